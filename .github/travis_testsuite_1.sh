@@ -250,6 +250,83 @@ testdir=t170_compress_all_methods_no_lzma_5_no_filter
 mkdir $testdir; v=expected_sha256sums__$testdir; echo -n "${!v}" >$testdir/.sha256sums.expected
 time testsuite_run_compress --all-methods --no-lzma -5 --no-filter
 
+# /***********************************************************************
+# // parallel in-place compression ('-j') of files with clashing names
+# // info: "x.ab1" and "x.ab2" share the temp name "x.upx" and the
+# //   backup name "x.ab~"
+# ************************************************************************/
+
+testsuite_run_parallel() {
+    local w=$testdir/w n=2
+    [[ " $* " == *" -k "* ]] && n=4
+    echo "# -j 2 $*"
+    rm -rf $w && mkdir $w
+    cp "$f1" $w/x.ab1 && cp "$f2" $w/x.ab2
+    if ! $upx_run -qq --prefer-ucl -1 -j 2 "$@" $w/x.ab1 $w/x.ab2 \
+    || [[ $(ls $w | wc -l) != $n ]] \
+    || ! $upx_run -qq -d -j 2 $w/x.ab1 $w/x.ab2 \
+    || ! cmp -s "$f1" $w/x.ab1 || ! cmp -s "$f2" $w/x.ab2; then
+        echo "UPX-ERROR: $testdir FAILED: -j 2 $*"
+        ls -l $w || true
+        exit_code=99
+        let num_errors+=1 || true
+        all_errors="${all_errors} $testdir"
+    fi
+}
+
+testdir=t180_compress_parallel_name_clash
+mkdir $testdir
+testsuite_header $testdir
+files=(t020_canonicalized/*/*)
+f1=${files[0]}; f2=${files[1]}
+testsuite_run_parallel
+testsuite_run_parallel -f
+testsuite_run_parallel -k
+testsuite_run_parallel -f -k
+
+# /***********************************************************************
+# // runtime tests: pack upx itself, then run the packed upx
+# // info: only where the packed program can run natively (linux/amd64)
+# ************************************************************************/
+
+testsuite_run_packed() {
+    local f=$testdir/upx.packed
+    echo "# $*"
+    rm -f $f $testdir/x.*
+    if ! $upx_run -qq "$@" $upx_exe -o $f \
+    || ! $f --version > $testdir/x.version \
+    || ! $upx_run --version | cmp -s - $testdir/x.version \
+    || ! $f -qq --prefer-ucl -1 $upx_exe -o $testdir/x.1 \
+    || ! $upx_run -qq --prefer-ucl -1 $upx_exe -o $testdir/x.2 \
+    || ! cmp -s $testdir/x.1 $testdir/x.2 \
+    || ! $f -q -t $f; then
+        echo "UPX-ERROR: $testdir FAILED: packed upx $*"
+        exit_code=99
+        let num_errors+=1 || true
+        all_errors="${all_errors} $testdir"
+    fi
+}
+
+if [[ $(uname -s -m) == "Linux x86_64" && $upx_run == "$upx_exe" \
+      && $(od -An -tx1 -N5 "$upx_exe") == " 7f 45 4c 46 02" \
+      && ! $BM_B =~ (^|\+)sanitize($|\+) ]]; then
+    testdir=t310_run_packed_hot_pages
+    mkdir $testdir
+    testsuite_header $testdir
+    # every other page of the first 1 MiB; one hot run of 256 KiB
+    for ((i = 0; i < 256; i += 2)); do echo $((i * 4096)); done > $testdir/hot.1
+    for ((i = 0; i < 64; i++)); do printf '0x%x\n' $(((160 + i) * 4096)); done > $testdir/hot.2
+    testsuite_run_packed -1 --hot-pages=$testdir/hot.1
+    testsuite_run_packed -1 --hot-pages=$testdir/hot.2
+    testsuite_run_packed --lzma -1 --hot-pages=$testdir/hot.1
+
+    testdir=t320_run_packed_lazy
+    mkdir $testdir
+    testsuite_header $testdir
+    testsuite_run_packed -1 --lazy
+    testsuite_run_packed --lzma -1 --lazy --hugepage-text
+fi
+
 # /***********************************************************************
 # // summary
 # ************************************************************************/
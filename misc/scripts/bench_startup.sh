@@ -0,0 +1,44 @@
+#! /usr/bin/env bash
+## vim:set ts=4 sw=4 et:
+set -e; set -o pipefail
+
+# Compare the startup of a program packed with different options.
+#
+# usage: bench_startup.sh UPX PROGRAM [ARGS...]
+#
+#   UPX_BENCH_OPTS   ';'-separated option sets, one packed copy for each
+#                    (default: see below; "-" means the unpacked program)
+#   UPX_BENCH_RUNS   runs of each copy (default 20)
+#   UPX_BENCH_EVENTS events for "perf stat" (default iTLB misses)
+#
+# Each copy is run with ARGS; pick ARGS which make PROGRAM exit quickly
+# (e.g. "--version"), so that the time is mostly decompression and the
+# first run of the code.  Uses "perf stat" when it is installed, else
+# the bash "time" builtin.
+
+[[ $# -ge 2 ]] || { echo "usage: $0 UPX PROGRAM [ARGS...]"; exit 1; }
+upx=$(readlink -fn "$1"); prog=$(readlink -fn "$2"); shift 2
+runs=${UPX_BENCH_RUNS:-20}
+events=${UPX_BENCH_EVENTS:-iTLB-load-misses,iTLB-loads,task-clock}
+IFS=';' read -r -a opts <<< "${UPX_BENCH_OPTS:--;;--lzma;--split-blocks=8;--hugepage-text;--lazy}"
+
+tmpdir=$(mktemp -d); trap 'rm -rf "$tmpdir"' EXIT
+i=0
+for o in "${opts[@]}"; do
+    f=$tmpdir/prog.$i; i=$((i+1))
+    name=${o:-(default)}
+    if [[ $o == - ]]; then
+        name='(unpacked)'; cp -p "$prog" "$f"
+    else
+        # shellcheck disable=SC2086
+        "$upx" -qqq --no-progress $o "$prog" -o "$f"
+    fi
+    printf '=== %-24s %10d bytes\n' "$name" "$(stat -c %s "$f")"
+    "$f" "$@" > /dev/null  # warm the page cache
+    if command -v perf > /dev/null; then
+        perf stat -r "$runs" -e "$events" -- "$f" "$@" 2>&1 > /dev/null |
+            grep -E '[0-9]' | grep -v 'Performance counter'
+    else
+        time (for ((k = 0; k < runs; k++)); do "$f" "$@" > /dev/null; done)
+    fi
+done
@@ -151,12 +151,94 @@ void con_fprintf(FILE *f, const char *format, ...)
     upx_safe_vsnprintf(buf, sizeof(buf), format,args);
     va_end(args);
 
+    if (con_capture_print(f,buf))
+        return;
     if (con == me)
         init(f,-1,-1);
     assert(con != me);
     con->print0(f,buf);
 }
 
+#else /* USE_CONSOLE */
+
+void con_fprintf(FILE *f, const char *format, ...)
+{
+    va_list args;
+    char buf[80*25];
+
+    va_start(args, format);
+    if (con_capture_active())
+    {
+        upx_safe_vsnprintf(buf, sizeof(buf), format,args);
+        con_capture_print(f,buf);
+    }
+    else
+        vfprintf(f,format,args);
+    va_end(args);
+}
+
 #endif /* USE_CONSOLE */
 
+
+/*************************************************************************
+// output capture
+**************************************************************************/
+
+static thread_local con_capture_t *capture = nullptr;
+
+
+void con_capture_begin(con_capture_t *c)
+{
+    assert(capture == nullptr);
+    memset(c, 0, sizeof(*c));
+    capture = c;
+}
+
+void con_capture_end(void)
+{
+    capture = nullptr;
+}
+
+bool con_capture_active(void)
+{
+    return capture != nullptr;
+}
+
+bool con_capture_print(FILE *f, const char *s)
+{
+    con_capture_t *c = capture;
+    if (c == nullptr)
+        return false;
+    size_t l = strlen(s);
+    if (c->len + l + 2 > c->size)
+    {
+        size_t size = UPX_MAX(c->size * 2, c->len + l + 2 + 1024);
+        char *buf = (char *) realloc(c->buf, size);
+        if (buf == nullptr)
+            throwOutOfMemoryException();
+        c->buf = buf;
+        c->size = size;
+    }
+    c->buf[c->len++] = (f == stderr) ? '2' : '1';
+    memcpy(c->buf + c->len, s, l + 1);
+    c->len += l + 1;
+    return true;
+}
+
+// print the captured output and free the buffer
+void con_capture_flush(con_capture_t *c)
+{
+    assert(capture != c);
+    for (size_t i = 0; i < c->len; )
+    {
+        FILE *f = (c->buf[i++] == '2') ? stderr : stdout;
+        const char *s = c->buf + i;
+        con_fprintf(f, "%s", s);
+        fflush(f);
+        i += strlen(s) + 1;
+    }
+    free(c->buf);
+    memset(c, 0, sizeof(*c));
+}
+
 /* vim:set ts=4 sw=4 et: */
@@ -0,0 +1,536 @@
+/* checksum.cpp -- adler32 and crc32 with runtime CPU dispatch
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2022 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2022 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+#include "conf.h"
+#include "compress.h"
+#include "mem.h"
+#include <chrono>
+
+// The vector kernels are bit-identical to upx_ucl_adler32() and
+// upx_ucl_crc32(), which remain the portable fallback.
+
+#if (ACC_ARCH_AMD64) && (ACC_CC_CLANG || ACC_CC_GNUC)
+#define WITH_CHECKSUM_X86 1
+#include <immintrin.h>
+#define TARGET_AVX2   __attribute__((__target__("avx2")))
+#define TARGET_PCLMUL __attribute__((__target__("pclmul,sse4.1")))
+#endif
+
+#if (ACC_ARCH_ARM64) && (ACC_CC_CLANG || ACC_CC_GNUC)
+#define WITH_CHECKSUM_NEON 1
+#include <arm_neon.h>
+#if defined(__ARM_FEATURE_CRC32)
+#define WITH_CHECKSUM_ARMV8_CRC 1
+#include <arm_acle.h>
+#define TARGET_CRC /*empty*/
+#elif (ACC_CC_GNUC && !ACC_CC_CLANG) && defined(__linux__)
+#define WITH_CHECKSUM_ARMV8_CRC 1
+#include <arm_acle.h>
+#include <sys/auxv.h>
+#define TARGET_CRC __attribute__((__target__("+crc")))
+#endif
+#endif
+
+#if !defined(WITH_CHECKSUM_X86)
+#define WITH_CHECKSUM_X86 0
+#endif
+#if !defined(WITH_CHECKSUM_NEON)
+#define WITH_CHECKSUM_NEON 0
+#endif
+#if !defined(WITH_CHECKSUM_ARMV8_CRC)
+#define WITH_CHECKSUM_ARMV8_CRC 0
+#endif
+
+typedef unsigned (*checksum_func_t)(const upx_byte *buf, unsigned len, unsigned sum);
+
+/*************************************************************************
+// adler32
+**************************************************************************/
+
+#define ADLER_BASE 65521u
+#define ADLER_NMAX 5552u // largest n such that 255n(n+1)/2 + (n+1)(BASE-1) < 2**32
+
+static unsigned adler32_ucl(const upx_byte *buf, unsigned len, unsigned adler) {
+    return upx_ucl_adler32(buf, len, adler);
+}
+
+// len < ADLER_NMAX
+static inline unsigned adler32_tail(const upx_byte *buf, unsigned len, unsigned s1, unsigned s2) {
+    while (len-- > 0) {
+        s1 += *buf++;
+        s2 += s1;
+    }
+    return ((s2 % ADLER_BASE) << 16) | (s1 % ADLER_BASE);
+}
+
+#if (WITH_CHECKSUM_X86)
+
+static inline unsigned hsum_epi32(__m128i v) {
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return (unsigned) _mm_cvtsi128_si32(v);
+}
+
+// 32 bytes per step; SSE2 is part of the amd64 baseline
+static unsigned adler32_sse2(const upx_byte *buf, unsigned len, unsigned adler) {
+    unsigned s1 = adler & 0xffff;
+    unsigned s2 = adler >> 16;
+    unsigned blocks = len / 32;
+    len -= blocks * 32;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i tap1 = _mm_setr_epi16(32, 31, 30, 29, 28, 27, 26, 25);
+    const __m128i tap2 = _mm_setr_epi16(24, 23, 22, 21, 20, 19, 18, 17);
+    const __m128i tap3 = _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9);
+    const __m128i tap4 = _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+    while (blocks > 0) {
+        unsigned n = UPX_MIN(blocks, ADLER_NMAX / 32);
+        blocks -= n;
+        __m128i v_ps = _mm_cvtsi32_si128((int) (s1 * n));
+        __m128i v_s2 = _mm_cvtsi32_si128((int) s2);
+        __m128i v_s1 = zero;
+        do {
+            const __m128i b1 = _mm_loadu_si128((const __m128i *) buf);
+            const __m128i b2 = _mm_loadu_si128((const __m128i *) (buf + 16));
+            v_ps = _mm_add_epi32(v_ps, v_s1);
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(b1, zero));
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(b2, zero));
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_unpacklo_epi8(b1, zero), tap1));
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_unpackhi_epi8(b1, zero), tap2));
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_unpacklo_epi8(b2, zero), tap3));
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_unpackhi_epi8(b2, zero), tap4));
+            buf += 32;
+        } while (--n);
+        v_s2 = _mm_add_epi32(v_s2, _mm_slli_epi32(v_ps, 5));
+        s1 = (s1 + hsum_epi32(v_s1)) % ADLER_BASE;
+        s2 = hsum_epi32(v_s2) % ADLER_BASE;
+    }
+    return adler32_tail(buf, len, s1, s2);
+}
+
+// 64 bytes per step
+TARGET_AVX2 static unsigned adler32_avx2(const upx_byte *buf, unsigned len, unsigned adler) {
+    unsigned s1 = adler & 0xffff;
+    unsigned s2 = adler >> 16;
+    unsigned blocks = len / 64;
+    len -= blocks * 64;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i tap1 = _mm256_setr_epi16(64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52,
+                                           51, 50, 49);
+    const __m256i tap2 = _mm256_setr_epi16(48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36,
+                                           35, 34, 33);
+    const __m256i tap3 = _mm256_setr_epi16(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20,
+                                           19, 18, 17);
+    const __m256i tap4 = _mm256_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    while (blocks > 0) {
+        unsigned n = UPX_MIN(blocks, ADLER_NMAX / 64);
+        blocks -= n;
+        __m256i v_ps = _mm256_setr_epi32((int) (s1 * n), 0, 0, 0, 0, 0, 0, 0);
+        __m256i v_s2 = _mm256_setr_epi32((int) s2, 0, 0, 0, 0, 0, 0, 0);
+        __m256i v_s1 = zero;
+        do {
+            const __m128i *p = (const __m128i *) buf;
+            const __m256i b1 = _mm256_loadu_si256((const __m256i *) buf);
+            const __m256i b2 = _mm256_loadu_si256((const __m256i *) (buf + 32));
+            v_ps = _mm256_add_epi32(v_ps, v_s1);
+            v_s1 = _mm256_add_epi32(v_s1, _mm256_sad_epu8(b1, zero));
+            v_s1 = _mm256_add_epi32(v_s1, _mm256_sad_epu8(b2, zero));
+            __m256i w;
+            w = _mm256_cvtepu8_epi16(_mm_loadu_si128(p + 0));
+            v_s2 = _mm256_add_epi32(v_s2, _mm256_madd_epi16(w, tap1));
+            w = _mm256_cvtepu8_epi16(_mm_loadu_si128(p + 1));
+            v_s2 = _mm256_add_epi32(v_s2, _mm256_madd_epi16(w, tap2));
+            w = _mm256_cvtepu8_epi16(_mm_loadu_si128(p + 2));
+            v_s2 = _mm256_add_epi32(v_s2, _mm256_madd_epi16(w, tap3));
+            w = _mm256_cvtepu8_epi16(_mm_loadu_si128(p + 3));
+            v_s2 = _mm256_add_epi32(v_s2, _mm256_madd_epi16(w, tap4));
+            buf += 64;
+        } while (--n);
+        v_s2 = _mm256_add_epi32(v_s2, _mm256_slli_epi32(v_ps, 6));
+        const __m128i s1x = _mm_add_epi32(_mm256_castsi256_si128(v_s1),
+                                          _mm256_extracti128_si256(v_s1, 1));
+        const __m128i s2x = _mm_add_epi32(_mm256_castsi256_si128(v_s2),
+                                          _mm256_extracti128_si256(v_s2, 1));
+        s1 = (s1 + hsum_epi32(s1x)) % ADLER_BASE;
+        s2 = hsum_epi32(s2x) % ADLER_BASE;
+    }
+    return adler32_tail(buf, len, s1, s2);
+}
+
+#endif // WITH_CHECKSUM_X86
+
+#if (WITH_CHECKSUM_NEON)
+
+// 32 bytes per step; NEON is part of the arm64 baseline
+static unsigned adler32_neon(const upx_byte *buf, unsigned len, unsigned adler) {
+    static const upx_uint16_t taps[32] = {32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22,
+                                          21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+                                          10, 9,  8,  7,  6,  5,  4,  3,  2,  1};
+    unsigned s1 = adler & 0xffff;
+    unsigned s2 = adler >> 16;
+    unsigned blocks = len / 32;
+    len -= blocks * 32;
+    while (blocks > 0) {
+        unsigned n = UPX_MIN(blocks, ADLER_NMAX / 32);
+        blocks -= n;
+        uint32x4_t v_s2 = vsetq_lane_u32(s1 * n, vdupq_n_u32(0), 0);
+        uint32x4_t v_s1 = vdupq_n_u32(0);
+        uint16x8_t col1 = vdupq_n_u16(0);
+        uint16x8_t col2 = vdupq_n_u16(0);
+        uint16x8_t col3 = vdupq_n_u16(0);
+        uint16x8_t col4 = vdupq_n_u16(0);
+        do {
+            const uint8x16_t b1 = vld1q_u8(buf);
+            const uint8x16_t b2 = vld1q_u8(buf + 16);
+            v_s2 = vaddq_u32(v_s2, v_s1);
+            v_s1 = vpadalq_u16(v_s1, vpadalq_u8(vpaddlq_u8(b1), b2));
+            col1 = vaddw_u8(col1, vget_low_u8(b1));
+            col2 = vaddw_u8(col2, vget_high_u8(b1));
+            col3 = vaddw_u8(col3, vget_low_u8(b2));
+            col4 = vaddw_u8(col4, vget_high_u8(b2));
+            buf += 32;
+        } while (--n);
+        v_s2 = vshlq_n_u32(v_s2, 5);
+        v_s2 = vmlal_u16(v_s2, vget_low_u16(col1), vld1_u16(taps + 0));
+        v_s2 = vmlal_u16(v_s2, vget_high_u16(col1), vld1_u16(taps + 4));
+        v_s2 = vmlal_u16(v_s2, vget_low_u16(col2), vld1_u16(taps + 8));
+        v_s2 = vmlal_u16(v_s2, vget_high_u16(col2), vld1_u16(taps + 12));
+        v_s2 = vmlal_u16(v_s2, vget_low_u16(col3), vld1_u16(taps + 16));
+        v_s2 = vmlal_u16(v_s2, vget_high_u16(col3), vld1_u16(taps + 20));
+        v_s2 = vmlal_u16(v_s2, vget_low_u16(col4), vld1_u16(taps + 24));
+        v_s2 = vmlal_u16(v_s2, vget_high_u16(col4), vld1_u16(taps + 28));
+        s1 = (s1 + vaddvq_u32(v_s1)) % ADLER_BASE;
+        s2 = (s2 + vaddvq_u32(v_s2)) % ADLER_BASE;
+    }
+    return adler32_tail(buf, len, s1, s2);
+}
+
+#endif // WITH_CHECKSUM_NEON
+
+/*************************************************************************
+// crc32 (the zlib polynomial)
+**************************************************************************/
+
+static unsigned crc32_ucl(const upx_byte *buf, unsigned len, unsigned crc) {
+    return upx_ucl_crc32(buf, len, crc);
+}
+
+#if (WITH_CHECKSUM_X86)
+
+// Fold 64 bytes at a time with carry-less multiplication and finish
+// with a Barrett reduction, see Intel's "Fast CRC Computation for
+// Generic Polynomials Using PCLMULQDQ Instruction".
+// crc is not inverted here; len >= 64 and a multiple of 16.
+TARGET_PCLMUL static unsigned crc32_pclmul_fold(const upx_byte *buf, unsigned len, unsigned crc) {
+    alignas(16) static const upx_uint64_t k1k2[2] = {0x0154442bd4ull, 0x01c6e41596ull};
+    alignas(16) static const upx_uint64_t k3k4[2] = {0x01751997d0ull, 0x00ccaa009eull};
+    alignas(16) static const upx_uint64_t k5k0[2] = {0x0163cd6124ull, 0};
+    alignas(16) static const upx_uint64_t poly[2] = {0x01db710641ull, 0x01f7011641ull};
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+    x1 = _mm_loadu_si128((const __m128i *) (buf + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *) (buf + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *) (buf + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *) (buf + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int) crc));
+    x0 = _mm_load_si128((const __m128i *) k1k2);
+    buf += 64;
+    len -= 64;
+    while (len >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i *) (buf + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i *) (buf + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i *) (buf + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i *) (buf + 0x30)));
+        buf += 64;
+        len -= 64;
+    }
+
+    // fold into 128 bits
+    x0 = _mm_load_si128((const __m128i *) k3k4);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+    while (len >= 16) {
+        x2 = _mm_loadu_si128((const __m128i *) buf);
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+        buf += 16;
+        len -= 16;
+    }
+
+    // fold 128 bits to 64 bits
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+    x0 = _mm_loadl_epi64((const __m128i *) k5k0);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x0 = _mm_load_si128((const __m128i *) poly);
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return (unsigned) _mm_extract_epi32(x1, 1);
+}
+
+static unsigned crc32_pclmul(const upx_byte *buf, unsigned len, unsigned crc) {
+    if (len >= 64) {
+        const unsigned n = len & ~15u;
+        crc = ~crc32_pclmul_fold(buf, n, ~crc);
+        buf += n;
+        len -= n;
+    }
+    return len ? upx_ucl_crc32(buf, len, crc) : crc;
+}
+
+#endif // WITH_CHECKSUM_X86
+
+#if (WITH_CHECKSUM_ARMV8_CRC)
+
+TARGET_CRC static unsigned crc32_armv8(const upx_byte *buf, unsigned len, unsigned crc) {
+    crc = ~crc;
+    while (len > 0 && ((acc_uintptr_t) buf & 7) != 0) {
+        crc = __crc32b(crc, *buf++);
+        len--;
+    }
+    for (; len >= 8; buf += 8, len -= 8)
+        crc = __crc32d(crc, get_le64(buf));
+    for (; len > 0; len--)
+        crc = __crc32b(crc, *buf++);
+    return ~crc;
+}
+
+#endif // WITH_CHECKSUM_ARMV8_CRC
+
+/*************************************************************************
+// runtime dispatch
+**************************************************************************/
+
+namespace {
+struct ChecksumImpl {
+    checksum_func_t adler32;
+    const char *adler32_name;
+    checksum_func_t crc32;
+    const char *crc32_name;
+    ChecksumImpl() {
+        adler32 = adler32_ucl;
+        adler32_name = "ucl";
+        crc32 = crc32_ucl;
+        crc32_name = "ucl";
+#if (WITH_CHECKSUM_X86)
+        adler32 = adler32_sse2;
+        adler32_name = "sse2";
+        if (__builtin_cpu_supports("avx2")) {
+            adler32 = adler32_avx2;
+            adler32_name = "avx2";
+        }
+        if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1")) {
+            crc32 = crc32_pclmul;
+            crc32_name = "pclmul";
+        }
+#endif
+#if (WITH_CHECKSUM_NEON)
+        adler32 = adler32_neon;
+        adler32_name = "neon";
+#endif
+#if (WITH_CHECKSUM_ARMV8_CRC)
+#if !defined(__ARM_FEATURE_CRC32)
+        if (getauxval(AT_HWCAP) & (1ul << 7)) // HWCAP_CRC32
+#endif
+        {
+            crc32 = crc32_armv8;
+            crc32_name = "armv8";
+        }
+#endif
+    }
+};
+} // namespace
+
+static const ChecksumImpl &checksum_impl() {
+    static const ChecksumImpl impl; // thread-safe initialization
+    return impl;
+}
+
+unsigned upx_adler32(const void *buf, unsigned len, unsigned adler) {
+    if (len == 0)
+        return adler;
+    assert(buf != nullptr);
+    return checksum_impl().adler32((const upx_byte *) buf, len, adler);
+}
+
+// Turn adler = upx_adler32(buf, len, old_adler) into upx_adler32(buf, len,
+// new_adler) without the data: s1 grows by the sum of the bytes, and s2
+// by len * s1_init plus a term that only depends on the data.
+unsigned upx_adler32_rebase(unsigned adler, unsigned len, unsigned old_adler,
+                            unsigned new_adler) {
+    const upx_uint64_t n = len % ADLER_BASE;
+    const upx_uint64_t d1 = (adler & 0xffff) + ADLER_BASE - (old_adler & 0xffff);
+    const upx_uint64_t d2 = (adler >> 16) + 2 * ADLER_BASE * ADLER_BASE - (old_adler >> 16) -
+                            n * (old_adler & 0xffff);
+    const upx_uint64_t s1 = (new_adler & 0xffff) + d1;
+    const upx_uint64_t s2 = (new_adler >> 16) + n * (new_adler & 0xffff) + d2;
+    return (unsigned) ((s2 % ADLER_BASE) << 16 | (s1 % ADLER_BASE));
+}
+
+unsigned upx_crc32(const void *buf, unsigned len, unsigned crc) {
+    if (len == 0)
+        return crc;
+    assert(buf != nullptr);
+    return checksum_impl().crc32((const upx_byte *) buf, len, crc);
+}
+
+/*************************************************************************
+// Debug checks
+**************************************************************************/
+
+namespace {
+struct ChecksumKernel {
+    const char *name;
+    checksum_func_t func;
+    bool supported;
+};
+} // namespace
+
+static unsigned checksum_kernels(ChecksumKernel *k, bool crc) {
+    unsigned n = 0;
+    if (!crc) {
+        k[n++] = {"ucl", adler32_ucl, true};
+#if (WITH_CHECKSUM_X86)
+        k[n++] = {"sse2", adler32_sse2, true};
+        k[n++] = {"avx2", adler32_avx2, !!__builtin_cpu_supports("avx2")};
+#endif
+#if (WITH_CHECKSUM_NEON)
+        k[n++] = {"neon", adler32_neon, true};
+#endif
+    } else {
+        k[n++] = {"ucl", crc32_ucl, true};
+#if (WITH_CHECKSUM_X86)
+        k[n++] = {"pclmul", crc32_pclmul, checksum_impl().crc32 == crc32_pclmul};
+#endif
+#if (WITH_CHECKSUM_ARMV8_CRC)
+        k[n++] = {"armv8", crc32_armv8, checksum_impl().crc32 == crc32_armv8};
+#endif
+    }
+    return n;
+}
+
+TEST_CASE("upx_adler32 upx_crc32") {
+    CHECK(upx_crc32("123456789", 9) == 0xcbf43926);
+    CHECK(upx_adler32("123456789", 9) == 0x091e01de);
+
+    MemBuffer mb(65536 + 64);
+    upx_byte *const buf = mb;
+    unsigned r = 0x12345678;
+    for (unsigned i = 0; i < mb.getSize(); i++) {
+        r = r * 1103515245 + 12345;
+        buf[i] = (upx_byte) (r >> 16);
+    }
+    memset(buf + 32768, 0xff, 16384); // worst case for the adler32 sums
+
+    for (int crc = 0; crc <= 1; crc++) {
+        ChecksumKernel k[8];
+        const unsigned nk = checksum_kernels(k, crc != 0);
+        for (unsigned len = 0; len <= 65536; len = len < 300 ? len + 1 : len * 3 + 7) {
+            for (unsigned off = 0; off < 64; off += 13) {
+                const unsigned init = crc ? r : (r % ADLER_BASE) | ((r >> 8) % ADLER_BASE) << 16;
+                const unsigned expect = k[0].func(buf + off, len, init);
+                for (unsigned i = 1; i < nk; i++)
+                    if (k[i].supported)
+                        CHECK(k[i].func(buf + off, len, init) == expect);
+                r = r * 1103515245 + 12345;
+            }
+        }
+        // the dispatched version
+        CHECK(crc ? upx_crc32(buf, 65536, 1) == crc32_ucl(buf, 65536, 1)
+                  : upx_adler32(buf, 65536, 1) == adler32_ucl(buf, 65536, 1));
+    }
+}
+
+TEST_CASE("upx_adler32_rebase") {
+    MemBuffer mb(70000);
+    upx_byte *const buf = mb;
+    unsigned r = 0x87654321;
+    for (unsigned i = 0; i < mb.getSize(); i++) {
+        r = r * 1103515245 + 12345;
+        buf[i] = (upx_byte) (r >> 16);
+    }
+    memset(buf + 20000, 0xff, 30000);
+    for (unsigned len = 0; len <= 70000; len = len < 100 ? len + 1 : len * 2 + 11) {
+        const unsigned a = upx_adler32(buf, len, 1);
+        const unsigned b = upx_adler32(buf, len, a);
+        CHECK(upx_adler32_rebase(a, len, 1, a) == b);
+        CHECK(upx_adler32_rebase(b, len, a, 1) == a);
+        CHECK(upx_adler32_rebase(b, len, a, 0xfff0fff0) == upx_adler32(buf, len, 0xfff0fff0));
+    }
+}
+
+// throughput benchmark; enabled with UPX_DEBUG_DOCTEST_VERBOSE=2
+TEST_CASE("upx_adler32 upx_crc32 benchmark") {
+    const char *e = getenv("UPX_DEBUG_DOCTEST_VERBOSE");
+    if (e == nullptr || strcmp(e, "2") != 0)
+        return;
+    const unsigned size = 1024 * 1024;
+    MemBuffer mb(size);
+    memset(mb, 0x5a, size);
+    for (int crc = 0; crc <= 1; crc++) {
+        ChecksumKernel k[8];
+        const unsigned nk = checksum_kernels(k, crc != 0);
+        for (unsigned i = 0; i < nk; i++) {
+            if (!k[i].supported)
+                continue;
+            unsigned sum = 0;
+            const auto t0 = std::chrono::steady_clock::now();
+            for (int loop = 0; loop < 256; loop++)
+                sum += k[i].func(mb, size, 1);
+            const std::chrono::duration<double> d = std::chrono::steady_clock::now() - t0;
+            printf("%-8s %-8s %8.1f MiB/s  (%08x)\n", crc ? "crc32" : "adler32", k[i].name,
+                   256.0 / (d.count() > 0 ? d.count() : 1e-9), sum);
+        }
+    }
+}
+
+/* vim:set ts=4 sw=4 et: */
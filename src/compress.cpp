@@ -31,38 +31,6 @@
 #include "mem.h"
 
 
-/*************************************************************************
-//
-**************************************************************************/
-
-unsigned upx_adler32(const void *buf, unsigned len, unsigned adler)
-{
-    if (len == 0)
-        return adler;
-    assert(buf != nullptr);
-#if 1
-    return upx_ucl_adler32(buf, len, adler);
-#else
-    return upx_zlib_adler32(buf, len, adler);
-#endif
-}
-
-
-#if 0 /* UNUSED */
-unsigned upx_crc32(const void *buf, unsigned len, unsigned crc)
-{
-    if (len == 0)
-        return crc;
-    assert(buf != nullptr);
-#if 1
-    return upx_ucl_crc32(buf, len, crc);
-#else
-    return upx_zlib_crc32(buf, len, crc);
-#endif
-}
-#endif /* UNUSED */
-
-
 /*************************************************************************
 //
 **************************************************************************/
@@ -108,6 +76,12 @@ int upx_compress( const upx_bytep src, unsigned  src_len,
         r = upx_lzma_compress(src, src_len, dst, dst_len,
                               cb, method, level, cconf, cresult);
 #endif
+    else if (M_IS_LZ4(method))
+        r = upx_lz4_compress(src, src_len, dst, dst_len,
+                             cb, method, level, cconf, cresult);
+    else if (M_IS_ZSTD(method))
+        r = upx_zstd_compress(src, src_len, dst, dst_len,
+                              cb, method, level, cconf, cresult);
 #if (WITH_NRV)
     else if ((M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method)) && !opt->prefer_ucl)
         r = upx_nrv_compress(src, src_len, dst, dst_len,
@@ -117,10 +91,19 @@ int upx_compress( const upx_bytep src, unsigned  src_len,
     else if (M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method))
         r = upx_ucl_compress(src, src_len, dst, dst_len,
                              cb, method, level, cconf, cresult);
+#endif
+#if (WITH_ZLIB)
+    else if (M_IS_DEFLATE(method))
+        r = upx_zlib_compress(src, src_len, dst, dst_len,
+                              cb, method, level, cconf, cresult);
 #endif
     else {
         throwInternalError("unknown compression method");
     }
+    // for the encoders which cannot give up early this at least
+    // saves the caller from verifying a useless result
+    if (r == UPX_E_OK && upx_compress_over_budget(cconf, *dst_len))
+        r = UPX_E_BUDGET_EXCEEDED;
 
 #if 1
     // debug
@@ -130,6 +113,37 @@ int upx_compress( const upx_bytep src, unsigned  src_len,
 }
 
 
+/*************************************************************************
+// Called by the encoders while compressing: has the compressed size
+// already reached cconf->budget? Only what has been written so far
+// counts, so a candidate never gives up unless it is sure to lose.
+**************************************************************************/
+
+bool upx_compress_over_budget(const upx_compress_config_t *cconf, unsigned c_pos)
+{
+    return cconf != nullptr && cconf->budget != 0 && c_pos >= cconf->budget;
+}
+
+
+/*************************************************************************
+// how often the encoders could reuse their pooled state (-D)
+**************************************************************************/
+
+void upx_compress_print_stats(void)
+{
+    unsigned n = 0, reused = 0;
+    UNUSED(n); UNUSED(reused);
+#if (WITH_LZMA)
+    upx_lzma_pool_stats(&n, &reused);
+    con_fprintf(stdout, "  lzma encoders: %u created, %u reused\n", n, reused);
+#endif
+#if (WITH_UCL)
+    upx_ucl_pool_stats(&n, &reused);
+    con_fprintf(stdout, "  ucl work memory: %u allocated, %u reused\n", n, reused);
+#endif
+}
+
+
 /*************************************************************************
 //
 **************************************************************************/
@@ -153,6 +167,10 @@ int upx_decompress(const upx_bytep src, unsigned  src_len,
     else if (M_IS_LZMA(method))
         r = upx_lzma_decompress(src, src_len, dst, dst_len, method, cresult);
 #endif
+    else if (M_IS_LZ4(method))
+        r = upx_lz4_decompress(src, src_len, dst, dst_len, method, cresult);
+    else if (M_IS_ZSTD(method))
+        r = upx_zstd_decompress(src, src_len, dst, dst_len, method, cresult);
 #if (WITH_NRV)
     else if ((M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method)) && !opt->prefer_ucl)
         r = upx_nrv_decompress(src, src_len, dst, dst_len, method, cresult);
@@ -200,6 +218,10 @@ int upx_test_overlap( const upx_bytep buf,
     else if (M_IS_LZMA(method))
         r = upx_lzma_test_overlap(buf, tbuf, src_off, src_len, dst_len, method, cresult);
 #endif
+    else if (M_IS_LZ4(method))
+        r = upx_lz4_test_overlap(buf, tbuf, src_off, src_len, dst_len, method, cresult);
+    else if (M_IS_ZSTD(method))
+        r = upx_zstd_test_overlap(buf, tbuf, src_off, src_len, dst_len, method, cresult);
 #if (WITH_NRV)
     else if ((M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method)) && !opt->prefer_ucl)
         r = upx_nrv_test_overlap(buf, tbuf, src_off, src_len, dst_len, method, cresult);
@@ -207,6 +229,10 @@ int upx_test_overlap( const upx_bytep buf,
 #if (WITH_UCL)
     else if (M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method))
         r = upx_ucl_test_overlap(buf, tbuf, src_off, src_len, dst_len, method, cresult);
+#endif
+#if (WITH_ZLIB)
+    else if (M_IS_DEFLATE(method))
+        r = upx_zlib_test_overlap(buf, tbuf, src_off, src_len, dst_len, method, cresult);
 #endif
     else {
         throwInternalError("unknown decompression method");
@@ -215,4 +241,57 @@ int upx_test_overlap( const upx_bytep buf,
     return r;
 }
 
+
+/*************************************************************************
+// Find the smallest overlap_overhead that upx_test_overlap() would
+// accept, using a single decompression pass.
+//
+// Returns UPX_E_NOT_YET_IMPLEMENTED if the method does not support this,
+// in which case the caller has to search by calling upx_test_overlap().
+**************************************************************************/
+
+int upx_find_overlap( const upx_bytep src, unsigned src_len,
+                            unsigned  dst_len,
+                            unsigned* overlap_overhead,
+                            int method,
+                      const upx_compress_result_t *cresult )
+{
+    int r = UPX_E_NOT_YET_IMPLEMENTED;
+    unsigned src_off = 0;
+
+    if (cresult && cresult->method == 0)
+        cresult = nullptr;
+
+    assert(dst_len > 0);
+    assert(src_len < dst_len); // must be compressed
+
+    if __acc_cte(0) {
+    }
+#if (WITH_LZMA)
+    else if (M_IS_LZMA(method))
+        r = upx_lzma_find_overlap(src, src_len, dst_len, &src_off, method, cresult);
+#endif
+    else if (M_IS_LZ4(method))
+        r = upx_lz4_find_overlap(src, src_len, dst_len, &src_off, method, cresult);
+    else if (M_IS_ZSTD(method))
+        r = upx_zstd_find_overlap(src, src_len, dst_len, &src_off, method, cresult);
+#if (WITH_UCL)
+    // NRV uses the very same bitstream, so this works for both libraries
+    else if (M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method))
+        r = upx_ucl_find_overlap(src, src_len, dst_len, &src_off, method, cresult);
+#endif
+#if (WITH_ZLIB)
+    else if (M_IS_DEFLATE(method))
+        r = upx_zlib_find_overlap(src, src_len, dst_len, &src_off, method, cresult);
+#endif
+
+    if (r == UPX_E_OK)
+    {
+        // upx_test_overlap() needs a positive overlap_overhead
+        src_off = UPX_MAX(src_off, dst_len - src_len + 1);
+        *overlap_overhead = src_off + src_len - dst_len;
+    }
+    return r;
+}
+
 /* vim:set ts=4 sw=4 et: */
@@ -53,9 +53,64 @@ int upx_lzma_test_overlap  ( const upx_bytep buf,
                                    unsigned* dst_len,
                                    int method,
                              const upx_compress_result_t *cresult );
+int upx_lzma_find_overlap  ( const upx_bytep src, unsigned src_len,
+                                   unsigned  dst_len,
+                                   unsigned* src_off,
+                                   int method,
+                             const upx_compress_result_t *cresult );
+int upx_lzma_tune          ( const upx_bytep src, unsigned src_len,
+                                   int level,
+                             const upx_compress_config_t *cconf,
+                                   lzma_compress_config_t *result );
+void upx_lzma_pool_stats(unsigned *created, unsigned *reused);
 #endif
 
 
+int upx_lz4_compress       ( const upx_bytep src, unsigned  src_len,
+                                   upx_bytep dst, unsigned* dst_len,
+                                   upx_callback_p cb,
+                                   int method, int level,
+                             const upx_compress_config_t *cconf,
+                                   upx_compress_result_t *cresult );
+int upx_lz4_decompress     ( const upx_bytep src, unsigned  src_len,
+                                   upx_bytep dst, unsigned* dst_len,
+                                   int method,
+                             const upx_compress_result_t *cresult );
+int upx_lz4_test_overlap   ( const upx_bytep buf,
+                             const upx_bytep tbuf,
+                                   unsigned  src_off, unsigned src_len,
+                                   unsigned* dst_len,
+                                   int method,
+                             const upx_compress_result_t *cresult );
+int upx_lz4_find_overlap   ( const upx_bytep src, unsigned src_len,
+                                   unsigned  dst_len,
+                                   unsigned* src_off,
+                                   int method,
+                             const upx_compress_result_t *cresult );
+
+int upx_zstd_compress      ( const upx_bytep src, unsigned  src_len,
+                                   upx_bytep dst, unsigned* dst_len,
+                                   upx_callback_p cb,
+                                   int method, int level,
+                             const upx_compress_config_t *cconf,
+                                   upx_compress_result_t *cresult );
+int upx_zstd_decompress    ( const upx_bytep src, unsigned  src_len,
+                                   upx_bytep dst, unsigned* dst_len,
+                                   int method,
+                             const upx_compress_result_t *cresult );
+int upx_zstd_test_overlap  ( const upx_bytep buf,
+                             const upx_bytep tbuf,
+                                   unsigned  src_off, unsigned src_len,
+                                   unsigned* dst_len,
+                                   int method,
+                             const upx_compress_result_t *cresult );
+int upx_zstd_find_overlap  ( const upx_bytep src, unsigned src_len,
+                                   unsigned  dst_len,
+                                   unsigned* src_off,
+                                   int method,
+                             const upx_compress_result_t *cresult );
+
+
 #if (WITH_NRV)
 int upx_nrv_init(void);
 const char *upx_nrv_version_string(void);
@@ -97,8 +152,14 @@ int upx_ucl_test_overlap   ( const upx_bytep buf,
                                    unsigned* dst_len,
                                    int method,
                              const upx_compress_result_t *cresult );
+int upx_ucl_find_overlap   ( const upx_bytep src, unsigned src_len,
+                                   unsigned  dst_len,
+                                   unsigned* src_off,
+                                   int method,
+                             const upx_compress_result_t *cresult );
 unsigned upx_ucl_adler32(const void *buf, unsigned len, unsigned adler);
 unsigned upx_ucl_crc32  (const void *buf, unsigned len, unsigned crc);
+void upx_ucl_pool_stats(unsigned *allocs, unsigned *reuses);
 #endif
 
 
@@ -121,6 +182,11 @@ int upx_zlib_test_overlap  ( const upx_bytep buf,
                                    unsigned* dst_len,
                                    int method,
                              const upx_compress_result_t *cresult );
+int upx_zlib_find_overlap  ( const upx_bytep src, unsigned src_len,
+                                   unsigned  dst_len,
+                                   unsigned* src_off,
+                                   int method,
+                             const upx_compress_result_t *cresult );
 unsigned upx_zlib_adler32(const void *buf, unsigned len, unsigned adler);
 unsigned upx_zlib_crc32  (const void *buf, unsigned len, unsigned crc);
 #endif
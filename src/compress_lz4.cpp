@@ -0,0 +1,503 @@
+/* compress_lz4.cpp --
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2022 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2022 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+
+#include "conf.h"
+#include "compress.h"
+#include "mem.h"
+
+
+/*************************************************************************
+// M_LZ4 uses the LZ4 block format: a sequence is a token byte
+// (literal length << 4 | match length - 4), optional extra literal
+// length bytes, the literals, a 16-bit little-endian offset and
+// optional extra match length bytes; a length nibble of 15 is followed
+// by bytes that are added until one is not 255. The last sequence only
+// has literals, and the block simply ends with the input.
+//
+// All byte-oriented, so the stub decompressors come close to memcpy()
+// speed. The stubs copy exactly forward, which is what
+// upx_lz4_test_overlap() and upx_lz4_find_overlap() assume.
+**************************************************************************/
+
+namespace {
+
+enum {
+    LZ4_MIN_MATCH = 4,
+    LZ4_LAST_LITERALS = 5,  // the block ends with at least 5 literals
+    LZ4_MF_LIMIT = 12,      // no match starts within the last 12 bytes
+    LZ4_MAX_OFFSET = 65535
+};
+
+class Lz4Encoder
+{
+public:
+    Lz4Encoder(const upx_bytep src_, unsigned src_len_, upx_bytep dst_, unsigned dst_len_,
+               int level);
+    int compress(unsigned *dst_len, upx_callback_p cb, const upx_compress_config_t *cconf);
+
+private:
+    enum { HBITS = 16, WSIZE = 1 << 16 };
+    static const unsigned NIL = 0xffffffffu;
+
+    const upx_byte *const src;
+    const unsigned src_len;
+    upx_byte *const dst;
+    const unsigned dst_len;
+    unsigned olen = 0;
+    unsigned depth;
+    bool lazy;
+    bool skip;          // speed up incompressible stretches
+    unsigned ins = 0;   // next position to insert
+    MemBuffer head_buf, prev_buf;
+    unsigned *head;
+    unsigned short *prev;
+
+    static unsigned hash(const upx_byte *p)
+    {
+        return (get_le32(p) * 0x9e3779b1u) >> (32 - HBITS);
+    }
+    void insertUpTo(unsigned pos);
+    unsigned find(unsigned pos, unsigned *off);
+    bool putLength(unsigned len);
+    bool putSequence(unsigned anchor, unsigned lit, unsigned off, unsigned len);
+};
+
+Lz4Encoder::Lz4Encoder(const upx_bytep src_, unsigned src_len_, upx_bytep dst_,
+                       unsigned dst_len_, int level) :
+    src(src_), src_len(src_len_), dst(dst_), dst_len(dst_len_)
+{
+    static const unsigned short depths[11] = { 0, 1, 1, 2, 4, 8, 16, 32, 64, 128, 256 };
+    level = UPX_MAX(1, UPX_MIN(level, 10));
+    depth = depths[level];
+    lazy = level >= 5;
+    skip = level <= 2;
+    head_buf.alloc(sizeof(*head) << HBITS);
+    head_buf.fill(0, head_buf.getSize(), 0xff);
+    prev_buf.alloc(sizeof(*prev) * WSIZE);
+    head = (unsigned *) (upx_bytep) head_buf;
+    prev = (unsigned short *) (upx_bytep) prev_buf;
+}
+
+// the chains store the distance to the previous position with the
+// same hash; 0xffff also ends a chain because of LZ4_MAX_OFFSET
+void Lz4Encoder::insertUpTo(unsigned pos)
+{
+    const unsigned last = UPX_MIN(pos, src_len - LZ4_MIN_MATCH + 1);
+    for ( ; ins < last; ins++)
+    {
+        const unsigned h = hash(src + ins);
+        const unsigned c = head[h];
+        prev[ins & (WSIZE - 1)] = (unsigned short) (c == NIL ? 0xffff : UPX_MIN(ins - c, 0xffffu));
+        head[h] = ins;
+    }
+}
+
+unsigned Lz4Encoder::find(unsigned pos, unsigned *off)
+{
+    insertUpTo(pos);
+    const upx_byte *const cur = src + pos;
+    const unsigned max_len = src_len - LZ4_LAST_LITERALS - pos;
+    unsigned best = LZ4_MIN_MATCH - 1;
+    unsigned c = head[hash(cur)];
+    for (unsigned i = depth; i > 0 && c != NIL && pos - c <= LZ4_MAX_OFFSET; i--)
+    {
+        if (src[c + best] == cur[best] && get_ne32(src + c) == get_ne32(cur))
+        {
+            unsigned len = LZ4_MIN_MATCH;
+            while (len + 4 <= max_len && get_ne32(src + c + len) == get_ne32(cur + len))
+                len += 4;
+            while (len < max_len && src[c + len] == cur[len])
+                len++;
+            if (len > best)
+            {
+                best = len;
+                *off = pos - c;
+                if (len >= max_len)
+                    break;
+            }
+        }
+        const unsigned d = prev[c & (WSIZE - 1)];
+        if (d == 0xffff || d > c)
+            break;
+        c -= d;
+    }
+    return best >= LZ4_MIN_MATCH ? best : 0;
+}
+
+bool Lz4Encoder::putLength(unsigned len)
+{
+    for ( ; len >= 255; len -= 255)
+    {
+        if (olen >= dst_len)
+            return false;
+        dst[olen++] = 255;
+    }
+    if (olen >= dst_len)
+        return false;
+    dst[olen++] = (upx_byte) len;
+    return true;
+}
+
+// a "len" of 0 means the final run of literals
+bool Lz4Encoder::putSequence(unsigned anchor, unsigned lit, unsigned off, unsigned len)
+{
+    const unsigned ml = len ? len - LZ4_MIN_MATCH : 0;
+    if (olen >= dst_len)
+        return false;
+    dst[olen++] = (upx_byte) ((UPX_MIN(lit, 15u) << 4) | UPX_MIN(ml, 15u));
+    if (lit >= 15 && !putLength(lit - 15))
+        return false;
+    if (lit > dst_len - olen)
+        return false;
+    memcpy(dst + olen, src + anchor, lit);
+    olen += lit;
+    if (len == 0)
+        return true;
+    if (dst_len - olen < 2)
+        return false;
+    set_le16(dst + olen, off);
+    olen += 2;
+    if (ml >= 15 && !putLength(ml - 15))
+        return false;
+    return true;
+}
+
+int Lz4Encoder::compress(unsigned *out_len, upx_callback_p cb, const upx_compress_config_t *cconf)
+{
+    unsigned pos = 0, anchor = 0;
+    unsigned misses = 0;
+    unsigned next_progress = 0;
+    // small steps for small inputs, for the sake of the budget check
+    const unsigned progress_step = UPX_MIN(256 * 1024u, src_len / 16 + 1);
+
+    while (src_len >= LZ4_MF_LIMIT && pos <= src_len - LZ4_MF_LIMIT)
+    {
+        if (pos >= next_progress)
+        {
+            if (cb && cb->nprogress)
+                cb->nprogress(cb, pos, olen);
+            if (upx_compress_over_budget(cconf, olen))
+                return UPX_E_BUDGET_EXCEEDED;
+            next_progress = pos + progress_step;
+        }
+        unsigned off = 0;
+        unsigned len = find(pos, &off);
+        if (len == 0)
+        {
+            pos += skip ? 1 + (misses++ >> 6) : 1;
+            continue;
+        }
+        while (lazy && pos + 1 <= src_len - LZ4_MF_LIMIT)
+        {
+            unsigned off2 = 0;
+            const unsigned len2 = find(pos + 1, &off2);
+            if (len2 <= len)
+                break;
+            pos++;
+            len = len2;
+            off = off2;
+        }
+        if (!putSequence(anchor, pos - anchor, off, len))
+            return UPX_E_NOT_COMPRESSIBLE;
+        pos += len;
+        anchor = pos;
+        misses = 0;
+    }
+    if (!putSequence(anchor, src_len - anchor, 0, 0))
+        return UPX_E_NOT_COMPRESSIBLE;
+    if (cb && cb->nprogress)
+        cb->nprogress(cb, src_len, olen);
+    *out_len = olen;
+    return UPX_E_OK;
+}
+
+
+// Decode a block into dst[0..*dst_len); src and dst may overlap like
+// in upx_lz4_test_overlap(). If "need" is given, it returns the
+// smallest offset of src in dst that allows in-place decompression.
+static int lz4_decode(const upx_byte *src, unsigned src_len,
+                      upx_byte *dst, unsigned *dst_len, unsigned *need)
+{
+    const unsigned dst_cap = *dst_len;
+    unsigned ilen = 0, olen = 0, n = 0;
+    // the stubs write the output of a sequence after they have read
+    // its input, so "olen <= src_off + ilen" must hold before each write
+#define NOTE_NEED(x)    if ((x) > ilen && (x) - ilen > n) n = (x) - ilen
+
+    *dst_len = 0;
+    for (;;)
+    {
+        if (ilen >= src_len)
+            return UPX_E_INPUT_OVERRUN;
+        const unsigned token = src[ilen++];
+        unsigned lit = token >> 4;
+        if (lit == 15)
+        {
+            unsigned b;
+            do {
+                if (ilen >= src_len)
+                    return UPX_E_INPUT_OVERRUN;
+                b = src[ilen++];
+                lit += b;
+            } while (b == 255 && lit < src_len);
+        }
+        if (lit > src_len - ilen)
+            return UPX_E_INPUT_OVERRUN;
+        if (lit > dst_cap - olen)
+            return UPX_E_OUTPUT_OVERRUN;
+        NOTE_NEED(olen);
+        memmove(dst + olen, src + ilen, lit);
+        ilen += lit;
+        olen += lit;
+        if (ilen == src_len)
+            break;
+
+        if (src_len - ilen < 2)
+            return UPX_E_INPUT_OVERRUN;
+        const unsigned off = get_le16(src + ilen);
+        ilen += 2;
+        if (off == 0 || off > olen)
+            return UPX_E_LOOKBEHIND_OVERRUN;
+        unsigned len = (token & 15) + LZ4_MIN_MATCH;
+        if ((token & 15) == 15)
+        {
+            unsigned b;
+            do {
+                if (ilen >= src_len)
+                    return UPX_E_INPUT_OVERRUN;
+                b = src[ilen++];
+                len += b;
+            } while (b == 255 && len <= dst_cap);
+        }
+        if (len > dst_cap - olen)
+            return UPX_E_OUTPUT_OVERRUN;
+        NOTE_NEED(olen + len);
+        for (upx_byte *d = dst + olen, *const e = d + len; d != e; d++)
+            *d = *(d - off);
+        olen += len;
+    }
+#undef NOTE_NEED
+
+    *dst_len = olen;
+    if (need)
+        *need = n;
+    return UPX_E_OK;
+}
+
+} // namespace
+
+
+/*************************************************************************
+//
+**************************************************************************/
+
+int upx_lz4_compress       ( const upx_bytep src, unsigned  src_len,
+                                   upx_bytep dst, unsigned* dst_len,
+                                   upx_callback_p cb,
+                                   int method, int level,
+                             const upx_compress_config_t *cconf_parm,
+                                   upx_compress_result_t *cresult )
+{
+    assert(method == M_LZ4);
+    assert(level > 0); assert(cresult != nullptr);
+    UNUSED(method);
+    int r;
+    unsigned c_len = 0;
+
+    try {
+        Lz4Encoder enc(src, src_len, dst, *dst_len, level);
+        r = enc.compress(&c_len, cb, cconf_parm);
+    } catch (...) {
+        r = UPX_E_OUT_OF_MEMORY;
+    }
+    *dst_len = c_len;
+    return r;
+}
+
+
+/*************************************************************************
+//
+**************************************************************************/
+
+int upx_lz4_decompress     ( const upx_bytep src, unsigned  src_len,
+                                   upx_bytep dst, unsigned* dst_len,
+                                   int method,
+                             const upx_compress_result_t *cresult )
+{
+    assert(method == M_LZ4);
+    UNUSED(method);
+    UNUSED(cresult);
+    return lz4_decode(src, src_len, dst, dst_len, nullptr);
+}
+
+
+/*************************************************************************
+// test_overlap - see <ucl/ucl.h> for semantics
+**************************************************************************/
+
+int upx_lz4_test_overlap   ( const upx_bytep buf,
+                             const upx_bytep tbuf,
+                                   unsigned  src_off, unsigned src_len,
+                                   unsigned* dst_len,
+                                   int method,
+                             const upx_compress_result_t *cresult )
+{
+    assert(method == M_LZ4);
+    UNUSED(method);
+    UNUSED(cresult);
+
+    MemBuffer b(src_off + src_len);
+    memcpy(b + src_off, buf + src_off, src_len);
+    unsigned saved_dst_len = *dst_len;
+    unsigned need = 0;
+    int r = lz4_decode(b + src_off, src_len, b, dst_len, &need);
+    if (r != UPX_E_OK)
+        return r;
+    if (*dst_len != saved_dst_len || need > src_off)
+        return UPX_E_ERROR;
+    if (tbuf != nullptr && memcmp(tbuf, b, *dst_len) != 0)
+        return UPX_E_ERROR;
+    return UPX_E_OK;
+}
+
+int upx_lz4_find_overlap   ( const upx_bytep src, unsigned src_len,
+                                   unsigned  dst_len,
+                                   unsigned* src_off,
+                                   int method,
+                             const upx_compress_result_t *cresult )
+{
+    assert(method == M_LZ4);
+    UNUSED(method);
+    UNUSED(cresult);
+
+    MemBuffer b(dst_len);
+    unsigned d_len = dst_len;
+    int r = lz4_decode(src, src_len, b, &d_len, src_off);
+    if (r != UPX_E_OK)
+        return r;
+    return d_len == dst_len ? UPX_E_OK : UPX_E_ERROR;
+}
+
+
+/*************************************************************************
+// Debug checks
+**************************************************************************/
+
+#if DEBUG && 1
+
+static bool check_lz4(const upx_bytep u_buf, unsigned u_len, int level)
+{
+    MemBuffer c_buf, d_buf;
+    upx_compress_result_t cresult;
+    unsigned c_len, d_len;
+    int r;
+
+    c_buf.allocForCompression(u_len);
+    d_buf.allocForUncompression(u_len);
+    c_len = c_buf.getSize();
+    r = upx_lz4_compress(u_buf, u_len, c_buf, &c_len, nullptr, M_LZ4, level, NULL_cconf, &cresult);
+    if (r != 0) return false;
+    d_len = d_buf.getSize();
+    r = upx_lz4_decompress(c_buf, c_len, d_buf, &d_len, M_LZ4, nullptr);
+    if (r != 0 || d_len != u_len || memcmp(u_buf, d_buf, u_len) != 0) return false;
+    if (c_len >= u_len)
+        return true;
+
+    // in-place decompression must work with exactly the overlap found
+    unsigned src_off = 0;
+    r = upx_lz4_find_overlap(c_buf, c_len, u_len, &src_off, M_LZ4, nullptr);
+    if (r != 0) return false;
+    src_off = UPX_MAX(src_off, u_len - c_len + 1);
+    MemBuffer o_buf(src_off + c_len);
+    memcpy(o_buf + src_off, c_buf, c_len);
+    unsigned x_len = u_len;
+    r = upx_lz4_test_overlap(o_buf, u_buf, src_off, c_len, &x_len, M_LZ4, nullptr);
+    if (r != 0 || x_len != u_len) return false;
+    if (src_off > u_len - c_len + 1)
+    {
+        memcpy(o_buf + src_off - 1, c_buf, c_len);
+        x_len = u_len;
+        r = upx_lz4_test_overlap(o_buf, u_buf, src_off - 1, c_len, &x_len, M_LZ4, nullptr);
+        if (r == 0) return false;
+    }
+    return true;
+}
+
+TEST_CASE("compress_lz4") {
+    const unsigned u_len = 200000;
+    MemBuffer u_buf(u_len);
+    // literal runs followed by copies, including long and overlapping ones
+    unsigned x = 1;
+    for (unsigned i = 0; i < u_len; ) {
+        x = x * 1103515245 + 12345;
+        const unsigned n = (x & 0x40000) ? 1 + ((x >> 16) & 1023) : 1 + ((x >> 16) & 31);
+        const bool copy = i >= 16 && (x & 3) != 0;
+        const unsigned off = copy ? 1 + ((x >> 4) % UPX_MIN(i, 70000u)) : 0;
+        for (unsigned j = 0; j < n && i < u_len; j++, i++) {
+            x = x * 1103515245 + 12345;
+            u_buf[i] = copy ? u_buf[i - off] : (upx_byte) (x >> 23);
+        }
+    }
+    for (int level = 1; level <= 10; level++)
+        CHECK(check_lz4(u_buf, u_len, level));
+    // give up as soon as the budget is reached
+    {
+        upx_compress_config_t cconf;
+        cconf.reset();
+        MemBuffer c_buf;
+        c_buf.allocForCompression(u_len);
+        unsigned c_len = c_buf.getSize();
+        CHECK(upx_compress(u_buf, u_len, c_buf, &c_len, nullptr, M_LZ4, 1, &cconf, nullptr) == 0);
+        const unsigned full_len = c_len;
+        cconf.budget = full_len + 1;
+        c_len = c_buf.getSize();
+        CHECK(upx_compress(u_buf, u_len, c_buf, &c_len, nullptr, M_LZ4, 1, &cconf, nullptr) == 0);
+        CHECK(c_len == full_len);
+        cconf.budget = full_len;
+        c_len = c_buf.getSize();
+        CHECK(upx_compress(u_buf, u_len, c_buf, &c_len, nullptr, M_LZ4, 1, &cconf, nullptr) ==
+              UPX_E_BUDGET_EXCEEDED);
+        CHECK(upx_compress_over_budget(&cconf, full_len));
+        CHECK(!upx_compress_over_budget(&cconf, full_len - 1));
+    }
+    // tiny and incompressible inputs are all literals
+    CHECK(check_lz4(u_buf, 1, 1));
+    CHECK(check_lz4(u_buf, 12, 9));
+    CHECK(check_lz4(u_buf, 13, 9));
+    for (unsigned i = 0; i < 4096; i++)
+        u_buf[i] = (upx_byte) ((i * 0x9e3779b1u) >> 24);
+    CHECK(check_lz4(u_buf, 4096, 1));
+    // a single long run
+    memset(u_buf, 'x', u_len);
+    CHECK(check_lz4(u_buf, u_len, 1));
+    CHECK(check_lz4(u_buf, u_len, 10));
+}
+
+#endif // DEBUG
+
+/* vim:set ts=4 sw=4 et: */
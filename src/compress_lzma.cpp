@@ -29,6 +29,12 @@
 #include "conf.h"
 #include "compress.h"
 #include "mem.h"
+#include "parallel.h"
+#if (WITH_THREADS)
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+#endif
 
 #if (ACC_CC_CLANG)
 #  pragma clang diagnostic ignored "-Wshadow"
@@ -294,12 +300,16 @@ struct ProgressInfo : public ICompressProgressInfo, public CMyUnknownImp
     MY_UNKNOWN_IMP
     STDMETHOD(SetRatioInfo)(const UInt64 *inSize, const UInt64 *outSize);
     upx_callback_p cb;
+    const upx_compress_config_t *cconf;
 };
 
 STDMETHODIMP ProgressInfo::SetRatioInfo(const UInt64 *inSize, const UInt64 *outSize)
 {
     if (cb && cb->nprogress)
         cb->nprogress(cb, (unsigned) *inSize, (unsigned) *outSize);
+    // the encoder stops with this result
+    if (upx_compress_over_budget(cconf, (unsigned) *outSize))
+        return E_ABORT;
     return S_OK;
 }
 
@@ -317,6 +327,875 @@ STDMETHODIMP ProgressInfo::SetRatioInfo(const UInt64 *inSize, const UInt64 *outS
 #include "C/7zip/Compress/RangeCoder/RangeCoderBit.cpp"
 #undef RC_NORMALIZE
 
+namespace MyLzma {
+
+// Setting up a CEncoder allocates the BT4 match finder, which is by far
+// the most expensive part for small inputs, and --brute asks for one per
+// candidate. So every thread keeps its last encoder: CEncoder::Create()
+// only reallocates when the dictionary size or the number of fast bytes
+// changes and Code() resets all other state. The match finder cycles
+// are applied only when the match finder is created, so they are part
+// of the key. The streams live here as well, as the encoder may still
+// hold pointers to them after Code() has returned. The match finder
+// needs more than ten times the dictionary size, so an encoder with a
+// big dictionary is not kept; a thread would hold on to it until exit.
+struct EncoderPool
+{
+    enum { MAX_DICT_SIZE = 1024 * 1024 };
+    InStream is;
+    OutStream os;
+    ProgressInfo progress;
+    NCompress::NLZMA::CEncoder *enc = nullptr;
+    unsigned match_finder_cycles = 0;
+    EncoderPool() { is.AddRef(); os.AddRef(); progress.AddRef(); }
+    ~EncoderPool() { drop(); }
+
+    NCompress::NLZMA::CEncoder *get(unsigned mfc);
+    void drop() { delete enc; enc = nullptr; }
+};
+
+static thread_local EncoderPool encoder_pool;
+static std::atomic<unsigned> encoder_pool_created(0);
+static std::atomic<unsigned> encoder_pool_reused(0);
+
+NCompress::NLZMA::CEncoder *EncoderPool::get(unsigned mfc)
+{
+    if (enc != nullptr && match_finder_cycles == mfc)
+    {
+        encoder_pool_reused++;
+        return enc;
+    }
+    drop();
+    enc = new NCompress::NLZMA::CEncoder;
+    match_finder_cycles = mfc;
+    encoder_pool_created++;
+    return enc;
+}
+
+} // namespace
+
+void upx_lzma_pool_stats(unsigned *created, unsigned *reused)
+{
+    *created = MyLzma::encoder_pool_created;
+    *reused = MyLzma::encoder_pool_reused;
+}
+
+
+/*************************************************************************
+// parallel LZMA encoder
+//
+// The LZMA SDK encoder runs its BT4 match finder inline. For the LZMA
+// "fast mode" (levels 1-2) and for very large inputs we use this encoder
+// instead: hash-chain match finders run on helper threads and hand the
+// matches of every position to the encoding thread in segments, which
+// parses them like GetOptimumFast() of later LZMA SDKs and range-codes
+// the result. The output is a plain LZMA stream just like the one of
+// the SDK encoder, so the stub decompressors are not affected.
+**************************************************************************/
+
+namespace {
+
+// The input is split into segments of fixed size, and the hash chains of
+// each segment are preloaded with the data in front of it. So the helper
+// threads can find the matches of several segments at once, and the
+// result does not depend on the number of threads.
+// The matches of a position are stored as (len, dist - 1) pairs with
+// strictly increasing len; we only keep the longest ones.
+class LzmaMatchFinder
+{
+public:
+    LzmaMatchFinder(const upx_bytep src_, unsigned src_len_, unsigned dict_size,
+                    unsigned nice_, unsigned cycles_);
+    ~LzmaMatchFinder();
+
+    enum { MAX_PAIRS = 3, MAX_THREADS = 16 };
+    void start(unsigned threads);
+    unsigned getMatches(unsigned *pairs);  // returns the number of pairs
+    void skip();
+
+private:
+    enum { SEGMENT_SIZE = 1 << 19, PRELOAD_SIZE = 1 << 20 };
+    enum { H2_BITS = 16, H3_BITS = 16, H4_BITS = 20 };
+    static const unsigned NIL = 0xffffffffu;
+
+    struct Tables {
+        MemBuffer head_buf, prev_buf;
+        unsigned *head2, *head3, *head4, *prev;
+    };
+    struct Slot {
+        MemBuffer counts, pairs;
+        bool done;
+    };
+
+    const upx_byte *const src;
+    const unsigned src_len;
+    const unsigned nice, cycles;
+    unsigned window, preload, wmask;
+    unsigned num_jobs, num_slots;
+    Tables tables[MAX_THREADS];         // [0] is used by the encoding thread
+    Slot slots[MAX_THREADS + 1];
+    unsigned next_job = 0;              // next segment to be started
+    unsigned num_consumed = 0;          // segments done by the encoder
+
+    // reading
+    const upx_byte *read_counts = nullptr;
+    const unsigned *read_pairs = nullptr;
+    unsigned read_left = 0;
+
+    void allocTables(Tables *t);
+    void insert(Tables *t, unsigned pos);
+    unsigned findMatches(Tables *t, unsigned pos, unsigned *pairs);
+    void runJob(unsigned job, Tables *t);
+    void nextSegment();
+    unsigned nextPosition(const unsigned **pairs);
+
+#if (WITH_THREADS)
+    unsigned num_helpers = 0;
+    bool stop = false;
+    std::thread helpers[MAX_THREADS];
+    std::mutex lock;
+    std::condition_variable cond;
+    void helperLoop(Tables *t);
+#endif
+};
+
+LzmaMatchFinder::LzmaMatchFinder(const upx_bytep src_, unsigned src_len_, unsigned dict_size,
+                                 unsigned nice_, unsigned cycles_) :
+    src(src_), src_len(src_len_), nice(nice_), cycles(cycles_)
+{
+    window = dict_size;
+    preload = UPX_MIN(dict_size, (unsigned) PRELOAD_SIZE);
+    wmask = 1;
+    while (wmask < UPX_MIN(src_len, preload + SEGMENT_SIZE))
+        wmask <<= 1;
+    wmask -= 1;
+    num_jobs = (src_len + SEGMENT_SIZE - 1) / SEGMENT_SIZE;
+    num_slots = 0;
+}
+
+LzmaMatchFinder::~LzmaMatchFinder()
+{
+#if (WITH_THREADS)
+    if (num_helpers > 0)
+    {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            stop = true;
+        }
+        cond.notify_all();
+        for (unsigned i = 0; i < num_helpers; i++)
+            helpers[i].join();
+    }
+#endif
+}
+
+void LzmaMatchFinder::allocTables(Tables *t)
+{
+    const unsigned nh = (1u << H2_BITS) + (1u << H3_BITS) + (1u << H4_BITS);
+    t->head_buf.alloc(sizeof(unsigned) * nh);
+    t->prev_buf.alloc(sizeof(unsigned) * (upx_uint64_t) (wmask + 1));
+    t->head2 = (unsigned *) (upx_bytep) t->head_buf;
+    t->head3 = t->head2 + (1u << H2_BITS);
+    t->head4 = t->head3 + (1u << H3_BITS);
+    t->prev = (unsigned *) (upx_bytep) t->prev_buf;
+}
+
+void LzmaMatchFinder::start(unsigned threads)
+{
+    threads = UPX_MAX(1u, UPX_MIN(threads, UPX_MIN(num_jobs, (unsigned) MAX_THREADS)));
+    num_slots = threads + 1;
+    const unsigned segment = UPX_MIN(src_len, (unsigned) SEGMENT_SIZE);
+    for (unsigned i = 0; i < num_slots; i++)
+    {
+        slots[i].counts.alloc(segment + 1);
+        slots[i].pairs.alloc(sizeof(unsigned) * (upx_uint64_t) (segment + 1) * 2 * MAX_PAIRS);
+        slots[i].done = false;
+    }
+    for (unsigned i = 0; i < threads; i++)
+        allocTables(&tables[i]);
+#if (WITH_THREADS)
+    for (unsigned i = 1; i < threads; i++)
+    {
+        try {
+            helpers[num_helpers] = std::thread(&LzmaMatchFinder::helperLoop, this, &tables[i]);
+            num_helpers++;
+        } catch (const std::system_error &) {
+            break; // just go on with what we have
+        }
+    }
+#endif
+}
+
+void LzmaMatchFinder::insert(Tables *t, unsigned pos)
+{
+    if (src_len - pos < 4)
+        return;
+    const unsigned v = get_le32(src + pos);
+    const unsigned h4 = (v * 0x9e3779b1u) >> (32 - H4_BITS);
+    t->head2[v & 0xffff] = pos;
+    t->head3[((v & 0xffffff) * 0x9e3779b1u) >> (32 - H3_BITS)] = pos;
+    t->prev[pos & wmask] = t->head4[h4];
+    t->head4[h4] = pos;
+}
+
+unsigned LzmaMatchFinder::findMatches(Tables *t, unsigned pos, unsigned *pairs)
+{
+    const unsigned avail = src_len - pos;
+    if (avail < 4)
+        return 0;
+    const unsigned max_len = UPX_MIN(avail, nice);
+    const upx_byte *const cur = src + pos;
+    const unsigned v = get_le32(cur);
+    const unsigned h2 = v & 0xffff;
+    const unsigned h3 = ((v & 0xffffff) * 0x9e3779b1u) >> (32 - H3_BITS);
+    const unsigned h4 = (v * 0x9e3779b1u) >> (32 - H4_BITS);
+    const unsigned c2 = t->head2[h2], c3 = t->head3[h3];
+    unsigned c4 = t->head4[h4];
+    t->head2[h2] = t->head3[h3] = t->head4[h4] = pos;
+    t->prev[pos & wmask] = c4;
+
+    unsigned n = 0, best = 1;
+    auto check = [&](unsigned c) {
+        if (src[c + best] != cur[best])
+            return;
+        unsigned len = 0;
+        while (len + 4 <= max_len && get_ne32(src + c + len) == get_ne32(cur + len))
+            len += 4;
+        while (len < max_len && src[c + len] == cur[len])
+            len++;
+        if (len > best)
+        {
+            pairs[n++] = best = len;
+            pairs[n++] = pos - c - 1;
+        }
+    };
+    if (c2 != NIL && pos - c2 <= window)
+        check(c2);
+    if (c3 != NIL && c3 != c2 && pos - c3 <= window && best < max_len)
+        check(c3);
+    for (unsigned i = cycles; i > 0 && c4 != NIL && best < max_len; i--)
+    {
+        if (pos - c4 > window)
+            break;
+        check(c4);
+        const unsigned next = t->prev[c4 & wmask];
+        if (next >= c4)
+            break;
+        c4 = next;
+    }
+    return n / 2;
+}
+
+void LzmaMatchFinder::runJob(unsigned job, Tables *t)
+{
+    Slot *s = &slots[job % num_slots];
+    const unsigned first = job * SEGMENT_SIZE;
+    const unsigned end = UPX_MIN(src_len - first, (unsigned) SEGMENT_SIZE) + first;
+    upx_byte *counts = s->counts;
+    unsigned *out = (unsigned *) (upx_bytep) s->pairs;
+    unsigned pairs[2 * 274];
+
+    t->head_buf.fill(0, t->head_buf.getSize(), 0xff);
+    for (unsigned pos = first - UPX_MIN(first, preload); pos < first; pos++)
+        insert(t, pos);
+    for (unsigned pos = first; pos < end; pos++)
+    {
+        unsigned n = findMatches(t, pos, pairs);
+        const unsigned *p = pairs;
+        if (n > MAX_PAIRS)
+        {
+            p += 2 * (n - MAX_PAIRS);
+            n = MAX_PAIRS;
+        }
+        memcpy(out, p, sizeof(*p) * 2 * n);
+        out += 2 * n;
+        *counts++ = (upx_byte) n;
+    }
+}
+
+#if (WITH_THREADS)
+void LzmaMatchFinder::helperLoop(Tables *t)
+{
+    for (;;)
+    {
+        unsigned job;
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            cond.wait(guard, [this]() {
+                return stop || next_job >= num_jobs || next_job < num_consumed + num_slots;
+            });
+            if (stop || next_job >= num_jobs)
+                return;
+            job = next_job++;
+        }
+        runJob(job, t);
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            slots[job % num_slots].done = true;
+        }
+        cond.notify_all();
+    }
+}
+#endif
+
+void LzmaMatchFinder::nextSegment()
+{
+    const unsigned job = num_consumed;
+    Slot *s = &slots[job % num_slots];
+    assert(job < num_jobs);
+#if (WITH_THREADS)
+    if (num_helpers > 0)
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        if (next_job == job)
+        {
+            // not started yet - do it ourselves
+            next_job++;
+            guard.unlock();
+            runJob(job, &tables[0]);
+        }
+        else
+            cond.wait(guard, [s]() { return s->done; });
+    }
+    else
+#endif
+    {
+        next_job++;
+        runJob(job, &tables[0]);
+    }
+    read_counts = s->counts;
+    read_pairs = (const unsigned *) (const upx_byte *) s->pairs;
+    read_left = UPX_MIN(src_len - job * SEGMENT_SIZE, (unsigned) SEGMENT_SIZE);
+}
+
+unsigned LzmaMatchFinder::nextPosition(const unsigned **pairs)
+{
+    if (read_left == 0)
+    {
+        if (read_counts != nullptr)
+        {
+            // hand back the slot of the previous segment
+#if (WITH_THREADS)
+            if (num_helpers > 0)
+            {
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+                    slots[num_consumed % num_slots].done = false;
+                    num_consumed++;
+                }
+                cond.notify_all();
+            }
+            else
+#endif
+                num_consumed++;
+        }
+        nextSegment();
+    }
+    read_left--;
+    const unsigned n = *read_counts++;
+    *pairs = read_pairs;
+    read_pairs += 2 * n;
+    return n;
+}
+
+unsigned LzmaMatchFinder::getMatches(unsigned *pairs)
+{
+    const unsigned *p;
+    const unsigned n = nextPosition(&p);
+    memcpy(pairs, p, sizeof(*p) * 2 * n);
+    return n;
+}
+
+void LzmaMatchFinder::skip()
+{
+    const unsigned *p;
+    (void) nextPosition(&p);
+}
+
+
+class LzmaFastEncoder
+{
+public:
+    LzmaFastEncoder(const upx_bytep src_, unsigned src_len_, upx_bytep dst, unsigned dst_size,
+                    const lzma_compress_result_t *res, int level);
+    int encode(upx_callback_p cb, const upx_compress_config_t *cconf, unsigned *dst_len,
+               unsigned threads);
+
+private:
+    enum { NUM_STATES = 12, NUM_REPS = 4, MATCH_LEN_MAX = 273 };
+    enum { END_POS_MODEL_INDEX = 14, NUM_FULL_DISTANCES = 128, NUM_ALIGN_BITS = 4 };
+    typedef unsigned short Prob;
+
+    struct LenEncoder {
+        Prob choice, choice2;
+        Prob low[16][8], mid[16][8], high[256];
+    };
+
+    const upx_byte *const src;
+    const unsigned src_len;
+    const unsigned lc, lp_mask, pb_mask, nice;
+    LzmaMatchFinder mf;
+
+    // range encoder
+    upx_byte *const out;
+    const unsigned out_size;
+    unsigned out_pos = 0;
+    bool overflow = false;
+    upx_uint64_t low = 0;
+    unsigned range = 0xffffffff;
+    unsigned cache_size = 1;
+    upx_byte cache = 0;
+
+    // model
+    unsigned state = 0;
+    unsigned reps[NUM_REPS] = {0, 0, 0, 0};
+    Prob is_match[NUM_STATES][16], is_rep0_long[NUM_STATES][16];
+    Prob is_rep[NUM_STATES], is_rep_g0[NUM_STATES], is_rep_g1[NUM_STATES], is_rep_g2[NUM_STATES];
+    Prob pos_slot[4][64];
+    Prob pos_special[NUM_FULL_DISTANCES - END_POS_MODEL_INDEX];
+    Prob pos_align[1 << NUM_ALIGN_BITS];
+    LenEncoder len_enc, rep_len_enc;
+    MemBuffer lit_buf;
+
+    // parser
+    enum { NO_BACK = 0xffffffffu };
+    unsigned mf_pos = 0;                // next position of the match finder
+    unsigned num_pairs = 0;
+    unsigned longest_len = 0;
+    unsigned matches[2 * LzmaMatchFinder::MAX_PAIRS];
+
+    void shiftLow();
+    void encodeBit(Prob *prob, unsigned bit)
+    {
+        const unsigned bound = (range >> 11) * *prob;
+        if (bit == 0)
+        {
+            range = bound;
+            *prob = (Prob) (*prob + ((2048 - *prob) >> 5));
+        }
+        else
+        {
+            low += bound;
+            range -= bound;
+            *prob = (Prob) (*prob - (*prob >> 5));
+        }
+        while (range < (1u << 24))
+        {
+            range <<= 8;
+            shiftLow();
+        }
+    }
+    void encodeDirectBits(unsigned value, unsigned num_bits);
+    void encodeTree(Prob *probs, unsigned num_bits, unsigned symbol);
+    void encodeReverseTree(Prob *probs, unsigned num_bits, unsigned symbol);
+    void encodeLen(LenEncoder *le, unsigned len, unsigned pos_state);
+    void encodeLiteral(unsigned pos);
+    void encodeMatch(unsigned dist, unsigned len, unsigned pos_state);
+    void encodeRep(unsigned rep_index, unsigned len, unsigned pos_state);
+
+    unsigned readMatches();
+    unsigned getOptimumFast(unsigned pos, unsigned *back);
+};
+
+LzmaFastEncoder::LzmaFastEncoder(const upx_bytep src_, unsigned src_len_, upx_bytep dst,
+                                 unsigned dst_size, const lzma_compress_result_t *res,
+                                 int level) :
+    src(src_), src_len(src_len_),
+    lc(res->lit_context_bits), lp_mask((1u << res->lit_pos_bits) - 1),
+    pb_mask((1u << res->pos_bits) - 1), nice(res->num_fast_bytes),
+    mf(src_, src_len_, res->dict_size, res->num_fast_bytes,
+       res->match_finder_cycles ? res->match_finder_cycles : (level <= 2 ? 8 : 32)),
+    out(dst), out_size(dst_size)
+{
+    // all probabilities start at 1/2
+    Prob *const model[] = {
+        &is_match[0][0], &is_rep0_long[0][0], is_rep, is_rep_g0, is_rep_g1, is_rep_g2,
+        &pos_slot[0][0], pos_special, pos_align, &len_enc.choice, &rep_len_enc.choice,
+    };
+    const size_t sizes[] = {
+        sizeof(is_match), sizeof(is_rep0_long), sizeof(is_rep), sizeof(is_rep_g0),
+        sizeof(is_rep_g1), sizeof(is_rep_g2), sizeof(pos_slot), sizeof(pos_special),
+        sizeof(pos_align), sizeof(len_enc), sizeof(rep_len_enc),
+    };
+    for (size_t i = 0; i < TABLESIZE(model); i++)
+        for (size_t j = 0; j < sizes[i] / sizeof(Prob); j++)
+            model[i][j] = 1024;
+    const unsigned num_lit = 0x300u << (res->lit_context_bits + res->lit_pos_bits);
+    lit_buf.alloc(sizeof(Prob) * num_lit);
+    Prob *lit = (Prob *) (upx_bytep) lit_buf;
+    for (unsigned i = 0; i < num_lit; i++)
+        lit[i] = 1024;
+}
+
+// see RangeCoder.h of the LZMA SDK
+void LzmaFastEncoder::shiftLow()
+{
+    if ((unsigned) low < 0xff000000u || (unsigned) (low >> 32) != 0)
+    {
+        upx_byte temp = cache;
+        do {
+            if (out_pos < out_size)
+                out[out_pos++] = (upx_byte) (temp + (upx_byte) (low >> 32));
+            else
+                overflow = true;
+            temp = 0xff;
+        } while (--cache_size != 0);
+        cache = (upx_byte) ((unsigned) low >> 24);
+    }
+    cache_size++;
+    low = (upx_uint64_t) ((unsigned) low & 0x00ffffffu) << 8;
+}
+
+void LzmaFastEncoder::encodeDirectBits(unsigned value, unsigned num_bits)
+{
+    do {
+        range >>= 1;
+        low += range & (0u - ((value >> --num_bits) & 1));
+        if (range < (1u << 24))
+        {
+            range <<= 8;
+            shiftLow();
+        }
+    } while (num_bits != 0);
+}
+
+void LzmaFastEncoder::encodeTree(Prob *probs, unsigned num_bits, unsigned symbol)
+{
+    unsigned m = 1;
+    while (num_bits-- != 0)
+    {
+        const unsigned bit = (symbol >> num_bits) & 1;
+        encodeBit(&probs[m], bit);
+        m = (m << 1) | bit;
+    }
+}
+
+void LzmaFastEncoder::encodeReverseTree(Prob *probs, unsigned num_bits, unsigned symbol)
+{
+    unsigned m = 1;
+    for (unsigned i = 0; i < num_bits; i++)
+    {
+        const unsigned bit = symbol & 1;
+        encodeBit(&probs[m], bit);
+        m = (m << 1) | bit;
+        symbol >>= 1;
+    }
+}
+
+void LzmaFastEncoder::encodeLen(LenEncoder *le, unsigned len, unsigned pos_state)
+{
+    len -= 2;
+    if (len < 8)
+    {
+        encodeBit(&le->choice, 0);
+        encodeTree(le->low[pos_state], 3, len);
+    }
+    else if (len < 16)
+    {
+        encodeBit(&le->choice, 1);
+        encodeBit(&le->choice2, 0);
+        encodeTree(le->mid[pos_state], 3, len - 8);
+    }
+    else
+    {
+        encodeBit(&le->choice, 1);
+        encodeBit(&le->choice2, 1);
+        encodeTree(le->high, 8, len - 16);
+    }
+}
+
+void LzmaFastEncoder::encodeLiteral(unsigned pos)
+{
+    const unsigned prev_byte = pos > 0 ? src[pos - 1] : 0;
+    Prob *probs = (Prob *) (upx_bytep) lit_buf;
+    probs += 0x300 * (((pos & lp_mask) << lc) + (prev_byte >> (8 - lc)));
+    encodeBit(&is_match[state][pos & pb_mask], 0);
+    unsigned symbol = src[pos] | 0x100;
+    if (state < 7)
+    {
+        do {
+            encodeBit(&probs[symbol >> 8], (symbol >> 7) & 1);
+            symbol <<= 1;
+        } while (symbol < 0x10000);
+    }
+    else
+    {
+        // "matched" literal - use the byte at rep0 as additional context
+        unsigned match_byte = src[pos - reps[0] - 1];
+        unsigned offs = 0x100;
+        do {
+            match_byte <<= 1;
+            encodeBit(&probs[offs + (match_byte & offs) + (symbol >> 8)], (symbol >> 7) & 1);
+            symbol <<= 1;
+            offs &= ~(match_byte ^ symbol);
+        } while (symbol < 0x10000);
+    }
+    state = state < 4 ? 0 : (state < 10 ? state - 3 : state - 6);
+}
+
+void LzmaFastEncoder::encodeMatch(unsigned dist, unsigned len, unsigned pos_state)
+{
+    encodeBit(&is_match[state][pos_state], 1);
+    encodeBit(&is_rep[state], 0);
+    encodeLen(&len_enc, len, pos_state);
+
+    unsigned slot = dist;
+    if (dist >= 4)
+    {
+        unsigned n = 31;
+        while ((dist >> n) == 0)
+            n--;
+        slot = (n << 1) | ((dist >> (n - 1)) & 1);
+    }
+    encodeTree(pos_slot[UPX_MIN(len - 2, 3u)], 6, slot);
+    if (slot >= 4)
+    {
+        const unsigned footer_bits = (slot >> 1) - 1;
+        const unsigned base = (2 | (slot & 1)) << footer_bits;
+        const unsigned reduced = dist - base;
+        if (slot < END_POS_MODEL_INDEX)
+            encodeReverseTree(pos_special + base - slot - 1, footer_bits, reduced);
+        else
+        {
+            encodeDirectBits(reduced >> NUM_ALIGN_BITS, footer_bits - NUM_ALIGN_BITS);
+            encodeReverseTree(pos_align, NUM_ALIGN_BITS, reduced & ((1 << NUM_ALIGN_BITS) - 1));
+        }
+    }
+    reps[3] = reps[2];
+    reps[2] = reps[1];
+    reps[1] = reps[0];
+    reps[0] = dist;
+    state = state < 7 ? 7 : 10;
+}
+
+void LzmaFastEncoder::encodeRep(unsigned rep_index, unsigned len, unsigned pos_state)
+{
+    encodeBit(&is_match[state][pos_state], 1);
+    encodeBit(&is_rep[state], 1);
+    if (rep_index == 0)
+    {
+        encodeBit(&is_rep_g0[state], 0);
+        encodeBit(&is_rep0_long[state][pos_state], 1);
+    }
+    else
+    {
+        const unsigned dist = reps[rep_index];
+        encodeBit(&is_rep_g0[state], 1);
+        if (rep_index == 1)
+            encodeBit(&is_rep_g1[state], 0);
+        else
+        {
+            encodeBit(&is_rep_g1[state], 1);
+            encodeBit(&is_rep_g2[state], rep_index - 2);
+            if (rep_index == 3)
+                reps[3] = reps[2];
+            reps[2] = reps[1];
+        }
+        reps[1] = reps[0];
+        reps[0] = dist;
+    }
+    encodeLen(&rep_len_enc, len, pos_state);
+    state = state < 7 ? 8 : 11;
+}
+
+// read the matches of the next position, returns the longest length
+unsigned LzmaFastEncoder::readMatches()
+{
+    const unsigned pos = mf_pos++;
+    num_pairs = mf.getMatches(matches);
+    if (num_pairs == 0)
+        return 0;
+    unsigned len = matches[2 * num_pairs - 2];
+    if (len == nice)
+    {
+        // the match finder stops at "nice" bytes
+        const unsigned limit = UPX_MIN(src_len - pos, (unsigned) MATCH_LEN_MAX);
+        const upx_byte *const cur = src + pos;
+        const upx_byte *const m = cur - matches[2 * num_pairs - 1] - 1;
+        while (len < limit && cur[len] == m[len])
+            len++;
+    }
+    return len;
+}
+
+// see GetOptimumFast() in LzmaEnc.c of later LZMA SDKs
+#define CHANGE_PAIR(small_dist, big_dist)   (((big_dist) >> 7) > (small_dist))
+
+unsigned LzmaFastEncoder::getOptimumFast(unsigned pos, unsigned *back)
+{
+    // the matches of "pos" may have been read ahead by the previous call
+    unsigned main_len = (mf_pos == pos) ? readMatches() : longest_len;
+    unsigned main_dist = 0;
+    unsigned n = num_pairs;
+
+    *back = NO_BACK;
+    unsigned num_avail = src_len - pos;
+    if (num_avail < 2)
+        return 1;
+    if (num_avail > MATCH_LEN_MAX)
+        num_avail = MATCH_LEN_MAX;
+
+    const upx_byte *data = src + pos;
+    unsigned rep_len = 0, rep_index = 0;
+    for (unsigned i = 0; i < NUM_REPS; i++)
+    {
+        const upx_byte *const data2 = data - reps[i] - 1;
+        if (data[0] != data2[0] || data[1] != data2[1])
+            continue;
+        unsigned len = 2;
+        while (len < num_avail && data[len] == data2[len])
+            len++;
+        if (len >= nice)
+        {
+            *back = i;
+            return len;
+        }
+        if (len > rep_len)
+        {
+            rep_index = i;
+            rep_len = len;
+        }
+    }
+
+    if (main_len >= nice)
+    {
+        *back = matches[2 * n - 1] + NUM_REPS;
+        return main_len;
+    }
+    if (main_len >= 2)
+    {
+        // prefer a shorter match with a much smaller distance
+        main_dist = matches[2 * n - 1];
+        while (n > 1 && main_len == matches[2 * n - 4] + 1)
+        {
+            if (!CHANGE_PAIR(matches[2 * n - 3], main_dist))
+                break;
+            n--;
+            main_len = matches[2 * n - 2];
+            main_dist = matches[2 * n - 1];
+        }
+        if (main_len == 2 && main_dist >= 0x80)
+            main_len = 1;
+    }
+
+    if (rep_len >= 2 && (rep_len + 1 >= main_len ||
+                         (rep_len + 2 >= main_len && main_dist >= (1u << 9)) ||
+                         (rep_len + 3 >= main_len && main_dist >= (1u << 15))))
+    {
+        *back = rep_index;
+        return rep_len;
+    }
+
+    if (main_len < 2 || num_avail <= 2)
+        return 1;
+
+    // look ahead one position - code a literal if the next match is better
+    longest_len = readMatches();
+    if (longest_len >= 2)
+    {
+        const unsigned new_dist = matches[2 * num_pairs - 1];
+        if ((longest_len >= main_len && new_dist < main_dist) ||
+            (longest_len == main_len + 1 && !CHANGE_PAIR(main_dist, new_dist)) ||
+            longest_len > main_len + 1 ||
+            (longest_len + 1 >= main_len && main_len >= 3 && CHANGE_PAIR(new_dist, main_dist)))
+            return 1;
+    }
+    data = src + pos + 1;
+    for (unsigned i = 0; i < NUM_REPS; i++)
+    {
+        const upx_byte *const data2 = data - reps[i] - 1;
+        if (data[0] != data2[0] || data[1] != data2[1])
+            continue;
+        const unsigned limit = main_len - 1;
+        unsigned len = 2;
+        while (len < limit && data[len] == data2[len])
+            len++;
+        if (len >= limit)
+            return 1;
+    }
+    *back = main_dist + NUM_REPS;
+    return main_len;
+}
+
+#undef CHANGE_PAIR
+
+int LzmaFastEncoder::encode(upx_callback_p cb, const upx_compress_config_t *cconf,
+                            unsigned *dst_len, unsigned threads)
+{
+    mf.start(threads);
+
+    unsigned pos = 0;
+    unsigned next_progress = 0;
+    // small steps for small inputs, for the sake of the budget check
+    const unsigned progress_step = UPX_MIN(1u << 20, src_len / 16 + 1);
+    if (src_len > 0)
+    {
+        // the first byte is always a literal
+        mf.skip();
+        mf_pos = 1;
+        encodeLiteral(0);
+        pos = 1;
+    }
+    while (pos < src_len && !overflow)
+    {
+        if (pos >= next_progress)
+        {
+            if (cb && cb->nprogress)
+                cb->nprogress(cb, pos, out_pos);
+            if (upx_compress_over_budget(cconf, 2 + out_pos))
+                return UPX_E_BUDGET_EXCEEDED;
+            next_progress = pos + progress_step;
+        }
+        unsigned back;
+        const unsigned len = getOptimumFast(pos, &back);
+        if (back == NO_BACK)
+            encodeLiteral(pos);
+        else if (back < NUM_REPS)
+            encodeRep(back, len, pos & pb_mask);
+        else
+            encodeMatch(back - NUM_REPS, len, pos & pb_mask);
+        pos += len;
+        for ( ; mf_pos < pos; mf_pos++)
+            mf.skip();
+    }
+    for (int i = 0; i < 5; i++)
+        shiftLow();
+
+    if (cb && cb->nprogress)
+        cb->nprogress(cb, src_len, out_pos);
+    *dst_len = out_pos;
+    return overflow ? UPX_E_NOT_COMPRESSIBLE : UPX_E_OK;
+}
+
+} // namespace
+
+static int lzma_fast_compress(const upx_bytep src, unsigned src_len,
+                              upx_bytep dst, unsigned *dst_len,
+                              upx_callback_p cb, int level,
+                              const upx_compress_config_t *cconf,
+                              const lzma_compress_result_t *res)
+{
+    int r;
+    unsigned c_len = 0;
+    if (*dst_len < 2)
+    {
+        *dst_len = 0;
+        return UPX_E_NOT_COMPRESSIBLE;
+    }
+    // same header as in upx_lzma_compress() below
+    unsigned t = res->lit_context_bits + res->lit_pos_bits;
+    dst[0] = (upx_byte) ((t << 3) | res->pos_bits);
+    dst[1] = (upx_byte) ((res->lit_pos_bits << 4) | (res->lit_context_bits));
+    try {
+        LzmaFastEncoder enc(src, src_len, dst + 2, *dst_len - 2, res, level);
+        r = enc.encode(cb, cconf, &c_len, upx_parallel_threads(LzmaMatchFinder::MAX_THREADS));
+    } catch (...) {
+        r = UPX_E_OUT_OF_MEMORY;
+    }
+    *dst_len = 2 + c_len;
+    return r;
+}
+
 
 int upx_lzma_compress      ( const upx_bytep src, unsigned  src_len,
                                    upx_bytep dst, unsigned* dst_len,
@@ -333,15 +1212,16 @@ int upx_lzma_compress      ( const upx_bytep src, unsigned  src_len,
     const lzma_compress_config_t *lcconf = cconf_parm ? &cconf_parm->conf_lzma : nullptr;
     lzma_compress_result_t *res = &cresult->result_lzma;
 
-    MyLzma::InStream is; is.AddRef();
-    MyLzma::OutStream os; os.AddRef();
+    MyLzma::InStream &is = MyLzma::encoder_pool.is;
+    MyLzma::OutStream &os = MyLzma::encoder_pool.os;
     is.Init(src, src_len);
     os.Init(dst, *dst_len);
 
-    MyLzma::ProgressInfo progress; progress.AddRef();
+    MyLzma::ProgressInfo &progress = MyLzma::encoder_pool.progress;
     progress.cb = cb;
+    progress.cconf = cconf_parm;
 
-    NCompress::NLZMA::CEncoder enc;
+    NCompress::NLZMA::CEncoder *enc = nullptr;
     const PROPID propIDs[8] = {
         NCoderPropID::kPosStateBits,        // 0  pb    _posStateBits(2)
         NCoderPropID::kLitPosBits,          // 1  lp    _numLiteralPosStateBits(0)
@@ -361,6 +1241,12 @@ int upx_lzma_compress      ( const upx_bytep src, unsigned  src_len,
     pr[4].vt = pr[5].vt = pr[6].vt = VT_UI4;
     if (prepare(res, src_len, method, level, lcconf) != 0)
         goto error;
+    // use the parallel encoder for the fast mode and for large inputs
+    if (res->fast_mode == 0 || (level <= 6 && src_len >= 32 * 1024 * 1024))
+    {
+        res->fast_mode = 0;
+        return lzma_fast_compress(src, src_len, dst, dst_len, cb, level, cconf_parm, res);
+    }
     pr[0].uintVal = res->pos_bits;
     pr[1].uintVal = res->lit_pos_bits;
     pr[2].uintVal = res->lit_context_bits;
@@ -371,9 +1257,13 @@ int upx_lzma_compress      ( const upx_bytep src, unsigned  src_len,
 
     try {
 
-    if (enc.SetCoderProperties(propIDs, pr, nprops) != S_OK)
+    enc = MyLzma::encoder_pool.get(res->match_finder_cycles);
+    if (enc->SetCoderProperties(propIDs, pr, nprops) != S_OK)
+    {
+        MyLzma::encoder_pool.drop();
         goto error;
-    if (enc.WriteCoderProperties(&os) != S_OK)
+    }
+    if (enc->WriteCoderProperties(&os) != S_OK)
         goto error;
     if (os.overflow) {
         //r = UPX_E_OUTPUT_OVERRUN;
@@ -387,16 +1277,23 @@ int upx_lzma_compress      ( const upx_bytep src, unsigned  src_len,
     os.WriteByte(Byte((t << 3) | res->pos_bits));
     os.WriteByte(Byte((res->lit_pos_bits << 4) | (res->lit_context_bits)));
 
-    rh = enc.Code(&is, &os, nullptr, nullptr, &progress);
+    rh = enc->Code(&is, &os, nullptr, nullptr, &progress);
 
     } catch (...) {
         rh = E_OUTOFMEMORY;
     }
+    // don't keep an encoder that failed in some unexpected way
+    if (rh != S_OK && rh != E_ABORT && !os.overflow)
+        MyLzma::encoder_pool.drop();
+    else if (res->dict_size > MyLzma::EncoderPool::MAX_DICT_SIZE)
+        MyLzma::encoder_pool.drop();
 
     assert(is.b_pos <=  src_len);
     assert(os.b_pos <= *dst_len);
     if (rh == E_OUTOFMEMORY)
         r = UPX_E_OUT_OF_MEMORY;
+    else if (rh == E_ABORT)
+        r = UPX_E_BUDGET_EXCEEDED;
     else if (os.overflow)
     {
         assert(os.b_pos == *dst_len);
@@ -417,6 +1314,143 @@ error:
 }
 
 
+/*************************************************************************
+// tune lc/lp/pb and the number of fast bytes for some data
+//
+// The best pb and lp follow the instruction alignment of the code (x86
+// code likes 0/0, arm64 code rather 2/2), and lc how predictable the
+// bytes are from their predecessor. So this compresses a few samples
+// with a grid of lc/lp/pb settings and then, with the winner, with some
+// numbers of fast bytes. Settings which are already set in cconf are
+// left alone, ties go to the initial settings, and lc+lp never exceeds
+// its initial value, so the stubs do not need more memory (num_probs).
+**************************************************************************/
+
+namespace {
+struct LzmaTuneSetting
+{
+    unsigned lc, lp, pb, fb;
+};
+} // namespace
+
+int upx_lzma_tune          ( const upx_bytep src, unsigned src_len,
+                                   int level,
+                             const upx_compress_config_t *cconf,
+                                   lzma_compress_config_t *result )
+{
+    enum { SAMPLE_SIZE = 64 * 1024, MAX_SAMPLES = 4, MAX_SETTINGS = 32 };
+
+    upx_compress_config_t base;
+    base.reset();
+    if (cconf)
+        base = *cconf;
+    base.budget = 0;
+    const lzma_compress_config_t &lconf = base.conf_lzma;
+    *result = lconf;
+    if (src_len < SAMPLE_SIZE)
+        return UPX_E_OK;
+
+    // samples evenly spread over the input, 16-byte aligned for lp and pb
+    const unsigned nsamples = UPX_MIN((unsigned) MAX_SAMPLES, src_len / SAMPLE_SIZE);
+    unsigned sample_off[MAX_SAMPLES];
+    for (unsigned j = 0; j < nsamples; j++)
+    {
+        upx_uint64_t off = 0;
+        if (nsamples > 1)
+            off = (upx_uint64_t) (src_len - SAMPLE_SIZE) * j / (nsamples - 1);
+        sample_off[j] = (unsigned) off & ~15u;
+    }
+
+    LzmaTuneSetting settings[MAX_SETTINGS];
+    unsigned sizes[MAX_SETTINGS];
+    LzmaTuneSetting best = { lconf.lit_context_bits, lconf.lit_pos_bits, lconf.pos_bits,
+                             lconf.num_fast_bytes };
+    const unsigned max_lclp = best.lc + best.lp;
+    int r = UPX_E_OK;
+
+    // compress all samples with all settings; the first one is "best"
+    auto evaluate = [&](unsigned nsettings) {
+        int rr[MAX_SETTINGS * MAX_SAMPLES];
+        unsigned c_lens[MAX_SETTINGS * MAX_SAMPLES];
+        auto func = [&](unsigned i) {
+            const LzmaTuneSetting &s = settings[i / nsamples];
+            upx_compress_config_t conf = base;
+            conf.conf_lzma.lit_context_bits = s.lc;
+            conf.conf_lzma.lit_pos_bits = s.lp;
+            conf.conf_lzma.pos_bits = s.pb;
+            conf.conf_lzma.num_fast_bytes = s.fb;
+            upx_compress_result_t cresult;
+            MemBuffer c_buf;
+            c_buf.allocForCompression(SAMPLE_SIZE);
+            unsigned c_len = c_buf.getSize();
+            rr[i] = upx_lzma_compress(src + sample_off[i % nsamples], SAMPLE_SIZE, c_buf, &c_len,
+                                      nullptr, M_LZMA, level, &conf, &cresult);
+            if (rr[i] == UPX_E_NOT_COMPRESSIBLE)
+                rr[i] = UPX_E_OK, c_len = SAMPLE_SIZE;
+            c_lens[i] = c_len;
+        };
+        upx_parallel_for(nsettings * nsamples, func);
+        for (unsigned k = 0; k < nsettings; k++)
+        {
+            sizes[k] = 0;
+            for (unsigned j = 0; j < nsamples; j++)
+            {
+                if (rr[k * nsamples + j] != UPX_E_OK)
+                    r = rr[k * nsamples + j];
+                sizes[k] += c_lens[k * nsamples + j];
+            }
+        }
+        unsigned w = 0;
+        for (unsigned k = 1; k < nsettings; k++)
+            if (sizes[k] < sizes[w])
+                w = k;
+        best = settings[w];
+    };
+
+    // lc/lp/pb
+    unsigned n = 0;
+    settings[n++] = best;
+    for (unsigned pb = 0; pb <= 2; pb++)
+        for (unsigned lp = 0; lp <= pb; lp++)
+            for (unsigned lc = 0; lc + lp <= max_lclp; lc++)
+            {
+                LzmaTuneSetting s = { lc, lp, pb, best.fb };
+                if (lconf.pos_bits.is_set && pb != best.pb) continue;
+                if (lconf.lit_pos_bits.is_set && lp != best.lp) continue;
+                if (lconf.lit_context_bits.is_set && lc != best.lc) continue;
+                if (lc == best.lc && lp == best.lp && pb == best.pb) continue;
+                if (n < MAX_SETTINGS)
+                    settings[n++] = s;
+            }
+    if (n > 1)
+        evaluate(n);
+
+    // fast bytes; but not for the fast mode, which has its own idea
+    static const unsigned fast_bytes[] = { 32, 64, 128, 273 };
+    n = 0;
+    settings[n++] = best;
+    for (unsigned k = 0; level > 2 && k < TABLESIZE(fast_bytes); k++)
+    {
+        if (lconf.num_fast_bytes.is_set || fast_bytes[k] == best.fb)
+            continue;
+        LzmaTuneSetting s = best;
+        s.fb = fast_bytes[k];
+        settings[n++] = s;
+    }
+    if (n > 1)
+        evaluate(n);
+
+    if (r != UPX_E_OK)
+        return r;
+    result->lit_context_bits = best.lc;
+    result->lit_pos_bits = best.lp;
+    result->pos_bits = best.pb;
+    if (level > 2)
+        result->num_fast_bytes = best.fb;
+    return UPX_E_OK;
+}
+
+
 /*************************************************************************
 // decompress
 **************************************************************************/
@@ -428,6 +1462,309 @@ error:
 #include "C/7zip/Compress/LZMA_C/LzmaDecode.h"
 #include "C/7zip/Compress/LZMA_C/LzmaDecode.c"
 
+// LzmaDecode() from the SDK above is the reference; upx_lzma_decompress()
+// uses the faster LzmaDecoder below, which gives the very same results.
+// The input is still fetched one byte at a time, exactly when the range
+// coder needs it, so that in-place decompression in upx_lzma_test_overlap()
+// works like in the stubs. The speed comes from keeping the coder state in
+// registers, decoding matched literals without data-dependent branches,
+// prefetching the literal probabilities of the next byte, and copying
+// matches by words.
+
+namespace {
+
+// probability model layout, same as in LzmaDecode.h
+enum {
+    LZMA_P_IS_MATCH = 0, LZMA_P_IS_REP = 192, LZMA_P_IS_REP_G0 = 204,
+    LZMA_P_IS_REP_G1 = 216, LZMA_P_IS_REP_G2 = 228, LZMA_P_IS_REP0_LONG = 240,
+    LZMA_P_POS_SLOT = 432, LZMA_P_SPEC_POS = 688, LZMA_P_ALIGN = 802,
+    LZMA_P_LEN = 818, LZMA_P_REP_LEN = 1332, LZMA_P_LITERAL = 1846
+};
+
+#if (ACC_CC_CLANG || ACC_CC_GNUC)
+#  define lzma_prefetch(p)  __builtin_prefetch(p)
+#else
+#  define lzma_prefetch(p)  ((void) 0)
+#endif
+
+// the range decoder; a local variable in LzmaDecoder::decode(), so that
+// its members can live in registers in spite of all the byte stores
+struct LzmaRangeDecoder
+{
+    typedef unsigned short Prob;
+    const upx_byte *ip;
+    const upx_byte *ip_end;
+    upx_uint32_t range;
+    upx_uint32_t code;
+
+    // false if the input is exhausted, like RC_TEST in LzmaDecode.c
+    __acc_forceinline bool normalize()
+    {
+        if (range >= (1u << 24))
+            return true;
+        if __acc_unlikely(ip == ip_end)
+            return false;
+        range <<= 8;
+        code = (code << 8) | *ip++;
+        return true;
+    }
+    // for the well predictable bits
+    __acc_forceinline unsigned bit(Prob *p)
+    {
+        const unsigned prob = *p;
+        const upx_uint32_t bound = (range >> 11) * prob;
+        if (code < bound)
+        {
+            range = bound;
+            *p = (Prob) (prob + (((1u << 11) - prob) >> 5));
+            return 0;
+        }
+        range -= bound;
+        code -= bound;
+        *p = (Prob) (prob - (prob >> 5));
+        return 1;
+    }
+    // for matched literals, which are all but predictable
+    __acc_forceinline unsigned bitNoBranch(Prob *p)
+    {
+        const unsigned prob = *p;
+        const upx_uint32_t bound = (range >> 11) * prob;
+        const unsigned b = code >= bound;
+        code -= bound & (0u - b);
+        range = b ? range - bound : bound;
+        *p = (Prob) (b ? prob - (prob >> 5) : prob + (((1u << 11) - prob) >> 5));
+        return b;
+    }
+};
+
+class LzmaDecoder
+{
+public:
+    LzmaDecoder(unsigned lc_, unsigned lp_, unsigned pb_) : lc(lc_), lp(lp_), pb(pb_) {}
+    int decode(const upx_bytep src, unsigned src_len, upx_bytep dst, unsigned *dst_len) const;
+
+private:
+    typedef LzmaRangeDecoder::Prob Prob;
+    const unsigned lc, lp, pb;
+};
+
+#define RC_NORM         do { if (!rc.normalize()) goto error; } while (0)
+#define RC_BIT(p, b)    do { RC_NORM; b = rc.bit(p); } while (0)
+#define RC_TREE(p, num_bits, m) do { \
+        m = 1; \
+        for (unsigned i_ = 0; i_ < (num_bits); i_++) { \
+            unsigned b_; RC_BIT((p) + m, b_); m = (m << 1) + b_; \
+        } \
+        m -= 1u << (num_bits); \
+    } while (0)
+
+int LzmaDecoder::decode(const upx_bytep src, unsigned src_len, upx_bytep dst, unsigned *dst_len) const
+{
+    const unsigned out_size = *dst_len;
+    const unsigned num_probs = LZMA_P_LITERAL + (0x300u << (lc + lp));
+    MemBuffer probs_buf(mem_size(sizeof(Prob), num_probs));
+    Prob *const probs = (Prob *) probs_buf.getVoidPtr();
+    for (unsigned i = 0; i < num_probs; i++)
+        probs[i] = 1u << 10;
+
+    const unsigned pos_mask = (1u << pb) - 1;
+    const unsigned lit_pos_mask = (1u << lp) - 1;
+    unsigned state = 0;
+    upx_uint32_t rep0 = 1, rep1 = 1, rep2 = 1, rep3 = 1;
+    unsigned pos = 0;
+    unsigned prev_byte = 0;
+    unsigned b, len;
+    LzmaRangeDecoder rc;
+
+    rc.ip = src;
+    rc.ip_end = src + src_len;
+    rc.range = 0xffffffff;
+    rc.code = 0;
+    if (src_len < 5)
+        goto error;
+    for (int i = 0; i < 5; i++)
+        rc.code = (rc.code << 8) | *rc.ip++;
+
+    while (pos < out_size)
+    {
+        const unsigned pos_state = pos & pos_mask;
+        RC_BIT(probs + LZMA_P_IS_MATCH + (state << 4) + pos_state, b);
+        if (b == 0)
+        {
+            Prob *const p = probs + LZMA_P_LITERAL +
+                0x300 * (((pos & lit_pos_mask) << lc) + (prev_byte >> (8 - lc)));
+            unsigned symbol = 1;
+            if (state < 7)
+            {
+                do {
+                    RC_NORM;
+                    symbol = (symbol << 1) | rc.bit(p + symbol);
+                } while (symbol < 0x100);
+            }
+            else
+            {
+                // use the probabilities for the bits of the match byte while
+                // they agree, and the plain ones after that ("offs" becomes 0)
+                unsigned match_byte = dst[pos - rep0];
+                unsigned offs = 0x100;
+                do {
+                    match_byte <<= 1;
+                    const unsigned match_bit = match_byte & offs;
+                    RC_NORM;
+                    b = rc.bitNoBranch(p + offs + match_bit + symbol);
+                    symbol = (symbol << 1) | b;
+                    offs &= b ? match_bit : ~match_bit;
+                } while (symbol < 0x100);
+            }
+            prev_byte = symbol & 0xff;
+            dst[pos++] = (upx_byte) prev_byte;
+            state = state < 4 ? 0 : (state < 10 ? state - 3 : state - 6);
+            lzma_prefetch(probs + LZMA_P_LITERAL +
+                          0x300 * (((pos & lit_pos_mask) << lc) + (prev_byte >> (8 - lc))));
+            continue;
+        }
+
+        Prob *len_probs;
+        bool new_dist = false;
+        RC_BIT(probs + LZMA_P_IS_REP + state, b);
+        if (b == 0)
+        {
+            // match
+            rep3 = rep2; rep2 = rep1; rep1 = rep0;
+            len_probs = probs + LZMA_P_LEN;
+            state = state < 7 ? 7 : 10;
+            new_dist = true;
+        }
+        else
+        {
+            RC_BIT(probs + LZMA_P_IS_REP_G0 + state, b);
+            if (b == 0)
+            {
+                RC_BIT(probs + LZMA_P_IS_REP0_LONG + (state << 4) + pos_state, b);
+                if (b == 0)
+                {
+                    // short rep
+                    if (pos == 0 || rep0 > pos)
+                        goto error;
+                    state = state < 7 ? 9 : 11;
+                    prev_byte = dst[pos - rep0];
+                    dst[pos++] = (upx_byte) prev_byte;
+                    continue;
+                }
+            }
+            else
+            {
+                upx_uint32_t dist;
+                RC_BIT(probs + LZMA_P_IS_REP_G1 + state, b);
+                if (b == 0)
+                    dist = rep1;
+                else
+                {
+                    RC_BIT(probs + LZMA_P_IS_REP_G2 + state, b);
+                    if (b == 0)
+                        dist = rep2;
+                    else
+                    {
+                        dist = rep3;
+                        rep3 = rep2;
+                    }
+                    rep2 = rep1;
+                }
+                rep1 = rep0;
+                rep0 = dist;
+            }
+            len_probs = probs + LZMA_P_REP_LEN;
+            state = state < 7 ? 8 : 11;
+        }
+
+        // [0] choice, [1] choice2, [2..] low, [130..] mid, [258..] high
+        RC_BIT(len_probs + 0, b);
+        if (b == 0)
+            RC_TREE(len_probs + 2 + (pos_state << 3), 3, len);
+        else
+        {
+            RC_BIT(len_probs + 1, b);
+            if (b == 0)
+            {
+                RC_TREE(len_probs + 130 + (pos_state << 3), 3, len);
+                len += 8;
+            }
+            else
+            {
+                RC_TREE(len_probs + 258, 8, len);
+                len += 16;
+            }
+        }
+
+        if (new_dist)
+        {
+            unsigned slot;
+            RC_TREE(probs + LZMA_P_POS_SLOT + (UPX_MIN(len, 3u) << 6), 6, slot);
+            if (slot >= 4)
+            {
+                unsigned num_direct_bits = (slot >> 1) - 1;
+                rep0 = (2 | (slot & 1)) << num_direct_bits;
+                Prob *q = probs + LZMA_P_SPEC_POS + rep0 - slot - 1;
+                if (slot >= 14)
+                {
+                    for (num_direct_bits -= 4; num_direct_bits > 0; num_direct_bits--)
+                    {
+                        RC_NORM;
+                        rc.range >>= 1;
+                        if (rc.code >= rc.range)
+                        {
+                            rc.code -= rc.range;
+                            rep0 += 1u << (num_direct_bits - 1 + 4);
+                        }
+                    }
+                    q = probs + LZMA_P_ALIGN;
+                    num_direct_bits = 4;
+                }
+                // reverse bit tree
+                for (unsigned i = 0, m = 1; i < num_direct_bits; i++)
+                {
+                    RC_BIT(q + m, b);
+                    m = (m << 1) + b;
+                    rep0 += b << i;
+                }
+            }
+            else
+                rep0 = slot;
+            if (++rep0 == 0)
+                break; // end marker
+        }
+
+        len += 2;
+        if (rep0 > pos)
+            goto error;
+        len = UPX_MIN(len, out_size - pos);
+        upx_bytep d = dst + pos;
+        const upx_byte *m = d - rep0;
+        pos += len;
+        // never write beyond the end of the match: in-place
+        // decompression may still need the input there
+        if (rep0 >= 8)
+            for ( ; len >= 8; len -= 8, d += 8, m += 8)
+                set_ne64(d, get_ne64(m));
+        for ( ; len > 0; len--)
+            *d++ = *m++;
+        prev_byte = d[-1];
+    }
+    RC_NORM; // LzmaDecode() does a final normalize as well
+    *dst_len = pos;
+    return rc.ip == rc.ip_end ? UPX_E_OK : UPX_E_INPUT_NOT_CONSUMED;
+
+error:
+    *dst_len = 0;
+    return UPX_E_ERROR;
+}
+
+#undef RC_NORM
+#undef RC_BIT
+#undef RC_TREE
+
+} // namespace
+
 int upx_lzma_decompress    ( const upx_bytep src, unsigned  src_len,
                                    upx_bytep dst, unsigned* dst_len,
                                    int method,
@@ -439,54 +1776,34 @@ int upx_lzma_decompress    ( const upx_bytep src, unsigned  src_len,
     COMPILE_TIME_ASSERT(LZMA_BASE_SIZE == 1846)
     COMPILE_TIME_ASSERT(LZMA_LIT_SIZE == 768)
 
-    CLzmaDecoderState s; memset(&s, 0, sizeof(s));
-    SizeT src_out = 0, dst_out = 0;
-    int r = UPX_E_ERROR;
-    int rh;
-
     if (src_len < 3)
-        goto error;
-    s.Properties.pb = src[0] & 7;
-    s.Properties.lp = (src[1] >> 4);
-    s.Properties.lc = src[1] & 15;
-    if (s.Properties.pb >= 5) goto error;
-    if (s.Properties.lp >= 5) goto error;
-    if (s.Properties.lc >= 9) goto error;
+    {
+        *dst_len = 0;
+        return UPX_E_ERROR;
+    }
+    const unsigned pb = src[0] & 7;
+    const unsigned lp = src[1] >> 4;
+    const unsigned lc = src[1] & 15;
     // extra
-    if ((src[0] >> 3) != s.Properties.lc + s.Properties.lp) goto error;
-    src += 2; src_len -= 2;
+    if (pb >= 5 || lp >= 5 || lc >= 9 || (src[0] >> 3) != lc + lp)
+    {
+        *dst_len = 0;
+        return UPX_E_ERROR;
+    }
 
     if (cresult)
     {
         assert(cresult->method == method);
-        assert(cresult->result_lzma.pos_bits == (unsigned) s.Properties.pb);
-        assert(cresult->result_lzma.lit_pos_bits == (unsigned) s.Properties.lp);
-        assert(cresult->result_lzma.lit_context_bits == (unsigned) s.Properties.lc);
-        assert(cresult->result_lzma.num_probs == (unsigned) LzmaGetNumProbs(&s.Properties));
+        assert(cresult->result_lzma.pos_bits == pb);
+        assert(cresult->result_lzma.lit_pos_bits == lp);
+        assert(cresult->result_lzma.lit_context_bits == lc);
+        assert(cresult->result_lzma.num_probs == LZMA_P_LITERAL + (0x300u << (lc + lp)));
         const lzma_compress_result_t *res = &cresult->result_lzma;
         UNUSED(res);
         //printf("\nlzma_decompress config: %u %u %u %u %u\n", res->pos_bits, res->lit_pos_bits, res->lit_context_bits, res->dict_size, res->num_probs);
     }
-    s.Probs = (CProb *) malloc(sizeof(CProb) * LzmaGetNumProbs(&s.Properties));
-    if (!s.Probs)
-    {
-        r = UPX_E_OUT_OF_MEMORY;
-        goto error;
-    }
-    rh = LzmaDecode(&s, src, src_len, &src_out, dst, *dst_len, &dst_out);
-    assert(src_out <=  src_len);
-    assert(dst_out <= *dst_len);
-    if (rh == 0)
-    {
-        r = UPX_E_OK;
-        if (src_out != src_len)
-            r = UPX_E_INPUT_NOT_CONSUMED;
-    }
-
-error:
-    *dst_len = dst_out;
-    free(s.Probs);
-    return r;
+    LzmaDecoder dec(lc, lp, pb);
+    return dec.decode(src + 2, src_len - 2, dst, dst_len);
 }
 
 
@@ -520,6 +1837,328 @@ int upx_lzma_test_overlap  ( const upx_bytep buf,
 }
 
 
+/*************************************************************************
+// find_overlap - see upx_find_overlap()
+//
+// This is a plain LZMA decoder that reads its input in exactly the same
+// order as LzmaDecode(), i.e. a byte is only fetched when the range coder
+// needs it. Along the way it records how far the write position runs
+// ahead of the read position, which is what limits in-place decompression.
+**************************************************************************/
+
+namespace {
+struct LzmaTrackingDecoder
+{
+    const upx_bytep src;
+    unsigned src_len;
+    unsigned ip;
+    upx_uint32_t range;
+    upx_uint32_t code;
+    bool overrun;
+
+    void normalize()
+    {
+        if (range < (1u << 24))
+        {
+            range <<= 8;
+            code <<= 8;
+            if (ip < src_len)
+                code |= src[ip++];
+            else
+                overrun = true;
+        }
+    }
+    unsigned bit(unsigned short *p)
+    {
+        normalize();
+        upx_uint32_t bound = (range >> 11) * *p;
+        if (code < bound)
+        {
+            range = bound;
+            *p = (unsigned short) (*p + (((1u << 11) - *p) >> 5));
+            return 0;
+        }
+        range -= bound;
+        code -= bound;
+        *p = (unsigned short) (*p - (*p >> 5));
+        return 1;
+    }
+    unsigned tree(unsigned short *p, unsigned num_bits)
+    {
+        unsigned m = 1;
+        for (unsigned i = 0; i < num_bits; i++)
+            m = (m << 1) + bit(p + m);
+        return m - (1u << num_bits);
+    }
+    unsigned reverse_tree(unsigned short *p, unsigned num_bits)
+    {
+        unsigned m = 1, r = 0;
+        for (unsigned i = 0; i < num_bits; i++)
+        {
+            unsigned b = bit(p + m);
+            m = (m << 1) + b;
+            r |= b << i;
+        }
+        return r;
+    }
+    unsigned length(unsigned short *p, unsigned pos_state)
+    {
+        // p[0] choice, p[1] choice2, p[2..] low, p[130..] mid, p[258..] high
+        if (!bit(p + 0))
+            return tree(p + 2 + (pos_state << 3), 3);
+        if (!bit(p + 1))
+            return 8 + tree(p + 130 + (pos_state << 3), 3);
+        return 16 + tree(p + 258, 8);
+    }
+};
+
+// Remembers the writes that get close to the maximum distance "need" the
+// write position runs ahead of the read position. Overwriting a not yet
+// read input byte is harmless if it happens to get the same value (which is
+// quite common for runs of zeros), and upx_lzma_test_overlap() will accept
+// that, so we try to lower "need" accordingly once the output is known.
+struct LzmaOverlapTracker
+{
+    enum { WINDOW = 256, MAX_WRITES = 1024 };
+    struct Write { unsigned start, end, ip; };
+    Write writes[MAX_WRITES];
+    unsigned n_writes;
+    unsigned need;
+    bool lost;
+
+    void note(unsigned start, unsigned end, unsigned ip)
+    {
+        if (end <= ip || end - ip + WINDOW <= need)
+            return;
+        need = UPX_MAX(need, end - ip);
+        if (n_writes == MAX_WRITES)
+        {
+            unsigned j = 0;
+            for (unsigned i = 0; i < n_writes; i++)
+                if (writes[i].end - writes[i].ip + WINDOW > need)
+                    writes[j++] = writes[i];
+            n_writes = j;
+        }
+        if (n_writes == MAX_WRITES)
+        {
+            lost = true;
+            return;
+        }
+        Write &w = writes[n_writes++];
+        w.start = start; w.end = end; w.ip = ip;
+    }
+    bool harmless(const upx_bytep src, unsigned src_len, const upx_bytep dst, unsigned off) const
+    {
+        // only input bytes that still get read later on do matter
+        for (unsigned i = 0; i < n_writes; i++)
+        {
+            const unsigned end = UPX_MIN(writes[i].end, off + src_len);
+            for (unsigned p = UPX_MAX(writes[i].start, off + writes[i].ip); p < end; p++)
+                if (dst[p] != src[p - off])
+                    return false;
+        }
+        return true;
+    }
+    unsigned refine(const upx_bytep src, unsigned src_len, const upx_bytep dst) const
+    {
+        unsigned off = need;
+        if (!lost)
+            while (off > 0 && need - off + 1 < WINDOW && harmless(src, src_len, dst, off - 1))
+                off--;
+        return off;
+    }
+};
+} // namespace
+
+// Returns the smallest "src_off" so that the data can get decompressed
+// in-place from buf + src_off to buf, in the same way as
+// upx_lzma_test_overlap() does. Very rarely the range decoder may even
+// survive a damaged final byte, so upx_lzma_test_overlap() might accept
+// a slightly smaller value - the caller has to deal with that.
+static int lzma_find_src_off(const upx_bytep src, unsigned src_len, unsigned dst_len,
+                             unsigned *src_off)
+{
+    COMPILE_TIME_ASSERT(LZMA_P_IS_REP0_LONG == IsRep0Long)
+    COMPILE_TIME_ASSERT(LZMA_P_LEN == LenCoder)
+    COMPILE_TIME_ASSERT(LZMA_P_LITERAL == Literal)
+
+    if (src_len < 3)
+        return UPX_E_ERROR;
+    const unsigned pb = src[0] & 7;
+    const unsigned lp = src[1] >> 4;
+    const unsigned lc = src[1] & 15;
+    if (pb >= 5 || lp >= 5 || lc >= 9 || (src[0] >> 3) != lc + lp)
+        return UPX_E_ERROR;
+    const unsigned num_probs = LZMA_P_LITERAL + (0x300u << (lc + lp));
+    MemBuffer probs_buf(mem_size(sizeof(unsigned short), num_probs));
+    unsigned short *const probs = (unsigned short *) probs_buf.getVoidPtr();
+    for (unsigned i = 0; i < num_probs; i++)
+        probs[i] = 1u << 10;
+    MemBuffer dst_buf(dst_len);
+    upx_bytep const dst = dst_buf;
+
+    LzmaTrackingDecoder rc;
+    rc.src = src;
+    rc.src_len = src_len;
+    rc.ip = 2;
+    rc.range = 0xffffffff;
+    rc.code = 0;
+    rc.overrun = false;
+    if (src_len < 2 + 5)
+        return UPX_E_INPUT_OVERRUN;
+    for (int i = 0; i < 5; i++)
+        rc.code = (rc.code << 8) | src[rc.ip++];
+
+    const unsigned pos_mask = (1u << pb) - 1;
+    const unsigned lit_pos_mask = (1u << lp) - 1;
+    unsigned state = 0;
+    upx_uint32_t rep0 = 1, rep1 = 1, rep2 = 1, rep3 = 1;
+    unsigned pos = 0;
+    unsigned prev_byte = 0;
+    // when writing dst[p] we need "p < src_off + rc.ip", as the byte at
+    // src_off + rc.ip is the next one to be read
+    LzmaOverlapTracker tr;
+    tr.n_writes = 0;
+    tr.need = 0;
+    tr.lost = false;
+
+    while (pos < dst_len)
+    {
+        if (rc.overrun)
+            return UPX_E_INPUT_OVERRUN;
+        const unsigned pos_state = pos & pos_mask;
+        if (!rc.bit(probs + LZMA_P_IS_MATCH + (state << 4) + pos_state))
+        {
+            unsigned short *p = probs + LZMA_P_LITERAL +
+                0x300 * (((pos & lit_pos_mask) << lc) + (prev_byte >> (8 - lc)));
+            unsigned symbol = 1;
+            if (state >= 7)
+            {
+                if (rep0 > pos)
+                    return UPX_E_ERROR;
+                unsigned match_byte = dst[pos - rep0];
+                do {
+                    match_byte <<= 1;
+                    const unsigned match_bit = match_byte & 0x100;
+                    const unsigned b = rc.bit(p + 0x100 + match_bit + symbol);
+                    symbol = (symbol << 1) + b;
+                    if (b != (match_bit >> 8))
+                        break;
+                } while (symbol < 0x100);
+            }
+            while (symbol < 0x100)
+                symbol = (symbol << 1) + rc.bit(p + symbol);
+            prev_byte = symbol & 0xff;
+            tr.note(pos, pos + 1, rc.ip);
+            dst[pos++] = (unsigned char) prev_byte;
+            state = state < 4 ? 0 : (state < 10 ? state - 3 : state - 6);
+            continue;
+        }
+        unsigned len;
+        if (!rc.bit(probs + LZMA_P_IS_REP + state))
+        {
+            // match
+            rep3 = rep2; rep2 = rep1; rep1 = rep0;
+            len = rc.length(probs + LZMA_P_LEN, pos_state);
+            state = state < 7 ? 7 : 10;
+            const unsigned slot = rc.tree(probs + LZMA_P_POS_SLOT + (UPX_MIN(len, 3u) << 6), 6);
+            if (slot >= 4)
+            {
+                unsigned num_direct_bits = (slot >> 1) - 1;
+                rep0 = (2 | (slot & 1)) << num_direct_bits;
+                if (slot < 14)
+                    rep0 += rc.reverse_tree(probs + LZMA_P_SPEC_POS + rep0 - slot - 1, num_direct_bits);
+                else
+                {
+                    for (num_direct_bits -= 4; num_direct_bits > 0; num_direct_bits--)
+                    {
+                        rc.normalize();
+                        rc.range >>= 1;
+                        if (rc.code >= rc.range)
+                        {
+                            rc.code -= rc.range;
+                            rep0 += 1u << (num_direct_bits - 1 + 4);
+                        }
+                    }
+                    rep0 += rc.reverse_tree(probs + LZMA_P_ALIGN, 4);
+                }
+            }
+            else
+                rep0 = slot;
+            if (++rep0 == 0)
+                break; // end marker
+        }
+        else
+        {
+            if (!rc.bit(probs + LZMA_P_IS_REP_G0 + state))
+            {
+                if (!rc.bit(probs + LZMA_P_IS_REP0_LONG + (state << 4) + pos_state))
+                {
+                    // short rep
+                    if (pos == 0 || rep0 > pos)
+                        return UPX_E_ERROR;
+                    state = state < 7 ? 9 : 11;
+                    prev_byte = dst[pos - rep0];
+                    tr.note(pos, pos + 1, rc.ip);
+                    dst[pos++] = (unsigned char) prev_byte;
+                    continue;
+                }
+            }
+            else
+            {
+                upx_uint32_t dist;
+                if (!rc.bit(probs + LZMA_P_IS_REP_G1 + state))
+                    dist = rep1;
+                else
+                {
+                    if (!rc.bit(probs + LZMA_P_IS_REP_G2 + state))
+                        dist = rep2;
+                    else
+                    {
+                        dist = rep3;
+                        rep3 = rep2;
+                    }
+                    rep2 = rep1;
+                }
+                rep1 = rep0;
+                rep0 = dist;
+            }
+            len = rc.length(probs + LZMA_P_REP_LEN, pos_state);
+            state = state < 7 ? 8 : 11;
+        }
+        len += 2;
+        if (rep0 > pos)
+            return UPX_E_LOOKBEHIND_OVERRUN;
+        len = UPX_MIN(len, dst_len - pos);
+        tr.note(pos, pos + len, rc.ip);
+        do {
+            prev_byte = dst[pos - rep0];
+            dst[pos++] = (unsigned char) prev_byte;
+        } while (--len != 0);
+    }
+    rc.normalize(); // LzmaDecode() does a final normalize as well
+    if (rc.overrun)
+        return UPX_E_INPUT_OVERRUN;
+    if (pos != dst_len)
+        return UPX_E_ERROR;
+    if (rc.ip != src_len)
+        return UPX_E_INPUT_NOT_CONSUMED;
+    *src_off = tr.refine(src, src_len, dst);
+    return UPX_E_OK;
+}
+
+int upx_lzma_find_overlap  ( const upx_bytep src, unsigned src_len,
+                                   unsigned  dst_len,
+                                   unsigned* src_off,
+                                   int method,
+                             const upx_compress_result_t *cresult )
+{
+    assert(M_IS_LZMA(method));
+    UNUSED(cresult);
+    return lzma_find_src_off(src, src_len, dst_len, src_off);
+}
+
+
 /*************************************************************************
 // misc
 **************************************************************************/
@@ -539,5 +2178,218 @@ const char *upx_lzma_version_string(void)
 #endif
 }
 
+/*************************************************************************
+// Debug checks
+**************************************************************************/
+
+#if DEBUG && 1
+
+static bool check_lzma_overlap(const unsigned u_len)
+{
+    MemBuffer u_buf(u_len), c_buf;
+    upx_compress_result_t cresult;
+    unsigned c_len, src_off, x_len;
+    int r;
+
+    // compressible data with an incompressible tail, so that
+    // the overlap is not trivial
+    for (unsigned i = 0; i < u_len; i++)
+        u_buf[i] = (upx_byte) (i < u_len - 512 ? i / 64 : i * 0x9e3779b1u >> 24);
+    c_buf.allocForCompression(u_len);
+    c_len = c_buf.getSize();
+    r = upx_lzma_compress(u_buf, u_len, c_buf, &c_len, nullptr, M_LZMA, 2, NULL_cconf, &cresult);
+    if (r != 0 || c_len >= u_len) return false;
+
+    r = upx_lzma_find_overlap(c_buf, c_len, u_len, &src_off, M_LZMA, nullptr);
+    if (r != 0) return false;
+    src_off = UPX_MAX(src_off, u_len - c_len + 1);
+    MemBuffer o_buf(src_off + c_len);
+    memcpy(o_buf + src_off, c_buf, c_len);
+    x_len = u_len;
+    r = upx_lzma_test_overlap(o_buf, u_buf, src_off, c_len, &x_len, M_LZMA, nullptr);
+    if (r != 0 || x_len != u_len) return false;
+    // a few bytes less must fail (see lzma_find_src_off() for the fine print)
+    if (src_off >= u_len - c_len + 1 + 8)
+    {
+        memcpy(o_buf + src_off - 8, c_buf, c_len);
+        x_len = u_len;
+        r = upx_lzma_test_overlap(o_buf, u_buf, src_off - 8, c_len, &x_len, M_LZMA, nullptr);
+        if (r == 0) return false;
+    }
+    return true;
+}
+
+TEST_CASE("upx_lzma_find_overlap") {
+    CHECK(check_lzma_overlap(16384));
+    CHECK(check_lzma_overlap(65536));
+}
+
+// LzmaDecoder must behave exactly like the reference LzmaDecode()
+static int lzma_reference_decompress(const upx_bytep src, unsigned src_len,
+                                     upx_bytep dst, unsigned *dst_len)
+{
+    CLzmaDecoderState s; memset(&s, 0, sizeof(s));
+    SizeT src_out = 0, dst_out = 0;
+    s.Properties.pb = src[0] & 7;
+    s.Properties.lp = (src[1] >> 4);
+    s.Properties.lc = src[1] & 15;
+    MemBuffer probs(mem_size(sizeof(CProb), LzmaGetNumProbs(&s.Properties)));
+    s.Probs = (CProb *) probs.getVoidPtr();
+    int r = LzmaDecode(&s, src + 2, src_len - 2, &src_out, dst, *dst_len, &dst_out);
+    *dst_len = (unsigned) dst_out;
+    if (r != 0)
+        return UPX_E_ERROR;
+    return src_out == src_len - 2 ? UPX_E_OK : UPX_E_INPUT_NOT_CONSUMED;
+}
+
+static bool check_lzma_decoder(const upx_bytep u_buf, unsigned u_len, int level)
+{
+    MemBuffer c_buf, d1, d2;
+    upx_compress_result_t cresult;
+    unsigned c_len, d1_len, d2_len;
+    int r1, r2;
+
+    c_buf.allocForCompression(u_len);
+    c_len = c_buf.getSize();
+    if (upx_lzma_compress(u_buf, u_len, c_buf, &c_len, nullptr, M_LZMA, level, NULL_cconf, &cresult) != 0)
+        return false;
+    d1.alloc(u_len + 1);
+    d2.alloc(u_len + 1);
+    // complete stream, short output buffer, truncated and damaged input
+    for (int t = 0; t < 4; t++)
+    {
+        unsigned cl = c_len;
+        if (t == 2) cl = c_len - 1 - c_len / 3;
+        if (t == 3) c_buf[c_len / 2] ^= 0x20;
+        d1_len = d2_len = t == 0 ? u_len : (t == 1 ? u_len / 2 : u_len + 1);
+        r1 = lzma_reference_decompress(c_buf, cl, d1, &d1_len);
+        r2 = upx_lzma_decompress(c_buf, cl, d2, &d2_len, M_LZMA, nullptr);
+        if (r1 != r2 || d1_len != d2_len || memcmp(d1, d2, d1_len) != 0)
+            return false;
+        if (t == 0 && (r2 != 0 || d2_len != u_len || memcmp(u_buf, d2, u_len) != 0))
+            return false;
+    }
+    return true;
+}
+
+TEST_CASE("upx_lzma_decompress") {
+    const unsigned u_len = 100000;
+    MemBuffer u_buf(u_len);
+    unsigned x = 1;
+    for (unsigned i = 0; i < u_len; i++) {
+        x = x * 1103515245 + 12345;
+        u_buf[i] = (i >= 256 && (x & 0x10000)) ? u_buf[i - 1 - (x >> 24)] : (upx_byte) ((x >> 28) + 'a');
+    }
+    CHECK(check_lzma_decoder(u_buf, u_len, 2));
+    CHECK(check_lzma_decoder(u_buf, u_len, 9));
+    CHECK(check_lzma_decoder(u_buf, 300, 5));
+}
+
+// the output of the parallel encoder must not depend on the number of threads
+static bool check_lzma_fast(const upx_bytep u_buf, unsigned u_len, int level, int threads,
+                            MemBuffer &c_buf, unsigned *c_len)
+{
+    MemBuffer d_buf;
+    upx_compress_result_t cresult;
+    unsigned d_len;
+    int r;
+
+    options_t *const saved_opt = opt;
+    options_t local_options;
+    opt = &local_options;
+    opt->reset();
+    opt->threads = threads;
+    c_buf.allocForCompression(u_len);
+    *c_len = c_buf.getSize();
+    r = upx_lzma_compress(u_buf, u_len, c_buf, c_len, nullptr, M_LZMA, level, NULL_cconf, &cresult);
+    opt = saved_opt;
+    if (r != 0 || *c_len >= u_len || cresult.result_lzma.fast_mode != 0) return false;
+
+    d_buf.allocForUncompression(u_len);
+    d_len = d_buf.getSize();
+    r = upx_lzma_decompress(c_buf, *c_len, d_buf, &d_len, M_LZMA, &cresult);
+    if (r != 0 || d_len != u_len) return false;
+    return memcmp(u_buf, d_buf, u_len) == 0;
+}
+
+TEST_CASE("upx_lzma_compress parallel") {
+    // more than one segment of the match finder
+    const unsigned u_len = 1200000;
+    MemBuffer u_buf(u_len);
+    unsigned x = 1;
+    for (unsigned i = 0; i < u_len; i++) {
+        x = x * 1103515245 + 12345;
+        u_buf[i] = (i >= 4096 && (x & 0x30000)) ? u_buf[i - 1 - (x >> 20) % 4000] : (upx_byte) (x >> 24);
+    }
+    MemBuffer c1, c4;
+    unsigned c1_len, c4_len;
+    CHECK(check_lzma_fast(u_buf, u_len, 1, 1, c1, &c1_len));
+    CHECK(check_lzma_fast(u_buf, u_len, 1, 4, c4, &c4_len));
+    CHECK((c1_len == c4_len && memcmp(c1, c4, c1_len) == 0));
+}
+
+// a pooled encoder must give the same output as a new one
+TEST_CASE("upx_lzma_compress pool") {
+    const unsigned u_len = 50000;
+    MemBuffer u_buf(u_len);
+    unsigned x = 1;
+    for (unsigned i = 0; i < u_len; i++) {
+        x = x * 1103515245 + 12345;
+        u_buf[i] = (i >= 256 && (x & 0x30000)) ? u_buf[i - 1 - (x >> 24)] : (upx_byte) (x >> 24);
+    }
+    // the second run changes the dictionary size and the literal coder
+    const int methods[4] = {M_LZMA, M_LZMA | 0x020200, M_LZMA, M_LZMA};
+    const unsigned lens[4] = {u_len, u_len / 2, u_len, u_len};
+    MemBuffer c_buf[4];
+    unsigned c_len[4];
+    unsigned created0, reused0, created, reused;
+    MyLzma::encoder_pool.drop();
+    upx_lzma_pool_stats(&created0, &reused0);
+    for (int i = 0; i < 4; i++) {
+        upx_compress_result_t cresult;
+        c_buf[i].allocForCompression(lens[i]);
+        c_len[i] = c_buf[i].getSize();
+        CHECK(upx_lzma_compress(u_buf, lens[i], c_buf[i], &c_len[i], nullptr, methods[i], 7,
+                                NULL_cconf, &cresult) == 0);
+    }
+    upx_lzma_pool_stats(&created, &reused);
+    CHECK(created - created0 >= 1);
+    CHECK(reused - reused0 >= 1);
+    CHECK((c_len[0] == c_len[2] && memcmp(c_buf[0], c_buf[2], c_len[0]) == 0));
+    CHECK((c_len[0] == c_len[3] && memcmp(c_buf[0], c_buf[3], c_len[0]) == 0));
+}
+
+TEST_CASE("upx_lzma_tune") {
+    // like the code of a RISC CPU: 32-bit words, the top byte from a small set
+    const unsigned u_len = 192 * 1024;
+    MemBuffer u_buf(u_len);
+    unsigned x = 1;
+    for (unsigned i = 0; i < u_len; i += 4) {
+        x = x * 1103515245 + 12345;
+        set_le32(u_buf + i, ((0x90 + ((x >> 28) & 7)) << 24) | ((x >> 8) & 0xfff));
+    }
+    upx_compress_config_t cconf;
+    cconf.reset();
+    cconf.conf_lzma.lit_context_bits = 2;
+    lzma_compress_config_t tuned;
+    CHECK(upx_lzma_tune(u_buf, u_len, 5, &cconf, &tuned) == 0);
+    // what is set stays, and lc + lp does not grow
+    CHECK(tuned.lit_context_bits == 2u);
+    CHECK(tuned.lit_context_bits + tuned.lit_pos_bits <= 2u);
+    CHECK(tuned.pos_bits <= 2u);
+    cconf.conf_lzma = tuned;
+    upx_compress_result_t cresult;
+    MemBuffer c_buf, d_buf;
+    c_buf.allocForCompression(u_len);
+    unsigned c_len = c_buf.getSize();
+    CHECK(upx_lzma_compress(u_buf, u_len, c_buf, &c_len, nullptr, M_LZMA, 5, &cconf, &cresult) == 0);
+    d_buf.allocForUncompression(u_len);
+    unsigned d_len = d_buf.getSize();
+    CHECK(upx_lzma_decompress(c_buf, c_len, d_buf, &d_len, M_LZMA, &cresult) == 0);
+    CHECK((d_len == u_len && memcmp(u_buf, d_buf, u_len) == 0));
+}
+
+#endif // DEBUG
+
 
 /* vim:set ts=4 sw=4 et: */
@@ -28,6 +28,8 @@
 
 #include "conf.h"
 #include "compress.h"
+#include "mem.h"
+#include <atomic>
 
 
 /*************************************************************************
@@ -66,6 +68,417 @@ static void __UCL_CDECL wrap_nprogress_ucl(ucl_uint a, ucl_uint b, int state, uc
 }}
 
 
+/*************************************************************************
+// fast NRV2B/NRV2D/NRV2E encoder for the low compression levels
+//
+// ucl_nrv2X_99_compress() always runs the exhaustive "99" match finder,
+// the level only limits its search depth. For levels 1-6 we use this
+// simple hash-chain encoder with greedy (1-3) or lazy (4-6) parsing
+// instead. It writes exactly the same bitstream as UCL (see
+// nrv_find_src_off() below for the decoding side), so the stub
+// decompressors do not care which encoder was used.
+**************************************************************************/
+
+namespace {
+
+template <int N, int E>
+class NrvFastEncoder
+{
+public:
+    NrvFastEncoder(const upx_bytep src_, unsigned src_len_, upx_bytep dst_,
+                   unsigned max_offset_, unsigned max_match_, int level) :
+        src(src_), src_len(src_len_), out(dst_),
+        max_offset(max_offset_), max_match(max_match_)
+    {
+        static const unsigned char chains[6] = { 1, 2, 4, 8, 16, 32 };
+        chain = chains[level - 1];
+        nice = 8u << level;
+        lazy = level >= 4;
+        head.alloc(sizeof(unsigned) << HBITS);
+        head.fill(0, head.getSize(), 0xff);
+        prev.alloc(sizeof(unsigned) << WBITS);
+    }
+
+    int compress(unsigned *dst_len, upx_callback_p cb, const upx_compress_config_t *cconf,
+                 ucl_uint *res);
+
+private:
+    enum { HBITS = 16, WBITS = 16 };
+    enum { M2_MAX_OFFSET = (N == 'b') ? 0xd00 : 0x500 };
+    static const unsigned NIL = 0xffffffffu;
+
+    struct Match { unsigned len, off; int gain; };
+
+    const upx_byte *const src;
+    const unsigned src_len;
+    upx_byte *const out;
+    const unsigned max_offset, max_match;
+    unsigned chain, nice;
+    bool lazy;
+    MemBuffer head, prev;           // hash chains
+    unsigned ins = 0;               // next position to insert
+    unsigned last_m_off = 1;
+    unsigned olen = 0;
+    unsigned bb_pos = 0, bb_k = 0;  // bit-buffer
+    upx_uint32_t bb = 0;
+
+    // the bit-buffer is stored in front of the bytes that follow its first bit
+    void putbyte(unsigned b) { out[olen++] = (unsigned char) b; }
+    void putbit(unsigned bit)
+    {
+        if (bb_k == 0)
+        {
+            bb_pos = olen;
+            olen += E / 8;
+        }
+        bb = bb * 2 + bit;
+        if (++bb_k == E)
+            flushbits();
+    }
+    void flushbits()
+    {
+        if (bb_k == 0)
+            return;
+        bb <<= E - bb_k;
+        if (E == 8)
+            out[bb_pos] = (unsigned char) bb;
+        else if (E == 16)
+            set_le16(out + bb_pos, bb);
+        else
+            set_le32(out + bb_pos, bb);
+        bb = 0;
+        bb_k = 0;
+    }
+
+    void code_ss11(unsigned v);
+    void code_ss12(unsigned v);
+    static unsigned len_ss11(unsigned v);
+    static unsigned len_ss12(unsigned v);
+    unsigned cost(unsigned m_len, unsigned m_off) const;
+    void code_match(unsigned m_len, unsigned m_off);
+
+    unsigned *heads() { return (unsigned *) (upx_bytep) head; }
+    unsigned *prevs() { return (unsigned *) (upx_bytep) prev; }
+    unsigned hash(unsigned pos) const
+    {
+        const unsigned v = src[pos] | (src[pos + 1] << 8) | (src[pos + 2] << 16);
+        return (v * 0x9e3779b1u) >> (32 - HBITS);
+    }
+    void insert_upto(unsigned pos);
+    unsigned match_len(unsigned a, unsigned b, unsigned max_len) const
+    {
+        unsigned len = 0;
+        while (len + 4 <= max_len && get_ne32(src + a + len) == get_ne32(src + b + len))
+            len += 4;
+        while (len < max_len && src[a + len] == src[b + len])
+            len++;
+        return len;
+    }
+    void consider(Match &m, unsigned m_len, unsigned m_off) const
+    {
+        if (m_len < 2u + (m_off > M2_MAX_OFFSET))
+            return;
+        // number of bits saved compared to coding literals
+        const int gain = (int) (9 * m_len) - (int) cost(m_len, m_off);
+        if (gain > m.gain)
+        {
+            m.len = m_len;
+            m.off = m_off;
+            m.gain = gain;
+        }
+    }
+    void find(unsigned pos, Match &m);
+};
+
+// gamma codes: starting with 1, the decoder shifts in one data bit
+// followed by a stop bit; "ss12" (the offsets of NRV2D/NRV2E) does an
+// extra step x = 2*(x-1)+bit between the stop bits
+template <int N, int E>
+void NrvFastEncoder<N, E>::code_ss11(unsigned v)
+{
+    unsigned t = 1;
+    while ((v >> 1) >= t)
+        t <<= 1;
+    while ((t >>= 1) != 0)
+    {
+        putbit((v & t) != 0);
+        putbit(t == 1);
+    }
+}
+
+template <int N, int E>
+unsigned NrvFastEncoder<N, E>::len_ss11(unsigned v)
+{
+    unsigned n = 0;
+    while (v >= 2)
+    {
+        v >>= 1;
+        n += 2;
+    }
+    return n;
+}
+
+template <int N, int E>
+void NrvFastEncoder<N, E>::code_ss12(unsigned v)
+{
+    // undo the decoder steps, collecting the bits in reverse order
+    unsigned char bits[64];
+    unsigned n = 0;
+    unsigned stop = 1;
+    for (;;)
+    {
+        bits[n++] = (unsigned char) stop;
+        bits[n++] = (unsigned char) (v & 1);
+        v >>= 1;
+        if (v == 1)
+            break;
+        bits[n++] = (unsigned char) (v & 1);
+        v = (v >> 1) + 1;
+        stop = 0;
+    }
+    while (n > 0)
+        putbit(bits[--n]);
+}
+
+template <int N, int E>
+unsigned NrvFastEncoder<N, E>::len_ss12(unsigned v)
+{
+    unsigned n = 2;
+    while ((v >>= 1) != 1)
+    {
+        v = (v >> 1) + 1;
+        n += 3;
+    }
+    return n;
+}
+
+template <int N, int E>
+unsigned NrvFastEncoder<N, E>::cost(unsigned m_len, unsigned m_off) const
+{
+    const unsigned code = m_len - 1 - (m_off > M2_MAX_OFFSET);
+    unsigned c = 1;
+    if (m_off == last_m_off)
+        c += (N == 'b') ? 2 : 3;
+    else if (N == 'b')
+        c += len_ss11(((m_off - 1) >> 8) + 3) + 8;
+    else
+        c += len_ss12(((m_off - 1) >> 7) + 3) + 8;
+    if (N == 'b')
+        c += 1;
+    if (N == 'e')
+        c += (code <= 2) ? 1 : (code <= 4) ? 2 : 2 + len_ss11(code - 3);
+    else
+        c += (code <= 3) ? 1 : 1 + len_ss11(code - 2);
+    return c;
+}
+
+template <int N, int E>
+void NrvFastEncoder<N, E>::code_match(unsigned m_len, unsigned m_off)
+{
+    const unsigned code = m_len - 1 - (m_off > M2_MAX_OFFSET);
+    unsigned lenbit;
+    if (N == 'e')
+        lenbit = code <= 2;
+    else
+        lenbit = code <= 3 ? code >> 1 : 0;
+
+    putbit(0);
+    if (m_off == last_m_off)
+    {
+        putbit(0);
+        putbit(1);
+        if (N != 'b')
+            putbit(lenbit);
+    }
+    else
+    {
+        unsigned raw = m_off - 1;
+        if (N == 'b')
+            code_ss11((raw >> 8) + 3);
+        else
+        {
+            // NRV2D/NRV2E store the first length bit in the offset
+            raw = (raw << 1) | (lenbit ^ 1);
+            code_ss12((raw >> 8) + 3);
+        }
+        putbyte(raw & 0xff);
+        last_m_off = m_off;
+    }
+    if (N == 'b')
+        putbit(lenbit);
+
+    if (N == 'e')
+    {
+        if (code <= 2)
+            putbit(code - 1);
+        else if (code <= 4)
+        {
+            putbit(1);
+            putbit(code - 3);
+        }
+        else
+        {
+            putbit(0);
+            code_ss11(code - 3);
+        }
+    }
+    else
+    {
+        if (code <= 3)
+            putbit(code & 1);
+        else
+        {
+            putbit(0);
+            code_ss11(code - 2);
+        }
+    }
+}
+
+template <int N, int E>
+void NrvFastEncoder<N, E>::insert_upto(unsigned pos)
+{
+    unsigned *h = heads();
+    unsigned *p = prevs();
+    for ( ; ins < pos && ins + 3 <= src_len; ins++)
+    {
+        const unsigned hv = hash(ins);
+        p[ins & ((1u << WBITS) - 1)] = h[hv];
+        h[hv] = ins;
+    }
+}
+
+template <int N, int E>
+void NrvFastEncoder<N, E>::find(unsigned pos, Match &m)
+{
+    m.len = m.off = 0;
+    m.gain = 0;
+    const unsigned max_len = UPX_MIN(src_len - pos, max_match);
+    if (max_len < 2)
+        return;
+
+    // the last offset is very cheap to code
+    if (last_m_off <= pos)
+        consider(m, match_len(pos - last_m_off, pos, max_len), last_m_off);
+
+    if (pos + 3 > src_len)
+        return;
+    insert_upto(pos);
+    if (ins != pos)
+        return;
+    unsigned *h = heads();
+    unsigned *p = prevs();
+    const unsigned hv = hash(pos);
+    unsigned cand = h[hv];
+    for (unsigned n = chain; n > 0 && cand != NIL; n--)
+    {
+        const unsigned off = pos - cand;
+        if (off > max_offset)
+            break;
+        if (m.len < max_len && src[cand + m.len] == src[pos + m.len])
+            consider(m, match_len(cand, pos, max_len), off);
+        if (m.len >= nice || m.len >= max_len)
+            break;
+        const unsigned next = p[cand & ((1u << WBITS) - 1)];
+        if (next >= cand)
+            break;
+        cand = next;
+    }
+    p[pos & ((1u << WBITS) - 1)] = h[hv];
+    h[hv] = pos;
+    ins = pos + 1;
+}
+
+template <int N, int E>
+int NrvFastEncoder<N, E>::compress(unsigned *dst_len, upx_callback_p cb,
+                                   const upx_compress_config_t *cconf, ucl_uint *res)
+{
+    unsigned max_offset_found = 0, max_match_found = 0, max_run_found = 0;
+    unsigned first_offset_found = 0;
+    unsigned run = 0;
+    unsigned next_progress = 0;
+    // small steps for small inputs, for the sake of the budget check
+    const unsigned progress_step = UPX_MIN(256 * 1024u, src_len / 16 + 1);
+    unsigned pos = 0;
+
+    while (pos < src_len)
+    {
+        if (pos >= next_progress)
+        {
+            if (cb && cb->nprogress)
+                cb->nprogress(cb, pos, olen);
+            if (upx_compress_over_budget(cconf, olen))
+                return UPX_E_BUDGET_EXCEEDED;
+            next_progress = pos + progress_step;
+        }
+        Match m;
+        find(pos, m);
+        while (lazy && m.gain > 0 && m.len < nice && pos + 1 < src_len)
+        {
+            Match m2;
+            find(pos + 1, m2);
+            if (m2.gain <= m.gain)
+                break;
+            putbit(1);
+            putbyte(src[pos++]);
+            run++;
+            m = m2;
+        }
+        if (m.gain <= 0)
+        {
+            putbit(1);
+            putbyte(src[pos++]);
+            run++;
+            continue;
+        }
+        if (first_offset_found == 0)
+            first_offset_found = m.off;
+        max_offset_found = UPX_MAX(max_offset_found, m.off);
+        max_match_found = UPX_MAX(max_match_found, m.len);
+        max_run_found = UPX_MAX(max_run_found, run);
+        run = 0;
+        code_match(m.len, m.off);
+        pos += m.len;
+    }
+    max_run_found = UPX_MAX(max_run_found, run);
+
+    // EOF marker
+    putbit(0);
+    if (N == 'b')
+        code_ss11(0xffffffu + 3);
+    else
+        code_ss12(0xffffffu + 3);
+    putbyte(0xff);
+    flushbits();
+
+    if (cb && cb->nprogress)
+        cb->nprogress(cb, src_len, olen);
+    res[1] = max_offset_found;
+    res[3] = max_match_found;
+    res[5] = max_run_found;
+    res[6] = first_offset_found;
+    *dst_len = olen;
+    return UPX_E_OK;
+}
+
+template <int N, int E>
+int nrv_fast_compress(const upx_bytep src, unsigned src_len,
+                      upx_bytep dst, unsigned *dst_len,
+                      upx_callback_p cb, int level, const ucl_compress_config_t &cconf,
+                      const upx_compress_config_t *cconf_parm, ucl_uint *res)
+{
+    unsigned max_offset = cconf.max_offset;
+    unsigned max_match = cconf.max_match;
+    if (max_offset == 0)
+        max_offset = UCL_UINT_MAX;
+    if (max_match == 0)
+        max_match = UCL_UINT_MAX;
+    NrvFastEncoder<N, E> enc(src, src_len, dst, max_offset, max_match, level);
+    return enc.compress(dst_len, cb, cconf_parm, res);
+}
+
+} // namespace
+
+
 /*************************************************************************
 //
 **************************************************************************/
@@ -118,6 +531,34 @@ int upx_ucl_compress       ( const upx_bytep src, unsigned  src_len,
         return UPX_E_ERROR;
     }
 
+    // use the fast encoder for the low levels, unless the UCL
+    // internals have been tuned by the --crp-ucl-xx options
+    if (level <= 6 && cconf.c_flags < 0 && cconf.s_level < 0 &&
+        cconf.h_level < 0 && cconf.p_level < 0)
+    {
+        switch (method)
+        {
+        case M_NRV2B_8:
+            return nrv_fast_compress<'b', 8>(src, src_len, dst, dst_len, cb_parm, level, cconf, cconf_parm, res);
+        case M_NRV2B_LE16:
+            return nrv_fast_compress<'b', 16>(src, src_len, dst, dst_len, cb_parm, level, cconf, cconf_parm, res);
+        case M_NRV2B_LE32:
+            return nrv_fast_compress<'b', 32>(src, src_len, dst, dst_len, cb_parm, level, cconf, cconf_parm, res);
+        case M_NRV2D_8:
+            return nrv_fast_compress<'d', 8>(src, src_len, dst, dst_len, cb_parm, level, cconf, cconf_parm, res);
+        case M_NRV2D_LE16:
+            return nrv_fast_compress<'d', 16>(src, src_len, dst, dst_len, cb_parm, level, cconf, cconf_parm, res);
+        case M_NRV2D_LE32:
+            return nrv_fast_compress<'d', 32>(src, src_len, dst, dst_len, cb_parm, level, cconf, cconf_parm, res);
+        case M_NRV2E_8:
+            return nrv_fast_compress<'e', 8>(src, src_len, dst, dst_len, cb_parm, level, cconf, cconf_parm, res);
+        case M_NRV2E_LE16:
+            return nrv_fast_compress<'e', 16>(src, src_len, dst, dst_len, cb_parm, level, cconf, cconf_parm, res);
+        case M_NRV2E_LE32:
+            return nrv_fast_compress<'e', 32>(src, src_len, dst, dst_len, cb_parm, level, cconf, cconf_parm, res);
+        }
+    }
+
     // optimize compression parms
     if (level <= 3 && cconf.max_offset == UCL_UINT_MAX)
         cconf.max_offset = 8*1024-1;
@@ -249,13 +690,307 @@ int upx_ucl_test_overlap   ( const upx_bytep buf,
 }
 
 
+/*************************************************************************
+// find_overlap - see upx_find_overlap()
+//
+// This walks the compressed data exactly like the TEST_OVERLAP variants
+// of the UCL decompressors do, but instead of checking a given "src_off"
+// it records the smallest one that passes. It only depends on the
+// bitstream format, so it also serves the NRV library.
+**************************************************************************/
+
+template <int N, int E>
+static int nrv_find_src_off(const upx_bytep src, unsigned src_len, unsigned dst_len,
+                            unsigned *src_off)
+{
+    upx_uint32_t bb = 0;
+    unsigned bc = 0;
+    unsigned ilen = 0, olen = 0, last_m_off = 1;
+    unsigned need = 0;
+    bool overrun = false;
+
+    // see ucl/src/getbit.h
+    auto getbit = [&]() -> unsigned {
+        if (E == 8)
+        {
+            if (bb & 0x7f)
+                bb *= 2;
+            else if (ilen < src_len)
+                bb = src[ilen++] * 2 + 1;
+            else
+            {
+                overrun = true;
+                return 0;
+            }
+            return (bb >> 8) & 1;
+        }
+        else if (E == 16)
+        {
+            bb *= 2;
+            if (bb & 0xffff)
+                return (bb >> 16) & 1;
+            if (ilen + 2 > src_len)
+            {
+                overrun = true;
+                return 0;
+            }
+            bb = get_le16(src + ilen) * 2 + 1;
+            ilen += 2;
+            return (bb >> 16) & 1;
+        }
+        else
+        {
+            if (bc > 0)
+                return (bb >> --bc) & 1;
+            if (ilen + 4 > src_len)
+            {
+                overrun = true;
+                return 0;
+            }
+            bc = 31;
+            bb = get_le32(src + ilen);
+            ilen += 4;
+            return (bb >> 31) & 1;
+        }
+    };
+    // the TEST_OVERLAP decompressors check "olen <= src_off + ilen"
+#define NOTE_NEED(x)    if ((x) > ilen && (x) - ilen > need) need = (x) - ilen
+
+    for (;;)
+    {
+        unsigned m_off, m_len = 0;
+
+        while (getbit())
+        {
+            if (overrun || ilen >= src_len)
+                return UPX_E_INPUT_OVERRUN;
+            if (olen >= dst_len)
+                return UPX_E_OUTPUT_OVERRUN;
+            NOTE_NEED(olen);
+            olen++;
+            ilen++;
+        }
+        m_off = 1;
+        for (;;)
+        {
+            m_off = m_off * 2 + getbit();
+            if (overrun || ilen >= src_len)
+                return UPX_E_INPUT_OVERRUN;
+            if (m_off > 0xffffffu + 3)
+                return UPX_E_LOOKBEHIND_OVERRUN;
+            if (getbit())
+                break;
+            if (N != 'b')
+                m_off = (m_off - 1) * 2 + getbit();
+        }
+        if (m_off == 2)
+        {
+            m_off = last_m_off;
+            if (N != 'b')
+                m_len = getbit();
+        }
+        else
+        {
+            if (ilen >= src_len)
+                return UPX_E_INPUT_OVERRUN;
+            m_off = (m_off - 3) * 256 + src[ilen++];
+            if (m_off == 0xffffffffu)
+                break;
+            if (N != 'b')
+            {
+                m_len = (m_off ^ 0xffffffffu) & 1;
+                m_off >>= 1;
+            }
+            last_m_off = ++m_off;
+        }
+        if (N == 'b')
+            m_len = getbit();
+        if (N == 'e')
+        {
+            if (m_len)
+                m_len = 1 + getbit();
+            else if (getbit())
+                m_len = 3 + getbit();
+            else
+                m_len = 0;
+        }
+        else
+            m_len = m_len * 2 + getbit();
+        if (m_len == 0)
+        {
+            m_len++;
+            do {
+                m_len = m_len * 2 + getbit();
+                if (overrun || ilen >= src_len)
+                    return UPX_E_INPUT_OVERRUN;
+                if (m_len >= dst_len)
+                    return UPX_E_OUTPUT_OVERRUN;
+            } while (!getbit());
+            m_len += (N == 'e') ? 3 : 2;
+        }
+        m_len += (m_off > ((N == 'b') ? 0xd00u : 0x500u));
+        if (overrun)
+            return UPX_E_INPUT_OVERRUN;
+        if (olen + m_len > dst_len)
+            return UPX_E_OUTPUT_OVERRUN;
+        if (m_off > olen)
+            return UPX_E_LOOKBEHIND_OVERRUN;
+        olen += m_len + 1;
+        NOTE_NEED(olen);
+    }
+#undef NOTE_NEED
+
+    if (ilen != src_len)
+        return ilen < src_len ? UPX_E_INPUT_NOT_CONSUMED : UPX_E_INPUT_OVERRUN;
+    if (olen != dst_len)
+        return UPX_E_ERROR;
+    *src_off = need;
+    return UPX_E_OK;
+}
+
+int upx_ucl_find_overlap   ( const upx_bytep src, unsigned src_len,
+                                   unsigned  dst_len,
+                                   unsigned* src_off,
+                                   int method,
+                             const upx_compress_result_t *cresult )
+{
+    int r;
+
+    switch (method)
+    {
+    case M_NRV2B_8:
+        r = nrv_find_src_off<'b', 8>(src, src_len, dst_len, src_off);
+        break;
+    case M_NRV2B_LE16:
+        r = nrv_find_src_off<'b', 16>(src, src_len, dst_len, src_off);
+        break;
+    case M_NRV2B_LE32:
+        r = nrv_find_src_off<'b', 32>(src, src_len, dst_len, src_off);
+        break;
+    case M_NRV2D_8:
+        r = nrv_find_src_off<'d', 8>(src, src_len, dst_len, src_off);
+        break;
+    case M_NRV2D_LE16:
+        r = nrv_find_src_off<'d', 16>(src, src_len, dst_len, src_off);
+        break;
+    case M_NRV2D_LE32:
+        r = nrv_find_src_off<'d', 32>(src, src_len, dst_len, src_off);
+        break;
+    case M_NRV2E_8:
+        r = nrv_find_src_off<'e', 8>(src, src_len, dst_len, src_off);
+        break;
+    case M_NRV2E_LE16:
+        r = nrv_find_src_off<'e', 16>(src, src_len, dst_len, src_off);
+        break;
+    case M_NRV2E_LE32:
+        r = nrv_find_src_off<'e', 32>(src, src_len, dst_len, src_off);
+        break;
+    default:
+        throwInternalError("unknown decompression method");
+        return UPX_E_ERROR;
+    }
+
+    UNUSED(cresult);
+    return r;
+}
+
+
+/*************************************************************************
+// memory pool for UCL
+//
+// ucl_nrv2X_99_compress() allocates its dictionary and hash tables on
+// every call and expects them to be zeroed, which --brute does dozens
+// of times per file. So freed blocks go into a small per-thread pool and
+// get cleared again when reused: memset() on memory that is already
+// mapped is much cheaper than fresh pages. A block is reused for any
+// request that fits, so the pool grows to the largest size seen.
+**************************************************************************/
+
+namespace {
+
+struct UclPool
+{
+    enum { MAX_BLOCKS = 8, HEADER = 16 };  // the header keeps the capacity
+    upx_byte *blocks[MAX_BLOCKS];
+    unsigned n = 0;
+    ~UclPool() { while (n > 0) ::free(blocks[--n]); }
+
+    static ucl_uint capacity(const upx_byte *b) { return get_ne32(b); }
+    void *alloc(ucl_uint size);
+    void free(void *p);
+};
+
+static thread_local UclPool ucl_pool;
+static std::atomic<unsigned> ucl_pool_allocs(0);
+static std::atomic<unsigned> ucl_pool_reuses(0);
+
+void *UclPool::alloc(ucl_uint size)
+{
+    // the smallest block that fits
+    unsigned best = n;
+    for (unsigned i = 0; i < n; i++)
+        if (capacity(blocks[i]) >= size && (best == n || capacity(blocks[i]) < capacity(blocks[best])))
+            best = i;
+    upx_byte *b;
+    if (best < n)
+    {
+        b = blocks[best];
+        blocks[best] = blocks[--n];
+        memset(b + HEADER, 0, size);
+        ucl_pool_reuses++;
+    }
+    else
+    {
+        if (size > 0xffffffffu - HEADER)
+            return nullptr;
+        b = (upx_byte *) calloc(1, HEADER + size);
+        if (b == nullptr)
+            return nullptr;
+        set_ne32(b, size);
+        ucl_pool_allocs++;
+    }
+    return b + HEADER;
+}
+
+void UclPool::free(void *p)
+{
+    if (p == nullptr)
+        return;
+    upx_byte *b = (upx_byte *) p - HEADER;
+    if (n == MAX_BLOCKS)
+    {
+        // keep the larger one
+        unsigned smallest = 0;
+        for (unsigned i = 1; i < n; i++)
+            if (capacity(blocks[i]) < capacity(blocks[smallest]))
+                smallest = i;
+        if (capacity(blocks[smallest]) >= capacity(b))
+        {
+            ::free(b);
+            return;
+        }
+        ::free(blocks[smallest]);
+        blocks[smallest] = blocks[--n];
+    }
+    blocks[n++] = b;
+}
+
+} // namespace
+
+void upx_ucl_pool_stats(unsigned *allocs, unsigned *reuses)
+{
+    *allocs = ucl_pool_allocs;
+    *reuses = ucl_pool_reuses;
+}
+
+
 /*************************************************************************
 // misc
 **************************************************************************/
 
 extern "C" {
-static ucl_voidp __UCL_CDECL my_malloc(ucl_uint n) { return calloc(1, n); }
-static void __UCL_CDECL my_free(ucl_voidp p) { free(p); }
+static ucl_voidp __UCL_CDECL my_malloc(ucl_uint n) { return ucl_pool.alloc(n); }
+static void __UCL_CDECL my_free(ucl_voidp p) { ucl_pool.free(p); }
 }
 
 int upx_ucl_init(void)
@@ -278,12 +1013,10 @@ unsigned upx_ucl_adler32(const void *buf, unsigned len, unsigned adler)
     return ucl_adler32(adler, (const ucl_bytep) buf, len);
 }
 
-#if 0 /* UNUSED */
 unsigned upx_ucl_crc32(const void *buf, unsigned len, unsigned crc)
 {
     return ucl_crc32(crc, (const ucl_bytep) buf, len);
 }
-#endif
 
 /*************************************************************************
 // Debug checks
@@ -291,16 +1024,13 @@ unsigned upx_ucl_crc32(const void *buf, unsigned len, unsigned crc)
 
 #if DEBUG && 1
 
-#include "mem.h"
-
-static bool check_ucl(const int method, const unsigned expected_c_len) {
+static bool check_ucl(const int method, const int level, const unsigned expected_c_len) {
     const unsigned u_len = 16384;
     const unsigned c_extra = 4096;
     MemBuffer u_buf, c_buf, d_buf;
     unsigned c_len, d_len;
     upx_compress_result_t cresult;
     int r;
-    const int level = 3; // don't waste time
 
     u_buf.alloc(u_len);
     memset(u_buf, 0, u_len);
@@ -309,29 +1039,102 @@ static bool check_ucl(const int method, const unsigned expected_c_len) {
 
     c_len = c_buf.getSize() - c_extra;
     r = upx_ucl_compress(u_buf, u_len, c_buf + c_extra, &c_len, nullptr, method, level, NULL_cconf, &cresult);
-    if (r != 0 || c_len != expected_c_len) return false;
+    if (r != 0 || (expected_c_len != 0 && c_len != expected_c_len)) return false;
 
     d_len = d_buf.getSize();
     r = upx_ucl_decompress(c_buf + c_extra, c_len, d_buf, &d_len, method, nullptr);
     if (r != 0 || d_len != u_len) return false;
     if (memcmp(u_buf, d_buf, u_len) != 0) return false;
 
-    // TODO: rewrite Packer::findOverlapOverhead() so that we can test it here
-    //unsigned x_len = d_len;
-    //r = upx_ucl_test_overlap(c_buf, u_buf, c_extra, c_len, &x_len, method, nullptr);
+    // the overlap found in a single pass must be the smallest one
+    // that upx_ucl_test_overlap() accepts
+    unsigned src_off = 0;
+    r = upx_ucl_find_overlap(c_buf + c_extra, c_len, u_len, &src_off, method, nullptr);
+    if (r != 0) return false;
+    src_off = UPX_MAX(src_off, u_len - c_len + 1);
+    MemBuffer o_buf(src_off + c_len);
+    unsigned x_len = u_len;
+    memcpy(o_buf + src_off, c_buf + c_extra, c_len);
+    r = upx_ucl_test_overlap(o_buf, u_buf, src_off, c_len, &x_len, method, nullptr);
+    if (r != 0 || x_len != u_len) return false;
+    if (src_off > u_len - c_len + 1)
+    {
+        memcpy(o_buf + src_off - 1, c_buf + c_extra, c_len);
+        x_len = u_len;
+        r = upx_ucl_test_overlap(o_buf, u_buf, src_off - 1, c_len, &x_len, method, nullptr);
+        if (r == 0) return false;
+    }
     return true;
 }
 
 TEST_CASE("compress_ucl") {
-    CHECK(check_ucl(M_NRV2B_8, 34));
-    CHECK(check_ucl(M_NRV2B_LE16, 34));
-    CHECK(check_ucl(M_NRV2B_LE32, 34));
-    CHECK(check_ucl(M_NRV2D_8, 32));
-    CHECK(check_ucl(M_NRV2D_LE16, 32));
-    CHECK(check_ucl(M_NRV2D_LE32, 34));
-    CHECK(check_ucl(M_NRV2E_8, 32));
-    CHECK(check_ucl(M_NRV2E_LE16, 32));
-    CHECK(check_ucl(M_NRV2E_LE32, 34));
+    // levels 1-6 use the fast encoder
+    CHECK(check_ucl(M_NRV2B_8, 3, 13));
+    CHECK(check_ucl(M_NRV2B_LE16, 3, 14));
+    CHECK(check_ucl(M_NRV2B_LE32, 3, 14));
+    CHECK(check_ucl(M_NRV2D_8, 3, 11));
+    CHECK(check_ucl(M_NRV2D_LE16, 3, 12));
+    CHECK(check_ucl(M_NRV2D_LE32, 3, 14));
+    CHECK(check_ucl(M_NRV2E_8, 3, 11));
+    CHECK(check_ucl(M_NRV2E_LE16, 3, 12));
+    CHECK(check_ucl(M_NRV2E_LE32, 3, 14));
+    CHECK(check_ucl(M_NRV2B_LE32, 7, 0));
+    CHECK(check_ucl(M_NRV2D_LE32, 7, 0));
+    CHECK(check_ucl(M_NRV2E_LE32, 7, 0));
+}
+
+// the stubs rely on the max_offset/max_match limits and on the
+// results reported by the fast encoder
+static bool check_ucl_fast(const int method, const int level, const upx_bytep u_buf,
+                           unsigned u_len, unsigned max_offset, unsigned max_match) {
+    MemBuffer c_buf, d_buf;
+    unsigned c_len, d_len;
+    upx_compress_config_t cconf;
+    upx_compress_result_t cresult;
+    int r;
+
+    cconf.reset();
+    cconf.conf_ucl.max_offset = max_offset;
+    cconf.conf_ucl.max_match = max_match;
+    c_buf.allocForCompression(u_len);
+    d_buf.allocForUncompression(u_len);
+    c_len = c_buf.getSize();
+    r = upx_ucl_compress(u_buf, u_len, c_buf, &c_len, nullptr, method, level, &cconf, &cresult);
+    if (r != 0 || c_len >= u_len) return false;
+    const ucl_uint *res = cresult.result_ucl.result;
+    if (res[1] == 0 || res[1] > max_offset || res[3] == 0 || res[3] > max_match) return false;
+    if (res[5] == 0 || res[5] >= u_len || res[6] == 0) return false;
+
+    d_len = d_buf.getSize();
+    r = upx_ucl_decompress(c_buf, c_len, d_buf, &d_len, method, nullptr);
+    if (r != 0 || d_len != u_len) return false;
+    return memcmp(u_buf, d_buf, u_len) == 0;
+}
+
+TEST_CASE("compress_ucl fast") {
+    const unsigned u_len = 65536;
+    MemBuffer u_buf(u_len);
+    // literal runs followed by copies from all over the buffer
+    unsigned x = 1;
+    for (unsigned i = 0; i < u_len; ) {
+        x = x * 1103515245 + 12345;
+        const unsigned n = 1 + ((x >> 16) & 31);
+        const bool copy = i >= 256 && (x & 3) != 0;
+        const unsigned off = copy ? 1 + ((x >> 4) % UPX_MIN(i, 40000u)) : 0;
+        for (unsigned j = 0; j < n && i < u_len; j++, i++) {
+            x = x * 1103515245 + 12345;
+            u_buf[i] = copy ? u_buf[i - off] : (unsigned char) (x >> 23);
+        }
+    }
+    static const int methods[] = {M_NRV2B_8, M_NRV2B_LE16, M_NRV2B_LE32, M_NRV2D_8, M_NRV2D_LE16,
+                                  M_NRV2D_LE32, M_NRV2E_8, M_NRV2E_LE16, M_NRV2E_LE32};
+    for (int level = 1; level <= 6; level++) {
+        for (unsigned i = 0; i < TABLESIZE(methods); i++) {
+            CHECK(check_ucl_fast(methods[i], level, u_buf, u_len, UCL_UINT_MAX, UCL_UINT_MAX));
+            CHECK(check_ucl_fast(methods[i], level, u_buf, u_len, 0xd00, 0x8000));
+            CHECK(check_ucl_fast(methods[i], level, u_buf, u_len, 0x7fff, 5));
+        }
+    }
 }
 
 #endif // DEBUG
@@ -31,6 +31,9 @@
 #include "mem.h"
 #include <zlib.h>
 
+// the very same decoder as in the stubs
+#include "stub/src/c/deflate_d_c.c"
+
 
 void zlib_compress_config_t::reset()
 {
@@ -55,45 +58,30 @@ static int convert_errno_from_zlib(int zr)
 
 
 /*************************************************************************
-//
+// M_DEFLATE writes one raw Deflate stream, which the stubs decode with
+// the small canonical Huffman decoder in deflate_d_c.c: its code is
+// smaller than the LZMA decoder and it runs a lot faster, so this is
+// a good trade for files where LZMA gains only a few percent.
 **************************************************************************/
 
-int upx_zlib_compress      ( const upx_bytep src, unsigned  src_len,
-                                   upx_bytep dst, unsigned* dst_len,
-                                   upx_callback_p cb_parm,
-                                   int method, int level,
-                             const upx_compress_config_t *cconf_parm,
-                                   upx_compress_result_t *cresult )
+static int zlib_deflate(const upx_bytep src, unsigned src_len,
+                        upx_bytep dst, unsigned *dst_len,
+                        upx_callback_p cb, int level,
+                        unsigned mem_level, unsigned window_bits, unsigned strategy,
+                        const upx_compress_config_t *cconf)
 {
-    assert(method == M_DEFLATE);
-    assert(level > 0); assert(cresult != nullptr);
-    UNUSED(cb_parm);
+    // feed the input in chunks so that we can report the progress and
+    // give up as soon as the budget is exceeded
+    const unsigned CHUNK = 256 * 1024;
     int r = UPX_E_ERROR;
     int zr;
-    const zlib_compress_config_t *lcconf = cconf_parm ? &cconf_parm->conf_zlib : nullptr;
-    zlib_compress_result_t *res = &cresult->result_zlib;
-
-    if (level == 10)
-        level = 9;
-
-    zlib_compress_config_t::mem_level_t mem_level;
-    zlib_compress_config_t::window_bits_t window_bits;
-    zlib_compress_config_t::strategy_t strategy;
-    // cconf overrides
-    if (lcconf)
-    {
-        oassign(mem_level, lcconf->mem_level);
-        oassign(window_bits, lcconf->window_bits);
-        oassign(strategy, lcconf->strategy);
-    }
-
-    res->dummy = 0;
 
     z_stream s;
     s.zalloc = (alloc_func) nullptr;
     s.zfree = (free_func) nullptr;
+    s.opaque = nullptr;
     s.next_in = ACC_UNCONST_CAST(upx_bytep, src);
-    s.avail_in = src_len;
+    s.avail_in = 0;
     s.next_out = dst;
     s.avail_out = *dst_len;
     s.total_in = s.total_out = 0;
@@ -102,17 +90,41 @@ int upx_zlib_compress      ( const upx_bytep src, unsigned  src_len,
                       mem_level, strategy);
     if (zr != Z_OK)
         goto error;
-    zr = deflate(&s, Z_FINISH);
-    if (zr != Z_STREAM_END)
-        goto error;
+    for (;;)
+    {
+        const unsigned left = src_len - (unsigned) s.total_in;
+        s.avail_in = UPX_MIN(left, CHUNK);
+        const int flush = left <= CHUNK ? Z_FINISH : Z_NO_FLUSH;
+        zr = deflate(&s, flush);
+        if (zr == Z_STREAM_END)
+            break;
+        if ((zr != Z_OK && zr != Z_BUF_ERROR) || s.avail_out == 0)
+        {
+            // the output buffer is full
+            zr = Z_OK;
+            r = UPX_E_NOT_COMPRESSIBLE;
+            goto error;
+        }
+        if (cb && cb->nprogress)
+            cb->nprogress(cb, (unsigned) s.total_in, (unsigned) s.total_out);
+        if (upx_compress_over_budget(cconf, (unsigned) s.total_out))
+        {
+            zr = Z_OK;
+            r = UPX_E_BUDGET_EXCEEDED;
+            goto error;
+        }
+    }
     zr = deflateEnd(&s);
     if (zr != Z_OK)
         goto error;
     r = UPX_E_OK;
+    if (cb && cb->nprogress)
+        cb->nprogress(cb, src_len, (unsigned) s.total_out);
     goto done;
 error:
     (void) deflateEnd(&s);
-    r = convert_errno_from_zlib(zr);
+    if (r == UPX_E_ERROR)
+        r = convert_errno_from_zlib(zr);
     if (r == UPX_E_OK)
         r = UPX_E_ERROR;
 done:
@@ -123,7 +135,61 @@ done:
     }
     assert(s.total_in  <=  src_len);
     assert(s.total_out <= *dst_len);
-    *dst_len = s.total_out;
+    *dst_len = (unsigned) s.total_out;
+    return r;
+}
+
+int upx_zlib_compress      ( const upx_bytep src, unsigned  src_len,
+                                   upx_bytep dst, unsigned* dst_len,
+                                   upx_callback_p cb_parm,
+                                   int method, int level,
+                             const upx_compress_config_t *cconf_parm,
+                                   upx_compress_result_t *cresult )
+{
+    assert(method == M_DEFLATE);
+    assert(level > 0); assert(cresult != nullptr);
+    UNUSED(method);
+    int r;
+    const zlib_compress_config_t *lcconf = cconf_parm ? &cconf_parm->conf_zlib : nullptr;
+    zlib_compress_result_t *res = &cresult->result_zlib;
+
+    zlib_compress_config_t::mem_level_t mem_level;
+    zlib_compress_config_t::window_bits_t window_bits;
+    zlib_compress_config_t::strategy_t strategy;
+    // more hash memory helps the higher levels
+    if (level >= 7)
+        mem_level = 9;
+    // cconf overrides
+    if (lcconf)
+    {
+        oassign(mem_level, lcconf->mem_level);
+        oassign(window_bits, lcconf->window_bits);
+        oassign(strategy, lcconf->strategy);
+    }
+
+    res->dummy = 0;
+
+    // level 10 is --best: try Z_FILTERED as well and keep the smaller
+    // stream, unless a strategy has been given
+    const bool try_filtered = level == 10 && !strategy.is_set;
+    if (level == 10)
+        level = 9;
+
+    const unsigned dst_cap = *dst_len;
+    r = zlib_deflate(src, src_len, dst, dst_len, cb_parm, level,
+                     mem_level, window_bits, strategy, cconf_parm);
+    if (try_filtered && r == UPX_E_OK)
+    {
+        MemBuffer tmp(dst_cap);
+        unsigned tmp_len = dst_cap;
+        if (zlib_deflate(src, src_len, tmp, &tmp_len, cb_parm, level,
+                         mem_level, window_bits, Z_FILTERED, cconf_parm) == UPX_E_OK
+            && tmp_len < *dst_len)
+        {
+            memcpy(dst, tmp, tmp_len);
+            *dst_len = tmp_len;
+        }
+    }
     return r;
 }
 
@@ -185,6 +251,25 @@ done:
 // test_overlap - see <ucl/ucl.h> for semantics
 **************************************************************************/
 
+// Decode with the stub decoder; src and dst may overlap like in
+// upx_zlib_test_overlap(). If "need" is given, it returns the
+// smallest offset of src in dst that allows in-place decompression.
+static int deflate_decode_stub(const upx_byte *src, unsigned src_len,
+                               upx_byte *dst, unsigned *dst_len, unsigned *need)
+{
+    ACC_COMPILE_TIME_ASSERT(sizeof(DeflateWork) <= DEFLATE_WORK_SIZE)
+    MemBuffer wb(sizeof(DeflateWork));
+    DeflateWork *w = (DeflateWork *) (upx_bytep) wb;
+    int r = DeflateDecode(src, src_len, dst, dst_len, w);
+    if (r <= 0)
+        return UPX_E_ERROR;
+    if ((unsigned) r != src_len)
+        return UPX_E_INPUT_NOT_CONSUMED;
+    if (need)
+        *need = UPX_MAX(0, w->need);
+    return UPX_E_OK;
+}
+
 int upx_zlib_test_overlap  ( const upx_bytep buf,
                              const upx_bytep tbuf,
                                    unsigned  src_off, unsigned src_len,
@@ -193,23 +278,41 @@ int upx_zlib_test_overlap  ( const upx_bytep buf,
                              const upx_compress_result_t *cresult )
 {
     assert(method == M_DEFLATE);
+    UNUSED(method);
+    UNUSED(cresult);
 
     MemBuffer b(src_off + src_len);
     memcpy(b + src_off, buf + src_off, src_len);
     unsigned saved_dst_len = *dst_len;
-    int r = upx_zlib_decompress(b + src_off, src_len, b, dst_len, method, cresult);
+    unsigned need = 0;
+    int r = deflate_decode_stub(b + src_off, src_len, b, dst_len, &need);
     if (r != UPX_E_OK)
         return r;
-    if (*dst_len != saved_dst_len)
+    if (*dst_len != saved_dst_len || need > src_off)
         return UPX_E_ERROR;
-    // NOTE: there is a very tiny possibility that decompression has
-    //   succeeded but the data is not restored correctly because of
-    //   in-place buffer overlapping, so we use an extra memcmp().
     if (tbuf != nullptr && memcmp(tbuf, b, *dst_len) != 0)
         return UPX_E_ERROR;
     return UPX_E_OK;
 }
 
+int upx_zlib_find_overlap  ( const upx_bytep src, unsigned src_len,
+                                   unsigned  dst_len,
+                                   unsigned* src_off,
+                                   int method,
+                             const upx_compress_result_t *cresult )
+{
+    assert(method == M_DEFLATE);
+    UNUSED(method);
+    UNUSED(cresult);
+
+    MemBuffer b(dst_len);
+    unsigned d_len = dst_len;
+    int r = deflate_decode_stub(src, src_len, b, &d_len, src_off);
+    if (r != UPX_E_OK)
+        return r;
+    return d_len == dst_len ? UPX_E_OK : UPX_E_ERROR;
+}
+
 
 /*************************************************************************
 // misc
@@ -242,4 +345,73 @@ unsigned upx_zlib_crc32(const void *buf, unsigned len, unsigned crc)
 #endif
 
 
+/*************************************************************************
+// Debug checks
+**************************************************************************/
+
+#if DEBUG && 1
+
+static bool check_deflate(const upx_bytep u_buf, unsigned u_len, int level)
+{
+    MemBuffer c_buf, d_buf;
+    upx_compress_result_t cresult;
+    unsigned c_len, d_len;
+    int r;
+
+    c_buf.allocForCompression(u_len);
+    d_buf.allocForUncompression(u_len);
+    c_len = c_buf.getSize();
+    r = upx_zlib_compress(u_buf, u_len, c_buf, &c_len, nullptr, M_DEFLATE, level, NULL_cconf, &cresult);
+    if (r != 0) return false;
+    // zlib and the stub decoder must agree
+    d_len = d_buf.getSize();
+    r = upx_zlib_decompress(c_buf, c_len, d_buf, &d_len, M_DEFLATE, nullptr);
+    if (r != 0 || d_len != u_len || memcmp(u_buf, d_buf, u_len) != 0) return false;
+    d_len = d_buf.getSize();
+    r = deflate_decode_stub(c_buf, c_len, d_buf, &d_len, nullptr);
+    if (r != 0 || d_len != u_len || memcmp(u_buf, d_buf, u_len) != 0) return false;
+    if (c_len >= u_len)
+        return true;
+
+    // in-place decompression must work with the overlap found
+    unsigned src_off = 0;
+    r = upx_zlib_find_overlap(c_buf, c_len, u_len, &src_off, M_DEFLATE, nullptr);
+    if (r != 0) return false;
+    src_off = UPX_MAX(src_off, u_len - c_len + 1);
+    MemBuffer o_buf(src_off + c_len);
+    memcpy(o_buf + src_off, c_buf, c_len);
+    unsigned x_len = u_len;
+    r = upx_zlib_test_overlap(o_buf, u_buf, src_off, c_len, &x_len, M_DEFLATE, nullptr);
+    return r == 0 && x_len == u_len;
+}
+
+TEST_CASE("compress_zlib") {
+    const unsigned u_len = 300000;
+    MemBuffer u_buf(u_len);
+    // skewed literals followed by copies
+    unsigned x = 1;
+    for (unsigned i = 0; i < u_len; ) {
+        x = x * 1103515245 + 12345;
+        const unsigned n = 1 + ((x >> 16) & 63);
+        const bool copy = i >= 16 && (x & 3) != 0;
+        const unsigned off = copy ? 1 + ((x >> 4) % UPX_MIN(i, 32768u)) : 0;
+        for (unsigned j = 0; j < n && i < u_len; j++, i++) {
+            x = x * 1103515245 + 12345;
+            u_buf[i] = copy ? u_buf[i - off] : (upx_byte) ((x >> 23) & (x >> 27));
+        }
+    }
+    for (int level = 1; level <= 10; level++)
+        CHECK(check_deflate(u_buf, u_len, level));
+    // fixed codes and stored blocks
+    CHECK(check_deflate(u_buf, 13, 9));
+    for (unsigned i = 0; i < 4096; i++)
+        u_buf[i] = (upx_byte) ((i * 0x9e3779b1u) >> 24);
+    CHECK(check_deflate(u_buf, 4096, 1));
+    // a single long run
+    memset(u_buf, 'x', u_len);
+    CHECK(check_deflate(u_buf, u_len, 10));
+}
+
+#endif // DEBUG
+
 /* vim:set ts=4 sw=4 et: */
@@ -0,0 +1,1189 @@
+/* compress_zstd.cpp --
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2022 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2022 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+
+#include "conf.h"
+#include "compress.h"
+#include "mem.h"
+
+// the very same decoder as in the stubs
+#include "stub/src/c/zstd_d_c.c"
+
+
+/*************************************************************************
+// M_ZSTD writes one Zstandard frame (RFC 8878) that any zstd can
+// decompress: a single-segment frame header with the content size,
+// then blocks of at most 128 KiB. A compressed block has Huffman-coded
+// or raw literals and FSE-coded sequences (literal length, offset,
+// match length) which use the predefined or an explicit table.
+// Treeless literals and repeated tables are not written, and the
+// frame has no checksum: the packers already store an adler32.
+//
+// Matches come from hash chains as in compress_lz4.cpp, but with a
+// much larger window and with zstd's repeat offsets. In-place
+// decompression needs the input of a compressed block from its
+// sequences section on, see 'need' in zstd_d_c.c.
+**************************************************************************/
+
+namespace {
+
+enum {
+    ZSTD_MIN_MATCH = 4,             // of the encoder; zstd allows 3
+    ZSTD_LL_MAX = 35,
+    ZSTD_ML_MAX = 52,
+    ZSTD_OF_MAX = 31,
+    ZSTD_LL_LOG = 9,
+    ZSTD_ML_LOG = 9,
+    ZSTD_OF_LOG = 8,
+    ZSTD_HUF_LOG = 11
+};
+
+unsigned zstd_bsr(unsigned x) { return zstd_highbit(x); }
+
+// forward bit stream, least significant bit first
+class ZstdBitWriter
+{
+public:
+    ZstdBitWriter(upx_byte *p_, unsigned cap_) : p(p_), cap(cap_) {}
+    void put(unsigned v, unsigned n)
+    {
+        acc |= (upx_uint64_t) (v & ((1ull << n) - 1)) << nacc;
+        nacc += n;
+        if (nacc >= 32)
+        {
+            if (len + 4 > cap)
+                overflow = true;
+            else
+                set_le32(p + len, (unsigned) acc);
+            len += 4;
+            acc >>= 32;
+            nacc -= 32;
+        }
+    }
+    // append the end mark of a backward stream; return the size or 0
+    unsigned close()
+    {
+        put(1, 1);
+        return finish();
+    }
+    // pad to a full byte; return the size or 0
+    unsigned finish()
+    {
+        for ( ; nacc > 0; nacc = nacc > 8 ? nacc - 8 : 0, acc >>= 8)
+        {
+            if (len >= cap)
+                overflow = true;
+            else
+                p[len] = (upx_byte) acc;
+            len += 1;
+        }
+        return overflow ? 0 : len;
+    }
+
+private:
+    upx_byte *const p;
+    const unsigned cap;
+    unsigned len = 0;
+    upx_uint64_t acc = 0;
+    unsigned nacc = 0;
+    bool overflow = false;
+};
+
+// FSE encoding table, see FSE_buildCTable() of zstd
+struct ZstdFseCTable
+{
+    unsigned log;
+    bool rle;
+    unsigned short next_state[1 << ZSTD_LL_LOG];
+    struct { int find; unsigned delta_nb; } tt[64];
+
+    void build(const short *norm, unsigned max_sym, unsigned log_);
+};
+
+void ZstdFseCTable::build(const short *norm, unsigned max_sym, unsigned log_)
+{
+    const unsigned size = 1u << log_;
+    const unsigned step = (size >> 1) + (size >> 3) + 3;
+    unsigned high = size - 1;
+    unsigned char symbol[1 << ZSTD_LL_LOG];
+    unsigned cumul[64 + 1];
+    unsigned s, i, pos = 0;
+
+    log = log_;
+    rle = false;
+    cumul[0] = 0;
+    for (s = 0; s <= max_sym; s++)
+    {
+        if (norm[s] == -1)
+        {
+            cumul[s + 1] = cumul[s] + 1;
+            symbol[high--] = (unsigned char) s;
+        }
+        else
+            cumul[s + 1] = cumul[s] + norm[s];
+    }
+    for (s = 0; s <= max_sym; s++)
+        for (int n = 0; n < norm[s]; n++)
+        {
+            symbol[pos] = (unsigned char) s;
+            do
+                pos = (pos + step) & (size - 1);
+            while (pos > high);
+        }
+    for (i = 0; i < size; i++)
+        next_state[cumul[symbol[i]]++] = (unsigned short) (size + i);
+
+    int total = 0;
+    for (s = 0; s <= max_sym; s++)
+    {
+        if (norm[s] == 0)
+            tt[s].delta_nb = ((log + 1) << 16) - size;
+        else if (norm[s] == -1 || norm[s] == 1)
+        {
+            tt[s].delta_nb = (log << 16) - size;
+            tt[s].find = total - 1;
+            total += 1;
+        }
+        else
+        {
+            const unsigned max_out = log - zstd_bsr(norm[s] - 1);
+            tt[s].delta_nb = (max_out << 16) - (norm[s] << max_out);
+            tt[s].find = total - norm[s];
+            total += norm[s];
+        }
+    }
+}
+
+struct ZstdFseState
+{
+    const ZstdFseCTable *ct;
+    unsigned value = 0;
+
+    void init(const ZstdFseCTable *ct_, unsigned s)
+    {
+        ct = ct_;
+        if (ct->rle)
+            return;
+        const unsigned nb = (ct->tt[s].delta_nb + (1 << 15)) >> 16;
+        const unsigned v = (nb << 16) - ct->tt[s].delta_nb;
+        value = ct->next_state[(v >> nb) + ct->tt[s].find];
+    }
+    void encode(ZstdBitWriter *bw, unsigned s)
+    {
+        if (ct->rle)
+            return;
+        const unsigned nb = (value + ct->tt[s].delta_nb) >> 16;
+        bw->put(value, nb);
+        value = ct->next_state[(value >> nb) + ct->tt[s].find];
+    }
+    void flush(ZstdBitWriter *bw)
+    {
+        if (!ct->rle)
+            bw->put(value, ct->log);
+    }
+};
+
+struct ZstdSeq
+{
+    unsigned lit;   // Literals_Length
+    unsigned len;   // Match_Length
+    unsigned off;   // Offset_Value, including the repeat codes
+};
+
+class ZstdEncoder
+{
+public:
+    ZstdEncoder(const upx_bytep src_, unsigned src_len_, upx_bytep dst_, unsigned dst_len_,
+                int level);
+    int compress(unsigned *dst_len, upx_callback_p cb, const upx_compress_config_t *cconf);
+
+private:
+    enum { HBITS = 17, BLOCK_SIZE = ZSTD_BLOCK_MAX };
+    static const unsigned NIL = 0xffffffffu;
+
+    const upx_byte *const src;
+    const unsigned src_len;
+    upx_byte *const dst;
+    const unsigned dst_len;
+    unsigned olen = 0;
+    unsigned wmask;     // window size - 1
+    unsigned depth;
+    unsigned nice;      // stop searching at this length
+    bool lazy;
+    bool skip;          // speed up incompressible stretches
+    unsigned ins = 0;   // next position to insert
+    unsigned rep[3];
+    MemBuffer head_buf, prev_buf, seq_buf, lit_buf, blk_buf, work_buf;
+    unsigned *head;
+    unsigned *prev;
+    ZstdSeq *seqs;
+    unsigned nseqs = 0;
+    upx_byte *lits;
+    unsigned nlits = 0;
+    unsigned char ll_code[64], ml_code[128];
+    ZstdFseCTable ll_ct, ml_ct, of_ct;
+
+    static unsigned hash(const upx_byte *p)
+    {
+        return (get_le32(p) * 0x9e3779b1u) >> (32 - HBITS);
+    }
+    void insertUpTo(unsigned pos, unsigned end);
+    unsigned find(unsigned pos, unsigned end, unsigned *off);
+    unsigned matchLen(unsigned pos, unsigned end, unsigned off) const;
+    void addSequence(unsigned anchor, unsigned pos, unsigned off, unsigned len);
+    void parseBlock(unsigned bstart, unsigned bend);
+    unsigned llCode(unsigned ll) const
+    {
+        return ll < 64 ? ll_code[ll] : zstd_bsr(ll) + 19;
+    }
+    unsigned mlCode(unsigned ml) const
+    {
+        return ml - 3 < 128 ? ml_code[ml - 3] : zstd_bsr(ml - 3) + 36;
+    }
+    unsigned putLiterals(upx_byte *p, unsigned cap);
+    unsigned putHuffman(upx_byte *p, unsigned cap);
+    unsigned putSequences(upx_byte *p, unsigned cap);
+    bool putBlock(unsigned bstart, unsigned bend, bool last);
+};
+
+ZstdEncoder::ZstdEncoder(const upx_bytep src_, unsigned src_len_, upx_bytep dst_,
+                         unsigned dst_len_, int level) :
+    src(src_), src_len(src_len_), dst(dst_), dst_len(dst_len_)
+{
+    static const unsigned short depths[11] = { 0, 2, 4, 8, 12, 16, 32, 64, 128, 256, 1024 };
+    static const unsigned char wlogs[11] = { 0, 18, 19, 20, 20, 21, 21, 22, 22, 23, 23 };
+    level = UPX_MAX(1, UPX_MIN(level, 10));
+    depth = depths[level];
+    nice = level >= 9 ? 256 : 16 * level;
+    lazy = level >= 3;
+    skip = level <= 2;
+    unsigned wlog = wlogs[level];
+    while (wlog > 10 && (1u << (wlog - 1)) >= src_len)
+        wlog--;
+    wmask = (1u << wlog) - 1;
+    rep[0] = 1; rep[1] = 4; rep[2] = 8;
+
+    head_buf.alloc(sizeof(*head) << HBITS);
+    head_buf.fill(0, head_buf.getSize(), 0xff);
+    prev_buf.alloc(sizeof(*prev) << wlog);
+    seq_buf.alloc(sizeof(*seqs) * (BLOCK_SIZE / ZSTD_MIN_MATCH + 1));
+    lit_buf.alloc(BLOCK_SIZE);
+    blk_buf.alloc(BLOCK_SIZE);
+    work_buf.alloc(sizeof(ZstdWork));
+    head = (unsigned *) (upx_bytep) head_buf;
+    prev = (unsigned *) (upx_bytep) prev_buf;
+    seqs = (ZstdSeq *) (upx_bytep) seq_buf;
+    lits = lit_buf;
+
+    unsigned bits;
+    for (unsigned c = 0, v = 0; v < 64; v++)
+    {
+        while (c < ZSTD_LL_MAX && zstd_ll_base(c + 1, &bits) <= v)
+            c++;
+        ll_code[v] = (unsigned char) c;
+    }
+    for (unsigned c = 0, v = 0; v < 128; v++)
+    {
+        while (c < ZSTD_ML_MAX && zstd_ml_base(c + 1, &bits) <= v + 3)
+            c++;
+        ml_code[v] = (unsigned char) c;
+    }
+}
+
+// the chains store absolute positions; a chain ends outside the window
+void ZstdEncoder::insertUpTo(unsigned pos, unsigned end)
+{
+    const unsigned last = UPX_MIN(pos, end - ZSTD_MIN_MATCH + 1);
+    for ( ; ins < last; ins++)
+    {
+        const unsigned h = hash(src + ins);
+        prev[ins & wmask] = head[h];
+        head[h] = ins;
+    }
+}
+
+unsigned ZstdEncoder::matchLen(unsigned pos, unsigned end, unsigned off) const
+{
+    const upx_byte *const cur = src + pos;
+    const upx_byte *const ref = cur - off;
+    const unsigned max_len = end - pos;
+    unsigned len = 0;
+    while (len + 4 <= max_len && get_ne32(ref + len) == get_ne32(cur + len))
+        len += 4;
+    while (len < max_len && ref[len] == cur[len])
+        len++;
+    return len;
+}
+
+unsigned ZstdEncoder::find(unsigned pos, unsigned end, unsigned *off)
+{
+    insertUpTo(pos, end);
+    const upx_byte *const cur = src + pos;
+    const unsigned max_len = end - pos;
+    unsigned best = ZSTD_MIN_MATCH - 1;
+    unsigned rep_len = 0;
+
+    // the most recent offset is the cheapest one, so a match must be
+    // longer by at least 2 to beat it
+    if (rep[0] <= pos && get_ne32(cur - rep[0]) == get_ne32(cur))
+    {
+        rep_len = matchLen(pos, end, rep[0]);
+        *off = rep[0];
+        if (rep_len >= nice)
+            return rep_len;
+        best = rep_len + 1;
+    }
+
+    unsigned c = head[hash(cur)];
+    for (unsigned i = depth; i > 0 && c < pos && pos - c <= wmask; i--)
+    {
+        if (best < max_len && src[c + best] == cur[best] && get_ne32(src + c) == get_ne32(cur))
+        {
+            const unsigned len = matchLen(pos, end, pos - c);
+            if (len > best)
+            {
+                best = len;
+                *off = pos - c;
+                if (len >= nice || len >= max_len)
+                    break;
+            }
+        }
+        const unsigned p = prev[c & wmask];
+        if (p >= c)
+            break;
+        c = p;
+    }
+    if (rep_len != 0 && best == rep_len + 1)
+        return rep_len;
+    return best >= ZSTD_MIN_MATCH ? best : 0;
+}
+
+// map the offset to an Offset_Value and update the repeat offsets
+// exactly like the decoder does
+void ZstdEncoder::addSequence(unsigned anchor, unsigned pos, unsigned off, unsigned len)
+{
+    const unsigned lit = pos - anchor;
+    unsigned v;
+    if (lit != 0)
+        v = off == rep[0] ? 1 : off == rep[1] ? 2 : off == rep[2] ? 3 : off + 3;
+    else
+        v = off == rep[1] ? 1 : off == rep[2] ? 2 : off == rep[0] - 1 ? 3 : off + 3;
+    if (v > 3)
+    {
+        rep[2] = rep[1];
+        rep[1] = rep[0];
+        rep[0] = off;
+    }
+    else
+    {
+        const unsigned n = v - 1 + (lit == 0);
+        if (n != 0)
+        {
+            if (n != 1)
+                rep[2] = rep[1];
+            rep[1] = rep[0];
+            rep[0] = off;
+        }
+    }
+    memcpy(lits + nlits, src + anchor, lit);
+    nlits += lit;
+    ZstdSeq *s = &seqs[nseqs++];
+    s->lit = lit;
+    s->len = len;
+    s->off = v;
+}
+
+void ZstdEncoder::parseBlock(unsigned bstart, unsigned bend)
+{
+    unsigned pos = bstart, anchor = bstart;
+    unsigned misses = 0;
+
+    nseqs = 0;
+    nlits = 0;
+    while (bend - pos >= ZSTD_MIN_MATCH)
+    {
+        unsigned off = 0;
+        unsigned len = find(pos, bend, &off);
+        if (len == 0)
+        {
+            pos += skip ? 1 + (misses++ >> 6) : 1;
+            continue;
+        }
+        while (lazy && len < nice && bend - (pos + 1) >= ZSTD_MIN_MATCH)
+        {
+            unsigned off2 = 0;
+            const unsigned len2 = find(pos + 1, bend, &off2);
+            if (len2 <= len)
+                break;
+            pos++;
+            len = len2;
+            off = off2;
+        }
+        addSequence(anchor, pos, off, len);
+        pos += len;
+        anchor = pos;
+        misses = 0;
+    }
+    insertUpTo(bend, src_len);
+    memcpy(lits + nlits, src + anchor, bend - anchor);
+    nlits += bend - anchor;
+}
+
+
+/*************************************************************************
+// entropy coding helpers
+**************************************************************************/
+
+// log2(x) in 1/256 bits, linear between powers of two
+unsigned zstd_log2_256(unsigned x)
+{
+    const unsigned h = zstd_bsr(x);
+    return (h << 8) + (h >= 8 ? (x >> (h - 8)) - 256 : (x << (8 - h)) - 256);
+}
+
+// cost in 1/256 bits of coding 'count' with the table 'norm'
+unsigned zstd_fse_cost(const unsigned *count, const short *norm, unsigned max_sym,
+                       unsigned log)
+{
+    unsigned cost = 0;
+    for (unsigned s = 0; s <= max_sym; s++)
+        if (count[s])
+        {
+            const unsigned n = norm[s] == -1 ? 1 : norm[s];
+            if (n == 0)
+                return 0xffffffffu;
+            cost += count[s] * ((log << 8) - zstd_log2_256(n));
+        }
+    return cost;
+}
+
+unsigned zstd_fse_log(unsigned total, unsigned max_sym, unsigned max_log)
+{
+    unsigned log = zstd_bsr(total) >= 7 ? zstd_bsr(total) - 2 : 5;
+    log = UPX_MAX(log, zstd_bsr(max_sym) + 2);
+    return UPX_MAX(5u, UPX_MIN(log, max_log));
+}
+
+// scale the counts to a sum of 1 << log, keeping every used symbol
+void zstd_fse_normalize(short *norm, const unsigned *count, unsigned max_sym,
+                        unsigned total, unsigned log)
+{
+    const unsigned size = 1u << log;
+    unsigned sum = 0, largest = 0;
+    for (unsigned s = 0; s <= max_sym; s++)
+    {
+        unsigned n = 0;
+        if (count[s])
+            n = UPX_MAX(1u, (unsigned) (((upx_uint64_t) count[s] * size + total / 2) / total));
+        norm[s] = (short) n;
+        sum += n;
+        if (n > (unsigned) norm[largest])
+            largest = s;
+    }
+    if (sum < size)
+        norm[largest] = (short) (norm[largest] + (size - sum));
+    while (sum > size)
+    {
+        // take from the symbols that lose the least
+        for (unsigned s = 0; s <= max_sym && sum > size; s++)
+            if (norm[s] > 1 && (norm[s] >= norm[largest] / 2 || norm[s] > 8))
+            {
+                norm[s] -= 1;
+                sum -= 1;
+            }
+    }
+}
+
+// write an FSE_Table_Description; return its size or 0
+unsigned zstd_fse_write_ncount(upx_byte *p, unsigned cap, const short *norm,
+                               unsigned max_sym, unsigned log)
+{
+    ZstdBitWriter bw(p, cap);
+    int remaining = (1 << log) + 1;
+    int threshold = 1 << log;
+    unsigned nb = log + 1;
+    unsigned s = 0;
+    bool prev0 = false;
+
+    bw.put(log - 5, 4);
+    while (s <= max_sym && remaining > 1)
+    {
+        if (prev0)
+        {
+            unsigned start = s;
+            while (norm[s] == 0)
+                s++;
+            for ( ; s >= start + 24; start += 24)
+                bw.put(0xffff, 16);
+            for ( ; s >= start + 3; start += 3)
+                bw.put(3, 2);
+            bw.put(s - start, 2);
+        }
+        int count = norm[s++];
+        const int max = 2 * threshold - 1 - remaining;
+        remaining -= count < 0 ? -count : count;
+        count += 1;
+        if (count >= threshold)
+            count += max;
+        bw.put(count, count < max ? nb - 1 : nb);
+        prev0 = count == 1;
+        while (remaining < threshold)
+        {
+            nb -= 1;
+            threshold >>= 1;
+        }
+    }
+    return bw.finish();
+}
+
+// Huffman code lengths limited to 'limit' bits; return the longest,
+// or 0 if fewer than two symbols are used
+unsigned zstd_huf_lengths(unsigned char *len, const unsigned *count, unsigned n,
+                          unsigned limit)
+{
+    unsigned freq[256], node_freq[512];
+    unsigned short order[256], parent[512];
+    unsigned char depth[512];
+    for (unsigned s = 0; s < n; s++)
+        freq[s] = count[s];
+    for (;;)
+    {
+        unsigned nleaves = 0;
+        for (unsigned s = 0; s < n; s++)
+            if (freq[s])
+                order[nleaves++] = (unsigned short) s;
+        for (unsigned i = 1; i < nleaves; i++)  // stable insertion sort by frequency
+        {
+            const unsigned short t = order[i];
+            unsigned j = i;
+            for ( ; j > 0 && freq[order[j - 1]] > freq[t]; j--)
+                order[j] = order[j - 1];
+            order[j] = t;
+        }
+        if (nleaves < 2)  // no code for a single symbol
+            return 0;
+        // two queues: the sorted leaves and the internal nodes in creation order
+        for (unsigned i = 0; i < nleaves; i++)
+            node_freq[i] = freq[order[i]];
+        unsigned leaf = 0, inner = nleaves, nnodes = nleaves;
+        for (unsigned k = 1; k < nleaves; k++)
+        {
+            unsigned pick[2];
+            for (unsigned j = 0; j < 2; j++)
+            {
+                if (leaf < nleaves && (inner >= nnodes || node_freq[leaf] <= node_freq[inner]))
+                    pick[j] = leaf++;
+                else
+                    pick[j] = inner++;
+            }
+            node_freq[nnodes] = node_freq[pick[0]] + node_freq[pick[1]];
+            parent[pick[0]] = parent[pick[1]] = (unsigned short) nnodes;
+            nnodes++;
+        }
+        unsigned max_len = 0;
+        depth[nnodes - 1] = 0;
+        for (unsigned i = nnodes - 1; i-- > 0; )
+        {
+            depth[i] = (unsigned char) (depth[parent[i]] + 1);
+            if (i < nleaves)
+                max_len = UPX_MAX(max_len, (unsigned) depth[i]);
+        }
+        if (max_len <= limit)
+        {
+            memset(len, 0, n);
+            for (unsigned i = 0; i < nleaves; i++)
+                len[order[i]] = depth[i];
+            return max_len;
+        }
+        for (unsigned s = 0; s < n; s++)
+            if (freq[s])
+                freq[s] = (freq[s] + 1) >> 1;
+    }
+}
+
+
+/*************************************************************************
+// block
+**************************************************************************/
+
+// Compressed_Literals_Block; return its size or 0 if not worth it
+unsigned ZstdEncoder::putHuffman(upx_byte *p, unsigned cap)
+{
+    unsigned count[256];
+    memset(count, 0, sizeof(count));
+    for (unsigned i = 0; i < nlits; i++)
+        count[lits[i]]++;
+    unsigned max_sym = 255;
+    while (count[max_sym] == 0)
+        max_sym--;
+
+    unsigned char len[256];
+    const unsigned bits = zstd_huf_lengths(len, count, max_sym + 1, ZSTD_HUF_LOG);
+    if (bits == 0)
+        return 0;
+    upx_uint64_t total_bits = 0;
+    for (unsigned s = 0; s <= max_sym; s++)
+        total_bits += (upx_uint64_t) count[s] * len[s];
+    if (total_bits / 8 + 64 >= nlits)
+        return 0;
+
+    // weights, and the codes assigned like the decoder's table
+    unsigned char wt[256];
+    unsigned start[16], code[256];
+    memset(start, 0, sizeof(start));
+    for (unsigned s = 0; s <= max_sym; s++)
+    {
+        wt[s] = (unsigned char) (len[s] ? bits + 1 - len[s] : 0);
+        start[wt[s]]++;
+    }
+    for (unsigned w = 1, u = 0; w <= bits; w++)
+    {
+        const unsigned n = start[w] << (w - 1);
+        start[w] = u;
+        u += n;
+    }
+    for (unsigned s = 0; s <= max_sym; s++)
+        if (wt[s])
+        {
+            code[s] = start[wt[s]] >> (wt[s] - 1);
+            start[wt[s]] += 1u << (wt[s] - 1);
+        }
+
+    // Huffman_Tree_Description: the weights except the last one
+    upx_byte desc[1 + 128];
+    unsigned dlen = 0;
+    const unsigned nw = max_sym;
+    if (nw > 2)
+    {
+        unsigned wcount[16];
+        short norm[16];
+        memset(wcount, 0, sizeof(wcount));
+        for (unsigned s = 0; s < nw; s++)
+            wcount[wt[s]]++;
+        unsigned wmax = bits;
+        while (wcount[wmax] == 0)
+            wmax--;
+        const unsigned log = UPX_MIN(6u, zstd_fse_log(nw, wmax, 6));
+        zstd_fse_normalize(norm, wcount, wmax, nw, log);
+        unsigned n = zstd_fse_write_ncount(desc + 1, 127, norm, wmax, log);
+        if (n != 0)
+        {
+            ZstdFseCTable ct;
+            ct.build(norm, wmax, log);
+            ZstdBitWriter bw(desc + 1 + n, 127 - n);
+            ZstdFseState s1, s2;
+            int i = (int) nw;
+            if (nw & 1)
+            {
+                s1.init(&ct, wt[--i]);
+                s2.init(&ct, wt[--i]);
+                s1.encode(&bw, wt[--i]);
+            }
+            else
+            {
+                s2.init(&ct, wt[--i]);
+                s1.init(&ct, wt[--i]);
+            }
+            while (i > 0)
+            {
+                s2.encode(&bw, wt[--i]);
+                s1.encode(&bw, wt[--i]);
+            }
+            s2.flush(&bw);
+            s1.flush(&bw);
+            const unsigned m = bw.close();
+            if (m != 0 && n + m < 128)
+            {
+                desc[0] = (upx_byte) (n + m);
+                dlen = 1 + n + m;
+            }
+        }
+    }
+    if (dlen != 0)
+    {
+        // the end of a weights stream is subtle, so double-check it
+        ZstdWork *w = (ZstdWork *) (upx_bytep) work_buf;
+        if (zstd_huf_table(desc, dlen, w) != (int) dlen || w->huf_bits != bits)
+            dlen = 0;
+        for (unsigned s = 0; dlen != 0 && s <= max_sym; s++)
+            if (w->weights[s] != wt[s])
+                dlen = 0;
+    }
+    if (dlen == 0)
+    {
+        if (nw > 128)
+            return 0;
+        desc[0] = (upx_byte) (127 + nw);
+        for (unsigned s = 0; s < nw; s += 2)
+            desc[1 + s / 2] = (upx_byte) ((wt[s] << 4) | (s + 1 < nw ? wt[s + 1] : 0));
+        dlen = 1 + (nw + 1) / 2;
+    }
+
+    // 1 stream for short literals, else 4 streams with a jump table;
+    // written after the longest header, then moved down
+    const bool single = nlits < 1024;
+    const unsigned nstreams = single ? 1 : 4;
+    const unsigned seg = single ? nlits : (nlits + 3) / 4;
+    upx_byte *const q = p + 5;
+    unsigned clen = dlen + (single ? 0 : 6);
+    if (cap < 5 + clen)
+        return 0;
+    memcpy(q, desc, dlen);
+    for (unsigned k = 0; k < nstreams; k++)
+    {
+        const unsigned lo = k * seg;
+        const unsigned hi = k == nstreams - 1 ? nlits : lo + seg;
+        ZstdBitWriter bw(q + clen, cap - 5 - clen);
+        for (unsigned i = hi; i-- > lo; )
+            bw.put(code[lits[i]], len[lits[i]]);
+        const unsigned m = bw.close();
+        if (m == 0 || m > 0xffff)
+            return 0;
+        if (k < nstreams - 1)
+            set_le16(q + dlen + 2 * k, m);
+        clen += m;
+    }
+
+    const unsigned big = UPX_MAX(nlits, clen);
+    const unsigned sf = single ? 0 : big < 1024 ? 1 : big < 16384 ? 2 : 3;
+    const unsigned hsize = sf < 2 ? 3 : sf + 2;
+    const unsigned nbits = sf < 2 ? 10 : sf * 4 + 6;
+    if (clen >= (1u << nbits) || hsize + clen >= nlits)
+        return 0;
+    const upx_uint64_t h = 2 | (sf << 2) | ((upx_uint64_t) nlits << 4) |
+                           ((upx_uint64_t) clen << (4 + nbits));
+    for (unsigned i = 0; i < hsize; i++)
+        p[i] = (upx_byte) (h >> (8 * i));
+    memmove(p + hsize, q, clen);
+    return hsize + clen;
+}
+
+// Literals_Section; return its size or 0
+unsigned ZstdEncoder::putLiterals(upx_byte *p, unsigned cap)
+{
+    unsigned n = nlits >= 256 ? putHuffman(p, cap) : 0;
+    if (n != 0)
+        return n;
+    bool same = nlits > 0;
+    for (unsigned i = 1; same && i < nlits; i++)
+        same = lits[i] == lits[0];
+    const unsigned type = same && nlits > 3 ? 1 : 0;
+    const unsigned hsize = nlits < 32 ? 1 : nlits < 4096 ? 2 : 3;
+    n = hsize + (type ? 1 : nlits);
+    if (n > cap)
+        return 0;
+    if (hsize == 1)
+        p[0] = (upx_byte) (type | (nlits << 3));
+    else
+    {
+        const unsigned h = type | ((hsize == 2 ? 1 : 3) << 2) | (nlits << 4);
+        p[0] = (upx_byte) h;
+        p[1] = (upx_byte) (h >> 8);
+        if (hsize == 3)
+            p[2] = (upx_byte) (h >> 16);
+    }
+    if (type)
+        p[hsize] = lits[0];
+    else
+        memcpy(p + hsize, lits, nlits);
+    return n;
+}
+
+// Sequences_Section; return its size or 0
+unsigned ZstdEncoder::putSequences(upx_byte *p, unsigned cap)
+{
+    if (cap < 4)
+        return 0;
+    unsigned n = 0;
+    if (nseqs < 128)
+        p[n++] = (upx_byte) nseqs;
+    else if (nseqs < 0x7f00)
+    {
+        p[n++] = (upx_byte) ((nseqs >> 8) + 128);
+        p[n++] = (upx_byte) nseqs;
+    }
+    else
+    {
+        p[n++] = 255;
+        set_le16(p + n, nseqs - 0x7f00);
+        n += 2;
+    }
+    if (nseqs == 0)
+        return n;
+
+    // codes
+    unsigned ll_count[64], ml_count[64], of_count[64];
+    memset(ll_count, 0, sizeof(ll_count));
+    memset(ml_count, 0, sizeof(ml_count));
+    memset(of_count, 0, sizeof(of_count));
+    MemBuffer code_buf(3 * nseqs);
+    upx_byte *const llc = code_buf;
+    upx_byte *const mlc = llc + nseqs;
+    upx_byte *const ofc = mlc + nseqs;
+    for (unsigned i = 0; i < nseqs; i++)
+    {
+        llc[i] = (upx_byte) llCode(seqs[i].lit);
+        mlc[i] = (upx_byte) mlCode(seqs[i].len);
+        ofc[i] = (upx_byte) zstd_bsr(seqs[i].off);
+        ll_count[llc[i]]++;
+        ml_count[mlc[i]]++;
+        of_count[ofc[i]]++;
+    }
+
+    // Symbol_Compression_Modes: RLE, Predefined or FSE_Compressed
+    const unsigned modes_pos = n++;
+    unsigned modes = 0;
+    struct {
+        ZstdFseCTable *ct;
+        const unsigned *count;
+        unsigned max_sym, max_log, shift;
+        unsigned long long w0, w1, w2;
+        unsigned predef_n, predef_log;
+    } const tabs[3] = {
+        { &ll_ct, ll_count, ZSTD_LL_MAX, ZSTD_LL_LOG, 6,
+          0x36db4936db6db6e5ULL, 0x9249c6dbULL, 0, 36, 6 },
+        { &of_ct, of_count, ZSTD_OF_MAX, ZSTD_OF_LOG, 4,
+          0x24924924936d2492ULL, 0x92ULL, 0, 29, 5 },
+        { &ml_ct, ml_count, ZSTD_ML_MAX, ZSTD_ML_LOG, 2,
+          0x24924924936db72aULL, 0x2492492492492492ULL, 0x492ULL, 53, 6 },
+    };
+    for (const auto &t : tabs)
+    {
+        unsigned max_sym = t.max_sym, used = 0;
+        while (t.count[max_sym] == 0)
+            max_sym--;
+        for (unsigned s = 0; s <= max_sym; s++)
+            used += t.count[s] != 0;
+        if (used == 1)
+        {
+            if (n >= cap)
+                return 0;
+            p[n++] = (upx_byte) max_sym;
+            t.ct->rle = true;
+            t.ct->log = 0;
+            modes |= 1 << t.shift;
+            continue;
+        }
+        short predef[64], norm[64];
+        zstd_predef(predef, t.predef_n, t.w0, t.w1, t.w2);
+        const unsigned predef_cost = max_sym < t.predef_n
+            ? zstd_fse_cost(t.count, predef, max_sym, t.predef_log) : 0xffffffffu;
+        const unsigned log = zstd_fse_log(nseqs, max_sym, t.max_log);
+        zstd_fse_normalize(norm, t.count, max_sym, nseqs, log);
+        upx_byte desc[128];
+        const unsigned dlen = zstd_fse_write_ncount(desc, sizeof(desc), norm, max_sym, log);
+        const unsigned cost = zstd_fse_cost(t.count, norm, max_sym, log);
+        if (dlen != 0 && (predef_cost == 0xffffffffu || cost / 256 + dlen * 8 < predef_cost / 256))
+        {
+            if (n + dlen > cap)
+                return 0;
+            memcpy(p + n, desc, dlen);
+            n += dlen;
+            t.ct->build(norm, max_sym, log);
+            modes |= 2 << t.shift;
+        }
+        else if (predef_cost != 0xffffffffu)
+            t.ct->build(predef, t.predef_n - 1, t.predef_log);
+        else
+            return 0;
+    }
+    p[modes_pos] = (upx_byte) modes;
+
+    // the bit stream, backwards from the last sequence
+    ZstdBitWriter bw(p + n, cap - n);
+    ZstdFseState ll_st, ml_st, of_st;
+    unsigned bits;
+    unsigned i = nseqs - 1;
+    ml_st.init(&ml_ct, mlc[i]);
+    of_st.init(&of_ct, ofc[i]);
+    ll_st.init(&ll_ct, llc[i]);
+    for (;;)
+    {
+        unsigned base = zstd_ll_base(llc[i], &bits);
+        bw.put(seqs[i].lit - base, bits);
+        base = zstd_ml_base(mlc[i], &bits);
+        bw.put(seqs[i].len - base, bits);
+        bw.put(seqs[i].off, ofc[i]);
+        if (i-- == 0)
+            break;
+        of_st.encode(&bw, ofc[i]);
+        ml_st.encode(&bw, mlc[i]);
+        ll_st.encode(&bw, llc[i]);
+    }
+    ml_st.flush(&bw);
+    of_st.flush(&bw);
+    ll_st.flush(&bw);
+    const unsigned m = bw.close();
+    return m ? n + m : 0;
+}
+
+bool ZstdEncoder::putBlock(unsigned bstart, unsigned bend, bool last)
+{
+    const unsigned bsize = bend - bstart;
+    const unsigned saved_rep[3] = { rep[0], rep[1], rep[2] };
+    parseBlock(bstart, bend);
+
+    unsigned n = putLiterals(blk_buf, bsize);
+    if (n != 0)
+    {
+        const unsigned m = putSequences(blk_buf + n, bsize - n);
+        n = m ? n + m : 0;
+    }
+    if (n == 0 || n >= bsize)
+    {
+        // Raw_Block; the decoder leaves the repeat offsets alone
+        memcpy(rep, saved_rep, sizeof(rep));
+        if (dst_len - olen < 3 + bsize)
+            return false;
+        set_le24(dst + olen, (bsize << 3) | last);
+        memcpy(dst + olen + 3, src + bstart, bsize);
+        olen += 3 + bsize;
+        return true;
+    }
+    if (dst_len - olen < 3 + n)
+        return false;
+    set_le24(dst + olen, (n << 3) | (2 << 1) | last);
+    memcpy(dst + olen + 3, blk_buf, n);
+    olen += 3 + n;
+    return true;
+}
+
+int ZstdEncoder::compress(unsigned *out_len, upx_callback_p cb, const upx_compress_config_t *cconf)
+{
+    // Single_Segment_Flag, 4 bytes of Frame_Content_Size
+    if (dst_len < 9 + 3)
+        return UPX_E_NOT_COMPRESSIBLE;
+    set_le32(dst, 0xfd2fb528);
+    dst[4] = 0x80 | 0x20;
+    set_le32(dst + 5, src_len);
+    olen = 9;
+
+    unsigned pos = 0;
+    do
+    {
+        if (cb && cb->nprogress)
+            cb->nprogress(cb, pos, olen);
+        if (upx_compress_over_budget(cconf, olen))
+            return UPX_E_BUDGET_EXCEEDED;
+        const unsigned bend = pos + UPX_MIN(src_len - pos, (unsigned) BLOCK_SIZE);
+        if (!putBlock(pos, bend, bend == src_len))
+            return UPX_E_NOT_COMPRESSIBLE;
+        pos = bend;
+    } while (pos < src_len);
+    if (cb && cb->nprogress)
+        cb->nprogress(cb, src_len, olen);
+    *out_len = olen;
+    return UPX_E_OK;
+}
+
+} // namespace
+
+
+/*************************************************************************
+//
+**************************************************************************/
+
+int upx_zstd_compress      ( const upx_bytep src, unsigned  src_len,
+                                   upx_bytep dst, unsigned* dst_len,
+                                   upx_callback_p cb,
+                                   int method, int level,
+                             const upx_compress_config_t *cconf_parm,
+                                   upx_compress_result_t *cresult )
+{
+    assert(method == M_ZSTD);
+    assert(level > 0); assert(cresult != nullptr);
+    UNUSED(method);
+    int r;
+    unsigned c_len = 0;
+
+    try {
+        ZstdEncoder enc(src, src_len, dst, *dst_len, level);
+        r = enc.compress(&c_len, cb, cconf_parm);
+    } catch (...) {
+        r = UPX_E_OUT_OF_MEMORY;
+    }
+    *dst_len = c_len;
+    return r;
+}
+
+
+/*************************************************************************
+//
+**************************************************************************/
+
+// Decode into dst[0..*dst_len); src and dst may overlap like in
+// upx_zstd_test_overlap(). If "need" is given, it returns the
+// smallest offset of src in dst that allows in-place decompression.
+static int zstd_decode(const upx_byte *src, unsigned src_len,
+                       upx_byte *dst, unsigned *dst_len, unsigned *need)
+{
+    ACC_COMPILE_TIME_ASSERT(sizeof(ZstdWork) <= ZSTD_WORK_SIZE)
+    MemBuffer wb(sizeof(ZstdWork));
+    ZstdWork *w = (ZstdWork *) (upx_bytep) wb;
+    int r = ZstdDecode(src, src_len, dst, dst_len, w);
+    if (r <= 0)
+        return UPX_E_ERROR;
+    if ((unsigned) r != src_len)
+        return UPX_E_INPUT_NOT_CONSUMED;
+    if (need)
+        *need = UPX_MAX(0, w->need);
+    return UPX_E_OK;
+}
+
+int upx_zstd_decompress    ( const upx_bytep src, unsigned  src_len,
+                                   upx_bytep dst, unsigned* dst_len,
+                                   int method,
+                             const upx_compress_result_t *cresult )
+{
+    assert(method == M_ZSTD);
+    UNUSED(method);
+    UNUSED(cresult);
+    return zstd_decode(src, src_len, dst, dst_len, nullptr);
+}
+
+
+/*************************************************************************
+// test_overlap - see <ucl/ucl.h> for semantics
+**************************************************************************/
+
+int upx_zstd_test_overlap  ( const upx_bytep buf,
+                             const upx_bytep tbuf,
+                                   unsigned  src_off, unsigned src_len,
+                                   unsigned* dst_len,
+                                   int method,
+                             const upx_compress_result_t *cresult )
+{
+    assert(method == M_ZSTD);
+    UNUSED(method);
+    UNUSED(cresult);
+
+    MemBuffer b(src_off + src_len);
+    memcpy(b + src_off, buf + src_off, src_len);
+    unsigned saved_dst_len = *dst_len;
+    unsigned need = 0;
+    int r = zstd_decode(b + src_off, src_len, b, dst_len, &need);
+    if (r != UPX_E_OK)
+        return r;
+    if (*dst_len != saved_dst_len || need > src_off)
+        return UPX_E_ERROR;
+    if (tbuf != nullptr && memcmp(tbuf, b, *dst_len) != 0)
+        return UPX_E_ERROR;
+    return UPX_E_OK;
+}
+
+int upx_zstd_find_overlap  ( const upx_bytep src, unsigned src_len,
+                                   unsigned  dst_len,
+                                   unsigned* src_off,
+                                   int method,
+                             const upx_compress_result_t *cresult )
+{
+    assert(method == M_ZSTD);
+    UNUSED(method);
+    UNUSED(cresult);
+
+    MemBuffer b(dst_len);
+    unsigned d_len = dst_len;
+    int r = zstd_decode(src, src_len, b, &d_len, src_off);
+    if (r != UPX_E_OK)
+        return r;
+    return d_len == dst_len ? UPX_E_OK : UPX_E_ERROR;
+}
+
+
+/*************************************************************************
+// Debug checks
+**************************************************************************/
+
+#if DEBUG && 1
+
+static bool check_zstd(const upx_bytep u_buf, unsigned u_len, int level)
+{
+    MemBuffer c_buf, d_buf;
+    upx_compress_result_t cresult;
+    unsigned c_len, d_len;
+    int r;
+
+    c_buf.allocForCompression(u_len);
+    d_buf.allocForUncompression(u_len);
+    c_len = c_buf.getSize();
+    r = upx_zstd_compress(u_buf, u_len, c_buf, &c_len, nullptr, M_ZSTD, level, NULL_cconf, &cresult);
+    if (r != 0) return false;
+    d_len = d_buf.getSize();
+    r = upx_zstd_decompress(c_buf, c_len, d_buf, &d_len, M_ZSTD, nullptr);
+    if (r != 0 || d_len != u_len || memcmp(u_buf, d_buf, u_len) != 0) return false;
+    if (c_len >= u_len)
+        return true;
+
+    // in-place decompression must work with the overlap found
+    unsigned src_off = 0;
+    r = upx_zstd_find_overlap(c_buf, c_len, u_len, &src_off, M_ZSTD, nullptr);
+    if (r != 0) return false;
+    src_off = UPX_MAX(src_off, u_len - c_len + 1);
+    MemBuffer o_buf(src_off + c_len);
+    memcpy(o_buf + src_off, c_buf, c_len);
+    unsigned x_len = u_len;
+    r = upx_zstd_test_overlap(o_buf, u_buf, src_off, c_len, &x_len, M_ZSTD, nullptr);
+    return r == 0 && x_len == u_len;
+}
+
+TEST_CASE("compress_zstd") {
+    const unsigned u_len = 300000;
+    MemBuffer u_buf(u_len);
+    // skewed literals followed by copies, including long and repeated ones
+    unsigned x = 1;
+    unsigned last_off = 1;
+    for (unsigned i = 0; i < u_len; ) {
+        x = x * 1103515245 + 12345;
+        const unsigned n = (x & 0x40000) ? 1 + ((x >> 16) & 1023) : 1 + ((x >> 16) & 31);
+        const bool copy = i >= 16 && (x & 3) != 0;
+        unsigned off = 0;
+        if (copy)
+            off = (x & 0x80) ? UPX_MIN(last_off, i) : 1 + ((x >> 4) % UPX_MIN(i, 200000u));
+        if (copy)
+            last_off = off;
+        for (unsigned j = 0; j < n && i < u_len; j++, i++) {
+            x = x * 1103515245 + 12345;
+            u_buf[i] = copy ? u_buf[i - off] : (upx_byte) ((x >> 23) & (x >> 27));
+        }
+    }
+    for (int level = 1; level <= 10; level++)
+        CHECK(check_zstd(u_buf, u_len, level));
+    // tiny and incompressible inputs are raw blocks
+    CHECK(check_zstd(u_buf, 1, 1));
+    CHECK(check_zstd(u_buf, 13, 9));
+    for (unsigned i = 0; i < 4096; i++)
+        u_buf[i] = (upx_byte) ((i * 0x9e3779b1u) >> 24);
+    CHECK(check_zstd(u_buf, 4096, 1));
+    // a single long run
+    memset(u_buf, 'x', u_len);
+    CHECK(check_zstd(u_buf, u_len, 1));
+    CHECK(check_zstd(u_buf, u_len, 10));
+}
+
+#endif // DEBUG
+
+/* vim:set ts=4 sw=4 et: */
@@ -432,6 +432,7 @@ constexpr bool string_ge(const char *a, const char *b) {
 #define UPX_E_INPUT_NOT_CONSUMED    (-8)
 #define UPX_E_NOT_YET_IMPLEMENTED   (-9)
 #define UPX_E_INVALID_ARGUMENT      (-10)
+#define UPX_E_BUDGET_EXCEEDED       (-11)
 
 
 // Executable formats. Note: big endian types are >= 128.
@@ -515,6 +516,8 @@ constexpr bool string_ge(const char *a, const char *b) {
 //#define M_CL1B_LE16     13
 #define M_LZMA          14
 #define M_DEFLATE       15      /* zlib */
+#define M_LZ4           16
+#define M_ZSTD          17
 // compression methods internal usage
 #define M_ALL           (-1)
 #define M_END           (-2)
@@ -528,6 +531,8 @@ constexpr bool string_ge(const char *a, const char *b) {
 //#define M_IS_CL1B(x)    ((x) >= M_CL1B_LE32  && (x) <= M_CL1B_LE16)
 #define M_IS_LZMA(x)    (((x) & 255) == M_LZMA)
 #define M_IS_DEFLATE(x) ((x) == M_DEFLATE)
+#define M_IS_LZ4(x)     ((x) == M_LZ4)
+#define M_IS_ZSTD(x)    ((x) == M_ZSTD)
 
 
 // filters
@@ -650,7 +655,11 @@ struct upx_compress_config_t
     lzma_compress_config_t  conf_lzma;
     ucl_compress_config_t   conf_ucl;
     zlib_compress_config_t  conf_zlib;
-    void reset() { conf_lzma.reset(); conf_ucl.reset(); conf_zlib.reset(); }
+    // give up with UPX_E_BUDGET_EXCEEDED as soon as the compressed size
+    // reaches budget (0 means no limit) - see upx_compress_over_budget()
+    unsigned                budget;
+    void reset() { conf_lzma.reset(); conf_ucl.reset(); conf_zlib.reset();
+                   budget = 0; }
 };
 
 #define NULL_cconf  ((upx_compress_config_t *) nullptr)
@@ -771,6 +780,7 @@ void show_version(int);
 
 // compress.cpp
 unsigned upx_adler32(const void *buf, unsigned len, unsigned adler=1);
+unsigned upx_adler32_rebase(unsigned adler, unsigned len, unsigned old_adler, unsigned new_adler);
 unsigned upx_crc32(const void *buf, unsigned len, unsigned crc=0);
 
 int upx_compress           ( const upx_bytep src, unsigned  src_len,
@@ -779,6 +789,8 @@ int upx_compress           ( const upx_bytep src, unsigned  src_len,
                                    int method, int level,
                              const upx_compress_config_t *cconf,
                                    upx_compress_result_t *cresult );
+bool upx_compress_over_budget(const upx_compress_config_t *cconf, unsigned c_pos);
+void upx_compress_print_stats(void);
 int upx_decompress         ( const upx_bytep src, unsigned  src_len,
                                    upx_bytep dst, unsigned* dst_len,
                                    int method,
@@ -789,6 +801,11 @@ int upx_test_overlap       ( const upx_bytep buf,
                                    unsigned* dst_len,
                                    int method,
                              const upx_compress_result_t *cresult );
+int upx_find_overlap       ( const upx_bytep src, unsigned src_len,
+                                   unsigned  dst_len,
+                                   unsigned* overlap_overhead,
+                                   int method,
+                             const upx_compress_result_t *cresult );
 
 
 #if (ACC_OS_CYGWIN || ACC_OS_DOS16 || ACC_OS_DOS32 || ACC_OS_EMX || ACC_OS_OS2 || ACC_OS_OS216 || ACC_OS_WIN16 || ACC_OS_WIN32 || ACC_OS_WIN64)
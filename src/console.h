@@ -122,9 +122,6 @@ typedef struct
 console_t;
 
 
-void con_fprintf(FILE *f, const char *format, ...) attribute_format(2, 3);
-
-
 #define FG_BLACK     0x00
 #define FG_BLUE      0x01
 #define FG_GREEN     0x02
@@ -160,6 +157,8 @@ void con_fprintf(FILE *f, const char *format, ...) attribute_format(2, 3);
 
 extern FILE *con_term;
 
+void con_fprintf(FILE *f, const char *format, ...) attribute_format(2, 3);
+
 #if (USE_CONSOLE)
 
 extern int con_mode;
@@ -173,13 +172,32 @@ extern console_t console_ansi_color;
 extern console_t console_screen;
 
 
-#define con_fg(f,x)     con->set_fg(f,x)
+#define con_fg(f,x)     (con_capture_active() ? -1 : con->set_fg(f,x))
 
 #else
 
 #define con_fg(f,x)     0
-#define con_fprintf     fprintf
 
 #endif /* USE_CONSOLE */
 
+
+/*************************************************************************
+// capture the console output of the current thread instead of
+// printing it, so that parallel jobs can print their output in
+// order - see do_files()
+**************************************************************************/
+
+struct con_capture_t
+{
+    char *buf;      // records of: stream ('1' or '2'), text, '\0'
+    size_t len;
+    size_t size;
+};
+
+void con_capture_begin(con_capture_t *c);
+void con_capture_end(void);
+bool con_capture_active(void);
+bool con_capture_print(FILE *f, const char *s);
+void con_capture_flush(con_capture_t *c);
+
 /* vim:set ts=4 sw=4 et: */
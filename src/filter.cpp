@@ -51,12 +51,10 @@ void initFilter(Filter *f, upx_byte *buf, unsigned buf_len)
 
 const FilterImp::FilterEntry *FilterImp::getFilter(int id)
 {
-    static bool done = false;
     static unsigned char filter_map[256];
 
-    if (!done)
-    {
-        // init the filter_map[]
+    // init the filter_map[]; thread-safe as a static local initializer
+    static const bool done = []() {
         assert(n_filters <= 254);       // as 0xff means "empty slot"
         memset(filter_map, 0xff, sizeof(filter_map));
         for (int i = 0; i < n_filters; i++)
@@ -66,8 +64,9 @@ const FilterImp::FilterEntry *FilterImp::getFilter(int id)
             assert(filter_map[filter_id] == 0xff);
             filter_map[filter_id] = (unsigned char) i;
         }
-        done = true;
-    }
+        return true;
+    }();
+    UNUSED(done);
 
     if (id < 0 || id > 255)
         return nullptr;
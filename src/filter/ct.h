@@ -31,11 +31,11 @@
 // 16-bit calltrick ("naive")
 **************************************************************************/
 
-#define CT16(f, cond, addvalue, get, set) \
+#define CT16(f, kind, addvalue, get, set) \
     upx_byte *b = f->buf; \
     upx_byte *b_end = b + f->buf_len - 3; \
     do { \
-        if (cond) \
+        if (filter_scan_match<kind>(b)) \
         { \
             b += 1; \
             unsigned a = (unsigned) (b - f->buf); \
@@ -44,7 +44,7 @@
             f->calls++; \
             b += 2 - 1; \
         } \
-    } while (++b < b_end); \
+    } while ((b = filter_scan_ptr<kind>(b + 1, b_end)) < b_end); \
     if (f->lastcall) f->lastcall += 2; \
     return 0;
 
@@ -53,153 +53,153 @@
 // filter: e8, e9, e8e9
 static int f_ct16_e8(Filter *f)
 {
-    CT16(f, (*b == 0xe8), a + f->addvalue, get_le16, set_le16)
+    CT16(f, FILTER_SCAN_E8, a + f->addvalue, get_le16, set_le16)
 }
 
 static int f_ct16_e9(Filter *f)
 {
-    CT16(f, (*b == 0xe9), a + f->addvalue, get_le16, set_le16)
+    CT16(f, FILTER_SCAN_E9, a + f->addvalue, get_le16, set_le16)
 }
 
 static int f_ct16_e8e9(Filter *f)
 {
-    CT16(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le16, set_le16)
+    CT16(f, FILTER_SCAN_E8E9, a + f->addvalue, get_le16, set_le16)
 }
 
 
 // unfilter: e8, e9, e8e9
 static int u_ct16_e8(Filter *f)
 {
-    CT16(f, (*b == 0xe8), 0 - a - f->addvalue, get_le16, set_le16)
+    CT16(f, FILTER_SCAN_E8, 0 - a - f->addvalue, get_le16, set_le16)
 }
 
 static int u_ct16_e9(Filter *f)
 {
-    CT16(f, (*b == 0xe9), 0 - a - f->addvalue, get_le16, set_le16)
+    CT16(f, FILTER_SCAN_E9, 0 - a - f->addvalue, get_le16, set_le16)
 }
 
 static int u_ct16_e8e9(Filter *f)
 {
-    CT16(f, (*b == 0xe8 || *b == 0xe9), 0 - a - f->addvalue, get_le16, set_le16)
+    CT16(f, FILTER_SCAN_E8E9, 0 - a - f->addvalue, get_le16, set_le16)
 }
 
 
 // scan: e8, e9, e8e9
 static int s_ct16_e8(Filter *f)
 {
-    CT16(f, (*b == 0xe8), a + f->addvalue, get_le16, set_dummy)
+    CT16(f, FILTER_SCAN_E8, a + f->addvalue, get_le16, set_dummy)
 }
 
 static int s_ct16_e9(Filter *f)
 {
-    CT16(f, (*b == 0xe9), a + f->addvalue, get_le16, set_dummy)
+    CT16(f, FILTER_SCAN_E9, a + f->addvalue, get_le16, set_dummy)
 }
 
 static int s_ct16_e8e9(Filter *f)
 {
-    CT16(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le16, set_dummy)
+    CT16(f, FILTER_SCAN_E8E9, a + f->addvalue, get_le16, set_dummy)
 }
 
 
 // filter: e8, e9, e8e9 with bswap le->be
 static int f_ct16_e8_bswap_le(Filter *f)
 {
-    CT16(f, (*b == 0xe8), a + f->addvalue, get_le16, set_be16)
+    CT16(f, FILTER_SCAN_E8, a + f->addvalue, get_le16, set_be16)
 }
 
 static int f_ct16_e9_bswap_le(Filter *f)
 {
-    CT16(f, (*b == 0xe9), a + f->addvalue, get_le16, set_be16)
+    CT16(f, FILTER_SCAN_E9, a + f->addvalue, get_le16, set_be16)
 }
 
 static int f_ct16_e8e9_bswap_le(Filter *f)
 {
-    CT16(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le16, set_be16)
+    CT16(f, FILTER_SCAN_E8E9, a + f->addvalue, get_le16, set_be16)
 }
 
 
 // unfilter: e8, e9, e8e9 with bswap le->be
 static int u_ct16_e8_bswap_le(Filter *f)
 {
-    CT16(f, (*b == 0xe8), 0 - a - f->addvalue, get_be16, set_le16)
+    CT16(f, FILTER_SCAN_E8, 0 - a - f->addvalue, get_be16, set_le16)
 }
 
 static int u_ct16_e9_bswap_le(Filter *f)
 {
-    CT16(f, (*b == 0xe9), 0 - a - f->addvalue, get_be16, set_le16)
+    CT16(f, FILTER_SCAN_E9, 0 - a - f->addvalue, get_be16, set_le16)
 }
 
 static int u_ct16_e8e9_bswap_le(Filter *f)
 {
-    CT16(f, (*b == 0xe8 || *b == 0xe9), 0 - a - f->addvalue, get_be16, set_le16)
+    CT16(f, FILTER_SCAN_E8E9, 0 - a - f->addvalue, get_be16, set_le16)
 }
 
 
 // scan: e8, e9, e8e9 with bswap le->be
 static int s_ct16_e8_bswap_le(Filter *f)
 {
-    CT16(f, (*b == 0xe8), a + f->addvalue, get_be16, set_dummy)
+    CT16(f, FILTER_SCAN_E8, a + f->addvalue, get_be16, set_dummy)
 }
 
 static int s_ct16_e9_bswap_le(Filter *f)
 {
-    CT16(f, (*b == 0xe9), a + f->addvalue, get_be16, set_dummy)
+    CT16(f, FILTER_SCAN_E9, a + f->addvalue, get_be16, set_dummy)
 }
 
 static int s_ct16_e8e9_bswap_le(Filter *f)
 {
-    CT16(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_be16, set_dummy)
+    CT16(f, FILTER_SCAN_E8E9, a + f->addvalue, get_be16, set_dummy)
 }
 
 
 // filter: e8, e9, e8e9 with bswap be->le
 static int f_ct16_e8_bswap_be(Filter *f)
 {
-    CT16(f, (*b == 0xe8), a + f->addvalue, get_be16, set_le16)
+    CT16(f, FILTER_SCAN_E8, a + f->addvalue, get_be16, set_le16)
 }
 
 static int f_ct16_e9_bswap_be(Filter *f)
 {
-    CT16(f, (*b == 0xe9), a + f->addvalue, get_be16, set_le16)
+    CT16(f, FILTER_SCAN_E9, a + f->addvalue, get_be16, set_le16)
 }
 
 static int f_ct16_e8e9_bswap_be(Filter *f)
 {
-    CT16(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_be16, set_le16)
+    CT16(f, FILTER_SCAN_E8E9, a + f->addvalue, get_be16, set_le16)
 }
 
 
 // unfilter: e8, e9, e8e9 with bswap be->le
 static int u_ct16_e8_bswap_be(Filter *f)
 {
-    CT16(f, (*b == 0xe8), 0 - a - f->addvalue, get_le16, set_be16)
+    CT16(f, FILTER_SCAN_E8, 0 - a - f->addvalue, get_le16, set_be16)
 }
 
 static int u_ct16_e9_bswap_be(Filter *f)
 {
-    CT16(f, (*b == 0xe9), 0 - a - f->addvalue, get_le16, set_be16)
+    CT16(f, FILTER_SCAN_E9, 0 - a - f->addvalue, get_le16, set_be16)
 }
 
 static int u_ct16_e8e9_bswap_be(Filter *f)
 {
-    CT16(f, (*b == 0xe8 || *b == 0xe9), 0 - a - f->addvalue, get_le16, set_be16)
+    CT16(f, FILTER_SCAN_E8E9, 0 - a - f->addvalue, get_le16, set_be16)
 }
 
 
 // scan: e8, e9, e8e9 with bswap be->le
 static int s_ct16_e8_bswap_be(Filter *f)
 {
-    CT16(f, (*b == 0xe8), a + f->addvalue, get_le16, set_dummy)
+    CT16(f, FILTER_SCAN_E8, a + f->addvalue, get_le16, set_dummy)
 }
 
 static int s_ct16_e9_bswap_be(Filter *f)
 {
-    CT16(f, (*b == 0xe9), a + f->addvalue, get_le16, set_dummy)
+    CT16(f, FILTER_SCAN_E9, a + f->addvalue, get_le16, set_dummy)
 }
 
 static int s_ct16_e8e9_bswap_be(Filter *f)
 {
-    CT16(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le16, set_dummy)
+    CT16(f, FILTER_SCAN_E8E9, a + f->addvalue, get_le16, set_dummy)
 }
 
 
@@ -210,11 +210,11 @@ static int s_ct16_e8e9_bswap_be(Filter *f)
 // 32-bit calltrick ("naive")
 **************************************************************************/
 
-#define CT32(f, cond, addvalue, get, set) \
+#define CT32(f, kind, addvalue, get, set) \
     upx_byte *b = f->buf; \
     upx_byte *b_end = b + f->buf_len - 5; \
     do { \
-        if (cond) \
+        if (filter_scan_match<kind>(b)) \
         { \
             b += 1; \
             unsigned a = (unsigned) (b - f->buf); \
@@ -223,7 +223,7 @@ static int s_ct16_e8e9_bswap_be(Filter *f)
             f->calls++; \
             b += 4 - 1; \
         } \
-    } while (++b < b_end); \
+    } while ((b = filter_scan_ptr<kind>(b + 1, b_end)) < b_end); \
     if (f->lastcall) f->lastcall += 4; \
     return 0;
 
@@ -231,153 +231,153 @@ static int s_ct16_e8e9_bswap_be(Filter *f)
 // filter: e8, e9, e8e9
 static int f_ct32_e8(Filter *f)
 {
-    CT32(f, (*b == 0xe8), a + f->addvalue, get_le32, set_le32)
+    CT32(f, FILTER_SCAN_E8, a + f->addvalue, get_le32, set_le32)
 }
 
 static int f_ct32_e9(Filter *f)
 {
-    CT32(f, (*b == 0xe9), a + f->addvalue, get_le32, set_le32)
+    CT32(f, FILTER_SCAN_E9, a + f->addvalue, get_le32, set_le32)
 }
 
 static int f_ct32_e8e9(Filter *f)
 {
-    CT32(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le32, set_le32)
+    CT32(f, FILTER_SCAN_E8E9, a + f->addvalue, get_le32, set_le32)
 }
 
 
 // unfilter: e8, e9, e8e9
 static int u_ct32_e8(Filter *f)
 {
-    CT32(f, (*b == 0xe8), 0 - a - f->addvalue, get_le32, set_le32)
+    CT32(f, FILTER_SCAN_E8, 0 - a - f->addvalue, get_le32, set_le32)
 }
 
 static int u_ct32_e9(Filter *f)
 {
-    CT32(f, (*b == 0xe9), 0 - a - f->addvalue, get_le32, set_le32)
+    CT32(f, FILTER_SCAN_E9, 0 - a - f->addvalue, get_le32, set_le32)
 }
 
 static int u_ct32_e8e9(Filter *f)
 {
-    CT32(f, (*b == 0xe8 || *b == 0xe9), 0 - a - f->addvalue, get_le32, set_le32)
+    CT32(f, FILTER_SCAN_E8E9, 0 - a - f->addvalue, get_le32, set_le32)
 }
 
 
 // scan: e8, e9, e8e9
 static int s_ct32_e8(Filter *f)
 {
-    CT32(f, (*b == 0xe8), a + f->addvalue, get_le32, set_dummy)
+    CT32(f, FILTER_SCAN_E8, a + f->addvalue, get_le32, set_dummy)
 }
 
 static int s_ct32_e9(Filter *f)
 {
-    CT32(f, (*b == 0xe9), a + f->addvalue, get_le32, set_dummy)
+    CT32(f, FILTER_SCAN_E9, a + f->addvalue, get_le32, set_dummy)
 }
 
 static int s_ct32_e8e9(Filter *f)
 {
-    CT32(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le32, set_dummy)
+    CT32(f, FILTER_SCAN_E8E9, a + f->addvalue, get_le32, set_dummy)
 }
 
 
 // filter: e8, e9, e8e9 with bswap le->be
 static int f_ct32_e8_bswap_le(Filter *f)
 {
-    CT32(f, (*b == 0xe8), a + f->addvalue, get_le32, set_be32)
+    CT32(f, FILTER_SCAN_E8, a + f->addvalue, get_le32, set_be32)
 }
 
 static int f_ct32_e9_bswap_le(Filter *f)
 {
-    CT32(f, (*b == 0xe9), a + f->addvalue, get_le32, set_be32)
+    CT32(f, FILTER_SCAN_E9, a + f->addvalue, get_le32, set_be32)
 }
 
 static int f_ct32_e8e9_bswap_le(Filter *f)
 {
-    CT32(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le32, set_be32)
+    CT32(f, FILTER_SCAN_E8E9, a + f->addvalue, get_le32, set_be32)
 }
 
 
 // unfilter: e8, e9, e8e9 with bswap le->be
 static int u_ct32_e8_bswap_le(Filter *f)
 {
-    CT32(f, (*b == 0xe8), 0 - a - f->addvalue, get_be32, set_le32)
+    CT32(f, FILTER_SCAN_E8, 0 - a - f->addvalue, get_be32, set_le32)
 }
 
 static int u_ct32_e9_bswap_le(Filter *f)
 {
-    CT32(f, (*b == 0xe9), 0 - a - f->addvalue, get_be32, set_le32)
+    CT32(f, FILTER_SCAN_E9, 0 - a - f->addvalue, get_be32, set_le32)
 }
 
 static int u_ct32_e8e9_bswap_le(Filter *f)
 {
-    CT32(f, (*b == 0xe8 || *b == 0xe9), 0 - a - f->addvalue, get_be32, set_le32)
+    CT32(f, FILTER_SCAN_E8E9, 0 - a - f->addvalue, get_be32, set_le32)
 }
 
 
 // scan: e8, e9, e8e9 with bswap le->be
 static int s_ct32_e8_bswap_le(Filter *f)
 {
-    CT32(f, (*b == 0xe8), a + f->addvalue, get_be32, set_dummy)
+    CT32(f, FILTER_SCAN_E8, a + f->addvalue, get_be32, set_dummy)
 }
 
 static int s_ct32_e9_bswap_le(Filter *f)
 {
-    CT32(f, (*b == 0xe9), a + f->addvalue, get_be32, set_dummy)
+    CT32(f, FILTER_SCAN_E9, a + f->addvalue, get_be32, set_dummy)
 }
 
 static int s_ct32_e8e9_bswap_le(Filter *f)
 {
-    CT32(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_be32, set_dummy)
+    CT32(f, FILTER_SCAN_E8E9, a + f->addvalue, get_be32, set_dummy)
 }
 
 
 // filter: e8, e9, e8e9 with bswap be->le
 static int f_ct32_e8_bswap_be(Filter *f)
 {
-    CT32(f, (*b == 0xe8), a + f->addvalue, get_be32, set_le32)
+    CT32(f, FILTER_SCAN_E8, a + f->addvalue, get_be32, set_le32)
 }
 
 static int f_ct32_e9_bswap_be(Filter *f)
 {
-    CT32(f, (*b == 0xe9), a + f->addvalue, get_be32, set_le32)
+    CT32(f, FILTER_SCAN_E9, a + f->addvalue, get_be32, set_le32)
 }
 
 static int f_ct32_e8e9_bswap_be(Filter *f)
 {
-    CT32(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_be32, set_le32)
+    CT32(f, FILTER_SCAN_E8E9, a + f->addvalue, get_be32, set_le32)
 }
 
 
 // unfilter: e8, e9, e8e9 with bswap be->le
 static int u_ct32_e8_bswap_be(Filter *f)
 {
-    CT32(f, (*b == 0xe8), 0 - a - f->addvalue, get_le32, set_be32)
+    CT32(f, FILTER_SCAN_E8, 0 - a - f->addvalue, get_le32, set_be32)
 }
 
 static int u_ct32_e9_bswap_be(Filter *f)
 {
-    CT32(f, (*b == 0xe9), 0 - a - f->addvalue, get_le32, set_be32)
+    CT32(f, FILTER_SCAN_E9, 0 - a - f->addvalue, get_le32, set_be32)
 }
 
 static int u_ct32_e8e9_bswap_be(Filter *f)
 {
-    CT32(f, (*b == 0xe8 || *b == 0xe9), 0 - a - f->addvalue, get_le32, set_be32)
+    CT32(f, FILTER_SCAN_E8E9, 0 - a - f->addvalue, get_le32, set_be32)
 }
 
 
 // scan: e8, e9, e8e9 with bswap be->le
 static int s_ct32_e8_bswap_be(Filter *f)
 {
-    CT32(f, (*b == 0xe8), a + f->addvalue, get_le32, set_dummy)
+    CT32(f, FILTER_SCAN_E8, a + f->addvalue, get_le32, set_dummy)
 }
 
 static int s_ct32_e9_bswap_be(Filter *f)
 {
-    CT32(f, (*b == 0xe9), a + f->addvalue, get_le32, set_dummy)
+    CT32(f, FILTER_SCAN_E9, a + f->addvalue, get_le32, set_dummy)
 }
 
 static int s_ct32_e8e9_bswap_be(Filter *f)
 {
-    CT32(f, (*b == 0xe8 || *b == 0xe9), a + f->addvalue, get_le32, set_dummy)
+    CT32(f, FILTER_SCAN_E8E9, a + f->addvalue, get_le32, set_dummy)
 }
 
 
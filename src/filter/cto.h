@@ -57,7 +57,7 @@ static int F(Filter *f)
         // So, a call to a destination that is outside the buffer
         // must not conflict with the mark.
         // Note that unsigned comparison checks both edges of buffer.
-        for (ic = 0; ic < size - 5; ic++)
+        for (ic = SCAN(b,0,size - 5); ic < size - 5; ic = SCAN(b,ic+1,size - 5))
         {
             if (!COND(b,ic))
                 continue;
@@ -79,7 +79,7 @@ static int F(Filter *f)
     const unsigned cto = (unsigned)f->cto << 24;
 #endif
 
-    for (ic = 0; ic < size - 5; ic++)
+    for (ic = SCAN(b,0,size - 5); ic < size - 5; ic = SCAN(b,ic+1,size - 5))
     {
         if (!COND(b,ic))
             continue;
@@ -147,7 +147,7 @@ static int U(Filter *f)
 
     unsigned ic, jc;
 
-    for (ic = 0; ic < size5; ic++)
+    for (ic = SCAN(b,0,size5); ic < size5; ic = SCAN(b,ic+1,size5))
         if (COND(b,ic))
         {
             jc = get_be32(b+ic+1);
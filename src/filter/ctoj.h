@@ -56,7 +56,7 @@ static int F(Filter *f)
         unsigned char buf[256];
         memset(buf,0,256);
 
-        for (ic = 0; ic < size - 5; ic++)
+        for (ic = SCAN(b,0,size - 5); ic < size - 5; ic = SCAN(b,ic+1,size - 5))
         {
             if (!COND(b,ic,lastcall))
                 continue;
@@ -78,7 +78,7 @@ static int F(Filter *f)
     const unsigned cto = (unsigned)f->cto << 24;
 #endif
 
-    for (ic = 0; ic < size - 5; ic++)
+    for (ic = SCAN(b,0,size - 5); ic < size - 5; ic = SCAN(b,ic+1,size - 5))
     {
         if (!COND(b,ic,lastcall))
             continue;
@@ -146,7 +146,7 @@ static int U(Filter *f)
 //    unsigned lastcall = 0;    // lastcall is not used in COND macro
     unsigned ic, jc;
 
-    for (ic = 0; ic < size5; ic++)
+    for (ic = SCAN(b,0,size5); ic < size5; ic = SCAN(b,ic+1,size5))
         if (COND(b,ic,lastcall))
         {
             jc = get_be32(b+ic+1);
@@ -130,7 +130,7 @@ static int F(Filter *f)
         unsigned char buf[256];
         memset(buf,0,256);
 
-        for (ic = 0; ic < size - 5; ic++)
+        for (ic = SCANF(b,0,size - 5); ic < size - 5; ic = SCANF(b,ic+1,size - 5))
             if (CONDF(which,b,ic,lastcall) && get_le32(b+ic+1)+ic+1 >= size)
             {
                 buf[b[ic+1]] |= 1;
@@ -145,7 +145,7 @@ static int F(Filter *f)
     const unsigned cto = (unsigned)f->cto << 24;
 #endif
 
-    for (ic = 0; ic < size - 5; ic++)
+    for (ic = SCANF(b,0,size - 5); ic < size - 5; ic = SCANF(b,ic+1,size - 5))
     {
         int which;
         int f_on = 0;
@@ -279,7 +279,7 @@ static int U(Filter *f)
     unsigned mru[N_MRU];
     memset(&mru[0], 0, sizeof(mru));
 
-    for (ic = 0; ic < size5; ic++) {
+    for (ic = SCANU(b,0,size5); ic < size5; ic = SCANU(b,ic+1,size5)) {
         int which;
         if (CONDU(which,b,ic,lastcall))
         {
@@ -57,7 +57,7 @@ static int F(Filter *f)
         unsigned char buf[256];
         memset(buf,0,256);
 
-        for (ic = 0; ic < size - 5; ic++)
+        for (ic = SCAN(b,0,size - 5,id); ic < size - 5; ic = SCAN(b,ic+1,size - 5,id))
         {
             if (!COND(b,ic,lastcall,id))
                 continue;
@@ -79,7 +79,7 @@ static int F(Filter *f)
     const unsigned cto = (unsigned)f->cto << 24;
 #endif
 
-    for (ic = 0; ic < size - 5; ic++)
+    for (ic = SCAN(b,0,size - 5,id); ic < size - 5; ic = SCAN(b,ic+1,size - 5,id))
     {
         if (!COND(b,ic,lastcall,id))
             continue;
@@ -149,7 +149,7 @@ static int U(Filter *f)
 
     unsigned ic, jc;
 
-    for (ic = 0; ic < size5; ic++)
+    for (ic = SCAN(b,0,size5,id); ic < size5; ic = SCAN(b,ic+1,size5,id))
         if (COND(b,ic,lastcall,id))
         {
             jc = get_be32(b+ic+1);
@@ -0,0 +1,161 @@
+/* scan.h -- find calltrick candidates
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2022 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2022 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+
+/*************************************************************************
+// The x86 calltrick filters spend most of their time looking for
+// the next opcode byte they are interested in. filter_scan() skips
+// over all positions that cannot possibly match, 16 bytes at a time
+// where possible; the filters then check their exact COND at the
+// returned position as before, so the output does not change.
+//
+// As the filters modify the buffer while they walk through it,
+// nothing is cached across calls.
+**************************************************************************/
+
+#define FILTER_SCAN_E8          1   // call
+#define FILTER_SCAN_E9          2   // jmp
+#define FILTER_SCAN_E8E9        3
+#define FILTER_SCAN_JCC         4   // 0x0f 0x8y, looks at b[x-1]
+#define FILTER_SCAN_JCC_SWAPPED 8   // 0x8y 0x0f, looks at b[x-1]
+
+#if (ACC_ARCH_AMD64 || ACC_ARCH_I386) && (ACC_CC_CLANG || ACC_CC_GNUC) && defined(__SSE2__)
+#  define WITH_FILTER_SCAN_SSE2 1
+#  include <emmintrin.h>
+#elif (ACC_ARCH_ARM64) && (ACC_CC_CLANG || ACC_CC_GNUC)
+#  define WITH_FILTER_SCAN_NEON 1
+#  include <arm_neon.h>
+#endif
+
+
+// scalar check of a single position; a superset of the filter COND
+template <unsigned K>
+static inline bool filter_scan_match(const upx_byte *p)
+{
+    if ((K & FILTER_SCAN_E8E9) == FILTER_SCAN_E8E9) {
+        if ((p[0] & 0xfe) == 0xe8)
+            return true;
+    }
+    else if ((K & FILTER_SCAN_E8) && p[0] == 0xe8)
+        return true;
+    else if ((K & FILTER_SCAN_E9) && p[0] == 0xe9)
+        return true;
+    if ((K & FILTER_SCAN_JCC) && p[-1] == 0x0f && (p[0] & 0xf0) == 0x80)
+        return true;
+    if ((K & FILTER_SCAN_JCC_SWAPPED) && p[0] == 0x0f && (p[-1] & 0xf0) == 0x80)
+        return true;
+    return false;
+}
+
+
+// return the index of the first match in p[0 .. n-1], or n
+template <unsigned K>
+static inline size_t filter_scan_n(const upx_byte *p, size_t n)
+{
+    size_t i = 0;
+#if defined(WITH_FILTER_SCAN_SSE2)
+    const __m128i hi = _mm_set1_epi8((char) 0xf0);
+    const __m128i op = _mm_set1_epi8((char) (K == FILTER_SCAN_E9 ? 0xe9 : 0xe8));
+    const __m128i op_mask = _mm_set1_epi8((char) ((K & 3) == 3 ? 0xfe : 0xff));
+    for ( ; i + 16 <= n; i += 16)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i *) (p + i));
+        __m128i m = _mm_setzero_si128();
+        if (K & FILTER_SCAN_E8E9)
+            m = _mm_cmpeq_epi8(_mm_and_si128(v, op_mask), op);
+        if (K & (FILTER_SCAN_JCC | FILTER_SCAN_JCC_SWAPPED))
+        {
+            const __m128i w = _mm_loadu_si128((const __m128i *) (p + i - 1));
+            const __m128i x0f = _mm_set1_epi8(0x0f);
+            const __m128i x80 = _mm_set1_epi8((char) 0x80);
+            if (K & FILTER_SCAN_JCC)
+                m = _mm_or_si128(m, _mm_and_si128(_mm_cmpeq_epi8(w, x0f),
+                                    _mm_cmpeq_epi8(_mm_and_si128(v, hi), x80)));
+            if (K & FILTER_SCAN_JCC_SWAPPED)
+                m = _mm_or_si128(m, _mm_and_si128(_mm_cmpeq_epi8(v, x0f),
+                                    _mm_cmpeq_epi8(_mm_and_si128(w, hi), x80)));
+        }
+        const unsigned mask = (unsigned) _mm_movemask_epi8(m);
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+#elif defined(WITH_FILTER_SCAN_NEON)
+    const uint8x16_t hi = vdupq_n_u8(0xf0);
+    const uint8x16_t op = vdupq_n_u8(K == FILTER_SCAN_E9 ? 0xe9 : 0xe8);
+    const uint8x16_t op_mask = vdupq_n_u8((K & 3) == 3 ? 0xfe : 0xff);
+    for ( ; i + 16 <= n; i += 16)
+    {
+        const uint8x16_t v = vld1q_u8(p + i);
+        uint8x16_t m = vdupq_n_u8(0);
+        if (K & FILTER_SCAN_E8E9)
+            m = vceqq_u8(vandq_u8(v, op_mask), op);
+        if (K & (FILTER_SCAN_JCC | FILTER_SCAN_JCC_SWAPPED))
+        {
+            const uint8x16_t w = vld1q_u8(p + i - 1);
+            const uint8x16_t x0f = vdupq_n_u8(0x0f);
+            const uint8x16_t x80 = vdupq_n_u8(0x80);
+            if (K & FILTER_SCAN_JCC)
+                m = vorrq_u8(m, vandq_u8(vceqq_u8(w, x0f), vceqq_u8(vandq_u8(v, hi), x80)));
+            if (K & FILTER_SCAN_JCC_SWAPPED)
+                m = vorrq_u8(m, vandq_u8(vceqq_u8(v, x0f), vceqq_u8(vandq_u8(w, hi), x80)));
+        }
+        // narrow to 4 bits per byte
+        const uint64_t mask = vget_lane_u64(
+            vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+        if (mask)
+            return i + (__builtin_ctzll(mask) >> 2);
+    }
+#endif
+    for ( ; i < n; i++)
+        if (filter_scan_match<K>(p + i))
+            return i;
+    return n;
+}
+
+
+// index version: first candidate in [x, end), or end; x itself if x >= end
+template <unsigned K>
+static inline unsigned filter_scan(const upx_byte *b, unsigned x, unsigned end)
+{
+    if (x >= end)
+        return x;
+    if ((K & (FILTER_SCAN_JCC | FILTER_SCAN_JCC_SWAPPED)) && x == 0)
+        return 0;   // there is no b[-1]; let COND decide
+    return x + (unsigned) filter_scan_n<K>(b + x, end - x);
+}
+
+// pointer version for the "naive" filters which never look at p[-1]
+template <unsigned K, class T>
+static inline T *filter_scan_ptr(T *p, T *p_end)
+{
+    COMPILE_TIME_ASSERT((K & ~FILTER_SCAN_E8E9) == 0)
+    if (p >= p_end)
+        return p;
+    return p + filter_scan_n<K>(p, (size_t) (p_end - p));
+}
+
+/* vim:set ts=4 sw=4 et: */
@@ -28,6 +28,8 @@
 
 #include "conf.h"
 #include "filter.h"
+#include "mem.h"
+#include <chrono>
 
 static unsigned
 umin(unsigned const a, unsigned const b)
@@ -46,6 +48,7 @@ umin(unsigned const a, unsigned const b)
 **************************************************************************/
 
 #include "filter/getcto.h"
+#include "filter/scan.h"
 
 
 /*************************************************************************
@@ -66,27 +69,33 @@ umin(unsigned const a, unsigned const b)
 **************************************************************************/
 
 #define COND(b,x)               (b[x] == 0xe8)
+#define SCAN(b,x,end)           filter_scan<FILTER_SCAN_E8>(b,x,end)
 #define F                       f_cto32_e8_bswap_le
 #define U                       u_cto32_e8_bswap_le
 #include "filter/cto.h"
 #define F                       s_cto32_e8_bswap_le
 #include "filter/cto.h"
+#undef SCAN
 #undef COND
 
 #define COND(b,x)               (b[x] == 0xe9)
+#define SCAN(b,x,end)           filter_scan<FILTER_SCAN_E9>(b,x,end)
 #define F                       f_cto32_e9_bswap_le
 #define U                       u_cto32_e9_bswap_le
 #include "filter/cto.h"
 #define F                       s_cto32_e9_bswap_le
 #include "filter/cto.h"
+#undef SCAN
 #undef COND
 
 #define COND(b,x)               (b[x] == 0xe8 || b[x] == 0xe9)
+#define SCAN(b,x,end)           filter_scan<FILTER_SCAN_E8E9>(b,x,end)
 #define F                       f_cto32_e8e9_bswap_le
 #define U                       u_cto32_e8e9_bswap_le
 #include "filter/cto.h"
 #define F                       s_cto32_e8e9_bswap_le
 #include "filter/cto.h"
+#undef SCAN
 #undef COND
 
 
@@ -95,11 +104,13 @@ umin(unsigned const a, unsigned const b)
 **************************************************************************/
 
 #define COND(b,x,lastcall) (b[x] == 0xe8 || b[x] == 0xe9)
+#define SCAN(b,x,end)      filter_scan<FILTER_SCAN_E8E9>(b,x,end)
 #define F                       f_ctoj32_e8e9_bswap_le
 #define U                       u_ctoj32_e8e9_bswap_le
 #include "filter/ctoj.h"
 #define F                       s_ctoj32_e8e9_bswap_le
 #include "filter/ctoj.h"
+#undef SCAN
 #undef COND
 
 
@@ -110,11 +121,15 @@ umin(unsigned const a, unsigned const b)
 #define COND1(b,x)     (b[x] == 0xe8 || b[x] == 0xe9)
 #define COND2(b,x,lc)  (lc!=(x) && 0xf==b[(x)-1] && 0x80<=b[x] && b[x]<=0x8f)
 #define COND(b,x,lc,id) (COND1(b,x) || ((9<=(0xf&(id))) && COND2(b,x,lc)))
+#define SCAN(b,x,end,id) ((9<=(0xf&(id))) \
+    ? filter_scan<FILTER_SCAN_E8E9 | FILTER_SCAN_JCC>(b,x,end) \
+    : filter_scan<FILTER_SCAN_E8E9>(b,x,end))
 #define F                       f_ctok32_e8e9_bswap_le
 #define U                       u_ctok32_e8e9_bswap_le
 #include "filter/ctok.h"
 #define F                       s_ctok32_e8e9_bswap_le
 #include "filter/ctok.h"
+#undef SCAN
 #undef COND
 #undef COND2
 #undef COND1
@@ -135,6 +150,8 @@ umin(unsigned const a, unsigned const b)
     (COND1(which,b,x) || COND2(which,b,lastcall,x,(x)-1, x   ))
 #define CONDU(which,b,x,lastcall) \
     (COND1(which,b,x) || COND2(which,b,lastcall,x, x   ,(x)-1))
+#define SCANF(b,x,end) filter_scan<FILTER_SCAN_E8E9 | FILTER_SCAN_JCC>(b,x,end)
+#define SCANU(b,x,end) filter_scan<FILTER_SCAN_E8E9 | FILTER_SCAN_JCC_SWAPPED>(b,x,end)
 
 #define F                       f_ctojr32_e8e9_bswap_le
 #define U                       u_ctojr32_e8e9_bswap_le
@@ -142,6 +159,8 @@ umin(unsigned const a, unsigned const b)
 #define F                       s_ctojr32_e8e9_bswap_le
 #include "filter/ctojr.h"
 
+#undef SCANU
+#undef SCANF
 #undef CONDU
 #undef CONDF
 #undef COND2
@@ -263,4 +282,134 @@ const FilterImp::FilterEntry FilterImp::filters[] = {
 
 const int FilterImp::n_filters = TABLESIZE(filters);
 
+
+/*************************************************************************
+// test filter_scan()
+**************************************************************************/
+
+template <unsigned K>
+static unsigned filter_scan_ref(const upx_byte *b, unsigned x, unsigned end)
+{
+    for ( ; x < end; x++)
+        if (x == 0 ? (K & (FILTER_SCAN_JCC | FILTER_SCAN_JCC_SWAPPED)) != 0
+                   : filter_scan_match<K>(b + x))
+            break;
+    return x;
+}
+
+template <unsigned K>
+static bool filter_scan_check(const upx_byte *b, unsigned len)
+{
+    for (unsigned end = 0; end <= len; end += 1 + end / 4)
+        for (unsigned x = 0; x <= end + 2; x += 1 + x / 64)
+            if (filter_scan<K>(b, x, end) != filter_scan_ref<K>(b, x, end))
+                return false;
+    return true;
+}
+
+// x86 code like data with lots of candidates
+static void filter_test_data(upx_byte *b, unsigned len, unsigned r, unsigned n_ops = 8)
+{
+    static const upx_byte ops[8] = { 0xe8, 0xe9, 0x00, 0xff, 0x0f, 0x80, 0x85, 0x8f };
+    for (unsigned i = 0; i < len; i++)
+    {
+        r = r * 1103515245 + 12345;
+        b[i] = (r >> 28) < n_ops ? ops[(r >> 28)] : (upx_byte) (r >> 16);
+    }
+}
+
+TEST_CASE("filter_scan")
+{
+    MemBuffer mb(4096);
+    upx_byte *const b = mb;
+    filter_test_data(b, 4096, 1);
+    CHECK(filter_scan_check<FILTER_SCAN_E8>(b, 300));
+    CHECK(filter_scan_check<FILTER_SCAN_E9>(b, 300));
+    CHECK(filter_scan_check<FILTER_SCAN_E8E9>(b, 300));
+    CHECK(filter_scan_check<FILTER_SCAN_E8E9 | FILTER_SCAN_JCC>(b, 300));
+    CHECK(filter_scan_check<FILTER_SCAN_E8E9 | FILTER_SCAN_JCC_SWAPPED>(b, 300));
+    // sparse candidates
+    memset(b, 0x90, 4096);
+    b[77] = 0xe9; b[1000] = 0xe8; b[2047] = 0x0f; b[2048] = 0x8f; b[3000] = 0x84; b[3001] = 0x0f;
+    CHECK(filter_scan_check<FILTER_SCAN_E8>(b, 4096));
+    CHECK(filter_scan_check<FILTER_SCAN_E9>(b, 4096));
+    CHECK(filter_scan_check<FILTER_SCAN_E8E9 | FILTER_SCAN_JCC>(b, 4096));
+    CHECK(filter_scan_check<FILTER_SCAN_E8E9 | FILTER_SCAN_JCC_SWAPPED>(b, 4096));
+    CHECK(filter_scan<FILTER_SCAN_E8E9 | FILTER_SCAN_JCC>(b, 1001, 4096) == 2048);
+    CHECK(filter_scan<FILTER_SCAN_E8E9 | FILTER_SCAN_JCC_SWAPPED>(b, 2049, 4096) == 3001);
+    CHECK(filter_scan_ptr<FILTER_SCAN_E8>(b, b + 4096) == b + 1000);
+
+    // all x86 calltrick filters must still round-trip; random jcc
+    // patterns can legitimately confuse ctojr, so use calls only
+    MemBuffer orig(4096);
+    for (int id = 0x01; id <= 0x87; id++)
+    {
+        if (!Filter::isValidFilter(id) || (id >= 0x50 && id < 0x80))
+            continue;
+        for (unsigned len = 16; len <= 4096; len *= 4)
+        {
+            filter_test_data(orig, len, id, 4);
+            memcpy(b, orig, len);
+            Filter f(1);
+            f.init(id, 0x1000);
+            if (!f.filter(b, len))
+                continue;
+            f.unfilter(b, len);
+            CHECK(memcmp(b, orig, len) == 0);
+        }
+    }
+}
+
+// throughput benchmark; enabled with UPX_DEBUG_DOCTEST_VERBOSE=2
+// uses the code of the running executable when possible
+TEST_CASE("filter_scan benchmark")
+{
+    const char *e = getenv("UPX_DEBUG_DOCTEST_VERBOSE");
+    if (e == nullptr || strcmp(e, "2") != 0)
+        return;
+    const unsigned size = 1024 * 1024;
+    MemBuffer mb(size);
+    MemBuffer work(size);
+    unsigned len = 0;
+#if (ACC_ARCH_AMD64 || ACC_ARCH_I386) && defined(__linux__)
+    FILE *fp = fopen("/proc/self/exe", "rb");
+    if (fp)
+    {
+        // skip the headers, then take up to 1 MiB of mostly code
+        if (fseek(fp, 4096, SEEK_SET) == 0)
+            len = (unsigned) fread(mb, 1, size, fp);
+        fclose(fp);
+    }
+#endif
+    if (len < 65536)
+    {
+        filter_test_data(mb, size, 1);
+        len = size;
+    }
+    static const int ids[] = { 0x13, 0x16, 0x26, 0x36, 0x49, 0x80, 0x86 };
+    for (int id : ids)
+    {
+        // filters work on blocks that are much smaller than a whole file
+        const unsigned block = 32768;
+        unsigned calls = 0, loops = 0;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int loop = 0; loop < 16; loop++)
+            for (unsigned off = 0; off + block <= len; off += block)
+            {
+                memcpy(work, mb + off, block);
+                Filter f(1);
+                f.init(id, 0);
+                if (f.filter(work, block))
+                {
+                    f.unfilter(work, block);
+                    calls += f.calls;
+                }
+                loops++;
+            }
+        const std::chrono::duration<double> d = std::chrono::steady_clock::now() - t0;
+        printf("filter 0x%02x %8.1f MiB/s  (%u calls)\n", id,
+               loops * (block / 1048576.0) / (d.count() > 0 ? d.count() : 1e-9), calls);
+    }
+}
+
 /* vim:set ts=4 sw=4 et: */
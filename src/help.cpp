@@ -197,6 +197,7 @@ void show_help(int verbose)
     con_fprintf(f,
                 "  -q     be quiet                          -v    be verbose\n"
                 "  -oFILE write output to 'FILE'\n"
+                "  -jN    process N files in parallel [0: one per CPU]\n"
                 //"  -f     force overwrite of output files and compression of suspicious files\n"
                 "  -f     force compression of suspicious files\n"
                 "%s%s"
@@ -215,8 +216,14 @@ void show_help(int verbose)
         fg = con_fg(f,fg);
         con_fprintf(f,
                     "  --lzma              try LZMA [slower but tighter than NRV]\n"
+                    "  --lzma-tune         tune the LZMA settings for each file [slower]\n"
+                    "  --lz4               use LZ4 [fastest decompression, linux/amd64]\n"
+                    "  --zstd[=N]          use Zstandard at level N [linux/amd64]\n"
+                    "  --deflate           use Deflate [small & fast stub, linux/amd64]\n"
                     "  --brute             try all available compression methods & filters [slow]\n"
                     "  --ultra-brute       try even more compression variants [very slow]\n"
+                    "  --brute=smart[=K]   only try the K (4) most promising of these [faster]\n"
+                    "  --threads=N         use N threads for --brute [0: one per CPU]\n"
                     "\n");
         fg = con_fg(f,FG_YELLOW);
         con_fprintf(f,"Backup options:\n");
@@ -293,6 +300,11 @@ void show_help(int verbose)
         fg = con_fg(f,fg);
         con_fprintf(f,
                     "  --preserve-build-id     copy .gnu.note.build-id to compressed output\n"
+                    "  --lazy                  decompress pages on first use [linux/amd64]\n"
+                    "  --cache-dir=DIR         keep decompressed program in DIR [linux/amd64]\n"
+                    "  --split-blocks=N        unpack in N parts on several CPUs [linux/amd64]\n"
+                    "  --hugepage-text         use 2 MiB pages for code [linux/amd64]\n"
+                    "  --hot-pages=FILE        keep pages listed in FILE uncompressed [linux/amd64]\n"
                     "\n");
     }
 
@@ -51,6 +51,55 @@ static void internal_error(const char *format, ...) {
     throwInternalError(buf);
 }
 
+/*************************************************************************
+// name hash tables; open addressing with linear probing, the capacity
+// is a power of 2 and at least twice the number of entries
+**************************************************************************/
+
+static unsigned name_hash(const char *name) {
+    unsigned h = 2166136261u; // FNV-1a
+    for (; *name; name++)
+        h = (h ^ (unsigned char) *name) * 16777619u;
+    return h;
+}
+
+template <class T>
+static T *hash_find(T *const *table, unsigned capacity, const char *name) {
+    if (capacity == 0)
+        return nullptr;
+    for (unsigned i = name_hash(name);; i++) {
+        T *item = table[i & (capacity - 1)];
+        if (item == nullptr || strcmp(item->name, name) == 0)
+            return item;
+    }
+}
+
+template <class T>
+static void hash_put(T **table, unsigned capacity, T *item) {
+    unsigned i = name_hash(item->name);
+    while (table[i & (capacity - 1)] != nullptr)
+        i++;
+    table[i & (capacity - 1)] = item;
+}
+
+// items[nitems - 1] is the new entry
+template <class T>
+static void hash_insert(T ***table, unsigned *capacity, T *const *items, unsigned nitems) {
+    if (2 * nitems <= *capacity) {
+        hash_put(*table, *capacity, items[nitems - 1]);
+        return;
+    }
+    unsigned new_capacity = *capacity ? *capacity : 64;
+    while (2 * nitems > new_capacity)
+        new_capacity *= 2;
+    free(*table);
+    *table = static_cast<T **>(calloc(new_capacity, sizeof(T *)));
+    assert(*table != nullptr);
+    *capacity = new_capacity;
+    for (unsigned ic = 0; ic < nitems; ic++)
+        hash_put(*table, new_capacity, items[ic]);
+}
+
 /*************************************************************************
 // Section
 **************************************************************************/
@@ -118,6 +167,8 @@ ElfLinker::~ElfLinker() {
     for (ic = 0; ic < nrelocations; ic++)
         delete relocations[ic];
     free(relocations);
+    free(section_hash);
+    free(symbol_hash);
 }
 
 void ElfLinker::init(const void *pdata_v, int plen, unsigned pxtra) {
@@ -159,8 +210,10 @@ void ElfLinker::init(const void *pdata_v, int plen, unsigned pxtra) {
     output = new upx_byte[inputlen ? (inputlen + pxtra) : 0x4000];
     outputlen = 0;
 
+    if (preprocessObjectTable())
+        addLoader("*UND*");
     // FIXME: bad compare when either symbols or relocs are absent
-    if ((int) strlen("Sections:\n"
+    else if ((int) strlen("Sections:\n"
                      "SYMBOL TABLE:\n"
                      "RELOCATION RECORDS FOR ") < inputlen) {
         char const *const eof = (char const *) &input[inputlen];
@@ -183,6 +236,78 @@ void ElfLinker::init(const void *pdata_v, int plen, unsigned pxtra) {
     }
 }
 
+/*************************************************************************
+// binary object info
+//
+// Stubs carry either the "objdump -htr" text that is parsed below or a
+// binary table written by src/stub/scripts/objinfo.py. All table values
+// are LE32 unless noted; names and types are offsets into the strings:
+//   nsections, nsymbols, nrelocations, strings_size
+//   nsections    x { name, size, offset, p2align }
+//   nsymbols     x { name, section, LE64 value }
+//   nrelocations x { section, offset, type, symbol, LE64 add }
+//   strings (NUL terminated)
+//   LE32 offset of the table, "UPX#OBJ1"
+// A symbol section index of nsections means *ABS*, nsections+1 *UND*.
+**************************************************************************/
+
+static const char *objinfo_string(const upx_byte *strings, unsigned strings_size, unsigned off) {
+    if (off >= strings_size)
+        throwBadLoader();
+    return (const char *) strings + off;
+}
+
+bool ElfLinker::preprocessObjectTable() {
+    static const char magic[8] = {'U', 'P', 'X', '#', 'O', 'B', 'J', '1'};
+    if (inputlen < 12 + 16 || memcmp(input + inputlen - 8, magic, 8) != 0)
+        return false;
+    const unsigned table_end = inputlen - 12;
+    const unsigned table_pos = get_le32(input + table_end);
+    if (table_pos > table_end || table_end - table_pos < 16)
+        throwBadLoader();
+    const upx_byte *p = input + table_pos;
+    const unsigned ns = get_le32(p);
+    const unsigned nsym = get_le32(p + 4);
+    const unsigned nrel = get_le32(p + 8);
+    const unsigned strings_size = get_le32(p + 12);
+    p += 16;
+    const upx_uint64_t table_size = 16 + 16 * (upx_uint64_t) ns + 16 * (upx_uint64_t) nsym +
+                                    24 * (upx_uint64_t) nrel + strings_size;
+    if (table_size != table_end - table_pos || strings_size == 0 || input[table_end - 1] != 0)
+        throwBadLoader();
+    const upx_byte *const strings = input + table_end - strings_size;
+
+    for (unsigned ic = 0; ic < ns; ic++, p += 16) {
+        const char *name = objinfo_string(strings, strings_size, get_le32(p));
+        const unsigned size = get_le32(p + 4);
+        const unsigned offset = get_le32(p + 8);
+        if (offset > table_pos || size > table_pos - offset)
+            throwBadLoader();
+        addSection(name, input + offset, size, get_le32(p + 12));
+    }
+    addSection("*ABS*", nullptr, 0, 0);
+    addSection("*UND*", nullptr, 0, 0);
+
+    for (unsigned ic = 0; ic < nsym; ic++, p += 16) {
+        const char *name = objinfo_string(strings, strings_size, get_le32(p));
+        const unsigned section = get_le32(p + 4);
+        if (section > ns + 1)
+            throwBadLoader();
+        addSymbol(name, sections[section]->name, get_le64(p + 8));
+    }
+
+    for (unsigned ic = 0; ic < nrel; ic++, p += 24) {
+        const unsigned section = get_le32(p);
+        const char *type = objinfo_string(strings, strings_size, get_le32(p + 8));
+        const unsigned symbol = get_le32(p + 12);
+        if (section >= ns || symbol >= nsymbols)
+            throwBadLoader();
+        addRelocation(sections[section]->name, get_le32(p + 4), type, symbols[symbol]->name,
+                      get_le64(p + 16));
+    }
+    return true;
+}
+
 void ElfLinker::preprocessSections(char *start, char const *end) {
     char *nextl;
     for (nsections = 0; start < end; start = 1 + nextl) {
@@ -297,18 +422,18 @@ void ElfLinker::preprocessRelocations(char *start, char const *end) {
 }
 
 ElfLinker::Section *ElfLinker::findSection(const char *name, bool fatal) const {
-    for (unsigned ic = 0; ic < nsections; ic++)
-        if (strcmp(sections[ic]->name, name) == 0)
-            return sections[ic];
+    Section *section = hash_find(section_hash, section_hash_capacity, name);
+    if (section != nullptr)
+        return section;
     if (fatal)
         internal_error("unknown section %s\n", name);
     return nullptr;
 }
 
 ElfLinker::Symbol *ElfLinker::findSymbol(const char *name, bool fatal) const {
-    for (unsigned ic = 0; ic < nsymbols; ic++)
-        if (strcmp(symbols[ic]->name, name) == 0)
-            return symbols[ic];
+    Symbol *symbol = hash_find(symbol_hash, symbol_hash_capacity, name);
+    if (symbol != nullptr)
+        return symbol;
     if (fatal)
         internal_error("unknown symbol %s\n", name);
     return nullptr;
@@ -329,6 +454,7 @@ ElfLinker::Section *ElfLinker::addSection(const char *sname, const void *sdata,
     assert(findSection(sname, false) == nullptr);
     Section *sec = new Section(sname, sdata, slen, p2align);
     sections[nsections++] = sec;
+    hash_insert(&section_hash, &section_hash_capacity, sections, nsections);
     return sec;
 }
 
@@ -344,6 +470,7 @@ ElfLinker::Symbol *ElfLinker::addSymbol(const char *name, const char *section,
     assert(findSymbol(name, false) == nullptr);
     Symbol *sym = new Symbol(name, findSection(section), offset);
     symbols[nsymbols++] = sym;
+    hash_insert(&symbol_hash, &symbol_hash_capacity, symbols, nsymbols);
     return sym;
 }
 
@@ -903,4 +1030,72 @@ void ElfLinkerX86::relocate1(const Relocation *rel, upx_byte *location, upx_uint
         super::relocate1(rel, location, value, type);
 }
 
+
+/*************************************************************************
+//
+**************************************************************************/
+
+TEST_CASE("ElfLinker object table") {
+    struct TestLinker final : public ElfLinker {
+        virtual void relocate1(const Relocation *, upx_byte *location, upx_uint64_t value,
+                               const char *type) override {
+            assert(strcmp(type, "R_386_32") == 0);
+            set_le32(location, get_le32(location) + (unsigned) value);
+        }
+        void link() { relocate(); }
+    };
+    static const char text[] = "\x90\x90\x90\x90\xc3\x00\x00\x00"
+                               "file format elf32-i386\n\n"
+                               "Sections:\n"
+                               "Idx Name Size VMA LMA File off Algn Flags\n"
+                               "  0 ENTRY 00000005 00000000 00000000 00000000 2**0 CONTENTS\n"
+                               "SYMBOL TABLE:\n"
+                               "00000000 l    d  ENTRY\t00000000 ENTRY\n"
+                               "00000000         *UND*\t00000000 foo\n\n"
+                               "RELOCATION RECORDS FOR [ENTRY]:\n"
+                               "OFFSET TYPE VALUE\n"
+                               "00000001 R_386_32 foo+0x00000004\n";
+    // the same as binary table
+    upx_byte table[8 + 16 + 16 + 2 * 16 + 24 + 20 + 12];
+    memcpy(table, text, 8);
+    upx_byte *p = table + 8;
+    const unsigned v[] = {1, 2, 1, 20, 0, 5, 0, 0, 0, 0};
+    for (unsigned i = 0; i < 10; i++, p += 4)
+        set_le32(p, v[i]);
+    set_le64(p, 0), p += 8; // symbol ENTRY
+    set_le32(p, 6), set_le32(p + 4, 2), set_le64(p + 8, 0xdeaddead), p += 16;
+    set_le32(p, 0), set_le32(p + 4, 1), set_le32(p + 8, 10), set_le32(p + 12, 1);
+    set_le64(p + 16, 4), p += 24;
+    memcpy(p, "ENTRY\0foo\0R_386_32\0\0", 20), p += 20;
+    set_le32(p, 8), memcpy(p + 4, "UPX#OBJ1", 8), p += 12;
+    CHECK(p == table + sizeof(table));
+
+    for (int format = 0; format < 2; format++) {
+        TestLinker linker;
+        if (format == 0)
+            linker.init(text, sizeof(text) - 1);
+        else
+            linker.init(table, sizeof(table));
+        // many more sections for the hash tables
+        for (unsigned i = 0; i < 200; i++) {
+            char name[16];
+            upx_safe_snprintf(name, sizeof(name), "S%u", i);
+            linker.addSection(name, text, i % 7, 0);
+        }
+        for (unsigned i = 0; i < 200; i++) {
+            char name[16];
+            upx_safe_snprintf(name, sizeof(name), "S%u", i);
+            CHECK(linker.getSectionSize(name) == (int) (i % 7));
+        }
+        CHECK(linker.getSectionSize("ENTRY") == 5);
+        linker.addLoader("ENTRY");
+        linker.defineSymbol("foo", 0x1000);
+        linker.link();
+        int len = 0;
+        const upx_byte *loader = linker.getLoader(&len);
+        CHECK(len == 5);
+        CHECK(get_le32(loader + 1) == 0xc3909090u + 0x1004);
+    }
+}
+
 /* vim:set ts=4 sw=4 et: */
@@ -61,9 +61,16 @@ protected:
     unsigned nrelocations = 0;
     unsigned nrelocations_capacity = 0;
 
+    // hash tables for findSection() and findSymbol()
+    Section **section_hash = nullptr;
+    unsigned section_hash_capacity = 0;
+    Symbol **symbol_hash = nullptr;
+    unsigned symbol_hash_capacity = 0;
+
     bool reloc_done = false;
 
 protected:
+    bool preprocessObjectTable();
     void preprocessSections(char *start, char const *end);
     void preprocessSymbols(char *start, char const *end);
     void preprocessRelocations(char *start, char const *end);
@@ -403,6 +403,9 @@ static int do_option(int optc, const char *arg) {
     case 'L':
         set_cmd(CMD_LICENSE);
         break;
+    case 'j':
+        getoptvar(&opt->jobs, 0, 256, arg);
+        break;
     case 'o':
         set_output_name(mfx_optarg, 1);
         break;
@@ -454,6 +457,25 @@ static int do_option(int optc, const char *arg) {
         if (M_IS_LZMA(opt->method))
             opt->method = -1;
         break;
+    case 725:
+        if (!set_method(M_LZ4, -1))
+            e_method(M_LZ4, opt->level);
+        break;
+    case 726: {
+        // --zstd=N also sets the compression level
+        int level = -1;
+        if (mfx_optarg && mfx_optarg[0])
+            getoptvar(&level, 1, 10, arg);
+        if (!set_method(M_ZSTD, level))
+            e_method(M_ZSTD, level);
+    } break;
+    case 727:
+        opt->lzma_tune = true;
+        break;
+    case 728:
+        if (!set_method(M_DEFLATE, -1))
+            e_method(M_DEFLATE, opt->level);
+        break;
     case 723:
         opt->prefer_ucl = false;
         break;
@@ -475,10 +497,19 @@ static int do_option(int optc, const char *arg) {
             e_method(opt->method, optc);
         break;
 
-    case 902: // --ultra-brute
+    case 902: // --ultra-brute[=smart[=K]]
         opt->ultra_brute = true;
         /* fallthrough */
-    case 901: // --brute
+    case 901: // --brute[=smart[=K]]
+        if (mfx_optarg && strncmp(mfx_optarg, "smart", 5) == 0 &&
+            (mfx_optarg[5] == 0 || mfx_optarg[5] == '=')) {
+            opt->brute_smart = 4;
+            if (mfx_optarg[5] == '=') {
+                mfx_optarg += 6;
+                getoptvar(&opt->brute_smart, 1, 999, arg);
+            }
+        } else if (mfx_optarg && mfx_optarg[0])
+            e_optarg(arg);
         opt->all_methods = true;
         if (opt->all_methods_use_lzma != -1)
             opt->all_methods_use_lzma = 1;
@@ -537,6 +568,9 @@ static int do_option(int optc, const char *arg) {
     case 528:
         opt->preserve_timestamp = false;
         break;
+    case 530: // --threads=
+        getoptvar(&opt->threads, 0, 256, arg);
+        break;
     // compression settings
     case 520: // --small
         if (opt->small < 0)
@@ -759,6 +793,26 @@ static int do_option(int optc, const char *arg) {
     case 677:
         opt->o_unix.force_pie = true;
         break;
+    case 678:
+        opt->o_unix.lazy = true;
+        break;
+    case 679:
+        // absolute, and must fit the space in the stub
+        if (!mfx_optarg || mfx_optarg[0] != '/' || strlen(mfx_optarg) >= 128)
+            e_optarg(arg);
+        opt->o_unix.cache_dir = mfx_optarg;
+        break;
+    case 680:
+        getoptvar(&opt->o_unix.split_blocks, 2u, 128u, arg);
+        break;
+    case 681:
+        opt->o_unix.hugepage_text = true;
+        break;
+    case 682:
+        if (!mfx_optarg || !mfx_optarg[0])
+            e_optarg(arg);
+        opt->o_unix.hot_pages = mfx_optarg;
+        break;
 
     case '\0':
         return -1;
@@ -779,8 +833,8 @@ int main_get_options(int argc, char **argv) {
     static const struct mfx_option longopts[] = {
         // commands
         {"best", 0x10, N, 900},        // compress best
-        {"brute", 0x10, N, 901},       // compress best, brute force
-        {"ultra-brute", 0x10, N, 902}, // compress best, brute force
+        {"brute", 0x12, N, 901},       // compress best, brute force
+        {"ultra-brute", 0x12, N, 902}, // compress best, brute force
         {"decompress", 0, N, 'd'},     // decompress
         {"fast", 0x10, N, '1'},        // compress faster
         {"fileinfo", 0x10, N, 909},    // display info about file
@@ -796,11 +850,13 @@ int main_get_options(int argc, char **argv) {
         {"force", 0, N, 'f'},          // force overwrite of output files
         {"force-compress", 0, N, 'f'}, //   and compression of suspicious files
         {"info", 0, N, 'i'},           // info mode
+        {"jobs", 0x21, N, 'j'},        // -j N
         {"no-env", 0x10, N, 519},      // no environment var
         {"no-mode", 0x10, N, 526},     // do not preserve mode (permissions)
         {"no-owner", 0x10, N, 527},    // do not preserve ownership
         {"no-progress", 0, N, 516},    // no progress bar
         {"no-time", 0x10, N, 528},     // do not preserve timestamp
+        {"threads", 0x31, N, 530},     // --threads=
         {"output", 0x21, N, 'o'},
         {"quiet", 0, N, 'q'},  // quiet mode
         {"silent", 0, N, 'q'}, // quiet mode
@@ -847,6 +903,10 @@ int main_get_options(int argc, char **argv) {
         {"nrv2e", 0x10, N, 705},   // --nrv2e
         {"lzma", 0x10, N, 721},    // --lzma
         {"no-lzma", 0x10, N, 722}, // disable all_methods_use_lzma
+        {"lz4", 0x10, N, 725},     // --lz4
+        {"zstd", 0x12, N, 726},    // --zstd[=level]
+        {"deflate", 0x10, N, 728}, // --deflate
+        {"lzma-tune", 0x10, N, 727},
         {"prefer-nrv", 0x10, N, 723},
         {"prefer-ucl", 0x10, N, 724},
         // compression settings
@@ -907,6 +967,11 @@ int main_get_options(int argc, char **argv) {
         {"preserve-build-id", 0, N, 675},
         {"android-shlib", 0, N, 676},
         {"force-pie", 0, N, 677},
+        {"lazy", 0x10, N, 678},
+        {"cache-dir", 0x31, N, 679},     // --cache-dir=
+        {"split-blocks", 0x31, N, 680},  // --split-blocks=
+        {"hugepage-text", 0x10, N, 681},
+        {"hot-pages", 0x31, N, 682},     // --hot-pages=
         // watcom/le
         {"le", 0x10, N, 620}, // produce LE output
                               // win32/pe
@@ -951,15 +1016,17 @@ void main_get_envoptions() {
     static const struct mfx_option longopts[] = {
         // commands
         {"best", 0x10, N, 900},        // compress best
-        {"brute", 0x10, N, 901},       // compress best, brute force
-        {"ultra-brute", 0x10, N, 902}, // compress best, brute force
+        {"brute", 0x12, N, 901},       // compress best, brute force
+        {"ultra-brute", 0x12, N, 902}, // compress best, brute force
         {"fast", 0x10, N, '1'},        // compress faster
 
         // options
         {"info", 0, N, 'i'},        // info mode
+        {"jobs", 0x21, N, 'j'},     // -j N
         {"no-progress", 0, N, 516}, // no progress bar
         {"quiet", 0, N, 'q'},       // quiet mode
         {"silent", 0, N, 'q'},      // quiet mode
+        {"threads", 0x31, N, 530},  // --threads=
         {"verbose", 0, N, 'v'},     // verbose mode
 
         // debug options
@@ -997,6 +1064,10 @@ void main_get_envoptions() {
         {"nrv2e", 0x10, N, 705},   // --nrv2e
         {"lzma", 0x10, N, 721},    // --lzma
         {"no-lzma", 0x10, N, 722}, // disable all_methods_use_lzma
+        {"lz4", 0x10, N, 725},     // --lz4
+        {"zstd", 0x12, N, 726},    // --zstd[=level]
+        {"deflate", 0x10, N, 728}, // --deflate
+        {"lzma-tune", 0x10, N, 727},
         {"prefer-nrv", 0x10, N, 723},
         {"prefer-ucl", 0x10, N, 724},
         // compression settings
@@ -1220,6 +1291,8 @@ int upx_main(int argc, char *argv[]) {
     set_term(stdout);
     if (do_files(i, argc, argv) != 0)
         return exit_code;
+    if (opt->debug.debug_level)
+        upx_compress_print_stats();
 
     if (gitrev[0]) {
         bool warn = true;
@@ -28,6 +28,7 @@
 
 #include "conf.h"
 #include "mem.h"
+#include <atomic>
 
 
 /*************************************************************************
@@ -187,7 +188,8 @@ void MemBuffer::fill(unsigned off, unsigned len, int value)
 #define MAGIC1(p)   (PTR(p) ^ 0xfefdbeeb)
 #define MAGIC2(p)   (PTR(p) ^ 0xfefdbeeb ^ 0x80024001)
 
-unsigned MemBuffer::global_alloc_counter = 0;
+// MemBuffers may get allocated by several threads - see parallel.cpp
+static std::atomic<unsigned> global_alloc_counter(0);
 
 
 void MemBuffer::checkState() const
@@ -73,8 +73,6 @@ private:
     unsigned char *b;
     unsigned b_size;
 
-    static unsigned global_alloc_counter;
-
     // disable copy, assignment and move assignment
     MemBuffer(const MemBuffer &) = delete;
     MemBuffer& operator= (const MemBuffer &) = delete;
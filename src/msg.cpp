@@ -34,7 +34,7 @@
 // we write all error messages to both stderr and stdout ?
 **************************************************************************/
 
-static int pr_need_nl = 0;
+static thread_local int pr_need_nl = 0;
 
 
 void printSetNl(int need_nl)
@@ -44,6 +44,12 @@ void printSetNl(int need_nl)
 
 void printClearLine(FILE *f)
 {
+    if (con_capture_active())
+    {
+        // no progress bar to clear - see UiPacker
+        printSetNl(0);
+        return;
+    }
     static char clear_line_msg[1+79+1+1];
     if (!clear_line_msg[0])
     {
@@ -65,6 +71,8 @@ void printClearLine(FILE *f)
 
 static void pr_print(bool c, const char *msg)
 {
+    if (con_capture_print(stderr, msg))
+        return;
     if (c && !opt->to_stdout)
         con_fprintf(stderr, "%s", msg);
     else
@@ -174,7 +182,7 @@ void printUnhandledException(const char *iname, const std::exception *e)
 // FIXME: should use colors and a consistent layout here
 **************************************************************************/
 
-static int info_header = 0;
+static thread_local int info_header = 0;
 
 
 static void info_print(const char *msg)
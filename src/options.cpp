@@ -55,6 +55,8 @@ void options_t::reset() {
 #elif 1 && defined(__linux__)
     o->console = CON_INIT;
 #endif
+    o->jobs = 1;
+    o->threads = 1;
     o->verbose = 2;
 
     o->win32_pe.compress_exports = 1;
@@ -68,7 +70,7 @@ void options_t::reset() {
 }
 
 static options_t global_options;
-options_t *opt = &global_options;
+thread_local options_t *opt = &global_options;
 
 /*************************************************************************
 //
@@ -122,6 +124,32 @@ TEST_CASE("getopt") {
         CHECK(opt->all_methods);
         CHECK(opt->all_methods_use_lzma == -1);
     }
+    SUBCASE("brute=smart") {
+        const char *a[] = {a0, "--brute=smart", nullptr};
+        CHECK(opt->brute_smart == 0);
+        test_options(a);
+        CHECK(opt->all_methods);
+        CHECK(opt->all_filters);
+        CHECK(opt->brute_smart > 0);
+    }
+    SUBCASE("brute=smart=K") {
+        const char *a[] = {a0, "--ultra-brute=smart=2", nullptr};
+        test_options(a);
+        CHECK(opt->ultra_brute);
+        CHECK(opt->brute_smart == 2);
+    }
+    SUBCASE("threads") {
+        const char *a[] = {a0, "--threads=4", nullptr};
+        CHECK(opt->threads == 1);
+        test_options(a);
+        CHECK(opt->threads == 4);
+    }
+    SUBCASE("jobs") {
+        const char *a[] = {a0, "-j", "3", nullptr};
+        CHECK(opt->jobs == 1);
+        test_options(a);
+        CHECK(opt->jobs == 3);
+    }
 
     opt = saved_opt;
 }
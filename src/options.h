@@ -57,12 +57,14 @@ struct options_t {
     int level;  // compression level 1..10
     int filter; // preferred filter from Packer::getFilters()
     bool ultra_brute;
+    int brute_smart;  // --brute=smart: only compress the N most promising candidates
     bool all_methods; // try all available compression methods ?
     int all_methods_use_lzma;
     bool all_filters; // try all available filters ?
     bool no_filter;   // force no filter
     bool prefer_ucl;  // prefer UCL
     bool exact;       // user requires byte-identical decompression
+    bool lzma_tune;   // tune the LZMA settings for each file
 
     // other options
     int backup;
@@ -70,6 +72,7 @@ struct options_t {
     int force;
     int info_mode;
     bool ignorewarn;
+    int jobs; // number of files to process in parallel; 0 means one per CPU
     bool no_env;
     bool no_progress;
     const char *output_name;
@@ -77,6 +80,7 @@ struct options_t {
     bool preserve_ownership;
     bool preserve_timestamp;
     int small;
+    int threads; // number of worker threads; 0 means one per CPU
     int verbose;
     bool to_stdout;
 
@@ -147,6 +151,11 @@ struct options_t {
         bool preserve_build_id; // copy the build-id to the compressed binary
         bool android_shlib;     // keep some ElfXX_Shdr for dlopen()
         bool force_pie;         // choose DF_1_PIE instead of is_shlib
+        bool lazy;              // decompress pages on first touch
+        const char *cache_dir;  // keep decompressed programs here
+        unsigned split_blocks;  // blocks per PT_LOAD, for threads in the stub
+        bool hugepage_text;     // 2 MiB pages for the decompressed PF_X
+        const char *hot_pages;  // file offsets of pages to keep uncompressed
     } o_unix;
     struct {
         bool le;
@@ -163,7 +172,9 @@ struct options_t {
     void reset();
 };
 
-extern struct options_t *opt;
+// The options of the current job. Each thread has its own pointer, so that
+// PackMaster can switch to a private copy without disturbing other threads.
+extern thread_local options_t *opt;
 
 #endif /* already included */
 
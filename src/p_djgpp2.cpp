@@ -75,12 +75,13 @@ const int *PackDjgpp2::getFilters() const
 }
 
 
-unsigned PackDjgpp2::findOverlapOverhead(const upx_bytep buf,
+unsigned PackDjgpp2::findOverlapOverhead(const PackHeader &ph_,
+                                         const upx_bytep buf,
                                          const upx_bytep tbuf,
                                          unsigned range,
                                          unsigned upper_limit) const
 {
-    unsigned o = super::findOverlapOverhead(buf, tbuf, range, upper_limit);
+    unsigned o = super::findOverlapOverhead(ph_, buf, tbuf, range, upper_limit);
     o = (o + 0x3ff) &~ 0x1ff;
     return o;
 }
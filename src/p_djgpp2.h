@@ -57,7 +57,8 @@ protected:
     virtual void handleStub(OutputFile *fo);
     virtual int readFileHeader();
 
-    virtual unsigned findOverlapOverhead(const upx_bytep buf,
+    virtual unsigned findOverlapOverhead(const PackHeader &ph_,
+                                         const upx_bytep buf,
                                          const upx_bytep tbuf,
                                          unsigned range = 0,
                                          unsigned upper_limit = ~0u) const;
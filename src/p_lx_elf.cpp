@@ -416,9 +416,10 @@ off_t PackLinuxElf32::pack3(OutputFile *fo, Filter &ft)
         if (x.size) {
             x.offset = get_te32(&phdri[k].p_offset) +
                        get_te32(&phdri[k].p_filesz);
-            packExtent(x, nullptr, fo);
+            planExtent(x, nullptr);
         }
     }
+    packPlannedExtents(fo);
     // write block end marker (uncompressed size 0)
     b_info hdr; memset(&hdr, 0, sizeof(hdr));
     set_le32(&hdr.sz_cpr, UPX_MAGIC_LE32);
@@ -539,9 +540,10 @@ off_t PackLinuxElf64::pack3(OutputFile *fo, Filter &ft)
         if (x.size) {
             x.offset = get_te64(&phdri[k].p_offset) +
                        get_te64(&phdri[k].p_filesz);
-            packExtent(x, nullptr, fo);
+            planExtent(x, nullptr);
         }
     }
+    packPlannedExtents(fo);
     // write block end marker (uncompressed size 0)
     b_info hdr; memset(&hdr, 0, sizeof(hdr));
     set_le32(&hdr.sz_cpr, UPX_MAGIC_LE32);
@@ -552,6 +554,16 @@ off_t PackLinuxElf64::pack3(OutputFile *fo, Filter &ft)
     set_te64(&elfout.phdr[C_TEXT].p_memsz,  sz_pack2 + lsize);
     if (0==xct_off) { // not shared library
         set_te64(&elfout.phdr[C_BASE].p_align, ((upx_uint64_t)0) - page_mask);
+        upx_uint64_t const hpage = 2 * 1024 * 1024;
+        if (opt->o_unix.hugepage_text && UPX_F_LINUX_ELF64_AMD == getFormat()
+        &&  0 == (get_te64(&elfout.phdr[C_BASE].p_vaddr) & (hpage - 1))) {
+            // The kernel places ET_DYN at a multiple of the largest .p_align,
+            // so that the PT_LOADs of a -pie program keep their offset
+            // from a 2 MiB boundary, and the stub can use huge pages.
+            // .p_vaddr must stay congruent to .p_offset (0) modulo .p_align;
+            // an ET_EXEC based elsewhere keeps the usual alignment.
+            set_te64(&elfout.phdr[C_BASE].p_align, hpage);
+        }
         elfout.phdr[C_BASE].p_paddr = elfout.phdr[C_BASE].p_vaddr;
         elfout.phdr[C_BASE].p_offset = 0;
         upx_uint64_t abrk = getbrk(phdri, e_phnum);
@@ -670,6 +682,9 @@ PackLinuxElf::addStubEntrySections(Filter const *)
         : M_IS_NRV2D(ph.method) ? "NRV_HEAD,NRV2D,NRV_TAIL"
         : M_IS_NRV2B(ph.method) ? "NRV_HEAD,NRV2B,NRV_TAIL"
         : M_IS_LZMA(ph.method)  ? "LZMA_ELF00,LZMA_DEC20,LZMA_DEC30"
+        : M_IS_LZ4(ph.method)   ? "LZ4_ELF00"
+        : M_IS_ZSTD(ph.method)  ? "ZSTD_ELF00,ZSTD_DEC20,ZSTD_DEC30"
+        : M_IS_DEFLATE(ph.method) ? "DEFLATE_ELF00,DEFLATE_DEC20,DEFLATE_DEC30"
         : nullptr), nullptr);
     if (hasLoaderSection("CFLUSH"))
         addLoader("CFLUSH");
@@ -696,7 +711,11 @@ PackLinuxElf::addStubEntrySections(Filter const *)
 
 void PackLinuxElf::defineSymbols(Filter const *)
 {
-    linker->defineSymbol("O_BINFO", (!!opt->o_unix.is_ptinterp) | o_binfo);
+    // o_binfo of ELF64 is a multiple of 8; the stub ignores the low 3 bits
+    bool const hugepage = opt->o_unix.hugepage_text
+        && UPX_F_LINUX_ELF64_AMD == getFormat();
+    linker->defineSymbol("O_BINFO", (!!opt->o_unix.is_ptinterp) | (lazy << 1)
+        | (hugepage << 2) | o_binfo);
 }
 
 void PackLinuxElf32::defineSymbols(Filter const *ft)
@@ -1585,6 +1604,18 @@ PackLinuxElf64amd::buildLoader(const Filter *ft)
             nullptr,                        0,                                 ft );
         return;
     }
+    if (opt->o_unix.cache_dir) { // put the directory over the marker
+        MemBuffer fold(sizeof(stub_amd64_linux_elf_fold));
+        memcpy(fold, stub_amd64_linux_elf_fold, sizeof(stub_amd64_linux_elf_fold));
+        int const off = find(fold, fold.getSize(), "UPX_CACHE_DIR", 13);
+        if (off < 0)  // stub built without cache support
+            throwCantPack("this stub has no '--cache-dir' support; try without it");
+        strcpy((char *)&fold[off], opt->o_unix.cache_dir);  // < 128 by main.cpp
+        buildLinuxLoader(
+            stub_amd64_linux_elf_entry, sizeof(stub_amd64_linux_elf_entry),
+            fold,                       fold.getSize(),                    ft);
+        return;
+    }
     buildLinuxLoader(
         stub_amd64_linux_elf_entry, sizeof(stub_amd64_linux_elf_entry),
         stub_amd64_linux_elf_fold,  sizeof(stub_amd64_linux_elf_fold), ft);
@@ -2813,6 +2844,27 @@ proceed: ;
     // this->blocksize: avoid over-allocating.
     // (file_size - max_offset): debug info, non-globl symbols, etc.
     opt->o_unix.blocksize = blocksize = UPX_MAX(max_LOADsz, file_size - max_offset);
+    // --split-blocks: the stub decompresses the blocks of a PT_LOAD on
+    // several threads.  Tiny blocks would cost more than they gain.
+    // Only the linux/amd64 fold has the thread support.
+    if (opt->o_unix.split_blocks && !xct_off
+    &&  UPX_F_LINUX_ELF64_AMD == getFormat()) {
+        unsigned const n = opt->o_unix.split_blocks;
+        opt->o_unix.blocksize = blocksize =
+            UPX_MAX(256 * 1024u, (unsigned)((max_LOADsz + n - 1) / n));
+    }
+    // --lazy: blocks of whole pages, small enough to decompress on a fault.
+    // Only the main program of linux/amd64 has the runtime support.
+    if (opt->o_unix.lazy && !opt->o_unix.cache_dir
+    &&  UPX_F_LINUX_ELF64_AMD == getFormat() && !xct_off) {
+        opt->o_unix.blocksize = blocksize = 64 * 1024;
+        lazy = true;
+    }
+    // --hot-pages: those stay uncompressed; the stub maps them from the file.
+    if (opt->o_unix.hot_pages
+    &&  UPX_F_LINUX_ELF64_AMD == getFormat() && !xct_off) {
+        readHotPages(opt->o_unix.hot_pages);
+    }
     return true;
 }
 
@@ -3829,6 +3881,22 @@ void PackLinuxElf64::pack1(OutputFile *fo, Filter &ft)
     page_mask = ~0ull<<lg2_page;
 
     progid = 0;  // getRandomId();  not useful, so do not clutter
+    if (opt->o_unix.cache_dir && 0==xct_off && UPX_F_LINUX_ELF64_AMD==getFormat()) {
+        // --cache-dir: the stub uses a cached copy of the PT_LOADs
+        // only if it has this adler32.
+        progid = upx_adler32(nullptr, 0);
+        phdr = phdri;
+        for (unsigned j=0; j < e_phnum; ++phdr, ++j)
+        if (PT_LOAD64 == get_te32(&phdr->p_type)) {
+            fi->seek(get_te64(&phdr->p_offset), SEEK_SET);
+            for (upx_uint64_t rest = get_te64(&phdr->p_filesz); 0 != rest; ) {
+                int const len = fi->readx(ibuf,
+                    (int)UPX_MIN(rest, (upx_uint64_t)ibuf.getSize()));
+                progid = upx_adler32(ibuf, len, progid);
+                rest -= len;
+            }
+        }
+    }
     sz_elf_hdrs = sizeof(ehdri) + sz_phdrs;
     if (0!=xct_off) { // shared library
         lowmem.alloc(xct_off + (!opt->o_unix.android_shlib
@@ -4235,8 +4303,8 @@ int PackLinuxElf32::pack2(OutputFile *fo, Filter &ft)
             // throw NotCompressible for small .data Extents, which PowerPC
             // sometimes marks as PF_X anyway.  So filter only first segment.
             if (k == nk_f || !is_shlib) {
-                packExtent(x,
-                    (k==nk_f ? &ft : nullptr ), fo, hdr_u_len);
+                planExtent(x,
+                    (k==nk_f ? &ft : nullptr ), hdr_u_len);
             }
             else {
                 total_in += x.size;
@@ -4248,6 +4316,7 @@ int PackLinuxElf32::pack2(OutputFile *fo, Filter &ft)
         hdr_u_len = 0;
         ++nx;
     }
+    packPlannedExtents(fo);
     sz_pack2a = fpad4(fo);  // MATCH01
 
     // Accounting only; ::pack3 will do the compression and output
@@ -4349,6 +4418,7 @@ int PackLinuxElf64::pack2(OutputFile *fo, Filter &ft)
         if (is_shlib) {
             if (x.offset <= xct_off) {
                 unsigned const len = umin(x.size, xct_off - x.offset);
+                packPlannedExtents(fo);  // before writing anything else
                 if (len) {
                     fi->seek(x.offset, SEEK_SET);
                     fi->readx(ibuf, x.size);
@@ -4378,12 +4448,12 @@ int PackLinuxElf64::pack2(OutputFile *fo, Filter &ft)
 
                     x.offset = 0;
                     x.size = sz_elf_hdrs;
-                    packExtent(x, nullptr, fo, 0, 0, true);
+                    planExtent(x, nullptr, 0, 0, true);
                     total_in -= sz_elf_hdrs;
 
                     x.offset = xct_off;
                     x.size = get_te64(&phdri[k].p_filesz) - len;
-                    packExtent(x, &ft, fo, 0, 0, true);
+                    planExtent(x, &ft, 0, 0, true);
                 }
             }
             else {
@@ -4391,7 +4461,7 @@ int PackLinuxElf64::pack2(OutputFile *fo, Filter &ft)
                     // Read-only PT_LOAD, assume not written by relocations.
                     // Also assume not the source for R_*_COPY relocation,
                     // therefore compress it.
-                    packExtent(x, &ft, fo, 0, 0, true);
+                    planExtent(x, &ft, 0, 0, true);
                     // De-compressing will re-create it, but otherwise ignore it.
                     Elf64_Phdr *phdro = (Elf64_Phdr *)(1+ (Elf64_Ehdr *)&lowmem[0]);
                     set_te32(&phdro[k].p_type, Elf64_Phdr::PT_NULL);
@@ -4427,8 +4497,8 @@ int PackLinuxElf64::pack2(OutputFile *fo, Filter &ft)
             // throw NotCompressible for small .data Extents, which PowerPC
             // sometimes marks as PF_X anyway.  So filter only first segment.
             if (k == nk_f || !is_shlib) {
-                packExtent(x,
-                    (k==nk_f ? &ft : nullptr ), fo, hdr_u_len, 0, true);
+                planExtent(x,
+                    (k==nk_f ? &ft : nullptr ), hdr_u_len, 0, true);
             }
             else {
                 total_in += x.size;
@@ -4440,6 +4510,7 @@ int PackLinuxElf64::pack2(OutputFile *fo, Filter &ft)
         hdr_u_len = 0;
         ++nx;
     }
+    packPlannedExtents(fo);
     sz_pack2a = fpad4(fo);  // MATCH01
 
     // Accounting only; ::pack3 will do the compression and output
@@ -66,14 +66,15 @@ const int *PackTmt::getFilters() const
 }
 
 
-unsigned PackTmt::findOverlapOverhead(const upx_bytep buf,
+unsigned PackTmt::findOverlapOverhead(const PackHeader &ph_,
+                                      const upx_bytep buf,
                                       const upx_bytep tbuf,
                                       unsigned range,
                                       unsigned upper_limit) const
 {
     // make sure the decompressor will be paragraph aligned
-    unsigned o = super::findOverlapOverhead(buf, tbuf, range, upper_limit);
-    o = ((o + 0x20) &~ 0xf) - (ph.u_len & 0xf);
+    unsigned o = super::findOverlapOverhead(ph_, buf, tbuf, range, upper_limit);
+    o = ((o + 0x20) &~ 0xf) - (ph_.u_len & 0xf);
     return o;
 }
 
@@ -55,7 +55,8 @@ public:
 protected:
     virtual int readFileHeader();
 
-    virtual unsigned findOverlapOverhead(const upx_bytep buf,
+    virtual unsigned findOverlapOverhead(const PackHeader &ph_,
+                                         const upx_bytep buf,
                                          const upx_bytep tbuf,
                                          unsigned range = 0,
                                          unsigned upper_limit = ~0u) const;
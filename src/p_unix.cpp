@@ -37,17 +37,22 @@
 #include "packer.h"
 #include "p_unix.h"
 #include "p_elf.h"
+#include "parallel.h"
+#include "ui.h"
 
 // do not change
 #define BLOCKSIZE       (512*1024)
 
+#define HOT_PAGE        4096    // --hot-pages: PAGE_SIZE of linux/amd64
+
 
 /*************************************************************************
 //
 **************************************************************************/
 
 PackUnix::PackUnix(InputFile *f) :
-    super(f), exetype(0), blocksize(0), overlay_offset(0), lsize(0)
+    super(f), exetype(0), blocksize(0), lazy(false), overlay_offset(0), lsize(0),
+    plan_head(nullptr), plan_tail(nullptr), plan_used(nullptr), plan_extents(0)
 {
     COMPILE_TIME_ASSERT(sizeof(Elf32_Ehdr) == 52);
     COMPILE_TIME_ASSERT(sizeof(Elf32_Phdr) == 32);
@@ -119,6 +124,17 @@ bool PackUnix::checkCompressionRatio(unsigned, unsigned) const
     return true;
 }
 
+// The ELF, Mach-O and Linux/i386 loaders only put the block sizes
+// into symbol values, so the loader size is the same for all blocks.
+bool PackUnix::getLoaderCacheKey(LoaderCacheKey *key, const Filter *ft) const
+{
+    key->method = ph.method;
+    key->filter = ft->id;
+    key->filter_cto = ft->cto;
+    key->n_mru = ft->n_mru;
+    return true;
+}
+
 void PackUnix::pack1(OutputFile * /*fo*/, Filter & /*ft*/)
 {
     // derived class usually provides this
@@ -147,6 +163,8 @@ int PackUnix::pack2(OutputFile *fo, Filter &ft)
 
     unsigned remaining = file_size;
     unsigned n_block = 0;
+    if (file_size > (off_t)blocksize && packBlocksParallel(fo, ft))
+        remaining = 0;
     while (remaining > 0)
     {
         // FIXME: disable filters if we have more than one block.
@@ -232,6 +250,178 @@ int PackUnix::pack2(OutputFile *fo, Filter &ft)
     return 1;  // default: write end-of-compression bhdr next
 }
 
+/*************************************************************************
+// Compress the blocks of pack2() on several threads.
+//
+// With more than one block there are no filters. Up to one block per
+// thread is read and handed to compressCandidates(), just like the
+// serial loop in pack2() does via compressWithFilters(); the blocks are
+// then written in their original order, and this is also when the
+// u_adler/c_adler chain gets computed. So the output does not change.
+**************************************************************************/
+
+namespace {
+struct PackUnixBlock
+{
+    MemBuffer ibuf;
+    MemBuffer obuf;
+    unsigned u_len;
+    // the result of compressCandidates()
+    PackHeader *ph;
+    Filter ft;
+    unsigned lsize;
+    bool overlap_ok;        // testOverlappingDecompression(OVERHEAD)
+    PackUnixBlock() : ph(nullptr), ft(0) { }
+    ~PackUnixBlock() { delete ph; }
+};
+}
+
+bool PackUnix::packBlocksParallel(OutputFile *fo, Filter &ft)
+{
+    unsigned const n_blocks = (unsigned) ((file_size + blocksize - 1) / blocksize);
+    unsigned const n_window = upx_parallel_threads(n_blocks);
+    if (n_window <= 1)
+        return false;
+
+    // the candidates of compressWithFilters() without filters
+    int methods[256];
+    int const nmethods = prepareMethods(methods, ph.method,
+        getCompressionMethods(M_ALL, ph.level));
+    assert(nmethods > 0);
+    assert(nmethods < 256);
+
+    struct Window {
+        PackUnixBlock *b;
+        explicit Window(unsigned n) : b(new PackUnixBlock[n]) {}
+        ~Window() { delete[] b; }
+    } window(n_window);
+    for (unsigned i = 0; i < n_window; i++) {
+        window.b[i].ibuf.alloc(blocksize);
+        window.b[i].obuf.allocForCompression(blocksize);
+        window.b[i].ph = new PackHeader(ph);
+    }
+
+    const PackHeader orig_ph = ph;
+    auto compress_block = [&](unsigned i) {
+        PackUnixBlock &blk = window.b[i];
+        const unsigned l = blk.u_len;
+        PackHeader bph = orig_ph;
+        bph.u_len = bph.c_len = l;
+        bph.overlap_overhead = 0;
+        Filter bft = ft;
+        bft.buf_len = l;
+        unsigned hdr_c_len = 0;
+        compressCandidates(bph, bft, blk.ibuf, l, blk.obuf, blk.ibuf, l, nullptr, 0,
+            OVERHEAD, NULL_cconf, -3, *blk.ph, blk.ft, blk.lsize, hdr_c_len);
+        blk.overlap_ok = blk.ph->c_len < l &&
+            testOverlappingDecompression(*blk.ph, blk.obuf, blk.ibuf, OVERHEAD);
+    };
+
+    unsigned remaining = file_size;
+    unsigned n_block = 0;
+    while (remaining > 0)
+    {
+        unsigned n = 0, batch_len = 0;
+        for ( ; n < n_window && remaining > 0; n++) {
+            PackUnixBlock &blk = window.b[n];
+            blk.u_len = fi->readx(blk.ibuf, UPX_MIN(blocksize, remaining));
+            remaining -= blk.u_len;
+            batch_len += blk.u_len;
+            // see compressWithFilters()
+            if (!is_forced_method(ph.method)) {
+                if (uip->ui_total_passes > 0)
+                    uip->ui_total_passes -= 1;
+                uip->ui_total_passes += nmethods;
+            }
+        }
+        // the serial loop tunes on the first block, before the workers start
+        if (n_block == 0)
+            for (int mm = 0; mm < nmethods; mm++)
+                tuneLzma(window.b[0].ibuf, window.b[0].u_len, methods[mm], NULL_cconf);
+
+        uip->startCallback(batch_len, 0, uip->ui_pass >= 0 ? uip->ui_pass + 1 : uip->ui_pass,
+                           uip->ui_total_passes);
+        uip->firstCallback();
+        upx_parallel_for(n, compress_block);
+        if (uip->ui_pass >= 0)
+            uip->ui_pass += n * nmethods;
+
+        // write the blocks in order, just like pack2()
+        unsigned batch_c_len = 0;
+        for (unsigned i = 0; i < n; i++) {
+            PackUnixBlock &blk = window.b[i];
+            ph.overlap_overhead = 0;
+            ph.c_len = ph.u_len = blk.u_len;
+            ft.buf_len = blk.u_len;
+            unsigned const end_u_adler = upx_adler32(blk.ibuf, ph.u_len, ph.u_adler);
+
+            // what compressWithFilters() leaves in ph and ft
+            PackHeader best_ph = ph;
+            Filter best_ft = ft;
+            if (blk.ph->c_len < blk.u_len) {
+                best_ph = *blk.ph;
+                best_ph.saved_u_adler = ph.u_adler;
+                best_ph.u_adler = end_u_adler;
+                best_ph.saved_c_adler = ph.c_adler;
+                best_ph.c_adler = upx_adler32(blk.obuf, best_ph.c_len, ph.c_adler);
+                best_ft = blk.ft;
+                best_ft.buf = ibuf;  // was the block buffer
+            }
+            // check compression ratio only on first block
+            useBestCandidate(best_ph, best_ft, blk.lsize, &ft, !!n_block++);
+
+            if (ph.c_len < ph.u_len) {
+                ph.overlap_overhead = OVERHEAD;
+                if (!blk.overlap_ok) {
+                    // not in-place compressible
+                    ph.c_len = ph.u_len;
+                }
+            }
+            if (ph.c_len >= ph.u_len) {
+                // block is not compressible
+                ph.c_len = ph.u_len;
+                // must manually update checksum of compressed data
+                ph.c_adler = upx_adler32(blk.ibuf, ph.u_len, ph.saved_c_adler);
+            }
+
+            // write block header
+            b_info blk_info;
+            memset(&blk_info, 0, sizeof(blk_info));
+            set_te32(&blk_info.sz_unc, ph.u_len);
+            set_te32(&blk_info.sz_cpr, ph.c_len);
+            if (ph.c_len < ph.u_len) {
+                blk_info.b_method = (unsigned char) ph.method;
+                blk_info.b_ftid = (unsigned char) ph.filter;
+                blk_info.b_cto8 = (unsigned char) ph.filter_cto;
+            }
+            fo->write(&blk_info, sizeof(blk_info));
+            b_len += sizeof(b_info);
+
+            // write compressed data
+            if (ph.c_len < ph.u_len) {
+                fo->write(blk.obuf, ph.c_len);
+                verifyOverlappingDecompression(blk.obuf, blk.obuf.getSize());
+                blk.obuf.checkState();
+            }
+            else {
+                fo->write(blk.ibuf, ph.u_len);
+            }
+            ph.u_adler = end_u_adler;
+
+            total_in += ph.u_len;
+            total_out += ph.c_len;
+            batch_c_len += ph.c_len;
+        }
+        uip->finalCallback(batch_len, batch_c_len);
+        uip->endCallback();
+
+        // leave the last block in ibuf, as the serial loop does
+        if (remaining == 0)
+            memcpy(ibuf, window.b[n - 1].ibuf, window.b[n - 1].u_len);
+    }
+    return true;
+}
+
 void
 PackUnix::patchLoaderChecksum()
 {
@@ -316,6 +506,403 @@ void PackUnix::pack(OutputFile *fo)
 }
 
 
+/*************************************************************************
+// Compress the blocks of several packExtent() calls on threads.
+//
+// pack2() lists its extents with planExtent() first, then
+// packPlannedExtents() calls packExtent() for each of them. Whenever
+// packExtent() comes to a block that was not compressed yet, the next
+// few planned blocks (one per thread, and possibly from later extents)
+// are read and compressed at once with compressCandidates(), which is
+// exactly what compressWithFilters() does for them, and so is compress()
+// for the extents without a filter. packExtent() then only applies these
+// results and writes them, so the b_info chain, the checksums, the
+// filter of each block and total_in/total_out do not change.
+//
+// A result depends on ph.method, ph.level and the filter strategy, so it
+// is only used if these are still the same when packExtent() gets there;
+// otherwise the compression simply happens again.
+**************************************************************************/
+
+struct PackUnix::PlannedBlock
+{
+    PlannedBlock *next;
+    unsigned extent;            // index of the planExtent() call
+    Extent x;                   // arguments of the packExtent() call
+    Filter *ft;
+    unsigned b_extra;
+    bool inhibit_compression_check;
+    off_t offset;               // this block
+    unsigned u_len;
+    unsigned hdr_len;           // only for the first block of an extent
+
+    // set by compressPlanned()
+    bool done;
+    int method;                 // the input
+    int level;
+    int filter_strategy;
+    unsigned addvalue;
+    MemBuffer ibuf;
+    MemBuffer obuf;
+    MemBuffer hdr_ibuf;
+    PackHeader *ph;             // the result
+    Filter *best_ft;
+    unsigned lsize;
+    bool compress_ok;           // return value of compress()
+    bool overlap_ok;            // testOverlappingDecompression(OVERHEAD)
+
+    PlannedBlock() : next(nullptr), ft(nullptr), done(false),
+        ph(nullptr), best_ft(nullptr) { }
+    ~PlannedBlock() { reset(); }
+    void reset() {
+        done = false;
+        delete ph; ph = nullptr;
+        delete best_ft; best_ft = nullptr;
+        ibuf.dealloc();
+        obuf.dealloc();
+        hdr_ibuf.dealloc();
+    }
+private:
+    PlannedBlock(const PlannedBlock &) = delete;
+    PlannedBlock &operator=(const PlannedBlock &) = delete;
+};
+
+PackUnix::~PackUnix()
+{
+    clearPlan();
+}
+
+// With --lazy the runtime stub decompresses each block on its own when a
+// page of it is touched, so a block must not straddle a page which also
+// belongs to the next block: end the blocks at multiples of blocksize.
+//
+// With --hot-pages a block is either all hot or all cold, and a hot block
+// which does not reach the end of the Extent is whole pages.
+unsigned PackUnix::blockLength(off_t offset, off_t rest) const
+{
+    off_t len = UPX_MIN(rest, (off_t)blocksize);
+    if (lazy)
+        len = UPX_MIN(len, (off_t)(blocksize - offset % blocksize));
+    if (hot_map.getSize()) {
+        bool const hot = isHotPage(offset);
+        off_t p = (offset | (HOT_PAGE - 1)) + 1;  // next page
+        if (hot && (offset & (HOT_PAGE - 1)) && p < offset + len)
+            return (unsigned) (p - offset);  // then whole pages
+        for (; p < offset + len; p += HOT_PAGE) {
+            if (isHotPage(p) != hot)
+                return (unsigned) (p - offset);
+        }
+        off_t const tail = (offset + len) & (HOT_PAGE - 1);
+        if (hot && len < rest && tail < len)
+            len -= tail;
+    }
+    return (unsigned) len;
+}
+
+// The profile is text: one file offset per line, decimal or 0x hex;
+// '#' begins a comment.  Each offset stands for its whole page.
+void PackUnix::readHotPages(const char *fname)
+{
+    InputFile fh;
+    fh.open(fname, O_RDONLY | O_BINARY);
+    unsigned const len = (unsigned) fh.st_size();
+    MemBuffer text(len + 1);
+    fh.readx(text, len);
+    fh.closex();
+    text[len] = 0;
+
+    hot_map.alloc(((upx_uint64_t) file_size + HOT_PAGE - 1) / HOT_PAGE);
+    hot_map.clear();
+    unsigned n_hot = 0;
+    for (char *p = (char *) (unsigned char *) text; *p; ) {
+        if (*p == '#') {
+            while (*p && *p != '\n')
+                p++;
+        }
+        else if (isspace((unsigned char) *p))
+            p++;
+        else {
+            char *end = nullptr;
+            upx_uint64_t const off = strtoull(p, &end, 0);
+            if (end == p || (*end && !isspace((unsigned char) *end) && *end != '#'))
+                throwCantPack("--hot-pages: bad page offset");
+            p = end;
+            if (off < (upx_uint64_t) file_size) {  // else not this file
+                n_hot += !hot_map[off / HOT_PAGE];
+                hot_map[off / HOT_PAGE] = 1;
+            }
+        }
+    }
+    if (n_hot == 0)
+        hot_map.dealloc();
+}
+
+bool PackUnix::isHotPage(off_t offset) const
+{
+    upx_uint64_t const page = (upx_uint64_t) offset / HOT_PAGE;
+    return page < hot_map.getSize() && hot_map[page];
+}
+
+void PackUnix::planExtent(
+    const Extent &x,
+    Filter *ft,
+    unsigned hdr_len,
+    unsigned b_extra,
+    bool inhibit_compression_check
+)
+{
+    off_t const end = x.offset + x.size;
+    for (off_t offset = x.offset; offset < end; ) {
+        PlannedBlock *const b = new PlannedBlock;
+        b->extent = plan_extents;
+        b->x = x;
+        b->ft = ft;
+        b->b_extra = b_extra;
+        b->inhibit_compression_check = inhibit_compression_check;
+        b->offset = offset;
+        b->u_len = blockLength(offset, end - offset);
+        b->hdr_len = (offset == x.offset) ? hdr_len : 0;
+        if (isHotPage(offset) && !b->hdr_len) { // stored by packExtent()
+            offset += b->u_len;
+            delete b;
+            continue;
+        }
+        if (plan_tail)
+            plan_tail->next = b;
+        else
+            plan_head = b;
+        plan_tail = b;
+        offset += b->u_len;
+    }
+    plan_extents++;
+}
+
+void PackUnix::packPlannedExtents(OutputFile *fo)
+{
+    while (plan_head != nullptr) {
+        // copy, as packExtent() takes the blocks
+        PlannedBlock const *const b = plan_head;
+        unsigned const extent = b->extent;
+        Extent const x = b->x;
+        Filter *const ft = b->ft;
+        unsigned const hdr_len = b->hdr_len;
+        unsigned const b_extra = b->b_extra;
+        bool const inhibit = b->inhibit_compression_check;
+        packExtent(x, ft, fo, hdr_len, b_extra, inhibit);
+        // drop what packExtent() did not ask for
+        while (plan_head != nullptr && plan_head->extent == extent) {
+            PlannedBlock *const t = plan_head;
+            plan_head = t->next;
+            delete t;
+        }
+        if (plan_head == nullptr)
+            plan_tail = nullptr;
+    }
+    clearPlan();
+}
+
+void PackUnix::clearPlan()
+{
+    while (plan_head != nullptr) {
+        PlannedBlock *const t = plan_head;
+        plan_head = t->next;
+        delete t;
+    }
+    plan_tail = nullptr;
+    delete plan_used;
+    plan_used = nullptr;
+    plan_extents = 0;
+}
+
+// Return the result for the next block of packExtent(), or nullptr
+// if it has to compress the block by itself.
+PackUnix::PlannedBlock *PackUnix::takePlannedBlock(
+    off_t offset,
+    unsigned u_len,
+    const Filter *ft,
+    unsigned hdr_len,
+    int filter_strategy
+)
+{
+    delete plan_used;
+    plan_used = nullptr;
+    PlannedBlock *const b = plan_head;
+    if (b == nullptr || b->offset != offset || b->u_len != u_len
+    ||  b->ft != ft || b->hdr_len != hdr_len)
+        return nullptr;
+    if (b->done && (b->method != ph.method || b->level != ph.level
+        || b->filter_strategy != filter_strategy
+        || (ft && b->addvalue != ft->addvalue))) {
+        // compressed ahead with other settings; so are the blocks after it
+        for (PlannedBlock *p = b; p != nullptr && p->done; p = p->next)
+            p->reset();
+    }
+    if (!b->done)
+        compressPlanned();
+    plan_head = b->next;
+    if (plan_head == nullptr)
+        plan_tail = nullptr;
+    if (!b->done) {
+        delete b;
+        return nullptr;
+    }
+    plan_used = b;
+    return b;
+}
+
+// Compress the next planned blocks at once, one per thread.
+bool PackUnix::compressPlanned()
+{
+    unsigned n_plan = 0;
+    for (PlannedBlock const *b = plan_head; b != nullptr; b = b->next)
+        n_plan++;
+    unsigned const n_window = upx_parallel_threads(n_plan);
+    if (n_window <= 1)
+        return false;
+
+    struct Window {
+        PlannedBlock **b;
+        explicit Window(unsigned n) : b(new PlannedBlock *[n]) {}
+        ~Window() { delete[] b; }
+    } window(n_window);
+
+    // read the input; this must not disturb the caller
+    upx_off_t const saved_pos = fi->tell();
+    unsigned n = 0, batch_len = 0;
+    for (PlannedBlock *b = plan_head; b != nullptr && n < n_window; b = b->next) {
+        b->reset();
+        b->ibuf.alloc(b->u_len);
+        fi->seek(b->offset, SEEK_SET);
+        if ((unsigned) fi->read(b->ibuf, b->u_len) != b->u_len)
+            break;  // packExtent() will complain
+        if (b->hdr_len) {
+            b->hdr_ibuf.alloc(b->hdr_len);
+            fi->seek(0, SEEK_SET);
+            fi->readx(b->hdr_ibuf, b->hdr_len);
+        }
+        b->obuf.allocForCompression(b->u_len);
+        // what packExtent() sets up for compressWithFilters() or compress()
+        b->method = ph.method;
+        b->level = ph.level;
+        b->filter_strategy = b->ft ? getStrategy(*b->ft) : 0;
+        b->ph = new PackHeader(ph);
+        b->ph->u_len = b->ph->c_len = b->u_len;
+        b->ph->overlap_overhead = 0;
+        if (b->ft) {
+            b->ph->filter = 0;
+            b->ph->filter_cto = 0;
+            b->best_ft = new Filter(*b->ft);
+            b->best_ft->id = 0;
+            b->best_ft->cto = 0;
+            b->best_ft->buf_len = b->u_len;
+            b->addvalue = b->ft->addvalue;
+        }
+        window.b[n++] = b;
+        batch_len += b->u_len;
+    }
+    fi->seek(saved_pos, SEEK_SET);
+    if (n == 0)
+        return false;
+
+    // --lzma-tune: the serial code tunes on the first block which is big
+    // enough; do it here, as the workers must not change lzma_tuned
+    if (!lzma_tuned) {
+        int methods[256];
+        int const nmethods = prepareMethods(methods, ph.method,
+            getCompressionMethods(M_ALL, ph.level));
+        for (unsigned i = 0; i < n && !lzma_tuned; i++)
+            for (int mm = 0; mm < nmethods; mm++)
+                tuneLzma(window.b[i]->ibuf, window.b[i]->u_len, methods[mm], NULL_cconf);
+    }
+
+    auto compress_block = [&](unsigned i) {
+        PlannedBlock *const b = window.b[i];
+        PackHeader &cph = *b->ph;
+        unsigned const l = b->u_len;
+        b->lsize = 0;
+        if (b->ft) {
+            const PackHeader orig_ph = cph;
+            const Filter orig_ft = *b->best_ft;
+            unsigned hdr_c_len = 0;
+            compressCandidates(orig_ph, orig_ft, b->ibuf, l, b->obuf, b->ibuf, l,
+                b->hdr_len ? (upx_bytep) b->hdr_ibuf : nullptr, b->hdr_len,
+                OVERHEAD, NULL_cconf, b->filter_strategy,
+                cph, *b->best_ft, b->lsize, hdr_c_len);
+            b->compress_ok = cph.c_len < l;
+        }
+        else
+            b->compress_ok = compress(cph, b->ibuf, l, b->obuf, nullptr, NULL_cconf);
+        b->overlap_ok = false;
+        if (cph.c_len < l) {
+            const upx_bytep tbuf = nullptr;
+            if (b->ft == nullptr || b->best_ft->id == 0) tbuf = b->ibuf;
+            b->overlap_ok = testOverlappingDecompression(cph, b->obuf, tbuf, OVERHEAD);
+        }
+    };
+
+    uip->startCallback(batch_len, 0, uip->ui_pass >= 0 ? uip->ui_pass + 1 : uip->ui_pass,
+                       uip->ui_total_passes);
+    uip->firstCallback();
+    upx_parallel_for(n, compress_block);
+    unsigned batch_c_len = 0;
+    for (unsigned i = 0; i < n; i++) {
+        window.b[i]->done = true;
+        batch_c_len += window.b[i]->ph->c_len;
+    }
+    uip->finalCallback(batch_len, batch_c_len);
+    uip->endCallback();
+    return true;
+}
+
+// What compressWithFilters() or compress() would leave in ph, ft and obuf.
+void PackUnix::usePlannedBlock(
+    const PlannedBlock *b,
+    Filter *ft,
+    bool inhibit_compression_check
+)
+{
+    const PackHeader &r = *b->ph;
+    if (uip->ui_pass >= 0)
+        uip->ui_pass++;
+    PackHeader best_ph = ph;
+    if (b->compress_ok || !ft) {
+        best_ph.u_len = r.u_len;
+        best_ph.c_len = r.c_len;
+        best_ph.saved_u_adler = ph.u_adler;
+        best_ph.saved_c_adler = ph.c_adler;
+        // the same data, but chained to our checksums
+        best_ph.u_adler = upx_adler32_rebase(r.u_adler, r.u_len,
+            r.saved_u_adler, ph.u_adler);
+        if (b->compress_ok)
+            best_ph.c_adler = upx_adler32(b->obuf, r.c_len, ph.c_adler);
+        best_ph.compress_result = r.compress_result;
+        int const method = forced_method(r.method);
+        if (M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method)) {
+            best_ph.max_offset_found = r.max_offset_found;
+            best_ph.max_match_found = r.max_match_found;
+            best_ph.max_run_found = r.max_run_found;
+            best_ph.first_offset_found = r.first_offset_found;
+        }
+        if (r.c_len < r.u_len)
+            memcpy(obuf, b->obuf, r.c_len);
+    }
+    if (!ft) {
+        ph = best_ph;
+        return;
+    }
+    Filter best_ft = *ft;
+    if (b->compress_ok) {
+        best_ph.method = r.method;
+        best_ph.filter = r.filter;
+        best_ph.filter_cto = r.filter_cto;
+        best_ph.n_mru = r.n_mru;
+        best_ph.overlap_overhead = r.overlap_overhead;
+        best_ft = *b->best_ft;
+        best_ft.buf = ibuf;  // was the private copy
+    }
+    useBestCandidate(best_ph, best_ft, b->lsize, ft, inhibit_compression_check);
+}
+
 void PackUnix::packExtent(
     const Extent &x,
     Filter *ft,
@@ -337,10 +924,38 @@ void PackUnix::packExtent(
     fi->seek(x.offset, SEEK_SET);
     for (off_t rest = x.size; 0 != rest; ) {
         int const filter_strategy = ft ? getStrategy(*ft) : 0;
-        int l = fi->readx(ibuf, UPX_MIN(rest, (off_t)blocksize));
+        int l = fi->readx(ibuf, blockLength(x.offset + x.size - rest, rest));
         if (l == 0) {
             break;
         }
+        if (!hdr_u_len && isHotPage(x.offset + x.size - rest)) {
+            // --hot-pages: stored, its data on a page of the output file,
+            // so that the runtime stub can map it instead of copying it
+            rest -= l;
+            unsigned const pad = (unsigned) (-(sizeof(b_info)
+                + fo->getBytesWritten()) & (HOT_PAGE - 1));
+            ph.c_len = ph.u_len = l;
+            ph.u_adler = upx_adler32(ibuf, l, ph.u_adler);
+            ph.c_adler = upx_adler32(ibuf, l, ph.c_adler);
+            b_info tmp;
+            memset(&tmp, 0, sizeof(tmp));
+            set_te32(&tmp.sz_unc, l);
+            set_te32(&tmp.sz_cpr, pad + l);
+            tmp.b_method = B_PAGES;
+            tmp.b_extra = b_extra;
+            fo->write(&tmp, sizeof(tmp));
+            b_len += sizeof(b_info);
+            if (pad) {
+                obuf.clear(0, pad);
+                fo->write(obuf, pad);
+            }
+            fo->write(ibuf, l);
+            total_in += l;
+            total_out += pad + l;
+            continue;
+        }
+        PlannedBlock const *const pb = takePlannedBlock(x.offset + x.size - rest,
+            l, ft, hdr_u_len, filter_strategy);
         rest -= l;
 
         // Note: compression for a block can fail if the
@@ -363,8 +978,16 @@ void PackUnix::packExtent(
             ft->id = 0;
             ft->cto = 0;
 
-            compressWithFilters(ft, OVERHEAD, NULL_cconf, filter_strategy,
-                                0, 0, 0, hdr_ibuf, hdr_u_len, inhibit_compression_check);
+            if (pb) {
+                usePlannedBlock(pb, ft, inhibit_compression_check);
+            }
+            else {
+                compressWithFilters(ft, OVERHEAD, NULL_cconf, filter_strategy,
+                                    0, 0, 0, hdr_ibuf, hdr_u_len, inhibit_compression_check);
+            }
+        }
+        else if (pb) {
+            usePlannedBlock(pb, nullptr, inhibit_compression_check);
         }
         else {
             (void) compress(ibuf, ph.u_len, obuf);    // ignore return value
@@ -374,7 +997,8 @@ void PackUnix::packExtent(
             const upx_bytep tbuf = nullptr;
             if (ft == nullptr || ft->id == 0) tbuf = ibuf;
             ph.overlap_overhead = OVERHEAD;
-            if (!testOverlappingDecompression(obuf, tbuf, ph.overlap_overhead)) {
+            if (pb ? !pb->overlap_ok
+                   : !testOverlappingDecompression(obuf, tbuf, ph.overlap_overhead)) {
                 // not in-place compressible
                 ph.c_len = ph.u_len;
             }
@@ -457,7 +1081,7 @@ void PackUnix::unpackExtent(unsigned wanted, OutputFile *fo,
     while (wanted) {
         fi->readx(&hdr, szb_info);
         int const sz_unc = ph.u_len = get_te32(&hdr.sz_unc);
-        int const sz_cpr = ph.c_len = get_te32(&hdr.sz_cpr);
+        int sz_cpr = ph.c_len = get_te32(&hdr.sz_cpr);
         ph.filter_cto = hdr.b_cto8;
 
         if (sz_unc == 0) { // must never happen while 0!=wanted
@@ -466,6 +1090,13 @@ void PackUnix::unpackExtent(unsigned wanted, OutputFile *fo,
         }
         if (sz_unc <= 0 || sz_cpr <= 0)
             throwCantUnpack("corrupt b_info");
+        if (hdr.b_method == B_PAGES && 12==szb_info) { // --hot-pages
+            if (sz_cpr < sz_unc)
+                throwCantUnpack("corrupt b_info");
+            fi->seek(sz_cpr - sz_unc, SEEK_CUR);  // padding
+            total_in += sz_cpr - sz_unc;
+            sz_cpr = ph.c_len = sz_unc;
+        }
         if (sz_cpr > sz_unc || sz_unc > (int)blocksize)
             throwCantUnpack("corrupt b_info");
 
@@ -41,6 +41,7 @@ class PackUnix : public Packer
 protected:
     PackUnix(InputFile *f);
 public:
+    virtual ~PackUnix();
     virtual int getVersion() const { return 13; }
     virtual const int *getFilters() const { return nullptr; }
     virtual int getStrategy(Filter &);
@@ -58,6 +59,7 @@ protected:
     virtual int  pack2(OutputFile *, Filter &);  // append compressed data
     virtual off_t pack3(OutputFile *, Filter &);  // append loader
     virtual void pack4(OutputFile *, Filter &);  // append PackHeader
+    bool packBlocksParallel(OutputFile *, Filter &);  // pack2() on threads
 
     virtual void patchLoader() = 0;
     virtual void patchLoaderChecksum();
@@ -66,6 +68,7 @@ protected:
     virtual void writePackHeader(OutputFile *fo);
 
     virtual bool checkCompressionRatio(unsigned, unsigned) const;
+    virtual bool getLoaderCacheKey(LoaderCacheKey *key, const Filter *ft) const;
 
 protected:
     struct Extent {
@@ -79,10 +82,31 @@ protected:
     virtual void unpackExtent(unsigned wanted, OutputFile *fo,
         unsigned &c_adler, unsigned &u_adler,
         bool first_PF_X, unsigned szb_info, bool is_rewrite = false);
+    unsigned blockLength(off_t offset, off_t rest) const;
+    void readHotPages(const char *fname);
+    bool isHotPage(off_t offset) const;
+
+    // pack2() and pack3() may announce their packExtent() calls with
+    // planExtent(), and then make them with packPlannedExtents(): this way
+    // the blocks of all these extents get compressed a few at a time on
+    // several threads, while packExtent() still writes them in order.
+    struct PlannedBlock;
+    void planExtent(const Extent &x, Filter *,
+        unsigned hdr_len = 0, unsigned b_extra = 0,
+        bool inhibit_compression_check = false);
+    void packPlannedExtents(OutputFile *);
+    void clearPlan();
+    PlannedBlock *takePlannedBlock(off_t offset, unsigned u_len,
+        const Filter *, unsigned hdr_len, int filter_strategy);
+    bool compressPlanned();
+    void usePlannedBlock(const PlannedBlock *, Filter *,
+        bool inhibit_compression_check);
     unsigned total_in, total_out;  // unpack
 
     int exetype;
     unsigned blocksize;
+    bool lazy;                    // blocks end at multiples of blocksize
+    MemBuffer hot_map;            // --hot-pages: one byte per page of input
     unsigned progid;              // program id
     unsigned overlay_offset;      // used when decompressing
 
@@ -93,6 +117,10 @@ protected:
 
     unsigned b_len;  // total length of b_info blocks
 
+    PlannedBlock *plan_head, *plan_tail;  // see planExtent()
+    PlannedBlock *plan_used;    // returned by takePlannedBlock()
+    unsigned plan_extents;
+
     // must agree with stub/linux.hh
     __packed_struct(b_info) // 12-byte header before each compressed block
         NE32 sz_unc;  // uncompressed_size
@@ -102,6 +130,9 @@ protected:
         unsigned char b_cto8;  // filter parameter
         unsigned char b_extra;
     __packed_struct_end()
+    // b_method of a block which --hot-pages stored so that its data begins
+    // on a page of the output file; sz_cpr also counts the padding before it
+    enum { B_PAGES = 0xff };
 
     __packed_struct(l_info) // 12-byte trailer in header for loader
         LE32 l_checksum;
@@ -26,11 +26,13 @@
  */
 
 #include "conf.h"
+#include "compress.h"
 #include "file.h"
 #include "packer.h"
 #include "filter.h"
 #include "linker.h"
 #include "ui.h"
+#include "parallel.h"
 
 /*************************************************************************
 //
@@ -180,21 +182,82 @@ int forced_method(int method) // extract the forced method
 // compress - wrap call to low-level upx_compress()
 **************************************************************************/
 
+// The progress bar for compressing ph_.u_len bytes, for one more pass.
+static void startCompressCallback(UiPacker *uip, const PackHeader &ph_) {
+    // Avoid too many progress bar updates. 64 is s->bar_len in ui.cpp.
+    unsigned step = (ph_.u_len < 64 * 1024) ? 0 : ph_.u_len / 64;
+#if (WITH_NRV)
+    int method = forced_method(ph_.method);
+    if ((M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method)) &&
+        (ph_.level >= 7 || (ph_.level >= 4 && ph_.u_len >= 512 * 1024)))
+        step = 0;
+#endif
+    if (uip->ui_pass >= 0)
+        uip->ui_pass++;
+    uip->startCallback(ph_.u_len, step, uip->ui_pass, uip->ui_total_passes);
+    uip->firstCallback();
+}
+
 bool Packer::compress(upx_bytep i_ptr, unsigned i_len, upx_bytep o_ptr,
                       const upx_compress_config_t *cconf_parm) {
     ph.u_len = i_len;
-    ph.c_len = 0;
     assert(ph.level >= 1);
     assert(ph.level <= 10);
 
-    // Avoid too many progress bar updates. 64 is s->bar_len in ui.cpp.
-    unsigned step = (ph.u_len < 64 * 1024) ? 0 : ph.u_len / 64;
+    tuneLzma(i_ptr, i_len, forced_method(ph.method), cconf_parm);
+    startCompressCallback(uip, ph);
+
+    bool ok = compress(ph, i_ptr, i_len, o_ptr, uip->getCallback(), cconf_parm);
+
+    // uip->finalCallback(ph.u_len, ph.c_len);
+    uip->endCallback();
+    return ok;
+}
+
+// --lzma-tune: choose lc/lp/pb and the number of fast bytes once per file,
+// on the first block of at least 64 KiB that is compressed with plain LZMA
+// (the variants like M_LZMA_003 of --brute bring their own settings).
+// Every LZMA stream starts with its settings, and upx_lzma_tune() never
+// increases the memory the decompressor needs, so blocks compressed
+// before may keep the default settings.
+void Packer::tuneLzma(const upx_bytep buf, unsigned len, int method,
+                      const upx_compress_config_t *cconf_parm) {
+    if (!opt->lzma_tune || lzma_tuned || !M_IS_LZMA(method) || method >= 0x100 ||
+        len < 64 * 1024)
+        return;
+    upx_compress_config_t cconf;
+    cconf.reset();
+    if (cconf_parm)
+        cconf = *cconf_parm;
+    oassign(cconf.conf_lzma.pos_bits, opt->crp.crp_lzma.pos_bits);
+    oassign(cconf.conf_lzma.lit_pos_bits, opt->crp.crp_lzma.lit_pos_bits);
+    oassign(cconf.conf_lzma.lit_context_bits, opt->crp.crp_lzma.lit_context_bits);
+    oassign(cconf.conf_lzma.dict_size, opt->crp.crp_lzma.dict_size);
+    oassign(cconf.conf_lzma.num_fast_bytes, opt->crp.crp_lzma.num_fast_bytes);
+    int r = upx_lzma_tune(buf, len, ph.level, &cconf, &lzma_tune);
+    if (r == UPX_E_OUT_OF_MEMORY)
+        throwOutOfMemoryException();
+    if (r != UPX_E_OK)
+        throwInternalError("lzma tuning failed");
+    lzma_tuned = true;
+}
+
+// The actual work of compress(), but without any UI and only using ph_,
+// so this may get called from several threads at once. The verification
+// decompresses to v_ptr[] if given, so that i_ptr[] may be shared.
+bool Packer::compress(PackHeader &ph_, upx_bytep i_ptr, unsigned i_len, upx_bytep o_ptr,
+                      upx_callback_p cb, const upx_compress_config_t *cconf_parm,
+                      upx_bytep v_ptr) const {
+    ph_.u_len = i_len;
+    ph_.c_len = 0;
+    assert(ph_.level >= 1);
+    assert(ph_.level <= 10);
 
     // save current checksums
-    ph.saved_u_adler = ph.u_adler;
-    ph.saved_c_adler = ph.c_adler;
+    ph_.saved_u_adler = ph_.u_adler;
+    ph_.saved_c_adler = ph_.c_adler;
     // update checksum of uncompressed data
-    ph.u_adler = upx_adler32(i_ptr, ph.u_len, ph.u_adler);
+    ph_.u_adler = upx_adler32(i_ptr, ph_.u_len, ph_.u_adler);
 
     // set compression parameters
     upx_compress_config_t cconf;
@@ -202,7 +265,7 @@ bool Packer::compress(upx_bytep i_ptr, unsigned i_len, upx_bytep o_ptr,
     if (cconf_parm)
         cconf = *cconf_parm;
     // cconf options
-    int method = forced_method(ph.method);
+    int method = forced_method(ph_.method);
     if (M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method)) {
         if (opt->crp.crp_ucl.c_flags != -1)
             cconf.conf_ucl.c_flags = opt->crp.crp_ucl.c_flags;
@@ -216,10 +279,6 @@ bool Packer::compress(upx_bytep i_ptr, unsigned i_len, upx_bytep o_ptr,
         if (opt->crp.crp_ucl.max_match != UINT_MAX &&
             opt->crp.crp_ucl.max_match < cconf.conf_ucl.max_match)
             cconf.conf_ucl.max_match = opt->crp.crp_ucl.max_match;
-#if (WITH_NRV)
-        if (ph.level >= 7 || (ph.level >= 4 && ph.u_len >= 512 * 1024))
-            step = 0;
-#endif
     }
     if (M_IS_LZMA(method)) {
         oassign(cconf.conf_lzma.pos_bits, opt->crp.crp_lzma.pos_bits);
@@ -227,72 +286,77 @@ bool Packer::compress(upx_bytep i_ptr, unsigned i_len, upx_bytep o_ptr,
         oassign(cconf.conf_lzma.lit_context_bits, opt->crp.crp_lzma.lit_context_bits);
         oassign(cconf.conf_lzma.dict_size, opt->crp.crp_lzma.dict_size);
         oassign(cconf.conf_lzma.num_fast_bytes, opt->crp.crp_lzma.num_fast_bytes);
+        if (lzma_tuned && method < 0x100) {
+            // see tuneLzma()
+            oassign(cconf.conf_lzma.pos_bits, lzma_tune.pos_bits);
+            oassign(cconf.conf_lzma.lit_pos_bits, lzma_tune.lit_pos_bits);
+            oassign(cconf.conf_lzma.lit_context_bits, lzma_tune.lit_context_bits);
+            oassign(cconf.conf_lzma.num_fast_bytes, lzma_tune.num_fast_bytes);
+        }
     }
     if (M_IS_DEFLATE(method)) {
         oassign(cconf.conf_zlib.mem_level, opt->crp.crp_zlib.mem_level);
         oassign(cconf.conf_zlib.window_bits, opt->crp.crp_zlib.window_bits);
         oassign(cconf.conf_zlib.strategy, opt->crp.crp_zlib.strategy);
     }
-    if (uip->ui_pass >= 0)
-        uip->ui_pass++;
-    uip->startCallback(ph.u_len, step, uip->ui_pass, uip->ui_total_passes);
-    uip->firstCallback();
 
-    // OutputFile::dump("data.raw", in, ph.u_len);
+    // OutputFile::dump("data.raw", in, ph_.u_len);
 
     // compress
-    int r = upx_compress(i_ptr, ph.u_len, o_ptr, &ph.c_len, uip->getCallback(), method, ph.level,
-                         &cconf, &ph.compress_result);
-
-    // uip->finalCallback(ph.u_len, ph.c_len);
-    uip->endCallback();
+    int r = upx_compress(i_ptr, ph_.u_len, o_ptr, &ph_.c_len, cb, method, ph_.level, &cconf,
+                         &ph_.compress_result);
 
     if (r == UPX_E_OUT_OF_MEMORY)
         throwOutOfMemoryException();
+    if (r == UPX_E_BUDGET_EXCEEDED) // cannot beat the best candidate
+        return false;
     if (r != UPX_E_OK)
         throwInternalError("compression failed");
 
     if (M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method)) {
-        const ucl_uint *res = ph.compress_result.result_ucl.result;
-        // ph.min_offset_found = res[0];
-        ph.max_offset_found = res[1];
-        // ph.min_match_found = res[2];
-        ph.max_match_found = res[3];
-        // ph.min_run_found = res[4];
-        ph.max_run_found = res[5];
-        ph.first_offset_found = res[6];
-        // ph.same_match_offsets_found = res[7];
+        const ucl_uint *res = ph_.compress_result.result_ucl.result;
+        // ph_.min_offset_found = res[0];
+        ph_.max_offset_found = res[1];
+        // ph_.min_match_found = res[2];
+        ph_.max_match_found = res[3];
+        // ph_.min_run_found = res[4];
+        ph_.max_run_found = res[5];
+        ph_.first_offset_found = res[6];
+        // ph_.same_match_offsets_found = res[7];
         if (cconf_parm) {
             assert(cconf.conf_ucl.max_offset == 0 ||
-                   cconf.conf_ucl.max_offset >= ph.max_offset_found);
-            assert(cconf.conf_ucl.max_match == 0 || cconf.conf_ucl.max_match >= ph.max_match_found);
+                   cconf.conf_ucl.max_offset >= ph_.max_offset_found);
+            assert(cconf.conf_ucl.max_match == 0 ||
+                   cconf.conf_ucl.max_match >= ph_.max_match_found);
         }
     }
 
-    // printf("\nPacker::compress: %d/%d: %7d -> %7d\n", method, ph.level, ph.u_len, ph.c_len);
-    if (!checkCompressionRatio(ph.u_len, ph.c_len))
+    // printf("\nPacker::compress: %d/%d: %7d -> %7d\n", method, ph_.level, ph_.u_len, ph_.c_len);
+    if (!checkCompressionRatio(ph_.u_len, ph_.c_len))
         return false;
     // return in any case if not compressible
-    if (ph.c_len >= ph.u_len)
+    if (ph_.c_len >= ph_.u_len)
         return false;
 
     // update checksum of compressed data
-    ph.c_adler = upx_adler32(o_ptr, ph.c_len, ph.c_adler);
+    ph_.c_adler = upx_adler32(o_ptr, ph_.c_len, ph_.c_adler);
     // Decompress and verify. Skip this when using the fastest level.
-    if (!ph_skipVerify(ph)) {
+    if (!ph_skipVerify(ph_)) {
         // decompress
-        unsigned new_len = ph.u_len;
-        r = upx_decompress(o_ptr, ph.c_len, i_ptr, &new_len, method, &ph.compress_result);
+        if (v_ptr == nullptr)
+            v_ptr = i_ptr;
+        unsigned new_len = ph_.u_len;
+        r = upx_decompress(o_ptr, ph_.c_len, v_ptr, &new_len, method, &ph_.compress_result);
         if (r == UPX_E_OUT_OF_MEMORY)
             throwOutOfMemoryException();
-        // printf("%d %d: %d %d %d\n", method, r, ph.c_len, ph.u_len, new_len);
+        // printf("%d %d: %d %d %d\n", method, r, ph_.c_len, ph_.u_len, new_len);
         if (r != UPX_E_OK)
             throwInternalError("decompression failed");
-        if (new_len != ph.u_len)
+        if (new_len != ph_.u_len)
             throwInternalError("decompression failed (size error)");
 
         // verify decompression
-        if (ph.u_adler != upx_adler32(i_ptr, ph.u_len, ph.saved_u_adler))
+        if (ph_.u_adler != upx_adler32(v_ptr, ph_.u_len, ph_.saved_u_adler))
             throwInternalError("decompression failed (checksum error)");
     }
     return true;
@@ -381,6 +445,15 @@ void Packer::decompress(const upx_bytep in, upx_bytep out, bool verify_checksum,
 // overlapping decompression
 **************************************************************************/
 
+// Because upx_test_overlap() does not use the asm_fast decompressor
+// we must account for extra 3 bytes that asm_fast does use,
+// or else we may fail at runtime decompression.
+static unsigned ph_overlapExtra(const PackHeader &ph) {
+    if (M_IS_NRV2B(ph.method) || M_IS_NRV2D(ph.method) || M_IS_NRV2E(ph.method))
+        return 3;
+    return 0;
+}
+
 static bool ph_testOverlappingDecompression(const PackHeader &ph, const upx_bytep buf,
                                             const upx_bytep tbuf, unsigned overlap_overhead) {
     if (ph.c_len >= ph.u_len)
@@ -389,12 +462,7 @@ static bool ph_testOverlappingDecompression(const PackHeader &ph, const upx_byte
     assert((int) overlap_overhead >= 0);
     assert((int) (ph.u_len + overlap_overhead) >= 0);
 
-    // Because upx_test_overlap() does not use the asm_fast decompressor
-    // we must account for extra 3 bytes that asm_fast does use,
-    // or else we may fail at runtime decompression.
-    unsigned extra = 0;
-    if (M_IS_NRV2B(ph.method) || M_IS_NRV2D(ph.method) || M_IS_NRV2E(ph.method))
-        extra = 3;
+    const unsigned extra = ph_overlapExtra(ph);
     if (overlap_overhead <= 4 + extra) // don't waste time here
         return false;
     overlap_overhead -= extra;
@@ -413,6 +481,11 @@ bool Packer::testOverlappingDecompression(const upx_bytep buf, const upx_bytep t
     return ph_testOverlappingDecompression(ph, buf, tbuf, overlap_overhead);
 }
 
+bool Packer::testOverlappingDecompression(const PackHeader &ph_, const upx_bytep buf,
+                                          const upx_bytep tbuf, unsigned overlap_overhead) const {
+    return ph_testOverlappingDecompression(ph_, buf, tbuf, overlap_overhead);
+}
+
 void Packer::verifyOverlappingDecompression(Filter *ft) {
     assert(ph.c_len < ph.u_len);
     assert((int) ph.overlap_overhead > 0);
@@ -453,6 +526,30 @@ void Packer::verifyOverlappingDecompression(upx_bytep o_ptr, unsigned o_size, Fi
     decompress(o_ptr + offset, o_ptr, true, ft);
 }
 
+// Return the smallest overlap_overhead for which
+// ph_testOverlappingDecompression() succeeds, or 0 if unknown.
+// Set "is_min" if we also know that all smaller values fail.
+static unsigned ph_findExactOverlap(const PackHeader &ph, const upx_bytep buf,
+                                    const upx_bytep tbuf, bool *is_min) {
+    *is_min = false;
+    if (ph.c_len >= ph.u_len)
+        return 0;
+    unsigned overlap_overhead = 0;
+    int r = upx_find_overlap(buf, ph.c_len, ph.u_len, &overlap_overhead,
+                             forced_method(ph.method), &ph.compress_result);
+    if (r == UPX_E_OUT_OF_MEMORY)
+        throwOutOfMemoryException();
+    if (r != UPX_E_OK)
+        return 0;
+    const unsigned extra = ph_overlapExtra(ph);
+    const unsigned exact = UPX_MAX(overlap_overhead + extra, 5 + extra);
+    // paranoia: check the answer against the real thing
+    if (!ph_testOverlappingDecompression(ph, buf, tbuf, exact))
+        return 0;
+    *is_min = !ph_testOverlappingDecompression(ph, buf, tbuf, exact - 1);
+    return exact;
+}
+
 /*************************************************************************
 // Find overhead for in-place decompression in a heuristic way
 // (using a binary search). Return 0 on error.
@@ -461,15 +558,24 @@ void Packer::verifyOverlappingDecompression(upx_bytep o_ptr, unsigned o_size, Fi
 //   - you can pass the range of an acceptable interval (so that
 //     we can succeed early)
 //   - you can enforce an upper_limit (so that we can fail early)
+//
+// Most methods can compute the threshold in a single decompression pass
+// (see upx_find_overlap). In that case we only verify it and then replay
+// the very same binary search without decompressing again, so the result
+// does not change.
 **************************************************************************/
 
-unsigned Packer::findOverlapOverhead(const upx_bytep buf, const upx_bytep tbuf, unsigned range,
+unsigned Packer::findOverlapOverhead(const PackHeader &ph_, const upx_bytep buf,
+                                     const upx_bytep tbuf, unsigned range,
                                      unsigned upper_limit) const {
     assert((int) range >= 0);
 
+    bool exact_is_min;
+    const unsigned exact = ph_findExactOverlap(ph_, buf, tbuf, &exact_is_min);
+
     // prepare to deal with very pessimistic values
     unsigned low = 1;
-    unsigned high = UPX_MIN(ph.u_len + 512, upper_limit);
+    unsigned high = UPX_MIN(ph_.u_len + 512, upper_limit);
     // but be optimistic for first try (speedup)
     unsigned m = UPX_MIN(16u, high);
     //
@@ -480,8 +586,15 @@ unsigned Packer::findOverlapOverhead(const upx_bytep buf, const upx_bytep tbuf,
         assert(m >= low);
         assert(m <= high);
         assert(m < overhead || overhead == 0);
-        nr++;
-        bool success = testOverlappingDecompression(buf, tbuf, m);
+        bool success;
+        if (exact && m >= exact)
+            success = true;
+        else if (exact && exact_is_min)
+            success = false;
+        else {
+            nr++;
+            success = ph_testOverlappingDecompression(ph_, buf, tbuf, m);
+        }
         // printf("testOverlapOverhead(%d): %d %d: %d -> %d\n", nr, low, high, m, (int)success);
         if (success) {
             overhead = m;
@@ -1061,6 +1174,57 @@ int Packer::getLoaderSize() const {
     return size;
 }
 
+// Most loaders also depend on the compressed and uncompressed sizes,
+// so caching is opt-in.
+bool Packer::getLoaderCacheKey(LoaderCacheKey *key, const Filter *ft) const {
+    UNUSED(key);
+    UNUSED(ft);
+    return false;
+}
+
+// buildLoader() + getLoaderSize(), using the loader cache if possible.
+// Only the size is cached: the caller must still call buildLoader()
+// for the filter it finally selects.
+unsigned Packer::getCandidateLoaderSize(const Filter *ft) {
+    LoaderCacheKey key;
+    mem_clear(&key, sizeof(key));
+    const bool cacheable = getLoaderCacheKey(&key, ft);
+    if (cacheable) {
+        for (unsigned i = 0; i < loader_cache_used; i++) {
+            if (memcmp(&loader_cache[i].key, &key, sizeof(key)) == 0) {
+                loader_cache_hits++;
+                return loader_cache[i].lsize;
+            }
+        }
+        loader_cache_misses++;
+    }
+    buildLoader(ft);
+    const unsigned lsize = getLoaderSize();
+    if (cacheable) {
+        unsigned i = loader_cache_used;
+        if (i < LOADER_CACHE_SIZE)
+            loader_cache_used++;
+        else {
+            i = loader_cache_next;
+            loader_cache_next = (i + 1) % LOADER_CACHE_SIZE;
+        }
+        loader_cache[i].key = key;
+        loader_cache[i].lsize = lsize;
+    }
+    return lsize;
+}
+
+// The same for a candidate that is not this->ph. buildLoader() uses
+// this->ph, so this temporarily swaps it under loader_lock.
+unsigned Packer::getCandidateLoaderSize(const PackHeader &ph_, const Filter *ft) {
+    MutexLocker guard(loader_lock);
+    const PackHeader saved_ph = ph;
+    ph = ph_;
+    const unsigned lsize = getCandidateLoaderSize(ft);
+    ph = saved_ph;
+    return lsize;
+}
+
 bool Packer::hasLoaderSection(const char *name) const {
     void *section = linker->findSection(name, false);
     return section != nullptr;
@@ -1228,6 +1392,28 @@ done:
     return nfilters;
 }
 
+// A candidate of compressWithFilters() can only win if its
+// c_len + lsize + hdr_c_len <= best_total, and as lsize > 0 the encoder
+// may give up as soon as c_len reaches best_total - hdr_c_len.
+static void prepareBudget(upx_compress_config_t &bconf, const upx_compress_config_t *cconf,
+                          unsigned best_total, unsigned hdr_c_len) {
+    bconf.reset();
+    if (cconf)
+        bconf = *cconf;
+    bconf.budget = (best_total > hdr_c_len) ? best_total - hdr_c_len : 1;
+}
+
+// --brute=smart: how many candidates to compress, see rankCandidates()
+static unsigned smartCandidates(unsigned ncandidates) {
+    if (opt->brute_smart > 0 && opt->all_methods)
+        return UPX_MIN(ncandidates, (unsigned) opt->brute_smart);
+    return ncandidates;
+}
+
+static bool skipCandidate(const unsigned *rank, unsigned index) {
+    return rank != nullptr && opt->brute_smart > 0 && rank[index] >= (unsigned) opt->brute_smart;
+}
+
 void Packer::compressWithFilters(upx_bytep i_ptr,
                                  unsigned const i_len,  // written and restored by filters
                                  upx_bytep const o_ptr, // where to put compressed output
@@ -1245,9 +1431,6 @@ void Packer::compressWithFilters(upx_bytep i_ptr,
     PackHeader best_ph = this->ph;
     const Filter orig_ft = *parm_ft;
     Filter best_ft = *parm_ft;
-    //
-    best_ph.c_len = i_len;
-    best_ph.overlap_overhead = 0;
     unsigned best_ph_lsize = 0;
     unsigned best_hdr_c_len = 0;
 
@@ -1260,6 +1443,7 @@ void Packer::compressWithFilters(upx_bytep i_ptr,
     int nmethods = prepareMethods(methods, ph.method, getCompressionMethods(M_ALL, ph.level));
     assert(nmethods > 0);
     assert(nmethods < 256);
+    const int orig_filter_strategy = filter_strategy;
     int filters[256];
     int nfilters = prepareFilters(filters, filter_strategy, getFilters());
     assert(nfilters > 0);
@@ -1272,159 +1456,403 @@ void Packer::compressWithFilters(upx_bytep i_ptr,
     printf("\n");
 #endif
 
+    const unsigned ncandidates = (filter_strategy < 0) ? nmethods : nmethods * nfilters;
+    const unsigned npasses = smartCandidates(ncandidates);
+
     // update total_passes; previous (ui_total_passes > 0) means incremental
     if (!is_forced_method(ph.method)) {
         if (uip->ui_total_passes > 0)
             uip->ui_total_passes -= 1;
-        if (filter_strategy < 0)
-            uip->ui_total_passes += nmethods;
-        else
-            uip->ui_total_passes += nfilters * nmethods;
+        uip->ui_total_passes += npasses;
     }
 
-    // Working buffer for compressed data. Don't waste memory and allocate as needed.
-    upx_bytep o_tmp = o_ptr;
-    MemBuffer o_tmp_buf;
+    // before any filter gets applied to i_ptr[]
+    for (int mm = 0; mm < nmethods; mm++)
+        tuneLzma(i_ptr, i_len, methods[mm], cconf);
+
+    // compress using all methods/filters; on one thread with a progress
+    // bar for each candidate, else with one for all of them
+    const bool each_ui = upx_parallel_threads(ncandidates) <= 1;
+    if (!each_ui) {
+        uip->startCallback(i_len, 0, uip->ui_pass >= 0 ? uip->ui_pass + 1 : uip->ui_pass,
+                           uip->ui_total_passes);
+        uip->firstCallback();
+    }
+    const int nfilters_success_total = compressCandidates(
+        orig_ph, orig_ft, i_ptr, i_len, o_ptr, f_ptr, f_len, hdr_ptr, hdr_len, overlap_range,
+        cconf, orig_filter_strategy, best_ph, best_ft, best_ph_lsize, best_hdr_c_len, each_ui);
+    if (!each_ui) {
+        if (uip->ui_pass >= 0)
+            uip->ui_pass += npasses;
+        uip->finalCallback(i_len, best_ph.c_len);
+        uip->endCallback();
+    }
 
-    // compress using all methods/filters
-    int nfilters_success_total = 0;
-    for (int mm = 0; mm < nmethods; mm++) // for all methods
-    {
-#if 0  //{
-        printf("\nmethod %d (%d of %d)\n", methods[mm], 1+ mm, nmethods);
-#endif //}
-        assert(isValidCompressionMethod(methods[mm]));
-        unsigned hdr_c_len = 0;
-        if (hdr_ptr != nullptr && hdr_len) {
-            if (nfilters_success_total != 0 && o_tmp == o_ptr) {
-                // do not overwrite o_ptr
-                o_tmp_buf.allocForCompression(UPX_MAX(hdr_len, i_len));
-                o_tmp = o_tmp_buf;
-            }
-            int r = upx_compress(hdr_ptr, hdr_len, o_tmp, &hdr_c_len, nullptr, methods[mm], 10,
-                                 nullptr, nullptr);
+    // postconditions 1)
+    assert(nfilters_success_total > 0);
+    assert(best_ph.u_len == orig_ph.u_len);
+    assert(best_ph.filter == best_ft.id);
+    assert(best_ph.filter_cto == best_ft.cto);
+    // FIXME  assert(best_ph.n_mru == best_ft.n_mru);
+    UNUSED(nfilters_success_total);
+
+    useBestCandidate(best_ph, best_ft, best_ph_lsize, parm_ft, inhibit_compression_check);
+}
+
+// The end of compressWithFilters(): copy back the results of the search.
+void Packer::useBestCandidate(const PackHeader &best_ph, const Filter &best_ft,
+                              unsigned best_ph_lsize, Filter *parm_ft,
+                              bool inhibit_compression_check) {
+    // copy back results
+    this->ph = best_ph;
+    *parm_ft = best_ft;
+
+    // Finally, check compression ratio.
+    // Might be inhibited when blocksize < file_size, for instance.
+    if (!inhibit_compression_check) {
+        if (best_ph.c_len + best_ph_lsize >= best_ph.u_len)
+            throwNotCompressible();
+        if (!checkCompressionRatio(best_ph.u_len, best_ph.c_len))
+            throwNotCompressible();
+
+        // postconditions 2)
+        assert(best_ph.overlap_overhead > 0);
+    }
+
+    // convenience; also needed because the loader cache only stores sizes
+    buildLoader(&best_ft);
+}
+
+/*************************************************************************
+// The candidate search of compressWithFilters(). It only reads orig_ph
+// and orig_ft, so the candidates can be tried on several threads at once
+// (unless this already runs inside a worker, see parallel.h). The winner
+// is selected by the same rules for any number of threads (ties are
+// resolved in favour of the candidate that comes first), and a candidate
+// only gives up once it is sure to lose (see prepareBudget()), so the
+// output does not depend on the number of threads.
+//
+// Each thread has one working set, which goes from candidate to
+// candidate: a copy of i_ptr[] for the filters and a buffer for the
+// compressed data. The candidates without a filter share i_ptr[] and
+// only use the copy to verify the compression. On a single thread the
+// filters work on i_ptr[] itself and restore it, the first candidate
+// compresses right into o_ptr[], and with_ui may show a progress bar
+// for each candidate.
+// Returns the number of successful filter calls.
+**************************************************************************/
+
+namespace {
+struct CandidateWorkingSet {
+    MemBuffer ibuf; // allocated as needed
+    MemBuffer obuf;
+    bool ibuf_copy = false; // ibuf[] holds the unfiltered i_ptr[]
+    bool busy = false;
+};
+} // namespace
+
+int Packer::compressCandidates(const PackHeader &orig_ph, const Filter &orig_ft, upx_bytep i_ptr,
+                               unsigned i_len, upx_bytep o_ptr, upx_bytep f_ptr, unsigned f_len,
+                               const upx_bytep hdr_ptr, unsigned hdr_len, unsigned overlap_range,
+                               const upx_compress_config_t *cconf, int filter_strategy,
+                               PackHeader &best_ph, Filter &best_ft, unsigned &best_ph_lsize,
+                               unsigned &best_hdr_c_len, bool with_ui) {
+    best_ph = orig_ph;
+    best_ph.c_len = i_len;
+    best_ph.overlap_overhead = 0;
+    best_ft = orig_ft;
+    best_ph_lsize = 0;
+    best_hdr_c_len = 0;
+
+    int methods[256];
+    const int nmethods =
+        prepareMethods(methods, orig_ph.method, getCompressionMethods(M_ALL, orig_ph.level));
+    assert(nmethods > 0);
+    assert(nmethods < 256);
+    int filters[256];
+    const int nfilters = prepareFilters(filters, filter_strategy, getFilters());
+    assert(nfilters > 0);
+    assert(nfilters < 256);
+    const unsigned ncandidates = (filter_strategy < 0) ? nmethods : nmethods * nfilters;
+    MemBuffer rank_buf;
+    const unsigned *rank = rankCandidates(rank_buf, orig_ft, i_ptr, i_len, f_ptr, f_len, methods,
+                                          nmethods, filters, nfilters, filter_strategy);
+
+    unsigned hdr_c_lens[256];
+    memset(hdr_c_lens, 0, sizeof(hdr_c_lens));
+    if (hdr_ptr != nullptr && hdr_len) {
+        MemBuffer hdr_tmp;
+        hdr_tmp.allocForCompression(hdr_len);
+        for (int mm = 0; mm < nmethods; mm++) {
+            assert(isValidCompressionMethod(methods[mm]));
+            int r = upx_compress(hdr_ptr, hdr_len, hdr_tmp, &hdr_c_lens[mm], nullptr, methods[mm],
+                                 10, nullptr, nullptr);
             if (r != UPX_E_OK)
                 throwInternalError("header compression failed");
-            if (hdr_c_len >= hdr_len)
+            if (hdr_c_lens[mm] >= hdr_len)
                 throwInternalError("header compression size increase");
         }
-        int nfilters_success_mm = 0;
-        for (int ff = 0; ff < nfilters; ff++) // for all filters
-        {
+    }
+    int nfilters_success_total = 0;
+    int nfilters_success[256];
+    memset(nfilters_success, 0, sizeof(nfilters_success));
+    unsigned best_index = ~0u;
+    upx_mutex_t lock;
+    const unsigned f_off = ptr_udiff(f_ptr, i_ptr);
+
+    const unsigned n_threads = upx_parallel_threads(ncandidates);
+    assert(n_threads == 1 || !with_ui);
+    struct WorkingSets {
+        CandidateWorkingSet *ws;
+        explicit WorkingSets(unsigned n) : ws(new CandidateWorkingSet[n]) {}
+        ~WorkingSets() { delete[] ws; }
+    } sets(n_threads);
+    // a free working set for the time of one candidate
+    struct Lease {
+        CandidateWorkingSet *ws = nullptr;
+        upx_mutex_t &lock;
+        Lease(WorkingSets &sets, unsigned n, upx_mutex_t &lock_) : lock(lock_) {
+            MutexLocker guard(lock);
+            for (unsigned i = 0; ws == nullptr; i++) {
+                assert(i < n);
+                if (!sets.ws[i].busy)
+                    ws = &sets.ws[i];
+            }
+            ws->busy = true;
+        }
+        ~Lease() {
+            MutexLocker guard(lock);
+            ws->busy = false;
+        }
+    };
+
+    auto candidate = [&](unsigned index) {
+        if (skipCandidate(rank, index))
+            return;
+        const int mm = (filter_strategy < 0) ? index : index / nfilters;
+        const int ff_first = (filter_strategy < 0) ? 0 : index % nfilters;
+        const int ff_last = (filter_strategy < 0) ? nfilters : ff_first + 1;
+        assert(isValidCompressionMethod(methods[mm]));
+        const unsigned hdr_c_len = hdr_c_lens[mm];
+        Lease lease(sets, n_threads, lock);
+        CandidateWorkingSet &ws = *lease.ws;
+        for (int ff = ff_first; ff < ff_last; ff++) {
             assert(isValidFilter(filters[ff]));
-            // get fresh packheader
-            ph = orig_ph;
-            ph.method = methods[mm];
-            ph.filter = filters[ff];
-            ph.overlap_overhead = 0;
-            // get fresh filter
+            PackHeader cph = orig_ph;
+            cph.u_len = i_len;
+            cph.method = methods[mm];
+            cph.filter = filters[ff];
+            cph.overlap_overhead = 0;
             Filter ft = orig_ft;
-            ft.init(ph.filter, orig_ft.addvalue);
-            // filter
-            optimizeFilter(&ft, f_ptr, f_len);
-            bool success = ft.filter(f_ptr, f_len);
+            ft.init(cph.filter, orig_ft.addvalue);
+            // the input, and where compress() verifies it
+            upx_bytep w_i_ptr = i_ptr;
+            upx_bytep v_ptr = nullptr;
+            if (n_threads > 1 && (ft.id != 0 || !ph_skipVerify(cph))) {
+                if (ws.ibuf.getSize() == 0)
+                    ws.ibuf.alloc(i_len);
+                if (ft.id != 0) {
+                    if (!ws.ibuf_copy)
+                        memcpy(ws.ibuf, i_ptr, i_len);
+                    ws.ibuf_copy = true; // again after ft.unfilter()
+                    w_i_ptr = ws.ibuf;
+                } else
+                    v_ptr = ws.ibuf;
+            }
+            upx_bytep const w_f_ptr = w_i_ptr + f_off;
+            optimizeFilter(&ft, w_f_ptr, f_len);
+            bool success = ft.filter(w_f_ptr, f_len);
             if (ft.id != 0 && ft.calls == 0) {
                 // filter did not do anything - no need to call ft.unfilter()
                 success = false;
             }
             if (!success) {
-                // filter failed or was useless
-                if (filter_strategy >= 0) {
-                    // adjust ui passes
-                    if (uip->ui_pass >= 0)
-                        uip->ui_pass++;
-                }
+                // filter failed or was useless; adjust ui passes
+                if (with_ui && filter_strategy >= 0 && uip->ui_pass >= 0)
+                    uip->ui_pass++;
                 continue;
             }
-            // filter success
-#if 0
-            printf("\nfilter: id 0x%02x size %6d, calls %5d/%5d/%3d/%5d/%5d, cto 0x%02x\n",
-                   ft.id, ft.buf_len, ft.calls, ft.noncalls, ft.wrongcalls, ft.firstcall, ft.lastcall, ft.cto);
-#endif
-            if (nfilters_success_total != 0 && o_tmp == o_ptr) {
-                o_tmp_buf.allocForCompression(i_len);
-                o_tmp = o_tmp_buf;
+            {
+                MutexLocker guard(lock);
+                nfilters_success_total++;
+                nfilters_success[mm]++;
             }
-            nfilters_success_total++;
-            nfilters_success_mm++;
-            ph.filter_cto = ft.cto;
-            ph.n_mru = ft.n_mru;
-            // compress
-            if (compress(i_ptr, i_len, o_tmp, cconf)) {
-                unsigned lsize = 0;
-                // findOverlapOperhead() might be slow; omit if already too big.
-                if (ph.c_len + lsize + hdr_c_len <=
-                    best_ph.c_len + best_ph_lsize + best_hdr_c_len) {
-                    // get results
-                    ph.overlap_overhead = findOverlapOverhead(o_tmp, i_ptr, overlap_range);
-                    buildLoader(&ft);
-                    lsize = getLoaderSize();
-                    assert(lsize > 0);
+            cph.filter_cto = ft.cto;
+            cph.n_mru = ft.n_mru;
+            // on one thread nothing needs to be kept in o_ptr[] before the first success
+            upx_bytep w_o_ptr = o_ptr;
+            if (n_threads > 1 || best_index != ~0u) {
+                if (ws.obuf.getSize() == 0)
+                    ws.obuf.allocForCompression(i_len);
+                w_o_ptr = ws.obuf;
+            }
+            // compress, giving up when sure to lose
+            upx_compress_config_t bconf;
+            {
+                MutexLocker guard(lock);
+                const unsigned best_total = best_ph.c_len + best_ph_lsize + best_hdr_c_len;
+                prepareBudget(bconf, cconf, best_total, hdr_c_len);
+            }
+            if (with_ui)
+                startCompressCallback(uip, cph);
+            const bool ok = compress(cph, w_i_ptr, i_len, w_o_ptr,
+                                     with_ui ? uip->getCallback() : nullptr, &bconf, v_ptr);
+            if (with_ui)
+                uip->endCallback();
+            if (ok) {
+                bool too_big;
+                {
+                    MutexLocker guard(lock);
+                    too_big =
+                        cph.c_len + hdr_c_len > best_ph.c_len + best_ph_lsize + best_hdr_c_len;
                 }
-#if 0  //{
-                printf("\n%2d %02x: %d +%4d +%3d = %d  (best: %d +%4d +%3d = %d)\n", ph.method, ph.filter,
-                       ph.c_len, lsize, hdr_c_len, ph.c_len + lsize + hdr_c_len,
-                       best_ph.c_len, best_ph_lsize, best_hdr_c_len, best_ph.c_len + best_ph_lsize + best_hdr_c_len);
-#endif //}
-                bool update = false;
-                if (ph.c_len + lsize + hdr_c_len < best_ph.c_len + best_ph_lsize + best_hdr_c_len)
-                    update = true;
-                else if (ph.c_len + lsize + hdr_c_len ==
-                         best_ph.c_len + best_ph_lsize + best_hdr_c_len) {
-                    // prefer smaller loaders
-                    if (lsize + hdr_c_len < best_ph_lsize + best_hdr_c_len)
+                // findOverlapOverhead() might be slow; omit if already too big.
+                if (!too_big) {
+                    cph.overlap_overhead =
+                        findOverlapOverhead(cph, w_o_ptr, w_i_ptr, overlap_range);
+                    const unsigned lsize = getCandidateLoaderSize(cph, &ft);
+                    assert(lsize > 0);
+                    MutexLocker guard(lock);
+                    const unsigned total = cph.c_len + lsize + hdr_c_len;
+                    const unsigned best_total = best_ph.c_len + best_ph_lsize + best_hdr_c_len;
+                    bool update = false;
+                    if (total < best_total)
                         update = true;
-                    else if (lsize + hdr_c_len == best_ph_lsize + best_hdr_c_len) {
-                        // prefer less overlap_overhead
-                        if (ph.overlap_overhead < best_ph.overlap_overhead)
+                    else if (total == best_total) {
+                        // prefer smaller loaders
+                        if (lsize + hdr_c_len < best_ph_lsize + best_hdr_c_len)
                             update = true;
+                        else if (lsize + hdr_c_len == best_ph_lsize + best_hdr_c_len) {
+                            // prefer less overlap_overhead
+                            if (cph.overlap_overhead < best_ph.overlap_overhead)
+                                update = true;
+                            else if (cph.overlap_overhead == best_ph.overlap_overhead)
+                                update = index < best_index;
+                        }
+                    }
+                    if (update) {
+                        assert((int) cph.overlap_overhead > 0);
+                        // update o_ptr[] with best version
+                        if (w_o_ptr != o_ptr)
+                            memcpy(o_ptr, w_o_ptr, cph.c_len);
+                        best_ph = cph;
+                        best_ph_lsize = lsize;
+                        best_hdr_c_len = hdr_c_len;
+                        best_ft = ft;
+                        best_index = index;
                     }
-                }
-                if (update) {
-                    assert((int) ph.overlap_overhead > 0);
-                    // update o_ptr[] with best version
-                    if (o_tmp != o_ptr)
-                        memcpy(o_ptr, o_tmp, ph.c_len);
-                    // save compression results
-                    best_ph = ph;
-                    best_ph_lsize = lsize;
-                    best_hdr_c_len = hdr_c_len;
-                    best_ft = ft;
                 }
             }
             // restore - unfilter with verify
-            ft.unfilter(f_ptr, f_len, true);
-            if (filter_strategy < 0)
-                break;
+            ft.unfilter(w_f_ptr, f_len, true);
+            break;
         }
-        assert(nfilters_success_mm > 0);
-    }
+    };
+    upx_parallel_for(ncandidates, candidate);
 
-    // postconditions 1)
-    assert(nfilters_success_total > 0);
-    assert(best_ph.u_len == orig_ph.u_len);
-    assert(best_ph.filter == best_ft.id);
-    assert(best_ph.filter_cto == best_ft.cto);
-    // FIXME  assert(best_ph.n_mru == best_ft.n_mru);
+    for (int mm = 0; mm < nmethods; mm++)
+        assert(nfilters_success[mm] > 0 || smartCandidates(ncandidates) < ncandidates);
+    noteCandidateRank(rank, ncandidates, best_index);
+    if (best_index != ~0u)
+        best_ft.buf = f_ptr; // maybe was the private copy
+    return nfilters_success_total;
+}
 
-    // copy back results
-    this->ph = best_ph;
-    *parm_ft = best_ft;
+/*************************************************************************
+// Predict the order of the candidates of compressWithFilters(), so that
+// --brute=smart only needs to compress the most promising ones; with -v
+// this is done for --brute as well, to see how good the prediction is.
+//
+// The sample consists of up to four 64 KiB windows spread over i_ptr[].
+// Each candidate filters a copy of the whole sample and compresses it
+// with the fastest level of its method. Filters that would not do
+// anything on f_ptr[] (see Filter::scan) come last, as they get skipped.
+// Returns nullptr if there is no need for a ranking, else rank[index]
+// with the index of compressCandidates(): 0 is the most promising one,
+// ties are resolved in favour of the candidate that comes first.
+**************************************************************************/
 
-    // Finally, check compression ratio.
-    // Might be inhibited when blocksize < file_size, for instance.
-    if (!inhibit_compression_check) {
-        if (best_ph.c_len + best_ph_lsize >= best_ph.u_len)
-            throwNotCompressible();
-        if (!checkCompressionRatio(best_ph.u_len, best_ph.c_len))
-            throwNotCompressible();
+const unsigned *Packer::rankCandidates(MemBuffer &rank_buf, const Filter &orig_ft,
+                                       const upx_bytep i_ptr, unsigned i_len,
+                                       const upx_bytep f_ptr, unsigned f_len, const int *methods,
+                                       int nmethods, const int *filters, int nfilters,
+                                       int filter_strategy) const {
+    enum { WINDOW = 64 * 1024, MAX_WINDOWS = 4 };
+    const unsigned ncandidates = (filter_strategy < 0) ? nmethods : nmethods * nfilters;
+    if (ncandidates <= 1 || !opt->all_methods)
+        return nullptr;
+    if (smartCandidates(ncandidates) == ncandidates && opt->verbose < 3)
+        return nullptr;
+
+    // the sample
+    const unsigned nwindows = UPX_MIN((unsigned) MAX_WINDOWS, (i_len + WINDOW - 1) / WINDOW);
+    const unsigned s_len = UPX_MIN(i_len, nwindows * WINDOW);
+    MemBuffer s_buf(s_len);
+    if (s_len == i_len)
+        memcpy(s_buf, i_ptr, s_len);
+    else
+        for (unsigned w = 0; w < nwindows; w++) {
+            const upx_uint64_t off = (upx_uint64_t) (i_len - WINDOW) * w / (nwindows - 1);
+            memcpy(s_buf + w * WINDOW, i_ptr + (size_t) off, WINDOW);
+        }
 
-        // postconditions 2)
-        assert(best_ph.overlap_overhead > 0);
+    bool useless[256];
+    for (int ff = 0; ff < nfilters; ff++) {
+        Filter ft = orig_ft;
+        ft.init(filters[ff], orig_ft.addvalue);
+        optimizeFilter(&ft, f_ptr, f_len);
+        useless[ff] = ft.id != 0 && (!ft.scan(f_ptr, f_len) || ft.calls == 0);
     }
 
-    // convenience
-    buildLoader(&best_ft);
+    MemBuffer score_buf(mem_size(sizeof(unsigned), ncandidates));
+    unsigned *const score = (unsigned *) score_buf.getVoidPtr();
+    auto candidate = [&](unsigned index) {
+        const int mm = (filter_strategy < 0) ? index : index / nfilters;
+        // filter_strategy < 0 uses the first working filter, usually the first one
+        int ff = (filter_strategy < 0) ? 0 : index % nfilters;
+        while (filter_strategy < 0 && ff < nfilters && useless[ff])
+            ff++;
+        score[index] = ~0u;
+        if (ff >= nfilters || useless[ff])
+            return;
+        MemBuffer w_buf(s_len);
+        memcpy(w_buf, s_buf, s_len);
+        Filter ft = orig_ft;
+        ft.init(filters[ff], orig_ft.addvalue);
+        optimizeFilter(&ft, w_buf, s_len);
+        if (ft.id != 0 && !ft.filter(w_buf, s_len))
+            memcpy(w_buf, s_buf, s_len);
+        MemBuffer c_buf;
+        c_buf.allocForCompression(s_len);
+        unsigned c_len = c_buf.getSize();
+        if (upx_compress(w_buf, s_len, c_buf, &c_len, nullptr, methods[mm], 1, nullptr,
+                         nullptr) == UPX_E_OK)
+            score[index] = c_len;
+    };
+    upx_parallel_for(ncandidates, candidate);
+
+    rank_buf.alloc(mem_size(sizeof(unsigned), ncandidates));
+    unsigned *const rank = (unsigned *) rank_buf.getVoidPtr();
+    for (unsigned i = 0; i < ncandidates; i++) {
+        rank[i] = 0;
+        for (unsigned j = 0; j < ncandidates; j++)
+            if (score[j] < score[i] || (score[j] == score[i] && j < i))
+                rank[i]++;
+    }
+    return rank;
+}
+
+// for the statistics printed by UiPacker::uiPackEnd()
+void Packer::noteCandidateRank(const unsigned *rank, unsigned ncandidates,
+                               unsigned best_index) {
+    if (rank == nullptr || best_index >= ncandidates)
+        return;
+    MutexLocker guard(loader_lock);
+    rank_searches++;
+    if (rank[best_index] == 0)
+        rank_hits++;
+    rank_worst = UPX_MAX(rank_worst, rank[best_index] + 1);
+    rank_candidates = UPX_MAX(rank_candidates, ncandidates);
 }
 
 /*************************************************************************
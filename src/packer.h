@@ -29,6 +29,7 @@
 #define __UPX_PACKER_H 1
 
 #include "mem.h"
+#include "parallel.h"
 
 class InputFile;
 class OutputFile;
@@ -165,6 +166,9 @@ protected:
     // main compression drivers
     virtual bool compress(upx_bytep i_ptr, unsigned i_len, upx_bytep o_ptr,
                           const upx_compress_config_t *cconf = nullptr);
+    bool compress(PackHeader &ph_, upx_bytep i_ptr, unsigned i_len, upx_bytep o_ptr,
+                  upx_callback_p cb, const upx_compress_config_t *cconf,
+                  upx_bytep v_ptr = nullptr) const;
     virtual void decompress(const upx_bytep in, upx_bytep out, bool verify_checksum = true,
                             Filter *ft = nullptr);
     virtual bool checkDefaultCompressionRatio(unsigned u_len, unsigned c_len) const;
@@ -188,14 +192,38 @@ protected:
                              Filter *parm_ft, // updated
                              unsigned overlap_range, upx_compress_config_t const *cconf,
                              int filter_strategy, bool inhibit_compression_check = false);
+    // the parts of the real compression driver
+    int compressCandidates(const PackHeader &orig_ph, const Filter &orig_ft, upx_bytep i_ptr,
+                           unsigned i_len, upx_bytep o_ptr, upx_bytep f_ptr, unsigned f_len,
+                           const upx_bytep hdr_ptr, unsigned hdr_len, unsigned overlap_range,
+                           const upx_compress_config_t *cconf, int filter_strategy,
+                           PackHeader &best_ph, Filter &best_ft, unsigned &best_ph_lsize,
+                           unsigned &best_hdr_c_len, bool with_ui = false);
+    const unsigned *rankCandidates(MemBuffer &rank_buf, const Filter &orig_ft,
+                                   const upx_bytep i_ptr, unsigned i_len, const upx_bytep f_ptr,
+                                   unsigned f_len, const int *methods, int nmethods,
+                                   const int *filters, int nfilters, int filter_strategy) const;
+    void noteCandidateRank(const unsigned *rank, unsigned ncandidates, unsigned best_index);
+    void useBestCandidate(const PackHeader &best_ph, const Filter &best_ft,
+                          unsigned best_ph_lsize, Filter *parm_ft,
+                          bool inhibit_compression_check);
+    void tuneLzma(const upx_bytep buf, unsigned len, int method,
+                  const upx_compress_config_t *cconf);
 
     // util for verifying overlapping decompresion
     //   non-destructive test
     virtual bool testOverlappingDecompression(const upx_bytep buf, const upx_bytep tbuf,
                                               unsigned overlap_overhead) const;
+    bool testOverlappingDecompression(const PackHeader &ph_, const upx_bytep buf,
+                                      const upx_bytep tbuf, unsigned overlap_overhead) const;
     //   non-destructive find
-    virtual unsigned findOverlapOverhead(const upx_bytep buf, const upx_bytep tbuf,
-                                         unsigned range = 0, unsigned upper_limit = ~0u) const;
+    unsigned findOverlapOverhead(const upx_bytep buf, const upx_bytep tbuf, unsigned range = 0,
+                                 unsigned upper_limit = ~0u) const {
+        return findOverlapOverhead(ph, buf, tbuf, range, upper_limit);
+    }
+    virtual unsigned findOverlapOverhead(const PackHeader &ph_, const upx_bytep buf,
+                                         const upx_bytep tbuf, unsigned range = 0,
+                                         unsigned upper_limit = ~0u) const;
     //   destructive decompress + verify
     void verifyOverlappingDecompression(Filter *ft = nullptr);
     void verifyOverlappingDecompression(upx_bytep o_ptr, unsigned o_size, Filter *ft = nullptr);
@@ -210,6 +238,17 @@ protected:
     virtual void buildLoader(const Filter *ft) = 0;
     virtual Linker *newLinker() const = 0;
     virtual void relocateLoader();
+    // loader cache for compressWithFilters(), see getLoaderCacheKey()
+    struct LoaderCacheKey {
+        int method;
+        int filter;
+        int filter_cto;
+        int n_mru;
+    };
+    // return false if the loader size depends on more than the key
+    virtual bool getLoaderCacheKey(LoaderCacheKey *key, const Filter *ft) const;
+    unsigned getCandidateLoaderSize(const Filter *ft);
+    unsigned getCandidateLoaderSize(const PackHeader &ph_, const Filter *ft); // thread-safe
     // loader util for linker
     virtual upx_byte *getLoader() const;
     virtual int getLoaderSize() const;
@@ -318,6 +357,29 @@ protected:
     // linker
     Linker *linker = nullptr;
 
+    // loader sizes of the compressWithFilters() candidates
+    enum { LOADER_CACHE_SIZE = 64 };
+    struct LoaderCacheEntry {
+        LoaderCacheKey key;
+        unsigned lsize;
+    };
+    LoaderCacheEntry loader_cache[LOADER_CACHE_SIZE];
+    unsigned loader_cache_used = 0;
+    unsigned loader_cache_next = 0;
+    unsigned loader_cache_hits = 0;
+    unsigned loader_cache_misses = 0;
+    upx_mutex_t loader_lock; // for compressCandidates()
+
+    // predicted rank of the winners of compressWithFilters(), for "-v"
+    unsigned rank_searches = 0;
+    unsigned rank_hits = 0;  // the winner was predicted to be the best
+    unsigned rank_worst = 0; // worst predicted rank of a winner, 1-based
+    unsigned rank_candidates = 0;
+
+    // --lzma-tune, see tuneLzma()
+    bool lzma_tuned = false;
+    lzma_compress_config_t lzma_tune;
+
 private:
     // private to checkPatch()
     void *last_patch = nullptr;
@@ -38,7 +38,7 @@
 
 bool Packer::isValidCompressionMethod(int method)
 {
-    if (M_IS_LZMA(method))
+    if (M_IS_LZMA(method) || M_IS_LZ4(method) || M_IS_ZSTD(method) || M_IS_DEFLATE(method))
         return true;
     return (method >= M_NRV2B_LE32 && method <= M_LZMA);
 }
@@ -77,10 +77,22 @@ const int *Packer::getDefaultCompressionMethods_le32(int method, int level, int
     static const int m_nrv2b[] = { M_NRV2B_LE32, M_END };
     static const int m_nrv2d[] = { M_NRV2D_LE32, M_END };
     static const int m_nrv2e[] = { M_NRV2E_LE32, M_END };
+    static const int m_lz4[]   = { M_LZ4, M_END };
+    static const int m_zstd[]  = { M_ZSTD, M_END };
+    static const int m_deflate[] = { M_DEFLATE, M_END };
+    static const int m_all_zstd[] = { M_NRV2B_LE32, M_NRV2D_LE32, M_NRV2E_LE32, M_LZMA, M_ZSTD, M_DEFLATE, M_ULTRA_BRUTE, M_LZMA_003, M_LZMA_407, M_END };
 
-    if (method == M_ALL)    return m_all;
+    // only the linux/amd64 stub has an LZ4, a zstd or a deflate decompressor
+    const bool amd64 = UPX_F_LINUX_ELF64_AMD == ph.format;
+    if (method == M_ALL)    return amd64 ? m_all_zstd : m_all;
     //if (M_IS_CL1B(method))  return m_cl1b;
     if (M_IS_LZMA(method))  return m_lzma;
+    if (M_IS_LZ4(method) && amd64)
+        return m_lz4;
+    if (M_IS_ZSTD(method) && amd64)
+        return m_zstd;
+    if (M_IS_DEFLATE(method) && amd64)
+        return m_deflate;
     if (M_IS_NRV2B(method)) return m_nrv2b;
     if (M_IS_NRV2D(method)) return m_nrv2d;
     if (M_IS_NRV2E(method)) return m_nrv2e;
@@ -190,6 +202,12 @@ const char *Packer::getDecompressorSections() const
         "LZMA_ELF00,LZMA_DEC10,LZMA_DEC30";
     static const char lzma_elf_fast[] =
         "LZMA_ELF00,LZMA_DEC20,LZMA_DEC30";
+    static const char lz4_elf[] =
+        "LZ4_ELF00";
+    static const char zstd_elf[] =
+        "ZSTD_ELF00,ZSTD_DEC20,ZSTD_DEC30";
+    static const char deflate_elf[] =
+        "DEFLATE_ELF00,DEFLATE_DEC20,DEFLATE_DEC30";
 
     if (ph.method == M_NRV2B_LE32)
         return opt->small ? nrv2b_le32_small : nrv2b_le32_fast;
@@ -222,6 +240,21 @@ const char *Packer::getDecompressorSections() const
         }
         return opt->small ? lzma_small  : lzma_fast;
     }
+    if (M_IS_LZ4(ph.method)) {
+        if (UPX_F_LINUX_ELF64_AMD  ==ph.format) {
+            return lz4_elf;
+        }
+    }
+    if (M_IS_ZSTD(ph.method)) {
+        if (UPX_F_LINUX_ELF64_AMD  ==ph.format) {
+            return zstd_elf;
+        }
+    }
+    if (M_IS_DEFLATE(ph.method)) {
+        if (UPX_F_LINUX_ELF64_AMD  ==ph.format) {
+            return deflate_elf;
+        }
+    }
     throwInternalError("bad decompressor");
     return nullptr;
 }
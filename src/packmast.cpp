@@ -58,10 +58,12 @@
 **************************************************************************/
 
 PackMaster::PackMaster(InputFile *f, options_t *o) : fi(f), p(nullptr) {
-    // replace global options with local options
-    saved_opt = o;
+    // replace the options of this thread with local options; as "opt"
+    // is thread_local, other threads are not affected
+    saved_opt = nullptr;
     if (o) {
         memcpy(&this->local_options, o, sizeof(*o)); // struct copy
+        saved_opt = opt;
         opt = &this->local_options;
     }
 }
@@ -70,7 +72,7 @@ PackMaster::~PackMaster() {
     fi = nullptr;
     delete p;
     p = nullptr;
-    // restore global options
+    // restore options
     if (saved_opt)
         opt = saved_opt;
     saved_opt = nullptr;
@@ -57,7 +57,8 @@ private:
     static Packer *getPacker(InputFile *f);
     static Packer *getUnpacker(InputFile *f);
 
-    // setup local options for each file
+    // setup local options for each file; a PackMaster must be
+    // created and destroyed by the same thread
     options_t local_options;
     options_t *saved_opt;
 };
@@ -0,0 +1,230 @@
+/* parallel.cpp --
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2022 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2022 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+#include "conf.h"
+#include "parallel.h"
+
+#if (WITH_THREADS)
+#include <atomic>
+#include <mutex>
+#include <thread>
+#endif
+
+// max number of threads, see also option '--threads='
+#define UPX_MAX_THREADS 256
+
+/*************************************************************************
+// each worker runs with a private copy of the options of the caller,
+// like PackMaster does; changes which a worker makes to "opt" are lost
+**************************************************************************/
+
+namespace {
+struct WorkerOptions final {
+    explicit WorkerOptions(const options_t *o) : saved_opt(opt) {
+        memcpy(&local_options, o, sizeof(*o)); // struct copy
+        opt = &local_options;
+    }
+    ~WorkerOptions() { opt = saved_opt; }
+
+    options_t local_options;
+    options_t *const saved_opt;
+};
+} // namespace
+
+/*************************************************************************
+//
+**************************************************************************/
+
+#if (WITH_THREADS)
+
+static thread_local bool in_worker = false;
+
+unsigned upx_parallel_threads(unsigned n_items, int threads) {
+    if (n_items <= 1 || in_worker)
+        return 1;
+    unsigned n = threads > 0 ? (unsigned) threads : 1;
+    if (threads == 0) { // use one thread per CPU
+        n = std::thread::hardware_concurrency();
+        if (n == 0)
+            n = 1;
+    }
+    n = UPX_MIN(n, n_items);
+    return UPX_MIN(n, (unsigned) UPX_MAX_THREADS);
+}
+
+namespace {
+struct ParallelState {
+    upx_parallel_func_t func;
+    void *user;
+    unsigned n_items;
+    const options_t *opt; // copied by each worker
+    std::atomic<unsigned> next_item;
+    std::atomic<bool> failed;
+    std::mutex lock;
+    std::exception_ptr exc;
+};
+} // namespace
+
+static void parallel_worker(ParallelState *st) {
+    const bool saved_in_worker = in_worker;
+    WorkerOptions worker_options(st->opt);
+    in_worker = true;
+    while (!st->failed) {
+        unsigned i = st->next_item++;
+        if (i >= st->n_items)
+            break;
+        try {
+            st->func(i, st->user);
+        } catch (...) {
+            std::lock_guard<std::mutex> guard(st->lock);
+            if (!st->exc)
+                st->exc = std::current_exception();
+            st->failed = true;
+        }
+    }
+    in_worker = saved_in_worker;
+}
+
+void upx_parallel_for(unsigned n_items, int threads, upx_parallel_func_t func, void *user) {
+    const unsigned n_threads = upx_parallel_threads(n_items, threads);
+    if (n_threads <= 1) {
+        WorkerOptions worker_options(opt);
+        for (unsigned i = 0; i < n_items; i++)
+            func(i, user);
+        return;
+    }
+
+    ParallelState st;
+    st.func = func;
+    st.user = user;
+    st.n_items = n_items;
+    st.opt = opt;
+    st.next_item = 0;
+    st.failed = false;
+
+    std::thread workers[UPX_MAX_THREADS];
+    unsigned n_started = 0;
+    try {
+        for (; n_started < n_threads - 1; n_started++)
+            workers[n_started] = std::thread(parallel_worker, &st);
+    } catch (const std::system_error &) {
+        // could not create more threads - just go on with what we have
+    }
+    parallel_worker(&st); // the calling thread is a worker as well
+    for (unsigned t = 0; t < n_started; t++)
+        workers[t].join();
+
+    if (st.exc)
+        std::rethrow_exception(st.exc);
+}
+
+#else // WITH_THREADS
+
+unsigned upx_parallel_threads(unsigned n_items, int threads) {
+    UNUSED(n_items);
+    UNUSED(threads);
+    return 1;
+}
+
+void upx_parallel_for(unsigned n_items, int threads, upx_parallel_func_t func, void *user) {
+    UNUSED(threads);
+    WorkerOptions worker_options(opt);
+    for (unsigned i = 0; i < n_items; i++)
+        func(i, user);
+}
+
+#endif // WITH_THREADS
+
+unsigned upx_parallel_threads(unsigned n_items) {
+    return upx_parallel_threads(n_items, opt->threads);
+}
+
+void upx_parallel_for(unsigned n_items, upx_parallel_func_t func, void *user) {
+    upx_parallel_for(n_items, opt->threads, func, user);
+}
+
+/*************************************************************************
+//
+**************************************************************************/
+
+TEST_CASE("upx_parallel_for") {
+    options_t *saved_opt = opt;
+    options_t local_options;
+    opt = &local_options;
+    opt->reset();
+
+    unsigned sum[1000];
+    int seen[1000];
+    for (int threads = 0; threads <= 4; threads++) {
+        opt->threads = threads;
+        opt->verbose = 1;
+        memset(sum, 0, sizeof(sum));
+        auto f = [&sum, &seen, &local_options](unsigned i) {
+            sum[i] += i + 1;
+            seen[i] = opt != &local_options ? opt->threads : -1;
+            opt->verbose = 3; // private to this worker
+        };
+        upx_parallel_for(1000, f);
+        bool ok = true;
+        for (unsigned i = 0; i < 1000; i++)
+            if (sum[i] != i + 1 || seen[i] != threads)
+                ok = false;
+        CHECK(ok);
+        CHECK(opt == &local_options);
+        CHECK(opt->verbose == 1);
+    }
+
+    opt->threads = 4;
+    auto g = [](unsigned i) {
+        if (i == 17)
+            throwInternalError("upx_parallel_for");
+    };
+    bool caught = false;
+    try {
+        upx_parallel_for(100, g);
+    } catch (const Error &) {
+        caught = true;
+    }
+    CHECK(caught);
+
+#if (WITH_THREADS)
+    // "opt" is thread_local
+    options_t other_options;
+    const options_t *other_seen = nullptr;
+    std::thread t([&other_options, &other_seen]() {
+        opt = &other_options;
+        other_seen = opt;
+    });
+    t.join();
+    CHECK(other_seen == &other_options);
+    CHECK(opt == &local_options);
+#endif
+
+    opt = saved_opt;
+}
+
+/* vim:set ts=4 sw=4 et: */
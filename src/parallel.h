@@ -0,0 +1,102 @@
+/* parallel.h --
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2022 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2022 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+#ifndef __UPX_PARALLEL_H
+#define __UPX_PARALLEL_H 1
+
+#if !defined(WITH_THREADS)
+#if (ACC_OS_DOS16 || ACC_OS_DOS32 || ACC_OS_TOS)
+#define WITH_THREADS 0
+#else
+#define WITH_THREADS 1
+#endif
+#endif
+
+/*************************************************************************
+// a minimal worker pool
+//
+// upx_parallel_for() calls func(i, user) for all i in [0, n_items),
+// using up to upx_parallel_threads() threads including the calling one;
+// the variant with "threads" uses that setting instead of opt->threads.
+// Items are handed out in increasing order. If an item throws, no new
+// items are started and the first exception is re-thrown in the calling
+// thread once all workers have finished.
+//
+// Nested calls from inside a worker simply run serially.
+// Each worker (the calling thread too, also for a serial run) sees a
+// private copy of the options "opt" of the caller; any change which func
+// makes to *opt is dropped when upx_parallel_for() returns.
+**************************************************************************/
+
+typedef void (*upx_parallel_func_t)(unsigned i, void *user);
+
+unsigned upx_parallel_threads(unsigned n_items);              // uses opt->threads
+unsigned upx_parallel_threads(unsigned n_items, int threads); // 0 means one per CPU
+void upx_parallel_for(unsigned n_items, upx_parallel_func_t func, void *user);
+void upx_parallel_for(unsigned n_items, int threads, upx_parallel_func_t func, void *user);
+
+template <class F>
+inline void upx_parallel_for(unsigned n_items, int threads, F &func) {
+    struct Thunk {
+        static void call(unsigned i, void *user) { (*(F *) user)(i); }
+    };
+    upx_parallel_for(n_items, threads, Thunk::call, (void *) &func);
+}
+
+template <class F>
+inline void upx_parallel_for(unsigned n_items, F &func) {
+    upx_parallel_for(n_items, opt->threads, func);
+}
+
+/*************************************************************************
+// locking for code that runs inside upx_parallel_for()
+**************************************************************************/
+
+#if (WITH_THREADS)
+#include <mutex>
+typedef std::mutex upx_mutex_t;
+#else
+struct upx_mutex_t {
+    void lock() {}
+    void unlock() {}
+};
+#endif
+
+class MutexLocker final {
+public:
+    explicit MutexLocker(upx_mutex_t &m_) : m(m_) { m.lock(); }
+    ~MutexLocker() { m.unlock(); }
+
+private:
+    upx_mutex_t &m;
+    MutexLocker(const MutexLocker &) = delete;
+    MutexLocker &operator=(const MutexLocker &) = delete;
+};
+
+#endif /* already included */
+
+/* vim:set ts=4 sw=4 et: */
@@ -1,5 +1,5 @@
 /* amd64-darwin.macho-entry.h
-   created from amd64-darwin.macho-entry.bin, 9864 (0x2688) bytes
+   created from amd64-darwin.macho-entry.bin, 7190 (0x1c16) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_DARWIN_MACHO_ENTRY_SIZE    9864
-#define STUB_AMD64_DARWIN_MACHO_ENTRY_ADLER32 0xd7aa0f84
-#define STUB_AMD64_DARWIN_MACHO_ENTRY_CRC32   0x34884431
+#define STUB_AMD64_DARWIN_MACHO_ENTRY_SIZE    7190
+#define STUB_AMD64_DARWIN_MACHO_ENTRY_ADLER32 0x9b867b7f
+#define STUB_AMD64_DARWIN_MACHO_ENTRY_CRC32   0x22123c3b
 
-unsigned char stub_amd64_darwin_macho_entry[9864] = {
+unsigned char stub_amd64_darwin_macho_entry[7190] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 62,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0, 88, 25,  0,  0,  0,  0,  0,  0,
@@ -429,228 +429,61 @@ unsigned char stub_amd64_darwin_macho_entry[9864] = {
 /* 0x1860 */ 101, 95,112, 97,116,104, 61, 72, 57, 72,  8,117,218, 72,141,120,
 /* 0x1870 */  16, 41,246,184,  5,  0,  0,  2, 15,  5, 80, 72,141, 53,  0,  0,
 /* 0x1880 */   0,  0, 73,137,244,173, 73, 41,196, 73,137,246,173, 73, 41,198,
-/* 0x1890 */  76,141,120,248, 76,137,100, 36, 16,232,203,254,255,255,102,105,
-/* 0x18a0 */ 108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 54, 52, 45,
-/* 0x18b0 */ 120, 56, 54, 45, 54, 52, 10, 10, 83,101, 99,116,105,111,110,115,
-/* 0x18c0 */  58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32,
-/* 0x18d0 */  32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77,
-/* 0x18e0 */  65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x18f0 */  76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1900 */  32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110,
-/* 0x1910 */  32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 65, 77, 68, 54,
-/* 0x1920 */  52, 66, 88, 88, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1930 */  52, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1940 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1950 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 48,
-/* 0x1960 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1970 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 77,
-/* 0x1980 */  65, 67, 72, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1990 */  48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19a0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x19c0 */  48, 56, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x19d0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x19e0 */  79, 78, 76, 89, 10, 32, 32, 50, 32, 77, 65, 67, 72, 95, 85, 78,
-/* 0x19f0 */  67, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 56, 32,
-/* 0x1a00 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a10 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a20 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 57, 49, 32, 32, 50,
-/* 0x1a30 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1a40 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 95,
-/* 0x1a50 */  72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1a60 */  54, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a70 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a80 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 57, 57,
-/* 0x1a90 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1aa0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 78,
-/* 0x1ab0 */  82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1ac0 */  48, 48, 48, 98, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ad0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ae0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1af0 */  49, 48, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1b00 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1b10 */  79, 78, 76, 89, 10, 32, 32, 53, 32, 78, 82, 86, 50, 68, 32, 32,
-/* 0x1b20 */  32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 97, 49, 32,
-/* 0x1b30 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b40 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b50 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 98, 97, 32, 32, 50,
-/* 0x1b60 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1b70 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1b80 */  32, 54, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1b90 */  32, 48, 48, 48, 48, 48, 48, 57, 51, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1ba0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1bb0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1bc0 */  48, 48, 48, 48, 50, 53, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1bd0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1be0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90, 77,
-/* 0x1bf0 */  65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1c00 */  48, 54, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c10 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c20 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,101,
-/* 0x1c30 */ 101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1c40 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1c50 */  76, 89, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x1c60 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57,102, 55, 32, 32, 48,
-/* 0x1c70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1c80 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c90 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 53, 50, 32, 32, 50, 42, 42,
-/* 0x1ca0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1cb0 */  68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1cc0 */  69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57,102, 55,
-/* 0x1cd0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ce0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cf0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,100, 52, 57, 32, 32,
-/* 0x1d00 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1d10 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48, 32, 76, 90, 77,
-/* 0x1d20 */  65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1d30 */  48, 49, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d40 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d50 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 52,
-/* 0x1d60 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1d70 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32,
-/* 0x1d80 */  78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1d90 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1da0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1db0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1dc0 */  49, 55, 53, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1dd0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1de0 */  49, 50, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89, 32, 32, 32, 32,
-/* 0x1df0 */  32, 48, 48, 48, 48, 48, 48, 49, 49, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1e00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1e10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1e20 */  48, 48, 48, 49, 55, 53, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1e30 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1e40 */  89, 10, 32, 49, 51, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 32,
-/* 0x1e50 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 51, 53, 32, 32, 48, 48,
-/* 0x1e60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1e70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e80 */  32, 32, 48, 48, 48, 48, 49, 55, 54, 57, 32, 32, 50, 42, 42, 48,
-/* 0x1e90 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x1ea0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66,
-/* 0x1eb0 */  79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1ec0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1ed0 */ 100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48,
-/* 0x1ee0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86,
-/* 0x1ef0 */  95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f00 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1f10 */  90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1f20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1f30 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f40 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77,
-/* 0x1f50 */  65, 67, 72, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 65, 67, 72, 77, 65,
-/* 0x1f70 */  73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f80 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67,
-/* 0x1f90 */  72, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fa0 */  48, 48, 48, 48, 48, 48, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78,
-/* 0x1fb0 */  90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 65, 77, 68, 54, 52,
-/* 0x1fd0 */  66, 88, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fe0 */  48, 48, 48, 48, 32, 65, 77, 68, 54, 52, 66, 88, 88, 10, 48, 48,
-/* 0x1ff0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2000 */  32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88,
-/* 0x2010 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2020 */  48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48,
-/* 0x2030 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2040 */  32, 32,100, 32, 32, 77, 65, 67, 72, 95, 85, 78, 67,  9, 48, 48,
-/* 0x2050 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77,
-/* 0x2060 */  65, 67, 72, 95, 85, 78, 67, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2070 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2080 */  32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2090 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x20a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x20b0 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48,
-/* 0x20c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82,
-/* 0x20d0 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20e0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x20f0 */  50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2100 */  48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2110 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2120 */ 100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48,
-/* 0x2130 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x2140 */  90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2150 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2160 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48,
-/* 0x2170 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x2180 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2190 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x21a0 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48,
-/* 0x21b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x21c0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x21d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x21e0 */ 100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48, 48,
-/* 0x21f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86,
-/* 0x2200 */  95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2210 */  48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 77,
-/* 0x2220 */  65, 67, 72, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2230 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116,
-/* 0x2240 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x2250 */  49, 32,103, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65,
-/* 0x2260 */  73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2270 */  48, 48, 48, 48, 32,101,110,100, 95,100,101, 99,111,109,112,114,
-/* 0x2280 */ 101,115,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x2290 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 77, 65, 67,
-/* 0x22a0 */  72, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x22b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x22c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x22d0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22e0 */  48, 49, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x22f0 */  32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 43, 48,
-/* 0x2300 */ 120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x2310 */  56, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x2320 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69,
-/* 0x2330 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2340 */  32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2350 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x2360 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 97,102, 32, 82, 95, 88,
-/* 0x2370 */  56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78,
-/* 0x2380 */  82, 86, 95, 72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48,
-/* 0x2390 */  48, 48, 48, 48, 48, 48, 48, 48, 50, 49, 10, 48, 48, 48, 48, 48,
-/* 0x23a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 88, 56,
-/* 0x23b0 */  54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 77, 65,
-/* 0x23c0 */  67, 72, 77, 65, 73, 78, 89, 43, 48,120,102,102,102,102,102,102,
-/* 0x23d0 */ 102,102,102,102,102,102,102,102,102, 99, 10, 10, 82, 69, 76, 79,
-/* 0x23e0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x23f0 */  79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2400 */  69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80,
-/* 0x2410 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x2420 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2430 */  48, 48, 48, 57, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80,
-/* 0x2440 */  67, 51, 50, 32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,
-/* 0x2450 */  43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2460 */  48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2470 */  48, 48, 53, 99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67,
-/* 0x2480 */  51, 50, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89,
-/* 0x2490 */  43, 48,120,102,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x24a0 */ 102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x24b0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86,
-/* 0x24c0 */  50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x24d0 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x24e0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x24f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 56, 98, 32, 82,
-/* 0x2500 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x2510 */  32, 78, 82, 86, 95, 72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48,
-/* 0x2520 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 49, 10, 48, 48, 48,
-/* 0x2530 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 51, 32, 82, 95,
-/* 0x2540 */  88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x2550 */  77, 65, 67, 72, 77, 65, 73, 78, 89, 43, 48,120,102,102,102,102,
-/* 0x2560 */ 102,102,102,102,102,102,102,102,102,102,102, 99, 10, 10, 82, 69,
-/* 0x2570 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x2580 */  32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x2590 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32,
-/* 0x25a0 */  32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x25b0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x25c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 88,
-/* 0x25d0 */  56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 76,
-/* 0x25e0 */  90, 77, 65, 95, 68, 69, 67, 51, 48, 43, 48,120, 48, 48, 48, 48,
-/* 0x25f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 50, 10, 10, 82, 69,
-/* 0x2600 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x2610 */  32, 70, 79, 82, 32, 91, 77, 65, 67, 72, 77, 65, 73, 78, 90, 93,
-/* 0x2620 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2630 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2640 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x2650 */  48, 48, 48, 48, 48, 48, 48, 48, 49, 49, 53, 32, 82, 95, 88, 56,
-/* 0x2660 */  54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 95,115,
-/* 0x2670 */ 116, 97,114,116, 43, 48,120,102,102,102,102,102,102,102,102,102,
-/* 0x2680 */ 102,102,102,102,102,102, 52, 10
+/* 0x1890 */  76,141,120,248, 76,137,100, 36, 16,232,203,254,255,255, 14,  0,
+/* 0x18a0 */   0,  0, 16,  0,  0,  0,  9,  0,  0,  0,164,  0,  0,  0,  0,  0,
+/* 0x18b0 */   0,  0, 76,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x18c0 */   0,  0,  5,  0,  0,  0,140,  0,  0,  0,  0,  0,  0,  0, 19,  0,
+/* 0x18d0 */   0,  0,  8,  0,  0,  0,145,  0,  0,  0,  0,  0,  0,  0, 28,  0,
+/* 0x18e0 */   0,  0,103,  0,  0,  0,153,  0,  0,  0,  0,  0,  0,  0, 37,  0,
+/* 0x18f0 */   0,  0,186,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0, 43,  0,
+/* 0x1900 */   0,  0,161,  0,  0,  0,186,  1,  0,  0,  0,  0,  0,  0, 49,  0,
+/* 0x1910 */   0,  0,147,  0,  0,  0, 91,  2,  0,  0,  0,  0,  0,  0, 55,  0,
+/* 0x1920 */   0,  0,100,  0,  0,  0,238,  2,  0,  0,  0,  0,  0,  0, 66,  0,
+/* 0x1930 */   0,  0,247,  9,  0,  0, 82,  3,  0,  0,  0,  0,  0,  0, 77,  0,
+/* 0x1940 */   0,  0,247,  9,  0,  0, 73, 13,  0,  0,  0,  0,  0,  0, 88,  0,
+/* 0x1950 */   0,  0, 24,  0,  0,  0, 64, 23,  0,  0,  0,  0,  0,  0, 99,  0,
+/* 0x1960 */   0,  0,  0,  0,  0,  0, 88, 23,  0,  0,  0,  0,  0,  0,108,  0,
+/* 0x1970 */   0,  0, 17,  0,  0,  0, 88, 23,  0,  0,  0,  0,  0,  0,118,  0,
+/* 0x1980 */   0,  0, 53,  1,  0,  0,105, 23,  0,  0,  0,  0,  0,  0, 28,  0,
+/* 0x1990 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 88,  0,
+/* 0x19a0 */   0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,108,  0,
+/* 0x19b0 */   0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,118,  0,
+/* 0x19c0 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x19e0 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,
+/* 0x19f0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  0,
+/* 0x1a00 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 43,  0,
+/* 0x1a10 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,
+/* 0x1a20 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 55,  0,
+/* 0x1a30 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66,  0,
+/* 0x1a40 */   0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 77,  0,
+/* 0x1a50 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 99,  0,
+/* 0x1a60 */   0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,  0,
+/* 0x1a70 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,135,  0,
+/* 0x1a80 */   0,  0, 12,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  1,  0,
+/* 0x1a90 */   0,  0,  1,  0,  0,  0,150,  0,  0,  0,  3,  0,  0,  0,200,  0,
+/* 0x1aa0 */   0,  0,  0,  0,  0,  0,  4,  0,  0,  0,175,  0,  0,  0,150,  0,
+/* 0x1ab0 */   0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  4,  0,
+/* 0x1ac0 */   0,  0, 92,  0,  0,  0,150,  0,  0,  0,  2,  0,  0,  0,252,255,
+/* 0x1ad0 */ 255,255,255,255,255,255,  5,  0,  0,  0,150,  0,  0,  0,150,  0,
+/* 0x1ae0 */   0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  5,  0,
+/* 0x1af0 */   0,  0, 92,  0,  0,  0,150,  0,  0,  0,  2,  0,  0,  0,252,255,
+/* 0x1b00 */ 255,255,255,255,255,255,  6,  0,  0,  0,139,  0,  0,  0,150,  0,
+/* 0x1b10 */   0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  6,  0,
+/* 0x1b20 */   0,  0, 83,  0,  0,  0,150,  0,  0,  0,  2,  0,  0,  0,252,255,
+/* 0x1b30 */ 255,255,255,255,255,255,  7,  0,  0,  0,  6,  0,  0,  0,150,  0,
+/* 0x1b40 */   0,  0,  1,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0, 13,  0,
+/* 0x1b50 */   0,  0, 21,  1,  0,  0,150,  0,  0,  0, 14,  0,  0,  0,244,255,
+/* 0x1b60 */ 255,255,255,255,255,255, 65, 77, 68, 54, 52, 66, 88, 88,  0, 77,
+/* 0x1b70 */  65, 67, 72, 77, 65, 73, 78, 88,  0, 77, 65, 67, 72, 95, 85, 78,
+/* 0x1b80 */  67,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 50, 69,
+/* 0x1b90 */   0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77,
+/* 0x1ba0 */  65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x1bb0 */  49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90,
+/* 0x1bc0 */  77, 65, 95, 68, 69, 67, 51, 48,  0, 78, 82, 86, 95, 84, 65, 73,
+/* 0x1bd0 */  76,  0, 77, 65, 67, 72, 77, 65, 73, 78, 89,  0, 77, 65, 67, 72,
+/* 0x1be0 */  77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,  0,101,110,100,
+/* 0x1bf0 */  95,100,101, 99,111,109,112,114,101,115,115,  0, 82, 95, 88, 56,
+/* 0x1c00 */  54, 95, 54, 52, 95, 80, 67, 51, 50,  0,158, 24,  0,  0, 85, 80,
+/* 0x1c10 */  88, 35, 79, 66, 74, 49
 };
@@ -1,5 +1,5 @@
 /* amd64-linux.elf-entry.h
-   created from amd64-linux.elf-entry.bin, 9485 (0x250d) bytes
+   created from amd64-linux.elf-entry.bin, 16641 (0x4101) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,14 +31,14 @@
  */
 
 
-#define STUB_AMD64_LINUX_ELF_ENTRY_SIZE    9485
-#define STUB_AMD64_LINUX_ELF_ENTRY_ADLER32 0x42ca99ef
-#define STUB_AMD64_LINUX_ELF_ENTRY_CRC32   0x44f5e317
+#define STUB_AMD64_LINUX_ELF_ENTRY_SIZE    16641
+#define STUB_AMD64_LINUX_ELF_ENTRY_ADLER32 0xcb0a5260
+#define STUB_AMD64_LINUX_ELF_ENTRY_CRC32   0xff15e0fb
 
-unsigned char stub_amd64_linux_elf_entry[9485] = {
+unsigned char stub_amd64_linux_elf_entry[16641] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 62,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,168, 24,  0,  0,  0,  0,  0,  0,
+/* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,112, 63,  0,  0,  0,  0,  0,  0,
 /* 0x0030 */   0,  0,  0,  0, 64,  0,  0,  0,  0,  0, 64,  0,  0,  0,  0,  0,
 /* 0x0040 */  80, 82,232,  0,  0,  0,  0, 85, 83, 81, 82, 72,  1,254, 86, 72,
 /* 0x0050 */ 137,254, 72,137,215, 49,219, 49,201, 72,131,205,255,232, 80,  0,
@@ -404,229 +404,677 @@ unsigned char stub_amd64_linux_elf_entry[9485] = {
 /* 0x16d0 */  26, 72,255,199,137,248, 43, 68, 36,248, 72,139, 76, 36,240, 72,
 /* 0x16e0 */ 139, 92, 36, 56,137,  1, 68,137, 59, 49,192, 91, 93, 65, 92, 65,
 /* 0x16f0 */  93, 65, 94, 65, 95, 72,139,117,248, 72,139,125, 16,139, 75,  4,
-/* 0x1700 */  72,  1,206,139, 19, 72,  1,215,201,235,  2, 87, 94, 89, 72,137,
-/* 0x1710 */ 240, 72, 41,200, 90, 72, 41,215, 89,137, 57, 91, 93,195,104, 30,
-/* 0x1720 */   0,  0,  0, 90,232,  0,  0,  0,  0, 80, 82, 79, 84, 95, 69, 88,
-/* 0x1730 */  69, 67,124, 80, 82, 79, 84, 95, 87, 82, 73, 84, 69, 32,102, 97,
-/* 0x1740 */ 105,108,101,100, 46, 10,  0,106, 14, 90, 87, 94,235,  1, 94,106,
-/* 0x1750 */   2, 95,106,  1, 88, 15,  5,106,127, 95,106, 60, 88, 15,  5, 95,
-/* 0x1760 */  41,246,106,  2, 88, 15,  5,133,192,120,220, 80, 72,141,183, 15,
-/* 0x1770 */   0,  0,  0,173,131,224,254, 65,137,198, 86, 91,139, 22, 72,141,
-/* 0x1780 */ 141,245,255,255,255, 68,139, 57, 76, 41,249, 69, 41,247, 73,  1,
-/* 0x1790 */ 206, 95, 82, 80, 87, 81, 77, 41,201, 65,131,200,255,106, 34, 65,
-/* 0x17a0 */  90, 82, 94,106,  3, 90, 41,255,106,  9, 88, 15,  5, 72,137, 68,
-/* 0x17b0 */  36, 16, 80, 90, 83, 94,173, 80, 72,137,225, 73,137,213,173, 80,
-/* 0x17c0 */ 173, 65,144, 72,137,247, 94,255,213, 89, 72,139,116, 36, 24, 72,
-/* 0x17d0 */ 139,124, 36, 16,106,  5, 90,106, 10, 88, 15,  5, 65,255,229, 93,
-/* 0x17e0 */ 232,122,255,255,255, 47,112,114,111, 99, 47,115,101,108,102, 47,
-/* 0x17f0 */ 101,120,101,  0,  0,  0,  0,  0,102,105,108,101, 32,102,111,114,
-/* 0x1800 */ 109, 97,116, 32,101,108,102, 54, 52, 45,120, 56, 54, 45, 54, 52,
-/* 0x1810 */  10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32,
-/* 0x1820 */  78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,
-/* 0x1830 */ 122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32,
-/* 0x1840 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32,
-/* 0x1850 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101,
-/* 0x1860 */  32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,
-/* 0x1870 */ 115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32,
-/* 0x1880 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48,
-/* 0x1890 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x18a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18b0 */  32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48,
-/* 0x18c0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x18d0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32,
-/* 0x18e0 */  78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x18f0 */  48, 48, 48, 48, 54, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1900 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1910 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1920 */  48, 48, 52,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1930 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1940 */  32, 50, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1950 */  32, 48, 48, 48, 48, 48, 48, 98, 97, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1960 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1970 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1980 */  48, 48, 48, 48, 48, 98, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1990 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x19a0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86,
-/* 0x19b0 */  50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x19c0 */  48, 97, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19d0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 54,
-/* 0x19f0 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1a00 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1a10 */  76, 89, 10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32,
-/* 0x1a20 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 57, 51, 32, 32, 48,
-/* 0x1a30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1a40 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a50 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 49, 48, 32, 32, 50, 42, 42,
-/* 0x1a60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1a70 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53,
-/* 0x1a80 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48,
-/* 0x1a90 */  48, 48, 48, 48, 48, 54, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1aa0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1ab0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1ac0 */  48, 48, 50, 97, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1ad0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1ae0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95,
-/* 0x1af0 */  68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57,102,
-/* 0x1b00 */  55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b10 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b20 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 48, 55, 32,
-/* 0x1b30 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1b40 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90,
-/* 0x1b50 */  77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1b60 */  48, 57,102, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b70 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b80 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 99,
-/* 0x1b90 */ 102,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1ba0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56,
-/* 0x1bb0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48,
-/* 0x1bc0 */  48, 48, 48, 48, 48, 49, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1be0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1bf0 */  48, 49, 54,102, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1c00 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1c10 */  32, 32, 57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32,
-/* 0x1c20 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1c30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1c40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1c50 */  48, 48, 48, 48, 49, 55, 48,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1c60 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1c70 */  76, 89, 10, 32, 49, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32,
-/* 0x1c80 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 51, 97, 32, 32, 48,
-/* 0x1c90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1ca0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cb0 */  48, 32, 32, 48, 48, 48, 48, 49, 55, 48,100, 32, 32, 50, 42, 42,
-/* 0x1cc0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1cd0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49,
-/* 0x1ce0 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1cf0 */  48, 48, 48, 48, 48, 98, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1d10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1d20 */  48, 49, 55, 52, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1d30 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1d40 */  65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65,
-/* 0x1d50 */  66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d60 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x1d70 */  86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d80 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68,
-/* 0x1d90 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1da0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1db0 */  69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1dc0 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x1dd0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1de0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1df0 */  78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e00 */  48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10, 48, 48, 48,
-/* 0x1e10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1e20 */  32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,  9, 48,
-/* 0x1e30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1e40 */  69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1e60 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48,
-/* 0x1e70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77,
-/* 0x1e80 */  65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e90 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x1ea0 */  86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1eb0 */  48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1ec0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1ed0 */  32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1ee0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68,
-/* 0x1ef0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f00 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66,  9,
-/* 0x1f10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f20 */  32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f30 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1f40 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48,
-/* 0x1f50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x1f60 */  95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f70 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1f80 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x1f90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x1fa0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fb0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1fc0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48,
-/* 0x1fd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x1fe0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ff0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2000 */  78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2010 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 84, 65,
-/* 0x2020 */  73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2030 */  48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77,
-/* 0x2040 */  65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2050 */  48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48,
-/* 0x2060 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x2070 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48,
-/* 0x2080 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 79, 95, 66,
-/* 0x2090 */  73, 78, 70, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x20a0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76,
-/* 0x20b0 */  70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x20c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x20d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x20e0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20f0 */  48, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x2100 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 43, 48,120,
-/* 0x2110 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 57, 52,
-/* 0x2120 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2130 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93,
-/* 0x2140 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2150 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2160 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x2170 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 97,102, 32, 82, 95, 88, 56,
-/* 0x2180 */  54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2190 */  86, 95, 72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21a0 */  48, 48, 48, 48, 48, 48, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x21b0 */  48, 48, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 88, 56, 54,
-/* 0x21c0 */  95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x21d0 */  77, 65, 73, 78, 89, 43, 48,120,102,102,102,102,102,102,102,102,
-/* 0x21e0 */ 102,102,102,102,102,102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x21f0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x2200 */  32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x2210 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x2220 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x2230 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2240 */  48, 57, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51,
-/* 0x2250 */  50, 32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43, 48,
-/* 0x2260 */ 120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x2270 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2280 */  53, 99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x2290 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89, 43, 48,120,
-/* 0x22a0 */ 102,102,102,102,102,102,102,102,102,102,102,102,102,102,102, 99,
-/* 0x22b0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x22c0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93,
-/* 0x22d0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22e0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22f0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x2300 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 56, 98, 32, 82, 95, 88, 56,
-/* 0x2310 */  54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2320 */  86, 95, 72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2330 */  48, 48, 48, 48, 48, 48, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2340 */  48, 48, 48, 48, 48, 48, 48, 48, 53, 51, 32, 82, 95, 88, 56, 54,
-/* 0x2350 */  95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x2360 */  77, 65, 73, 78, 89, 43, 48,120,102,102,102,102,102,102,102,102,
-/* 0x2370 */ 102,102,102,102,102,102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x2380 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x2390 */  32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79,
-/* 0x23a0 */  70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x23b0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x23c0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23d0 */  48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x23e0 */  52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x23f0 */  68, 69, 67, 51, 48, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2400 */  48, 48, 48, 48, 48, 48, 49, 50, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x2410 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x2420 */  32, 91, 69, 76, 70, 77, 65, 73, 78, 89, 93, 58, 10, 79, 70, 70,
-/* 0x2430 */  83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89,
-/* 0x2440 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2450 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2460 */  48, 48, 48, 48, 49, 56, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x2470 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x2480 */  90, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2490 */  48, 48, 48, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x24a0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76,
-/* 0x24b0 */  70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x24c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x24d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x24e0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24f0 */  97,100, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 32, 32,
-/* 0x2500 */  32, 32, 32, 32, 32, 79, 95, 66, 73, 78, 70, 79, 10
+/* 0x1700 */  72,  1,206,139, 19, 72,  1,215,201,235,  2, 87, 94, 65,128,248,
+/* 0x1710 */  16,117, 96, 73,137,241, 72,137,254, 72,137,215,252, 15,182, 22,
+/* 0x1720 */  72,255,198,137,209,193,233,  4,116, 17,131,249, 15,117,  5,232,
+/* 0x1730 */  46,  0,  0,  0,243,164, 76, 57,206,115, 58, 15,183,  6, 72,131,
+/* 0x1740 */ 198,  2,131,226, 15,141, 74,  4,131,249, 19,117,  5,232, 16,  0,
+/* 0x1750 */   0,  0, 73,137,242, 72,137,254, 72, 41,198,243,164, 76,137,214,
+/* 0x1760 */ 235,187, 15,182, 30, 72,255,198,  1,217,129,251,255,  0,  0,  0,
+/* 0x1770 */ 116,240,195, 87, 94, 65,128,248, 17, 15,133,  0,  0,  0,  0, 85,
+/* 0x1780 */  72,137,229, 87, 82, 81, 72, 41,254, 72,141,132, 36,  0,216,253,
+/* 0x1790 */ 255, 72,131,224,192,106,  0, 72, 57,196,117,249, 73,137,224,232,
+/* 0x17a0 */  28,  0,  0,  0, 72,139,117,248,137,192, 72,  1,198, 72,139, 77,
+/* 0x17b0 */ 232,139,  9, 72,139,125,240, 72,  1,207,201,233,  0,  0,  0,  0,
+/* 0x17c0 */  65, 87, 65, 86, 65, 85, 65, 84, 73,137,252, 85, 83, 72,131,236,
+/* 0x17d0 */  56,139, 57,199,  1,  0,  0,  0,  0, 65,199,128, 12, 39,  2,  0,
+/* 0x17e0 */   0,  0,  0,  0, 65,198,128, 16, 39,  2,  0,  0, 65,198,128, 19,
+/* 0x17f0 */  39,  2,  0,  0, 65,198,128, 18, 39,  2,  0,  0, 65,198,128, 17,
+/* 0x1800 */  39,  2,  0,  0, 65,199,128,  0, 39,  2,  0,  1,  0,  0,  0, 65,
+/* 0x1810 */ 199,128,  4, 39,  2,  0,  4,  0,  0,  0, 65,199,128,  8, 39,  2,
+/* 0x1820 */   0,  8,  0,  0,  0,131,254,  5,118,  7, 65,128, 60, 36, 40,116,
+/* 0x1830 */  23, 49,192, 72,131,196, 56, 91, 93, 65, 92, 65, 93, 65, 94, 65,
+/* 0x1840 */  95,195,102, 15, 31, 68,  0,  0, 65,128,124, 36,  1,181,117,225,
+/* 0x1850 */  65,128,124, 36,  2, 47,117,217, 65,128,124, 36,  3,253,117,209,
+/* 0x1860 */  69, 15,182,108, 36,  4, 65,246,197,  8,117,197, 72,137,205,137,
+/* 0x1870 */ 246, 49,201, 65,246,197, 32, 15,148,193, 73,141, 28, 52, 68,137,
+/* 0x1880 */ 232, 74,141, 76, 33,  5, 73,137,217,131,224,  3, 73, 41,201, 60,
+/* 0x1890 */   3,116, 49, 15,182,240, 65, 57,241,114,150,132,192,116, 53,141,
+/* 0x18a0 */  70,255, 72,141, 68,  1,  1,235, 12, 15, 31,128,  0,  0,  0,  0,
+/* 0x18b0 */  72, 57,193,116, 34, 72,131,193,  1,128,121,255,  0,116,241,233,
+/* 0x18c0 */ 109,255,255,255,190,  4,  0,  0,  0, 65,131,249,  3,119,208,233,
+/* 0x18d0 */  93,255,255,255, 72,137,200, 65, 15,182,245, 68,136,108, 36, 39,
+/* 0x18e0 */  77,137,227, 73,137,214,137,241,193,238,  5, 72,137,108, 36, 40,
+/* 0x18f0 */  73,137,212,193,233,  6, 65,137,241,190,  1,  0,  0,  0, 77,137,
+/* 0x1900 */ 194,211,230,133,201,137,249, 73, 15, 68,241, 72,  1,209, 72,  1,
+/* 0x1910 */ 240, 72, 57,195, 15,130, 23,255,255,255, 72,137,218, 72, 41,194,
+/* 0x1920 */ 131,250,  2, 15,134,  8,255,255,255, 15,182,104,  2, 15,183, 16,
+/* 0x1930 */  76,141,120,  3,193,229, 16,  9,213,137,234, 65,137,237,209,234,
+/* 0x1940 */  65,193,237,  3,131,226,  3,131,250,  1, 15,132, 49,  1,  0,  0,
+/* 0x1950 */ 131,250,  2, 15,132,175,  0,  0,  0,133,210, 15,133,208,254,255,
+/* 0x1960 */ 255, 72,137,218, 76, 41,250, 68, 57,234, 15,130,193,254,255,255,
+/* 0x1970 */  72,137,202, 76, 41,242, 68, 57,234, 15,130,178,254,255,255, 76,
+/* 0x1980 */ 137,242, 76,137,254, 76, 41,226, 76, 41,222, 41,242, 65, 57,146,
+/* 0x1990 */  12, 39,  2,  0,125,  7, 65,137,146, 12, 39,  2,  0, 69,133,237,
+/* 0x19a0 */  15,132, 67,  1,  0,  0, 49,210, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x19b0 */  15,182,116, 16,  3, 65,136, 52, 22, 72,131,194,  1, 76, 57,234,
+/* 0x19c0 */ 117,238, 73,141,  4, 23, 73,  1,214,131,229,  1, 15,132, 63,255,
+/* 0x19d0 */ 255,255, 68, 15,182,108, 36, 39, 76,137,226, 72,139,108, 36, 40,
+/* 0x19e0 */  77,137,220, 65,128,229,  4,116,  4, 72,131,192,  4, 72, 57,195,
+/* 0x19f0 */  15,130, 59,254,255,255, 73, 41,214, 68, 41,224, 68,137,117,  0,
+/* 0x1a00 */ 233, 46,254,255,255, 15, 31,  0, 65,129,253,  0,  0,  2,  0, 15,
+/* 0x1a10 */ 135, 28,254,255,255, 72,137,216, 76, 41,248, 68, 57,232, 15,130,
+/* 0x1a20 */  13,254,255,255, 76,137, 92, 36, 24, 72,131,236,  8, 77,137,241,
+/* 0x1a30 */  76,137,248, 65, 82, 76, 41,216, 77, 41,225, 76,137,242, 65, 41,
+/* 0x1a40 */ 193, 77,137,224, 68,137,238, 76,137,255, 76,137, 84, 36, 32, 72,
+/* 0x1a50 */ 137, 76, 36, 24,232,167,  0,  0,  0, 90, 89,131,248,255, 15,132,
+/* 0x1a60 */ 205,253,255,255,137,192, 72,139, 76, 36,  8, 76,139, 84, 36, 16,
+/* 0x1a70 */  73,  1,198, 76,139, 92, 36, 24, 75,141,  4, 47,233, 72,255,255,
+/* 0x1a80 */ 255, 73, 57,223, 15,131,167,253,255,255, 72,137,202, 76, 41,242,
+/* 0x1a90 */  68, 57,234, 15,130,152,253,255,255, 72,141,120,  4, 68,137,238,
+/* 0x1aa0 */  73,141, 20, 54, 73,137,248, 76, 41,226, 77, 41,216, 68, 41,194,
+/* 0x1ab0 */  65, 57,146, 12, 39,  2,  0,125,  7, 65,137,146, 12, 39,  2,  0,
+/* 0x1ac0 */  69,133,237,116, 28, 76,  1,246, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x1ad0 */  15,182, 80,  3, 73,131,198,  1, 65,136, 86,255, 76, 57,246,117,
+/* 0x1ae0 */ 239, 72,137,248,233,224,254,255,255, 76,137,248,233,216,254,255,
+/* 0x1af0 */ 255,102,102, 46, 15, 31,132,  0,  0,  0,  0,  0, 15, 31, 64,  0,
+/* 0x1b00 */  65, 87, 65, 86, 73,137,254, 65, 85, 65,137,245, 65, 84, 73,  1,
+/* 0x1b10 */ 253, 85, 83, 72,129,236,152,  0,  0,  0, 72,139,156, 36,208,  0,
+/* 0x1b20 */   0,  0, 72,137, 84, 36, 32, 72,141, 84, 36,120, 72,137, 76, 36,
+/* 0x1b30 */  16, 72,137,217, 76,137, 68, 36, 40, 68,137, 76, 36, 52,232, 45,
+/* 0x1b40 */   7,  0,  0,133,192, 15,136, 85,  5,  0,  0, 65,137,196,139, 68,
+/* 0x1b50 */  36,120, 72,  1,216, 72,137, 68, 36, 24, 73, 99,196, 76,  1,240,
+/* 0x1b60 */  76, 57,232, 15,131, 55,  5,  0,  0, 68, 15,182, 16, 72,137,221,
+/* 0x1b70 */  72,141, 80,  1, 65,131,250,127,119,118, 69,133,210, 15,133,165,
+/* 0x1b80 */   0,  0,  0, 76,139, 92, 36, 32, 72,139,116, 36, 24, 72,139, 68,
+/* 0x1b90 */  36, 16, 72,137,241, 76, 41,216, 72, 41,233, 57,200, 15,130,253,
+/* 0x1ba0 */   4,  0,  0, 72, 57,245,115, 29, 49,192,102, 15, 31, 68,  0,  0,
+/* 0x1bb0 */  15,182, 84,  5,  0, 65,136, 20,  3, 72,131,192,  1, 72, 57,193,
+/* 0x1bc0 */ 117,238, 73,  1,203, 72,139, 76, 36, 32,139, 84, 36, 52, 76,137,
+/* 0x1bd0 */ 216, 72, 41,200, 68, 41,226,  1,194, 57,147, 12, 39,  2,  0, 15,
+/* 0x1be0 */ 141,192,  4,  0,  0,137,147, 12, 39,  2,  0,233,181,  4,  0,  0,
+/* 0x1bf0 */  76,137,233, 72, 41,209, 65,129,250,255,  0,  0,  0, 15,132,189,
+/* 0x1c00 */   4,  0,  0, 72,133,201, 15,142,148,  4,  0,  0, 65,131,194,128,
+/* 0x1c10 */  72,141, 80,  2, 15,182, 64,  1, 65,193,226,  8, 65,  1,194, 69,
+/* 0x1c20 */ 133,210, 15,132, 91,255,255,255, 68,137, 84, 36,  8, 76, 57,234,
+/* 0x1c30 */  15,131,106,  4,  0,  0, 68, 15,182, 50, 65,246,198,  3, 15,133,
+/* 0x1c40 */  92,  4,  0,  0, 83, 76,141,122,  1, 69,137,232, 68,137,242,106,
+/* 0x1c50 */   9, 65,185, 35,  0,  0,  0, 69, 41,248,193,234,  6, 72,141,179,
+/* 0x1c60 */  17, 39,  2,  0, 72,141,187,  0, 16,  2,  0, 76,137,249,232,157,
+/* 0x1c70 */  14,  0,  0, 65, 88, 65, 89,133,192, 15,136, 33,  4,  0,  0, 83,
+/* 0x1c80 */  72,152, 68,137,242, 69,137,232,106,  8, 73,  1,199,193,234,  4,
+/* 0x1c90 */  72,141,179, 19, 39,  2,  0, 72,141,187,  0, 32,  2,  0,131,226,
+/* 0x1ca0 */   3, 69, 41,248, 76,137,249, 65,185, 31,  0,  0,  0,232, 94, 14,
+/* 0x1cb0 */   0,  0, 94, 95,133,192, 15,136,228,  3,  0,  0, 83, 72,152, 68,
+/* 0x1cc0 */ 137,242, 69,137,232,106,  9, 73,  1,199,193,234,  2, 72,141,179,
+/* 0x1cd0 */  18, 39,  2,  0,131,226,  3, 76,137,249, 72,141,187,  0, 24,  2,
+/* 0x1ce0 */   0, 69, 41,248, 65,185, 52,  0,  0,  0,232, 33, 14,  0,  0, 90,
+/* 0x1cf0 */  89,133,192, 15,136,167,  3,  0,  0, 72,152, 76,137,233, 73,141,
+/* 0x1d00 */  20,  7, 72, 41,209, 65, 57,213, 15,132,146,  3,  0,  0,141, 65,
+/* 0x1d10 */ 255, 73,137,199, 15,182,  4,  2,132,192, 15,132,128,  3,  0,  0,
+/* 0x1d20 */  65,193,231,  3,209,232, 68,139, 84, 36,  8, 72,137,148, 36,128,
+/* 0x1d30 */   0,  0,  0,137,140, 36,136,  0,  0,  0,116, 14, 49,210,102,144,
+/* 0x1d40 */ 131,194,  1,209,232,117,249, 65,  1,215, 68, 15,182,179, 17, 39,
+/* 0x1d50 */   2,  0, 76,141,172, 36,128,  0,  0,  0, 68,137, 84, 36, 64, 76,
+/* 0x1d60 */ 137,239, 68,137,188, 36,140,  0,  0,  0, 65,131,238,  1, 68,137,
+/* 0x1d70 */ 246,232, 58, 20,  0,  0, 69,137,248, 76,137,239, 69, 41,240, 68,
+/* 0x1d80 */  15,182,179, 19, 39,  2,  0,137, 68, 36, 72, 68,137,132, 36,140,
+/* 0x1d90 */   0,  0,  0, 65,131,238,  1, 68,137, 68, 36,  8, 68,137,246,232,
+/* 0x1da0 */  12, 20,  0,  0, 15,182,147, 18, 39,  2,  0, 68,139, 68, 36,  8,
+/* 0x1db0 */  76,137,239, 65,137,199,131,234,  1, 69, 41,240, 69,137,254,137,
+/* 0x1dc0 */ 214, 68,137,132, 36,140,  0,  0,  0, 68,137, 68, 36, 56,137, 84,
+/* 0x1dd0 */  36,  8,232,217, 19,  0,  0,139, 84, 36,  8, 68,139, 68, 36, 56,
+/* 0x1de0 */  68,137,100, 36,108, 68,139, 84, 36, 64, 76,139, 92, 36, 32,137,
+/* 0x1df0 */  68, 36, 80, 72,141, 68, 36,124, 65, 41,208, 72,137, 68, 36, 56,
+/* 0x1e00 */  68,137,132, 36,140,  0,  0,  0, 77,137,220, 68,137, 84, 36,104,
+/* 0x1e10 */  76,137,108, 36,  8, 69,137,197, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x1e20 */  78,141, 12,179, 72,139,124, 36,  8, 69,137,238, 65, 15,182,177,
+/* 0x1e30 */   3, 32,  2,  0, 76,137, 76, 36, 96, 65,137,247,137,116, 36, 64,
+/* 0x1e40 */ 232,107, 19,  0,  0, 68,137,249, 68,139,124, 36, 80,139,116, 36,
+/* 0x1e50 */  64, 65,184,  1,  0,  0,  0, 65,211,224, 74,141, 12,187, 65, 41,
+/* 0x1e60 */ 246, 72,139,116, 36, 56, 15,182,185,  3, 24,  2,  0, 65,  1,192,
+/* 0x1e70 */  72,137, 76, 36, 80, 68,137, 68, 36, 88, 68,137,180, 36,140,  0,
+/* 0x1e80 */   0,  0,232, 89,  3,  0,  0, 68,139,108, 36,124, 72,139,124, 36,
+/* 0x1e90 */   8, 65,137,199, 68,137,238, 69, 41,238,232, 17, 19,  0,  0, 68,
+/* 0x1ea0 */ 139,108, 36, 72, 72,139,116, 36, 56, 68,137,180, 36,140,  0,  0,
+/* 0x1eb0 */   0, 65,  1,199, 78,141, 20,171, 65, 15,182,186,  3, 16,  2,  0,
+/* 0x1ec0 */  76,137, 84, 36, 72,232,150,  2,  0,  0, 68,139,108, 36,124, 72,
+/* 0x1ed0 */ 139,124, 36,  8,137, 68, 36, 64, 68,137,238, 69, 41,238,232,205,
+/* 0x1ee0 */  18,  0,  0,139, 76, 36, 64, 68,139, 68, 36, 88, 68,137,180, 36,
+/* 0x1ef0 */ 140,  0,  0,  0, 76,139, 84, 36, 72, 76,139, 76, 36, 96,  1,193,
+/* 0x1f00 */  65,131,248,  3,137,200, 72,139, 76, 36, 80, 15,134,215,  1,  0,
+/* 0x1f10 */   0,139,187,  4, 39,  2,  0, 65,141,112,253,137,187,  8, 39,  2,
+/* 0x1f20 */   0,139,187,  0, 39,  2,  0,137,179,  0, 39,  2,  0,137,187,  4,
+/* 0x1f30 */  39,  2,  0, 72,139,124, 36, 24, 72, 41,239, 57,199, 15,130, 93,
+/* 0x1f40 */   1,  0,  0, 72,139,124, 36, 16, 76, 41,231, 57,199, 15,130, 77,
+/* 0x1f50 */   1,  0,  0,133,192,116, 33, 49,255, 15, 31,128,  0,  0,  0,  0,
+/* 0x1f60 */  15,182, 84, 61,  0, 65,136, 20, 60, 72,131,199,  1, 72, 57,248,
+/* 0x1f70 */ 117,238, 72,  1,197, 73,  1,196, 72,139, 84, 36, 40, 76,137,224,
+/* 0x1f80 */ 141,126,255, 72, 41,208, 57,199, 15,131, 18,  1,  0,  0, 72,139,
+/* 0x1f90 */  68, 36, 16, 76, 41,224, 68, 57,248, 15,130,  1,  1,  0,  0, 76,
+/* 0x1fa0 */ 137,231, 68,137,124, 36,120, 72, 41,247, 69,133,255,116, 37, 49,
+/* 0x1fb0 */ 192, 15, 31,128,  0,  0,  0,  0, 15,182, 20,  7, 65,136, 20,  4,
+/* 0x1fc0 */  72,131,192,  1, 73, 57,199,117,239,199, 68, 36,120,  0,  0,  0,
+/* 0x1fd0 */   0, 77,  1,252,131,108, 36,104,  1, 76,137, 76, 36, 88, 72,137,
+/* 0x1fe0 */  76, 36, 64, 15,132,161,  0,  0,  0, 69, 15,182,186,  2, 16,  2,
+/* 0x1ff0 */   0, 72,139,124, 36,  8, 69, 15,183,170,  0, 16,  2,  0, 68,137,
+/* 0x2000 */ 254, 69, 41,254,232,167, 17,  0,  0, 72,139, 76, 36, 64, 72,139,
+/* 0x2010 */ 124, 36,  8, 68,137,180, 36,140,  0,  0,  0, 68,  1,232, 68, 15,
+/* 0x2020 */ 182,185,  2, 24,  2,  0,137, 68, 36, 72, 15,183,129,  0, 24,  2,
+/* 0x2030 */   0, 68,137,254, 69, 41,254,137, 68, 36, 64, 69,137,245,232,109,
+/* 0x2040 */  17,  0,  0, 76,139, 76, 36, 88,139, 76, 36, 64, 68,137,180, 36,
+/* 0x2050 */ 140,  0,  0,  0, 72,139,124, 36,  8, 69, 15,182,185,  2, 32,  2,
+/* 0x2060 */   0, 69, 15,183,177,  0, 32,  2,  0,  1,200,137, 68, 36, 80, 68,
+/* 0x2070 */ 137,254, 69, 41,253,232, 54, 17,  0,  0, 68,137,172, 36,140,  0,
+/* 0x2080 */   0,  0, 65,  1,198,233,150,253,255,255, 77,137,227, 68,139,100,
+/* 0x2090 */  36,108, 69,133,246, 15,132,237,250,255,255, 15, 31, 68,  0,  0,
+/* 0x20a0 */ 184,255,255,255,255, 72,129,196,152,  0,  0,  0, 91, 93, 65, 92,
+/* 0x20b0 */  65, 93, 65, 94, 65, 95,195,102, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x20c0 */  72,131,249,  1,126,218, 15,182, 80,  2, 15,182, 72,  1,193,226,
+/* 0x20d0 */   8, 68,141,148, 10,  0,127,  0,  0, 72,141, 80,  3,233, 70,251,
+/* 0x20e0 */ 255,255,102, 15, 31, 68,  0,  0,137,198,247,222,139,179,  0, 39,
+/* 0x20f0 */   2,  0, 65,131,216,  0, 69,133,192, 15,132, 52,254,255,255, 65,
+/* 0x2100 */ 131,248,  3,116, 49, 68,137,199,139,188,187,  0, 39,  2,  0, 65,
+/* 0x2110 */ 131,248,  1,116, 14, 68,139,131,  4, 39,  2,  0, 68,137,131,  8,
+/* 0x2120 */  39,  2,  0,137,179,  4, 39,  2,  0,137,254,137,187,  0, 39,  2,
+/* 0x2130 */   0,233,253,253,255,255, 68,139,131,  4, 39,  2,  0,141,126,255,
+/* 0x2140 */ 137,179,  4, 39,  2,  0,137,187,  0, 39,  2,  0,137,254, 68,137,
+/* 0x2150 */ 131,  8, 39,  2,  0,233,233,253,255,255,102, 15, 31, 68,  0,  0,
+/* 0x2160 */ 131,255, 15,118, 59,131,255, 19,118, 38,131,255, 21,118, 81,131,
+/* 0x2170 */ 255, 23,118, 60,131,255, 24,116, 87,141, 79,237,184,  1,  0,  0,
+/* 0x2180 */   0,137, 14,211,224,195,102, 46, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x2190 */ 141, 68, 63,240,185,  1,  0,  0,  0,137, 14,195, 15, 31, 64,  0,
+/* 0x21a0 */  49,201,137,248,137, 14,195,102, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x21b0 */ 141,  4,253,112,255,255,255,185,  3,  0,  0,  0,235,219,102,144,
+/* 0x21c0 */ 185,  2,  0,  0,  0,141,  4,189,200,255,255,255,137, 14,195,144,
+/* 0x21d0 */ 185,  4,  0,  0,  0,184, 48,  0,  0,  0,235,189, 15, 31, 64,  0,
+/* 0x21e0 */ 141, 71,  3, 49,201,131,255, 31,118, 38,131,255, 35,118, 41,131,
+/* 0x21f0 */ 255, 37,118, 76,131,255, 39,118, 47,131,255, 41,118, 82,131,255,
+/* 0x2200 */  42,116, 93,141, 79,220,184,  1,  0,  0,  0,211,224,131,192,  3,
+/* 0x2210 */ 137, 14,195, 15, 31, 68,  0,  0,185,  1,  0,  0,  0,141, 68, 63,
+/* 0x2220 */ 227,137, 14,195, 15, 31, 64,  0,141,  4,253,  3,255,255,255,185,
+/* 0x2230 */   3,  0,  0,  0,235,218,102, 46, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x2240 */ 185,  2,  0,  0,  0,141,  4,189,155,255,255,255,137, 14,195,144,
+/* 0x2250 */ 193,231,  4,185,  4,  0,  0,  0,141,135,195,253,255,255,235,176,
+/* 0x2260 */ 185,  5,  0,  0,  0,184, 99,  0,  0,  0,235,164, 15, 31, 64,  0,
+/* 0x2270 */ 133,246, 15,132,160,  3,  0,  0, 65, 87, 65, 86, 65, 85, 65, 84,
+/* 0x2280 */  85, 72,137,205, 83, 72,137,251, 72,137,215, 72,131,236, 56, 68,
+/* 0x2290 */  15,182,  3, 69,137,195, 68,137,194, 65,192,235,  2,131,226,  3,
+/* 0x22a0 */  69,137,220, 68,137,217, 65,131,228,  3,131,225,  3, 65,246,192,
+/* 0x22b0 */   2, 15,132,  9,  2,  0,  0,133,201,184,  1,  0,  0,  0, 15, 69,
+/* 0x22c0 */ 193, 68,141, 64,  2, 68, 57,198, 15,130,202,  2,  0,  0,131,192,
+/* 0x22d0 */   1, 69, 49,210, 72,  1,216,102, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x22e0 */  68, 15,182,  8, 73,193,226,  8, 77,  9,202, 73,137,193, 72,131,
+/* 0x22f0 */ 232,  1, 73, 57,217,117,233, 77,137,209, 73,193,233,  4, 65,131,
+/* 0x2300 */ 227,  2, 15,132,152,  1,  0,  0,141,  4,141,  0,  0,  0,  0, 65,
+/* 0x2310 */ 191,255,255,255,255, 69,137,206,141, 72,  6, 65,211,231,141, 72,
+/* 0x2320 */  10, 65,247,215, 73,211,234, 69, 33,254, 69, 33,215, 65,129,254,
+/* 0x2330 */   0,  0,  2,  0, 15,135, 94,  2,  0,  0, 68, 41,198, 68, 57,254,
+/* 0x2340 */  15,130, 82,  2,  0,  0, 68,137,192, 68,137, 55, 72,  1,195, 67,
+/* 0x2350 */ 141,  4, 56,137, 68, 36, 12,128,250,  2, 15,132,104,  2,  0,  0,
+/* 0x2360 */ 128,189, 16, 39,  2,  0,  0, 15,132, 43,  2,  0,  0, 69,132,228,
+/* 0x2370 */  15,132,  2,  2,  0,  0, 65,141, 78,  3,193,233,  2, 65,131,255,
+/* 0x2380 */   5, 15,134, 17,  2,  0,  0,141,  4, 73,137, 68, 36, 32, 65, 57,
+/* 0x2390 */ 198, 15,130,  1,  2,  0,  0, 68, 15,183, 83,  2, 15,183, 51, 65,
+/* 0x23a0 */ 141,127,250, 72,131,195,  6, 68, 15,183,107,254,137,124, 36, 44,
+/* 0x23b0 */  70,141, 60, 22,137,116, 36, 24, 77,137,212, 67,141,  4, 47,102,
+/* 0x23c0 */  68,137,108, 36, 42, 68,137, 84, 36, 16, 57,199, 15,130,198,  1,
+/* 0x23d0 */   0,  0, 73,137,232, 72,137,234, 72,137,223,137, 76, 36, 36,232,
+/* 0x23e0 */  60,  2,  0,  0,133,192, 15,132,172,  1,  0,  0, 68,139, 92, 36,
+/* 0x23f0 */  24,139,116, 36, 16, 73,137,232, 69, 15,183,219, 73,  1,219,139,
+/* 0x2400 */  92, 36, 36, 76,137,223, 76,137, 92, 36, 16, 72,141, 84, 29,  0,
+/* 0x2410 */  72,137,217, 72,137, 84, 36, 24,232,  3,  2,  0,  0,133,192, 15,
+/* 0x2420 */ 132,115,  1,  0,  0, 76,139, 92, 36, 16, 72,139, 84, 36, 24, 73,
+/* 0x2430 */ 137,232, 68,137,238,139, 76, 36, 36, 77,  1,220, 72,  1,218, 76,
+/* 0x2440 */ 137,231, 72,137, 84, 36, 16,232,212,  1,  0,  0,133,192, 15,132,
+/* 0x2450 */  68,  1,  0,  0,139, 68, 36, 32,139,116, 36, 44, 68,137,241, 73,
+/* 0x2460 */ 137,232, 72,139, 84, 36, 16, 41,193, 15,183, 68, 36, 42, 68, 41,
+/* 0x2470 */ 238, 72,  1,218, 68, 41,254, 73,141, 60,  4,232,160,  1,  0,  0,
+/* 0x2480 */ 133,192, 15,132, 16,  1,  0,  0,139, 68, 36, 12, 72,131,196, 56,
+/* 0x2490 */  91, 93, 65, 92, 65, 93, 65, 94, 65, 95,195, 15, 31, 68,  0,  0,
+/* 0x24a0 */  73,193,234, 14, 69,137,206, 69,137,215, 65,129,230,255,  3,  0,
+/* 0x24b0 */   0, 65,129,231,255,  3,  0,  0,233,125,254,255,255, 15, 31,  0,
+/* 0x24c0 */ 209,233, 65,131,227,  1,141, 65,  2,185,  1,  0,  0,  0, 15, 68,
+/* 0x24d0 */ 193, 15,182,202,  1,193, 57,206, 15,130,186,  0,  0,  0, 65,128,
+/* 0x24e0 */ 252,  1, 15,132,192,  0,  0,  0, 65,128,252,  3,117,122, 68, 15,
+/* 0x24f0 */ 182, 75,  1, 15,182, 75,  2, 65,192,232,  4, 69, 15,182,192, 65,
+/* 0x2500 */ 193,225,  4,193,225, 12, 69,  1,193, 65,  1,201, 65,129,249,  0,
+/* 0x2510 */   0,  2,  0, 15,143,127,  0,  0,  0, 65,137,192, 68,137, 15, 73,
+/* 0x2520 */   1,216,128,250,  1, 15,132,197,  0,  0,  0, 41,198, 68, 57,206,
+/* 0x2530 */ 114,102, 68,137,206, 49,210, 69,133,201,116, 22, 15, 31, 64,  0,
+/* 0x2540 */  65, 15,182, 12, 16,136, 76, 21,  0, 72,131,194,  1, 72, 57,242,
+/* 0x2550 */ 117,238, 72,131,196, 56, 68,  1,200, 91, 93, 65, 92, 65, 93, 65,
+/* 0x2560 */  94, 65, 95,195, 15, 31, 64,  0, 65,192,232,  3, 69, 15,182,200,
+/* 0x2570 */ 235,167,102, 15, 31, 68,  0,  0, 73,137,232, 68,137,241, 72,137,
+/* 0x2580 */ 234, 68,137,254, 72,137,223,232,148,  0,  0,  0,133,192, 15,133,
+/* 0x2590 */ 244,254,255,255, 15, 31, 64,  0,184,255,255,255,255,233,234,254,
+/* 0x25a0 */ 255,255,102, 15, 31, 68,  0,  0, 68, 15,182, 75,  1, 65,192,232,
+/* 0x25b0 */   4, 69, 15,182,192, 65,193,225,  4, 69,  1,193,233, 88,255,255,
+/* 0x25c0 */ 255, 15, 31,128,  0,  0,  0,  0, 72,137,234, 68,137,254, 72,137,
+/* 0x25d0 */ 223,232,250,  0,  0,  0,133,192,120,190, 72, 99,208, 65, 41,199,
+/* 0x25e0 */  72,  1,211,233,133,253,255,255, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x25f0 */  68,137,201, 72,  1,233, 69,133,201,116, 21, 15, 31, 68,  0,  0,
+/* 0x2600 */  65, 15,182, 16, 72,131,197,  1,136, 85,255, 72, 57,205,117,240,
+/* 0x2610 */ 131,192,  1,233,116,254,255,255,184,255,255,255,255,195,102,144,
+/* 0x2620 */  65, 86, 65, 85, 65, 84, 85, 83, 72,137,211, 49,210, 72,131,236,
+/* 0x2630 */  16,133,246, 15,132,129,  0,  0,  0,141, 70,255, 73,137,197, 15,
+/* 0x2640 */ 182,  4,  7,132,192,116,115, 65,193,229,  3,209,232, 72,137, 60,
+/* 0x2650 */  36, 77,137,198,137,116, 36,  8,116, 16,102, 15, 31, 68,  0,  0,
+/* 0x2660 */ 131,194,  1,209,232,117,249, 65,  1,213, 68,137,108, 36, 12,133,
+/* 0x2670 */ 201,116, 63,137,205, 73,137,228, 72,  1,221, 15, 31, 68,  0,  0,
+/* 0x2680 */  65, 15,182,182, 16, 39,  2,  0, 76,137,231, 72,131,195,  1,232,
+/* 0x2690 */  28, 11,  0,  0,137,192, 65, 15,183,132, 70,  0,  0,  2,  0,136,
+/* 0x26a0 */  67,255,193,232,  8, 65, 41,197, 68,137,108, 36, 12, 72, 57,235,
+/* 0x26b0 */ 117,206, 49,210, 69,133,237, 15,148,194, 72,131,196, 16,137,208,
+/* 0x26c0 */  91, 93, 65, 92, 65, 93, 65, 94,195, 15, 31,128,  0,  0,  0,  0,
+/* 0x26d0 */ 133,246, 15,132, 37,  4,  0,  0, 65, 87, 65, 86, 65, 85, 65, 84,
+/* 0x26e0 */  85, 72,137,253, 83, 72,137,211, 72,131,236, 72, 68, 15,182, 55,
+/* 0x26f0 */  68,137,116, 36, 12, 65,131,254,127, 15,135,  1,  2,  0,  0,131,
+/* 0x2700 */ 238,  1,199, 68, 36, 24, 15,  0,  0,  0, 68, 57,246, 15,130,211,
+/* 0x2710 */   1,  0,  0, 76,141,170,  0, 37,  2,  0, 76,141, 71,  1, 69,137,
+/* 0x2720 */ 241,185,  6,  0,  0,  0, 72,141, 84, 36, 28, 72,141,116, 36, 24,
+/* 0x2730 */  76,137,239,232,152,  6,  0,  0, 76, 99,224, 69,133,228, 15,136,
+/* 0x2740 */ 162,  1,  0,  0, 68,139,124, 36, 28,139, 84, 36, 24, 76,137,238,
+/* 0x2750 */  72,141,187,  0, 36,  2,  0, 76,141,131,128, 37,  2,  0, 68,137,
+/* 0x2760 */ 249,232,218,  8,  0,  0, 68,137,242, 68, 41,226, 15,132,116,  1,
+/* 0x2770 */   0,  0, 74,141, 76, 37,  1,141, 66,255, 73,137,196, 15,182,  4,
+/* 0x2780 */   1,132,192, 15,132, 93,  1,  0,  0,209,232, 72,137, 76, 36, 32,
+/* 0x2790 */  70,141, 52,229,  0,  0,  0,  0,137, 84, 36, 40,116, 12, 49,210,
+/* 0x27a0 */ 131,194,  1,209,232,117,249, 65,  1,214, 76,141,108, 36, 32, 68,
+/* 0x27b0 */ 137,254, 68,137,116, 36, 44, 69, 41,254, 76,137,239,232,238,  9,
+/* 0x27c0 */   0,  0, 68,137,254, 76,137,239, 68,137,116, 36, 44,137,197,232,
+/* 0x27d0 */ 220,  9,  0,  0, 68,137,242, 65,190,  1, 38,  2,  0, 68, 41,250,
+/* 0x27e0 */  65,137,196,137, 84, 36, 44,235, 85, 15, 31,128,  0,  0,  0,  0,
+/* 0x27f0 */  74,141,  4,163,137, 84, 36,  4, 15,182,176,  3, 36,  2,  0, 66,
+/* 0x2800 */ 136, 52, 51, 68, 15,182,160,  2, 36,  2,  0, 73,131,198,  2, 15,
+/* 0x2810 */ 183,184,  0, 36,  2,  0, 68,137,230,137, 60, 36, 76,137,239,232,
+/* 0x2820 */ 140,  9,  0,  0,139, 84, 36,  4,139, 60, 36, 68, 41,226, 68,141,
+/* 0x2830 */  36,  7,137, 84, 36, 44,133,210, 15,136,130,  2,  0,  0, 68,137,
+/* 0x2840 */ 116, 36,  8, 73,129,254,255, 38,  2,  0, 15,132,150,  0,  0,  0,
+/* 0x2850 */  72,141,  4,171, 76,137,239, 15,182,144,  3, 36,  2,  0, 66,136,
+/* 0x2860 */  84, 51,255, 68, 15,182,184,  2, 36,  2,  0, 15,183,168,  0, 36,
+/* 0x2870 */   2,  0, 68,137,254,232, 54,  9,  0,  0,139, 84, 36, 44,  1,197,
+/* 0x2880 */  68, 41,250, 69,141,190,  1,218,253,255,137, 84, 36, 44,133,210,
+/* 0x2890 */  15,137, 90,255,255,255, 66, 15,182,132,163,  3, 36,  2,  0, 66,
+/* 0x28a0 */ 136,  4, 51,139, 68, 36, 12,131,192,  1, 72,141,187,  0, 38,  2,
+/* 0x28b0 */   0, 69,137,248, 49,246, 65,185,  1,  0,  0,  0, 78,141, 20,  7,
+/* 0x28c0 */  72,137,250,235, 25, 15, 31,  0, 69,137,203, 72,131,194,  1, 65,
+/* 0x28d0 */ 211,227, 68,137,217,209,233,  1,206, 76, 57,210,116,114, 15,182,
+/* 0x28e0 */  10,128,249, 11,118,226, 72,131,196, 72,184,255,255,255,255, 91,
+/* 0x28f0 */  93, 65, 92, 65, 93, 65, 94, 65, 95,195,102, 15, 31, 68,  0,  0,
+/* 0x2900 */ 139, 68, 36, 12, 68,141,112,130, 68,141,120,129, 65,209,238, 65,
+/* 0x2910 */ 141, 70,  1, 57,198,114,207, 49,201, 15, 31,128,  0,  0,  0,  0,
+/* 0x2920 */ 137,202,209,234,131,194,  1, 15,182, 84, 21,  0,137,214,192,234,
+/* 0x2930 */   4,131,230, 15,246,193,  1, 15, 69,214,136,148, 11,  0, 38,  2,
+/* 0x2940 */   0, 72,131,193,  1, 68, 57,249,114,214,233, 91,255,255,255,144,
+/* 0x2950 */ 133,246,116,146,137,242,209,234, 15,132,133,  1,  0,  0, 49,201,
+/* 0x2960 */  65,137,201,131,193,  1,209,234,117,246, 65,131,193,  2,186,  1,
+/* 0x2970 */   0,  0,  0, 68,137,201,211,226, 41,242, 65,131,249, 11, 15,135,
+/* 0x2980 */  98,255,255,255,141, 74,255, 33,209, 15,133, 87,255,255,255,209,
+/* 0x2990 */ 234, 15,132, 92,  1,  0,  0,102, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x29a0 */ 131,193,  1,209,234,117,249,131,193,  1, 76,141,108, 36, 32, 66,
+/* 0x29b0 */ 136,140,  3,  0, 38,  2,  0, 72,141, 76, 36, 64, 76,137,234,144,
+/* 0x29c0 */  49,246, 72,131,194,  2,102,137,114,254, 72, 57,209,117,241, 74,
+/* 0x29d0 */ 141,140,  3,  1, 38,  2,  0,102, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x29e0 */  15,182, 23, 72,131,199,  1,102,131, 68, 84, 32,  1, 72, 57,207,
+/* 0x29f0 */ 117,238, 68,137,207, 49,201, 49,246, 69,133,201,116, 27,102,144,
+/* 0x2a00 */  65, 15,183, 84, 77,  2,102, 65,137,116, 77,  2,211,226, 72,131,
+/* 0x2a10 */ 193,  1,  1,214, 72, 57,207,117,231, 49,246, 65,141,105,  1, 76,
+/* 0x2a20 */ 141, 91,  2, 65,188,  1,  0,  0,  0,235, 17, 15, 31, 68,  0,  0,
+/* 0x2a30 */  72,141, 86,  1, 76, 57,198,116,105, 72,137,214, 15,182,140, 51,
+/* 0x2a40 */   0, 38,  2,  0,132,201,116,232, 69,137,226, 68, 15,183,108, 76,
+/* 0x2a50 */  32, 15,182,209, 65,211,226,137,233, 65,209,234, 41,209, 74,141,
+/* 0x2a60 */  20,107, 76,137,239, 69,141,114,255,193,225,  8, 76,  1,247,  9,
+/* 0x2a70 */ 241, 73,141, 60,123, 15, 31,  0,102,137,138,  0,  0,  2,  0, 72,
+/* 0x2a80 */ 131,194,  2, 72, 57,215,117,240, 15,182,148, 51,  0, 38,  2,  0,
+/* 0x2a90 */  69,  1,234,102, 68,137, 84, 84, 32, 72,141, 86,  1, 76, 57,198,
+/* 0x2aa0 */ 117,151, 68,136,139, 16, 39,  2,  0, 72,131,196, 72, 91, 93, 65,
+/* 0x2ab0 */  92, 65, 93, 65, 94, 65, 95,195, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x2ac0 */  15,182,132,171,  3, 36,  2,  0, 69,137,248, 66,136,132,  3,  0,
+/* 0x2ad0 */  38,  2,  0,139, 68, 36,  8, 68,141,184,  2,218,253,255,233,192,
+/* 0x2ae0 */ 253,255,255, 65,185,  1,  0,  0,  0,185,  1,  0,  0,  0,233,183,
+/* 0x2af0 */ 254,255,255,185,  1,  0,  0,  0,233,173,254,255,255,184,255,255,
+/* 0x2b00 */ 255,255,195,102,102, 46, 15, 31,132,  0,  0,  0,  0,  0,102,144,
+/* 0x2b10 */  65, 86, 65, 85, 65, 84, 73,137,244, 85, 72,137,253, 83, 72,131,
+/* 0x2b20 */ 236, 32, 68,137, 76, 36, 12, 72,139, 92, 36, 88,133,210, 15,133,
+/* 0x2b30 */ 140,  0,  0,  0, 68,137,207, 72,141,179,  0, 37,  2,  0, 49,192,
+/* 0x2b40 */  65,131,249, 35, 15,132,190,  0,  0,  0, 72,185,146, 36,109,147,
+/* 0x2b50 */  36, 73,146, 36, 65,131,249, 52, 15,132, 74,  1,  0,  0,102,144,
+/* 0x2b60 */  72,131,248, 21, 15,132,126,  0,  0,  0,137,202, 72,193,233,  3,
+/* 0x2b70 */ 131,226,  7,131,234,  1,102,137,148, 67,  0, 37,  2,  0, 72,131,
+/* 0x2b80 */ 192,  1, 72,131,248, 29,117,216, 65,189,  6,  0,  0,  0,191, 28,
+/* 0x2b90 */   0,  0,  0,185,  5,  0,  0,  0,137,250, 76,141,131,128, 37,  2,
+/* 0x2ba0 */   0, 72,137,239,232,151,  4,  0,  0, 49,192, 69,136, 44, 36, 72,
+/* 0x2bb0 */ 131,196, 32, 91, 93, 65, 92, 65, 93, 65, 94,195, 15, 31, 64,  0,
+/* 0x2bc0 */ 131,250,  1, 15,132,167,  0,  0,  0,131,250,  2, 15,132, 78,  1,
+/* 0x2bd0 */   0,  0,128, 62,  1, 25,192, 72,131,196, 32, 91, 93, 65, 92, 65,
+/* 0x2be0 */  93, 65, 94,195, 15, 31, 64,  0,186,  1,  0,  0,  0,185, 18,  0,
+/* 0x2bf0 */   0,  0,184, 22,  0,  0,  0,102,137,147, 42, 37,  2,  0,233,103,
+/* 0x2c00 */ 255,255,255, 15, 31, 68,  0,  0, 72,185,229,182,109,219, 54, 73,
+/* 0x2c10 */ 219, 54,102, 15, 31, 68,  0,  0, 72,131,248, 21,116, 50,137,202,
+/* 0x2c20 */  72,193,233,  3,131,226,  7,131,234,  1,102,137,148, 67,  0, 37,
+/* 0x2c30 */   2,  0, 72,131,192,  1, 72,131,248, 36,117,220, 65,189,  7,  0,
+/* 0x2c40 */   0,  0,185,  6,  0,  0,  0,233, 76,255,255,255, 15, 31, 64,  0,
+/* 0x2c50 */  65,185,  2,  0,  0,  0,185,219, 56, 73, 18,184, 22,  0,  0,  0,
+/* 0x2c60 */ 102, 68,137,139, 42, 37,  2,  0,235,180,102, 15, 31, 68,  0,  0,
+/* 0x2c70 */  69,133,192, 15,132,253,  0,  0,  0, 15,182, 17, 57, 84, 36, 12,
+/* 0x2c80 */  15,130,240,  0,  0,  0, 49,192,136, 85,  3, 65,189,  1,  0,  0,
+/* 0x2c90 */   0,102,137,  7,184,  1,  0,  0,  0,198, 71,  2,  0,233,  9,255,
+/* 0x2ca0 */ 255,255,102, 15, 31, 68,  0,  0, 72,129,193,152,146,  0,  0, 72,
+/* 0x2cb0 */ 131,248, 21,116, 46, 72,131,248, 42,116, 77,137,202, 72,193,233,
+/* 0x2cc0 */   3,131,226,  7,131,234,  1,102,137,148, 67,  0, 37,  2,  0, 72,
+/* 0x2cd0 */ 131,192,  1, 72,131,248, 53, 15,132, 95,255,255,255, 72,131,248,
+/* 0x2ce0 */  21,117,210, 65,184,  1,  0,  0,  0,184, 22,  0,  0,  0, 72,185,
+/* 0x2cf0 */ 146, 36, 73,146, 36, 73,146,  4,102, 68,137,131, 42, 37,  2,  0,
+/* 0x2d00 */ 235,185,102, 15, 31, 68,  0,  0,185,  1,  0,  0,  0,184, 43,  0,
+/* 0x2d10 */   0,  0,102,137,139, 84, 37,  2,  0,185,146,  0,  0,  0,235,155,
+/* 0x2d20 */  69,137,193, 76,141,179,  0, 37,  2,  0, 73,137,200,139, 76, 36,
+/* 0x2d30 */  80, 72,141, 84, 36, 28, 72,141,116, 36, 12, 76,137,247,232,141,
+/* 0x2d40 */   0,  0,  0,133,192,137, 68, 36,  8,120, 43, 68,139,108, 36, 28,
+/* 0x2d50 */ 139, 84, 36, 12, 76,137,246, 72,137,239, 76,141,131,128, 37,  2,
+/* 0x2d60 */   0, 68,137,233, 65,131,197,  1,232,211,  2,  0,  0,139, 68, 36,
+/* 0x2d70 */   8,233, 53,254,255,255,184,255,255,255,255,233, 47,254,255,255,
+/* 0x2d80 */  73,137,249,133,246,116, 57,137,246, 49,192,235, 37, 15, 31,  0,
+/* 0x2d90 */  72,131,248, 42, 73, 15, 68,208,137,215, 72,193,234,  3,131,231,
+/* 0x2da0 */   7,131,239,  1,102, 65,137, 60, 65, 72,131,192,  1, 72, 57,198,
+/* 0x2db0 */ 116, 14, 72,131,248, 21,117,216, 72,137,202,235,219, 15, 31,  0,
+/* 0x2dc0 */ 195,102,102, 46, 15, 31,132,  0,  0,  0,  0,  0, 15, 31, 64,  0,
+/* 0x2dd0 */  69,133,201, 15,132, 85,  2,  0,  0, 65, 87,137,200, 65, 86, 65,
+/* 0x2de0 */  85, 73,137,213, 65, 84, 85, 76,137,197, 83, 65, 15,182, 16, 72,
+/* 0x2df0 */ 137,243,131,226, 15,141, 74,  5, 15,182,241, 57,240, 15,130,111,
+/* 0x2e00 */   1,  0,  0,184,  1,  0,  0,  0,137,116, 36,236, 73,137,254,131,
+/* 0x2e10 */ 194,  6, 76,137,108, 36,248,211,224, 68,139, 35, 15,182,250, 72,
+/* 0x2e20 */ 137, 92, 36,240, 68,141, 64,  1, 69, 49,255, 76,137,243, 65,186,
+/* 0x2e30 */   4,  0,  0,  0, 69,137,213, 49,210, 69, 49,219, 65,193,237,  3,
+/* 0x2e40 */  69,137,238, 73,  1,238,102, 46, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x2e50 */  65,141, 76, 21,  0, 68, 57,201,115, 18, 65, 15,182, 52, 22,141,
+/* 0x2e60 */  12,213,  0,  0,  0,  0, 72,211,230, 73,  9,243, 72,131,194,  1,
+/* 0x2e70 */  72,131,250,  5,117,218, 68,137,209,141, 52,  0,141, 80,255,131,
+/* 0x2e80 */ 225,  7, 73,211,235,137,241, 68, 41,193, 68, 33,218,131,233,  1,
+/* 0x2e90 */  57,202,125, 92, 69,141, 84, 58,255,141, 74,255, 68,137,254,137,
+/* 0x2ea0 */ 202,102,137, 12,115,247,218, 15, 72,209, 65, 41,208, 65,141, 87,
+/* 0x2eb0 */   1, 65, 57,192,115, 20,102, 46, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x2ec0 */ 209,232,131,239,  1, 65, 57,192,114,246, 65,131,248,  1, 15,134,
+/* 0x2ed0 */  28,  1,  0,  0, 65, 57,212, 15,130, 19,  1,  0,  0,133,201,116,
+/* 0x2ee0 */  39, 65,137,215,233, 75,255,255,255, 15, 31,128,  0,  0,  0,  0,
+/* 0x2ef0 */ 131,238,  1, 68, 33,222,137,242, 41,206, 57,208, 15, 78,214, 65,
+/* 0x2f00 */   1,250,235,149, 15, 31, 64,  0,137, 84, 36,232, 65,137,214,144,
+/* 0x2f10 */  69,137,213, 49,210, 49,246, 65,193,237,  3, 69,137,239, 73,  1,
+/* 0x2f20 */ 239, 15, 31,128,  0,  0,  0,  0, 65,141, 76, 21,  0, 68, 57,201,
+/* 0x2f30 */ 115, 18, 69, 15,182, 28, 23,141, 12,213,  0,  0,  0,  0, 73,211,
+/* 0x2f40 */ 227, 76,  9,222, 72,131,194,  1, 72,131,250,  5,117,218, 68,137,
+/* 0x2f50 */ 209,131,225,  7, 72,211,238, 15,183,214, 65,137,243,129,250,255,
+/* 0x2f60 */ 255,  0,  0,117, 29, 65,131,198, 24, 65,131,194, 16, 69, 57,244,
+/* 0x2f70 */ 115,158, 91,184,255,255,255,255, 93, 65, 92, 65, 93, 65, 94, 65,
+/* 0x2f80 */  95,195,131,230,  3,139, 84, 36,232,131,254,  3,117, 25,102,144,
+/* 0x2f90 */  65,193,235,  2, 65,131,198,  3, 65,131,194,  2, 68,137,222,131,
+/* 0x2fa0 */ 230,  3,131,254,  3,116,233, 66,141, 12, 54, 65,131,194,  2, 65,
+/* 0x2fb0 */  57,204,114,190, 57,202, 15,131, 37,255,255,255, 65,137,205, 65,
+/* 0x2fc0 */ 137,211, 65, 41,213, 74,141, 52, 91, 65,141, 85,255, 76,  1,218,
+/* 0x2fd0 */  72,141, 84, 83,  2, 15, 31,  0, 69, 49,219, 72,131,198,  2,102,
+/* 0x2fe0 */  68,137, 94,254, 72, 57,214,117,239,137,202,233,241,254,255,255,
+/* 0x2ff0 */ 139,116, 36,236, 72,139, 92, 36,240, 76,139,108, 36,248, 65,131,
+/* 0x3000 */ 248,  1, 15,133,106,255,255,255, 65,193,225,  3, 69, 57,209, 15,
+/* 0x3010 */ 130, 93,255,255,255, 65,141, 66,  7, 68,137, 59,193,232,  3, 65,
+/* 0x3020 */ 137,117,  0, 91, 93, 65, 92, 65, 93, 65, 94, 65, 95,195,184,255,
+/* 0x3030 */ 255,255,255,195,102,102, 46, 15, 31,132,  0,  0,  0,  0,  0,144,
+/* 0x3040 */  65, 87, 73,137,249, 65, 86, 65,190,  1,  0,  0,  0, 65,211,230,
+/* 0x3050 */  65, 85, 65,137,205, 65, 84, 68,137,240, 65,137,212, 68,137,242,
+/* 0x3060 */  85,209,234,193,232,  3, 72,137,245, 65,141,118,255,141,124,  2,
+/* 0x3070 */   3, 83, 49,192, 76,137,195,137,242, 15, 31,128,  0,  0,  0,  0,
+/* 0x3080 */ 137,193, 76,141,  4, 75, 15,183, 76, 77,  0,102,131,249,255,117,
+/* 0x3090 */  15,137,209,131,234,  1, 65,136, 68,137,  3,185,  1,  0,  0,  0,
+/* 0x30a0 */ 131,192,  1,102, 65,137,  8, 65, 57,196,115,212, 49,201, 49,192,
+/* 0x30b0 */  68, 15,191, 84, 77,  0, 65,137,203, 69, 49,192,102, 69,133,210,
+/* 0x30c0 */ 126, 31,102, 15, 31, 68,  0,  0, 65,137,199, 71,136, 92,185,  3,
+/* 0x30d0 */   1,248, 33,240, 57,194,114,248, 65,131,192,  1, 69, 57,208,117,
+/* 0x30e0 */ 231, 76,141, 65,  1, 73, 57,204,116,  5, 76,137,193,235,193, 68,
+/* 0x30f0 */ 137,247, 69,137,246, 79,141,  4,177, 15, 31,128,  0,  0,  0,  0,
+/* 0x3100 */  65, 15,182, 65,  3, 72,141,  4, 67, 15,183, 48,141, 86,  1,102,
+/* 0x3110 */ 137, 16,137,240,209,232,116, 53, 49,210,102, 15, 31, 68,  0,  0,
+/* 0x3120 */ 131,194,  1,209,232,117,249, 68,137,233, 41,209,211,230, 65,136,
+/* 0x3130 */  73,  2, 73,131,193,  4, 41,254,102, 65,137,113,252, 77, 57,200,
+/* 0x3140 */ 117,190, 91, 93, 65, 92, 65, 93, 65, 94, 65, 95,195, 68,137,233,
+/* 0x3150 */ 235,218,102,102, 46, 15, 31,132,  0,  0,  0,  0,  0, 15, 31,  0,
+/* 0x3160 */  49,201,133,210,116, 59, 68,141, 66,255, 76,137,192, 73,  1,240,
+/* 0x3170 */  65,128, 56,  0,116, 43, 72,137, 55,141, 12,197,  0,  0,  0,  0,
+/* 0x3180 */ 137, 87,  8, 65, 15,182,  0,209,232,116, 14, 49,210, 15, 31,  0,
+/* 0x3190 */ 131,194,  1,209,232,117,249,  1,209,137, 79, 12,185,  1,  0,  0,
+/* 0x31a0 */   0,137,200,195,102,102, 46, 15, 31,132,  0,  0,  0,  0,  0,144,
+/* 0x31b0 */  68,139, 79, 12,137,242, 69,133,201,126,117,133,246,116,113, 69,
+/* 0x31c0 */ 137,202,139,119,  8, 65, 41,210,120,126, 69,137,208,137,209,184,
+/* 0x31d0 */   1,  0,  0,  0, 65,131,226,  7, 65,193,248,  3, 72,211,224, 65,
+/* 0x31e0 */ 141, 80,  8, 77, 99,200,131,232,  1, 76,  3, 15, 57,214,115, 72,
+/* 0x31f0 */  65, 57,240,115, 59,141,126,255, 49,210, 68, 41,199, 69, 49,192,
+/* 0x3200 */  65, 15,182, 52, 17,141, 12,213,  0,  0,  0,  0, 72,211,230, 73,
+/* 0x3210 */   9,240, 72,137,214, 72,131,194,  1, 72, 57,247,117,226, 68,137,
+/* 0x3220 */ 209, 73,211,232, 68, 33,192,195, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x3230 */  49,192,195, 15, 31, 68,  0,  0, 73,139, 17, 68,137,209, 72,211,
+/* 0x3240 */ 234, 33,208,195, 15, 31, 64,  0, 49,192, 69, 49,210, 72, 57,240,
+/* 0x3250 */ 116, 31, 72,139, 15, 68, 15,182,  4,  1,141, 12,197,  0,  0,  0,
+/* 0x3260 */   0, 72,131,192,  1, 73,211,224, 77,  9,194, 72,131,248,  4,117,
+/* 0x3270 */ 220, 68,137,201, 72,199,192,255,255,255,255, 68, 41,202, 72,211,
+/* 0x3280 */ 224,137,209, 72,247,208, 76, 33,208, 72,211,224,195, 15, 31,  0,
+/* 0x3290 */  83, 73,137,251,137,243,232, 21,255,255,255, 65, 41, 91, 12, 91,
+/* 0x32a0 */ 195,102,102, 46, 15, 31,132,  0,  0,  0,  0,  0, 15, 31, 64,  0,
+/* 0x32b0 */  65,137,210, 69, 49,192, 49,192, 65,193,234,  3, 68,137,209, 72,
+/* 0x32c0 */   1,207,102, 15, 31, 68,  0,  0, 71,141, 12,  2, 65, 57,241,115,
+/* 0x32d0 */  19, 70, 15,182, 12,  7, 66,141, 12,197,  0,  0,  0,  0, 73,211,
+/* 0x32e0 */ 225, 76,  9,200, 73,131,192,  1, 73,131,248,  5,117,218,131,226,
+/* 0x32f0 */   7,137,209, 72,211,232,195,102, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x3300 */  49,192,209,239,116, 26,102, 46, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x3310 */ 131,192,  1,209,239,117,249,195, 15, 31,132,  0,  0,  0,  0,  0,
+/* 0x3320 */ 195, 87, 94, 65,128,248, 15, 15,133,  0,  0,  0,  0, 85, 72,137,
+/* 0x3330 */ 229, 87, 82, 81, 72, 41,254, 72,141,132, 36,  0,250,255,255, 72,
+/* 0x3340 */ 131,224,192,106,  0, 72, 57,196,117,249, 73,137,224,232, 28,  0,
+/* 0x3350 */   0,  0, 72,139,117,248,137,192, 72,  1,198, 72,139, 77,232,139,
+/* 0x3360 */   9, 72,139,125,240, 72,  1,207,201,233,  0,  0,  0,  0, 65, 87,
+/* 0x3370 */ 137,246, 65, 86, 72,  1,254, 73,137,206, 65, 85, 73,137,213, 65,
+/* 0x3380 */  84, 73,137,252, 85, 76,137,237, 83, 76,137,195, 72,131,236, 24,
+/* 0x3390 */ 139,  1, 72,  1,208, 49,210, 72,137, 68, 36,  8, 49,192,137,  1,
+/* 0x33a0 */  73,137,184, 56,  5,  0,  0, 73,137,176, 64,  5,  0,  0, 65,137,
+/* 0x33b0 */ 144, 72,  5,  0,  0, 65,137,144, 76,  5,  0,  0, 65,137,144, 80,
+/* 0x33c0 */   5,  0,  0, 65,137,144, 84,  5,  0,  0,190,  1,  0,  0,  0, 72,
+/* 0x33d0 */ 137,223,232,251,  6,  0,  0,190,  2,  0,  0,  0, 72,137,223, 65,
+/* 0x33e0 */ 137,199,232,235,  6,  0,  0,133,192,117, 18, 72,139,116, 36,  8,
+/* 0x33f0 */  72,137,218, 72,137,239,232,108,  0,  0,  0,235, 58,131,248,  1,
+/* 0x3400 */ 117, 10, 72,137,223,232,127,  2,  0,  0,235, 21,131,248,  2,116,
+/* 0x3410 */   4, 49,192,235, 67, 72,137,223,232, 76,  3,  0,  0,133,192,117,
+/* 0x3420 */ 240, 72,139,116, 36,  8, 73,137,216, 76,137,225, 76,137,234, 72,
+/* 0x3430 */ 137,239,232,199,  0,  0,  0,131,187, 80,  5,  0,  0,  0, 72,137,
+/* 0x3440 */ 197,117,206, 69,133,255,116,130, 76, 41,237, 72,139,131, 56,  5,
+/* 0x3450 */   0,  0, 65,137, 46, 68, 41,224, 72,131,196, 24, 91, 93, 65, 92,
+/* 0x3460 */  65, 93, 65, 94, 65, 95,195, 72,137,208, 72,137,249, 72,139,146,
+/* 0x3470 */  56,  5,  0,  0, 72,137,247, 76,139,136, 64,  5,  0,  0, 49,246,
+/* 0x3480 */ 137,176, 72,  5,  0,  0,137,176, 76,  5,  0,  0, 76,137,206, 72,
+/* 0x3490 */  41,214, 72,131,254,  3,126, 88, 64,138, 50, 64, 50,114,  2, 64,
+/* 0x34a0 */ 254,198,117, 76, 64,138,114,  1, 64, 50,114,  3, 64,254,198,117,
+/* 0x34b0 */  63, 68, 15,183, 18, 76,141, 66,  4, 77, 41,193, 76,137,214, 69,
+/* 0x34c0 */  57,209,114, 44, 72, 41,207, 68, 57,215,114, 36, 49,255, 72, 57,
+/* 0x34d0 */ 254,116, 14, 68,138, 76, 58,  4, 68,136, 12, 57, 72,255,199,235,
+/* 0x34e0 */ 237, 73,  1,240, 72,  1,241, 76,137,128, 56,  5,  0,  0,235, 10,
+/* 0x34f0 */ 199,128, 80,  5,  0,  0,  1,  0,  0,  0, 72,137,200,195, 65, 87,
+/* 0x3500 */  73,141, 64, 32, 73,137,255, 65, 86, 77,137,198, 65, 85, 73,137,
+/* 0x3510 */ 213, 65, 84, 73,137,244, 85, 83, 72,131,236, 24, 72,137, 12, 36,
+/* 0x3520 */  72,137, 68, 36,  8, 72,139, 84, 36,  8, 76,137,246, 76,137,247,
+/* 0x3530 */ 232, 28,  5,  0,  0, 61,255,  0,  0,  0,127, 28,133,192, 15,136,
+/* 0x3540 */  40,  1,  0,  0, 77, 57,231, 15,132, 31,  1,  0,  0, 65,136,  7,
+/* 0x3550 */  73,255,199,233,210,  0,  0,  0, 61,  0,  1,  0,  0, 15,132, 20,
+/* 0x3560 */   1,  0,  0,141,168,255,254,255,255,131,253, 28, 15,143,250,  0,
+/* 0x3570 */   0,  0,131,253,  7,127, 10,141,168,  2,255,255,255, 49,246,235,
+/* 0x3580 */  34,131,253, 28,116, 22,137,238,131,229,  3,193,254,  2,131,197,
+/* 0x3590 */   4,255,206,137,241,211,229,131,197,  3,235,  7, 49,246,189,  2,
+/* 0x35a0 */   1,  0,  0, 76,137,247,232, 39,  5,  0,  0, 73,141,150,128,  2,
+/* 0x35b0 */   0,  0, 73,141,182, 96,  2,  0,  0, 76,137,247,  1,197,232,142,
+/* 0x35c0 */   4,  0,  0,131,248, 29, 15,135,160,  0,  0,  0,131,248,  3,127,
+/* 0x35d0 */   7,141, 88,  1, 49,246,235, 20,137,198,131,224,  1,209,254,137,
+/* 0x35e0 */ 195,255,206,131,195,  2,137,241,211,227,255,195, 76,137,247,232,
+/* 0x35f0 */ 222,  4,  0,  0,  1,195, 76,137,248, 76, 41,232, 57,216,114,108,
+/* 0x3600 */  76,137,224, 76, 41,248, 57,232,114, 98, 76,137,248, 72,247,219,
+/* 0x3610 */  66,141, 84, 61,  0,138, 12, 24, 72,255,192,136, 72,255, 57,194,
+/* 0x3620 */ 117,243,141, 69,255, 77,141,124,  7,  1, 65,131,190, 80,  5,  0,
+/* 0x3630 */   0,  0,117, 56, 73,139,150, 56,  5,  0,  0, 72,139, 60, 36, 76,
+/* 0x3640 */ 137,248, 76, 41,232, 73, 99,142, 84,  5,  0,  0, 72, 41,250, 72,
+/* 0x3650 */ 137,198, 72, 41,214, 72, 57,206, 15,142,199,254,255,255, 41,208,
+/* 0x3660 */  65,137,134, 84,  5,  0,  0,233,185,254,255,255, 65,199,134, 80,
+/* 0x3670 */   5,  0,  0,  1,  0,  0,  0, 72,131,196, 24, 76,137,248, 91, 93,
+/* 0x3680 */  65, 92, 65, 93, 65, 94, 65, 95,195, 83, 49,192, 72,137,251,102,
+/* 0x3690 */ 199,132,  3,188,  2,  0,  0,  8,  0, 72,131,192,  2, 72, 61, 32,
+/* 0x36a0 */   1,  0,  0,117,234, 49,192,102,199,132,  3,220,  3,  0,  0,  9,
+/* 0x36b0 */   0, 72,131,192,  2, 72, 61,224,  0,  0,  0,117,234, 49,192,102,
+/* 0x36c0 */ 199,132,  3,188,  4,  0,  0,  7,  0, 72,131,192,  2, 72,131,248,
+/* 0x36d0 */  48,117,236,102,199,131,236,  4,  0,  0,  8,  0, 49,192,102,199,
+/* 0x36e0 */ 131,238,  4,  0,  0,  8,  0,102,199,131,240,  4,  0,  0,  8,  0,
+/* 0x36f0 */ 102,199,131,242,  4,  0,  0,  8,  0,102,199,131,244,  4,  0,  0,
+/* 0x3700 */   8,  0,102,199,131,246,  4,  0,  0,  8,  0,102,199,131,248,  4,
+/* 0x3710 */   0,  0,  8,  0,102,199,131,250,  4,  0,  0,  8,  0,102,199,132,
+/* 0x3720 */   3,252,  4,  0,  0,  5,  0, 72,131,192,  2, 72,131,248, 60,117,
+/* 0x3730 */ 236, 72,141,147,188,  2,  0,  0, 72,141,115, 32, 72,137,223,185,
+/* 0x3740 */  32,  1,  0,  0,232, 98,  2,  0,  0, 72,141,147,252,  4,  0,  0,
+/* 0x3750 */ 185, 30,  0,  0,  0, 72,141,179,128,  2,  0,  0, 72,141,187, 96,
+/* 0x3760 */   2,  0,  0, 91,233, 66,  2,  0,  0, 65, 87,190,  5,  0,  0,  0,
+/* 0x3770 */  65, 86, 65, 85, 65, 84, 85, 83, 72,137,251, 72,131,236, 24,232,
+/* 0x3780 */  78,  3,  0,  0,190,  5,  0,  0,  0, 72,137,223,141,168,  1,  1,
+/* 0x3790 */   0,  0,232, 59,  3,  0,  0,190,  4,  0,  0,  0, 72,137,223, 68,
+/* 0x37a0 */ 141, 96,  1,232, 42,  3,  0,  0,131,192,  4,137,  4, 36,129,253,
+/* 0x37b0 */  30,  1,  0,  0,119,  8, 49,192, 65,131,252, 30,118,  8,131,200,
+/* 0x37c0 */ 255,233,214,  1,  0,  0,102,199,132,  3,188,  2,  0,  0,  0,  0,
+/* 0x37d0 */  72,131,192,  2, 72,131,248, 38,117,236, 73,191,108, 52,225,194,
+/* 0x37e0 */   3,  0,  0,  0, 69, 49,246,139,  4, 36, 65, 57,198,115, 60, 73,
+/* 0x37f0 */ 189, 48, 74,128, 78, 50,170, 44,  2, 67,141, 12,182, 65,131,254,
+/* 0x3800 */  11,118,  6,131,233, 60, 77,137,253, 73,211,237,190,  3,  0,  0,
+/* 0x3810 */   0, 72,137,223, 65,255,198,232,182,  2,  0,  0, 65,131,229, 31,
+/* 0x3820 */ 102, 66,137,132,107,188,  2,  0,  0,235,188, 72,141,131,188,  2,
+/* 0x3830 */   0,  0,185, 19,  0,  0,  0, 72,137,223, 72,137,  4, 36, 72,141,
+/* 0x3840 */  67, 32, 72,139, 20, 36, 72,137,198, 72,137, 68, 36,  8,232, 88,
+/* 0x3850 */   1,  0,  0,133,192, 15,133, 99,255,255,255, 69, 49,246, 70,141,
+/* 0x3860 */ 124, 37,  0, 69, 57,254, 15,131,184,  0,  0,  0, 72,139, 84, 36,
+/* 0x3870 */   8, 72,137,222, 72,137,223,232,213,  1,  0,  0,133,192, 15,136,
+/* 0x3880 */  58,255,255,255,131,248, 15,127, 16, 68,137,242, 65,255,198,102,
+/* 0x3890 */ 137,132, 83,188,  2,  0,  0,235,121,131,248, 16,117, 40, 69,133,
+/* 0x38a0 */ 246, 15,132, 23,255,255,255, 65,141, 70,255,190,  2,  0,  0,  0,
+/* 0x38b0 */  72,137,223,102, 68,139,172, 67,188,  2,  0,  0,232, 17,  2,  0,
+/* 0x38c0 */   0,131,192,  3,235, 42,131,248, 17,117, 18,190,  3,  0,  0,  0,
+/* 0x38d0 */  72,137,223,232,250,  1,  0,  0,131,192,  3,235, 16,190,  7,  0,
+/* 0x38e0 */   0,  0, 72,137,223,232,232,  1,  0,  0,131,192, 11, 69, 49,237,
+/* 0x38f0 */  68,  1,240, 65, 57,199, 15,130,194,254,255,255, 68, 57,240,116,
+/* 0x3900 */  17, 68,137,246, 65,255,198,102, 68,137,172,115,188,  2,  0,  0,
+/* 0x3910 */ 235,234,131,187, 80,  5,  0,  0,  0, 15,132, 68,255,255,255,233,
+/* 0x3920 */ 154,254,255,255,102,131,187,188,  4,  0,  0,  0, 15,132,140,254,
+/* 0x3930 */ 255,255, 72,139, 20, 36, 72,139,116, 36,  8,137,233, 72,137,223,
+/* 0x3940 */ 232,102,  0,  0,  0,133,192, 15,136,113,254,255,255,116, 15, 15,
+/* 0x3950 */ 191, 19,137,232, 41,208,255,200, 15,133, 96,254,255,255, 72,139,
+/* 0x3960 */  20, 36, 72,  1,237, 68,137,225, 72,141,179,128,  2,  0,  0, 72,
+/* 0x3970 */ 141,187, 96,  2,  0,  0, 72,  1,234,232, 45,  0,  0,  0,133,192,
+/* 0x3980 */  15,136, 56,254,255,255,116, 20, 15,191,131, 96,  2,  0,  0, 65,
+/* 0x3990 */  41,196, 49,192, 65,255,204, 15,149,192,247,216, 72,131,196, 24,
+/* 0x39a0 */  91, 93, 65, 92, 65, 93, 65, 94, 65, 95,195, 73,137,241, 73,137,
+/* 0x39b0 */ 208, 49,192,102,199,  4, 71,  0,  0, 72,255,192, 72,131,248, 16,
+/* 0x39c0 */ 117,241, 49,192, 57,200,115, 14, 73, 15,191, 20, 64, 72,255,192,
+/* 0x39d0 */ 102,255,  4, 87,235,238, 49,192,102, 57, 15,116,115, 15,191, 87,
+/* 0x39e0 */   2,184,  2,  0,  0,  0, 41,208,120,102,186,  2,  0,  0,  0, 15,
+/* 0x39f0 */ 191, 52, 87,  1,192, 72,255,194, 41,240,120, 84, 72,131,250, 16,
+/* 0x3a00 */ 117,237,102,199, 68, 36,226,  0,  0,186,  2,  0,  0,  0,102,139,
+/* 0x3a10 */  52, 23,102,  3,116, 20,224,102,137,116, 20,226, 72,131,194,  2,
+/* 0x3a20 */  72,131,250, 30,117,232, 49,210, 57,202,115, 36, 73, 15,191, 52,
+/* 0x3a30 */  80,102,133,246,116, 21, 72, 15,191,124,116,224, 68,141, 87,  1,
+/* 0x3a40 */ 102, 65,137, 20,121,102, 68,137, 84,116,224, 72,255,194,235,216,
+/* 0x3a50 */ 195, 65, 87, 65, 86, 65,190,  1,  0,  0,  0, 65, 85, 73,137,245,
+/* 0x3a60 */  65, 84, 69, 49,228, 85, 49,237, 83, 49,219, 72,131,236, 24, 72,
+/* 0x3a70 */ 137, 60, 36, 72,139, 60, 36,190,  1,  0,  0,  0, 72,137, 84, 36,
+/* 0x3a80 */   8, 71, 15,191,124,117,  0,232, 70,  0,  0,  0, 72,139, 84, 36,
+/* 0x3a90 */   8,  9,232,137,198, 68, 41,254, 68, 57,230,125, 14, 68, 41,227,
+/* 0x3aa0 */   1,195, 72, 99,219, 15,191,  4, 90,235, 24, 69,  1,252, 73,255,
+/* 0x3ab0 */ 198,141, 44,  0, 68,  1,251, 69,  1,228, 73,131,254, 16,117,179,
+/* 0x3ac0 */ 131,200,255, 72,131,196, 24, 91, 93, 65, 92, 65, 93, 65, 94, 65,
+/* 0x3ad0 */  95,195,139,151, 72,  5,  0,  0,139,135, 76,  5,  0,  0, 57,240,
+/* 0x3ae0 */ 115, 63, 72,139,143, 56,  5,  0,  0, 72, 59,143, 64,  5,  0,  0,
+/* 0x3af0 */ 117, 13,199,135, 80,  5,  0,  0,  1,  0,  0,  0, 49,192,195, 76,
+/* 0x3b00 */ 141, 65,  1, 76,137,135, 56,  5,  0,  0, 68, 15,182,  1,137,193,
+/* 0x3b10 */ 131,192,  8,137,135, 76,  5,  0,  0, 65,211,224, 68,  9,194,235,
+/* 0x3b20 */ 183, 41,240,137,241, 65,137,209,137,135, 76,  5,  0,  0,131,200,
+/* 0x3b30 */ 255, 65,211,233,211,224, 68,137,143, 72,  5,  0,  0,247,208, 33,
+/* 0x3b40 */ 208,195, 87, 94, 89, 72,137,240, 72, 41,200, 90, 72, 41,215, 89,
+/* 0x3b50 */ 137, 57, 91, 93,195,104, 30,  0,  0,  0, 90,232,  0,  0,  0,  0,
+/* 0x3b60 */  80, 82, 79, 84, 95, 69, 88, 69, 67,124, 80, 82, 79, 84, 95, 87,
+/* 0x3b70 */  82, 73, 84, 69, 32,102, 97,105,108,101,100, 46, 10,  0,106, 14,
+/* 0x3b80 */  90, 87, 94,235,  1, 94,106,  2, 95,106,  1, 88, 15,  5,106,127,
+/* 0x3b90 */  95,106, 60, 88, 15,  5, 95, 41,246,106,  2, 88, 15,  5,133,192,
+/* 0x3ba0 */ 120,220, 80, 72,141,183, 15,  0,  0,  0,173,131,224,248, 65,137,
+/* 0x3bb0 */ 198, 86, 91,139, 22, 72,141, 77,245, 68,139, 57, 76, 41,249, 69,
+/* 0x3bc0 */  41,247, 73,  1,206, 95, 82, 80, 87, 81, 77, 41,201, 65,131,200,
+/* 0x3bd0 */ 255,106, 34, 65, 90, 82, 94,106,  3, 90, 41,255,106,  9, 88, 15,
+/* 0x3be0 */   5, 72,137, 68, 36, 16, 80, 90, 83, 94,173, 80, 72,137,225, 73,
+/* 0x3bf0 */ 137,213,173, 80,173, 65,144, 72,137,247, 94,255,213, 89, 72,139,
+/* 0x3c00 */ 116, 36, 24, 72,139,124, 36, 16,106,  5, 90,106, 10, 88, 15,  5,
+/* 0x3c10 */  65,255,229, 93,232,125,255,255,255, 47,112,114,111, 99, 47,115,
+/* 0x3c20 */ 101,108,102, 47,101,120,101,  0,  0,  0,  0,  0, 19,  0,  0,  0,
+/* 0x3c30 */  21,  0,  0,  0, 14,  0,  0,  0,233,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3c40 */  15,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x3c50 */ 102,  0,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x3c60 */ 186,  0,  0,  0,181,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,
+/* 0x3c70 */ 161,  0,  0,  0,111,  1,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,
+/* 0x3c80 */ 147,  0,  0,  0, 16,  2,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,
+/* 0x3c90 */ 100,  0,  0,  0,163,  2,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,
+/* 0x3ca0 */ 247,  9,  0,  0,  7,  3,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,
+/* 0x3cb0 */ 247,  9,  0,  0,254, 12,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0,
+/* 0x3cc0 */  24,  0,  0,  0,245, 22,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,
+/* 0x3cd0 */ 104,  0,  0,  0, 13, 23,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,
+/* 0x3ce0 */  75,  0,  0,  0,117, 23,  0,  0,  0,  0,  0,  0,101,  0,  0,  0,
+/* 0x3cf0 */  97, 27,  0,  0,192, 23,  0,  0,  0,  0,  0,  0,112,  0,  0,  0,
+/* 0x3d00 */   2,  0,  0,  0, 33, 51,  0,  0,  0,  0,  0,  0,123,  0,  0,  0,
+/* 0x3d10 */  75,  0,  0,  0, 35, 51,  0,  0,  0,  0,  0,  0,137,  0,  0,  0,
+/* 0x3d20 */ 212,  7,  0,  0,110, 51,  0,  0,  0,  0,  0,  0,151,  0,  0,  0,
+/* 0x3d30 */   2,  0,  0,  0, 66, 59,  0,  0,  0,  0,  0,  0,165,  0,  0,  0,
+/* 0x3d40 */   0,  0,  0,  0, 68, 59,  0,  0,  0,  0,  0,  0,174,  0,  0,  0,
+/* 0x3d50 */  58,  0,  0,  0, 68, 59,  0,  0,  0,  0,  0,  0,183,  0,  0,  0,
+/* 0x3d60 */ 174,  0,  0,  0,126, 59,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3d70 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x3d80 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,
+/* 0x3d90 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,
+/* 0x3da0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,
+/* 0x3db0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,
+/* 0x3dc0 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,
+/* 0x3dd0 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,
+/* 0x3de0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,
+/* 0x3df0 */  10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,101,  0,  0,  0,
+/* 0x3e00 */  11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,123,  0,  0,  0,
+/* 0x3e10 */  13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,137,  0,  0,  0,
+/* 0x3e20 */  14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,165,  0,  0,  0,
+/* 0x3e30 */  16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x3e40 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0,
+/* 0x3e50 */   8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,112,  0,  0,  0,
+/* 0x3e60 */  12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,151,  0,  0,  0,
+/* 0x3e70 */  15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,174,  0,  0,  0,
+/* 0x3e80 */  17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,183,  0,  0,  0,
+/* 0x3e90 */  18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,  0,  0,  0,
+/* 0x3ea0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,199,  0,  0,  0,
+/* 0x3eb0 */  20,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ec0 */   3,  0,  0,  0,207,  0,  0,  0, 18,  0,  0,  0,145,  0,  0,  0,
+/* 0x3ed0 */   0,  0,  0,  0,  2,  0,  0,  0,175,  0,  0,  0,207,  0,  0,  0,
+/* 0x3ee0 */  13,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x3ef0 */  92,  0,  0,  0,207,  0,  0,  0, 17,  0,  0,  0,252,255,255,255,
+/* 0x3f00 */ 255,255,255,255,  3,  0,  0,  0,150,  0,  0,  0,207,  0,  0,  0,
+/* 0x3f10 */  13,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x3f20 */  92,  0,  0,  0,207,  0,  0,  0, 17,  0,  0,  0,252,255,255,255,
+/* 0x3f30 */ 255,255,255,255,  4,  0,  0,  0,139,  0,  0,  0,207,  0,  0,  0,
+/* 0x3f40 */  13,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x3f50 */  83,  0,  0,  0,207,  0,  0,  0, 17,  0,  0,  0,252,255,255,255,
+/* 0x3f60 */ 255,255,255,255,  5,  0,  0,  0,  6,  0,  0,  0,207,  0,  0,  0,
+/* 0x3f70 */  14,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,
+/* 0x3f80 */   6,  0,  0,  0,207,  0,  0,  0, 15,  0,  0,  0,252,255,255,255,
+/* 0x3f90 */ 255,255,255,255, 10,  0,  0,  0, 71,  0,  0,  0,207,  0,  0,  0,
+/* 0x3fa0 */  15,  0,  0,  0,254,255,255,255,255,255,255,255, 13,  0,  0,  0,
+/* 0x3fb0 */   6,  0,  0,  0,207,  0,  0,  0, 16,  0,  0,  0,252,255,255,255,
+/* 0x3fc0 */ 255,255,255,255, 13,  0,  0,  0, 71,  0,  0,  0,207,  0,  0,  0,
+/* 0x3fd0 */  16,  0,  0,  0,254,255,255,255,255,255,255,255, 17,  0,  0,  0,
+/* 0x3fe0 */  24,  0,  0,  0,207,  0,  0,  0, 18,  0,  0,  0,  3,  0,  0,  0,
+/* 0x3ff0 */   0,  0,  0,  0, 18,  0,  0,  0,170,  0,  0,  0,221,  0,  0,  0,
+/* 0x4000 */  20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77,
+/* 0x4010 */  65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82,
+/* 0x4020 */  86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0,
+/* 0x4030 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95,
+/* 0x4040 */  68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
+/* 0x4050 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 76, 90, 52, 95,
+/* 0x4060 */  69, 76, 70, 48, 48,  0, 90, 83, 84, 68, 95, 69, 76, 70, 48, 48,
+/* 0x4070 */   0, 90, 83, 84, 68, 95, 68, 69, 67, 50, 48,  0, 90, 83, 84, 68,
+/* 0x4080 */  95, 68, 69, 67, 51, 48,  0, 68, 69, 70, 76, 65, 84, 69, 95, 69,
+/* 0x4090 */  76, 70, 48, 48,  0, 68, 69, 70, 76, 65, 84, 69, 95, 68, 69, 67,
+/* 0x40a0 */  50, 48,  0, 68, 69, 70, 76, 65, 84, 69, 95, 68, 69, 67, 51, 48,
+/* 0x40b0 */   0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 69, 76, 70, 77, 65, 73,
+/* 0x40c0 */  78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,116, 97,
+/* 0x40d0 */ 114,116,  0, 79, 95, 66, 73, 78, 70, 79,  0, 82, 95, 88, 56, 54,
+/* 0x40e0 */  95, 54, 52, 95, 80, 67, 51, 50,  0, 82, 95, 88, 56, 54, 95, 54,
+/* 0x40f0 */  52, 95, 51, 50,  0, 44, 60,  0,  0, 85, 80, 88, 35, 79, 66, 74,
+/* 0x4100 */  49
 };
@@ -1,5 +1,5 @@
 /* amd64-linux.elf-fold.h
-   created from amd64-linux.elf-fold.bin, 2360 (0x938) bytes
+   created from amd64-linux.elf-fold.bin, 6420 (0x1914) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,20 +31,20 @@
  */
 
 
-#define STUB_AMD64_LINUX_ELF_FOLD_SIZE    2360
-#define STUB_AMD64_LINUX_ELF_FOLD_ADLER32 0x2f1172c0
-#define STUB_AMD64_LINUX_ELF_FOLD_CRC32   0xa8c542f0
+#define STUB_AMD64_LINUX_ELF_FOLD_SIZE    6420
+#define STUB_AMD64_LINUX_ELF_FOLD_ADLER32 0x443bf858
+#define STUB_AMD64_LINUX_ELF_FOLD_CRC32   0xa0b16943
 
-unsigned char stub_amd64_linux_elf_fold[2360] = {
+unsigned char stub_amd64_linux_elf_fold[6420] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   2,  0, 62,  0,  1,  0,  0,  0,188,  0, 16,  0,  0,  0,  0,  0,
 /* 0x0020 */  64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x0030 */   0,  0,  0,  0, 64,  0, 56,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0030 */   0,  0,  0,  0, 64,  0, 56,  0,  2,  0, 64,  0,  0,  0,  0,  0,
 /* 0x0040 */   1,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0050 */   0,  0, 16,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0,  0,  0,
-/* 0x0060 */  56,  9,  0,  0,  0,  0,  0,  0, 56,  9,  0,  0,  0,  0,  0,  0,
+/* 0x0060 */  20, 25,  0,  0,  0,  0,  0,  0, 20, 25,  0,  0,  0,  0,  0,  0,
 /* 0x0070 */   0,  0, 16,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
-/* 0x0080 */  56,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0080 */  20, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0090 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x00a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0,  0,  0,
 /* 0x00b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,232, 74,  0,  0,
@@ -63,125 +63,379 @@ unsigned char stub_amd64_linux_elf_fold[2360] = {
 /* 0x0180 */  61, 73,137, 62, 72,131,231,248, 76,137,249, 72, 41,225,137,200,
 /* 0x0190 */  49,248,131,240,  8,131,224,  8, 72, 41,199, 73,137,254, 72,131,
 /* 0x01a0 */ 239,  8, 73,141,119,248, 72,193,233,  3,243, 72,165, 72,141,103,
-/* 0x01b0 */   8,252, 75,141, 12, 38,139, 67,252,131,224,  1, 72,  1,193, 65,
+/* 0x01b0 */   8,252, 75,141, 12, 38,139, 67,252,131,224,  7, 72,  1,193, 65,
 /* 0x01c0 */  89, 94, 95, 88, 72,129,236,  0,  8,  0,  0, 72,137,226, 80, 73,
-/* 0x01d0 */ 137,197, 73,137,232,232, 22,  6,  0,  0, 72,129,196,  8,  8,  0,
-/* 0x01e0 */   0, 72,137, 68, 36, 32, 91, 73,139,181,136,  0,  0,  0, 76,137,
-/* 0x01f0 */ 239, 73, 43,117, 80,232, 79,  0,  0,  0, 77, 41,201, 65,137,216,
-/* 0x0200 */ 106,  2, 89,106,  1, 90,190,  0, 16,  0,  0, 41,255,232, 16,  0,
-/* 0x0210 */   0,  0,137,223,232, 40,  0,  0,  0, 95, 94,106, 11, 88, 65,255,
-/* 0x0220 */ 102,248,176,  9, 73,137,202, 15,182,192, 15,  5, 72, 61,  0,240,
-/* 0x0230 */ 255,255,114,  4, 72,131,200,255,195,176, 60,235,  2,176, 12,235,
-/* 0x0240 */   2,176,  3,235,  2,176,  2,235,  2,176, 11,235,  2,176, 10,235,
-/* 0x0250 */   2,176,  1,235,  2,176,  0,235,206,  0,  0,  0, 81, 72, 57, 23,
-/* 0x0260 */  76,139, 71,  8, 72,141, 74,255,115, 10,191,127,  0,  0,  0,232,
-/* 0x0270 */ 197,255,255,255, 72,131,249,255,116, 17, 65, 15,182,  0, 72,255,
-/* 0x0280 */ 201, 73,255,192,136,  6, 72,255,198,235,233, 72,  1, 87,  8, 72,
-/* 0x0290 */  41, 23, 88,195, 65, 85, 73,137,213, 65, 84, 73,137,204, 85, 72,
-/* 0x02a0 */ 137,253, 83, 72,137,243, 72,131,236, 40, 72,131, 62,  0, 15,132,
-/* 0x02b0 */ 230,  0,  0,  0, 72,141,116, 36, 16,186, 12,  0,  0,  0, 72,137,
-/* 0x02c0 */ 239,232,150,255,255,255,139, 68, 36, 16,139,116, 36, 20,133,192,
-/* 0x02d0 */ 117, 21,129,254, 85, 80, 88, 33,117, 17, 72,131,125,  0,  0, 15,
-/* 0x02e0 */ 132,181,  0,  0,  0,235,  4,133,246,117, 10,191,127,  0,  0,  0,
-/* 0x02f0 */ 232, 68,255,255,255, 57,198,119,242,137,194, 72, 59, 19,119,235,
-/* 0x0300 */  57,198, 72,139, 67,  8,115,108, 72,137, 84, 36,  8, 72,139,125,
-/* 0x0310 */   8, 72,141, 76, 36,  8, 68,139, 68, 36, 24, 72,137,194, 65,255,
-/* 0x0320 */ 213,133,192,117,198,139, 68, 36, 16, 72,139,116, 36,  8, 72, 57,
-/* 0x0330 */ 198,117,184, 15,182, 76, 36, 25,132,201, 15,149,194, 49,192, 77,
-/* 0x0340 */ 133,228, 15,149,192,133,194,116, 29, 72,129,254,  0,  2,  0,  0,
-/* 0x0350 */ 119,  5, 72, 57, 51,117, 15, 15,182, 84, 36, 26, 15,182,201, 72,
-/* 0x0360 */ 139,123,  8, 65,255,212,139, 68, 36, 20, 72,  1, 69,  8, 72, 41,
-/* 0x0370 */  69,  0,235, 13,137,242, 72,137,239, 72,137,198,232,219,254,255,
-/* 0x0380 */ 255,139, 84, 36, 16, 72,139,  3, 72,  1, 83,  8, 72, 41,208, 72,
-/* 0x0390 */ 133,192, 72,137,  3,233, 20,255,255,255, 72,131,196, 40, 91, 93,
-/* 0x03a0 */  65, 92, 65, 93,195, 72,133,255, 73,137,209,116, 54, 64,246,199,
-/* 0x03b0 */   1,117, 48, 72,139, 15, 65,137,240, 76, 57,193,116, 18, 72,131,
-/* 0x03c0 */ 249,  1, 15,148,194, 49,192,133,246, 15,149,192,133,194,116,  8,
-/* 0x03d0 */  76,137,  7, 76,137, 79,  8,195, 72,133,201,116,  6, 72,131,199,
-/* 0x03e0 */  16,235,208,195, 65, 87, 73,137,255, 65, 86, 65, 85, 73,137,253,
-/* 0x03f0 */  65, 84, 85, 83, 72,131,236,104, 76,  3,111, 32, 72,133,246, 72,
-/* 0x0400 */ 139,132, 36,160,  0,  0,  0,137, 84, 36, 60, 72,137,116, 36, 64,
-/* 0x0410 */  72,137, 76, 36, 48, 76,137, 68, 36, 40, 76,137, 76, 36, 32, 72,
-/* 0x0420 */ 139, 56, 65, 15,183, 87, 16,116, 76, 72,139, 71, 32, 72,  1,248,
-/* 0x0430 */  72, 43,120, 72,102,131,250,  2,117,  4, 72,139,120, 16, 72,139,
-/* 0x0440 */ 112, 40, 69, 49,201, 65,131,200,255, 49,210,185, 50,  0,  0,  0,
-/* 0x0450 */  72,141,  4, 62, 72,137, 68, 36, 72,232,196,253,255,255,102, 65,
-/* 0x0460 */ 131,127, 16,  2, 73,137,198, 15,133,172,  0,  0,  0, 69, 49,246,
-/* 0x0470 */ 233,164,  0,  0,  0,102,131,250,  3, 65, 15,183, 87, 56,185, 16,
-/* 0x0480 */   0,  0,  0,184,  0,  0,  0,  0, 73,137,248, 76,137,238, 15, 68,
-/* 0x0490 */ 200, 72,131,205,255, 49,219, 49,255,131,193, 34,255,202,120, 33,
-/* 0x04a0 */ 131, 62,  1,117, 22, 72,139, 70, 16, 72, 57,232, 72, 15, 66,232,
-/* 0x04b0 */  72,  3, 70, 40, 72, 57,195, 72, 15, 66,216, 72,131,198, 56,235,
-/* 0x04c0 */ 219, 72,129,229,  0,240,255,255, 72, 41,235, 72,129,195,255, 15,
-/* 0x04d0 */   0,  0, 72,129,227,  0,240,255,255,246,193, 16,116,  5, 72,137,
-/* 0x04e0 */ 239,235, 19, 72,133,237,117, 14,137,200, 76,137,199,131,200, 16,
-/* 0x04f0 */  77,133,192, 15, 69,200, 69, 49,201, 65,131,200,255, 49,210, 72,
-/* 0x0500 */ 137,222,232, 27,253,255,255, 72,137,199, 72,141,  4,  3, 73,137,
-/* 0x0510 */ 254, 72,137, 68, 36, 72, 73, 41,238,102, 65,131,127, 56,  0,199,
-/* 0x0520 */  68, 36, 28,  0,  0,  0,  0, 15,132,162,  2,  0,  0, 72,131,124,
-/* 0x0530 */  36, 64,  0,116, 34, 65,131,125,  0,  6,117, 27, 73,139, 85, 16,
-/* 0x0540 */  72,139,124, 36, 48,190,  3,  0,  0,  0, 76,  1,242,232, 83,254,
-/* 0x0550 */ 255,255,233, 97,  2,  0,  0, 65,131,125,  0,  1, 15,133, 86,  2,
-/* 0x0560 */   0,  0, 72,131,124, 36, 64,  0,116, 73, 73,131,125,  8,  0,117,
-/* 0x0570 */  66, 73,139, 85, 16, 72,139,124, 36, 48,190,  3,  0,  0,  0, 76,
-/* 0x0580 */   1,242, 73,  3, 87, 32,232, 26,254,255,255, 73, 15,183, 87, 56,
-/* 0x0590 */  72,139,124, 36, 48,190,  5,  0,  0,  0,232,  6,254,255,255, 73,
-/* 0x05a0 */  15,183, 87, 54, 72,139,124, 36, 48,190,  4,  0,  0,  0,232,242,
-/* 0x05b0 */ 253,255,255, 73,139, 69, 16, 65,139, 77,  4, 65,131,200,255, 73,
-/* 0x05c0 */ 139, 85, 32,199, 68, 36, 24, 64, 98, 81,115, 76,  1,240,131,225,
-/* 0x05d0 */   7, 73,137,196, 72,137, 68, 36, 88, 73,139, 69, 40, 76,137,229,
-/* 0x05e0 */ 193,225,  2,211,108, 36, 24,129,229,255, 15,  0,  0,131,100, 36,
-/* 0x05f0 */  24,  7, 72,137, 84, 36, 80, 76,  1,224, 72,  1,234, 73, 41,236,
-/* 0x0600 */  72,137, 68, 36,  8,185, 50,  0,  0,  0, 73,139, 69,  8, 72,137,
-/* 0x0610 */  84, 36, 16, 72, 41,232, 72,131,124, 36, 64,  0,117,  7, 68,139,
-/* 0x0620 */  68, 36, 60,177, 18,139, 84, 36, 24, 72,139,116, 36, 16, 73,137,
-/* 0x0630 */ 193, 76,137,231,131,202,  2, 72,131,124, 36, 64,  0, 15, 68, 84,
-/* 0x0640 */  36, 24,232,219,251,255,255, 73, 57,196, 15,133, 37,  1,  0,  0,
-/* 0x0650 */  72,131,124, 36, 64,  0,116, 25, 72,139, 76, 36, 32, 72,139, 84,
-/* 0x0660 */  36, 40, 72,141,116, 36, 80, 72,139,124, 36, 64,232, 35,252,255,
-/* 0x0670 */ 255, 72,139,108, 36, 16, 72,247,221,129,229,255, 15,  0,  0,246,
-/* 0x0680 */  68, 36, 24,  2,116, 17, 72,139, 68, 36, 16, 72,137,233,252, 73,
-/* 0x0690 */ 141, 60,  4, 49,192,243,170, 72,131,124, 36, 64,  0, 15,132,220,
-/* 0x06a0 */   0,  0,  0,199, 68, 36,  4,  0,  0,  0,  0, 72,184,255,255,255,
-/* 0x06b0 */ 255,  1,  0,  0,  0, 73, 35, 69,  0, 72,186,  1,  0,  0,  0,  1,
-/* 0x06c0 */   0,  0,  0, 72, 57,208, 15,133,148,  0,  0,  0, 73,139, 85, 40,
-/* 0x06d0 */  73,139, 77, 16, 73, 59, 85, 32, 72,141,  4, 10, 74,141, 28, 48,
-/* 0x06e0 */ 117, 14,137,216,247,216, 37,255, 15,  0,  0,131,248,  3,119, 57,
-/* 0x06f0 */  73,131,125,  8,  0, 74,141, 92, 49, 12,116, 45, 69, 49,201, 65,
-/* 0x0700 */ 131,200,255, 49,255,185, 34,  0,  0,  0,186,  3,  0,  0,  0,190,
-/* 0x0710 */   0, 16,  0,  0,199, 68, 36,  4,  1,  0,  0,  0,232,  1,251,255,
-/* 0x0720 */ 255, 72,133,192, 72,137,195,116, 55,131,124, 36,  4,  0,199,  3,
-/* 0x0730 */  15,  5, 90,195,116, 18,186,  5,  0,  0,  0,190,  4,  0,  0,  0,
-/* 0x0740 */  72,137,223,232,  5,251,255,255, 72,133,219,116, 19, 72,139,124,
-/* 0x0750 */  36, 48, 72,137,218, 49,246, 72,131,231,254,232, 69,252,255,255,
-/* 0x0760 */ 139, 84, 36, 24, 72,139,116, 36, 16, 76,137,231,232,220,250,255,
-/* 0x0770 */ 255,133,192,116, 10,191,127,  0,  0,  0,232,186,250,255,255, 72,
-/* 0x0780 */ 139, 68, 36, 16, 72,  1,232, 73,  1,196, 76, 59,100, 36,  8,115,
-/* 0x0790 */  39, 76, 41,100, 36,  8,139, 84, 36, 24, 69, 49,201, 72,139,116,
-/* 0x07a0 */  36,  8, 65,131,200,255,185, 50,  0,  0,  0, 76,137,231,232,111,
-/* 0x07b0 */ 250,255,255, 73, 57,196,117,189,255, 68, 36, 28, 65, 15,183, 71,
-/* 0x07c0 */  56, 73,131,197, 56, 57, 68, 36, 28, 15,140, 94,253,255,255, 72,
-/* 0x07d0 */ 139,132, 36,160,  0,  0,  0, 76,137, 48, 77,  3,119, 24, 72,131,
-/* 0x07e0 */ 196,104, 91, 93, 65, 92, 65, 93, 76,137,240, 65, 94, 65, 95,195,
-/* 0x07f0 */  65, 87, 65, 86, 73,137,206, 49,201, 65, 85, 65, 84, 77,137,204,
-/* 0x0800 */  85, 72,137,213, 76,141,109, 64, 83, 76,137,195, 72,131,236, 72,
-/* 0x0810 */ 139,  7, 72,137,124, 36, 24, 72,137,124, 36, 40, 76,141,188, 36,
-/* 0x0820 */ 128,  0,  0,  0, 72,137,116, 36, 32, 72,141,116, 36, 48, 72,137,
-/* 0x0830 */  84, 36, 56, 76,137,194, 72,137, 68, 36, 48,139, 71,  4, 72,141,
-/* 0x0840 */ 124, 36, 16, 72,131,192, 12, 72,137, 68, 36, 16,232, 67,250,255,
-/* 0x0850 */ 255, 65, 83, 77,137,225, 49,210, 73,137,216, 76,137,241, 72,137,
-/* 0x0860 */ 239, 72,141,116, 36, 40, 65, 87,232,119,251,255,255,190,  9,  0,
-/* 0x0870 */   0,  0, 72,137,194, 76,137,247, 73,137,196,232, 37,251,255,255,
-/* 0x0880 */  65, 89, 65, 90,102,131,125, 56,  0,199, 68, 36, 12,  0,  0,  0,
-/* 0x0890 */   0, 15,132,143,  0,  0,  0, 65,131,125,  0,  3,117,114, 73,139,
-/* 0x08a0 */  63, 73,  3,125, 16, 49,210, 49,246,232,151,249,255,255,133,192,
-/* 0x08b0 */ 137,195,120, 23,186,  0,  4,  0,  0, 72,137,238,137,199,232,146,
-/* 0x08c0 */ 249,255,255, 72, 61,  0,  4,  0,  0,116, 10,191,127,  0,  0,  0,
-/* 0x08d0 */ 232,100,249,255,255, 73,199,  7,  0,  0,  0,  0, 65, 80, 69, 49,
-/* 0x08e0 */ 201, 69, 49,192, 49,201, 65, 87,137,218, 49,246, 72,137,239,232,
-/* 0x08f0 */ 240,250,255,255, 73,139, 23,190,  7,  0,  0,  0, 76,137,247, 73,
-/* 0x0900 */ 137,196,232,158,250,255,255,137,223,232, 51,249,255,255, 94, 95,
-/* 0x0910 */ 255, 68, 36, 12, 15,183, 69, 56, 73,131,197, 56, 57, 68, 36, 12,
-/* 0x0920 */  15,130,113,255,255,255, 72,131,196, 72, 76,137,224, 91, 93, 65,
-/* 0x0930 */  92, 65, 93, 65, 94, 65, 95,195
+/* 0x01d0 */ 137,197, 73,137,232,232,227, 16,  0,  0, 68,139, 99,252, 72,129,
+/* 0x01e0 */ 196,  8,  8,  0,  0, 72,137, 68, 36, 32, 91, 65,246,196,  2,117,
+/* 0x01f0 */  19, 73,139,181,136,  0,  0,  0, 76,137,239, 73, 43,117, 80,232,
+/* 0x0200 */  87,  0,  0,  0, 77, 41,201, 65,137,216,106,  2, 89,106,  1, 90,
+/* 0x0210 */ 190,  0, 16,  0,  0, 41,255,232, 24,  0,  0,  0,137,223,232, 48,
+/* 0x0220 */   0,  0,  0, 95, 94, 65,246,196,  2,116,  2, 41,246,106, 11, 88,
+/* 0x0230 */  65,255,102,248,176,  9, 73,137,202, 15,182,192, 15,  5, 72, 61,
+/* 0x0240 */   0,240,255,255,114,  4, 72,131,200,255,195,176, 60,235,  2,176,
+/* 0x0250 */  12,235,  2,176,  3,235,  2,176,  2,235,  2,176, 11,235,  2,176,
+/* 0x0260 */  10,235,  2,176,  1,235,  2,176,  0,235,206, 73,137,202,106, 25,
+/* 0x0270 */ 235, 79,106, 28,235, 75,104,204,  0,  0,  0,235, 68, 73,137,202,
+/* 0x0280 */ 104,202,  0,  0,  0,235, 58,106,  5,235, 54,106, 39,235, 50,106,
+/* 0x0290 */ 107,235, 46,106, 82,235, 42,106, 87,235, 38, 73,137,202,106, 18,
+/* 0x02a0 */ 235, 31,106, 16,235, 27,104,231,  0,  0,  0,235, 20,104, 67,  1,
+/* 0x02b0 */   0,  0,235, 13,106, 72,235,  9,106, 97,235,  5, 73,137,202,106,
+/* 0x02c0 */  14, 88, 15,  5,195, 72,131,238, 16, 72,137, 14, 72,137, 86,  8,
+/* 0x02d0 */  77,137,194,106, 56, 88, 15,  5,133,192,117, 11, 95, 88,255,208,
+/* 0x02e0 */  41,255,106, 60, 88, 15,  5,195, 72,141,  5,  1,  0,  0,  0,195,
+/* 0x02f0 */  85, 80, 88, 95, 67, 65, 67, 72, 69, 95, 68, 73, 82,  0,  0,  0,
+/* 0x0300 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0310 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0320 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0330 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0340 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0350 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0360 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0370 */  15,183,207, 73,137,208,193,239, 16, 65,185,241,255,  0,  0, 77,
+/* 0x0380 */ 133,192,116, 58,184,176, 21,  0,  0, 73, 57,192, 73, 15, 70,192,
+/* 0x0390 */  49,210, 73, 41,192, 68, 15,182, 20, 22, 72,255,194, 68,  1,209,
+/* 0x03a0 */   1,207, 72, 57,208,117,238, 72,  1,198, 49,210,137,200, 65,247,
+/* 0x03b0 */ 241,137,248,137,209, 49,210, 65,247,241,137,215,235,193,193,231,
+/* 0x03c0 */  16,137,248,  9,200,195, 73,137,248,185, 28,  0,  0,  0,137,242,
+/* 0x03d0 */ 211,234,131,226, 15,131,250, 10, 25,192,131,233,  4, 73,255,192,
+/* 0x03e0 */ 131,224,217,141, 68, 16, 87, 65,136, 64,255,131,249,252,117,222,
+/* 0x03f0 */ 198, 71,  8,  0, 72,141, 71,  8,195, 85,137,253,191,  7,  0,  0,
+/* 0x0400 */   0, 83, 72,131,236, 24, 72,137,230,232,170,254,255,255,133,192,
+/* 0x0410 */ 116,  4,137,235,235, 51, 72,139, 20, 36, 72,131,250,127,118,242,
+/* 0x0420 */ 184,  0,  0,  1,  0,190,  6,  4,  0,  0,137,239, 72, 57,194, 72,
+/* 0x0430 */  15, 71,208, 72,131,234, 64,232,120,254,255,255,137,195,133,192,
+/* 0x0440 */ 120,208,137,239,232, 10,254,255,255, 72,131,196, 24,137,216, 91,
+/* 0x0450 */  93,195, 65, 87, 65, 86, 73,137,214, 65, 85, 65, 84, 85, 83, 72,
+/* 0x0460 */ 131,236, 72, 72,139,106,  8,137,116, 36, 12, 72,141, 68, 36, 24,
+/* 0x0470 */  68,139,109,  0,139,117,  4, 72,137,  4, 36, 76,141,101, 12, 68,
+/* 0x0480 */  57,238,115, 80, 72,137,251, 72,139, 87, 16, 76,137,108, 36, 24,
+/* 0x0490 */  72,137,193, 68,139, 69,  8, 76,137,231,255, 83, 32,133,192,117,
+/* 0x04a0 */   7, 76, 57,108, 36, 24,116, 10,191,127,  0,  0,  0,232,244,253,
+/* 0x04b0 */ 255,255, 15,182, 77,  9,132,201,116, 22, 72,139, 67, 40, 72,133,
+/* 0x04c0 */ 192,116, 13, 15,182, 85, 10, 72,139,123, 16, 68,137,238,255,208,
+/* 0x04d0 */  76,139, 99, 16, 49,210, 73,139,  6,189,  3,170, 40,192,139,124,
+/* 0x04e0 */  36, 12, 72,137, 84, 36, 48, 72,137,238, 72,137, 84, 36, 56, 72,
+/* 0x04f0 */ 139, 20, 36, 72,137, 68, 36, 24, 76,137,100, 36, 32, 76,137,108,
+/* 0x0500 */  36, 40,232,155,253,255,255,133,192,116, 96, 49,219, 73,139,  6,
+/* 0x0510 */  76, 57,235,115, 58, 72,  1,216, 72,139, 20, 36,139,124, 36, 12,
+/* 0x0520 */  72,137,238, 72,137, 68, 36, 24, 73,141,  4, 28, 72,129,195,  0,
+/* 0x0530 */  16,  0,  0, 72,137, 68, 36, 32, 49,192, 72,199, 68, 36, 40,  0,
+/* 0x0540 */  16,  0,  0, 72,137, 68, 36, 48,232, 85,253,255,255,235,190, 72,
+/* 0x0550 */ 139, 20, 36,139,124, 36, 12,190,  2,170, 16,128, 72,137, 68, 36,
+/* 0x0560 */  24, 76,137,108, 36, 32,232, 55,253,255,255, 72,131,196, 72, 91,
+/* 0x0570 */  93, 65, 92, 65, 93, 65, 94, 65, 95,195, 65, 85, 65, 84, 65,188,
+/* 0x0580 */   2,170, 16,128, 85, 83, 72,137,251, 72,131,236, 40,139, 59, 72,
+/* 0x0590 */ 137,230,186, 32,  0,  0,  0,232,203,252,255,255, 72,131,248, 32,
+/* 0x05a0 */ 116,  7, 49,255,232,162,252,255,255, 15,182,  4, 36, 72,131,248,
+/* 0x05b0 */  18,117,108,139,115,  4, 72,139,124, 36, 16, 49,192,137,242, 41,
+/* 0x05c0 */ 194,131,250,  1,118, 24,141, 20, 48,209,234,137,209, 72,193,225,
+/* 0x05d0 */   4, 72, 59,124, 25, 48, 15, 67,194, 15, 66,242,235,223,141, 80,
+/* 0x05e0 */   3,139, 51, 72,137,223, 72,193,226,  4, 72,  1,218,232, 96,254,
+/* 0x05f0 */ 255,255, 72,139, 68, 36, 16,139, 59, 76,137,230, 72,199, 68, 36,
+/* 0x0600 */  16,  0, 16,  0,  0, 72,141, 84, 36,  8, 72, 37,  0,240,255,255,
+/* 0x0610 */  72,137, 68, 36,  8,232,136,252,255,255,233,110,255,255,255, 72,
+/* 0x0620 */ 131,248, 19, 15,133,100,255,255,255,139,124, 36,  8, 69, 49,237,
+/* 0x0630 */ 232,196,253,255,255,137,197, 68, 59,107,  4,115, 29, 68,137,234,
+/* 0x0640 */ 137,238, 72,137,223, 65,255,197, 72,131,194,  3, 72,193,226,  4,
+/* 0x0650 */  72,  1,218,232,250,253,255,255,235,221,137,239,232,242,251,255,
+/* 0x0660 */ 255,233, 39,255,255,255, 72,133,255,116, 47, 64,246,199,  1,117,
+/* 0x0670 */  41,137,241, 72,139,  7, 72, 57,200,117,  8, 72,137, 15, 72,137,
+/* 0x0680 */  87,  8,195, 72,131,248,  1,117,  6,133,246,116,  7,235,236, 72,
+/* 0x0690 */ 133,192,116,  6, 72,131,199, 16,235,217,195, 76,139, 71,  8, 49,
+/* 0x06a0 */ 192, 72, 57, 23,115, 11, 80,191,127,  0,  0,  0,232,154,251,255,
+/* 0x06b0 */ 255, 65,138, 12,  0,136, 12,  6, 72,255,192, 72, 57,194,117,241,
+/* 0x06c0 */  72,  1, 87,  8, 72, 41, 23,195, 65, 87, 65, 86, 73,137,214, 65,
+/* 0x06d0 */  85, 73,137,205, 65, 84, 85, 72,137,245, 83, 72,137,251, 72,131,
+/* 0x06e0 */ 236, 56, 72,141, 68, 36, 36, 72,137,  4, 36, 72,131,125,  0,  0,
+/* 0x06f0 */  15,132, 59,  1,  0,  0, 72,139, 52, 36,186, 12,  0,  0,  0, 72,
+/* 0x0700 */ 137,223,232,148,255,255,255,139, 68, 36, 36,133,192,117, 22,129,
+/* 0x0710 */ 124, 36, 40, 85, 80, 88, 33,117, 20, 72,131, 59,  0, 15,132, 14,
+/* 0x0720 */   1,  0,  0,235,  8,139, 84, 36, 40,133,210,117, 10,191,127,  0,
+/* 0x0730 */   0,  0,232, 20,251,255,255, 64,138,124, 36, 44, 64,128,255,255,
+/* 0x0740 */ 117, 28, 57,194,114,231, 72,139, 11, 41,194, 72, 57,209,114,221,
+/* 0x0750 */  72, 41,209, 72,  1, 83,  8, 72,137, 11,137, 68, 36, 40,139,116,
+/* 0x0760 */  36, 40, 57,240,114,199, 65,137,196, 76, 57,101,  0,114,190, 57,
+/* 0x0770 */ 198, 76,139, 85,  8, 65,137,247,115, 82, 76,137,100, 36, 24, 72,
+/* 0x0780 */ 139,123,  8, 72,141, 76, 36, 24, 76,137,210, 68,139, 68, 36, 44,
+/* 0x0790 */  65,255,214,133,192,117,150, 72,139,116, 36, 24, 73, 57,244,117,
+/* 0x07a0 */ 140, 15,182, 76, 36, 45,132,201,116, 98, 77,133,237,116, 93, 73,
+/* 0x07b0 */ 129,252,  0,  2,  0,  0,119,  6, 76, 59,101,  0,117, 78, 15,182,
+/* 0x07c0 */  84, 36, 46, 72,139,125,  8, 65,255,213,235, 64, 64,254,199,117,
+/* 0x07d0 */  68, 76, 57, 59,114, 63, 72,139,123,  8, 72,137,248, 76,  9,208,
+/* 0x07e0 */  76,  9,224,169,255, 15,  0,  0,117, 43, 77,137,208,185,  3,  0,
+/* 0x07f0 */   0,  0, 76,137,226, 76,137,230, 76,137, 84, 36,  8,232,105,250,
+/* 0x0800 */ 255,255, 76,139, 84, 36,  8, 73, 57,194,117,  9, 76,  1,123,  8,
+/* 0x0810 */  76, 41, 59,235, 15, 72,139,117,  8, 76,137,250, 72,137,223,232,
+/* 0x0820 */ 119,254,255,255, 76,  1,101,  8, 76, 41,101,  0,233,186,254,255,
+/* 0x0830 */ 255, 72,131,196, 56, 91, 93, 65, 92, 65, 93, 65, 94, 65, 95,195,
+/* 0x0840 */  65, 87, 65, 86, 65, 85, 65, 84, 73,137,212, 85, 83, 72,131,236,
+/* 0x0850 */  72,139, 87,  4, 57,214, 15,131,177,  0,  0,  0,137,240, 73,137,
+/* 0x0860 */ 205, 72,137,251,137,245, 72,193,224,  4,190,  0,170, 32,192, 72,
+/* 0x0870 */ 139, 76, 56, 48,141, 66,255, 72,193,224,  4, 72,  1,248,139, 63,
+/* 0x0880 */  72,137, 76, 36, 32, 72,139, 80, 56,139, 18, 72,  3, 80, 48, 72,
+/* 0x0890 */ 199, 68, 36, 48,  1,  0,  0,  0, 72,137,208, 72,141, 84, 36, 32,
+/* 0x08a0 */  72, 41,200, 72,137, 68, 36, 40, 49,192, 72,137, 68, 36, 56,232,
+/* 0x08b0 */ 238,249,255,255,133,192,116, 85, 65,137,239, 76,141,116, 36, 16,
+/* 0x08c0 */  68, 59,123,  4,115, 68, 68,137,248, 72,137,231, 76,137,246, 65,
+/* 0x08d0 */ 255,199, 72,193,224,  4, 72,  1,216, 72,139, 80, 56, 72,139, 64,
+/* 0x08e0 */  48,139, 74,  4, 72,137, 68, 36, 24,139,  2, 72,137, 84, 36,  8,
+/* 0x08f0 */  76,137,226, 72,131,193, 12, 72,137, 12, 36, 76,137,233, 72,137,
+/* 0x0900 */  68, 36, 16,232,192,253,255,255,235,182,137,107,  4, 72,131,196,
+/* 0x0910 */  72, 91, 93, 65, 92, 65, 93, 65, 94, 65, 95,195, 65, 85, 65, 84,
+/* 0x0920 */  85, 72,137,253, 83, 72,131,236, 40, 68,139,103, 16, 76,141,108,
+/* 0x0930 */  36, 16, 68, 59,101,  8,115, 77, 68,137,227, 72,139, 85, 24, 72,
+/* 0x0940 */ 137,231, 76,137,238, 72,107,219, 48, 72,  3, 93,  0, 72,139, 67,
+/* 0x0950 */   8, 72,139, 75, 32, 72,137, 68, 36,  8, 72,139,  3, 72,137,  4,
+/* 0x0960 */  36, 72,139, 67, 24, 72,137, 68, 36, 24, 72,139, 67, 16, 72,137,
+/* 0x0970 */  68, 36, 16,232, 80,253,255,255,199, 67, 40,  1,  0,  0,  0, 68,
+/* 0x0980 */   3,101, 12,235,173, 72,131,196, 40, 91, 93, 65, 92, 65, 93,195,
+/* 0x0990 */  65, 87, 73,137,207, 65, 86, 69, 49,246, 65, 85, 73,137,253, 49,
+/* 0x09a0 */ 255, 65, 84, 69, 49,228, 85, 72,137,245, 83, 72,129,236,184, 26,
+/* 0x09b0 */   0,  0, 72,139, 54, 72,141,132, 36,176,  2,  0,  0, 72,137, 84,
+/* 0x09c0 */  36, 16, 72,137,  4, 36,137,124, 36, 40, 73, 57,244, 15,131,135,
+/* 0x09d0 */   0,  0,  0,129,124, 36, 40,128,  0,  0,  0,116,125, 73,139, 77,
+/* 0x09e0 */   0, 73,141, 86, 12, 72, 57,209,114,112, 77,139, 77,  8, 77,  1,
+/* 0x09f0 */ 241, 65,139, 81,  4, 65,139, 57, 72,131,194, 12,133,255,116, 90,
+/* 0x0a00 */  73,137,242, 65,137,248, 77, 41,226, 77, 57,194,114, 76, 76, 41,
+/* 0x0a10 */ 241, 72, 57,209,114, 68, 72,139, 77,  8,255, 68, 36, 40, 73,  1,
+/* 0x0a20 */ 214, 76,137, 72,  8, 76,  1,225, 77,  1,196, 72,137, 16, 72,137,
+/* 0x0a30 */  72, 24, 76,137, 64, 16, 76, 57,230,116, 10, 49,210,129,255,  0,
+/* 0x0a40 */   2,  0,  0,118,  3, 76,137,250, 49,201, 72,137, 80, 32, 72,131,
+/* 0x0a50 */ 192, 48,137, 72,248,233,112,255,255,255, 72,141, 84, 36, 48,190,
+/* 0x0a60 */ 128,  0,  0,  0, 49,255,232, 11,248,255,255, 49,210, 49,201, 57,
+/* 0x0a70 */ 208,126, 38,131,250,127,127, 33, 72, 99,242, 72,193,238,  3, 72,
+/* 0x0a80 */ 139,116,244, 48, 72,133,246,116, 11, 72,141,126,255,255,193, 72,
+/* 0x0a90 */  33,254,235,240,131,194,  8,235,214,187, 16,  0,  0,  0, 57, 92,
+/* 0x0aa0 */  36, 40, 15, 70, 92, 36, 40, 57,203, 15, 71,217, 76, 57,101,  0,
+/* 0x0ab0 */ 117,  5,131,251,  1,119, 24, 72,139, 84, 36, 16, 76,137,249, 72,
+/* 0x0ac0 */ 137,238, 76,137,239,232,254,251,255,255,233,130,  1,  0,  0,141,
+/* 0x0ad0 */  67,255, 69, 49,201, 65,131,200,255,185, 34,  0,  0,  0,193,224,
+/* 0x0ae0 */  20,186,  3,  0,  0,  0, 49,255, 72,137,198, 72,137, 68, 36, 24,
+/* 0x0af0 */ 232, 63,247,255,255, 72,137, 68, 36,  8, 72,137,198, 72, 61,  0,
+/* 0x0b00 */ 240,255,255,119,178, 76,141,124, 36, 48, 69, 49,201, 72,141,132,
+/* 0x0b10 */  36,176,  2,  0,  0, 65,137, 95, 12, 73,137,  7,139, 68, 36, 40,
+/* 0x0b20 */  69,137, 79, 16, 65,137, 71,  8, 72,139, 68, 36, 16, 73,137, 71,
+/* 0x0b30 */  24, 69,133,201,117, 25, 49,210, 73,131,199, 40, 72,129,198,  0,
+/* 0x0b40 */   0, 16,  0, 65,185,  1,  0,  0,  0, 65,137, 87,248,235,190, 65,
+/* 0x0b50 */ 199, 71, 32,255,255,255,255, 77,141, 71, 32, 76,137,249, 72,141,
+/* 0x0b60 */  21,183,253,255,255,191,  0, 15, 37,  0, 68,137, 76, 36, 44, 72,
+/* 0x0b70 */ 137,116, 36, 32,232, 76,247,255,255, 72,139,116, 36, 32, 68,139,
+/* 0x0b80 */  76, 36, 44,133,192,127,  6, 49,192, 65,137, 71, 32, 65,255,193,
+/* 0x0b90 */  65, 57,217,115, 16, 73,131,199, 40, 72,129,198,  0,  0, 16,  0,
+/* 0x0ba0 */ 233,104,255,255,255, 72,141,124, 36, 48,232,109,253,255,255, 72,
+/* 0x0bb0 */ 141,124, 36,120, 65,184,  1,  0,  0,  0, 69,137,199, 77,107,255,
+/* 0x0bc0 */  40, 73,141,135,176, 26,  0,  0, 76,141, 60,  4, 65,139,151,160,
+/* 0x0bd0 */ 229,255,255,133,210,116, 31, 49,201, 49,246, 68,137, 68, 36, 44,
+/* 0x0be0 */  72,137,124, 36, 32,232,147,246,255,255, 68,139, 68, 36, 44, 72,
+/* 0x0bf0 */ 139,124, 36, 32,235,214, 65,255,192, 72,131,199, 40, 65, 57,216,
+/* 0x0c00 */ 114,184, 72,139,116, 36, 24, 72,139,124, 36,  8, 49,219,232, 72,
+/* 0x0c10 */ 246,255,255, 57, 92, 36, 40,116, 40, 72,139,  4, 36,131,120, 40,
+/* 0x0c20 */   0,117, 21, 72,139, 72, 32, 72,139, 84, 36, 16, 72,141,112, 16,
+/* 0x0c30 */  72,137,199,232,144,250,255,255, 72,131,  4, 36, 48,255,195,235,
+/* 0x0c40 */ 210, 77,  1,117,  8, 77, 41,117,  0, 76,  1,101,  8, 76, 41,101,
+/* 0x0c50 */   0, 72,129,196,184, 26,  0,  0, 91, 93, 65, 92, 65, 93, 65, 94,
+/* 0x0c60 */  65, 95,195, 65, 87, 73,137,247, 65, 86, 65, 85, 73,137,253, 65,
+/* 0x0c70 */  84, 85, 83, 72,129,236,168,  0,  0,  0, 72,139, 95, 32, 72,139,
+/* 0x0c80 */ 132, 36,224,  0,  0,  0,137, 84, 36, 96, 72,  1,251, 72,137, 76,
+/* 0x0c90 */  36, 32, 65,139, 85, 16, 76,137, 68, 36, 56, 72,139, 56, 76,137,
+/* 0x0ca0 */  76, 36, 40, 72,133,246,116, 67, 72,139, 71, 32, 72,  1,248, 72,
+/* 0x0cb0 */ 139, 72, 72, 72, 41,207,102,131,250,  2,117,  4, 72,139,120, 16,
+/* 0x0cc0 */  72,139,112, 40, 49,210, 69, 49,201, 65,131,200,255,185, 50,  0,
+/* 0x0cd0 */   0,  0,232, 93,245,255,255, 49,210,102, 65,131,125, 16,  2, 72,
+/* 0x0ce0 */  15, 69,208, 72,137,213,233,141,  0,  0,  0, 49,201,102,131,250,
+/* 0x0cf0 */   3, 69, 15,183, 69, 56, 72,137,218, 15,149,193, 49,246, 73,131,
+/* 0x0d00 */ 204,255,193,225,  4,131,193, 34, 65,131,232,  1,114, 33,131, 58,
+/* 0x0d10 */   1,117, 22, 72,139, 66, 16, 73, 57,196, 76, 15, 71,224, 72,  3,
+/* 0x0d20 */  66, 40, 72, 57,198, 72, 15, 66,240, 72,131,194, 56,235,217, 73,
+/* 0x0d30 */ 129,228,  0,240,255,255, 72,129,198,255, 15,  0,  0, 76, 41,230,
+/* 0x0d40 */  72,129,230,  0,240,255,255,246,193, 16,117, 17, 77,133,228,117,
+/* 0x0d50 */  17, 72,133,255,116, 12,185, 50,  0,  0,  0,235,  7, 76,137,231,
+/* 0x0d60 */ 235,  2, 49,255, 69, 49,201, 65,131,200,255, 49,210,232,194,244,
+/* 0x0d70 */ 255,255, 76, 41,224, 72,137,197, 77,133,255,139, 76, 36, 96, 15,
+/* 0x0d80 */ 149,194, 15,182,194,193,233, 31,  1,192, 32,202,136, 84, 36, 71,
+/* 0x0d90 */ 186,  2,  0,  0,  0, 15, 68,208,128,124, 36, 71,  1, 25,192,137,
+/* 0x0da0 */  68, 36, 80, 49,192,131,100, 36, 80,224,131, 68, 36, 80, 50,137,
+/* 0x0db0 */  84, 36,100,137, 68, 36, 84, 65, 15,183, 69, 56,139, 76, 36, 84,
+/* 0x0dc0 */  65,137,192, 57,200, 15,142,206,  4,  0,  0,139,  3, 77,133,255,
+/* 0x0dd0 */ 116, 32,131,248,  6,117, 37, 72,139, 83, 16, 72,139,124, 36, 32,
+/* 0x0de0 */ 190,  3,  0,  0,  0, 72,  1,234,232,121,248,255,255,233,154,  4,
+/* 0x0df0 */   0,  0,255,200, 15,133,146,  4,  0,  0,235, 80,255,200, 15,133,
+/* 0x0e00 */ 136,  4,  0,  0, 72,131,123,  8,  0,117, 65, 73,139, 85, 32, 72,
+/* 0x0e10 */ 139,124, 36, 32,190,  3,  0,  0,  0, 72,  1,234, 72,  3, 83, 16,
+/* 0x0e20 */ 232, 65,248,255,255, 72,139,124, 36, 32, 65, 15,183,208,190,  5,
+/* 0x0e30 */   0,  0,  0,232, 46,248,255,255, 65, 15,183, 85, 54, 72,139,124,
+/* 0x0e40 */  36, 32,190,  4,  0,  0,  0,232, 26,248,255,255,139, 67,  4, 65,
+/* 0x0e50 */ 190, 64, 98, 81,115, 72,139, 83, 32, 76,139, 75,  8, 68,139, 68,
+/* 0x0e60 */  36, 96,141, 12,133,  0,  0,  0,  0, 72,137,148, 36,128,  0,  0,
+/* 0x0e70 */   0,131,225, 28, 65,211,238, 68,137,240,131,224,  7,137, 68, 36,
+/* 0x0e80 */  72, 72,139, 67, 16,139, 76, 36, 72, 72,  1,232, 72,137, 68, 36,
+/* 0x0e90 */  24, 72,139,116, 36, 24, 72,137,132, 36,136,  0,  0,  0, 72,  3,
+/* 0x0ea0 */  67, 40, 72,137, 68, 36, 88, 72,139, 68, 36, 24, 72,129,230,  0,
+/* 0x0eb0 */ 240,255,255, 72,137,116, 36, 16, 37,255, 15,  0,  0, 72,141, 60,
+/* 0x0ec0 */   2,139, 84, 36,100, 73, 41,193, 72,137,124, 36,  8, 72,137,254,
+/* 0x0ed0 */  72,139,124, 36, 16,  9,202,139, 76, 36, 80,232, 84,243,255,255,
+/* 0x0ee0 */  72, 57, 68, 36, 16,116, 10,191,127,  0,  0,  0,232, 90,243,255,
+/* 0x0ef0 */ 255,131,188, 36,240,  0,  0,  0,  0,116, 26,246, 67,  4,  1,116,
+/* 0x0f00 */  20, 72,139,116, 36,  8, 72,139,124, 36, 16,186, 14,  0,  0,  0,
+/* 0x0f10 */ 232, 93,243,255,255, 72,139, 68, 36,  8, 65,131,230,  2, 72,247,
+/* 0x0f20 */ 216, 37,255, 15,  0,  0,128,124, 36, 71,  0, 72,137, 68, 36, 48,
+/* 0x0f30 */  15,132, 52,  2,  0,  0, 72,131,188, 36,232,  0,  0,  0,  0, 15,
+/* 0x0f40 */ 132,234,  1,  0,  0, 72,139,132, 36,232,  0,  0,  0,139, 64,  4,
+/* 0x0f50 */ 137, 68, 36, 76, 72,141,132, 36,144,  0,  0,  0, 72,137, 68, 36,
+/* 0x0f60 */ 104, 76,139,164, 36,128,  0,  0,  0, 77,133,228, 15,132,108,  1,
+/* 0x0f70 */   0,  0, 77,139, 79,  8, 73,139, 23, 76,139,132, 36,136,  0,  0,
+/* 0x0f80 */   0, 65,139, 73,  4, 72,137,207, 72,131,193, 12, 72, 57,202, 15,
+/* 0x0f90 */ 130,133,  0,  0,  0, 72,131,250, 11,118,127, 72,139,132, 36,232,
+/* 0x0fa0 */   0,  0,  0, 72,139,180, 36,232,  0,  0,  0,139, 64,  4, 59, 70,
+/* 0x0fb0 */   8,115,103, 76, 57, 68, 36, 24,116, 96, 65,139, 49, 76, 57,230,
+/* 0x0fc0 */ 115, 88, 77,137,195, 73,  9,243, 65,247,195,255, 15,  0,  0,117,
+/* 0x0fd0 */  73, 57,254,114, 69, 65,128,121,  8,255,116, 62, 76,139,148, 36,
+/* 0x0fe0 */ 232,  0,  0,  0,141,120,  1, 72,193,224,  4, 72, 41,202, 73, 41,
+/* 0x0ff0 */ 244, 76,  1,208, 65,137,122,  4, 76,137, 64, 48, 73,  1,240, 76,
+/* 0x1000 */ 137, 72, 56, 73,  1,201, 77,137, 79,  8, 73,137, 23, 76,137,132,
+/* 0x1010 */  36,136,  0,  0,  0,233,183,  0,  0,  0, 72,139, 84, 36, 56, 72,
+/* 0x1020 */ 139, 76, 36, 40, 76,137, 68, 36,120,139,116, 36, 76, 72,139,188,
+/* 0x1030 */  36,232,  0,  0,  0, 76,137, 76, 36,112,232,  1,248,255,255, 76,
+/* 0x1040 */ 139, 76, 36,112, 76,139, 68, 36,120, 72,139,132, 36,232,  0,  0,
+/* 0x1050 */   0, 65,139, 17, 76,137,132, 36,152,  0,  0,  0,139, 64,  4,137,
+/* 0x1060 */  68, 36, 76,133,210,116, 38,137,208, 72,139, 76, 36, 40, 73, 57,
+/* 0x1070 */ 196, 72,137,198, 73, 15, 70,244,129,250,  0,  2,  0,  0,119, 18,
+/* 0x1080 */  49,201, 76, 57,224, 72, 15, 67, 76, 36, 40,235,  5, 76,137,230,
+/* 0x1090 */  49,201, 72,137,180, 36,144,  0,  0,  0, 72,139, 84, 36, 56, 76,
+/* 0x10a0 */ 137,255, 72,139,116, 36,104, 76,137, 68, 36,112,232, 23,246,255,
+/* 0x10b0 */ 255, 72,139,132, 36,152,  0,  0,  0, 76,139, 68, 36,112, 72,137,
+/* 0x10c0 */ 194, 76, 41,194,116, 24, 72,137,132, 36,136,  0,  0,  0, 73, 41,
+/* 0x10d0 */ 212, 76,137,164, 36,128,  0,  0,  0,233,131,254,255,255, 72,139,
+/* 0x10e0 */  76, 36, 40, 72,139, 84, 36, 56,139,116, 36, 76, 72,139,188, 36,
+/* 0x10f0 */ 232,  0,  0,  0,232, 71,247,255,255, 69,133,246,117, 33, 72,186,
+/* 0x1100 */ 255,255,255,255,  1,  0,  0,  0, 72, 35, 19, 72,184,  1,  0,  0,
+/* 0x1110 */   0,  1,  0,  0,  0, 72, 57,194,116,127,233, 12,  1,  0,  0, 72,
+/* 0x1120 */ 139, 68, 36, 16, 72,139, 76, 36,  8, 72,141, 20,  8,235, 45, 72,
+/* 0x1130 */ 139, 76, 36, 40, 72,139, 84, 36, 56, 72,141,180, 36,128,  0,  0,
+/* 0x1140 */   0, 76,137,255,232, 71,248,255,255, 69,133,246,116,176, 72,139,
+/* 0x1150 */  68, 36, 16, 72,139,124, 36,  8, 72,141, 20, 56, 72,139, 76, 36,
+/* 0x1160 */  48, 49,192, 72,137,215,243,170,235,148, 69,133,246,116, 28, 72,
+/* 0x1170 */ 139, 68, 36, 16, 72,139, 76, 36,  8, 72,141, 20,  8, 72,139, 76,
+/* 0x1180 */  36, 48,138, 68, 36, 71, 72,137,215,243,170, 77,133,255, 15,132,
+/* 0x1190 */ 178,  0,  0,  0,233,101,255,255,255, 76,139, 99, 40, 72,139, 67,
+/* 0x11a0 */  16, 76, 59, 99, 32,117, 19, 73,  1,196, 73,  1,236, 68,137,226,
+/* 0x11b0 */ 247,218,129,226,252, 15,  0,  0,117, 86, 72,131,123,  8,  0,116,
+/* 0x11c0 */  63, 69, 49,201, 65,131,200,255,185, 34,  0,  0,  0, 49,255,186,
+/* 0x11d0 */   3,  0,  0,  0,190,  0, 16,  0,  0,232, 86,240,255,255, 73,137,
+/* 0x11e0 */ 196, 72,133,192,116, 69,199,  0, 15,  5, 90,195,186,  5,  0,  0,
+/* 0x11f0 */   0,190,  4,  0,  0,  0, 72,137,199,232, 97,240,255,255,235, 24,
+/* 0x1200 */  72,  1,232,199, 64, 12, 15,  5, 90,195, 76,141, 96, 12,235,  8,
+/* 0x1210 */  65,199,  4, 36, 15,  5, 90,195, 72,139,124, 36, 32, 76,137,226,
+/* 0x1220 */  49,246, 72,131,231,254,232, 59,244,255,255,139, 84, 36, 72, 72,
+/* 0x1230 */ 139,116, 36,  8, 72,139,124, 36, 16,232, 33,240,255,255,133,192,
+/* 0x1240 */  15,133,161,252,255,255, 72,139, 68, 36,  8, 72,139,124, 36, 48,
+/* 0x1250 */  76,139,100, 36, 16, 72,  1,248, 73,  1,196, 72,139, 68, 36, 88,
+/* 0x1260 */  73, 57,196,115, 39, 72,137,198,139, 84, 36, 72, 69, 49,201, 65,
+/* 0x1270 */ 131,200,255, 76, 41,230,185, 50,  0,  0,  0, 76,137,231,232,177,
+/* 0x1280 */ 239,255,255, 73, 57,196, 15,133, 91,252,255,255,255, 68, 36, 84,
+/* 0x1290 */  72,131,195, 56,233, 30,251,255,255, 72,139,132, 36,224,  0,  0,
+/* 0x12a0 */   0, 72,137, 40, 73,139, 69, 24, 72,129,196,168,  0,  0,  0, 91,
+/* 0x12b0 */  72,  1,232, 93, 65, 92, 65, 93, 65, 94, 65, 95,195, 65, 87, 73,
+/* 0x12c0 */ 137,215, 65, 86, 65, 85, 65, 84, 73,137,244, 85, 72,137,253, 83,
+/* 0x12d0 */  72,137,203, 49,201, 72,129,236,216,  1,  0,  0,139,  7, 72,137,
+/* 0x12e0 */  84, 36, 88, 76,137,194, 72,137, 68, 36, 80,139, 71,  4, 72,137,
+/* 0x12f0 */ 124, 36,120, 72,131,192, 12, 72,137,124, 36,104, 72,141,124, 36,
+/* 0x1300 */ 112, 72,137,116, 36, 96, 72,141,116, 36, 80, 76,137, 68, 36, 32,
+/* 0x1310 */  76,137, 76, 36, 40, 72,137, 68, 36,112,232,169,243,255,255,232,
+/* 0x1320 */ 196,239,255,255, 72,137,217,131,225,  2, 72,137, 76, 36, 24,137,
+/* 0x1330 */ 217,131,225,  4,137, 76, 36, 56, 72,137,217, 72,131,225,251,128,
+/* 0x1340 */  56, 47, 72,137, 76, 36,  8,117,  7,139,117,244,133,246,117, 25,
+/* 0x1350 */  72,131,124, 36, 24,  0, 15,133,172,  1,  0,  0,189,254,255,255,
+/* 0x1360 */ 255, 69, 49,237,233,182,  2,  0,  0, 72,141,148, 36,131,  0,  0,
+/* 0x1370 */   0, 73,137,211,138,  8, 72,141,122,  1,132,201,116, 11,136, 79,
+/* 0x1380 */ 255, 72,255,192, 72,137,250,235,235,198,  2, 47,232, 53,240,255,
+/* 0x1390 */ 255,198,  0, 45,139,117,248, 72,141,120,  1,232, 38,240,255,255,
+/* 0x13a0 */  76,137,226, 72,137,238,191,  1,  0,  0,  0,198,  0, 45, 73,137,
+/* 0x13b0 */ 197,232,186,239,255,255, 73,141,125,  1, 77,141,111, 64,137,198,
+/* 0x13c0 */ 232,  1,240,255,255, 72,133,192,116,134,139, 69,244, 49,210,190,
+/* 0x13d0 */   0,  0, 10,  0, 76,137,223,137, 68, 36, 52,232,119,238,255,255,
+/* 0x13e0 */ 137,197,133,192,120, 75, 65, 15,183,119, 56, 76,137,232, 49,201,
+/* 0x13f0 */  69, 49,228, 57,241,125, 28,131, 56,  1,117, 15, 72,139, 80, 32,
+/* 0x1400 */  72,  3, 80,  8, 73, 57,212, 76, 15, 66,226, 72,131,192, 56,255,
+/* 0x1410 */ 193,235,224, 72,141,180, 36, 40,  1,  0,  0,137,239,232,101,238,
+/* 0x1420 */ 255,255,137, 68, 36, 16,133,192,116, 15,137,239,232, 34,238,255,
+/* 0x1430 */ 255,131,205,255,233,178,  0,  0,  0, 76,139,180, 36, 64,  1,  0,
+/* 0x1440 */   0, 76,137,240, 37, 18,240,  0,  0, 72, 61,  0,128,  0,  0,117,
+/* 0x1450 */ 217, 73,193,238, 32,117, 12, 76, 57,164, 36, 88,  1,  0,  0,115,
+/* 0x1460 */  16,235,199,232, 39,238,255,255,137,192, 73, 57,198,116,232,235,
+/* 0x1470 */ 185, 69, 49,201, 65,137,232,185,  2,  0,  0,  0,186,  1,  0,  0,
+/* 0x1480 */   0, 76,137,230, 49,255,232,169,237,255,255, 73,137,195,169,255,
+/* 0x1490 */  15,  0,  0,117,149, 65, 15,183, 79, 56, 65,190,  1,  0,  0,  0,
+/* 0x14a0 */  57, 76, 36, 16,125, 47, 65,131,125,  0,  1,117, 30, 73,139,117,
+/* 0x14b0 */   8, 73,139, 85, 32, 68,137,247,137, 76, 36, 60, 76,  1,222,232,
+/* 0x14c0 */ 172,238,255,255,139, 76, 36, 60, 65,137,198,255, 68, 36, 16, 73,
+/* 0x14d0 */ 131,197, 56,235,203, 76,137,230, 76,137,223,232,123,237,255,255,
+/* 0x14e0 */  68, 57,116, 36, 52, 15,133, 63,255,255,255, 69, 49,237, 72,131,
+/* 0x14f0 */ 124, 36, 24,  0, 15,132, 37,  1,  0,  0, 72,131,227,249, 72,137,
+/* 0x1500 */  92, 36,  8,233, 23,  1,  0,  0,191,  0,  0,  8,  0, 72,131,227,
+/* 0x1510 */ 249, 72,137, 92, 36,  8,232,146,237,255,255,137,199,133,192, 15,
+/* 0x1520 */ 136,242,  0,  0,  0,232,207,238,255,255, 49,246, 72,141,148, 36,
+/* 0x1530 */  40,  1,  0,  0, 72,199,132, 36, 40,  1,  0,  0,170,  0,  0,  0,
+/* 0x1540 */  72,137,180, 36, 56,  1,  0,  0,137,199,190, 63,170, 24,192,137,
+/* 0x1550 */ 195, 72,199,132, 36, 48,  1,  0,  0,  2,  0,  0,  0,232, 64,237,
+/* 0x1560 */ 255,255,133,192, 15,133,166,  0,  0,  0, 69, 49,246, 49,192, 49,
+/* 0x1570 */ 201, 72,141, 81, 12, 73, 57,212,114, 31, 72,141,116, 13,  0,139,
+/* 0x1580 */  22,133,210,116, 20, 72, 57,208, 72, 15, 66,194,139, 86,  4, 65,
+/* 0x1590 */ 255,198, 72,141, 76, 17, 12,235,216, 68,137,242, 72,  5,255, 15,
+/* 0x15a0 */   0,  0, 69, 49,201, 65,131,200,255, 72,193,226,  4, 72, 37,  0,
+/* 0x15b0 */ 240,255,255,185, 34,  0,  0,  0, 49,255, 76,141,162, 63, 16,  0,
+/* 0x15c0 */   0, 72,141,168,  0,  0, 16,  0,186,  3,  0,  0,  0, 73,129,228,
+/* 0x15d0 */   0,240,255,255, 74,141,116, 37,  0,232, 86,236,255,255, 73,137,
+/* 0x15e0 */ 197,169,255, 15,  0,  0,117, 40, 73,  1,196,137, 24, 76,137, 96,
+/* 0x15f0 */  16, 73,  1,236, 68,137,112,  8, 76,137, 96, 24, 72,139, 68, 36,
+/* 0x1600 */  32, 73,137, 69, 32, 72,139, 68, 36, 40, 73,137, 69, 40,235, 10,
+/* 0x1610 */ 137,223,232, 60,236,255,255, 69, 49,237,189,254,255,255,255, 72,
+/* 0x1620 */ 141,116, 36, 96, 81,139, 68, 36, 64,133,237,186,255,255,255,255,
+/* 0x1630 */  76,137,255, 77,141,103, 64, 80, 15, 73,213, 65, 85, 72,141,132,
+/* 0x1640 */  36, 40,  2,  0,  0, 80, 76,139, 76, 36, 72, 76,139, 68, 36, 64,
+/* 0x1650 */  72,139, 76, 36, 40,232,  9,246,255,255, 72,131,196, 32, 72,137,
+/* 0x1660 */ 195, 77,133,237, 15,132,161,  0,  0,  0, 65,131,125,  4,  0, 15,
+/* 0x1670 */ 132,141,  0,  0,  0, 72,141,116, 36, 72,185,  8,  0,  0,  0,191,
+/* 0x1680 */   2,  0,  0,  0, 72,199, 68, 36, 72,255,255,255,255, 76,141,180,
+/* 0x1690 */  36, 40,  1,  0,  0, 76,137,242,232, 31,236,255,255, 73,139,117,
+/* 0x16a0 */  24, 69, 49,192, 76,137,233, 72,141, 21,204,238,255,255,191,  0,
+/* 0x16b0 */  15,  5,  0,232, 13,236,255,255, 76,137,246,185,  8,  0,  0,  0,
+/* 0x16c0 */  49,210,191,  2,  0,  0,  0,137, 68, 36, 16, 69, 49,246,232,233,
+/* 0x16d0 */ 235,255,255, 68,139, 68, 36, 16, 69,133,192,127, 46, 65,139,117,
+/* 0x16e0 */   0, 69, 59,117,  4,115, 27, 68,137,242, 76,137,239, 65,255,198,
+/* 0x16f0 */  72,131,194,  3, 72,193,226,  4, 76,  1,234,232, 82,237,255,255,
+/* 0x1700 */ 235,219, 65,139,125,  0,232, 72,235,255,255,133,237,120, 12,137,
+/* 0x1710 */ 239,232, 61,235,255,255,233, 27,  1,  0,  0,255,197, 15,133, 19,
+/* 0x1720 */   1,  0,  0, 72,139,132, 36, 16,  2,  0,  0, 72,141,148, 36,131,
+/* 0x1730 */   0,  0,  0, 72,137, 84, 36, 32, 72,137, 68, 36, 24, 72,141,132,
+/* 0x1740 */  36, 40,  1,  0,  0, 72,137,197,138, 10, 76,141,104,  1,132,201,
+/* 0x1750 */ 116, 12, 65,136, 77,255, 72,255,194, 76,137,232,235,234,198,  0,
+/* 0x1760 */  46,232, 37,235,255,255, 76,137,239,137,198,232, 86,236,255,255,
+/* 0x1770 */  72,137,239,186,128,  1,  0,  0,190,193,  0, 10,  0,232,213,234,
+/* 0x1780 */ 255,255,137,197,133,192, 15,136,170,  0,  0,  0, 77,137,224, 65,
+/* 0x1790 */ 189,  1,  0,  0,  0, 69, 49,246, 65, 15,183, 71, 56, 65, 57,198,
+/* 0x17a0 */ 125, 71, 65,131, 56,  1,117, 56, 73,139, 64, 32, 73,139, 72,  8,
+/* 0x17b0 */ 137,239, 76,137, 68, 36, 40, 72,139,116, 36, 24, 73,  3,112, 16,
+/* 0x17c0 */  72,137,194, 72,137, 68, 36, 16,232,206,234,255,255, 72, 57, 68,
+/* 0x17d0 */  36, 16, 76,139, 68, 36, 40, 15,148,192, 15,182,192, 65, 33,197,
+/* 0x17e0 */  73,131,192, 56, 65,255,198,235,175, 49,201,137,239,186, 64,  0,
+/* 0x17f0 */   0,  0, 76,137,254,232,161,234,255,255,137,239, 72,141,172, 36,
+/* 0x1800 */  40,  1,  0,  0, 72,131,248, 64, 15,148,192, 15,182,192, 65, 33,
+/* 0x1810 */ 197,232, 61,234,255,255, 69,133,237,117, 10, 72,137,239,232,116,
+/* 0x1820 */ 234,255,255,235, 17, 72,139,116, 36, 32, 72,137,239,232, 97,234,
+/* 0x1830 */ 255,255,133,192,117,229, 72,139,124, 36,  8, 72,137,218,190,  9,
+/* 0x1840 */   0,  0,  0, 69, 49,237, 76,141,180, 36, 16,  2,  0,  0,232, 19,
+/* 0x1850 */ 238,255,255, 65, 15,183, 71, 56, 65, 57,197, 15,131,158,  0,  0,
+/* 0x1860 */   0, 65,131, 60, 36,  3, 15,133,135,  0,  0,  0, 73,139,124, 36,
+/* 0x1870 */  16, 49,210, 49,246, 72,  3,188, 36, 16,  2,  0,  0,232,213,233,
+/* 0x1880 */ 255,255,137,197,133,192,121, 10,191,127,  0,  0,  0,232,185,233,
+/* 0x1890 */ 255,255,186,  0,  4,  0,  0, 76,137,254,137,199,232,198,233,255,
+/* 0x18a0 */ 255, 72, 61,  0,  4,  0,  0,117,223, 49,192, 49,201, 49,246, 76,
+/* 0x18b0 */ 137,255, 72,137,132, 36, 16,  2,  0,  0, 69, 49,201, 69, 49,192,
+/* 0x18c0 */  82,137,234,106,  0,106,  0, 65, 86,232,149,243,255,255, 72,139,
+/* 0x18d0 */ 124, 36, 40, 72,131,196, 32, 72,139,148, 36, 16,  2,  0,  0,190,
+/* 0x18e0 */   7,  0,  0,  0, 72,137,195,232,122,237,255,255,137,239,232, 96,
+/* 0x18f0 */ 233,255,255, 73,131,196, 56, 65,255,197,233, 84,255,255,255, 72,
+/* 0x1900 */ 129,196,216,  1,  0,  0, 72,137,216, 91, 93, 65, 92, 65, 93, 65,
+/* 0x1910 */  94, 65, 95,195
 };
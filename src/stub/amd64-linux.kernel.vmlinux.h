@@ -1,5 +1,5 @@
 /* amd64-linux.kernel.vmlinux.h
-   created from amd64-linux.kernel.vmlinux.bin, 25838 (0x64ee) bytes
+   created from amd64-linux.kernel.vmlinux.bin, 12630 (0x3156) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_LINUX_KERNEL_VMLINUX_SIZE    25838
-#define STUB_AMD64_LINUX_KERNEL_VMLINUX_ADLER32 0xf24f9703
-#define STUB_AMD64_LINUX_KERNEL_VMLINUX_CRC32   0x459edbda
+#define STUB_AMD64_LINUX_KERNEL_VMLINUX_SIZE    12630
+#define STUB_AMD64_LINUX_KERNEL_VMLINUX_ADLER32 0x1110b7d9
+#define STUB_AMD64_LINUX_KERNEL_VMLINUX_CRC32   0xaa0c0ce2
 
-unsigned char stub_amd64_linux_kernel_vmlinux[25838] = {
+unsigned char stub_amd64_linux_kernel_vmlinux[12630] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  52, 30,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -450,1205 +450,380 @@ unsigned char stub_amd64_linux_kernel_vmlinux[25838] = {
 /* 0x19b0 */ 252,131,193,  3,193,233,  2,141,116,138,252,141,120,252,243,165,
 /* 0x19c0 */ 252,141,119,  4,137,239,131,205,255,255,224, 85, 80, 88, 33,161,
 /* 0x19d0 */ 216,208,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x19e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,102,105,108,101, 32,
-/* 0x19f0 */ 102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,105, 51, 56,
-/* 0x1a00 */  54, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120,
-/* 0x1a10 */  32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x1a20 */ 105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32,
-/* 0x1a30 */  32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,
-/* 0x1a40 */ 101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,
-/* 0x1a50 */ 103,115, 10, 32, 32, 48, 32, 76, 73, 78, 85, 88, 48, 48, 48, 32,
-/* 0x1a60 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32, 32, 48,
-/* 0x1a70 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a80 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32, 32, 50, 42, 42,
-/* 0x1a90 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1aa0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49,
-/* 0x1ab0 */  32, 76, 88, 67, 65, 76, 76, 84, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1ac0 */  48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ad0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1ae0 */  48, 48, 48, 52, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1af0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1b00 */  32, 32, 50, 32, 76, 88, 67, 75, 76, 76, 84, 49, 32, 32, 32, 32,
-/* 0x1b10 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48,
-/* 0x1b20 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1b30 */  48, 48, 48, 48, 48, 48, 52, 51, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1b40 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1b50 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 76, 88,
-/* 0x1b60 */  77, 79, 86, 69, 85, 80, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1b70 */  48, 48, 48, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1b80 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1b90 */  52, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1ba0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1bb0 */  78, 76, 89, 10, 32, 32, 52, 32, 78, 50, 66, 83, 77, 65, 49, 48,
-/* 0x1bc0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32,
-/* 0x1bd0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1be0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 53, 48, 32, 32, 50, 42,
-/* 0x1bf0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1c00 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1c10 */  53, 32, 78, 50, 66, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1c20 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1c30 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1c40 */  48, 48, 48, 48, 53, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1c50 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1c60 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 78, 50, 66, 70,
-/* 0x1c70 */  65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1c80 */  48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1c90 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 53, 53,
-/* 0x1ca0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1cb0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 78,
-/* 0x1cc0 */  50, 66, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1cd0 */  48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1ce0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1cf0 */  48, 53, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1d00 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1d10 */  56, 32, 78, 50, 66, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1d30 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1d40 */  48, 48, 48, 48, 54, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1d50 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1d60 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 78, 50, 66, 70,
-/* 0x1d70 */  65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1d80 */  48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1d90 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 54, 98,
-/* 0x1da0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1db0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1dc0 */  89, 10, 32, 49, 48, 32, 78, 50, 66, 68, 69, 67, 50, 48, 32, 32,
-/* 0x1dd0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48,
-/* 0x1de0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1df0 */  32, 32, 48, 48, 48, 48, 48, 48, 55, 52, 32, 32, 50, 42, 42, 48,
-/* 0x1e00 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x1e10 */  79, 78, 76, 89, 10, 32, 49, 49, 32, 78, 50, 66, 83, 77, 65, 51,
-/* 0x1e20 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32,
-/* 0x1e30 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1e40 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 56, 49, 32, 32, 50,
-/* 0x1e50 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1e60 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1e70 */  49, 50, 32, 78, 50, 66, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32,
-/* 0x1e80 */  32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1e90 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1ea0 */  48, 48, 48, 48, 48, 56,101, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1eb0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1ec0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 51, 32, 78, 50, 66,
-/* 0x1ed0 */  68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1ee0 */  48, 51,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1ef0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 57,
-/* 0x1f00 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1f10 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1f20 */  76, 89, 10, 32, 49, 52, 32, 78, 50, 66, 83, 77, 65, 52, 48, 32,
-/* 0x1f30 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48,
-/* 0x1f40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f50 */  48, 32, 32, 48, 48, 48, 48, 48, 48,100, 98, 32, 32, 50, 42, 42,
-/* 0x1f60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1f70 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 53,
-/* 0x1f80 */  32, 78, 50, 66, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1f90 */  48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fa0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1fb0 */  48, 48, 48,101, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1fc0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1fd0 */  65, 68, 79, 78, 76, 89, 10, 32, 49, 54, 32, 78, 50, 66, 83, 77,
-/* 0x1fe0 */  65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ff0 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2000 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,102, 55, 32,
-/* 0x2010 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2020 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 55, 32, 78, 50,
-/* 0x2030 */  66, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2040 */  48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2050 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2060 */ 102, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2070 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 56,
-/* 0x2080 */  32, 78, 50, 66, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2090 */  48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20a0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x20b0 */  48, 48, 48,102, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x20c0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x20d0 */  32, 49, 57, 32, 78, 50, 66, 83, 77, 65, 54, 48, 32, 32, 32, 32,
-/* 0x20e0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32, 32, 48, 48, 48, 48,
-/* 0x20f0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2100 */  48, 48, 48, 48, 48, 49, 48, 53, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2110 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x2120 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 48, 32, 78, 50,
-/* 0x2130 */  66, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2140 */  48, 48, 49, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2150 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x2160 */  49, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2170 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2180 */  78, 76, 89, 10, 32, 50, 49, 32, 78, 50, 66, 70, 65, 83, 54, 49,
-/* 0x2190 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 54, 32, 32,
-/* 0x21a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x21b0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 50, 97, 32, 32, 50, 42,
-/* 0x21c0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x21d0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50,
-/* 0x21e0 */  50, 32, 78, 50, 66, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32,
-/* 0x21f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2200 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2210 */  48, 48, 48, 49, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2220 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2230 */  10, 32, 50, 51, 32, 78, 50, 68, 83, 77, 65, 49, 48, 32, 32, 32,
-/* 0x2240 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48,
-/* 0x2250 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2260 */  32, 48, 48, 48, 48, 48, 49, 52, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2270 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x2280 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 52, 32, 78,
-/* 0x2290 */  50, 68, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x22a0 */  48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x22b0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x22c0 */  49, 52, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x22d0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x22e0 */  79, 78, 76, 89, 10, 32, 50, 53, 32, 78, 50, 68, 70, 65, 83, 49,
-/* 0x22f0 */  49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32,
-/* 0x2300 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2310 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 52, 53, 32, 32, 50,
-/* 0x2320 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2330 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 54, 32, 78, 50, 68, 68,
-/* 0x2340 */  69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2350 */  48, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2360 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 52, 98,
-/* 0x2370 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2380 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 55, 32, 78,
-/* 0x2390 */  50, 68, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x23a0 */  48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x23b0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x23c0 */  49, 53, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x23d0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x23e0 */  79, 78, 76, 89, 10, 32, 50, 56, 32, 78, 50, 68, 70, 65, 83, 50,
-/* 0x23f0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32,
-/* 0x2400 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2410 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 53, 98, 32, 32, 50,
-/* 0x2420 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2430 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2440 */  50, 57, 32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32,
-/* 0x2450 */  32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2460 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2470 */  48, 48, 48, 48, 49, 54, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2480 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2490 */  89, 10, 32, 51, 48, 32, 78, 50, 68, 83, 77, 65, 51, 48, 32, 32,
-/* 0x24a0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48,
-/* 0x24b0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24c0 */  32, 32, 48, 48, 48, 48, 48, 49, 55, 49, 32, 32, 50, 42, 42, 48,
-/* 0x24d0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x24e0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 49, 32,
-/* 0x24f0 */  78, 50, 68, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2500 */  48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2510 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2520 */  48, 49, 55,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2530 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2540 */  68, 79, 78, 76, 89, 10, 32, 51, 50, 32, 78, 50, 68, 68, 69, 67,
-/* 0x2550 */  51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 53, 50,
-/* 0x2560 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2570 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 56,100, 32, 32,
-/* 0x2580 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2590 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x25a0 */  32, 51, 51, 32, 78, 50, 68, 83, 77, 65, 52, 48, 32, 32, 32, 32,
-/* 0x25b0 */  32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48,
-/* 0x25c0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x25d0 */  48, 48, 48, 48, 48, 49,100,102, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x25e0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x25f0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 52, 32, 78, 50,
-/* 0x2600 */  68, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2610 */  48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2620 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x2630 */ 101, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2640 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2650 */  78, 76, 89, 10, 32, 51, 53, 32, 78, 50, 68, 83, 77, 65, 53, 48,
-/* 0x2660 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x2670 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2680 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49,102, 98, 32, 32, 50, 42,
-/* 0x2690 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x26a0 */  65, 68, 79, 78, 76, 89, 10, 32, 51, 54, 32, 78, 50, 68, 70, 65,
-/* 0x26b0 */  83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26c0 */  51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x26d0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,102,100, 32,
-/* 0x26e0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x26f0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 55, 32, 78, 50,
-/* 0x2700 */  68, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2710 */  48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2720 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,
-/* 0x2730 */  48, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2740 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 56,
-/* 0x2750 */  32, 78, 50, 68, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2760 */  48, 48, 48, 48, 48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2770 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2780 */  48, 48, 50, 48, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2790 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x27a0 */  65, 68, 79, 78, 76, 89, 10, 32, 51, 57, 32, 78, 50, 68, 70, 65,
-/* 0x27b0 */  83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49,
-/* 0x27c0 */  57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x27d0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 49, 53, 32,
-/* 0x27e0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x27f0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2800 */  10, 32, 52, 48, 32, 78, 50, 68, 70, 65, 83, 54, 49, 32, 32, 32,
-/* 0x2810 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48,
-/* 0x2820 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2830 */  32, 48, 48, 48, 48, 48, 50, 50,101, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2840 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x2850 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 49, 32, 78,
-/* 0x2860 */  50, 68, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2870 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2880 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2890 */  50, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x28a0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52,
-/* 0x28b0 */  50, 32, 78, 50, 69, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32,
-/* 0x28c0 */  48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x28d0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x28e0 */  48, 48, 48, 50, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x28f0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2900 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 51, 32, 78, 50, 69, 70,
-/* 0x2910 */  65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2920 */  48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2930 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 52, 55,
-/* 0x2940 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2950 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2960 */  89, 10, 32, 52, 52, 32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 32,
-/* 0x2970 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48,
-/* 0x2980 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2990 */  32, 32, 48, 48, 48, 48, 48, 50, 52, 57, 32, 32, 50, 42, 42, 48,
-/* 0x29a0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x29b0 */  79, 78, 76, 89, 10, 32, 52, 53, 32, 78, 50, 69, 68, 69, 67, 49,
-/* 0x29c0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32,
-/* 0x29d0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x29e0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 52,102, 32, 32, 50,
-/* 0x29f0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2a00 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 54, 32, 78, 50, 69, 83,
-/* 0x2a10 */  77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2a20 */  48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2a30 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 53, 97,
-/* 0x2a40 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2a50 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2a60 */  89, 10, 32, 52, 55, 32, 78, 50, 69, 70, 65, 83, 50, 48, 32, 32,
-/* 0x2a70 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48,
-/* 0x2a80 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a90 */  32, 32, 48, 48, 48, 48, 48, 50, 53,102, 32, 32, 50, 42, 42, 48,
-/* 0x2aa0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2ab0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 56, 32,
-/* 0x2ac0 */  78, 50, 69, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2ad0 */  48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ae0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2af0 */  48, 50, 54, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2b00 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2b10 */  52, 57, 32, 78, 50, 69, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32,
-/* 0x2b20 */  32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2b30 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2b40 */  48, 48, 48, 48, 50, 55, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2b50 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2b60 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 48, 32, 78, 50, 69,
-/* 0x2b70 */  70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2b80 */  48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2b90 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 56,
-/* 0x2ba0 */  50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2bb0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2bc0 */  76, 89, 10, 32, 53, 49, 32, 78, 50, 69, 68, 69, 67, 51, 48, 32,
-/* 0x2bd0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 53,102, 32, 32, 48,
-/* 0x2be0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2bf0 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 57, 49, 32, 32, 50, 42, 42,
-/* 0x2c00 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2c10 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 50,
-/* 0x2c20 */  32, 78, 50, 69, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2c30 */  48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c40 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2c50 */  48, 48, 50,102, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2c60 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x2c70 */  65, 68, 79, 78, 76, 89, 10, 32, 53, 51, 32, 78, 50, 69, 70, 65,
-/* 0x2c80 */  83, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c90 */ 102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2ca0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,102,100, 32,
-/* 0x2cb0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2cc0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2cd0 */  10, 32, 53, 52, 32, 78, 50, 69, 83, 77, 65, 53, 48, 32, 32, 32,
-/* 0x2ce0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48,
-/* 0x2cf0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2d00 */  32, 48, 48, 48, 48, 48, 51, 48, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2d10 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2d20 */  78, 76, 89, 10, 32, 53, 53, 32, 78, 50, 69, 70, 65, 83, 53, 48,
-/* 0x2d30 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32,
-/* 0x2d40 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2d50 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 48,101, 32, 32, 50, 42,
-/* 0x2d60 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2d70 */  65, 68, 79, 78, 76, 89, 10, 32, 53, 54, 32, 78, 50, 69, 68, 69,
-/* 0x2d80 */  67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2d90 */  57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2da0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 49, 49, 32,
-/* 0x2db0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2dc0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 55, 32, 78, 50,
-/* 0x2dd0 */  69, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2de0 */  48, 48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2df0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,
-/* 0x2e00 */  49, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2e10 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2e20 */  78, 76, 89, 10, 32, 53, 56, 32, 78, 50, 69, 70, 65, 83, 54, 48,
-/* 0x2e30 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 57, 32, 32,
-/* 0x2e40 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2e50 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 50, 54, 32, 32, 50, 42,
-/* 0x2e60 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2e70 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53,
-/* 0x2e80 */  57, 32, 78, 50, 69, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32,
-/* 0x2e90 */  48, 48, 48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2ea0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2eb0 */  48, 48, 48, 51, 51,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2ec0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2ed0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 48, 32, 78, 50, 69, 68,
-/* 0x2ee0 */  69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2ef0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2f00 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 53, 53,
-/* 0x2f10 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2f20 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 49, 32, 76,
-/* 0x2f30 */  90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2f40 */  48, 48, 48, 50,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2f50 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2f60 */  51, 53, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2f70 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2f80 */  79, 78, 76, 89, 10, 32, 54, 50, 32, 76, 90, 77, 65, 95, 69, 76,
-/* 0x2f90 */  70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32,
-/* 0x2fa0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2fb0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 56, 51, 32, 32, 50,
-/* 0x2fc0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2fd0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 51, 32, 76, 90, 77, 65,
-/* 0x2fe0 */  95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97,
-/* 0x2ff0 */  56, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3000 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 99, 98,
-/* 0x3010 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3020 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 52, 32, 76,
-/* 0x3030 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48,
-/* 0x3040 */  48, 48, 97, 56, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3050 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3060 */ 101, 53, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3070 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54,
-/* 0x3080 */  53, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32,
-/* 0x3090 */  48, 48, 48, 48, 48, 48, 49, 97, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x30a0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x30b0 */  48, 48, 49, 56,100, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x30c0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x30d0 */  10, 32, 54, 54, 32, 76, 88, 67, 75, 76, 76, 84, 57, 32, 32, 32,
-/* 0x30e0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48,
-/* 0x30f0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3100 */  32, 48, 48, 48, 48, 49, 56,102, 49, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3110 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x3120 */  78, 76, 89, 10, 32, 54, 55, 32, 99,116,111,107, 51, 50, 46, 48,
-/* 0x3130 */  48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 55, 32, 32,
-/* 0x3140 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3150 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 56,102, 52, 32, 32, 50, 42,
-/* 0x3160 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3170 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54,
-/* 0x3180 */  56, 32, 99,116,111,107, 51, 50, 46, 49, 48, 32, 32, 32, 32, 32,
-/* 0x3190 */  48, 48, 48, 48, 48, 48, 48,101, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x31a0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x31b0 */  48, 48, 49, 56,102, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x31c0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x31d0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 57, 32, 99,116,111,107,
-/* 0x31e0 */  51, 50, 46, 50, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x31f0 */  50, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3200 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 48, 57,
-/* 0x3210 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3220 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x3230 */  89, 10, 32, 55, 48, 32, 99,116,111,107, 51, 50, 46, 51, 48, 32,
-/* 0x3240 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 97, 32, 32, 48, 48,
-/* 0x3250 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3260 */  32, 32, 48, 48, 48, 48, 49, 57, 50, 57, 32, 32, 50, 42, 42, 48,
-/* 0x3270 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x3280 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 49, 32,
-/* 0x3290 */  99,116,111,107, 51, 50, 46, 52, 48, 32, 32, 32, 32, 32, 48, 48,
-/* 0x32a0 */  48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32b0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x32c0 */  49, 57, 51, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x32d0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x32e0 */  68, 79, 78, 76, 89, 10, 32, 55, 50, 32, 76, 88, 67, 65, 76, 76,
-/* 0x32f0 */  84, 57, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x3300 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3310 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 51, 56, 32, 32,
-/* 0x3320 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3330 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 51, 32, 67, 65, 76,
-/* 0x3340 */  76, 84, 82, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3350 */  48, 48,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3360 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 51,
-/* 0x3370 */  97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3380 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3390 */  76, 89, 10, 32, 55, 52, 32, 67, 84, 67, 76, 69, 86, 69, 49, 32,
-/* 0x33a0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x33b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33c0 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 52, 56, 32, 32, 50, 42, 42,
-/* 0x33d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x33e0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 53,
-/* 0x33f0 */  32, 67, 65, 76, 76, 84, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3400 */  48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3410 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3420 */  48, 49, 57, 52,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3430 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3440 */  32, 55, 54, 32, 67, 84, 66, 83, 72, 82, 48, 49, 32, 32, 32, 32,
-/* 0x3450 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48,
-/* 0x3460 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3470 */  48, 48, 48, 48, 49, 57, 53, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3480 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3490 */  76, 89, 10, 32, 55, 55, 32, 67, 84, 66, 82, 79, 82, 48, 49, 32,
-/* 0x34a0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x34b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x34c0 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 53, 54, 32, 32, 50, 42, 42,
-/* 0x34d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x34e0 */  68, 79, 78, 76, 89, 10, 32, 55, 56, 32, 67, 84, 66, 83, 87, 65,
-/* 0x34f0 */  48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x3500 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3510 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 53, 56, 32, 32,
-/* 0x3520 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3530 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 57, 32, 67, 65, 76,
-/* 0x3540 */  76, 84, 82, 48, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3550 */  48, 48,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3560 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 53,
-/* 0x3570 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3580 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3590 */  76, 89, 10, 32, 56, 48, 32, 67, 65, 76, 76, 84, 82, 49, 48, 32,
-/* 0x35a0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x35b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x35c0 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 54, 98, 32, 32, 50, 42, 42,
-/* 0x35d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x35e0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 49,
-/* 0x35f0 */  32, 67, 65, 76, 76, 84, 82, 69, 56, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3600 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3610 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3620 */  48, 49, 57, 55, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3630 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3640 */  32, 56, 50, 32, 67, 65, 76, 76, 84, 82, 69, 57, 32, 32, 32, 32,
-/* 0x3650 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x3660 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3670 */  48, 48, 48, 48, 49, 57, 55, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3680 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3690 */  76, 89, 10, 32, 56, 51, 32, 67, 65, 76, 76, 84, 82, 49, 49, 32,
-/* 0x36a0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48,
-/* 0x36b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36c0 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 55, 52, 32, 32, 50, 42, 42,
-/* 0x36d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x36e0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 52,
-/* 0x36f0 */  32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3700 */  48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3710 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3720 */  48, 49, 57, 55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3730 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x3740 */  65, 68, 79, 78, 76, 89, 10, 32, 56, 53, 32, 67, 65, 76, 76, 84,
-/* 0x3750 */  82, 49, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3760 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3770 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 55,100, 32,
-/* 0x3780 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3790 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 54, 32, 67, 84,
-/* 0x37a0 */  66, 83, 72, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x37b0 */  48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x37c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x37d0 */  55,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x37e0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 55,
-/* 0x37f0 */  32, 67, 84, 66, 82, 79, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3800 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3810 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3820 */  48, 49, 57, 56, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3830 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3840 */  32, 56, 56, 32, 67, 84, 66, 83, 87, 65, 49, 49, 32, 32, 32, 32,
-/* 0x3850 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48,
-/* 0x3860 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3870 */  48, 48, 48, 48, 49, 57, 56, 53, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3880 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3890 */  76, 89, 10, 32, 56, 57, 32, 67, 65, 76, 76, 84, 82, 49, 51, 32,
-/* 0x38a0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x38b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x38c0 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 56, 97, 32, 32, 50, 42, 42,
-/* 0x38d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x38e0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 48,
-/* 0x38f0 */  32, 76, 73, 78, 85, 88, 57, 57, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3900 */  48, 48, 48, 48, 48, 51, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3910 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3920 */  48, 49, 57, 56,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3930 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3940 */  32, 57, 49, 32, 76, 73, 78, 85, 88, 57, 57, 49, 32, 32, 32, 32,
-/* 0x3950 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48,
-/* 0x3960 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3970 */  48, 48, 48, 48, 49, 57, 99, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3980 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3990 */  76, 89, 10, 32, 57, 50, 32, 76, 73, 78, 85, 88, 57, 57, 50, 32,
-/* 0x39a0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x39b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x39c0 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 99, 57, 32, 32, 50, 42, 42,
-/* 0x39d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x39e0 */  68, 79, 78, 76, 89, 10, 32, 57, 51, 32, 85, 80, 88, 49, 72, 69,
-/* 0x39f0 */  65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 48,
-/* 0x3a00 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3a10 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 99, 98, 32, 32,
-/* 0x3a20 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3a30 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32,
-/* 0x3a40 */  84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3a50 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 49, 48,
-/* 0x3a60 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65,
-/* 0x3a70 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3a80 */  32,100, 32, 32, 78, 50, 66, 70, 65, 83, 49, 49,  9, 48, 48, 48,
-/* 0x3a90 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 48,
-/* 0x3aa0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3ab0 */  78, 50, 66, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ac0 */  48, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3ad0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68,
-/* 0x3ae0 */  69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x3af0 */  66, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3b00 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48,
-/* 0x3b10 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67,
-/* 0x3b20 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3b30 */  32,100, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48,  9, 48, 48, 48,
-/* 0x3b40 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 48,
-/* 0x3b50 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3b60 */  78, 50, 66, 70, 65, 83, 54, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b70 */  48, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48,
-/* 0x3b80 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68,
-/* 0x3b90 */  69, 67, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x3ba0 */  66, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3bb0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48,
-/* 0x3bc0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65,
-/* 0x3bd0 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3be0 */  32,100, 32, 32, 78, 50, 68, 70, 65, 83, 49, 49,  9, 48, 48, 48,
-/* 0x3bf0 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 48,
-/* 0x3c00 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3c10 */  78, 50, 68, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c20 */  48, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3c30 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68,
-/* 0x3c40 */  69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x3c50 */  68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3c60 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x3c70 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67,
-/* 0x3c80 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3c90 */  32,100, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48,  9, 48, 48, 48,
-/* 0x3ca0 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 48,
-/* 0x3cb0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3cc0 */  78, 50, 68, 70, 65, 83, 54, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3cd0 */  48, 32, 78, 50, 68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48,
-/* 0x3ce0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68,
-/* 0x3cf0 */  69, 67, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x3d00 */  68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3d10 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48,
-/* 0x3d20 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65,
-/* 0x3d30 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3d40 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 49, 49,  9, 48, 48, 48,
-/* 0x3d50 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 49, 49, 10, 48,
-/* 0x3d60 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3d70 */  78, 50, 69, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d80 */  48, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3d90 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68,
-/* 0x3da0 */  69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x3db0 */  69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3dc0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x3dd0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67,
-/* 0x3de0 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3df0 */  32,100, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48,  9, 48, 48, 48,
-/* 0x3e00 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48,
-/* 0x3e10 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3e20 */  78, 50, 69, 70, 65, 83, 54, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e30 */  48, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48,
-/* 0x3e40 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68,
-/* 0x3e50 */  69, 67, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x3e60 */  69, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3e70 */ 108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 48,
-/* 0x3e80 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51,
-/* 0x3e90 */  50, 46, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3ea0 */  32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48,  9,
-/* 0x3eb0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46,
-/* 0x3ec0 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3ed0 */  32,100, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48,  9, 48, 48,
-/* 0x3ee0 */  48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 50, 48,
-/* 0x3ef0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3f00 */  32, 32, 99,116,111,107, 51, 50, 46, 52, 48,  9, 48, 48, 48, 48,
-/* 0x3f10 */  48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48,
-/* 0x3f20 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3f30 */  67, 65, 76, 76, 84, 82, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f40 */  48, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3f50 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76,
-/* 0x3f60 */  84, 82, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65,
-/* 0x3f70 */  76, 76, 84, 82, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3f80 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49,
-/* 0x3f90 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x3fa0 */  49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3fb0 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51,  9, 48, 48, 48,
-/* 0x3fc0 */  48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 49, 51, 10, 48,
-/* 0x3fd0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3fe0 */  76, 73, 78, 85, 88, 57, 57, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ff0 */  48, 32, 76, 73, 78, 85, 88, 57, 57, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4000 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85,
-/* 0x4010 */  88, 48, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 73,
-/* 0x4020 */  78, 85, 88, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4030 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 84, 49,
-/* 0x4040 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 65, 76, 76,
-/* 0x4050 */  84, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4060 */  32,100, 32, 32, 76, 88, 67, 75, 76, 76, 84, 49,  9, 48, 48, 48,
-/* 0x4070 */  48, 48, 48, 48, 48, 32, 76, 88, 67, 75, 76, 76, 84, 49, 10, 48,
-/* 0x4080 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4090 */  76, 88, 77, 79, 86, 69, 85, 80,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x40a0 */  48, 32, 76, 88, 77, 79, 86, 69, 85, 80, 10, 48, 48, 48, 48, 48,
-/* 0x40b0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x40c0 */  65, 83, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x40d0 */  66, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x40e0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 50, 48,
-/* 0x40f0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65,
-/* 0x4100 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4110 */  32,100, 32, 32, 78, 50, 66, 70, 65, 83, 50, 48,  9, 48, 48, 48,
-/* 0x4120 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 50, 48, 10, 48,
-/* 0x4130 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4140 */  78, 50, 66, 83, 77, 65, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4150 */  48, 32, 78, 50, 66, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4160 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x4170 */  65, 83, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4180 */  66, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4190 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 52, 48,
-/* 0x41a0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65,
-/* 0x41b0 */  52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x41c0 */  32,100, 32, 32, 78, 50, 66, 70, 65, 83, 52, 48,  9, 48, 48, 48,
-/* 0x41d0 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 52, 48, 10, 48,
-/* 0x41e0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x41f0 */  78, 50, 66, 83, 77, 65, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4200 */  48, 32, 78, 50, 66, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4210 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x4220 */  65, 83, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4230 */  66, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4240 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 54, 48,
-/* 0x4250 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65,
-/* 0x4260 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4270 */  32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 48,  9, 48, 48, 48,
-/* 0x4280 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 54, 48, 10, 48,
-/* 0x4290 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x42a0 */  78, 50, 68, 70, 65, 83, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x42b0 */  48, 32, 78, 50, 68, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x42c0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83,
-/* 0x42d0 */  77, 65, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x42e0 */  68, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x42f0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 50, 48,
-/* 0x4300 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x4310 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4320 */  32,100, 32, 32, 78, 50, 68, 83, 77, 65, 51, 48,  9, 48, 48, 48,
-/* 0x4330 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 51, 48, 10, 48,
-/* 0x4340 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4350 */  78, 50, 68, 70, 65, 83, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4360 */  48, 32, 78, 50, 68, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4370 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83,
-/* 0x4380 */  77, 65, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4390 */  68, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x43a0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 52, 48,
-/* 0x43b0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x43c0 */  52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x43d0 */  32,100, 32, 32, 78, 50, 68, 83, 77, 65, 53, 48,  9, 48, 48, 48,
-/* 0x43e0 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 53, 48, 10, 48,
-/* 0x43f0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4400 */  78, 50, 68, 70, 65, 83, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4410 */  48, 32, 78, 50, 68, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4420 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83,
-/* 0x4430 */  77, 65, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4440 */  68, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4450 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 48,
-/* 0x4460 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x4470 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4480 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 49, 48,  9, 48, 48, 48,
-/* 0x4490 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 49, 48, 10, 48,
-/* 0x44a0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x44b0 */  78, 50, 69, 83, 77, 65, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x44c0 */  48, 32, 78, 50, 69, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x44d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x44e0 */  65, 83, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x44f0 */  69, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4500 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 51, 48,
-/* 0x4510 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65,
-/* 0x4520 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4530 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 51, 48,  9, 48, 48, 48,
-/* 0x4540 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 51, 48, 10, 48,
-/* 0x4550 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4560 */  78, 50, 69, 83, 77, 65, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4570 */  48, 32, 78, 50, 69, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4580 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x4590 */  65, 83, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x45a0 */  69, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x45b0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 53, 48,
-/* 0x45c0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65,
-/* 0x45d0 */  53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x45e0 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 53, 48,  9, 48, 48, 48,
-/* 0x45f0 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 53, 48, 10, 48,
-/* 0x4600 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4610 */  78, 50, 69, 83, 77, 65, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4620 */  48, 32, 78, 50, 69, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4630 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x4640 */  65, 83, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4650 */  69, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4660 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x4670 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x4680 */  95, 68, 69, 67, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4690 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x46a0 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x46b0 */  95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x46c0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x46d0 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x46e0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x46f0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x4700 */  50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x4710 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4720 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x4730 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x4740 */  95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4750 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 75, 76, 76, 84, 57,
-/* 0x4760 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 75, 76, 76,
-/* 0x4770 */  84, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4780 */  32,100, 32, 32, 99,116,111,107, 51, 50, 46, 51, 48,  9, 48, 48,
-/* 0x4790 */  48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 51, 48,
-/* 0x47a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x47b0 */  32, 32, 76, 88, 67, 65, 76, 76, 84, 57,  9, 48, 48, 48, 48, 48,
-/* 0x47c0 */  48, 48, 48, 32, 76, 88, 67, 65, 76, 76, 84, 57, 10, 48, 48, 48,
-/* 0x47d0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x47e0 */  67, 76, 69, 86, 69, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x47f0 */  67, 84, 67, 76, 69, 86, 69, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4800 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x4810 */  48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76,
-/* 0x4820 */  84, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4830 */  32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72, 82, 48, 49,  9, 48,
-/* 0x4840 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83, 72, 82, 48, 49,
-/* 0x4850 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4860 */  32, 32, 67, 84, 66, 82, 79, 82, 48, 49,  9, 48, 48, 48, 48, 48,
-/* 0x4870 */  48, 48, 48, 32, 67, 84, 66, 82, 79, 82, 48, 49, 10, 48, 48, 48,
-/* 0x4880 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x4890 */  66, 83, 87, 65, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x48a0 */  67, 84, 66, 83, 87, 65, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x48b0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x48c0 */  48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76,
-/* 0x48d0 */  84, 82, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x48e0 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 69, 56,  9, 48,
-/* 0x48f0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 69, 56,
-/* 0x4900 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4910 */  32, 32, 67, 65, 76, 76, 84, 82, 69, 57,  9, 48, 48, 48, 48, 48,
-/* 0x4920 */  48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 69, 57, 10, 48, 48, 48,
-/* 0x4930 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x4940 */  67, 76, 69, 86, 69, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4950 */  67, 84, 67, 76, 69, 86, 69, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4960 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x4970 */  49, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76,
-/* 0x4980 */  84, 82, 49, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4990 */  32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72, 82, 49, 49,  9, 48,
-/* 0x49a0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83, 72, 82, 49, 49,
-/* 0x49b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x49c0 */  32, 32, 67, 84, 66, 82, 79, 82, 49, 49,  9, 48, 48, 48, 48, 48,
-/* 0x49d0 */  48, 48, 48, 32, 67, 84, 66, 82, 79, 82, 49, 49, 10, 48, 48, 48,
-/* 0x49e0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x49f0 */  66, 83, 87, 65, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4a00 */  67, 84, 66, 83, 87, 65, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a10 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85, 88, 57,
-/* 0x4a20 */  57, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 73, 78, 85,
-/* 0x4a30 */  88, 57, 57, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4a40 */  32, 32, 32,100, 32, 32, 76, 73, 78, 85, 88, 57, 57, 50,  9, 48,
-/* 0x4a50 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 73, 78, 85, 88, 57, 57, 50,
-/* 0x4a60 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4a70 */  32, 32, 85, 80, 88, 49, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48,
-/* 0x4a80 */  48, 48, 48, 32, 85, 80, 88, 49, 72, 69, 65, 68, 10, 48, 48, 48,
-/* 0x4a90 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x4aa0 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 78, 84,
-/* 0x4ab0 */  82, 89, 95, 80, 79, 73, 78, 84, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ac0 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x4ad0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 72, 89, 83, 73, 67, 65,
-/* 0x4ae0 */  76, 95, 83, 84, 65, 82, 84, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4af0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48,
-/* 0x4b00 */  48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,101,114, 95, 99,
-/* 0x4b10 */ 116,111, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x4b20 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4b30 */  48, 48, 32,102,105,108,116,101,114, 95,108,101,110,103,116,104,
-/* 0x4b40 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4b50 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4b60 */  32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,
-/* 0x4b70 */ 115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x4b80 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4b90 */  48, 48, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48,
-/* 0x4ba0 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x4bb0 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,
-/* 0x4bc0 */ 109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4bd0 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x4be0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95,112,114,
-/* 0x4bf0 */ 111,112,101,114,116,105,101,115, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4c00 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4c10 */  32, 91, 76, 73, 78, 85, 88, 48, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x4c20 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x4c30 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x4c40 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x4c50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 69, 78, 84, 82, 89, 95, 80,
-/* 0x4c60 */  79, 73, 78, 84, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95,
-/* 0x4c70 */  51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c80 */  80, 72, 89, 83, 73, 67, 65, 76, 95, 83, 84, 65, 82, 84, 10, 10,
-/* 0x4c90 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4ca0 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 75, 76, 76, 84, 49,
-/* 0x4cb0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4cc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4cd0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51,
-/* 0x4ce0 */  56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,
-/* 0x4cf0 */ 105,108,116,101,114, 95, 99,116,111, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4d00 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4d10 */  82, 32, 91, 76, 88, 77, 79, 86, 69, 85, 80, 93, 58, 10, 79, 70,
-/* 0x4d20 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x4d30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x4d40 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x4d50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114,
-/* 0x4d60 */  95,108,101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 54,
-/* 0x4d70 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x4d80 */  32, 32, 32, 76, 73, 78, 85, 88, 57, 57, 48, 10, 10, 82, 69, 76,
-/* 0x4d90 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x4da0 */  70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 49, 48, 93, 58, 10,
-/* 0x4db0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4dc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4dd0 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4de0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x4df0 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4e00 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x4e10 */  66, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4e20 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4e30 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4e40 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x4e50 */  32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x4e60 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x4e70 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 50, 48, 93,
-/* 0x4e80 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x4e90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x4ea0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x4eb0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x4ec0 */  66, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4ed0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x4ee0 */  78, 50, 66, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x4ef0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4f00 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x4f10 */  48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x4f20 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10,
-/* 0x4f30 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x4f40 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 51,
-/* 0x4f50 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x4f60 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x4f70 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95,
-/* 0x4f80 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4f90 */  78, 50, 66, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4fa0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4fb0 */  32, 91, 78, 50, 66, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70,
-/* 0x4fc0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x4fd0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x4fe0 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x4ff0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50,
-/* 0x5000 */  48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54,
-/* 0x5010 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x5020 */  68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5030 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5040 */  50, 66, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5050 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5060 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5070 */  48, 49, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5080 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48,
-/* 0x5090 */  48, 48, 48, 48, 48, 50,102, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x50a0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x50b0 */  53, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x50c0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83,
-/* 0x50d0 */  77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x50e0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x50f0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x5100 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5110 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x5120 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5130 */  70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 52, 48, 93, 58, 10,
-/* 0x5140 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5150 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5160 */  10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5170 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x5180 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95,
-/* 0x5190 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x51a0 */  78, 50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x51b0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x51c0 */  32, 91, 78, 50, 66, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70,
-/* 0x51d0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x51e0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x51f0 */  48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x5200 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49,
-/* 0x5210 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5220 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65,
-/* 0x5230 */  83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5240 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5250 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32,
-/* 0x5260 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5270 */  32, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48,
-/* 0x5280 */  48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x5290 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10,
-/* 0x52a0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x52b0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 49,
-/* 0x52c0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x52d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x52e0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51,
-/* 0x52f0 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5300 */  50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5310 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5320 */  91, 78, 50, 68, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5330 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5340 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5350 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5360 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48,
-/* 0x5370 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5380 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83,
-/* 0x5390 */  49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x53a0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x53b0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x53c0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x53d0 */  32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x53e0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x53f0 */  82, 32, 91, 78, 50, 68, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70,
-/* 0x5400 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5410 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5420 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5430 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 83, 77, 65,
-/* 0x5440 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5450 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70,
-/* 0x5460 */  65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5470 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5480 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x5490 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x54a0 */  32, 32, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76,
-/* 0x54b0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x54c0 */  70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 51, 48, 93, 58, 10,
-/* 0x54d0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x54e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x54f0 */  10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5500 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x5510 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5520 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x5530 */  68, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5540 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5550 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5560 */  48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5570 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48,
-/* 0x5580 */  48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5590 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51,
-/* 0x55a0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x55b0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 68, 69,
-/* 0x55c0 */  67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x55d0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x55e0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32,
-/* 0x55f0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5600 */  32, 32, 78, 50, 68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5610 */  48, 50, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5620 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48,
-/* 0x5630 */  48, 48, 48, 48, 48, 52, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5640 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x5650 */  53, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5660 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83,
-/* 0x5670 */  77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5680 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5690 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x56a0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x56b0 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x56c0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x56d0 */  70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 52, 48, 93, 58, 10,
-/* 0x56e0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x56f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5700 */  10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5710 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x5720 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95,
-/* 0x5730 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5740 */  78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5750 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5760 */  32, 91, 78, 50, 68, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70,
-/* 0x5770 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5780 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5790 */  48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x57a0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49,
-/* 0x57b0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x57c0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65,
-/* 0x57d0 */  83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x57e0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x57f0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32,
-/* 0x5800 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5810 */  32, 32, 78, 50, 68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48,
-/* 0x5820 */  48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x5830 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10,
-/* 0x5840 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5850 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 49,
-/* 0x5860 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5870 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5880 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51,
-/* 0x5890 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x58a0 */  50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x58b0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x58c0 */  91, 78, 50, 69, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x58d0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x58e0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x58f0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5900 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48,
-/* 0x5910 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5920 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83,
-/* 0x5930 */  49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5940 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5950 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x5960 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5970 */  32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5980 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5990 */  82, 32, 91, 78, 50, 69, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70,
-/* 0x59a0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x59b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x59c0 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x59d0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 83, 77, 65,
-/* 0x59e0 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x59f0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70,
-/* 0x5a00 */  65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5a10 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5a20 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x5a30 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5a40 */  32, 32, 32, 78, 50, 69, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76,
-/* 0x5a50 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5a60 */  70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 51, 48, 93, 58, 10,
-/* 0x5a70 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5a80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5a90 */  10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5aa0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x5ab0 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5ac0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x5ad0 */  69, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5ae0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5af0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5b00 */  48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5b10 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48,
-/* 0x5b20 */  48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5b30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51,
-/* 0x5b40 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5b50 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 68, 69,
-/* 0x5b60 */  67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5b70 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5b80 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32,
-/* 0x5b90 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ba0 */  32, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5bb0 */  48, 49,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5bc0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48,
-/* 0x5bd0 */  48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5be0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x5bf0 */  54, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5c00 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83,
-/* 0x5c10 */  77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5c20 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5c30 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x5c40 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5c50 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x5c60 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5c70 */  70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 52, 48, 93, 58, 10,
-/* 0x5c80 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5c90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5ca0 */  10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5cb0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x5cc0 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95,
-/* 0x5cd0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ce0 */  78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5cf0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5d00 */  32, 91, 78, 50, 69, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70,
-/* 0x5d10 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5d20 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5d30 */  48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x5d40 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49,
-/* 0x5d50 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5d60 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65,
-/* 0x5d70 */  83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5d80 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d90 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32,
-/* 0x5da0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5db0 */  32, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48,
-/* 0x5dc0 */  48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x5dd0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10,
-/* 0x5de0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5df0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 49,
-/* 0x5e00 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5e10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5e20 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51,
-/* 0x5e30 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5e40 */  50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5e50 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5e60 */  91, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 93, 58, 10, 79, 70,
-/* 0x5e70 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5e80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5e90 */  48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x5ea0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,115,
-/* 0x5eb0 */ 116, 97, 99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48,
-/* 0x5ec0 */  48, 48, 49, 52, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x5ed0 */  32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,117, 95,108,101,
-/* 0x5ee0 */ 110, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54,
-/* 0x5ef0 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109,
-/* 0x5f00 */  97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 50, 97,
-/* 0x5f10 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f20 */  32, 32, 32,108,122,109, 97, 95,112,114,111,112,101,114,116,105,
-/* 0x5f30 */ 101,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5f40 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107,
-/* 0x5f50 */  51, 50, 46, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5f60 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f70 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5f80 */  51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5f90 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 10, 82,
-/* 0x5fa0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5fb0 */  83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 49, 48,
-/* 0x5fc0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5fd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5fe0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,100, 32, 82, 95, 51,
-/* 0x5ff0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x6000 */ 116,111,107, 51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6010 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6020 */  32, 91, 99,116,111,107, 51, 50, 46, 50, 48, 93, 58, 10, 79, 70,
-/* 0x6030 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6040 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6050 */  48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6060 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50,
-/* 0x6070 */  46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51,
-/* 0x6080 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x6090 */ 116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x60a0 */  48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x60b0 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 10, 82,
-/* 0x60c0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x60d0 */  83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 51, 48,
-/* 0x60e0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x60f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6100 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51,
-/* 0x6110 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x6120 */ 116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6130 */  57, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x6140 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 10, 82,
-/* 0x6150 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6160 */  83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x6170 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6180 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6190 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51,
-/* 0x61a0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x61b0 */ 116,111,107, 51, 50, 46, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x61c0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x61d0 */  32, 91, 67, 65, 76, 76, 84, 82, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x61e0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x61f0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6200 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x6210 */  32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,
-/* 0x6220 */ 108,101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6230 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6240 */  67, 84, 67, 76, 69, 86, 69, 49, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x6250 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6260 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6270 */  48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32,
-/* 0x6280 */  32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,
-/* 0x6290 */ 111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54,
-/* 0x62a0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76,
-/* 0x62b0 */  76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x62c0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67,
-/* 0x62d0 */  65, 76, 76, 84, 82, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x62e0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x62f0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6300 */  48, 48,100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6310 */  32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10,
-/* 0x6320 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6330 */  68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 48,
-/* 0x6340 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6350 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6360 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x6370 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,
-/* 0x6380 */ 105,108,116,101,114, 95,108,101,110,103,116,104, 10, 10, 82, 69,
-/* 0x6390 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x63a0 */  32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 49, 93, 58,
-/* 0x63b0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x63c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x63d0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54,
-/* 0x63e0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76,
-/* 0x63f0 */  76, 84, 82, 49, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6400 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67,
-/* 0x6410 */  84, 67, 76, 69, 86, 69, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6420 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6430 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6440 */  48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32,
-/* 0x6450 */  32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,111,
-/* 0x6460 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6470 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76,
-/* 0x6480 */  84, 82, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6490 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65,
-/* 0x64a0 */  76, 76, 84, 82, 49, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x64b0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x64c0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x64d0 */  48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x64e0 */  32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 48, 10
+/* 0x19e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45, 94,  0,  0,  0,102,
+/* 0x19f0 */   0,  0,  0, 76,  0,  0,  0,239,  3,  0,  0,  0,  0,  0,  0, 14,
+/* 0x1a00 */   0,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,
+/* 0x1a10 */   0,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  3,
+/* 0x1a20 */   0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0, 10,
+/* 0x1a30 */   0,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  3,
+/* 0x1a40 */   0,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  2,
+/* 0x1a50 */   0,  0,  0, 83,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  6,
+/* 0x1a60 */   0,  0,  0, 85,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0, 11,
+/* 0x1a70 */   0,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,  5,
+/* 0x1a80 */   0,  0,  0,102,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,  9,
+/* 0x1a90 */   0,  0,  0,107,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0, 13,
+/* 0x1aa0 */   0,  0,  0,116,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0, 13,
+/* 0x1ab0 */   0,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0, 15,
+/* 0x1ac0 */   0,  0,  0,142,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0, 62,
+/* 0x1ad0 */   0,  0,  0,157,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0, 13,
+/* 0x1ae0 */   0,  0,  0,219,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0, 15,
+/* 0x1af0 */   0,  0,  0,232,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0,  2,
+/* 0x1b00 */   0,  0,  0,247,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0,  3,
+/* 0x1b10 */   0,  0,  0,249,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,  0,  9,
+/* 0x1b20 */   0,  0,  0,252,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,  0, 12,
+/* 0x1b30 */   0,  0,  0,  5,  1,  0,  0,  0,  0,  0,  0,180,  0,  0,  0, 25,
+/* 0x1b40 */   0,  0,  0, 17,  1,  0,  0,  0,  0,  0,  0,189,  0,  0,  0, 22,
+/* 0x1b50 */   0,  0,  0, 42,  1,  0,  0,  0,  0,  0,  0,198,  0,  0,  0,  0,
+/* 0x1b60 */   0,  0,  0, 64,  1,  0,  0,  0,  0,  0,  0,207,  0,  0,  0,  3,
+/* 0x1b70 */   0,  0,  0, 64,  1,  0,  0,  0,  0,  0,  0,216,  0,  0,  0,  2,
+/* 0x1b80 */   0,  0,  0, 67,  1,  0,  0,  0,  0,  0,  0,225,  0,  0,  0,  6,
+/* 0x1b90 */   0,  0,  0, 69,  1,  0,  0,  0,  0,  0,  0,234,  0,  0,  0, 11,
+/* 0x1ba0 */   0,  0,  0, 75,  1,  0,  0,  0,  0,  0,  0,243,  0,  0,  0,  5,
+/* 0x1bb0 */   0,  0,  0, 86,  1,  0,  0,  0,  0,  0,  0,252,  0,  0,  0,  9,
+/* 0x1bc0 */   0,  0,  0, 91,  1,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0, 13,
+/* 0x1bd0 */   0,  0,  0,100,  1,  0,  0,  0,  0,  0,  0, 14,  1,  0,  0, 13,
+/* 0x1be0 */   0,  0,  0,113,  1,  0,  0,  0,  0,  0,  0, 23,  1,  0,  0, 15,
+/* 0x1bf0 */   0,  0,  0,126,  1,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0, 82,
+/* 0x1c00 */   0,  0,  0,141,  1,  0,  0,  0,  0,  0,  0, 41,  1,  0,  0, 13,
+/* 0x1c10 */   0,  0,  0,223,  1,  0,  0,  0,  0,  0,  0, 50,  1,  0,  0, 15,
+/* 0x1c20 */   0,  0,  0,236,  1,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0,  2,
+/* 0x1c30 */   0,  0,  0,251,  1,  0,  0,  0,  0,  0,  0, 68,  1,  0,  0,  3,
+/* 0x1c40 */   0,  0,  0,253,  1,  0,  0,  0,  0,  0,  0, 77,  1,  0,  0,  9,
+/* 0x1c50 */   0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0, 86,  1,  0,  0, 12,
+/* 0x1c60 */   0,  0,  0,  9,  2,  0,  0,  0,  0,  0,  0, 95,  1,  0,  0, 25,
+/* 0x1c70 */   0,  0,  0, 21,  2,  0,  0,  0,  0,  0,  0,104,  1,  0,  0, 22,
+/* 0x1c80 */   0,  0,  0, 46,  2,  0,  0,  0,  0,  0,  0,113,  1,  0,  0,  0,
+/* 0x1c90 */   0,  0,  0, 68,  2,  0,  0,  0,  0,  0,  0,122,  1,  0,  0,  3,
+/* 0x1ca0 */   0,  0,  0, 68,  2,  0,  0,  0,  0,  0,  0,131,  1,  0,  0,  2,
+/* 0x1cb0 */   0,  0,  0, 71,  2,  0,  0,  0,  0,  0,  0,140,  1,  0,  0,  6,
+/* 0x1cc0 */   0,  0,  0, 73,  2,  0,  0,  0,  0,  0,  0,149,  1,  0,  0, 11,
+/* 0x1cd0 */   0,  0,  0, 79,  2,  0,  0,  0,  0,  0,  0,158,  1,  0,  0,  5,
+/* 0x1ce0 */   0,  0,  0, 90,  2,  0,  0,  0,  0,  0,  0,167,  1,  0,  0,  9,
+/* 0x1cf0 */   0,  0,  0, 95,  2,  0,  0,  0,  0,  0,  0,176,  1,  0,  0, 13,
+/* 0x1d00 */   0,  0,  0,104,  2,  0,  0,  0,  0,  0,  0,185,  1,  0,  0, 13,
+/* 0x1d10 */   0,  0,  0,117,  2,  0,  0,  0,  0,  0,  0,194,  1,  0,  0, 15,
+/* 0x1d20 */   0,  0,  0,130,  2,  0,  0,  0,  0,  0,  0,203,  1,  0,  0, 95,
+/* 0x1d30 */   0,  0,  0,145,  2,  0,  0,  0,  0,  0,  0,212,  1,  0,  0, 13,
+/* 0x1d40 */   0,  0,  0,240,  2,  0,  0,  0,  0,  0,  0,221,  1,  0,  0, 15,
+/* 0x1d50 */   0,  0,  0,253,  2,  0,  0,  0,  0,  0,  0,230,  1,  0,  0,  2,
+/* 0x1d60 */   0,  0,  0, 12,  3,  0,  0,  0,  0,  0,  0,239,  1,  0,  0,  3,
+/* 0x1d70 */   0,  0,  0, 14,  3,  0,  0,  0,  0,  0,  0,248,  1,  0,  0,  9,
+/* 0x1d80 */   0,  0,  0, 17,  3,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0, 12,
+/* 0x1d90 */   0,  0,  0, 26,  3,  0,  0,  0,  0,  0,  0, 10,  2,  0,  0, 25,
+/* 0x1da0 */   0,  0,  0, 38,  3,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0, 22,
+/* 0x1db0 */   0,  0,  0, 63,  3,  0,  0,  0,  0,  0,  0, 28,  2,  0,  0,  0,
+/* 0x1dc0 */   0,  0,  0, 85,  3,  0,  0,  0,  0,  0,  0, 37,  2,  0,  0, 46,
+/* 0x1dd0 */   0,  0,  0, 85,  3,  0,  0,  0,  0,  0,  0, 48,  2,  0,  0, 72,
+/* 0x1de0 */   0,  0,  0,131,  3,  0,  0,  0,  0,  0,  0, 59,  2,  0,  0,134,
+/* 0x1df0 */  10,  0,  0,203,  3,  0,  0,  0,  0,  0,  0, 70,  2,  0,  0,134,
+/* 0x1e00 */  10,  0,  0, 81, 14,  0,  0,  0,  0,  0,  0, 81,  2,  0,  0, 26,
+/* 0x1e10 */   0,  0,  0,215, 24,  0,  0,  0,  0,  0,  0, 92,  2,  0,  0,  3,
+/* 0x1e20 */   0,  0,  0,241, 24,  0,  0,  0,  0,  0,  0,101,  2,  0,  0,  7,
+/* 0x1e30 */   0,  0,  0,244, 24,  0,  0,  0,  0,  0,  0,111,  2,  0,  0, 14,
+/* 0x1e40 */   0,  0,  0,251, 24,  0,  0,  0,  0,  0,  0,121,  2,  0,  0, 32,
+/* 0x1e50 */   0,  0,  0,  9, 25,  0,  0,  0,  0,  0,  0,131,  2,  0,  0, 10,
+/* 0x1e60 */   0,  0,  0, 41, 25,  0,  0,  0,  0,  0,  0,141,  2,  0,  0,  5,
+/* 0x1e70 */   0,  0,  0, 51, 25,  0,  0,  0,  0,  0,  0,151,  2,  0,  0,  2,
+/* 0x1e80 */   0,  0,  0, 56, 25,  0,  0,  0,  0,  0,  0,160,  2,  0,  0, 14,
+/* 0x1e90 */   0,  0,  0, 58, 25,  0,  0,  0,  0,  0,  0,169,  2,  0,  0,  5,
+/* 0x1ea0 */   0,  0,  0, 72, 25,  0,  0,  0,  0,  0,  0,178,  2,  0,  0,  5,
+/* 0x1eb0 */   0,  0,  0, 77, 25,  0,  0,  0,  0,  0,  0,187,  2,  0,  0,  4,
+/* 0x1ec0 */   0,  0,  0, 82, 25,  0,  0,  0,  0,  0,  0,196,  2,  0,  0,  2,
+/* 0x1ed0 */   0,  0,  0, 86, 25,  0,  0,  0,  0,  0,  0,205,  2,  0,  0,  5,
+/* 0x1ee0 */   0,  0,  0, 88, 25,  0,  0,  0,  0,  0,  0,214,  2,  0,  0, 14,
+/* 0x1ef0 */   0,  0,  0, 93, 25,  0,  0,  0,  0,  0,  0,223,  2,  0,  0,  5,
+/* 0x1f00 */   0,  0,  0,107, 25,  0,  0,  0,  0,  0,  0,232,  2,  0,  0,  2,
+/* 0x1f10 */   0,  0,  0,112, 25,  0,  0,  0,  0,  0,  0,241,  2,  0,  0,  2,
+/* 0x1f20 */   0,  0,  0,114, 25,  0,  0,  0,  0,  0,  0,250,  2,  0,  0,  4,
+/* 0x1f30 */   0,  0,  0,116, 25,  0,  0,  0,  0,  0,  0,  3,  3,  0,  0,  5,
+/* 0x1f40 */   0,  0,  0,120, 25,  0,  0,  0,  0,  0,  0, 12,  3,  0,  0,  2,
+/* 0x1f50 */   0,  0,  0,125, 25,  0,  0,  0,  0,  0,  0, 21,  3,  0,  0,  4,
+/* 0x1f60 */   0,  0,  0,127, 25,  0,  0,  0,  0,  0,  0, 30,  3,  0,  0,  2,
+/* 0x1f70 */   0,  0,  0,131, 25,  0,  0,  0,  0,  0,  0, 39,  3,  0,  0,  5,
+/* 0x1f80 */   0,  0,  0,133, 25,  0,  0,  0,  0,  0,  0, 48,  3,  0,  0,  5,
+/* 0x1f90 */   0,  0,  0,138, 25,  0,  0,  0,  0,  0,  0, 57,  3,  0,  0, 55,
+/* 0x1fa0 */   0,  0,  0,143, 25,  0,  0,  0,  0,  0,  0, 66,  3,  0,  0,  3,
+/* 0x1fb0 */   0,  0,  0,198, 25,  0,  0,  0,  0,  0,  0, 75,  3,  0,  0,  2,
+/* 0x1fc0 */   0,  0,  0,201, 25,  0,  0,  0,  0,  0,  0, 84,  3,  0,  0, 32,
+/* 0x1fd0 */   0,  0,  0,203, 25,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  4,
+/* 0x1fe0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  6,
+/* 0x1ff0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,  7,
+/* 0x2000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0, 10,
+/* 0x2010 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0, 13,
+/* 0x2020 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,  0, 18,
+/* 0x2030 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0, 21,
+/* 0x2040 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,198,  0,  0,  0, 22,
+/* 0x2050 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,  0, 23,
+/* 0x2060 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0, 25,
+/* 0x2070 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,234,  0,  0,  0, 26,
+/* 0x2080 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0, 29,
+/* 0x2090 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0, 32,
+/* 0x20a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 77,  1,  0,  0, 37,
+/* 0x20b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0, 40,
+/* 0x20c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,113,  1,  0,  0, 41,
+/* 0x20d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,122,  1,  0,  0, 42,
+/* 0x20e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0, 44,
+/* 0x20f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,149,  1,  0,  0, 45,
+/* 0x2100 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,176,  1,  0,  0, 48,
+/* 0x2110 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,  0, 51,
+/* 0x2120 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,248,  1,  0,  0, 56,
+/* 0x2130 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0, 59,
+/* 0x2140 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,  0, 60,
+/* 0x2150 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,101,  2,  0,  0, 67,
+/* 0x2160 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,111,  2,  0,  0, 68,
+/* 0x2170 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,121,  2,  0,  0, 69,
+/* 0x2180 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,141,  2,  0,  0, 71,
+/* 0x2190 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,  2,  0,  0, 73,
+/* 0x21a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,223,  2,  0,  0, 80,
+/* 0x21b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,250,  2,  0,  0, 83,
+/* 0x21c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48,  3,  0,  0, 89,
+/* 0x21d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,  3,  0,  0, 90,
+/* 0x21e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,
+/* 0x2200 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,
+/* 0x2210 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  3,
+/* 0x2220 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  5,
+/* 0x2230 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,  8,
+/* 0x2240 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,  9,
+/* 0x2250 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0, 11,
+/* 0x2260 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0, 12,
+/* 0x2270 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0, 14,
+/* 0x2280 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0, 15,
+/* 0x2290 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0, 16,
+/* 0x22a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0, 17,
+/* 0x22b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,  0, 19,
+/* 0x22c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0, 20,
+/* 0x22d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,216,  0,  0,  0, 24,
+/* 0x22e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,243,  0,  0,  0, 27,
+/* 0x22f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0, 28,
+/* 0x2300 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,  0, 30,
+/* 0x2310 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  1,  0,  0, 31,
+/* 0x2320 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  1,  0,  0, 33,
+/* 0x2330 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  1,  0,  0, 34,
+/* 0x2340 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0, 35,
+/* 0x2350 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 68,  1,  0,  0, 36,
+/* 0x2360 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 86,  1,  0,  0, 38,
+/* 0x2370 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,  0, 39,
+/* 0x2380 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,131,  1,  0,  0, 43,
+/* 0x2390 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0, 46,
+/* 0x23a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0, 47,
+/* 0x23b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,185,  1,  0,  0, 49,
+/* 0x23c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,194,  1,  0,  0, 50,
+/* 0x23d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0, 52,
+/* 0x23e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,  0, 53,
+/* 0x23f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,230,  1,  0,  0, 54,
+/* 0x2400 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,239,  1,  0,  0, 55,
+/* 0x2410 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0, 57,
+/* 0x2420 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  2,  0,  0, 58,
+/* 0x2430 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  2,  0,  0, 61,
+/* 0x2440 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48,  2,  0,  0, 62,
+/* 0x2450 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 59,  2,  0,  0, 63,
+/* 0x2460 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,  2,  0,  0, 64,
+/* 0x2470 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81,  2,  0,  0, 65,
+/* 0x2480 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 92,  2,  0,  0, 66,
+/* 0x2490 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,131,  2,  0,  0, 70,
+/* 0x24a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,151,  2,  0,  0, 72,
+/* 0x24b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,169,  2,  0,  0, 74,
+/* 0x24c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,178,  2,  0,  0, 75,
+/* 0x24d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,187,  2,  0,  0, 76,
+/* 0x24e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,196,  2,  0,  0, 77,
+/* 0x24f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,205,  2,  0,  0, 78,
+/* 0x2500 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,214,  2,  0,  0, 79,
+/* 0x2510 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,232,  2,  0,  0, 81,
+/* 0x2520 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,241,  2,  0,  0, 82,
+/* 0x2530 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  3,  0,  0, 84,
+/* 0x2540 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  3,  0,  0, 85,
+/* 0x2550 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 21,  3,  0,  0, 86,
+/* 0x2560 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  3,  0,  0, 87,
+/* 0x2570 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  3,  0,  0, 88,
+/* 0x2580 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66,  3,  0,  0, 91,
+/* 0x2590 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 75,  3,  0,  0, 92,
+/* 0x25a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 84,  3,  0,  0, 93,
+/* 0x25b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 93,  3,  0,  0, 95,
+/* 0x25c0 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0,105,  3,  0,  0, 95,
+/* 0x25d0 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0,120,  3,  0,  0, 95,
+/* 0x25e0 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0,131,  3,  0,  0, 95,
+/* 0x25f0 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0,145,  3,  0,  0, 95,
+/* 0x2600 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0,163,  3,  0,  0, 95,
+/* 0x2610 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0,174,  3,  0,  0, 95,
+/* 0x2620 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0,185,  3,  0,  0, 95,
+/* 0x2630 */   0,  0,  0,173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,  3,
+/* 0x2640 */   0,  0,  0,201,  3,  0,  0, 94,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2650 */   0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,201,  3,  0,  0, 95,
+/* 0x2660 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  2,
+/* 0x2670 */   0,  0,  0,210,  3,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2680 */   0,  0,  0,  3,  0,  0,  0,  1,  0,  0,  0,201,  3,  0,  0, 97,
+/* 0x2690 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  6,
+/* 0x26a0 */   0,  0,  0,218,  3,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26b0 */   0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,229,  3,  0,  0,  2,
+/* 0x26c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  1,
+/* 0x26d0 */   0,  0,  0,229,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26e0 */   0,  0,  0,  8,  0,  0,  0,  1,  0,  0,  0,229,  3,  0,  0,  0,
+/* 0x26f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  3,
+/* 0x2700 */   0,  0,  0,229,  3,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2710 */   0,  0,  0, 11,  0,  0,  0, 12,  0,  0,  0,229,  3,  0,  0,  3,
+/* 0x2720 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  3,
+/* 0x2730 */   0,  0,  0,229,  3,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2740 */   0,  0,  0, 12,  0,  0,  0, 14,  0,  0,  0,229,  3,  0,  0,  3,
+/* 0x2750 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 17,
+/* 0x2760 */   0,  0,  0,229,  3,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2770 */   0,  0,  0, 13,  0,  0,  0, 47,  0,  0,  0,229,  3,  0,  0,  5,
+/* 0x2780 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0, 12,
+/* 0x2790 */   0,  0,  0,229,  3,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27a0 */   0,  0,  0, 15,  0,  0,  0,  3,  0,  0,  0,229,  3,  0,  0,  4,
+/* 0x27b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0, 14,
+/* 0x27c0 */   0,  0,  0,229,  3,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27d0 */   0,  0,  0, 19,  0,  0,  0,  8,  0,  0,  0,218,  3,  0,  0,  2,
+/* 0x27e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0, 10,
+/* 0x27f0 */   0,  0,  0,229,  3,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2800 */   0,  0,  0, 20,  0,  0,  0, 21,  0,  0,  0,218,  3,  0,  0,  2,
+/* 0x2810 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0, 18,
+/* 0x2820 */   0,  0,  0,218,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2830 */   0,  0,  0, 23,  0,  0,  0,  1,  0,  0,  0,229,  3,  0,  0, 10,
+/* 0x2840 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,  1,
+/* 0x2850 */   0,  0,  0,229,  3,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2860 */   0,  0,  0, 27,  0,  0,  0,  1,  0,  0,  0,229,  3,  0,  0,  8,
+/* 0x2870 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  0,  0,  0,  3,
+/* 0x2880 */   0,  0,  0,229,  3,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2890 */   0,  0,  0, 30,  0,  0,  0, 12,  0,  0,  0,229,  3,  0,  0, 12,
+/* 0x28a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,  5,
+/* 0x28b0 */   0,  0,  0,229,  3,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28c0 */   0,  0,  0, 31,  0,  0,  0, 14,  0,  0,  0,229,  3,  0,  0, 12,
+/* 0x28d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0, 15,
+/* 0x28e0 */   0,  0,  0,229,  3,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28f0 */   0,  0,  0, 32,  0,  0,  0, 33,  0,  0,  0,229,  3,  0,  0, 15,
+/* 0x2900 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0, 67,
+/* 0x2910 */   0,  0,  0,229,  3,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2920 */   0,  0,  0, 33,  0,  0,  0, 12,  0,  0,  0,229,  3,  0,  0, 12,
+/* 0x2930 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,  0,  0,  0,  3,
+/* 0x2940 */   0,  0,  0,229,  3,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2950 */   0,  0,  0, 34,  0,  0,  0, 14,  0,  0,  0,229,  3,  0,  0, 12,
+/* 0x2960 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0,  8,
+/* 0x2970 */   0,  0,  0,218,  3,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2980 */   0,  0,  0, 39,  0,  0,  0, 10,  0,  0,  0,229,  3,  0,  0, 14,
+/* 0x2990 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0, 21,
+/* 0x29a0 */   0,  0,  0,218,  3,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29b0 */   0,  0,  0, 40,  0,  0,  0, 18,  0,  0,  0,218,  3,  0,  0, 10,
+/* 0x29c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,  1,
+/* 0x29d0 */   0,  0,  0,229,  3,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29e0 */   0,  0,  0, 43,  0,  0,  0,  1,  0,  0,  0,229,  3,  0,  0, 18,
+/* 0x29f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  1,
+/* 0x2a00 */   0,  0,  0,229,  3,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a10 */   0,  0,  0, 47,  0,  0,  0,  3,  0,  0,  0,229,  3,  0,  0, 17,
+/* 0x2a20 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0, 12,
+/* 0x2a30 */   0,  0,  0,229,  3,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a40 */   0,  0,  0, 50,  0,  0,  0,  5,  0,  0,  0,229,  3,  0,  0, 20,
+/* 0x2a50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0, 14,
+/* 0x2a60 */   0,  0,  0,229,  3,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a70 */   0,  0,  0, 51,  0,  0,  0, 15,  0,  0,  0,229,  3,  0,  0, 19,
+/* 0x2a80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  0,  0,  0, 30,
+/* 0x2a90 */   0,  0,  0,229,  3,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2aa0 */   0,  0,  0, 51,  0,  0,  0, 48,  0,  0,  0,229,  3,  0,  0, 23,
+/* 0x2ab0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 12,
+/* 0x2ac0 */   0,  0,  0,229,  3,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ad0 */   0,  0,  0, 53,  0,  0,  0,  3,  0,  0,  0,229,  3,  0,  0, 20,
+/* 0x2ae0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,  0,  0,  0, 14,
+/* 0x2af0 */   0,  0,  0,229,  3,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b00 */   0,  0,  0, 57,  0,  0,  0,  8,  0,  0,  0,218,  3,  0,  0, 18,
+/* 0x2b10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0, 10,
+/* 0x2b20 */   0,  0,  0,229,  3,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b30 */   0,  0,  0, 58,  0,  0,  0, 21,  0,  0,  0,218,  3,  0,  0, 18,
+/* 0x2b40 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 59,  0,  0,  0, 18,
+/* 0x2b50 */   0,  0,  0,218,  3,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b60 */   0,  0,  0, 61,  0,  0,  0,  5,  0,  0,  0,201,  3,  0,  0, 98,
+/* 0x2b70 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 61,  0,  0,  0, 20,
+/* 0x2b80 */   0,  0,  0,201,  3,  0,  0, 99,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b90 */   0,  0,  0, 61,  0,  0,  0, 30,  0,  0,  0,201,  3,  0,  0,100,
+/* 0x2ba0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 61,  0,  0,  0, 42,
+/* 0x2bb0 */   0,  0,  0,201,  3,  0,  0,101,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bc0 */   0,  0,  0, 67,  0,  0,  0,  3,  0,  0,  0,229,  3,  0,  0, 26,
+/* 0x2bd0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 68,  0,  0,  0, 13,
+/* 0x2be0 */   0,  0,  0,229,  3,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bf0 */   0,  0,  0, 69,  0,  0,  0,  5,  0,  0,  0,229,  3,  0,  0, 27,
+/* 0x2c00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0, 10,
+/* 0x2c10 */   0,  0,  0,229,  3,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c20 */   0,  0,  0, 69,  0,  0,  0, 16,  0,  0,  0,229,  3,  0,  0, 27,
+/* 0x2c30 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,  4,
+/* 0x2c40 */   0,  0,  0,229,  3,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c50 */   0,  0,  0, 70,  0,  0,  0,  9,  0,  0,  0,229,  3,  0,  0, 25,
+/* 0x2c60 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 71,  0,  0,  0,  4,
+/* 0x2c70 */   0,  0,  0,229,  3,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c80 */   0,  0,  0, 73,  0,  0,  0,  1,  0,  0,  0,201,  3,  0,  0, 97,
+/* 0x2c90 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 74,  0,  0,  0,  2,
+/* 0x2ca0 */   0,  0,  0,210,  3,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cb0 */   0,  0,  0, 74,  0,  0,  0,  4,  0,  0,  0,229,  3,  0,  0, 28,
+/* 0x2cc0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 79,  0,  0,  0, 13,
+/* 0x2cd0 */   0,  0,  0,229,  3,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ce0 */   0,  0,  0, 80,  0,  0,  0,  1,  0,  0,  0,201,  3,  0,  0, 97,
+/* 0x2cf0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 83,  0,  0,  0,  3,
+/* 0x2d00 */   0,  0,  0,229,  3,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d10 */   0,  0,  0, 84,  0,  0,  0,  2,  0,  0,  0,210,  3,  0,  0, 96,
+/* 0x2d20 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 84,  0,  0,  0,  4,
+/* 0x2d30 */   0,  0,  0,229,  3,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d40 */   0,  0,  0, 89,  0,  0,  0,  4,  0,  0,  0,229,  3,  0,  0, 29,
+/* 0x2d50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76, 73, 78, 85, 88,
+/* 0x2d60 */  48, 48, 48,  0, 76, 88, 67, 65, 76, 76, 84, 49,  0, 76, 88, 67,
+/* 0x2d70 */  75, 76, 76, 84, 49,  0, 76, 88, 77, 79, 86, 69, 85, 80,  0, 78,
+/* 0x2d80 */  50, 66, 83, 77, 65, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49, 48,
+/* 0x2d90 */   0, 78, 50, 66, 70, 65, 83, 49, 49,  0, 78, 50, 66, 68, 69, 67,
+/* 0x2da0 */  49, 48,  0, 78, 50, 66, 83, 77, 65, 50, 48,  0, 78, 50, 66, 70,
+/* 0x2db0 */  65, 83, 50, 48,  0, 78, 50, 66, 68, 69, 67, 50, 48,  0, 78, 50,
+/* 0x2dc0 */  66, 83, 77, 65, 51, 48,  0, 78, 50, 66, 70, 65, 83, 51, 48,  0,
+/* 0x2dd0 */  78, 50, 66, 68, 69, 67, 51, 48,  0, 78, 50, 66, 83, 77, 65, 52,
+/* 0x2de0 */  48,  0, 78, 50, 66, 70, 65, 83, 52, 48,  0, 78, 50, 66, 83, 77,
+/* 0x2df0 */  65, 53, 48,  0, 78, 50, 66, 70, 65, 83, 53, 48,  0, 78, 50, 66,
+/* 0x2e00 */  68, 69, 67, 53, 48,  0, 78, 50, 66, 83, 77, 65, 54, 48,  0, 78,
+/* 0x2e10 */  50, 66, 70, 65, 83, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 49,
+/* 0x2e20 */   0, 78, 50, 66, 68, 69, 67, 54, 48,  0, 78, 50, 68, 83, 77, 65,
+/* 0x2e30 */  49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 48,  0, 78, 50, 68, 70,
+/* 0x2e40 */  65, 83, 49, 49,  0, 78, 50, 68, 68, 69, 67, 49, 48,  0, 78, 50,
+/* 0x2e50 */  68, 83, 77, 65, 50, 48,  0, 78, 50, 68, 70, 65, 83, 50, 48,  0,
+/* 0x2e60 */  78, 50, 68, 68, 69, 67, 50, 48,  0, 78, 50, 68, 83, 77, 65, 51,
+/* 0x2e70 */  48,  0, 78, 50, 68, 70, 65, 83, 51, 48,  0, 78, 50, 68, 68, 69,
+/* 0x2e80 */  67, 51, 48,  0, 78, 50, 68, 83, 77, 65, 52, 48,  0, 78, 50, 68,
+/* 0x2e90 */  70, 65, 83, 52, 48,  0, 78, 50, 68, 83, 77, 65, 53, 48,  0, 78,
+/* 0x2ea0 */  50, 68, 70, 65, 83, 53, 48,  0, 78, 50, 68, 68, 69, 67, 53, 48,
+/* 0x2eb0 */   0, 78, 50, 68, 83, 77, 65, 54, 48,  0, 78, 50, 68, 70, 65, 83,
+/* 0x2ec0 */  54, 48,  0, 78, 50, 68, 70, 65, 83, 54, 49,  0, 78, 50, 68, 68,
+/* 0x2ed0 */  69, 67, 54, 48,  0, 78, 50, 69, 83, 77, 65, 49, 48,  0, 78, 50,
+/* 0x2ee0 */  69, 70, 65, 83, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 49,  0,
+/* 0x2ef0 */  78, 50, 69, 68, 69, 67, 49, 48,  0, 78, 50, 69, 83, 77, 65, 50,
+/* 0x2f00 */  48,  0, 78, 50, 69, 70, 65, 83, 50, 48,  0, 78, 50, 69, 68, 69,
+/* 0x2f10 */  67, 50, 48,  0, 78, 50, 69, 83, 77, 65, 51, 48,  0, 78, 50, 69,
+/* 0x2f20 */  70, 65, 83, 51, 48,  0, 78, 50, 69, 68, 69, 67, 51, 48,  0, 78,
+/* 0x2f30 */  50, 69, 83, 77, 65, 52, 48,  0, 78, 50, 69, 70, 65, 83, 52, 48,
+/* 0x2f40 */   0, 78, 50, 69, 83, 77, 65, 53, 48,  0, 78, 50, 69, 70, 65, 83,
+/* 0x2f50 */  53, 48,  0, 78, 50, 69, 68, 69, 67, 53, 48,  0, 78, 50, 69, 83,
+/* 0x2f60 */  77, 65, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 48,  0, 78, 50,
+/* 0x2f70 */  69, 70, 65, 83, 54, 49,  0, 78, 50, 69, 68, 69, 67, 54, 48,  0,
+/* 0x2f80 */  76, 90, 77, 65, 95, 68, 69, 67, 48, 48,  0, 76, 90, 77, 65, 95,
+/* 0x2f90 */  69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
+/* 0x2fa0 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65,
+/* 0x2fb0 */  95, 68, 69, 67, 51, 48,  0, 76, 88, 67, 75, 76, 76, 84, 57,  0,
+/* 0x2fc0 */  99,116,111,107, 51, 50, 46, 48, 48,  0, 99,116,111,107, 51, 50,
+/* 0x2fd0 */  46, 49, 48,  0, 99,116,111,107, 51, 50, 46, 50, 48,  0, 99,116,
+/* 0x2fe0 */ 111,107, 51, 50, 46, 51, 48,  0, 99,116,111,107, 51, 50, 46, 52,
+/* 0x2ff0 */  48,  0, 76, 88, 67, 65, 76, 76, 84, 57,  0, 67, 65, 76, 76, 84,
+/* 0x3000 */  82, 48, 48,  0, 67, 84, 67, 76, 69, 86, 69, 49,  0, 67, 65, 76,
+/* 0x3010 */  76, 84, 82, 48, 49,  0, 67, 84, 66, 83, 72, 82, 48, 49,  0, 67,
+/* 0x3020 */  84, 66, 82, 79, 82, 48, 49,  0, 67, 84, 66, 83, 87, 65, 48, 49,
+/* 0x3030 */   0, 67, 65, 76, 76, 84, 82, 48, 50,  0, 67, 65, 76, 76, 84, 82,
+/* 0x3040 */  49, 48,  0, 67, 65, 76, 76, 84, 82, 69, 56,  0, 67, 65, 76, 76,
+/* 0x3050 */  84, 82, 69, 57,  0, 67, 65, 76, 76, 84, 82, 49, 49,  0, 67, 84,
+/* 0x3060 */  67, 76, 69, 86, 69, 50,  0, 67, 65, 76, 76, 84, 82, 49, 50,  0,
+/* 0x3070 */  67, 84, 66, 83, 72, 82, 49, 49,  0, 67, 84, 66, 82, 79, 82, 49,
+/* 0x3080 */  49,  0, 67, 84, 66, 83, 87, 65, 49, 49,  0, 67, 65, 76, 76, 84,
+/* 0x3090 */  82, 49, 51,  0, 76, 73, 78, 85, 88, 57, 57, 48,  0, 76, 73, 78,
+/* 0x30a0 */  85, 88, 57, 57, 49,  0, 76, 73, 78, 85, 88, 57, 57, 50,  0, 85,
+/* 0x30b0 */  80, 88, 49, 72, 69, 65, 68,  0, 69, 78, 84, 82, 89, 95, 80, 79,
+/* 0x30c0 */  73, 78, 84,  0, 80, 72, 89, 83, 73, 67, 65, 76, 95, 83, 84, 65,
+/* 0x30d0 */  82, 84,  0,102,105,108,116,101,114, 95, 99,116,111,  0,102,105,
+/* 0x30e0 */ 108,116,101,114, 95,108,101,110,103,116,104,  0,108,122,109, 97,
+/* 0x30f0 */  95,115,116, 97, 99,107, 95, 97,100,106,117,115,116,  0,108,122,
+/* 0x3100 */ 109, 97, 95,117, 95,108,101,110,  0,108,122,109, 97, 95, 99, 95,
+/* 0x3110 */ 108,101,110,  0,108,122,109, 97, 95,112,114,111,112,101,114,116,
+/* 0x3120 */ 105,101,115,  0, 82, 95, 51, 56, 54, 95, 51, 50,  0, 82, 95, 51,
+/* 0x3130 */  56, 54, 95, 56,  0, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,  0,
+/* 0x3140 */  82, 95, 51, 56, 54, 95, 80, 67, 56,  0,235, 25,  0,  0, 85, 80,
+/* 0x3150 */  88, 35, 79, 66, 74, 49
 };
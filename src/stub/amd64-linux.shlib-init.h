@@ -1,5 +1,5 @@
 /* amd64-linux.shlib-init.h
-   created from amd64-linux.shlib-init.bin, 9572 (0x2564) bytes
+   created from amd64-linux.shlib-init.bin, 7178 (0x1c0a) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_LINUX_SHLIB_INIT_SIZE    9572
-#define STUB_AMD64_LINUX_SHLIB_INIT_ADLER32 0xed53ee12
-#define STUB_AMD64_LINUX_SHLIB_INIT_CRC32   0x31a6648b
+#define STUB_AMD64_LINUX_SHLIB_INIT_SIZE    7178
+#define STUB_AMD64_LINUX_SHLIB_INIT_ADLER32 0xb5339bfb
+#define STUB_AMD64_LINUX_SHLIB_INIT_CRC32   0x073942ba
 
-unsigned char stub_amd64_linux_shlib_init[9572] = {
+unsigned char stub_amd64_linux_shlib_init[7178] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 62,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,176, 25,  0,  0,  0,  0,  0,  0,
@@ -436,203 +436,53 @@ unsigned char stub_amd64_linux_shlib_init[9572] = {
 /* 0x18d0 */   3,193,233,  2,243,165, 94, 89, 81, 87,131,193,  3,193,233,  2,
 /* 0x18e0 */ 243,165, 72,139,117,168, 72,137,125,168,139, 78,252,243,164, 72,
 /* 0x18f0 */ 139,117,208, 72,137,125,208,139, 78,252,243,164, 72,137,198, 87,
-/* 0x1900 */ 139, 78,252,243,164,195,102,105,108,101, 32,102,111,114,109, 97,
-/* 0x1910 */ 116, 32,101,108,102, 54, 52, 45,120, 56, 54, 45, 54, 52, 10, 10,
-/* 0x1920 */  83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,
-/* 0x1930 */ 109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101,
-/* 0x1940 */  32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1950 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32,
-/* 0x1960 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,
-/* 0x1970 */ 102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10,
-/* 0x1980 */  32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32, 32, 32,
-/* 0x1990 */  32, 32, 48, 48, 48, 48, 48, 48, 49, 57, 32, 32, 48, 48, 48, 48,
-/* 0x19a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x19b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x19c0 */  48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x19d0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x19e0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 78, 82,
-/* 0x19f0 */  86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1a00 */  48, 48, 54, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a10 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a20 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1a30 */  53, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1a40 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50,
-/* 0x1a50 */  32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1a60 */  48, 48, 48, 48, 48, 98, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1a80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1a90 */  48, 48, 48, 98,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1aa0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1ab0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 50, 68,
-/* 0x1ac0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 97,
-/* 0x1ad0 */  49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ae0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1af0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 55, 57, 32,
-/* 0x1b00 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1b10 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1b20 */  10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32,
-/* 0x1b30 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 57, 51, 32, 32, 48, 48, 48,
-/* 0x1b40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1b50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1b60 */  32, 48, 48, 48, 48, 48, 50, 49, 97, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1b70 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x1b80 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 76,
-/* 0x1b90 */  90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1ba0 */  48, 48, 48, 54, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bb0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1bd0 */  50, 97,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1be0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1bf0 */  79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1c00 */  67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57,102, 55, 32,
-/* 0x1c10 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c20 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c30 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 49, 49, 32, 32, 50,
-/* 0x1c40 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1c50 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90, 77, 65,
-/* 0x1c60 */  95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57,
-/* 0x1c70 */ 102, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c80 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c90 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,100, 48, 56,
-/* 0x1ca0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1cb0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 76,
-/* 0x1cc0 */  90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1cd0 */  48, 48, 48, 49, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ce0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cf0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x1d00 */  54,102,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1d10 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1d20 */  57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32,
-/* 0x1d30 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1d40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1d50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1d60 */  48, 48, 49, 55, 49, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1d70 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1d80 */  10, 32, 49, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 32, 32,
-/* 0x1d90 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 51, 97, 32, 32, 48, 48, 48,
-/* 0x1da0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1db0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1dc0 */  32, 48, 48, 48, 48, 49, 55, 49, 55, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1dd0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x1de0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 69,
-/* 0x1df0 */  76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1e00 */  48, 48, 49, 98, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e10 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x1e30 */  55, 53, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1e40 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89,
-/* 0x1e50 */  77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48,
-/* 0x1e60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1e70 */  32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48,
-/* 0x1e80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x1e90 */  82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ea0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1eb0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48,
-/* 0x1ec0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77,
-/* 0x1ed0 */  65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ee0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1ef0 */  32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1f00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65,
-/* 0x1f10 */  73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f20 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70,
-/* 0x1f30 */  77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f40 */  48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x1f50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f60 */  32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x1f70 */  88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f80 */  48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48,
-/* 0x1f90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1fa0 */  32, 32,100, 32, 32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48,
-/* 0x1fb0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50,
-/* 0x1fc0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fd0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,
-/* 0x1fe0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ff0 */  48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2000 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2010 */  32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2020 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x2030 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2040 */  32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x2050 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2060 */  48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48,
-/* 0x2070 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2080 */  32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x2090 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20a0 */  48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x20b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x20c0 */  32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x20d0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20e0 */  48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x20f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2100 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9,
-/* 0x2110 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2120 */  32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2130 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32,
-/* 0x2140 */  32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48,
-/* 0x2150 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 95,115,116,
-/* 0x2160 */  97,114,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x2170 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70,
-/* 0x2180 */  77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x2190 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x21a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x21b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21c0 */ 100, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32,
-/* 0x21d0 */  32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 43, 48,120, 48,
-/* 0x21e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,100, 10,
-/* 0x21f0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x2200 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58,
-/* 0x2210 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2220 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2230 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2240 */  48, 48, 48, 48, 48, 48, 48, 48, 97,102, 32, 82, 95, 88, 56, 54,
-/* 0x2250 */  95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2260 */  95, 72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2270 */  48, 48, 48, 48, 48, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2280 */  48, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 88, 56, 54, 95,
-/* 0x2290 */  54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 76, 70, 77,
-/* 0x22a0 */  65, 73, 78, 89, 43, 48,120,102,102,102,102,102,102,102,102,102,
-/* 0x22b0 */ 102,102,102,102,102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x22c0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x22d0 */  91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x22e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x22f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x2300 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2310 */  57, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x2320 */  32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43, 48,120,
-/* 0x2330 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 49,
-/* 0x2340 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x2350 */  99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32,
-/* 0x2360 */  32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89, 43, 48,120,102,
-/* 0x2370 */ 102,102,102,102,102,102,102,102,102,102,102,102,102,102, 99, 10,
-/* 0x2380 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x2390 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58,
-/* 0x23a0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x23b0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x23c0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x23d0 */  48, 48, 48, 48, 48, 48, 48, 48, 56, 98, 32, 82, 95, 88, 56, 54,
-/* 0x23e0 */  95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x23f0 */  95, 72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2400 */  48, 48, 48, 48, 48, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2410 */  48, 48, 48, 48, 48, 48, 48, 53, 51, 32, 82, 95, 88, 56, 54, 95,
-/* 0x2420 */  54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 76, 70, 77,
-/* 0x2430 */  65, 73, 78, 89, 43, 48,120,102,102,102,102,102,102,102,102,102,
-/* 0x2440 */ 102,102,102,102,102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x2450 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x2460 */  91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70,
-/* 0x2470 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x2480 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2490 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24a0 */  48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52,
-/* 0x24b0 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x24c0 */  69, 67, 51, 48, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24d0 */  48, 48, 48, 48, 48, 49, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x24e0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x24f0 */  91, 69, 76, 70, 77, 65, 73, 78, 89, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2500 */  69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80,
-/* 0x2510 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x2520 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2530 */  48, 48, 48, 49, 56, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80,
-/* 0x2540 */  67, 51, 50, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,
-/* 0x2550 */  43, 48,120,102,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x2560 */ 102,102, 99, 10
+/* 0x1900 */ 139, 78,252,243,164,195, 12,  0,  0,  0, 13,  0,  0,  0,  9,  0,
+/* 0x1910 */   0,  0,128,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0, 64,  0,
+/* 0x1920 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0,102,  0,  0,  0, 89,  0,
+/* 0x1930 */   0,  0,  0,  0,  0,  0, 18,  0,  0,  0,186,  0,  0,  0,191,  0,
+/* 0x1940 */   0,  0,  0,  0,  0,  0, 24,  0,  0,  0,161,  0,  0,  0,121,  1,
+/* 0x1950 */   0,  0,  0,  0,  0,  0, 30,  0,  0,  0,147,  0,  0,  0, 26,  2,
+/* 0x1960 */   0,  0,  0,  0,  0,  0, 36,  0,  0,  0,100,  0,  0,  0,173,  2,
+/* 0x1970 */   0,  0,  0,  0,  0,  0, 47,  0,  0,  0,247,  9,  0,  0, 17,  3,
+/* 0x1980 */   0,  0,  0,  0,  0,  0, 58,  0,  0,  0,247,  9,  0,  0,  8, 13,
+/* 0x1990 */   0,  0,  0,  0,  0,  0, 69,  0,  0,  0, 24,  0,  0,  0,255, 22,
+/* 0x19a0 */   0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0, 23, 23,
+/* 0x19b0 */   0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 58,  0,  0,  0, 23, 23,
+/* 0x19c0 */   0,  0,  0,  0,  0,  0, 98,  0,  0,  0,181,  1,  0,  0, 81, 23,
+/* 0x19d0 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x19e0 */   0,  0,  0,  0,  0,  0, 69,  0,  0,  0,  8,  0,  0,  0,  0,  0,
+/* 0x19f0 */   0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,  0,  0,
+/* 0x1a00 */   0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x1a10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a20 */   0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1a30 */   0,  0,  0,  0,  0,  0, 24,  0,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x1a40 */   0,  0,  0,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1a50 */   0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x1a60 */   0,  0,  0,  0,  0,  0, 47,  0,  0,  0,  6,  0,  0,  0,  0,  0,
+/* 0x1a70 */   0,  0,  0,  0,  0,  0, 58,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x1a80 */   0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x1a90 */   0,  0,  0,  0,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1aa0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,114,  0,
+/* 0x1ab0 */   0,  0,  3,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  2,  0,
+/* 0x1ac0 */   0,  0,175,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0, 33,  0,
+/* 0x1ad0 */   0,  0,  0,  0,  0,  0,  2,  0,  0,  0, 92,  0,  0,  0,114,  0,
+/* 0x1ae0 */   0,  0,  2,  0,  0,  0,252,255,255,255,255,255,255,255,  3,  0,
+/* 0x1af0 */   0,  0,150,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0, 33,  0,
+/* 0x1b00 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 92,  0,  0,  0,114,  0,
+/* 0x1b10 */   0,  0,  2,  0,  0,  0,252,255,255,255,255,255,255,255,  4,  0,
+/* 0x1b20 */   0,  0,139,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0, 33,  0,
+/* 0x1b30 */   0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 83,  0,  0,  0,114,  0,
+/* 0x1b40 */   0,  0,  2,  0,  0,  0,252,255,255,255,255,255,255,255,  5,  0,
+/* 0x1b50 */   0,  0,  6,  0,  0,  0,114,  0,  0,  0,  1,  0,  0,  0, 18,  0,
+/* 0x1b60 */   0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 24,  0,  0,  0,114,  0,
+/* 0x1b70 */   0,  0,  3,  0,  0,  0,252,255,255,255,255,255,255,255, 69, 76,
+/* 0x1b80 */  70, 77, 65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0,
+/* 0x1b90 */  78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50,
+/* 0x1ba0 */  66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77,
+/* 0x1bb0 */  65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x1bc0 */  50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 78, 82,
+/* 0x1bd0 */  86, 95, 84, 65, 73, 76,  0, 69, 76, 70, 77, 65, 73, 78, 89,  0,
+/* 0x1be0 */  69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,  0,
+/* 0x1bf0 */  82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,  0,  6, 25,
+/* 0x1c00 */   0,  0, 85, 80, 88, 35, 79, 66, 74, 49
 };
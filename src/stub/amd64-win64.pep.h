@@ -1,5 +1,5 @@
 /* amd64-win64.pep.h
-   created from amd64-win64.pep.bin, 18665 (0x48e9) bytes
+   created from amd64-win64.pep.bin, 8067 (0x1f83) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_WIN64_PEP_SIZE    18665
-#define STUB_AMD64_WIN64_PEP_ADLER32 0xdba68dba
-#define STUB_AMD64_WIN64_PEP_CRC32   0xd0d78409
+#define STUB_AMD64_WIN64_PEP_SIZE    8067
+#define STUB_AMD64_WIN64_PEP_ADLER32 0x46946afd
+#define STUB_AMD64_WIN64_PEP_CRC32   0xc04b5d98
 
-unsigned char stub_amd64_win64_pep[18665] = {
+unsigned char stub_amd64_win64_pep[8067] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 62,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,200, 17,  0,  0,  0,  0,  0,  0,
@@ -281,926 +281,264 @@ unsigned char stub_amd64_win64_pep[18665] = {
 /* 0x0f20 */  72,173, 72,133,192,116, 20, 81, 82, 65, 80, 72,131,236, 40,255,
 /* 0x0f30 */ 208, 72,131,196, 40, 65, 88, 90, 89,235,229, 94,195, 85, 80, 88,
 /* 0x0f40 */  33,161,216,208,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x0f50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,102,105,108,
-/* 0x0f60 */ 101, 32,102,111,114,109, 97,116, 32,101,108,102, 54, 52, 45,120,
-/* 0x0f70 */  56, 54, 45, 54, 52, 10, 10, 83,101, 99,116,105,111,110,115, 58,
-/* 0x0f80 */  10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32,
-/* 0x0f90 */  32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65,
-/* 0x0fa0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x0fb0 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x0fc0 */  32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32,
-/* 0x0fd0 */  32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 83, 84, 65, 82, 84,
-/* 0x0fe0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x0ff0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1000 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1010 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32,
-/* 0x1020 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1030 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 80, 69,
-/* 0x1040 */  73, 83, 68, 76, 76, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1050 */  48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1060 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1070 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1080 */  52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1090 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50,
-/* 0x10a0 */  32, 80, 69, 73, 83, 69, 70, 73, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x10b0 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x10c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x10d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x10e0 */  48, 48, 48, 52,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x10f0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1100 */  32, 32, 51, 32, 80, 69, 73, 83, 68, 76, 76, 49, 32, 32, 32, 32,
-/* 0x1110 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48,
-/* 0x1120 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1130 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1140 */  48, 48, 48, 48, 48, 48, 53, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1150 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1160 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 80, 69,
-/* 0x1170 */  77, 65, 73, 78, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1180 */  48, 48, 49, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1190 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x11a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x11b0 */  53, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x11c0 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x11d0 */  78, 76, 89, 10, 32, 32, 53, 32, 80, 69, 73, 67, 79, 78, 83, 49,
-/* 0x11e0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 55, 32, 32,
-/* 0x11f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1200 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1210 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 54, 99, 32, 32, 50, 42,
-/* 0x1220 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1230 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1240 */  54, 32, 80, 69, 73, 67, 79, 78, 83, 50, 32, 32, 32, 32, 32, 32,
-/* 0x1250 */  48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1260 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1270 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1280 */  48, 48, 48, 48, 55, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1290 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x12a0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 80, 69, 84, 76,
-/* 0x12b0 */  83, 72, 65, 75, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x12c0 */  49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x12d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x12e0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 55, 99,
-/* 0x12f0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1300 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1310 */  89, 10, 32, 32, 56, 32, 80, 69, 77, 65, 73, 78, 48, 50, 32, 32,
-/* 0x1320 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48,
-/* 0x1330 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1340 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1350 */  32, 32, 48, 48, 48, 48, 48, 48, 56, 99, 32, 32, 50, 42, 42, 48,
-/* 0x1360 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x1370 */  79, 78, 76, 89, 10, 32, 32, 57, 32, 80, 69, 77, 65, 73, 78, 48,
-/* 0x1380 */  51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1390 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x13a0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x13b0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 56,100, 32, 32, 50,
-/* 0x13c0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x13d0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48, 32, 78, 82, 86, 95,
-/* 0x13e0 */  72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x13f0 */  54, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1400 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1410 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 56,100,
-/* 0x1420 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1430 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 78,
-/* 0x1440 */  82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1450 */  48, 48, 48, 56, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1460 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1470 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1480 */  48,101,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1490 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x14a0 */  79, 78, 76, 89, 10, 32, 49, 50, 32, 78, 82, 86, 50, 68, 32, 32,
-/* 0x14b0 */  32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 57, 49, 32,
-/* 0x14c0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x14d0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x14e0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 55, 48, 32, 32, 50,
-/* 0x14f0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1500 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1510 */  49, 51, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1520 */  32, 48, 48, 48, 48, 48, 48, 97, 97, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1530 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1540 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1550 */  48, 48, 48, 48, 50, 48, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1560 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1570 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 52, 32, 76, 90, 77,
-/* 0x1580 */  65, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1590 */  48, 49, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x15a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x15b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 97,
-/* 0x15c0 */  98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x15d0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x15e0 */  76, 89, 10, 32, 49, 53, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x15f0 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 53, 97, 32, 32, 48,
-/* 0x1600 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1610 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1620 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 98,102, 32, 32, 50, 42, 42,
-/* 0x1630 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1640 */  68, 79, 78, 76, 89, 10, 32, 49, 54, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1650 */  69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97, 48, 49,
-/* 0x1660 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1670 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1680 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 49, 57, 32, 32,
-/* 0x1690 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x16a0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 55, 32, 76, 90, 77,
-/* 0x16b0 */  65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x16c0 */  48, 49, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16d0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,100, 49,
-/* 0x16f0 */  97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1700 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 56, 32,
-/* 0x1710 */  76, 90, 77, 65, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1720 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1730 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1740 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1750 */  48,100, 50,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1760 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1770 */  49, 57, 32, 80, 69, 77, 65, 73, 78, 49, 48, 32, 32, 32, 32, 32,
-/* 0x1780 */  32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1790 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x17a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x17b0 */  48, 48, 48, 48,100, 51, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x17c0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x17d0 */  89, 10, 32, 50, 48, 32, 80, 69, 84, 76, 83, 72, 65, 75, 50, 32,
-/* 0x17e0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48,
-/* 0x17f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1800 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1810 */  32, 32, 48, 48, 48, 48, 48,100, 51, 49, 32, 32, 50, 42, 42, 48,
-/* 0x1820 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x1830 */  79, 78, 76, 89, 10, 32, 50, 49, 32, 80, 69, 67, 84, 84, 80, 79,
-/* 0x1840 */  83, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 55, 32,
-/* 0x1850 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1860 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1870 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48,100, 51, 53, 32, 32, 50,
-/* 0x1880 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1890 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x18a0 */  50, 50, 32, 80, 69, 67, 84, 84, 78, 85, 76, 32, 32, 32, 32, 32,
-/* 0x18b0 */  32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48,
-/* 0x18c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x18d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x18e0 */  48, 48, 48, 48,100, 51, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x18f0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1900 */  89, 10, 32, 50, 51, 32, 80, 69, 70, 73, 76, 84, 69, 82, 52, 57,
-/* 0x1910 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 53, 50, 32, 32, 48, 48,
-/* 0x1920 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1930 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1940 */  32, 32, 48, 48, 48, 48, 48,100, 51,102, 32, 32, 50, 42, 42, 48,
-/* 0x1950 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x1960 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 52, 32,
-/* 0x1970 */  80, 69, 73, 77, 80, 79, 82, 84, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1980 */  48, 48, 48, 48, 51, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1990 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x19a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x19b0 */  48,100, 57, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x19c0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x19d0 */  68, 79, 78, 76, 89, 10, 32, 50, 53, 32, 80, 69, 73, 66, 89, 79,
-/* 0x19e0 */  82, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x19f0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a00 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a10 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,100, 99, 53, 32, 32,
-/* 0x1a20 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1a30 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1a40 */  32, 50, 54, 32, 80, 69, 75, 51, 50, 79, 82, 68, 32, 32, 32, 32,
-/* 0x1a50 */  32, 32, 48, 48, 48, 48, 48, 48, 49, 50, 32, 32, 48, 48, 48, 48,
-/* 0x1a60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1a70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1a80 */  48, 48, 48, 48, 48,100, 99, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1a90 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1aa0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 55, 32, 80, 69,
-/* 0x1ab0 */  73, 77, 79, 82, 68, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1ac0 */  48, 48, 48, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ad0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ae0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,100,
-/* 0x1af0 */ 100, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1b00 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1b10 */  78, 76, 89, 10, 32, 50, 56, 32, 80, 69, 73, 77, 80, 79, 82, 50,
-/* 0x1b20 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 49, 32, 32,
-/* 0x1b30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b40 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b50 */  48, 48, 32, 32, 48, 48, 48, 48, 48,100,101, 51, 32, 32, 50, 42,
-/* 0x1b60 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1b70 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50,
-/* 0x1b80 */  57, 32, 80, 69, 73, 69, 82, 68, 76, 76, 32, 32, 32, 32, 32, 32,
-/* 0x1b90 */  48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1ba0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1bb0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1bc0 */  48, 48, 48,101, 48, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1bd0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1be0 */  10, 32, 51, 48, 32, 80, 69, 73, 69, 82, 69, 88, 69, 32, 32, 32,
-/* 0x1bf0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48,
-/* 0x1c00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1c10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1c20 */  32, 48, 48, 48, 48, 48,101, 48,102, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1c30 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x1c40 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 49, 32, 80,
-/* 0x1c50 */  69, 73, 77, 68, 79, 78, 69, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1c60 */  48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c70 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1c90 */ 101, 49, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1ca0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51,
-/* 0x1cb0 */  50, 32, 80, 69, 82, 69, 76, 79, 67, 49, 32, 32, 32, 32, 32, 32,
-/* 0x1cc0 */  48, 48, 48, 48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1cd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1ce0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1cf0 */  48, 48, 48,101, 49, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1d00 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1d10 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 51, 32, 80, 69, 82, 69,
-/* 0x1d20 */  76, 79, 67, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1d30 */  48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d40 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d50 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,101, 50, 48,
-/* 0x1d60 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1d70 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 52, 32, 80,
-/* 0x1d80 */  69, 82, 69, 76, 79, 67, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1d90 */  48, 48, 48, 51, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1da0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1db0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1dc0 */ 101, 50, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1dd0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1de0 */  79, 78, 76, 89, 10, 32, 51, 53, 32, 82, 69, 76, 54, 52, 66, 73,
-/* 0x1df0 */  71, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 97, 32,
-/* 0x1e00 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e10 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e20 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48,101, 53, 52, 32, 32, 50,
-/* 0x1e30 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1e40 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1e50 */  51, 54, 32, 82, 69, 76, 79, 67, 54, 52, 74, 32, 32, 32, 32, 32,
-/* 0x1e60 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1e70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1e80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1e90 */  48, 48, 48, 48,101, 53,101, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1ea0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x1eb0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 55, 32, 80, 69, 82,
-/* 0x1ec0 */  76, 79, 72, 73, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1ed0 */  48, 48, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ee0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ef0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,101, 54,
-/* 0x1f00 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1f10 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1f20 */  76, 89, 10, 32, 51, 56, 32, 80, 69, 82, 69, 76, 76, 79, 48, 32,
-/* 0x1f30 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48,
-/* 0x1f40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1f50 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f60 */  48, 32, 32, 48, 48, 48, 48, 48,101, 54, 97, 32, 32, 50, 42, 42,
-/* 0x1f70 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1f80 */  68, 79, 78, 76, 89, 10, 32, 51, 57, 32, 80, 69, 82, 69, 76, 72,
-/* 0x1f90 */  73, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,101,
-/* 0x1fa0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fb0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,101, 55, 53, 32, 32,
-/* 0x1fd0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1fe0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 48, 32, 80, 69, 68,
-/* 0x1ff0 */  69, 80, 72, 65, 75, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2000 */  48, 52, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2010 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2020 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,101, 56,
-/* 0x2030 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2040 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2050 */  76, 89, 10, 32, 52, 49, 32, 80, 69, 84, 76, 83, 67, 32, 32, 32,
-/* 0x2060 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 98, 32, 32, 48,
-/* 0x2070 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2080 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2090 */  48, 32, 32, 48, 48, 48, 48, 48,101, 99,101, 32, 32, 50, 42, 42,
-/* 0x20a0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x20b0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 50,
-/* 0x20c0 */  32, 80, 69, 77, 65, 73, 78, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x20d0 */  48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x20f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2100 */  48, 48,101,101, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2110 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2120 */  32, 52, 51, 32, 67, 76, 69, 65, 82, 83, 84, 65, 67, 75, 32, 32,
-/* 0x2130 */  32, 32, 48, 48, 48, 48, 48, 48, 49, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2140 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2150 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2160 */  48, 48, 48, 48, 48,101,101,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2170 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2180 */  76, 89, 10, 32, 52, 52, 32, 80, 69, 77, 65, 73, 78, 50, 49, 32,
-/* 0x2190 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x21a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x21b0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21c0 */  48, 32, 32, 48, 48, 48, 48, 48,101,102,100, 32, 32, 50, 42, 42,
-/* 0x21d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x21e0 */  68, 79, 78, 76, 89, 10, 32, 52, 53, 32, 80, 69, 73, 83, 68, 76,
-/* 0x21f0 */  76, 57, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102,
-/* 0x2200 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2210 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2220 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,101,102,100, 32, 32,
-/* 0x2230 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2240 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 54, 32, 80, 69, 73,
-/* 0x2250 */  83, 69, 70, 73, 57, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2260 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2270 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2280 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,102, 48,
-/* 0x2290 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x22a0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 55, 32,
-/* 0x22b0 */  80, 69, 82, 69, 84, 85, 82, 78, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x22c0 */  48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x22e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x22f0 */  48,102, 48,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2300 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2310 */  52, 56, 32, 80, 69, 68, 79, 74, 85, 77, 80, 32, 32, 32, 32, 32,
-/* 0x2320 */  32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2330 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2340 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2350 */  48, 48, 48, 48,102, 49, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2360 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2370 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 57, 32, 80, 69, 84,
-/* 0x2380 */  76, 83, 67, 50, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2390 */  48, 50, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,102, 49,
-/* 0x23c0 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x23d0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x23e0 */  76, 89, 10, 32, 53, 48, 32, 85, 80, 88, 49, 72, 69, 65, 68, 32,
-/* 0x23f0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 48, 32, 32, 48,
-/* 0x2400 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2410 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2420 */  48, 32, 32, 48, 48, 48, 48, 48,102, 51,100, 32, 32, 50, 42, 42,
-/* 0x2430 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x2440 */  68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66,
-/* 0x2450 */  76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2460 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x2470 */  95, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2480 */  48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10,
-/* 0x2490 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24a0 */  32,108, 32, 32, 32, 32, 32, 32, 32, 80, 69, 73, 77, 68, 79, 78,
-/* 0x24b0 */  69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24c0 */  48, 48, 32,105,109,112,111,114,116,115, 95,100,111,110,101, 10,
-/* 0x24d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 98,
-/* 0x24e0 */  32,108, 32, 32, 32, 32, 32, 32, 32, 80, 69, 73, 77, 80, 79, 82,
-/* 0x24f0 */  84,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2500 */  48, 48, 32,110,101,120,116, 95,102,117,110, 99, 10, 48, 48, 48,
-/* 0x2510 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 97, 32,108, 32,
-/* 0x2520 */  32, 32, 32, 32, 32, 32, 80, 69, 73, 77, 79, 82, 68, 49,  9, 48,
-/* 0x2530 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2540 */  98,121,110, 97,109,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2550 */  48, 48, 48, 48, 48, 49, 56, 32,108, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2560 */  80, 69, 73, 77, 80, 79, 82, 50,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2570 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,110,101,120,116, 95,105,
-/* 0x2580 */ 109,112, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2590 */  48, 48, 97, 32,108, 32, 32, 32, 32, 32, 32, 32, 80, 69, 73, 77,
-/* 0x25a0 */  80, 79, 82, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25b0 */  48, 48, 48, 48, 48, 32,102,105,114,115,116, 95,105,109,112, 10,
-/* 0x25c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x25d0 */  32,108, 32, 32, 32, 32, 32, 32, 32, 82, 69, 76, 79, 67, 54, 52,
-/* 0x25e0 */  74,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25f0 */  48, 48, 32,114,101,108,111, 99, 95,101,110,100,120, 10, 48, 48,
-/* 0x2600 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 51, 32,108,
-/* 0x2610 */  32, 32, 32, 32, 32, 32, 32, 80, 69, 82, 69, 76, 79, 67, 51,  9,
-/* 0x2620 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2630 */  32,114,101,108,111, 99, 95, 97,100,100, 10, 48, 48, 48, 48, 48,
-/* 0x2640 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2650 */  32,100, 32, 32, 80, 69, 84, 76, 83, 67, 50,  9, 48, 48, 48, 48,
-/* 0x2660 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 84,
-/* 0x2670 */  76, 83, 67, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2680 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69,
-/* 0x2690 */  77, 65, 73, 78, 50, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26a0 */  48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 77, 65, 73, 78, 50, 49,
-/* 0x26b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 83, 84, 65, 82, 84,  9,
-/* 0x26d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26e0 */  32, 83, 84, 65, 82, 84, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26f0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2700 */  80, 69, 73, 83, 68, 76, 76, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2710 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 73, 83, 68, 76,
-/* 0x2720 */  76, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2730 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 83,
-/* 0x2740 */  69, 70, 73, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2750 */  48, 48, 48, 48, 48, 32, 80, 69, 73, 83, 69, 70, 73, 48, 10, 48,
-/* 0x2760 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2770 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 83, 68, 76, 76, 49,
-/* 0x2780 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2790 */  48, 32, 80, 69, 73, 83, 68, 76, 76, 49, 10, 48, 48, 48, 48, 48,
-/* 0x27a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x27b0 */  32,100, 32, 32, 80, 69, 77, 65, 73, 78, 48, 49,  9, 48, 48, 48,
-/* 0x27c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69,
-/* 0x27d0 */  77, 65, 73, 78, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27e0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x27f0 */  80, 69, 73, 67, 79, 78, 83, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2800 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 73, 67, 79, 78,
-/* 0x2810 */  83, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2820 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 67,
-/* 0x2830 */  79, 78, 83, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2840 */  48, 48, 48, 48, 48, 32, 80, 69, 73, 67, 79, 78, 83, 50, 10, 48,
-/* 0x2850 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2860 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 84, 76, 83, 72, 65, 75,
-/* 0x2870 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2880 */  48, 32, 80, 69, 84, 76, 83, 72, 65, 75, 10, 48, 48, 48, 48, 48,
-/* 0x2890 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x28a0 */  32,100, 32, 32, 80, 69, 77, 65, 73, 78, 48, 50,  9, 48, 48, 48,
-/* 0x28b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69,
-/* 0x28c0 */  77, 65, 73, 78, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28d0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x28e0 */  80, 69, 77, 65, 73, 78, 48, 51,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 77, 65, 73, 78,
-/* 0x2900 */  48, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2910 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x2920 */  66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2930 */  48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2940 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2950 */  32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2960 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x2970 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2980 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69,  9, 48, 48,
-/* 0x2990 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x29a0 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x29b0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x29c0 */  77, 65, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x29d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 72, 69,
-/* 0x29e0 */  65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x29f0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x2a00 */  95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a10 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x2a20 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a30 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x2a40 */  95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a50 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2a60 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a70 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x2a80 */  95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a90 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2aa0 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ab0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x2ac0 */  95, 84, 65, 73, 76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ad0 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 84, 65, 73, 76,
-/* 0x2ae0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2af0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 77, 65, 73, 78,
-/* 0x2b00 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b10 */  48, 48, 48, 32, 80, 69, 77, 65, 73, 78, 49, 48, 10, 48, 48, 48,
-/* 0x2b20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2b30 */  32, 32, 32,100, 32, 32, 80, 69, 84, 76, 83, 72, 65, 75, 50,  9,
-/* 0x2b40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b50 */  32, 80, 69, 84, 76, 83, 72, 65, 75, 50, 10, 48, 48, 48, 48, 48,
-/* 0x2b60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2b70 */  32,100, 32, 32, 80, 69, 67, 84, 84, 80, 79, 83,  9, 48, 48, 48,
-/* 0x2b80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69,
-/* 0x2b90 */  67, 84, 84, 80, 79, 83, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ba0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2bb0 */  80, 69, 67, 84, 84, 78, 85, 76,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2bc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 67, 84, 84, 78,
-/* 0x2bd0 */  85, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2be0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 70, 73,
-/* 0x2bf0 */  76, 84, 69, 82, 52, 57,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c00 */  48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 70, 73, 76, 84, 69, 82,
-/* 0x2c10 */  52, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c20 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 77,
-/* 0x2c30 */  80, 79, 82, 84,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c40 */  48, 48, 48, 48, 48, 32, 80, 69, 73, 77, 80, 79, 82, 84, 10, 48,
-/* 0x2c50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2c60 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 66, 89, 79, 82, 68,
-/* 0x2c70 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c80 */  48, 32, 80, 69, 73, 66, 89, 79, 82, 68, 10, 48, 48, 48, 48, 48,
-/* 0x2c90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2ca0 */  32,100, 32, 32, 80, 69, 75, 51, 50, 79, 82, 68,  9, 48, 48, 48,
-/* 0x2cb0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69,
-/* 0x2cc0 */  75, 51, 50, 79, 82, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2cd0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2ce0 */  80, 69, 73, 77, 79, 82, 68, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2cf0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 73, 77, 79, 82,
-/* 0x2d00 */  68, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2d10 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 77,
-/* 0x2d20 */  80, 79, 82, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2d30 */  48, 48, 48, 48, 48, 32, 80, 69, 73, 77, 80, 79, 82, 50, 10, 48,
-/* 0x2d40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2d50 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 69, 82, 68, 76, 76,
-/* 0x2d60 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2d70 */  48, 32, 80, 69, 73, 69, 82, 68, 76, 76, 10, 48, 48, 48, 48, 48,
-/* 0x2d80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2d90 */  32,100, 32, 32, 80, 69, 73, 69, 82, 69, 88, 69,  9, 48, 48, 48,
-/* 0x2da0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69,
-/* 0x2db0 */  73, 69, 82, 69, 88, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2dc0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2dd0 */  80, 69, 73, 77, 68, 79, 78, 69,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2de0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 73, 77, 68, 79,
-/* 0x2df0 */  78, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2e00 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 82, 69,
-/* 0x2e10 */  76, 79, 67, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2e20 */  48, 48, 48, 48, 48, 32, 80, 69, 82, 69, 76, 79, 67, 49, 10, 48,
-/* 0x2e30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2e40 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 82, 69, 76, 79, 67, 50,
-/* 0x2e50 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2e60 */  48, 32, 80, 69, 82, 69, 76, 79, 67, 50, 10, 48, 48, 48, 48, 48,
-/* 0x2e70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2e80 */  32,100, 32, 32, 80, 69, 82, 69, 76, 79, 67, 51,  9, 48, 48, 48,
-/* 0x2e90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69,
-/* 0x2ea0 */  82, 69, 76, 79, 67, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2eb0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2ec0 */  82, 69, 76, 54, 52, 66, 73, 71,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ed0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 69, 76, 54, 52, 66,
-/* 0x2ee0 */  73, 71, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ef0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 82, 69, 76, 79,
-/* 0x2f00 */  67, 54, 52, 74,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f10 */  48, 48, 48, 48, 48, 32, 82, 69, 76, 79, 67, 54, 52, 74, 10, 48,
-/* 0x2f20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2f30 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 82, 76, 79, 72, 73, 48,
-/* 0x2f40 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f50 */  48, 32, 80, 69, 82, 76, 79, 72, 73, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2f60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2f70 */  32,100, 32, 32, 80, 69, 82, 69, 76, 76, 79, 48,  9, 48, 48, 48,
-/* 0x2f80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69,
-/* 0x2f90 */  82, 69, 76, 76, 79, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2fa0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2fb0 */  80, 69, 82, 69, 76, 72, 73, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2fc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 82, 69, 76, 72,
-/* 0x2fd0 */  73, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2fe0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 68, 69,
-/* 0x2ff0 */  80, 72, 65, 75,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3000 */  48, 48, 48, 48, 48, 32, 80, 69, 68, 69, 80, 72, 65, 75, 10, 48,
-/* 0x3010 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3020 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 84, 76, 83, 67,  9, 48,
-/* 0x3030 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3040 */  80, 69, 84, 76, 83, 67, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3050 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3060 */  80, 69, 77, 65, 73, 78, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3070 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 77, 65, 73, 78,
-/* 0x3080 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3090 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 69, 65,
-/* 0x30a0 */  82, 83, 84, 65, 67, 75,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x30b0 */  48, 48, 48, 48, 48, 48, 48, 32, 67, 76, 69, 65, 82, 83, 84, 65,
-/* 0x30c0 */  67, 75, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x30d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 83,
-/* 0x30e0 */  68, 76, 76, 57,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x30f0 */  48, 48, 48, 48, 48, 32, 80, 69, 73, 83, 68, 76, 76, 57, 10, 48,
-/* 0x3100 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3110 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 83, 69, 70, 73, 57,
-/* 0x3120 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3130 */  48, 32, 80, 69, 73, 83, 69, 70, 73, 57, 10, 48, 48, 48, 48, 48,
-/* 0x3140 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3150 */  32,100, 32, 32, 80, 69, 82, 69, 84, 85, 82, 78,  9, 48, 48, 48,
-/* 0x3160 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69,
-/* 0x3170 */  82, 69, 84, 85, 82, 78, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3180 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3190 */  80, 69, 68, 79, 74, 85, 77, 80,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80, 69, 68, 79, 74, 85,
-/* 0x31b0 */  77, 80, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31c0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 85, 80, 88, 49,
-/* 0x31d0 */  72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31e0 */  48, 48, 48, 48, 48, 32, 85, 80, 88, 49, 72, 69, 65, 68, 10, 48,
-/* 0x31f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3200 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x3210 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,
-/* 0x3220 */ 116, 97,114,116, 95,111,102, 95, 99,111,109,112,114,101,115,115,
-/* 0x3230 */ 101,100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3240 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x3250 */  42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3260 */  48, 48, 32,115,116, 97,114,116, 95,111,102, 95,117,110, 99,111,
-/* 0x3270 */ 109,112,114,101,115,115,101,100, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3280 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3290 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,105, 99,111,110, 95,111,102,
-/* 0x32b0 */ 102,115,101,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32c0 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x32d0 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32e0 */  48, 48, 48, 48, 32,105, 99,111,110, 95,100,101,108,116, 97, 10,
-/* 0x32f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3300 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48,
-/* 0x3310 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3320 */ 116,108,115, 95, 97,100,100,114,101,115,115, 10, 48, 48, 48, 48,
-/* 0x3330 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x3340 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x3350 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,116,108,115, 95,
-/* 0x3360 */ 118, 97,108,117,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3370 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x3380 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3390 */  48, 48, 48, 48, 48, 32,108,122,109, 97, 95,117, 95,108,101,110,
-/* 0x33a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33b0 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x33c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33d0 */  32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48,
-/* 0x33e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x33f0 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x3400 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,
-/* 0x3410 */ 101,114, 95, 98,117,102,102,101,114, 95,115,116, 97,114,116, 10,
-/* 0x3420 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3430 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48,
-/* 0x3440 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3450 */ 102,105,108,116,101,114, 95,108,101,110,103,116,104, 10, 48, 48,
-/* 0x3460 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3470 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48,
-/* 0x3480 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,
-/* 0x3490 */ 108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x34a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x34b0 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x34c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 99,111,109,112,114,101,115,
-/* 0x34d0 */ 115,101,100, 95,105,109,112,111,114,116,115, 10, 48, 48, 48, 48,
-/* 0x34e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x34f0 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x3500 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,116, 97,114,
-/* 0x3510 */ 116, 95,111,102, 95,105,109,112,111,114,116,115, 10, 48, 48, 48,
-/* 0x3520 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x3530 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48,
-/* 0x3540 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,111, 97,
-/* 0x3550 */ 100, 76,105, 98,114, 97,114,121, 65, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3560 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3570 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3580 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,107,101,114,110,101,108,
-/* 0x3590 */  51, 50, 95,111,114,100,105,110, 97,108,115, 10, 48, 48, 48, 48,
-/* 0x35a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x35b0 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x35c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 71,101,116, 80,
-/* 0x35d0 */ 114,111, 99, 65,100,100,114,101,115,115, 10, 48, 48, 48, 48, 48,
-/* 0x35e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x35f0 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x3600 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69,120,105,116, 80,
-/* 0x3610 */ 114,111, 99,101,115,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3620 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3630 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3640 */  48, 48, 48, 48, 48, 48, 32,115,116, 97,114,116, 95,111,102, 95,
-/* 0x3650 */ 114,101,108,111, 99,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3660 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3670 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3680 */  48, 48, 48, 48, 48, 48, 32,114,101,108,111, 99, 95,100,101,108,
-/* 0x3690 */ 116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36a0 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x36b0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36c0 */  48, 32, 86,105,114,116,117, 97,108, 80,114,111,116,101, 99,116,
-/* 0x36d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36e0 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x36f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3700 */  32,118,112, 95, 98, 97,115,101, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3710 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3720 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3730 */  48, 48, 48, 48, 48, 48, 48, 48, 32,118,112, 95,115,105,122,101,
-/* 0x3740 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3750 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x3760 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3770 */  32,115,119,114,105, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3780 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x3790 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x37a0 */  48, 48, 48, 48, 48, 32,116,108,115, 95,109,111,100,117,108,101,
-/* 0x37b0 */  95, 98, 97,115,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x37c0 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x37d0 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x37e0 */  48, 48, 48, 48, 48, 32,111,114,105,103,105,110, 97,108, 95,101,
-/* 0x37f0 */ 110,116,114,121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3800 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x3810 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3820 */  48, 48, 48, 48, 32,116,108,115, 95, 99, 97,108,108, 98, 97, 99,
-/* 0x3830 */ 107,115, 95,112,116,114, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x3840 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x3850 */  80, 69, 73, 83, 68, 76, 76, 49, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x3860 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x3870 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x3880 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3890 */  48, 48, 48, 53, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67,
-/* 0x38a0 */  51, 50, 32, 32, 32, 32, 32, 80, 69, 77, 65, 73, 78, 50, 49, 45,
-/* 0x38b0 */  48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x38c0 */  48, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x38d0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 77, 65,
-/* 0x38e0 */  73, 78, 48, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x38f0 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x3900 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x3910 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 55,
-/* 0x3920 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32,
-/* 0x3930 */  32, 32, 32,115,116, 97,114,116, 95,111,102, 95, 99,111,109,112,
-/* 0x3940 */ 114,101,115,115,101,100, 45, 48,120, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3950 */  48, 48, 48, 48, 48, 48, 48, 48, 52, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3960 */  48, 48, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 88, 56, 54,
-/* 0x3970 */  95, 54, 52, 95, 51, 50, 83, 32, 32, 32, 32, 32, 32,115,116, 97,
-/* 0x3980 */ 114,116, 95,111,102, 95,117,110, 99,111,109,112,114,101,115,115,
-/* 0x3990 */ 101,100, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x39a0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73, 67,
-/* 0x39b0 */  79, 78, 83, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x39c0 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x39d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x39e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x39f0 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32, 32,
-/* 0x3a00 */  32, 32, 32,105, 99,111,110, 95,111,102,102,115,101,116, 10, 10,
-/* 0x3a10 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x3a20 */  68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73, 67, 79, 78, 83, 50,
-/* 0x3a30 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3a40 */  32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3a50 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x3a60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 88,
-/* 0x3a70 */  56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32, 32, 32, 32, 32,105,
-/* 0x3a80 */  99,111,110, 95,111,102,102,115,101,116, 10, 48, 48, 48, 48, 48,
-/* 0x3a90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95, 88, 56,
-/* 0x3aa0 */  54, 95, 54, 52, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32,105, 99,
-/* 0x3ab0 */ 111,110, 95,100,101,108,116, 97, 43, 48,120, 48, 48, 48, 48, 48,
-/* 0x3ac0 */  48, 48, 48, 48, 48, 48, 48, 56, 48, 48, 48, 10, 10, 82, 69, 76,
-/* 0x3ad0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x3ae0 */  70, 79, 82, 32, 91, 80, 69, 84, 76, 83, 72, 65, 75, 93, 58, 10,
-/* 0x3af0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3b00 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3b10 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b20 */  48, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 88, 56, 54, 95,
-/* 0x3b30 */  54, 52, 95, 51, 50, 83, 32, 32, 32, 32, 32, 32,116,108,115, 95,
-/* 0x3b40 */  97,100,100,114,101,115,115, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b50 */  48, 48, 48, 48, 48, 48, 48, 98, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x3b60 */  52, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,116,108,115, 95,118,
-/* 0x3b70 */  97,108,117,101, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 56,
-/* 0x3b80 */  48, 48, 48, 48, 48, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x3b90 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x3ba0 */  91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x3bb0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x3bc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x3bd0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3be0 */  55,100, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x3bf0 */  32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43, 48,120,
-/* 0x3c00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 98,
-/* 0x3c10 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x3c20 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93,
-/* 0x3c30 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3c40 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3c50 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x3c60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 56, 56, 32, 82, 95, 88, 56,
-/* 0x3c70 */  54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78, 82,
-/* 0x3c80 */  86, 95, 72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c90 */  48, 48, 48, 48, 48, 48, 48, 49, 98, 10, 10, 82, 69, 76, 79, 67,
-/* 0x3ca0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x3cb0 */  82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x3cc0 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x3cd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x3ce0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3cf0 */  48, 48, 97, 49, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67,
-/* 0x3d00 */  51, 50, 32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43,
-/* 0x3d10 */  48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d20 */  49, 98, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x3d30 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65,
-/* 0x3d40 */  95, 72, 69, 65, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x3d50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x3d60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x3d70 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d80 */  49, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 32, 32, 32,
-/* 0x3d90 */  32, 32, 32, 32,108,122,109, 97, 95,117, 95,108,101,110, 43, 48,
-/* 0x3da0 */ 120, 48, 48, 48, 48, 48, 48, 48, 48, 56, 48, 48, 48, 48, 48, 48,
-/* 0x3db0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3dc0 */  49, 48, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 32, 32,
-/* 0x3dd0 */  32, 32, 32, 32, 32,108,122,109, 97, 95, 99, 95,108,101,110, 43,
-/* 0x3de0 */  48,120, 48, 48, 48, 48, 48, 48, 48, 48, 56, 48, 48, 48, 48, 48,
-/* 0x3df0 */  48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x3e00 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 67, 84,
-/* 0x3e10 */  84, 80, 79, 83, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x3e20 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x3e30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x3e40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x3e50 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32, 32,
-/* 0x3e60 */  32, 32, 32,102,105,108,116,101,114, 95, 98,117,102,102,101,114,
-/* 0x3e70 */  95,115,116, 97,114,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x3e80 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x3e90 */  80, 69, 70, 73, 76, 84, 69, 82, 52, 57, 93, 58, 10, 79, 70, 70,
-/* 0x3ea0 */  83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89,
-/* 0x3eb0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3ec0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ed0 */  48, 48, 48, 48, 48, 55, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x3ee0 */  51, 50, 83, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,
-/* 0x3ef0 */ 108,101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f00 */  48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 88, 56, 54, 95, 54, 52,
-/* 0x3f10 */  95, 56, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114,
-/* 0x3f20 */  95, 99,116,111, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x3f30 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69,
-/* 0x3f40 */  73, 77, 80, 79, 82, 84, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x3f50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x3f60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x3f70 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f80 */  48, 55, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32,
-/* 0x3f90 */  32, 32, 32, 32, 32, 99,111,109,112,114,101,115,115,101,100, 95,
-/* 0x3fa0 */ 105,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3fb0 */  48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x3fc0 */  52, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,105,109,112,111,114,
-/* 0x3fd0 */ 116,115, 95,100,111,110,101, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3fe0 */  48, 48, 48, 48, 48, 48, 49, 56, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x3ff0 */  52, 95, 51, 50, 83, 32, 32, 32, 32, 32, 32,115,116, 97,114,116,
-/* 0x4000 */  95,111,102, 95,105,109,112,111,114,116,115, 10, 48, 48, 48, 48,
-/* 0x4010 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 53, 32, 82, 95, 88,
-/* 0x4020 */  56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 76,
-/* 0x4030 */ 111, 97,100, 76,105, 98,114, 97,114,121, 65, 45, 48,120, 48, 48,
-/* 0x4040 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 10, 10,
-/* 0x4050 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4060 */  68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73, 66, 89, 79, 82, 68,
-/* 0x4070 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4080 */  32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4090 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x40a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 88,
-/* 0x40b0 */  56, 54, 95, 54, 52, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 98,
-/* 0x40c0 */ 121,110, 97,109,101, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x40d0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80,
-/* 0x40e0 */  69, 75, 51, 50, 79, 82, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x40f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x4100 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x4110 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4120 */  48, 48, 99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83,
-/* 0x4130 */  32, 32, 32, 32, 32, 32,107,101,114,110,101,108, 51, 50, 95,111,
-/* 0x4140 */ 114,100,105,110, 97,108,115, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4150 */  48, 48, 48, 48, 48, 48, 49, 49, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x4160 */  52, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,110,101,120,116, 95,
-/* 0x4170 */ 105,109,112, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x4180 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73,
-/* 0x4190 */  77, 79, 82, 68, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x41a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x41b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x41c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x41d0 */  57, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 56, 32, 32,
-/* 0x41e0 */  32, 32, 32, 32,102,105,114,115,116, 95,105,109,112, 10, 10, 82,
-/* 0x41f0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x4200 */  83, 32, 70, 79, 82, 32, 91, 80, 69, 73, 77, 80, 79, 82, 50, 93,
-/* 0x4210 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4220 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4230 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4240 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 88, 56,
-/* 0x4250 */  54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 71,101,
-/* 0x4260 */ 116, 80,114,111, 99, 65,100,100,114,101,115,115, 45, 48,120, 48,
-/* 0x4270 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 10,
-/* 0x4280 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 48,
-/* 0x4290 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 56, 32, 32, 32,
-/* 0x42a0 */  32, 32, 32,110,101,120,116, 95,102,117,110, 99, 10, 10, 82, 69,
-/* 0x42b0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x42c0 */  32, 70, 79, 82, 32, 91, 80, 69, 73, 69, 82, 69, 88, 69, 93, 58,
-/* 0x42d0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x42e0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x42f0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4300 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 88, 56, 54,
-/* 0x4310 */  95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69,120,105,
-/* 0x4320 */ 116, 80,114,111, 99,101,115,115, 45, 48,120, 48, 48, 48, 48, 48,
-/* 0x4330 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 10, 10, 82, 69, 76,
-/* 0x4340 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x4350 */  70, 79, 82, 32, 91, 80, 69, 82, 69, 76, 79, 67, 49, 93, 58, 10,
-/* 0x4360 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4370 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4380 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4390 */  48, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 88, 56, 54, 95,
-/* 0x43a0 */  54, 52, 95, 51, 50, 83, 32, 32, 32, 32, 32, 32,115,116, 97,114,
-/* 0x43b0 */ 116, 95,111,102, 95,114,101,108,111, 99,115, 10, 10, 82, 69, 76,
-/* 0x43c0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x43d0 */  70, 79, 82, 32, 91, 80, 69, 82, 69, 76, 79, 67, 51, 93, 58, 10,
-/* 0x43e0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x43f0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4400 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4410 */  48, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 88, 56, 54, 95,
-/* 0x4420 */  54, 52, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,114,101,108,111,
-/* 0x4430 */  99, 95,101,110,100,120, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4440 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x4450 */  82, 69, 76, 54, 52, 66, 73, 71, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x4460 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4470 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4480 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4490 */  48, 48, 48, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67,
-/* 0x44a0 */  56, 32, 32, 32, 32, 32, 32,114,101,108,111, 99, 95, 97,100,100,
-/* 0x44b0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x44c0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 82, 69, 76, 79, 67, 54,
-/* 0x44d0 */  52, 74, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x44e0 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x44f0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x4500 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x4510 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x4520 */  32,114,101,108,111, 99, 95, 97,100,100, 10, 10, 82, 69, 76, 79,
-/* 0x4530 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4540 */  79, 82, 32, 91, 80, 69, 82, 76, 79, 72, 73, 48, 93, 58, 10, 79,
-/* 0x4550 */  70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4560 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4570 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4580 */  48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x4590 */  52, 95, 51, 50, 83, 32, 32, 32, 32, 32, 32,114,101,108,111, 99,
-/* 0x45a0 */  95,100,101,108,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x45b0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80,
-/* 0x45c0 */  69, 68, 69, 80, 72, 65, 75, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x45d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x45e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x45f0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4600 */  48, 48, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51,
-/* 0x4610 */  50, 32, 32, 32, 32, 32, 86,105,114,116,117, 97,108, 80,114,111,
-/* 0x4620 */ 116,101, 99,116, 45, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4630 */  48, 48, 48, 48, 48, 48, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4640 */  48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x4650 */  52, 95, 51, 50, 83, 32, 32, 32, 32, 32, 32,118,112, 95, 98, 97,
-/* 0x4660 */ 115,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4670 */  48, 48,102, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 32,
-/* 0x4680 */  32, 32, 32, 32, 32, 32,118,112, 95,115,105,122,101, 43, 48,120,
-/* 0x4690 */  48, 48, 48, 48, 48, 48, 48, 48, 56, 48, 48, 48, 48, 48, 48, 48,
-/* 0x46a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x46b0 */  99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32,
-/* 0x46c0 */  32, 32, 32, 32,115,119,114,105, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x46d0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x46e0 */  32, 91, 80, 69, 84, 76, 83, 67, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x46f0 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4700 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4710 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4720 */  48, 48, 48, 50, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67,
-/* 0x4730 */  51, 50, 32, 32, 32, 32, 32, 80, 69, 84, 76, 83, 67, 50, 45, 48,
-/* 0x4740 */ 120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4750 */  53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4760 */  48, 97, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32,
-/* 0x4770 */  32, 32, 32, 32, 32,116,108,115, 95,109,111,100,117,108,101, 95,
-/* 0x4780 */  98, 97,115,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4790 */  48, 48, 48, 49, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80,
-/* 0x47a0 */  67, 51, 50, 32, 32, 32, 32, 32, 80, 69, 84, 76, 83, 67, 50, 45,
-/* 0x47b0 */  48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x47c0 */  48, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x47d0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 68, 79,
-/* 0x47e0 */  74, 85, 77, 80, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x47f0 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x4800 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x4810 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x4820 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32,
-/* 0x4830 */  32, 32, 32,111,114,105,103,105,110, 97,108, 95,101,110,116,114,
-/* 0x4840 */ 121, 45, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4850 */  48, 48, 48, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4860 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69,
-/* 0x4870 */  84, 76, 83, 67, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x4880 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4890 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x48a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x48b0 */  53, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32,
-/* 0x48c0 */  32, 32, 32, 32,116,108,115, 95, 99, 97,108,108, 98, 97, 99,107,
-/* 0x48d0 */ 115, 95,112,116,114, 45, 48,120, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x48e0 */  48, 48, 48, 48, 48, 48, 48, 52, 10
+/* 0x0f50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45, 51,  0,  0,
+/* 0x0f60 */   0, 84,  0,  0,  0, 41,  0,  0,  0,194,  3,  0,  0,  0,  0,  0,
+/* 0x0f70 */   0,  0,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,
+/* 0x0f80 */   0, 15,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,
+/* 0x0f90 */   0,  2,  0,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,
+/* 0x0fa0 */   0,  9,  0,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,
+/* 0x0fb0 */   0, 18,  0,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,
+/* 0x0fc0 */   0,  7,  0,  0,  0,108,  0,  0,  0,  0,  0,  0,  0, 51,  0,  0,
+/* 0x0fd0 */   0,  9,  0,  0,  0,115,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,
+/* 0x0fe0 */   0, 16,  0,  0,  0,124,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,
+/* 0x0ff0 */   0,  1,  0,  0,  0,140,  0,  0,  0,  0,  0,  0,  0, 78,  0,  0,
+/* 0x1000 */   0,  0,  0,  0,  0,141,  0,  0,  0,  0,  0,  0,  0, 87,  0,  0,
+/* 0x1010 */   0, 96,  0,  0,  0,141,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,
+/* 0x1020 */   0,131,  0,  0,  0,237,  0,  0,  0,  0,  0,  0,  0,102,  0,  0,
+/* 0x1030 */   0,145,  0,  0,  0,112,  1,  0,  0,  0,  0,  0,  0,108,  0,  0,
+/* 0x1040 */   0,170,  0,  0,  0,  1,  2,  0,  0,  0,  0,  0,  0,114,  0,  0,
+/* 0x1050 */   0, 20,  0,  0,  0,171,  2,  0,  0,  0,  0,  0,  0,124,  0,  0,
+/* 0x1060 */   0, 90,  0,  0,  0,191,  2,  0,  0,  0,  0,  0,  0,135,  0,  0,
+/* 0x1070 */   0,  1, 10,  0,  0, 25,  3,  0,  0,  0,  0,  0,  0,146,  0,  0,
+/* 0x1080 */   0, 20,  0,  0,  0, 26, 13,  0,  0,  0,  0,  0,  0,157,  0,  0,
+/* 0x1090 */   0,  2,  0,  0,  0, 46, 13,  0,  0,  0,  0,  0,  0,167,  0,  0,
+/* 0x10a0 */   0,  1,  0,  0,  0, 48, 13,  0,  0,  0,  0,  0,  0,176,  0,  0,
+/* 0x10b0 */   0,  4,  0,  0,  0, 49, 13,  0,  0,  0,  0,  0,  0,186,  0,  0,
+/* 0x10c0 */   0,  7,  0,  0,  0, 53, 13,  0,  0,  0,  0,  0,  0,195,  0,  0,
+/* 0x10d0 */   0,  3,  0,  0,  0, 60, 13,  0,  0,  0,  0,  0,  0,204,  0,  0,
+/* 0x10e0 */   0, 82,  0,  0,  0, 63, 13,  0,  0,  0,  0,  0,  0,215,  0,  0,
+/* 0x10f0 */   0, 52,  0,  0,  0,145, 13,  0,  0,  0,  0,  0,  0,224,  0,  0,
+/* 0x1100 */   0,  2,  0,  0,  0,197, 13,  0,  0,  0,  0,  0,  0,233,  0,  0,
+/* 0x1110 */   0, 18,  0,  0,  0,199, 13,  0,  0,  0,  0,  0,  0,242,  0,  0,
+/* 0x1120 */   0, 10,  0,  0,  0,217, 13,  0,  0,  0,  0,  0,  0,251,  0,  0,
+/* 0x1130 */   0, 33,  0,  0,  0,227, 13,  0,  0,  0,  0,  0,  0,  4,  1,  0,
+/* 0x1140 */   0, 11,  0,  0,  0,  4, 14,  0,  0,  0,  0,  0,  0, 13,  1,  0,
+/* 0x1150 */   0,  6,  0,  0,  0, 15, 14,  0,  0,  0,  0,  0,  0, 22,  1,  0,
+/* 0x1160 */   0,  4,  0,  0,  0, 21, 14,  0,  0,  0,  0,  0,  0, 31,  1,  0,
+/* 0x1170 */   0,  7,  0,  0,  0, 25, 14,  0,  0,  0,  0,  0,  0, 40,  1,  0,
+/* 0x1180 */   0,  4,  0,  0,  0, 32, 14,  0,  0,  0,  0,  0,  0, 49,  1,  0,
+/* 0x1190 */   0, 48,  0,  0,  0, 36, 14,  0,  0,  0,  0,  0,  0, 58,  1,  0,
+/* 0x11a0 */   0, 10,  0,  0,  0, 84, 14,  0,  0,  0,  0,  0,  0, 67,  1,  0,
+/* 0x11b0 */   0,  2,  0,  0,  0, 94, 14,  0,  0,  0,  0,  0,  0, 76,  1,  0,
+/* 0x11c0 */   0, 10,  0,  0,  0, 96, 14,  0,  0,  0,  0,  0,  0, 85,  1,  0,
+/* 0x11d0 */   0, 11,  0,  0,  0,106, 14,  0,  0,  0,  0,  0,  0, 94,  1,  0,
+/* 0x11e0 */   0, 14,  0,  0,  0,117, 14,  0,  0,  0,  0,  0,  0,103,  1,  0,
+/* 0x11f0 */   0, 75,  0,  0,  0,131, 14,  0,  0,  0,  0,  0,  0,112,  1,  0,
+/* 0x1200 */   0, 27,  0,  0,  0,206, 14,  0,  0,  0,  0,  0,  0,119,  1,  0,
+/* 0x1210 */   0,  4,  0,  0,  0,233, 14,  0,  0,  0,  0,  0,  0,128,  1,  0,
+/* 0x1220 */   0, 16,  0,  0,  0,237, 14,  0,  0,  0,  0,  0,  0,139,  1,  0,
+/* 0x1230 */   0,  0,  0,  0,  0,253, 14,  0,  0,  0,  0,  0,  0,148,  1,  0,
+/* 0x1240 */   0, 15,  0,  0,  0,253, 14,  0,  0,  0,  0,  0,  0,157,  1,  0,
+/* 0x1250 */   0,  2,  0,  0,  0, 12, 15,  0,  0,  0,  0,  0,  0,166,  1,  0,
+/* 0x1260 */   0,  4,  0,  0,  0, 14, 15,  0,  0,  0,  0,  0,  0,175,  1,  0,
+/* 0x1270 */   0,  5,  0,  0,  0, 18, 15,  0,  0,  0,  0,  0,  0,184,  1,  0,
+/* 0x1280 */   0, 38,  0,  0,  0, 23, 15,  0,  0,  0,  0,  0,  0,192,  1,  0,
+/* 0x1290 */   0, 32,  0,  0,  0, 61, 15,  0,  0,  0,  0,  0,  0, 87,  0,  0,
+/* 0x12a0 */   0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,201,  1,  0,
+/* 0x12b0 */   0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,214,  1,  0,
+/* 0x12c0 */   0, 24,  0,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,224,  1,  0,
+/* 0x12d0 */   0, 27,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,231,  1,  0,
+/* 0x12e0 */   0, 28,  0,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,240,  1,  0,
+/* 0x12f0 */   0, 28,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,250,  1,  0,
+/* 0x1300 */   0, 36,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  5,  2,  0,
+/* 0x1310 */   0, 34,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,184,  1,  0,
+/* 0x1320 */   0, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,139,  1,  0,
+/* 0x1330 */   0, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1340 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,
+/* 0x1350 */   0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,
+/* 0x1360 */   0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,
+/* 0x1370 */   0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,
+/* 0x1380 */   0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,
+/* 0x1390 */   0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  0,  0,
+/* 0x13a0 */   0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,
+/* 0x13b0 */   0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,
+/* 0x13c0 */   0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 78,  0,  0,
+/* 0x13d0 */   0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,
+/* 0x13e0 */   0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,102,  0,  0,
+/* 0x13f0 */   0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,
+/* 0x1400 */   0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,
+/* 0x1410 */   0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,124,  0,  0,
+/* 0x1420 */   0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,
+/* 0x1430 */   0, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,146,  0,  0,
+/* 0x1440 */   0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,157,  0,  0,
+/* 0x1450 */   0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,167,  0,  0,
+/* 0x1460 */   0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,176,  0,  0,
+/* 0x1470 */   0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,186,  0,  0,
+/* 0x1480 */   0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,195,  0,  0,
+/* 0x1490 */   0, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,204,  0,  0,
+/* 0x14a0 */   0, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,215,  0,  0,
+/* 0x14b0 */   0, 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,224,  0,  0,
+/* 0x14c0 */   0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,233,  0,  0,
+/* 0x14d0 */   0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,242,  0,  0,
+/* 0x14e0 */   0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,  0,  0,
+/* 0x14f0 */   0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  1,  0,
+/* 0x1500 */   0, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  1,  0,
+/* 0x1510 */   0, 30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22,  1,  0,
+/* 0x1520 */   0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  1,  0,
+/* 0x1530 */   0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 40,  1,  0,
+/* 0x1540 */   0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  1,  0,
+/* 0x1550 */   0, 34,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 58,  1,  0,
+/* 0x1560 */   0, 35,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 67,  1,  0,
+/* 0x1570 */   0, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76,  1,  0,
+/* 0x1580 */   0, 37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,  1,  0,
+/* 0x1590 */   0, 38,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 94,  1,  0,
+/* 0x15a0 */   0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,103,  1,  0,
+/* 0x15b0 */   0, 40,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,112,  1,  0,
+/* 0x15c0 */   0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,119,  1,  0,
+/* 0x15d0 */   0, 42,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,  1,  0,
+/* 0x15e0 */   0, 43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,148,  1,  0,
+/* 0x15f0 */   0, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,157,  1,  0,
+/* 0x1600 */   0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,166,  1,  0,
+/* 0x1610 */   0, 47,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,175,  1,  0,
+/* 0x1620 */   0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,  1,  0,
+/* 0x1630 */   0, 50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  2,  0,
+/* 0x1640 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 35,  2,  0,
+/* 0x1650 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 57,  2,  0,
+/* 0x1660 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 69,  2,  0,
+/* 0x1670 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 80,  2,  0,
+/* 0x1680 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 92,  2,  0,
+/* 0x1690 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,102,  2,  0,
+/* 0x16a0 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,113,  2,  0,
+/* 0x16b0 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,124,  2,  0,
+/* 0x16c0 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,144,  2,  0,
+/* 0x16d0 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,158,  2,  0,
+/* 0x16e0 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,169,  2,  0,
+/* 0x16f0 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,188,  2,  0,
+/* 0x1700 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,205,  2,  0,
+/* 0x1710 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,218,  2,  0,
+/* 0x1720 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,236,  2,  0,
+/* 0x1730 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,251,  2,  0,
+/* 0x1740 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,  7,  3,  0,
+/* 0x1750 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 23,  3,  0,
+/* 0x1760 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 34,  3,  0,
+/* 0x1770 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 49,  3,  0,
+/* 0x1780 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 57,  3,  0,
+/* 0x1790 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 65,  3,  0,
+/* 0x17a0 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 70,  3,  0,
+/* 0x17b0 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 86,  3,  0,
+/* 0x17c0 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,101,  3,  0,
+/* 0x17d0 */   0, 52,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,  3,  0,  0,
+/* 0x17e0 */   0,  5,  0,  0,  0,119,  3,  0,  0,  9,  0,  0,  0,252,255,255,
+/* 0x17f0 */ 255,255,255,255,255,  4,  0,  0,  0,  7,  0,  0,  0,119,  3,  0,
+/* 0x1800 */   0, 58,  0,  0,  0,252,255,255,255,255,255,255,255,  4,  0,  0,
+/* 0x1810 */   0, 14,  0,  0,  0,133,  3,  0,  0, 59,  0,  0,  0,  0,  0,  0,
+/* 0x1820 */   0,  0,  0,  0,  0,  5,  0,  0,  0,  3,  0,  0,  0,133,  3,  0,
+/* 0x1830 */   0, 60,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,
+/* 0x1840 */   0,  3,  0,  0,  0,133,  3,  0,  0, 60,  0,  0,  0,  0,  0,  0,
+/* 0x1850 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  7,  0,  0,  0,146,  3,  0,
+/* 0x1860 */   0, 61,  0,  0,  0,  0,128,  0,  0,  0,  0,  0,  0,  7,  0,  0,
+/* 0x1870 */   0,  3,  0,  0,  0,133,  3,  0,  0, 62,  0,  0,  0,  0,  0,  0,
+/* 0x1880 */   0,  0,  0,  0,  0,  7,  0,  0,  0, 11,  0,  0,  0,158,  3,  0,
+/* 0x1890 */   0, 63,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,  0, 11,  0,  0,
+/* 0x18a0 */   0,125,  0,  0,  0,119,  3,  0,  0,  0,  0,  0,  0, 27,  0,  0,
+/* 0x18b0 */   0,  0,  0,  0,  0, 12,  0,  0,  0,136,  0,  0,  0,119,  3,  0,
+/* 0x18c0 */   0,  0,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,
+/* 0x18d0 */   0,161,  0,  0,  0,119,  3,  0,  0,  0,  0,  0,  0, 27,  0,  0,
+/* 0x18e0 */   0,  0,  0,  0,  0, 14,  0,  0,  0,  1,  0,  0,  0,158,  3,  0,
+/* 0x18f0 */   0, 64,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,  0, 14,  0,  0,
+/* 0x1900 */   0, 16,  0,  0,  0,158,  3,  0,  0, 65,  0,  0,  0,  0,  0,  0,
+/* 0x1910 */ 128,  0,  0,  0,  0, 21,  0,  0,  0,  3,  0,  0,  0,133,  3,  0,
+/* 0x1920 */   0, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  0,  0,
+/* 0x1930 */   0,  7,  0,  0,  0,133,  3,  0,  0, 67,  0,  0,  0,  0,  0,  0,
+/* 0x1940 */   0,  0,  0,  0,  0, 23,  0,  0,  0, 12,  0,  0,  0,170,  3,  0,
+/* 0x1950 */   0, 68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,
+/* 0x1960 */   0,  7,  0,  0,  0,133,  3,  0,  0, 69,  0,  0,  0,  0,  0,  0,
+/* 0x1970 */   0,  0,  0,  0,  0, 24,  0,  0,  0, 16,  0,  0,  0,181,  3,  0,
+/* 0x1980 */   0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,
+/* 0x1990 */   0, 24,  0,  0,  0,133,  3,  0,  0, 70,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */   0,  0,  0,  0,  0, 24,  0,  0,  0, 37,  0,  0,  0,119,  3,  0,
+/* 0x19b0 */   0, 71,  0,  0,  0,252,255,255,255,255,255,255,255, 25,  0,  0,
+/* 0x19c0 */   0,  1,  0,  0,  0,181,  3,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */   0,  0,  0,  0,  0, 26,  0,  0,  0, 12,  0,  0,  0,133,  3,  0,
+/* 0x19e0 */   0, 72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,
+/* 0x19f0 */   0, 17,  0,  0,  0,181,  3,  0,  0,  4,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */   0,  0,  0,  0,  0, 27,  0,  0,  0,  9,  0,  0,  0,181,  3,  0,
+/* 0x1a10 */   0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  0,  0,
+/* 0x1a20 */   0, 15,  0,  0,  0,119,  3,  0,  0, 73,  0,  0,  0,252,255,255,
+/* 0x1a30 */ 255,255,255,255,255, 28,  0,  0,  0, 32,  0,  0,  0,181,  3,  0,
+/* 0x1a40 */   0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,
+/* 0x1a50 */   0,  2,  0,  0,  0,119,  3,  0,  0, 74,  0,  0,  0,252,255,255,
+/* 0x1a60 */ 255,255,255,255,255, 32,  0,  0,  0,  3,  0,  0,  0,133,  3,  0,
+/* 0x1a70 */   0, 75,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,  0,  0,
+/* 0x1a80 */   0, 14,  0,  0,  0,181,  3,  0,  0,  6,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */   0,  0,  0,  0,  0, 35,  0,  0,  0,  3,  0,  0,  0,181,  3,  0,
+/* 0x1aa0 */   0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,
+/* 0x1ab0 */   0,  1,  0,  0,  0,181,  3,  0,  0,  7,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */   0,  0,  0,  0,  0, 37,  0,  0,  0,  6,  0,  0,  0,133,  3,  0,
+/* 0x1ad0 */   0, 76,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 40,  0,  0,
+/* 0x1ae0 */   0,  3,  0,  0,  0,119,  3,  0,  0, 77,  0,  0,  0,252,255,255,
+/* 0x1af0 */ 255,255,255,255,255, 40,  0,  0,  0, 10,  0,  0,  0,133,  3,  0,
+/* 0x1b00 */   0, 78,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 40,  0,  0,
+/* 0x1b10 */   0, 15,  0,  0,  0,158,  3,  0,  0, 79,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */ 128,  0,  0,  0,  0, 40,  0,  0,  0, 44,  0,  0,  0,133,  3,  0,
+/* 0x1b30 */   0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,
+/* 0x1b40 */   0,  2,  0,  0,  0,119,  3,  0,  0,  8,  0,  0,  0,251,255,255,
+/* 0x1b50 */ 255,255,255,255,255, 41,  0,  0,  0, 10,  0,  0,  0,133,  3,  0,
+/* 0x1b60 */   0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,
+/* 0x1b70 */   0, 22,  0,  0,  0,119,  3,  0,  0,  8,  0,  0,  0,252,255,255,
+/* 0x1b80 */ 255,255,255,255,255, 48,  0,  0,  0,  1,  0,  0,  0,119,  3,  0,
+/* 0x1b90 */   0, 82,  0,  0,  0,252,255,255,255,255,255,255,255, 49,  0,  0,
+/* 0x1ba0 */   0,  5,  0,  0,  0,119,  3,  0,  0, 83,  0,  0,  0,252,255,255,
+/* 0x1bb0 */ 255,255,255,255,255, 83, 84, 65, 82, 84,  0, 80, 69, 73, 83, 68,
+/* 0x1bc0 */  76, 76, 48,  0, 80, 69, 73, 83, 69, 70, 73, 48,  0, 80, 69, 73,
+/* 0x1bd0 */  83, 68, 76, 76, 49,  0, 80, 69, 77, 65, 73, 78, 48, 49,  0, 80,
+/* 0x1be0 */  69, 73, 67, 79, 78, 83, 49,  0, 80, 69, 73, 67, 79, 78, 83, 50,
+/* 0x1bf0 */   0, 80, 69, 84, 76, 83, 72, 65, 75,  0, 80, 69, 77, 65, 73, 78,
+/* 0x1c00 */  48, 50,  0, 80, 69, 77, 65, 73, 78, 48, 51,  0, 78, 82, 86, 95,
+/* 0x1c10 */  72, 69, 65, 68,  0, 78, 82, 86, 50, 66,  0, 78, 82, 86, 50, 68,
+/* 0x1c20 */   0, 78, 82, 86, 50, 69,  0, 76, 90, 77, 65, 95, 72, 69, 65, 68,
+/* 0x1c30 */   0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65,
+/* 0x1c40 */  95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51,
+/* 0x1c50 */  48,  0, 76, 90, 77, 65, 95, 84, 65, 73, 76,  0, 80, 69, 77, 65,
+/* 0x1c60 */  73, 78, 49, 48,  0, 80, 69, 84, 76, 83, 72, 65, 75, 50,  0, 80,
+/* 0x1c70 */  69, 67, 84, 84, 80, 79, 83,  0, 80, 69, 67, 84, 84, 78, 85, 76,
+/* 0x1c80 */   0, 80, 69, 70, 73, 76, 84, 69, 82, 52, 57,  0, 80, 69, 73, 77,
+/* 0x1c90 */  80, 79, 82, 84,  0, 80, 69, 73, 66, 89, 79, 82, 68,  0, 80, 69,
+/* 0x1ca0 */  75, 51, 50, 79, 82, 68,  0, 80, 69, 73, 77, 79, 82, 68, 49,  0,
+/* 0x1cb0 */  80, 69, 73, 77, 80, 79, 82, 50,  0, 80, 69, 73, 69, 82, 68, 76,
+/* 0x1cc0 */  76,  0, 80, 69, 73, 69, 82, 69, 88, 69,  0, 80, 69, 73, 77, 68,
+/* 0x1cd0 */  79, 78, 69,  0, 80, 69, 82, 69, 76, 79, 67, 49,  0, 80, 69, 82,
+/* 0x1ce0 */  69, 76, 79, 67, 50,  0, 80, 69, 82, 69, 76, 79, 67, 51,  0, 82,
+/* 0x1cf0 */  69, 76, 54, 52, 66, 73, 71,  0, 82, 69, 76, 79, 67, 54, 52, 74,
+/* 0x1d00 */   0, 80, 69, 82, 76, 79, 72, 73, 48,  0, 80, 69, 82, 69, 76, 76,
+/* 0x1d10 */  79, 48,  0, 80, 69, 82, 69, 76, 72, 73, 48,  0, 80, 69, 68, 69,
+/* 0x1d20 */  80, 72, 65, 75,  0, 80, 69, 84, 76, 83, 67,  0, 80, 69, 77, 65,
+/* 0x1d30 */  73, 78, 50, 48,  0, 67, 76, 69, 65, 82, 83, 84, 65, 67, 75,  0,
+/* 0x1d40 */  80, 69, 77, 65, 73, 78, 50, 49,  0, 80, 69, 73, 83, 68, 76, 76,
+/* 0x1d50 */  57,  0, 80, 69, 73, 83, 69, 70, 73, 57,  0, 80, 69, 82, 69, 84,
+/* 0x1d60 */  85, 82, 78,  0, 80, 69, 68, 79, 74, 85, 77, 80,  0, 80, 69, 84,
+/* 0x1d70 */  76, 83, 67, 50,  0, 85, 80, 88, 49, 72, 69, 65, 68,  0,105,109,
+/* 0x1d80 */ 112,111,114,116,115, 95,100,111,110,101,  0,110,101,120,116, 95,
+/* 0x1d90 */ 102,117,110, 99,  0, 98,121,110, 97,109,101,  0,110,101,120,116,
+/* 0x1da0 */  95,105,109,112,  0,102,105,114,115,116, 95,105,109,112,  0,114,
+/* 0x1db0 */ 101,108,111, 99, 95,101,110,100,120,  0,114,101,108,111, 99, 95,
+/* 0x1dc0 */  97,100,100,  0,115,116, 97,114,116, 95,111,102, 95, 99,111,109,
+/* 0x1dd0 */ 112,114,101,115,115,101,100,  0,115,116, 97,114,116, 95,111,102,
+/* 0x1de0 */  95,117,110, 99,111,109,112,114,101,115,115,101,100,  0,105, 99,
+/* 0x1df0 */ 111,110, 95,111,102,102,115,101,116,  0,105, 99,111,110, 95,100,
+/* 0x1e00 */ 101,108,116, 97,  0,116,108,115, 95, 97,100,100,114,101,115,115,
+/* 0x1e10 */   0,116,108,115, 95,118, 97,108,117,101,  0,108,122,109, 97, 95,
+/* 0x1e20 */ 117, 95,108,101,110,  0,108,122,109, 97, 95, 99, 95,108,101,110,
+/* 0x1e30 */   0,102,105,108,116,101,114, 95, 98,117,102,102,101,114, 95,115,
+/* 0x1e40 */ 116, 97,114,116,  0,102,105,108,116,101,114, 95,108,101,110,103,
+/* 0x1e50 */ 116,104,  0,102,105,108,116,101,114, 95, 99,116,111,  0, 99,111,
+/* 0x1e60 */ 109,112,114,101,115,115,101,100, 95,105,109,112,111,114,116,115,
+/* 0x1e70 */   0,115,116, 97,114,116, 95,111,102, 95,105,109,112,111,114,116,
+/* 0x1e80 */ 115,  0, 76,111, 97,100, 76,105, 98,114, 97,114,121, 65,  0,107,
+/* 0x1e90 */ 101,114,110,101,108, 51, 50, 95,111,114,100,105,110, 97,108,115,
+/* 0x1ea0 */   0, 71,101,116, 80,114,111, 99, 65,100,100,114,101,115,115,  0,
+/* 0x1eb0 */  69,120,105,116, 80,114,111, 99,101,115,115,  0,115,116, 97,114,
+/* 0x1ec0 */ 116, 95,111,102, 95,114,101,108,111, 99,115,  0,114,101,108,111,
+/* 0x1ed0 */  99, 95,100,101,108,116,  0, 86,105,114,116,117, 97,108, 80,114,
+/* 0x1ee0 */ 111,116,101, 99,116,  0,118,112, 95, 98, 97,115,101,  0,118,112,
+/* 0x1ef0 */  95,115,105,122,101,  0,115,119,114,105,  0,116,108,115, 95,109,
+/* 0x1f00 */ 111,100,117,108,101, 95, 98, 97,115,101,  0,111,114,105,103,105,
+/* 0x1f10 */ 110, 97,108, 95,101,110,116,114,121,  0,116,108,115, 95, 99, 97,
+/* 0x1f20 */ 108,108, 98, 97, 99,107,115, 95,112,116,114,  0, 82, 95, 88, 56,
+/* 0x1f30 */  54, 95, 54, 52, 95, 80, 67, 51, 50,  0, 82, 95, 88, 56, 54, 95,
+/* 0x1f40 */  54, 52, 95, 51, 50, 83,  0, 82, 95, 88, 56, 54, 95, 54, 52, 95,
+/* 0x1f50 */  49, 54,  0, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50,  0, 82,
+/* 0x1f60 */  95, 88, 56, 54, 95, 54, 52, 95, 56,  0, 82, 95, 88, 56, 54, 95,
+/* 0x1f70 */  54, 52, 95, 80, 67, 56,  0, 93, 15,  0,  0, 85, 80, 88, 35, 79,
+/* 0x1f80 */  66, 74, 49
 };
@@ -1,5 +1,5 @@
 /* arm.v4a-linux.elf-entry.h
-   created from arm.v4a-linux.elf-entry.bin, 14444 (0x386c) bytes
+   created from arm.v4a-linux.elf-entry.bin, 10190 (0x27ce) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V4A_LINUX_ELF_ENTRY_SIZE    14444
-#define STUB_ARM_V4A_LINUX_ELF_ENTRY_ADLER32 0xd1f2bd9e
-#define STUB_ARM_V4A_LINUX_ELF_ENTRY_CRC32   0x46aad860
+#define STUB_ARM_V4A_LINUX_ELF_ENTRY_SIZE    10190
+#define STUB_ARM_V4A_LINUX_ELF_ENTRY_ADLER32 0xd8d1e3a6
+#define STUB_ARM_V4A_LINUX_ELF_ENTRY_CRC32   0xefdf5aee
 
-unsigned char stub_arm_v4a_linux_elf_entry[14444] = {
+unsigned char stub_arm_v4a_linux_elf_entry[10190] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  80, 19,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -334,609 +334,343 @@ unsigned char stub_arm_v4a_linux_elf_entry[14444] = {
 /* 0x1270 */  16, 96, 78,226, 16,224,141,229,  0, 96, 70,224,  0, 96,141,229,
 /* 0x1280 */   0,144,160,225, 72,  0, 79,226,  0, 16,160,227,  5,  0,144,239,
 /* 0x1290 */   0,  0, 80,227, 37,  0,  0,186,  4,  0,141,229, 12, 48, 30,229,
-/* 0x12a0 */ 254,255,255,235,  0,  0,  0,  0,102,105,108,101, 32,102,111,114,
-/* 0x12b0 */ 109, 97,116, 32,101,108,102, 51, 50, 45,108,105,116,116,108,101,
-/* 0x12c0 */  97,114,109, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,
-/* 0x12d0 */ 100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x12e0 */  32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32,
-/* 0x12f0 */  32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,
-/* 0x1300 */ 105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,
-/* 0x1310 */ 108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x1320 */  88, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32,
-/* 0x1330 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1340 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32, 32, 50,
-/* 0x1350 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1360 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1370 */  32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32,
-/* 0x1380 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1390 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x13a0 */  48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x13b0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x13c0 */  89, 10, 32, 32, 50, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32,
-/* 0x13d0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x13e0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x13f0 */  32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48,
-/* 0x1400 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x1410 */  79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 50, 69, 32, 32,
-/* 0x1420 */  32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 50, 99, 32,
-/* 0x1430 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1440 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50,
-/* 0x1450 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1460 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1470 */  32, 52, 32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1480 */  32, 48, 48, 48, 48, 48, 49, 49, 56, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1490 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x14a0 */  48, 48, 48, 48, 49, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x14b0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x14c0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 78, 82, 86,
-/* 0x14d0 */  50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x14e0 */  48,100, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x14f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 56,
-/* 0x1500 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1510 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1520 */  76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x1530 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 97, 56, 32, 32, 48,
-/* 0x1540 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1550 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 54, 48, 32, 32, 50, 42, 42,
-/* 0x1560 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1570 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55,
-/* 0x1580 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48,
-/* 0x1590 */  48, 48, 48, 48, 57, 51, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x15a0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x15b0 */  48, 48, 52, 48, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x15c0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x15d0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95,
-/* 0x15e0 */  68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 52, 55,
-/* 0x15f0 */  56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1600 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,100, 52, 48, 32,
-/* 0x1610 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1620 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1630 */  10, 32, 32, 57, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32,
-/* 0x1640 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1650 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1660 */  32, 48, 48, 48, 48, 49, 49, 98, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1670 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1680 */  78, 76, 89, 10, 32, 49, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89,
-/* 0x1690 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x16a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x16b0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 49, 98, 56, 32, 32, 50, 42,
-/* 0x16c0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x16d0 */  65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65,
-/* 0x16e0 */  73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,102,
-/* 0x16f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1700 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 49, 98, 56, 32,
-/* 0x1710 */  32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1720 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1730 */  10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48,
-/* 0x1740 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1750 */  78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x1760 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1770 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48,
-/* 0x1780 */  48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x1790 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x17a0 */  66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 66,
-/* 0x17b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x17c0 */  32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48,
-/* 0x17d0 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x17e0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x17f0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48,
-/* 0x1800 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x1810 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1820 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48,
-/* 0x1830 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x1840 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1850 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48,
-/* 0x1860 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x1870 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1880 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48,
-/* 0x1890 */  48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48,
-/* 0x18a0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76,
-/* 0x18b0 */  70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x18c0 */  69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69,
-/* 0x18e0 */  65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95,
-/* 0x18f0 */  72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1900 */  32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48,
-/* 0x1910 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x1920 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1930 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48,
-/* 0x1940 */  48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10, 48, 48, 48,
-/* 0x1950 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x1960 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 70, 76,
-/* 0x1970 */  71, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32,103, 32, 32, 32, 32,
-/* 0x1980 */  32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48,
-/* 0x1990 */  48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48,
-/* 0x19a0 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86,
-/* 0x19b0 */  50, 69,  9, 48, 48, 48, 48, 48, 49, 50, 99, 32,117, 99,108, 95,
-/* 0x19c0 */ 110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x19d0 */  95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32,
-/* 0x19e0 */  32, 32, 70, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 49,
-/* 0x19f0 */  49, 56, 32,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,
-/* 0x1a00 */ 111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1a10 */  48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 66,
-/* 0x1a20 */   9, 48, 48, 48, 48, 48, 48,100, 99, 32,117, 99,108, 95,110,114,
-/* 0x1a30 */ 118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x1a40 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x1a50 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48,
-/* 0x1a60 */  48, 48, 48, 48, 48, 32, 76,122,109, 97, 68,101, 99,111,100,101,
-/* 0x1a70 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x1a80 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48,
-/* 0x1a90 */  48, 48, 48, 32,101,110,100, 95,100,101, 99,111,109,112,114,101,
-/* 0x1aa0 */ 115,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x1ab0 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1ac0 */  48, 48, 32, 79, 95, 66, 73, 78, 70, 79, 10, 48, 48, 48, 48, 48,
-/* 0x1ad0 */  48,102, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77,
-/* 0x1ae0 */  65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,112,
-/* 0x1af0 */ 114, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x1b00 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77,
-/* 0x1b10 */  65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x1b20 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1b30 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b40 */  32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32,
-/* 0x1b50 */  32, 32, 32, 77, 70, 76, 71, 10, 48, 48, 48, 48, 48, 48, 48, 56,
-/* 0x1b60 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1b70 */  32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69, 76,
-/* 0x1b80 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x1b90 */  70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70,
-/* 0x1ba0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x1bb0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x1bc0 */  48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1bd0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1be0 */  48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1bf0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1c00 */  48, 48, 48, 48, 48, 48, 54, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1c10 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1c20 */  10, 48, 48, 48, 48, 48, 48, 54, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1c30 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1c40 */  69, 10, 48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82, 77,
-/* 0x1c50 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1c60 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82,
-/* 0x1c70 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1c80 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 56, 99, 32, 82, 95, 65,
-/* 0x1c90 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1ca0 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95,
-/* 0x1cb0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1cc0 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 99, 32, 82,
-/* 0x1cd0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ce0 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32,
-/* 0x1cf0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1d00 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 98, 52,
-/* 0x1d10 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1d20 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 98,
-/* 0x1d30 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1d40 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1d50 */  99, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1d60 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1d70 */  48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1d80 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x1d90 */  48, 48,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1da0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1db0 */  48, 48, 48,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1dc0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1dd0 */  48, 48, 48, 48,100, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1de0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1df0 */  48, 48, 48, 48, 48,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1e00 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1e10 */  48, 48, 48, 48, 48, 48,101, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1e20 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1e30 */  10, 48, 48, 48, 48, 48, 48,102, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1e40 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1e50 */  69, 10, 48, 48, 48, 48, 48, 48,102, 99, 32, 82, 95, 65, 82, 77,
-/* 0x1e60 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1e70 */  50, 69, 10, 48, 48, 48, 48, 48, 49, 50, 52, 32, 82, 95, 65, 82,
-/* 0x1e80 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1e90 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 50, 56, 32, 82, 95, 65,
-/* 0x1ea0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1eb0 */  82, 86, 50, 69, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x1ec0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x1ed0 */  86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x1ee0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ef0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32,
-/* 0x1f00 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1f10 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 53, 99,
-/* 0x1f20 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1f30 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 54,
-/* 0x1f40 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1f50 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1f60 */  54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1f70 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x1f80 */  48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1f90 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x1fa0 */  48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1fb0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x1fc0 */  48, 48, 48, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1fd0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x1fe0 */  48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1ff0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x2000 */  48, 48, 48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2010 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x2020 */  48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2030 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x2040 */  10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2050 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2060 */  68, 10, 48, 48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2070 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2080 */  50, 68, 10, 48, 48, 48, 48, 48, 48, 99, 56, 32, 82, 95, 65, 82,
-/* 0x2090 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x20a0 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48,100, 48, 32, 82, 95, 65,
-/* 0x20b0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x20c0 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,100, 99, 32, 82, 95,
-/* 0x20d0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x20e0 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101, 56, 32, 82,
-/* 0x20f0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2100 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101, 99, 32,
-/* 0x2110 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2120 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 49, 49, 48,
-/* 0x2130 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2140 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 49, 49,
-/* 0x2150 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2160 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 10, 82, 69, 76, 79, 67,
-/* 0x2170 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x2180 */  82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x2190 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x21a0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x21b0 */  48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x21c0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x21d0 */  48, 48, 48, 54, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x21e0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x21f0 */  48, 48, 48, 48, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2200 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x2210 */  48, 48, 48, 48, 48, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2220 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10,
-/* 0x2230 */  48, 48, 48, 48, 48, 48, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2240 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x2250 */  10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2260 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2270 */  66, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2280 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2290 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82,
-/* 0x22a0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x22b0 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 97, 48, 32, 82, 95, 65,
-/* 0x22c0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x22d0 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 97, 52, 32, 82, 95,
-/* 0x22e0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22f0 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82,
-/* 0x2300 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2310 */  32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32,
-/* 0x2320 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2330 */  32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 56,
-/* 0x2340 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2350 */  32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,100,
-/* 0x2360 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2370 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2380 */ 100, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2390 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 10, 82, 69, 76, 79,
-/* 0x23a0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x23b0 */  79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58,
-/* 0x23c0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x23d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x23e0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 65, 82, 77,
-/* 0x23f0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2400 */  65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 52, 99,
-/* 0x2410 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2420 */  32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48,
-/* 0x2430 */  48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2440 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76,
-/* 0x2450 */  70, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x2460 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77,
-/* 0x2470 */  65, 95, 68, 69, 67, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x2480 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2490 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x24a0 */  48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x24b0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x24c0 */  10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x24d0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x24e0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 98, 56, 32,
-/* 0x24f0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2500 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2510 */  48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2520 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2530 */  50, 48, 10, 48, 48, 48, 48, 48, 48,102, 52, 32, 82, 95, 65, 82,
-/* 0x2540 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2550 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 48,
-/* 0x2560 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2570 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2580 */  48, 48, 48, 48, 49, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2590 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x25a0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82, 95,
-/* 0x25b0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x25c0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x25d0 */  49, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x25e0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x25f0 */  10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2600 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2610 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49,100, 56, 32,
-/* 0x2620 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2630 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2640 */  48, 48, 50, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2650 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2660 */  50, 48, 10, 48, 48, 48, 48, 48, 50, 49, 56, 32, 82, 95, 65, 82,
-/* 0x2670 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2680 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 50,
-/* 0x2690 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x26a0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x26b0 */  48, 48, 48, 48, 50, 51, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x26c0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x26d0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 51, 99, 32, 82, 95,
-/* 0x26e0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x26f0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2700 */  50, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2710 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2720 */  10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2730 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2740 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 53, 56, 32,
-/* 0x2750 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2760 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2770 */  48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2780 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2790 */  50, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56, 32, 82, 95, 65, 82,
-/* 0x27a0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x27b0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,101,
-/* 0x27c0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x27d0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x27e0 */  48, 48, 48, 48, 51, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x27f0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2800 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32, 82, 95,
-/* 0x2810 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2820 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2830 */  51, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2840 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2850 */  10, 48, 48, 48, 48, 48, 51, 56, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2860 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2870 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 97, 48, 32,
-/* 0x2880 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2890 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x28a0 */  48, 48, 51, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x28b0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x28c0 */  50, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99, 32, 82, 95, 65, 82,
-/* 0x28d0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x28e0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,101,
-/* 0x28f0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2900 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2910 */  48, 48, 48, 48, 51,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2920 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2930 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 50, 52, 32, 82, 95,
-/* 0x2940 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2950 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2960 */  52, 51, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2970 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2980 */  10, 48, 48, 48, 48, 48, 52, 54, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2990 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x29a0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 56, 52, 32,
-/* 0x29b0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x29c0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x29d0 */  48, 48, 52, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x29e0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x29f0 */  50, 48, 10, 48, 48, 48, 48, 48, 52, 98, 48, 32, 82, 95, 65, 82,
-/* 0x2a00 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2a10 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,100,
-/* 0x2a20 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2a30 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2a40 */  48, 48, 48, 48, 52,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2a50 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2a60 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,102, 52, 32, 82, 95,
-/* 0x2a70 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2a80 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2a90 */  53, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2aa0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2ab0 */  10, 48, 48, 48, 48, 48, 53, 51, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2ac0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2ad0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 57, 56, 32,
-/* 0x2ae0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2af0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2b00 */  48, 48, 53, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2b10 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2b20 */  50, 48, 10, 48, 48, 48, 48, 48, 53, 99, 48, 32, 82, 95, 65, 82,
-/* 0x2b30 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2b40 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53,101,
-/* 0x2b50 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2b60 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2b70 */  48, 48, 48, 48, 53,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2b80 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2b90 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 48, 52, 32, 82, 95,
-/* 0x2ba0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2bb0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2bc0 */  54, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2bd0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2be0 */  10, 48, 48, 48, 48, 48, 54, 52, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2bf0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2c00 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 56, 48, 32,
-/* 0x2c10 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2c20 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2c30 */  48, 48, 54, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2c40 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2c50 */  50, 48, 10, 48, 48, 48, 48, 48, 54,100, 48, 32, 82, 95, 65, 82,
-/* 0x2c60 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2c70 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,101,
-/* 0x2c80 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2c90 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2ca0 */  48, 48, 48, 48, 55, 49, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2cb0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2cc0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 50, 56, 32, 82, 95,
-/* 0x2cd0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2ce0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2cf0 */  55, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2d00 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2d10 */  10, 48, 48, 48, 48, 48, 55, 55, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2d20 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2d30 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 57, 99, 32,
-/* 0x2d40 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2d50 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2d60 */  48, 48, 55, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2d70 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2d80 */  50, 48, 10, 48, 48, 48, 48, 48, 55, 99, 52, 32, 82, 95, 65, 82,
-/* 0x2d90 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2da0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,100,
-/* 0x2db0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2dc0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2dd0 */  48, 48, 48, 48, 55,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2de0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2df0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 50, 48, 32, 82, 95,
-/* 0x2e00 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2e10 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2e20 */  56, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2e30 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2e40 */  10, 48, 48, 48, 48, 48, 56, 55, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2e50 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2e60 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 56, 56, 32,
-/* 0x2e70 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2e80 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2e90 */  48, 48, 56, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2ea0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2eb0 */  50, 48, 10, 48, 48, 48, 48, 48, 56,101, 56, 32, 82, 95, 65, 82,
-/* 0x2ec0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2ed0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,102,
-/* 0x2ee0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2ef0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2f00 */  48, 48, 48, 48, 56,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2f10 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2f20 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 57, 48, 52, 32, 82, 95,
-/* 0x2f30 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2f40 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2f50 */  57, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2f60 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2f70 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2f80 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68,
-/* 0x2f90 */  69, 67, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x2fa0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2fb0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 56,
-/* 0x2fc0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2fd0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x2fe0 */  48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2ff0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3000 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 56, 56, 32, 82, 95, 65,
-/* 0x3010 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3020 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3030 */  97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3040 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3050 */  48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3060 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3070 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,101, 52, 32, 82,
-/* 0x3080 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3090 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x30a0 */  48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x30b0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x30c0 */  48, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32, 82, 95, 65, 82, 77,
-/* 0x30d0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x30e0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 49, 52,
-/* 0x30f0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3100 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3110 */  48, 48, 48, 49, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3120 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3130 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 50, 48, 32, 82, 95, 65,
-/* 0x3140 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3150 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x3160 */  50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3170 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3180 */  48, 48, 48, 48, 48, 49, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3190 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x31a0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 52, 99, 32, 82,
-/* 0x31b0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x31c0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x31d0 */  48, 49, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x31e0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x31f0 */  48, 10, 48, 48, 48, 48, 48, 49, 56, 48, 32, 82, 95, 65, 82, 77,
-/* 0x3200 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3210 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 56,
-/* 0x3220 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3230 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3240 */  48, 48, 48, 49, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3250 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3260 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 57, 99, 32, 82, 95, 65,
-/* 0x3270 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3280 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x3290 */  97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x32a0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x32b0 */  48, 48, 48, 48, 48, 49, 99, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x32c0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x32d0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82,
-/* 0x32e0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x32f0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3300 */  48, 49,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3310 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3320 */  48, 10, 48, 48, 48, 48, 48, 49,100, 99, 32, 82, 95, 65, 82, 77,
-/* 0x3330 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3340 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,101, 52,
-/* 0x3350 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3360 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3370 */  48, 48, 48, 49,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3380 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3390 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 50, 56, 32, 82, 95, 65,
-/* 0x33a0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x33b0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x33c0 */  50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x33d0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x33e0 */  48, 48, 48, 48, 48, 50, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x33f0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3400 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82,
-/* 0x3410 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3420 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3430 */  48, 50, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3440 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3450 */  48, 10, 48, 48, 48, 48, 48, 50, 54, 56, 32, 82, 95, 65, 82, 77,
-/* 0x3460 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3470 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 56, 52,
-/* 0x3480 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3490 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x34a0 */  48, 48, 48, 50, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x34b0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x34c0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 97, 52, 32, 82, 95, 65,
-/* 0x34d0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x34e0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x34f0 */  99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3500 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3510 */  48, 48, 48, 48, 48, 50,100, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3520 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3530 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,100, 99, 32, 82,
-/* 0x3540 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3550 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3560 */  48, 50,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3570 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3580 */  48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32, 82, 95, 65, 82, 77,
-/* 0x3590 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x35a0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 49, 52,
-/* 0x35b0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x35c0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x35d0 */  48, 48, 48, 51, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x35e0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x35f0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 53, 48, 32, 82, 95, 65,
-/* 0x3600 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3610 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x3620 */  53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3630 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3640 */  48, 48, 48, 48, 48, 51, 55, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3650 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3660 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 55, 56, 32, 82,
-/* 0x3670 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3680 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3690 */  48, 51, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x36a0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x36b0 */  48, 10, 48, 48, 48, 48, 48, 51, 98, 48, 32, 82, 95, 65, 82, 77,
-/* 0x36c0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x36d0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 98, 56,
-/* 0x36e0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x36f0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3700 */  48, 48, 48, 51, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3710 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3720 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99, 32, 82, 95, 65,
-/* 0x3730 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3740 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x3750 */  48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3760 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3770 */  48, 48, 48, 48, 48, 52, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3780 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3790 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 52, 48, 32, 82,
-/* 0x37a0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x37b0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x37c0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x37d0 */  70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 90, 93, 58, 10,
-/* 0x37e0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x37f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x3800 */  10, 48, 48, 48, 48, 48, 48,100, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3810 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77,
-/* 0x3820 */  65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48,101, 56, 32, 82, 95,
-/* 0x3830 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3840 */  69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48,101,
-/* 0x3850 */  99, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32,
-/* 0x3860 */  32, 32, 32, 32, 79, 95, 66, 73, 78, 70, 79, 10
+/* 0x12a0 */ 254,255,255,235,  0,  0,  0,  0, 12,  0,  0,  0, 21,  0,  0,  0,
+/* 0x12b0 */ 192,  0,  0,  0,250,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
+/* 0x12c0 */  52,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x12d0 */  64,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+/* 0x12e0 */  64,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0, 44,  1,  0,  0,
+/* 0x12f0 */  64,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0, 24,  1,  0,  0,
+/* 0x1300 */ 108,  1,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,220,  0,  0,  0,
+/* 0x1310 */ 132,  2,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,168,  0,  0,  0,
+/* 0x1320 */  96,  3,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0, 56,  9,  0,  0,
+/* 0x1330 */   8,  4,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,120,  4,  0,  0,
+/* 0x1340 */  64, 13,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1350 */ 184, 17,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1360 */ 184, 17,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,240,  0,  0,  0,
+/* 0x1370 */ 184, 17,  0,  0,  2,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1380 */   0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1390 */   0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,  5,  0,  0,  0,
+/* 0x13a0 */   0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  6,  0,  0,  0,
+/* 0x13b0 */   0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,  7,  0,  0,  0,
+/* 0x13c0 */   0,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,  8,  0,  0,  0,
+/* 0x13d0 */   0,  0,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,  9,  0,  0,  0,
+/* 0x13e0 */   0,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 11,  0,  0,  0,
+/* 0x13f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1400 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1410 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1420 */   0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1430 */   0,  0,  0,  0,  0,  0,  0,  0,107,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1440 */ 173,222,173,222,  0,  0,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1450 */   4,  0,  0,  0,  0,  0,  0,  0,119,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1460 */   0,  0,  0,  0,  0,  0,  0,  0,142,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1470 */   0,  0,  0,  0,  0,  0,  0,  0,165,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1480 */   0,  0,  0,  0,  0,  0,  0,  0,188,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1490 */   0,  0,  0,  0,  0,  0,  0,  0,199,  0,  0,  0, 10,  0,  0,  0,
+/* 0x14a0 */   0,  0,  0,  0,  0,  0,  0,  0,214,  0,  0,  0, 13,  0,  0,  0,
+/* 0x14b0 */ 173,222,173,222,  0,  0,  0,  0,222,  0,  0,  0, 11,  0,  0,  0,
+/* 0x14c0 */ 240,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14d0 */ 227,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14e0 */   0,  0,  0,  0,  8,  0,  0,  0,239,  0,  0,  0,  7,  0,  0,  0,
+/* 0x14f0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 16,  0,  0,  0,
+/* 0x1500 */ 239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1510 */   3,  0,  0,  0, 92,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1520 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 96,  0,  0,  0,
+/* 0x1530 */ 239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1540 */   3,  0,  0,  0,104,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1550 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,116,  0,  0,  0,
+/* 0x1560 */ 239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1570 */   3,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1580 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,140,  0,  0,  0,
+/* 0x1590 */ 239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15a0 */   3,  0,  0,  0,144,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15b0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,156,  0,  0,  0,
+/* 0x15c0 */ 239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15d0 */   3,  0,  0,  0,172,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15e0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,180,  0,  0,  0,
+/* 0x15f0 */ 239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1600 */   3,  0,  0,  0,184,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1610 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,192,  0,  0,  0,
+/* 0x1620 */ 239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1630 */   3,  0,  0,  0,196,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1640 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,208,  0,  0,  0,
+/* 0x1650 */ 239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1660 */   3,  0,  0,  0,212,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1670 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,220,  0,  0,  0,
+/* 0x1680 */ 239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1690 */   3,  0,  0,  0,232,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16a0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,236,  0,  0,  0,
+/* 0x16b0 */ 239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16c0 */   3,  0,  0,  0,244,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16d0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,252,  0,  0,  0,
+/* 0x16e0 */ 239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16f0 */   3,  0,  0,  0, 36,  1,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1700 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 40,  1,  0,  0,
+/* 0x1710 */ 239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1720 */   4,  0,  0,  0, 16,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1730 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 92,  0,  0,  0,
+/* 0x1740 */ 239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1750 */   4,  0,  0,  0, 96,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1760 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,104,  0,  0,  0,
+/* 0x1770 */ 239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1780 */   4,  0,  0,  0,116,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1790 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,128,  0,  0,  0,
+/* 0x17a0 */ 239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17b0 */   4,  0,  0,  0,140,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,
+/* 0x17c0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,144,  0,  0,  0,
+/* 0x17d0 */ 239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17e0 */   4,  0,  0,  0,156,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,
+/* 0x17f0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,172,  0,  0,  0,
+/* 0x1800 */ 239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1810 */   4,  0,  0,  0,180,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1820 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,188,  0,  0,  0,
+/* 0x1830 */ 239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1840 */   4,  0,  0,  0,200,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1850 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,208,  0,  0,  0,
+/* 0x1860 */ 239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1870 */   4,  0,  0,  0,220,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1880 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,232,  0,  0,  0,
+/* 0x1890 */ 239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18a0 */   4,  0,  0,  0,236,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,
+/* 0x18b0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 16,  1,  0,  0,
+/* 0x18c0 */ 239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18d0 */   4,  0,  0,  0, 20,  1,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,
+/* 0x18e0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0, 16,  0,  0,  0,
+/* 0x18f0 */ 239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1900 */   5,  0,  0,  0, 96,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1910 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,104,  0,  0,  0,
+/* 0x1920 */ 239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1930 */   5,  0,  0,  0,108,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1940 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,124,  0,  0,  0,
+/* 0x1950 */ 239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1960 */   5,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1970 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,132,  0,  0,  0,
+/* 0x1980 */ 239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1990 */   5,  0,  0,  0,144,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,
+/* 0x19a0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,160,  0,  0,  0,
+/* 0x19b0 */ 239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19c0 */   5,  0,  0,  0,164,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,
+/* 0x19d0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,172,  0,  0,  0,
+/* 0x19e0 */ 239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19f0 */   5,  0,  0,  0,180,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1a00 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,184,  0,  0,  0,
+/* 0x1a10 */ 239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a20 */   5,  0,  0,  0,212,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1a30 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,216,  0,  0,  0,
+/* 0x1a40 */ 239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a50 */   6,  0,  0,  0,  8,  0,  0,  0,239,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1a60 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0, 76,  0,  0,  0,
+/* 0x1a70 */ 239,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a80 */   6,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1a90 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,116,  0,  0,  0,
+/* 0x1aa0 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ab0 */   7,  0,  0,  0,144,  0,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1ac0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,184,  0,  0,  0,
+/* 0x1ad0 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ae0 */   7,  0,  0,  0,204,  0,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1af0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,244,  0,  0,  0,
+/* 0x1b00 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b10 */   7,  0,  0,  0,  0,  1,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1b20 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  8,  1,  0,  0,
+/* 0x1b30 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b40 */   7,  0,  0,  0, 68,  1,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1b50 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,144,  1,  0,  0,
+/* 0x1b60 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b70 */   7,  0,  0,  0,204,  1,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1b80 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,216,  1,  0,  0,
+/* 0x1b90 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ba0 */   7,  0,  0,  0,  4,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1bb0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 24,  2,  0,  0,
+/* 0x1bc0 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bd0 */   7,  0,  0,  0, 32,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1be0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 52,  2,  0,  0,
+/* 0x1bf0 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c00 */   7,  0,  0,  0, 60,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1c10 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 64,  2,  0,  0,
+/* 0x1c20 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c30 */   7,  0,  0,  0, 76,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1c40 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 88,  2,  0,  0,
+/* 0x1c50 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c60 */   7,  0,  0,  0,164,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1c70 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,200,  2,  0,  0,
+/* 0x1c80 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c90 */   7,  0,  0,  0,232,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1ca0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  4,  3,  0,  0,
+/* 0x1cb0 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cc0 */   7,  0,  0,  0, 12,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1cd0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 60,  3,  0,  0,
+/* 0x1ce0 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cf0 */   7,  0,  0,  0,136,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1d00 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,160,  3,  0,  0,
+/* 0x1d10 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d20 */   7,  0,  0,  0,168,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1d30 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,204,  3,  0,  0,
+/* 0x1d40 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d50 */   7,  0,  0,  0,224,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1d60 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,232,  3,  0,  0,
+/* 0x1d70 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d80 */   7,  0,  0,  0, 36,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1d90 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 56,  4,  0,  0,
+/* 0x1da0 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1db0 */   7,  0,  0,  0,108,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1dc0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,132,  4,  0,  0,
+/* 0x1dd0 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1de0 */   7,  0,  0,  0,140,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,176,  4,  0,  0,
+/* 0x1e00 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e10 */   7,  0,  0,  0,212,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,236,  4,  0,  0,
+/* 0x1e30 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e40 */   7,  0,  0,  0,244,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 24,  5,  0,  0,
+/* 0x1e60 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e70 */   7,  0,  0,  0, 60,  5,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,152,  5,  0,  0,
+/* 0x1e90 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ea0 */   7,  0,  0,  0,160,  5,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,192,  5,  0,  0,
+/* 0x1ec0 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ed0 */   7,  0,  0,  0,228,  5,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,252,  5,  0,  0,
+/* 0x1ef0 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f00 */   7,  0,  0,  0,  4,  6,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 36,  6,  0,  0,
+/* 0x1f20 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f30 */   7,  0,  0,  0, 72,  6,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,128,  6,  0,  0,
+/* 0x1f50 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f60 */   7,  0,  0,  0,140,  6,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,208,  6,  0,  0,
+/* 0x1f80 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f90 */   7,  0,  0,  0,236,  6,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1fa0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 28,  7,  0,  0,
+/* 0x1fb0 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fc0 */   7,  0,  0,  0, 40,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,108,  7,  0,  0,
+/* 0x1fe0 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ff0 */   7,  0,  0,  0,124,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2000 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,156,  7,  0,  0,
+/* 0x2010 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2020 */   7,  0,  0,  0,184,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2030 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,196,  7,  0,  0,
+/* 0x2040 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2050 */   7,  0,  0,  0,208,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2060 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,244,  7,  0,  0,
+/* 0x2070 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2080 */   7,  0,  0,  0, 32,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2090 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 44,  8,  0,  0,
+/* 0x20a0 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20b0 */   7,  0,  0,  0,124,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,136,  8,  0,  0,
+/* 0x20d0 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20e0 */   7,  0,  0,  0,160,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,232,  8,  0,  0,
+/* 0x2100 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2110 */   7,  0,  0,  0,244,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2120 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,252,  8,  0,  0,
+/* 0x2130 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2140 */   7,  0,  0,  0,  4,  9,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2150 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 40,  9,  0,  0,
+/* 0x2160 */ 239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2170 */   8,  0,  0,  0,120,  0,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2180 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,128,  0,  0,  0,
+/* 0x2190 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21a0 */   8,  0,  0,  0,136,  0,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x21b0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,168,  0,  0,  0,
+/* 0x21c0 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21d0 */   8,  0,  0,  0,172,  0,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x21e0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,228,  0,  0,  0,
+/* 0x21f0 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2200 */   8,  0,  0,  0,  0,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2210 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 12,  1,  0,  0,
+/* 0x2220 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2230 */   8,  0,  0,  0, 20,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2240 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 24,  1,  0,  0,
+/* 0x2250 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2260 */   8,  0,  0,  0, 32,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2270 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 40,  1,  0,  0,
+/* 0x2280 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2290 */   8,  0,  0,  0, 68,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x22a0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 76,  1,  0,  0,
+/* 0x22b0 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22c0 */   8,  0,  0,  0, 80,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x22d0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,128,  1,  0,  0,
+/* 0x22e0 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22f0 */   8,  0,  0,  0,136,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2300 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,140,  1,  0,  0,
+/* 0x2310 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2320 */   8,  0,  0,  0,156,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2330 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,160,  1,  0,  0,
+/* 0x2340 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2350 */   8,  0,  0,  0,192,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2360 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,204,  1,  0,  0,
+/* 0x2370 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2380 */   8,  0,  0,  0,212,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2390 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,220,  1,  0,  0,
+/* 0x23a0 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23b0 */   8,  0,  0,  0,228,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x23c0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,236,  1,  0,  0,
+/* 0x23d0 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23e0 */   8,  0,  0,  0, 40,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x23f0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 44,  2,  0,  0,
+/* 0x2400 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2410 */   8,  0,  0,  0, 68,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2420 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 76,  2,  0,  0,
+/* 0x2430 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2440 */   8,  0,  0,  0, 80,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2450 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,104,  2,  0,  0,
+/* 0x2460 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2470 */   8,  0,  0,  0,132,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2480 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,140,  2,  0,  0,
+/* 0x2490 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24a0 */   8,  0,  0,  0,164,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x24b0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,200,  2,  0,  0,
+/* 0x24c0 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24d0 */   8,  0,  0,  0,208,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x24e0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,220,  2,  0,  0,
+/* 0x24f0 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2500 */   8,  0,  0,  0,244,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2510 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 12,  3,  0,  0,
+/* 0x2520 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2530 */   8,  0,  0,  0, 20,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2540 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 44,  3,  0,  0,
+/* 0x2550 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2560 */   8,  0,  0,  0, 80,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2570 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 88,  3,  0,  0,
+/* 0x2580 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2590 */   8,  0,  0,  0,112,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x25a0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,120,  3,  0,  0,
+/* 0x25b0 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25c0 */   8,  0,  0,  0,156,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x25d0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,176,  3,  0,  0,
+/* 0x25e0 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25f0 */   8,  0,  0,  0,184,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2600 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,200,  3,  0,  0,
+/* 0x2610 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2620 */   8,  0,  0,  0,204,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2630 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  4,  0,  0,
+/* 0x2640 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2650 */   8,  0,  0,  0, 24,  4,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2660 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 64,  4,  0,  0,
+/* 0x2670 */ 239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2680 */  11,  0,  0,  0,220,  0,  0,  0,239,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2690 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,232,  0,  0,  0,
+/* 0x26a0 */ 239,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26b0 */  11,  0,  0,  0,236,  0,  0,  0,227,  0,  0,  0, 19,  0,  0,  0,
+/* 0x26c0 */   0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,
+/* 0x26d0 */   0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 95, 84, 65,
+/* 0x26e0 */  73, 76,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78,
+/* 0x26f0 */  82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0,
+/* 0x2700 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95,
+/* 0x2710 */  68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
+/* 0x2720 */   0, 69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73,
+/* 0x2730 */  78, 90,  0, 77, 70, 76, 71,  0, 95,115,116, 97,114,116,  0,117,
+/* 0x2740 */  99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,
+/* 0x2750 */ 101,115,115, 95, 56,  0,117, 99,108, 95,110,114,118, 50,100, 95,
+/* 0x2760 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56,  0,117, 99,108,
+/* 0x2770 */  95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,
+/* 0x2780 */ 115, 95, 56,  0, 76,122,109, 97, 68,101, 99,111,100,101,  0,101,
+/* 0x2790 */ 110,100, 95,100,101, 99,111,109,112,114,101,115,115,  0, 79, 95,
+/* 0x27a0 */  66, 73, 78, 70, 79,  0, 99,112,114, 48,  0, 82, 95, 65, 82, 77,
+/* 0x27b0 */  95, 65, 66, 83, 51, 50,  0, 82, 95, 65, 82, 77, 95, 80, 67, 50,
+/* 0x27c0 */  52,  0,168, 18,  0,  0, 85, 80, 88, 35, 79, 66, 74, 49
 };
@@ -1,5 +1,5 @@
 /* arm.v4t-wince.pe.h
-   created from arm.v4t-wince.pe.bin, 7542 (0x1d76) bytes
+   created from arm.v4t-wince.pe.bin, 4689 (0x1251) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V4T_WINCE_PE_SIZE    7542
-#define STUB_ARM_V4T_WINCE_PE_ADLER32 0xdcd3f4f4
-#define STUB_ARM_V4T_WINCE_PE_CRC32   0x652a61f0
+#define STUB_ARM_V4T_WINCE_PE_SIZE    4689
+#define STUB_ARM_V4T_WINCE_PE_ADLER32 0x5aea6572
+#define STUB_ARM_V4T_WINCE_PE_CRC32   0x46acc078
 
-unsigned char stub_arm_v4t_wince_pe[7542] = {
+unsigned char stub_arm_v4t_wince_pe[4689] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 132, 11,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -206,306 +206,128 @@ unsigned char stub_arm_v4t_wince_pe[7542] = {
 /* 0x0a70 */ 241,209,  7,146,  7,152, 37,154,144, 66,  0,210,175,228,  9, 75,
 /* 0x0a80 */ 153, 66,  3,216, 16,155,157, 66,  9,208,  1, 53,  4,152,  3,153,
 /* 0x0a90 */  43, 26, 11, 96,  7,154, 38,155,  0, 32, 26, 96,  0,224,  1, 32,
-/* 0x0aa0 */  31,176,240,189,255,255,255,  0,102,105,108,101, 32,102,111,114,
-/* 0x0ab0 */ 109, 97,116, 32,101,108,102, 51, 50, 45,108,105,116,116,108,101,
-/* 0x0ac0 */  97,114,109, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,
-/* 0x0ad0 */ 100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x0ae0 */  32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32,
-/* 0x0af0 */  32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,
-/* 0x0b00 */ 105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,
-/* 0x0b10 */ 108, 97,103,115, 10, 32, 32, 48, 32, 68,108,108, 83,116, 97,114,
-/* 0x0b20 */ 116, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 56, 32,
-/* 0x0b30 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x0b40 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32, 32, 50,
-/* 0x0b50 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x0b60 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x0b70 */  32, 49, 32, 69,120,101, 83,116, 97,114,116, 32, 32, 32, 32, 32,
-/* 0x0b80 */  32, 48, 48, 48, 48, 48, 48, 54, 52, 32, 32, 48, 48, 48, 48, 48,
-/* 0x0b90 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x0ba0 */  48, 48, 48, 48, 48, 51, 99, 32, 32, 50, 42, 42, 49, 32, 32, 67,
-/* 0x0bb0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x0bc0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 85,110,102,
-/* 0x0bd0 */ 105,108,116,101,114, 95, 48,120, 53, 48, 32, 48, 48, 48, 48, 48,
-/* 0x0be0 */  48, 51, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x0bf0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 97,
-/* 0x0c00 */  48, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x0c10 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x0c20 */  76, 89, 10, 32, 32, 51, 32, 82,101,108,111, 99,115, 32, 32, 32,
-/* 0x0c30 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 48,
-/* 0x0c40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x0c50 */  48, 32, 32, 48, 48, 48, 48, 48, 48,100, 56, 32, 32, 50, 42, 42,
-/* 0x0c60 */  50, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x0c70 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52,
-/* 0x0c80 */  32, 73,109,112,111,114,116,115, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x0c90 */  48, 48, 48, 48, 48, 56, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x0ca0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x0cb0 */  48, 48, 49, 49, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x0cc0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x0cd0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 80,114,111, 99,101,
-/* 0x0ce0 */ 115,115, 69,110,100, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x0cf0 */  56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x0d00 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 57, 97, 32,
-/* 0x0d10 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x0d20 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 85, 80,
-/* 0x0d30 */  88, 49, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x0d40 */  48, 48, 50, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x0d50 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x0d60 */  97, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x0d70 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55,
-/* 0x0d80 */  32, 46,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,
-/* 0x0d90 */ 109,112,114,101,115,115, 95, 56, 32, 48, 48, 48, 48, 48, 48, 57,
-/* 0x0da0 */  56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x0db0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 99, 50, 32,
-/* 0x0dc0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x0dd0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 67, 97,
-/* 0x0de0 */ 108,108, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x0df0 */  48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x0e00 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,
-/* 0x0e10 */  53, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x0e20 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x0e30 */  78, 76, 89, 10, 32, 32, 57, 32, 46,117, 99,108, 95,110,114,118,
-/* 0x0e40 */  50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 32,
-/* 0x0e50 */  48, 48, 48, 48, 48, 48, 98, 50, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x0e60 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x0e70 */  48, 48, 48, 50, 53,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x0e80 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x0e90 */  10, 32, 49, 48, 32, 67, 97,108,108, 50, 69, 32, 32, 32, 32, 32,
-/* 0x0ea0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48,
-/* 0x0eb0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x0ec0 */  32, 48, 48, 48, 48, 48, 51, 49, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x0ed0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x0ee0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 67,
-/* 0x0ef0 */  97,108,108, 76, 90, 77, 65, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x0f00 */  48, 48, 48, 51, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x0f10 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x0f20 */  51, 49, 52, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69,
-/* 0x0f30 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x0f40 */  79, 78, 76, 89, 10, 32, 49, 50, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x0f50 */  67, 79, 68, 69, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x0f60 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x0f70 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 52, 56, 32, 32, 50,
-/* 0x0f80 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x0f90 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 51, 32, 76, 90, 77, 65,
-/* 0x0fa0 */  95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 55,
-/* 0x0fb0 */  54, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x0fc0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 52, 56,
-/* 0x0fd0 */  32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x0fe0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79,
-/* 0x0ff0 */  76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1000 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,120,101, 83,116, 97,
-/* 0x1010 */ 114,116,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69,120,101, 83,
-/* 0x1020 */ 116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1030 */  32, 32, 32, 32, 32, 32, 73,109,112,111,114,116,115,  9, 48, 48,
-/* 0x1040 */  48, 48, 48, 48, 48, 48, 32, 46,114,101, 97,108, 95,115,116, 97,
-/* 0x1050 */ 114,116, 95,111,102, 73,109,112,111,114,116,115, 10, 48, 48, 48,
-/* 0x1060 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 46,117,
-/* 0x1070 */  99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,
-/* 0x1080 */ 101,115,115, 95, 56,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 46,
-/* 0x1090 */ 117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,
-/* 0x10a0 */ 114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x10b0 */ 108, 32, 32, 32, 32,100, 32, 32, 46,117, 99,108, 95,110,114,118,
-/* 0x10c0 */  50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  9,
-/* 0x10d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 46,117, 99,108, 95,110,114,
-/* 0x10e0 */ 118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x10f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32, 32,
-/* 0x1100 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 79, 68, 69,  9, 48, 48,
-/* 0x1110 */  48, 48, 48, 48, 48, 48, 32, 46,114,101, 97,108, 95,115,116, 97,
-/* 0x1120 */ 114,116, 95,111,102, 76, 90, 77, 65, 95, 68, 69, 67, 79, 68, 69,
-/* 0x1130 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1140 */  32, 32, 68,108,108, 83,116, 97,114,116,  9, 48, 48, 48, 48, 48,
-/* 0x1150 */  48, 48, 48, 32, 68,108,108, 83,116, 97,114,116, 10, 48, 48, 48,
-/* 0x1160 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 85,110,
-/* 0x1170 */ 102,105,108,116,101,114, 95, 48,120, 53, 48,  9, 48, 48, 48, 48,
-/* 0x1180 */  48, 48, 48, 48, 32, 85,110,102,105,108,116,101,114, 95, 48,120,
-/* 0x1190 */  53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x11a0 */  32,100, 32, 32, 82,101,108,111, 99,115,  9, 48, 48, 48, 48, 48,
-/* 0x11b0 */  48, 48, 48, 32, 82,101,108,111, 99,115, 10, 48, 48, 48, 48, 48,
-/* 0x11c0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 73,109,112,111,
-/* 0x11d0 */ 114,116,115,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 73,109,112,
-/* 0x11e0 */ 111,114,116,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x11f0 */  32, 32, 32,100, 32, 32, 80,114,111, 99,101,115,115, 69,110,100,
-/* 0x1200 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 80,114,111, 99,101,115,
-/* 0x1210 */ 115, 69,110,100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1220 */  32, 32, 32,100, 32, 32, 85, 80, 88, 49, 72, 69, 65, 68,  9, 48,
-/* 0x1230 */  48, 48, 48, 48, 48, 48, 48, 32, 85, 80, 88, 49, 72, 69, 65, 68,
-/* 0x1240 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1250 */  32, 32, 67, 97,108,108, 50, 66,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1260 */  48, 32, 67, 97,108,108, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1270 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 97,108,108, 50, 69,
-/* 0x1280 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 97,108,108, 50, 69,
-/* 0x1290 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x12a0 */  32, 32, 67, 97,108,108, 76, 90, 77, 65,  9, 48, 48, 48, 48, 48,
-/* 0x12b0 */  48, 48, 48, 32, 67, 97,108,108, 76, 90, 77, 65, 10, 48, 48, 48,
-/* 0x12c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x12d0 */  77, 65, 95, 68, 69, 67, 79, 68, 69,  9, 48, 48, 48, 48, 48, 48,
-/* 0x12e0 */  48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 79, 68, 69, 10, 48,
-/* 0x12f0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1300 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x1310 */  48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x1320 */  48, 48, 48, 48, 48, 51, 56, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1330 */  69,120,101, 83,116, 97,114,116,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1340 */  48, 32, 83, 82, 67, 48, 10, 48, 48, 48, 48, 48, 48, 52, 48, 32,
-/* 0x1350 */ 103, 32, 32, 32, 32, 32, 32, 32, 69,120,101, 83,116, 97,114,116,
-/* 0x1360 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 68, 83, 84, 48, 10, 48,
-/* 0x1370 */  48, 48, 48, 48, 48, 52, 56, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1380 */  69,120,101, 83,116, 97,114,116,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1390 */  48, 32, 73, 65, 84, 84, 10, 48, 48, 48, 48, 48, 48, 53, 56, 32,
-/* 0x13a0 */ 103, 32, 32, 32, 32, 32, 32, 32, 69,120,101, 83,116, 97,114,116,
-/* 0x13b0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 78, 84, 82, 10, 48,
-/* 0x13c0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x13d0 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,
-/* 0x13e0 */ 116, 97,114,116, 95,111,102, 95, 99,111,109,112,114,101,115,115,
-/* 0x13f0 */ 101,100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x1400 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1410 */  48, 48, 32, 99,111,109,112,114,101,115,115,101,100, 95,108,101,
-/* 0x1420 */ 110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x1430 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48,
-/* 0x1440 */  48, 48, 48, 48, 32,115,116, 97,114,116, 95,111,102, 95,117,110,
-/* 0x1450 */  99,111,109,112,114,101,115,115,101,100, 10, 48, 48, 48, 48, 48,
-/* 0x1460 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x1470 */  42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,117,110, 99,111,109,
-/* 0x1480 */ 112,114,101,115,115,101,100, 95,108,101,110,103,116,104, 10, 48,
-/* 0x1490 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x14a0 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,111,
-/* 0x14b0 */ 114,105,103,105,110, 97,108, 95,101,110,116,114,121, 10, 48, 48,
-/* 0x14c0 */  48, 48, 48, 48, 51, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 85,
-/* 0x14d0 */ 110,102,105,108,116,101,114, 95, 48,120, 53, 48,  9, 48, 48, 48,
-/* 0x14e0 */  48, 48, 48, 48, 48, 32, 70, 73, 66, 83, 10, 48, 48, 48, 48, 48,
-/* 0x14f0 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x1500 */  42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,101,
-/* 0x1510 */ 114, 95, 98,117,102,102,101,114, 95,115,116, 97,114,116, 10, 48,
-/* 0x1520 */  48, 48, 48, 48, 48, 51, 52, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1530 */  85,110,102,105,108,116,101,114, 95, 48,120, 53, 48,  9, 48, 48,
-/* 0x1540 */  48, 48, 48, 48, 48, 48, 32, 70, 73, 66, 69, 10, 48, 48, 48, 48,
-/* 0x1550 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x1560 */  68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,
-/* 0x1570 */ 101,114, 95, 98,117,102,102,101,114, 95,101,110,100, 10, 48, 48,
-/* 0x1580 */  48, 48, 48, 48, 51, 99, 32,103, 32, 32, 32, 32, 32, 32, 32, 82,
-/* 0x1590 */ 101,108,111, 99,115,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 66,
-/* 0x15a0 */  82, 69, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x15b0 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x15c0 */  48, 48, 48, 32,115,116, 97,114,116, 95,111,102, 95,114,101,108,
-/* 0x15d0 */ 111, 99,115, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32,103, 32, 32,
-/* 0x15e0 */  32, 32, 32, 32, 32, 73,109,112,111,114,116,115,  9, 48, 48, 48,
-/* 0x15f0 */  48, 48, 48, 48, 48, 32, 66, 73, 77, 80, 10, 48, 48, 48, 48, 48,
-/* 0x1600 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x1610 */  42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,115,116, 97,114,116,
-/* 0x1620 */  95,111,102, 95,105,109,112,111,114,116,115, 10, 48, 48, 48, 48,
-/* 0x1630 */  48, 48, 55, 99, 32,103, 32, 32, 32, 32, 32, 32, 32, 73,109,112,
-/* 0x1640 */ 111,114,116,115,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 79, 78,
-/* 0x1650 */  65, 77, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x1660 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1670 */  48, 48, 32,115,116, 97,114,116, 95,111,102, 95,100,108,108, 95,
-/* 0x1680 */ 110, 97,109,101,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1690 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48,
-/* 0x16a0 */  48, 48, 48, 48, 48, 32,108,122,109, 97, 95,117, 95,108,101,110,
-/* 0x16b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x16c0 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16d0 */  32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,
-/* 0x16e0 */ 115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x16f0 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1700 */  48, 48, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48,
-/* 0x1710 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x1720 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,
-/* 0x1730 */ 109, 97, 95,112,114,111,112,101,114,116,105,101,115, 10, 10, 82,
-/* 0x1740 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x1750 */  83, 32, 70, 79, 82, 32, 91, 68,108,108, 83,116, 97,114,116, 93,
-/* 0x1760 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x1770 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x1780 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 65, 82,
-/* 0x1790 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69,120,
-/* 0x17a0 */ 101, 83,116, 97,114,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x17b0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x17c0 */  69,120,101, 83,116, 97,114,116, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x17d0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x17e0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x17f0 */  48, 48, 49, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1800 */  32, 32, 32, 32, 32, 32, 32, 69,120,101, 83,116, 97,114,116, 10,
-/* 0x1810 */  48, 48, 48, 48, 48, 48, 51, 56, 32, 82, 95, 65, 82, 77, 95, 65,
-/* 0x1820 */  66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116,
-/* 0x1830 */  95,111,102, 95, 99,111,109,112,114,101,115,115,101,100, 10, 48,
-/* 0x1840 */  48, 48, 48, 48, 48, 51, 99, 32, 82, 95, 65, 82, 77, 95, 65, 66,
-/* 0x1850 */  83, 51, 50, 32, 32, 32, 32, 32, 32, 32, 99,111,109,112,114,101,
-/* 0x1860 */ 115,115,101,100, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48,
-/* 0x1870 */  48, 48, 52, 48, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50,
-/* 0x1880 */  32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,111,102, 95,
-/* 0x1890 */ 117,110, 99,111,109,112,114,101,115,115,101,100, 10, 48, 48, 48,
-/* 0x18a0 */  48, 48, 48, 52, 52, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51,
-/* 0x18b0 */  50, 32, 32, 32, 32, 32, 32, 32,117,110, 99,111,109,112,114,101,
-/* 0x18c0 */ 115,115,101,100, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48,
-/* 0x18d0 */  48, 48, 53, 56, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50,
-/* 0x18e0 */  32, 32, 32, 32, 32, 32, 32,111,114,105,103,105,110, 97,108, 95,
-/* 0x18f0 */ 101,110,116,114,121, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x1900 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 85,
-/* 0x1910 */ 110,102,105,108,116,101,114, 95, 48,120, 53, 48, 93, 58, 10, 79,
-/* 0x1920 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x1930 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x1940 */  48, 48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 65, 82, 77, 95, 65,
-/* 0x1950 */  66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,
-/* 0x1960 */ 114, 95, 98,117,102,102,101,114, 95,115,116, 97,114,116, 10, 48,
-/* 0x1970 */  48, 48, 48, 48, 48, 51, 52, 32, 82, 95, 65, 82, 77, 95, 65, 66,
-/* 0x1980 */  83, 51, 50, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114,
-/* 0x1990 */  95, 98,117,102,102,101,114, 95,101,110,100, 10, 10, 82, 69, 76,
-/* 0x19a0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x19b0 */  70, 79, 82, 32, 91, 82,101,108,111, 99,115, 93, 58, 10, 79, 70,
-/* 0x19c0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x19d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x19e0 */  48, 48, 48, 48, 48, 51, 99, 32, 82, 95, 65, 82, 77, 95, 65, 66,
-/* 0x19f0 */  83, 51, 50, 32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,
-/* 0x1a00 */ 111,102, 95,114,101,108,111, 99,115, 10, 10, 82, 69, 76, 79, 67,
-/* 0x1a10 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x1a20 */  82, 32, 91, 73,109,112,111,114,116,115, 93, 58, 10, 79, 70, 70,
-/* 0x1a30 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x1a40 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x1a50 */  48, 48, 48, 48, 48,101, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77,
-/* 0x1a60 */  95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108, 95,115,
-/* 0x1a70 */ 116, 97,114,116, 95,111,102, 73,109,112,111,114,116,115, 10, 48,
-/* 0x1a80 */  48, 48, 48, 48, 48, 50, 56, 32, 82, 95, 65, 82, 77, 95, 84, 72,
-/* 0x1a90 */  77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108, 95,
-/* 0x1aa0 */ 115,116, 97,114,116, 95,111,102, 73,109,112,111,114,116,115, 10,
-/* 0x1ab0 */  48, 48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 65, 82, 77, 95, 84,
-/* 0x1ac0 */  72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108,
-/* 0x1ad0 */  95,115,116, 97,114,116, 95,111,102, 73,109,112,111,114,116,115,
-/* 0x1ae0 */  10, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1af0 */  84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,
-/* 0x1b00 */ 108, 95,115,116, 97,114,116, 95,111,102, 73,109,112,111,114,116,
-/* 0x1b10 */ 115, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77,
-/* 0x1b20 */  95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,115,116, 97,
-/* 0x1b30 */ 114,116, 95,111,102, 95,105,109,112,111,114,116,115, 10, 48, 48,
-/* 0x1b40 */  48, 48, 48, 48, 55, 99, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83,
-/* 0x1b50 */  51, 50, 32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,111,
-/* 0x1b60 */ 102, 95,100,108,108, 95,110, 97,109,101,115, 10, 10, 82, 69, 76,
-/* 0x1b70 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x1b80 */  70, 79, 82, 32, 91, 67, 97,108,108, 50, 66, 93, 58, 10, 79, 70,
-/* 0x1b90 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x1ba0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x1bb0 */  48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 65, 82, 77, 95, 84, 72,
-/* 0x1bc0 */  77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,117, 99,108, 95,110,
-/* 0x1bd0 */ 114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x1be0 */  56, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x1bf0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 97,108,108, 50,
-/* 0x1c00 */  69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x1c10 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1c20 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95,
-/* 0x1c30 */  65, 82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32,
-/* 0x1c40 */  46,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,
-/* 0x1c50 */ 112,114,101,115,115, 95, 56, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x1c60 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x1c70 */  91, 67, 97,108,108, 76, 90, 77, 65, 93, 58, 10, 79, 70, 70, 83,
-/* 0x1c80 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c90 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x1ca0 */  48, 48, 48, 49, 99, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77, 95,
-/* 0x1cb0 */  67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108, 95,115,116,
-/* 0x1cc0 */  97,114,116, 95,111,102, 76, 90, 77, 65, 95, 68, 69, 67, 79, 68,
-/* 0x1cd0 */  69, 10, 48, 48, 48, 48, 48, 48, 50, 52, 32, 82, 95, 65, 82, 77,
-/* 0x1ce0 */  95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,108,122,109,
-/* 0x1cf0 */  97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 50, 56,
-/* 0x1d00 */  32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32,
-/* 0x1d10 */  32, 32, 32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,
-/* 0x1d20 */ 106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 50, 99, 32, 82, 95,
-/* 0x1d30 */  65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1d40 */ 108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48,
-/* 0x1d50 */  48, 51, 48, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32,
-/* 0x1d60 */  32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,114,111,112,101,
-/* 0x1d70 */ 114,116,105,101,115, 10
+/* 0x0aa0 */  31,176,240,189,255,255,255,  0, 14,  0,  0,  0, 39,  0,  0,  0,
+/* 0x0ab0 */  23,  0,  0,  0, 21,  2,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x0ac0 */  52,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,100,  0,  0,  0,
+/* 0x0ad0 */  60,  0,  0,  0,  1,  0,  0,  0, 18,  0,  0,  0, 56,  0,  0,  0,
+/* 0x0ae0 */ 160,  0,  0,  0,  2,  0,  0,  0, 32,  0,  0,  0, 64,  0,  0,  0,
+/* 0x0af0 */ 216,  0,  0,  0,  2,  0,  0,  0, 39,  0,  0,  0,130,  0,  0,  0,
+/* 0x0b00 */  24,  1,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,  8,  0,  0,  0,
+/* 0x0b10 */ 154,  1,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0, 32,  0,  0,  0,
+/* 0x0b20 */ 162,  1,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,152,  0,  0,  0,
+/* 0x0b30 */ 194,  1,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,  4,  0,  0,  0,
+/* 0x0b40 */  90,  2,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,178,  0,  0,  0,
+/* 0x0b50 */  94,  2,  0,  0,  0,  0,  0,  0,122,  0,  0,  0,  4,  0,  0,  0,
+/* 0x0b60 */  16,  3,  0,  0,  0,  0,  0,  0,129,  0,  0,  0, 52,  0,  0,  0,
+/* 0x0b70 */  20,  3,  0,  0,  2,  0,  0,  0,138,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0b80 */  72,  3,  0,  0,  0,  0,  0,  0,150,  0,  0,  0, 96,  7,  0,  0,
+/* 0x0b90 */  72,  3,  0,  0,  2,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x0ba0 */   0,  0,  0,  0,  0,  0,  0,  0,161,  0,  0,  0,  4,  0,  0,  0,
+/* 0x0bb0 */   0,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,  7,  0,  0,  0,
+/* 0x0bc0 */   0,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,  9,  0,  0,  0,
+/* 0x0bd0 */   0,  0,  0,  0,  0,  0,  0,  0,183,  0,  0,  0, 12,  0,  0,  0,
+/* 0x0be0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0bf0 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,
+/* 0x0c00 */   0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,  3,  0,  0,  0,
+/* 0x0c10 */   0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,  4,  0,  0,  0,
+/* 0x0c20 */   0,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,  5,  0,  0,  0,
+/* 0x0c30 */   0,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,  6,  0,  0,  0,
+/* 0x0c40 */   0,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,  8,  0,  0,  0,
+/* 0x0c50 */   0,  0,  0,  0,  0,  0,  0,  0,122,  0,  0,  0, 10,  0,  0,  0,
+/* 0x0c60 */   0,  0,  0,  0,  0,  0,  0,  0,129,  0,  0,  0, 11,  0,  0,  0,
+/* 0x0c70 */   0,  0,  0,  0,  0,  0,  0,  0,138,  0,  0,  0, 12,  0,  0,  0,
+/* 0x0c80 */   0,  0,  0,  0,  0,  0,  0,  0,150,  0,  0,  0, 13,  0,  0,  0,
+/* 0x0c90 */   0,  0,  0,  0,  0,  0,  0,  0,209,  0,  0,  0,  1,  0,  0,  0,
+/* 0x0ca0 */  56,  0,  0,  0,  0,  0,  0,  0,214,  0,  0,  0,  1,  0,  0,  0,
+/* 0x0cb0 */  64,  0,  0,  0,  0,  0,  0,  0,219,  0,  0,  0,  1,  0,  0,  0,
+/* 0x0cc0 */  72,  0,  0,  0,  0,  0,  0,  0,224,  0,  0,  0,  1,  0,  0,  0,
+/* 0x0cd0 */  88,  0,  0,  0,  0,  0,  0,  0,229,  0,  0,  0, 15,  0,  0,  0,
+/* 0x0ce0 */ 173,222,173,222,  0,  0,  0,  0,249,  0,  0,  0, 15,  0,  0,  0,
+/* 0x0cf0 */ 173,222,173,222,  0,  0,  0,  0, 11,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0d00 */ 173,222,173,222,  0,  0,  0,  0, 33,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0d10 */ 173,222,173,222,  0,  0,  0,  0, 53,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0d20 */ 173,222,173,222,  0,  0,  0,  0, 68,  1,  0,  0,  2,  0,  0,  0,
+/* 0x0d30 */  48,  0,  0,  0,  0,  0,  0,  0, 73,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0d40 */ 173,222,173,222,  0,  0,  0,  0, 93,  1,  0,  0,  2,  0,  0,  0,
+/* 0x0d50 */  52,  0,  0,  0,  0,  0,  0,  0, 98,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0d60 */ 173,222,173,222,  0,  0,  0,  0,116,  1,  0,  0,  3,  0,  0,  0,
+/* 0x0d70 */  60,  0,  0,  0,  0,  0,  0,  0,121,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0d80 */ 173,222,173,222,  0,  0,  0,  0,137,  1,  0,  0,  4,  0,  0,  0,
+/* 0x0d90 */ 120,  0,  0,  0,  0,  0,  0,  0,142,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0da0 */ 173,222,173,222,  0,  0,  0,  0,159,  1,  0,  0,  4,  0,  0,  0,
+/* 0x0db0 */ 124,  0,  0,  0,  0,  0,  0,  0,164,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0dc0 */ 173,222,173,222,  0,  0,  0,  0,183,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0dd0 */ 173,222,173,222,  0,  0,  0,  0,194,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0de0 */ 173,222,173,222,  0,  0,  0,  0,212,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0df0 */ 173,222,173,222,  0,  0,  0,  0,223,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0e00 */ 173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x0e10 */ 239,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0e20 */   1,  0,  0,  0, 28,  0,  0,  0,239,  1,  0,  0,  0,  0,  0,  0,
+/* 0x0e30 */   0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 56,  0,  0,  0,
+/* 0x0e40 */ 250,  1,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0e50 */   1,  0,  0,  0, 60,  0,  0,  0,250,  1,  0,  0, 21,  0,  0,  0,
+/* 0x0e60 */   0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 64,  0,  0,  0,
+/* 0x0e70 */ 250,  1,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0e80 */   1,  0,  0,  0, 68,  0,  0,  0,250,  1,  0,  0, 23,  0,  0,  0,
+/* 0x0e90 */   0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, 88,  0,  0,  0,
+/* 0x0ea0 */ 250,  1,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0eb0 */   2,  0,  0,  0, 48,  0,  0,  0,250,  1,  0,  0, 26,  0,  0,  0,
+/* 0x0ec0 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0, 52,  0,  0,  0,
+/* 0x0ed0 */ 250,  1,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0ee0 */   3,  0,  0,  0, 60,  0,  0,  0,250,  1,  0,  0, 30,  0,  0,  0,
+/* 0x0ef0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 14,  0,  0,  0,
+/* 0x0f00 */   6,  2,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0f10 */   4,  0,  0,  0, 40,  0,  0,  0,  6,  2,  0,  0,  1,  0,  0,  0,
+/* 0x0f20 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 48,  0,  0,  0,
+/* 0x0f30 */   6,  2,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0f40 */   4,  0,  0,  0, 92,  0,  0,  0,  6,  2,  0,  0,  1,  0,  0,  0,
+/* 0x0f50 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,120,  0,  0,  0,
+/* 0x0f60 */ 250,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0f70 */   4,  0,  0,  0,124,  0,  0,  0,250,  1,  0,  0, 34,  0,  0,  0,
+/* 0x0f80 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0f90 */   6,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0fa0 */  10,  0,  0,  0,  0,  0,  0,  0,  6,  2,  0,  0,  3,  0,  0,  0,
+/* 0x0fb0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 28,  0,  0,  0,
+/* 0x0fc0 */   6,  2,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0fd0 */  11,  0,  0,  0, 36,  0,  0,  0,250,  1,  0,  0, 35,  0,  0,  0,
+/* 0x0fe0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 40,  0,  0,  0,
+/* 0x0ff0 */ 250,  1,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1000 */  11,  0,  0,  0, 44,  0,  0,  0,250,  1,  0,  0, 37,  0,  0,  0,
+/* 0x1010 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 48,  0,  0,  0,
+/* 0x1020 */ 250,  1,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1030 */  68,108,108, 83,116, 97,114,116,  0, 69,120,101, 83,116, 97,114,
+/* 0x1040 */ 116,  0, 85,110,102,105,108,116,101,114, 95, 48,120, 53, 48,  0,
+/* 0x1050 */  82,101,108,111, 99,115,  0, 73,109,112,111,114,116,115,  0, 80,
+/* 0x1060 */ 114,111, 99,101,115,115, 69,110,100,  0, 85, 80, 88, 49, 72, 69,
+/* 0x1070 */  65, 68,  0, 46,117, 99,108, 95,110,114,118, 50, 98, 95,100,101,
+/* 0x1080 */  99,111,109,112,114,101,115,115, 95, 56,  0, 67, 97,108,108, 50,
+/* 0x1090 */  66,  0, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,
+/* 0x10a0 */ 111,109,112,114,101,115,115, 95, 56,  0, 67, 97,108,108, 50, 69,
+/* 0x10b0 */   0, 67, 97,108,108, 76, 90, 77, 65,  0, 76, 90, 77, 65, 95, 68,
+/* 0x10c0 */  69, 67, 79, 68, 69,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
+/* 0x10d0 */   0, 46,114,101, 97,108, 95,115,116, 97,114,116, 95,111,102, 73,
+/* 0x10e0 */ 109,112,111,114,116,115,  0, 46,114,101, 97,108, 95,115,116, 97,
+/* 0x10f0 */ 114,116, 95,111,102, 76, 90, 77, 65, 95, 68, 69, 67, 79, 68, 69,
+/* 0x1100 */   0, 83, 82, 67, 48,  0, 68, 83, 84, 48,  0, 73, 65, 84, 84,  0,
+/* 0x1110 */  69, 78, 84, 82,  0,115,116, 97,114,116, 95,111,102, 95, 99,111,
+/* 0x1120 */ 109,112,114,101,115,115,101,100,  0, 99,111,109,112,114,101,115,
+/* 0x1130 */ 115,101,100, 95,108,101,110,103,116,104,  0,115,116, 97,114,116,
+/* 0x1140 */  95,111,102, 95,117,110, 99,111,109,112,114,101,115,115,101,100,
+/* 0x1150 */   0,117,110, 99,111,109,112,114,101,115,115,101,100, 95,108,101,
+/* 0x1160 */ 110,103,116,104,  0,111,114,105,103,105,110, 97,108, 95,101,110,
+/* 0x1170 */ 116,114,121,  0, 70, 73, 66, 83,  0,102,105,108,116,101,114, 95,
+/* 0x1180 */  98,117,102,102,101,114, 95,115,116, 97,114,116,  0, 70, 73, 66,
+/* 0x1190 */  69,  0,102,105,108,116,101,114, 95, 98,117,102,102,101,114, 95,
+/* 0x11a0 */ 101,110,100,  0, 66, 82, 69, 76,  0,115,116, 97,114,116, 95,111,
+/* 0x11b0 */ 102, 95,114,101,108,111, 99,115,  0, 66, 73, 77, 80,  0,115,116,
+/* 0x11c0 */  97,114,116, 95,111,102, 95,105,109,112,111,114,116,115,  0, 79,
+/* 0x11d0 */  78, 65, 77,  0,115,116, 97,114,116, 95,111,102, 95,100,108,108,
+/* 0x11e0 */  95,110, 97,109,101,115,  0,108,122,109, 97, 95,117, 95,108,101,
+/* 0x11f0 */ 110,  0,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,
+/* 0x1200 */ 117,115,116,  0,108,122,109, 97, 95, 99, 95,108,101,110,  0,108,
+/* 0x1210 */ 122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,  0, 82,
+/* 0x1220 */  95, 65, 82, 77, 95, 80, 67, 50, 52,  0, 82, 95, 65, 82, 77, 95,
+/* 0x1230 */  65, 66, 83, 51, 50,  0, 82, 95, 65, 82, 77, 95, 84, 72, 77, 95,
+/* 0x1240 */  67, 65, 76, 76,  0,168, 10,  0,  0, 85, 80, 88, 35, 79, 66, 74,
+/* 0x1250 */  49
 };
@@ -1,5 +1,5 @@
 /* arm.v5a-linux.elf-entry.h
-   created from arm.v5a-linux.elf-entry.bin, 14528 (0x38c0) bytes
+   created from arm.v5a-linux.elf-entry.bin, 10274 (0x2822) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V5A_LINUX_ELF_ENTRY_SIZE    14528
-#define STUB_ARM_V5A_LINUX_ELF_ENTRY_ADLER32 0x9bcfe3fa
-#define STUB_ARM_V5A_LINUX_ELF_ENTRY_CRC32   0xe7a7fe1c
+#define STUB_ARM_V5A_LINUX_ELF_ENTRY_SIZE    10274
+#define STUB_ARM_V5A_LINUX_ELF_ENTRY_ADLER32 0xbc7e0b07
+#define STUB_ARM_V5A_LINUX_ELF_ENTRY_CRC32   0xf09c339a
 
-unsigned char stub_arm_v5a_linux_elf_entry[14528] = {
+unsigned char stub_arm_v5a_linux_elf_entry[10274] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 164, 19,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -339,609 +339,344 @@ unsigned char stub_arm_v5a_linux_elf_entry[14528] = {
 /* 0x12c0 */  16, 96, 78,226, 16,224,141,229,  0, 96, 70,224,  0, 96,141,229,
 /* 0x12d0 */   0,144,160,225, 80,  0, 79,226,  0, 16,160,227,  5,112,160,227,
 /* 0x12e0 */   0,  0,  0,239,  0,  0, 80,227, 39,  0,  0,186,  4,  0,141,229,
-/* 0x12f0 */  12, 48, 30,229,254,255,255,235,  0,  0,  0,  0,102,105,108,101,
-/* 0x1300 */  32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,108,105,
-/* 0x1310 */ 116,116,108,101, 97,114,109, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x1320 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x1330 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1340 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x1350 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x1360 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70,
-/* 0x1370 */  77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1380 */  48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1390 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51,
-/* 0x13a0 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x13b0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x13c0 */  76, 89, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32,
-/* 0x13d0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x13e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x13f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42,
-/* 0x1400 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1410 */  68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 78, 82, 86, 95, 84, 65,
-/* 0x1420 */  73, 76, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1430 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1440 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32,
-/* 0x1450 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1460 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86,
-/* 0x1470 */  50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1480 */  49, 51, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1490 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52,
-/* 0x14a0 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x14b0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x14c0 */  76, 89, 10, 32, 32, 52, 32, 78, 82, 86, 50, 68, 32, 32, 32, 32,
-/* 0x14d0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 50, 56, 32, 32, 48,
-/* 0x14e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x14f0 */  48, 32, 32, 48, 48, 48, 48, 48, 49, 55, 99, 32, 32, 50, 42, 42,
-/* 0x1500 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1510 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53,
-/* 0x1520 */  32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1530 */  48, 48, 48, 48, 48,101, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1540 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1550 */  48, 48, 50, 97, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1560 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1570 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95,
-/* 0x1580 */  69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 98,
-/* 0x1590 */  56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x15a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 57, 48, 32,
-/* 0x15b0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x15c0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x15d0 */  10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x15e0 */  32, 32, 32, 48, 48, 48, 48, 48, 57, 51, 56, 32, 32, 48, 48, 48,
-/* 0x15f0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1600 */  32, 48, 48, 48, 48, 48, 52, 52, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1610 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x1620 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 76,
-/* 0x1630 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1640 */  48, 48, 52, 55, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1650 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1660 */ 100, 56, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1670 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1680 */  79, 78, 76, 89, 10, 32, 32, 57, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1690 */  67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x16a0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x16b0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 49,102, 56, 32, 32, 50,
-/* 0x16c0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x16d0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48, 32, 69, 76, 70, 77,
-/* 0x16e0 */  65, 73, 78, 89, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x16f0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1700 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 49,102, 56,
-/* 0x1710 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1720 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 69,
-/* 0x1730 */  76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1740 */  48, 48, 49, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1750 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x1760 */  49,102, 56, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1770 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1780 */  79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76,
-/* 0x1790 */  69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x17a0 */  32,100, 32, 32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48,
-/* 0x17b0 */  48, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x17c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9,
-/* 0x17d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x17e0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x17f0 */  78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x1800 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1810 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x1820 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69,
-/* 0x1830 */  76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1840 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x1850 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1860 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1870 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x1880 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1890 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x18a0 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x18b0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x18c0 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x18d0 */  32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,  9, 48,
-/* 0x18e0 */  48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90,
-/* 0x18f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1900 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48,
-/* 0x1910 */  48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48,
-/* 0x1920 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x1930 */  86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1940 */  78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1950 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65,
-/* 0x1960 */  73, 76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95,
-/* 0x1970 */  84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1980 */  32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48,
-/* 0x1990 */  48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89,
-/* 0x19a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x19b0 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19c0 */  32, 77, 70, 76, 71, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32,103,
-/* 0x19d0 */  32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9,
-/* 0x19e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10,
-/* 0x19f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70,
-/* 0x1a00 */  32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 49, 51, 99, 32,
-/* 0x1a10 */ 117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,
-/* 0x1a20 */ 114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1a30 */ 103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 68,  9, 48, 48,
-/* 0x1a40 */  48, 48, 48, 49, 50, 56, 32,117, 99,108, 95,110,114,118, 50,100,
-/* 0x1a50 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48,
-/* 0x1a60 */  48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78,
-/* 0x1a70 */  82, 86, 50, 66,  9, 48, 48, 48, 48, 48, 48,101, 99, 32,117, 99,
-/* 0x1a80 */ 108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,
-/* 0x1a90 */ 115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x1aa0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x1ab0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,122,109, 97, 68,101,
-/* 0x1ac0 */  99,111,100,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x1ad0 */  32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48,
-/* 0x1ae0 */  48, 48, 48, 48, 48, 48, 48, 32,101,110,100, 95,100,101, 99,111,
-/* 0x1af0 */ 109,112,114,101,115,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1b00 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x1b10 */  48, 48, 48, 48, 48, 48, 32, 79, 95, 66, 73, 78, 70, 79, 10, 48,
-/* 0x1b20 */  48, 48, 48, 48, 49, 48, 52, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1b30 */  69, 76, 70, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b40 */  48, 32, 99,112,114, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x1b50 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x1b60 */  69, 76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x1b70 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1b80 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x1b90 */  48, 48, 48, 48, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50,
-/* 0x1ba0 */  32, 32, 32, 32, 32, 32, 32, 77, 70, 76, 71, 10, 48, 48, 48, 48,
-/* 0x1bb0 */  48, 48, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1bc0 */  32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x1bd0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x1be0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58,
-/* 0x1bf0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x1c00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x1c10 */  69, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77,
-/* 0x1c20 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1c30 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 54, 99, 32, 82, 95, 65, 82,
-/* 0x1c40 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1c50 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 55, 48, 32, 82, 95, 65,
-/* 0x1c60 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1c70 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95,
-/* 0x1c80 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c90 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32, 82,
-/* 0x1ca0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1cb0 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32,
-/* 0x1cc0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1cd0 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 99,
-/* 0x1ce0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1cf0 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 97,
-/* 0x1d00 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1d10 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1d20 */  97, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1d30 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1d40 */  48, 98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1d50 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x1d60 */  48, 48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1d70 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1d80 */  48, 48, 48, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1d90 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1da0 */  48, 48, 48, 48,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1db0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1dc0 */  48, 48, 48, 48, 48,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1dd0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1de0 */  48, 48, 48, 48, 48, 48,101, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1df0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1e00 */  10, 48, 48, 48, 48, 48, 48,101, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1e10 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1e20 */  69, 10, 48, 48, 48, 48, 48, 48,101, 99, 32, 82, 95, 65, 82, 77,
-/* 0x1e30 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1e40 */  50, 69, 10, 48, 48, 48, 48, 48, 48,102, 56, 32, 82, 95, 65, 82,
-/* 0x1e50 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1e60 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48,102, 99, 32, 82, 95, 65,
-/* 0x1e70 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1e80 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 48, 52, 32, 82, 95,
-/* 0x1e90 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ea0 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32, 82,
-/* 0x1eb0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ec0 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 51, 52, 32,
-/* 0x1ed0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1ee0 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 51, 56,
-/* 0x1ef0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1f00 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x1f10 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x1f20 */  32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x1f30 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f40 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1f50 */  48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1f60 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x1f70 */  48, 48, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1f80 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x1f90 */  48, 48, 48, 55, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1fa0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x1fb0 */  48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1fc0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x1fd0 */  48, 48, 48, 48, 48, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1fe0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x1ff0 */  48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2000 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x2010 */  10, 48, 48, 48, 48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2020 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2030 */  68, 10, 48, 48, 48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2040 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2050 */  50, 68, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82,
-/* 0x2060 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2070 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65,
-/* 0x2080 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x2090 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32, 82, 95,
-/* 0x20a0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x20b0 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82,
-/* 0x20c0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x20d0 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,100, 56, 32,
-/* 0x20e0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x20f0 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101, 48,
-/* 0x2100 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2110 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101,
-/* 0x2120 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2130 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2140 */ 102, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2150 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x2160 */  48,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2170 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x2180 */  48, 49, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2190 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x21a0 */  48, 48, 49, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x21b0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 10, 82,
-/* 0x21c0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x21d0 */  83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79,
-/* 0x21e0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x21f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x2200 */  48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2210 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x2220 */  10, 48, 48, 48, 48, 48, 48, 55, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2230 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2240 */  66, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2250 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2260 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 55, 99, 32, 82, 95, 65, 82,
-/* 0x2270 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2280 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 56, 99, 32, 82, 95, 65,
-/* 0x2290 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x22a0 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95,
-/* 0x22b0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22c0 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 52, 32, 82,
-/* 0x22d0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22e0 */  32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 97, 48, 32,
-/* 0x22f0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2300 */  32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 48,
-/* 0x2310 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2320 */  32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98,
-/* 0x2330 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2340 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2350 */  98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2360 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x2370 */  48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2380 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48,
-/* 0x2390 */  48, 48, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x23a0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x23b0 */  48, 48, 48,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x23c0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x23d0 */  48, 48, 48, 48,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x23e0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 10,
-/* 0x23f0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x2400 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x2410 */  48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x2420 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2430 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82,
-/* 0x2440 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2450 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x2460 */  48, 48, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2470 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x2480 */  48, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2490 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x24a0 */  65, 95, 69, 76, 70, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x24b0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x24c0 */  91, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 93, 58, 10, 79, 70,
-/* 0x24d0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x24e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x24f0 */  48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2500 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2510 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95,
-/* 0x2520 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2530 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2540 */  48, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2550 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2560 */  10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2570 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2580 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,102, 52, 32,
-/* 0x2590 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x25a0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x25b0 */  48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x25c0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x25d0 */  50, 48, 10, 48, 48, 48, 48, 48, 49, 48, 56, 32, 82, 95, 65, 82,
-/* 0x25e0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x25f0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 52,
-/* 0x2600 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2610 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2620 */  48, 48, 48, 48, 49, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2630 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2640 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82, 95,
-/* 0x2650 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2660 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2670 */  49,100, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2680 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2690 */  10, 48, 48, 48, 48, 48, 50, 48, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x26a0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x26b0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 49, 56, 32,
-/* 0x26c0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x26d0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x26e0 */  48, 48, 50, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x26f0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2700 */  50, 48, 10, 48, 48, 48, 48, 48, 50, 51, 52, 32, 82, 95, 65, 82,
-/* 0x2710 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2720 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 51,
-/* 0x2730 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2740 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2750 */  48, 48, 48, 48, 50, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2760 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2770 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82, 95,
-/* 0x2780 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2790 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x27a0 */  50, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x27b0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x27c0 */  10, 48, 48, 48, 48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x27d0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x27e0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56, 32,
-/* 0x27f0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2800 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2810 */  48, 48, 50,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2820 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2830 */  50, 48, 10, 48, 48, 48, 48, 48, 51, 48, 52, 32, 82, 95, 65, 82,
-/* 0x2840 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2850 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 48,
-/* 0x2860 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2870 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2880 */  48, 48, 48, 48, 51, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2890 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x28a0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 56, 56, 32, 82, 95,
-/* 0x28b0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x28c0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x28d0 */  51, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x28e0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x28f0 */  10, 48, 48, 48, 48, 48, 51, 97, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2900 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2910 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99, 32,
-/* 0x2920 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2930 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2940 */  48, 48, 51,101, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2950 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2960 */  50, 48, 10, 48, 48, 48, 48, 48, 51,101, 56, 32, 82, 95, 65, 82,
-/* 0x2970 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2980 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 50,
-/* 0x2990 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x29a0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x29b0 */  48, 48, 48, 48, 52, 51, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x29c0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x29d0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 54, 99, 32, 82, 95,
-/* 0x29e0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x29f0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2a00 */  52, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2a10 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2a20 */  10, 48, 48, 48, 48, 48, 52, 56, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2a30 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2a40 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 98, 48, 32,
-/* 0x2a50 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2a60 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2a70 */  48, 48, 52,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2a80 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2a90 */  50, 48, 10, 48, 48, 48, 48, 48, 52,101, 99, 32, 82, 95, 65, 82,
-/* 0x2aa0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2ab0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,102,
-/* 0x2ac0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2ad0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2ae0 */  48, 48, 48, 48, 53, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2af0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2b00 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 51, 99, 32, 82, 95,
-/* 0x2b10 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b20 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2b30 */  53, 57, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2b40 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2b50 */  10, 48, 48, 48, 48, 48, 53, 97, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2b60 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2b70 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 99, 48, 32,
-/* 0x2b80 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2b90 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2ba0 */  48, 48, 53,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2bb0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2bc0 */  50, 48, 10, 48, 48, 48, 48, 48, 53,102, 99, 32, 82, 95, 65, 82,
-/* 0x2bd0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2be0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 48,
-/* 0x2bf0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2c00 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2c10 */  48, 48, 48, 48, 54, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2c20 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2c30 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 52, 56, 32, 82, 95,
-/* 0x2c40 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2c50 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2c60 */  54, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2c70 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2c80 */  10, 48, 48, 48, 48, 48, 54, 56, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2c90 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2ca0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,100, 48, 32,
-/* 0x2cb0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2cc0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2cd0 */  48, 48, 54,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2ce0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2cf0 */  50, 48, 10, 48, 48, 48, 48, 48, 55, 49, 99, 32, 82, 95, 65, 82,
-/* 0x2d00 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2d10 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 50,
-/* 0x2d20 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2d30 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2d40 */  48, 48, 48, 48, 55, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2d50 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2d60 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 55, 99, 32, 82, 95,
-/* 0x2d70 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2d80 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2d90 */  55, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2da0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2db0 */  10, 48, 48, 48, 48, 48, 55, 98, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2dc0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2dd0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 99, 52, 32,
-/* 0x2de0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2df0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2e00 */  48, 48, 55,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2e10 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2e20 */  50, 48, 10, 48, 48, 48, 48, 48, 55,102, 52, 32, 82, 95, 65, 82,
-/* 0x2e30 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2e40 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 50,
-/* 0x2e50 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2e60 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2e70 */  48, 48, 48, 48, 56, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2e80 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2e90 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 55, 99, 32, 82, 95,
-/* 0x2ea0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2eb0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2ec0 */  56, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2ed0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2ee0 */  10, 48, 48, 48, 48, 48, 56, 97, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2ef0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2f00 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,101, 56, 32,
-/* 0x2f10 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2f20 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2f30 */  48, 48, 56,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2f40 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2f50 */  50, 48, 10, 48, 48, 48, 48, 48, 56,102, 99, 32, 82, 95, 65, 82,
-/* 0x2f60 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2f70 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 57, 48,
-/* 0x2f80 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2f90 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2fa0 */  48, 48, 48, 48, 57, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2fb0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2fc0 */  69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x2fd0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90,
-/* 0x2fe0 */  77, 65, 95, 68, 69, 67, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x2ff0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3000 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x3010 */  48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3020 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3030 */  48, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77,
-/* 0x3040 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3050 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 56, 56,
-/* 0x3060 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3070 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3080 */  48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3090 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x30a0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65,
-/* 0x30b0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x30c0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x30d0 */ 101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x30e0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x30f0 */  48, 48, 48, 48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3100 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3110 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32, 82,
-/* 0x3120 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3130 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3140 */  48, 49, 49, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3150 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3160 */  48, 10, 48, 48, 48, 48, 48, 49, 49, 56, 32, 82, 95, 65, 82, 77,
-/* 0x3170 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3180 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 50, 48,
-/* 0x3190 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x31a0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x31b0 */  48, 48, 48, 49, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x31c0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x31d0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82, 95, 65,
-/* 0x31e0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x31f0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x3200 */  52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3210 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3220 */  48, 48, 48, 48, 48, 49, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3230 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3240 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 48, 32, 82,
-/* 0x3250 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3260 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3270 */  48, 49, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3280 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3290 */  48, 10, 48, 48, 48, 48, 48, 49, 56, 99, 32, 82, 95, 65, 82, 77,
-/* 0x32a0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x32b0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 57, 99,
-/* 0x32c0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x32d0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x32e0 */  48, 48, 48, 49, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x32f0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3300 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 99, 48, 32, 82, 95, 65,
-/* 0x3310 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3320 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x3330 */  99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3340 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3350 */  48, 48, 48, 48, 48, 49,100, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3360 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3370 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,100, 99, 32, 82,
-/* 0x3380 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3390 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x33a0 */  48, 49,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x33b0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x33c0 */  48, 10, 48, 48, 48, 48, 48, 49,101, 99, 32, 82, 95, 65, 82, 77,
-/* 0x33d0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x33e0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 50, 56,
-/* 0x33f0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3400 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3410 */  48, 48, 48, 50, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3420 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3430 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 52, 52, 32, 82, 95, 65,
-/* 0x3440 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3450 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x3460 */  52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3470 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3480 */  48, 48, 48, 48, 48, 50, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3490 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x34a0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 54, 56, 32, 82,
-/* 0x34b0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x34c0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x34d0 */  48, 50, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x34e0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x34f0 */  48, 10, 48, 48, 48, 48, 48, 50, 56, 99, 32, 82, 95, 65, 82, 77,
-/* 0x3500 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3510 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 97, 52,
-/* 0x3520 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3530 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3540 */  48, 48, 48, 50, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3550 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3560 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 50,100, 48, 32, 82, 95, 65,
-/* 0x3570 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3580 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x3590 */ 100, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x35a0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x35b0 */  48, 48, 48, 48, 48, 50,102, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x35c0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x35d0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32, 82,
-/* 0x35e0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x35f0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3600 */  48, 51, 49, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3610 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3620 */  48, 10, 48, 48, 48, 48, 48, 51, 50, 99, 32, 82, 95, 65, 82, 77,
-/* 0x3630 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3640 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 53, 48,
-/* 0x3650 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3660 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3670 */  48, 48, 48, 51, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3680 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3690 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 55, 48, 32, 82, 95, 65,
-/* 0x36a0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x36b0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x36c0 */  55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x36d0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x36e0 */  48, 48, 48, 48, 48, 51, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x36f0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3700 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 98, 48, 32, 82,
-/* 0x3710 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3720 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3730 */  48, 51, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3740 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3750 */  48, 10, 48, 48, 48, 48, 48, 51, 99, 56, 32, 82, 95, 65, 82, 77,
-/* 0x3760 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3770 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99,
-/* 0x3780 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3790 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x37a0 */  48, 48, 48, 52, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x37b0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x37c0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 49, 56, 32, 82, 95, 65,
-/* 0x37d0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x37e0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x37f0 */  52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3800 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3810 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x3820 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78,
-/* 0x3830 */  90, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x3840 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x3850 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,102, 48, 32, 82, 95,
-/* 0x3860 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3870 */  69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48,102,
-/* 0x3880 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3890 */  32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48,
-/* 0x38a0 */  48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51,
-/* 0x38b0 */  50, 32, 32, 32, 32, 32, 32, 32, 79, 95, 66, 73, 78, 70, 79, 10
+/* 0x12f0 */  12, 48, 30,229,254,255,255,235,  0,  0,  0,  0, 12,  0,  0,  0,
+/* 0x1300 */  21,  0,  0,  0,192,  0,  0,  0,250,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1310 */  12,  0,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1320 */   0,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1330 */   0,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1340 */  60,  1,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1350 */  40,  1,  0,  0,124,  1,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,
+/* 0x1360 */ 236,  0,  0,  0,164,  2,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x1370 */ 184,  0,  0,  0,144,  3,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1380 */  56,  9,  0,  0, 72,  4,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,
+/* 0x1390 */ 120,  4,  0,  0,128, 13,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,
+/* 0x13a0 */   0,  0,  0,  0,248, 17,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,
+/* 0x13b0 */   0,  0,  0,  0,248, 17,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,
+/* 0x13c0 */   4,  1,  0,  0,248, 17,  0,  0,  2,  0,  0,  0, 27,  0,  0,  0,
+/* 0x13d0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x13e0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,
+/* 0x13f0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x1400 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1410 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,
+/* 0x1420 */   8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,
+/* 0x1430 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,
+/* 0x1440 */  11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1450 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1460 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1470 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,
+/* 0x1480 */  10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,107,  0,  0,  0,
+/* 0x1490 */  13,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,112,  0,  0,  0,
+/* 0x14a0 */   0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,119,  0,  0,  0,
+/* 0x14b0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,142,  0,  0,  0,
+/* 0x14c0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,165,  0,  0,  0,
+/* 0x14d0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,188,  0,  0,  0,
+/* 0x14e0 */   8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,199,  0,  0,  0,
+/* 0x14f0 */  10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,214,  0,  0,  0,
+/* 0x1500 */  13,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,222,  0,  0,  0,
+/* 0x1510 */  11,  0,  0,  0,  4,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1520 */   0,  0,  0,  0,227,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1530 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,239,  0,  0,  0,
+/* 0x1540 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1550 */  16,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1560 */   0,  0,  0,  0,  3,  0,  0,  0,108,  0,  0,  0,239,  0,  0,  0,
+/* 0x1570 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1580 */ 112,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1590 */   0,  0,  0,  0,  3,  0,  0,  0,120,  0,  0,  0,239,  0,  0,  0,
+/* 0x15a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x15b0 */ 132,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15c0 */   0,  0,  0,  0,  3,  0,  0,  0,144,  0,  0,  0,239,  0,  0,  0,
+/* 0x15d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x15e0 */ 156,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15f0 */   0,  0,  0,  0,  3,  0,  0,  0,160,  0,  0,  0,239,  0,  0,  0,
+/* 0x1600 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1610 */ 172,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1620 */   0,  0,  0,  0,  3,  0,  0,  0,188,  0,  0,  0,239,  0,  0,  0,
+/* 0x1630 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1640 */ 196,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1650 */   0,  0,  0,  0,  3,  0,  0,  0,200,  0,  0,  0,239,  0,  0,  0,
+/* 0x1660 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1670 */ 208,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1680 */   0,  0,  0,  0,  3,  0,  0,  0,212,  0,  0,  0,239,  0,  0,  0,
+/* 0x1690 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x16a0 */ 224,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16b0 */   0,  0,  0,  0,  3,  0,  0,  0,228,  0,  0,  0,239,  0,  0,  0,
+/* 0x16c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x16d0 */ 236,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16e0 */   0,  0,  0,  0,  3,  0,  0,  0,248,  0,  0,  0,239,  0,  0,  0,
+/* 0x16f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1700 */ 252,  0,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1710 */   0,  0,  0,  0,  3,  0,  0,  0,  4,  1,  0,  0,239,  0,  0,  0,
+/* 0x1720 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1730 */  12,  1,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1740 */   0,  0,  0,  0,  3,  0,  0,  0, 52,  1,  0,  0,239,  0,  0,  0,
+/* 0x1750 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1760 */  56,  1,  0,  0,239,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1770 */   0,  0,  0,  0,  4,  0,  0,  0, 16,  0,  0,  0,239,  0,  0,  0,
+/* 0x1780 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1790 */ 108,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17a0 */   0,  0,  0,  0,  4,  0,  0,  0,112,  0,  0,  0,239,  0,  0,  0,
+/* 0x17b0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x17c0 */ 120,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17d0 */   0,  0,  0,  0,  4,  0,  0,  0,132,  0,  0,  0,239,  0,  0,  0,
+/* 0x17e0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x17f0 */ 144,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1800 */   0,  0,  0,  0,  4,  0,  0,  0,156,  0,  0,  0,239,  0,  0,  0,
+/* 0x1810 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1820 */ 160,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1830 */   0,  0,  0,  0,  4,  0,  0,  0,172,  0,  0,  0,239,  0,  0,  0,
+/* 0x1840 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1850 */ 188,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1860 */   0,  0,  0,  0,  4,  0,  0,  0,196,  0,  0,  0,239,  0,  0,  0,
+/* 0x1870 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1880 */ 204,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1890 */   0,  0,  0,  0,  4,  0,  0,  0,216,  0,  0,  0,239,  0,  0,  0,
+/* 0x18a0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x18b0 */ 224,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18c0 */   0,  0,  0,  0,  4,  0,  0,  0,236,  0,  0,  0,239,  0,  0,  0,
+/* 0x18d0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x18e0 */ 248,  0,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18f0 */   0,  0,  0,  0,  4,  0,  0,  0,252,  0,  0,  0,239,  0,  0,  0,
+/* 0x1900 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1910 */  32,  1,  0,  0,239,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1920 */   0,  0,  0,  0,  4,  0,  0,  0, 36,  1,  0,  0,239,  0,  0,  0,
+/* 0x1930 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1940 */  16,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1950 */   0,  0,  0,  0,  5,  0,  0,  0,112,  0,  0,  0,239,  0,  0,  0,
+/* 0x1960 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1970 */ 120,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1980 */   0,  0,  0,  0,  5,  0,  0,  0,124,  0,  0,  0,239,  0,  0,  0,
+/* 0x1990 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x19a0 */ 140,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19b0 */   0,  0,  0,  0,  5,  0,  0,  0,144,  0,  0,  0,239,  0,  0,  0,
+/* 0x19c0 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x19d0 */ 148,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19e0 */   0,  0,  0,  0,  5,  0,  0,  0,160,  0,  0,  0,239,  0,  0,  0,
+/* 0x19f0 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a00 */ 176,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a10 */   0,  0,  0,  0,  5,  0,  0,  0,180,  0,  0,  0,239,  0,  0,  0,
+/* 0x1a20 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a30 */ 188,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a40 */   0,  0,  0,  0,  5,  0,  0,  0,196,  0,  0,  0,239,  0,  0,  0,
+/* 0x1a50 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a60 */ 200,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a70 */   0,  0,  0,  0,  5,  0,  0,  0,228,  0,  0,  0,239,  0,  0,  0,
+/* 0x1a80 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a90 */ 232,  0,  0,  0,239,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1aa0 */   0,  0,  0,  0,  6,  0,  0,  0,  8,  0,  0,  0,239,  0,  0,  0,
+/* 0x1ab0 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1ac0 */  76,  0,  0,  0,239,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ad0 */   0,  0,  0,  0,  6,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0,
+/* 0x1ae0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1af0 */ 116,  0,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b00 */   0,  0,  0,  0,  7,  0,  0,  0,144,  0,  0,  0,239,  0,  0,  0,
+/* 0x1b10 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1b20 */ 184,  0,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b30 */   0,  0,  0,  0,  7,  0,  0,  0,204,  0,  0,  0,239,  0,  0,  0,
+/* 0x1b40 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1b50 */ 244,  0,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b60 */   0,  0,  0,  0,  7,  0,  0,  0,  0,  1,  0,  0,239,  0,  0,  0,
+/* 0x1b70 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1b80 */   8,  1,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b90 */   0,  0,  0,  0,  7,  0,  0,  0, 68,  1,  0,  0,239,  0,  0,  0,
+/* 0x1ba0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1bb0 */ 144,  1,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bc0 */   0,  0,  0,  0,  7,  0,  0,  0,204,  1,  0,  0,239,  0,  0,  0,
+/* 0x1bd0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1be0 */ 216,  1,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bf0 */   0,  0,  0,  0,  7,  0,  0,  0,  4,  2,  0,  0,239,  0,  0,  0,
+/* 0x1c00 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c10 */  24,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c20 */   0,  0,  0,  0,  7,  0,  0,  0, 32,  2,  0,  0,239,  0,  0,  0,
+/* 0x1c30 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c40 */  52,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c50 */   0,  0,  0,  0,  7,  0,  0,  0, 60,  2,  0,  0,239,  0,  0,  0,
+/* 0x1c60 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c70 */  64,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c80 */   0,  0,  0,  0,  7,  0,  0,  0, 76,  2,  0,  0,239,  0,  0,  0,
+/* 0x1c90 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ca0 */  88,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cb0 */   0,  0,  0,  0,  7,  0,  0,  0,164,  2,  0,  0,239,  0,  0,  0,
+/* 0x1cc0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1cd0 */ 200,  2,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  0,  0,  7,  0,  0,  0,232,  2,  0,  0,239,  0,  0,  0,
+/* 0x1cf0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d00 */   4,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d10 */   0,  0,  0,  0,  7,  0,  0,  0, 12,  3,  0,  0,239,  0,  0,  0,
+/* 0x1d20 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d30 */  60,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d40 */   0,  0,  0,  0,  7,  0,  0,  0,136,  3,  0,  0,239,  0,  0,  0,
+/* 0x1d50 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d60 */ 160,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d70 */   0,  0,  0,  0,  7,  0,  0,  0,168,  3,  0,  0,239,  0,  0,  0,
+/* 0x1d80 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d90 */ 204,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1da0 */   0,  0,  0,  0,  7,  0,  0,  0,224,  3,  0,  0,239,  0,  0,  0,
+/* 0x1db0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1dc0 */ 232,  3,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dd0 */   0,  0,  0,  0,  7,  0,  0,  0, 36,  4,  0,  0,239,  0,  0,  0,
+/* 0x1de0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1df0 */  56,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e00 */   0,  0,  0,  0,  7,  0,  0,  0,108,  4,  0,  0,239,  0,  0,  0,
+/* 0x1e10 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e20 */ 132,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0,  7,  0,  0,  0,140,  4,  0,  0,239,  0,  0,  0,
+/* 0x1e40 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e50 */ 176,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0,  7,  0,  0,  0,212,  4,  0,  0,239,  0,  0,  0,
+/* 0x1e70 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e80 */ 236,  4,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0,  7,  0,  0,  0,244,  4,  0,  0,239,  0,  0,  0,
+/* 0x1ea0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1eb0 */  24,  5,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0,  7,  0,  0,  0, 60,  5,  0,  0,239,  0,  0,  0,
+/* 0x1ed0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ee0 */ 152,  5,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0,  7,  0,  0,  0,160,  5,  0,  0,239,  0,  0,  0,
+/* 0x1f00 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f10 */ 192,  5,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f20 */   0,  0,  0,  0,  7,  0,  0,  0,228,  5,  0,  0,239,  0,  0,  0,
+/* 0x1f30 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f40 */ 252,  5,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f50 */   0,  0,  0,  0,  7,  0,  0,  0,  4,  6,  0,  0,239,  0,  0,  0,
+/* 0x1f60 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f70 */  36,  6,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0,  7,  0,  0,  0, 72,  6,  0,  0,239,  0,  0,  0,
+/* 0x1f90 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1fa0 */ 128,  6,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0,  7,  0,  0,  0,140,  6,  0,  0,239,  0,  0,  0,
+/* 0x1fc0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1fd0 */ 208,  6,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0,  7,  0,  0,  0,236,  6,  0,  0,239,  0,  0,  0,
+/* 0x1ff0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2000 */  28,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2010 */   0,  0,  0,  0,  7,  0,  0,  0, 40,  7,  0,  0,239,  0,  0,  0,
+/* 0x2020 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2030 */ 108,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,  7,  0,  0,  0,124,  7,  0,  0,239,  0,  0,  0,
+/* 0x2050 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2060 */ 156,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2070 */   0,  0,  0,  0,  7,  0,  0,  0,184,  7,  0,  0,239,  0,  0,  0,
+/* 0x2080 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2090 */ 196,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20a0 */   0,  0,  0,  0,  7,  0,  0,  0,208,  7,  0,  0,239,  0,  0,  0,
+/* 0x20b0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x20c0 */ 244,  7,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20d0 */   0,  0,  0,  0,  7,  0,  0,  0, 32,  8,  0,  0,239,  0,  0,  0,
+/* 0x20e0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x20f0 */  44,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2100 */   0,  0,  0,  0,  7,  0,  0,  0,124,  8,  0,  0,239,  0,  0,  0,
+/* 0x2110 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2120 */ 136,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2130 */   0,  0,  0,  0,  7,  0,  0,  0,160,  8,  0,  0,239,  0,  0,  0,
+/* 0x2140 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2150 */ 232,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2160 */   0,  0,  0,  0,  7,  0,  0,  0,244,  8,  0,  0,239,  0,  0,  0,
+/* 0x2170 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2180 */ 252,  8,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2190 */   0,  0,  0,  0,  7,  0,  0,  0,  4,  9,  0,  0,239,  0,  0,  0,
+/* 0x21a0 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x21b0 */  40,  9,  0,  0,239,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21c0 */   0,  0,  0,  0,  8,  0,  0,  0,120,  0,  0,  0,239,  0,  0,  0,
+/* 0x21d0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x21e0 */ 128,  0,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21f0 */   0,  0,  0,  0,  8,  0,  0,  0,136,  0,  0,  0,239,  0,  0,  0,
+/* 0x2200 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2210 */ 168,  0,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2220 */   0,  0,  0,  0,  8,  0,  0,  0,172,  0,  0,  0,239,  0,  0,  0,
+/* 0x2230 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2240 */ 228,  0,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2250 */   0,  0,  0,  0,  8,  0,  0,  0,  0,  1,  0,  0,239,  0,  0,  0,
+/* 0x2260 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2270 */  12,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2280 */   0,  0,  0,  0,  8,  0,  0,  0, 20,  1,  0,  0,239,  0,  0,  0,
+/* 0x2290 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x22a0 */  24,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22b0 */   0,  0,  0,  0,  8,  0,  0,  0, 32,  1,  0,  0,239,  0,  0,  0,
+/* 0x22c0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x22d0 */  40,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22e0 */   0,  0,  0,  0,  8,  0,  0,  0, 68,  1,  0,  0,239,  0,  0,  0,
+/* 0x22f0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2300 */  76,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2310 */   0,  0,  0,  0,  8,  0,  0,  0, 80,  1,  0,  0,239,  0,  0,  0,
+/* 0x2320 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2330 */ 128,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2340 */   0,  0,  0,  0,  8,  0,  0,  0,136,  1,  0,  0,239,  0,  0,  0,
+/* 0x2350 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2360 */ 140,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2370 */   0,  0,  0,  0,  8,  0,  0,  0,156,  1,  0,  0,239,  0,  0,  0,
+/* 0x2380 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2390 */ 160,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23a0 */   0,  0,  0,  0,  8,  0,  0,  0,192,  1,  0,  0,239,  0,  0,  0,
+/* 0x23b0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x23c0 */ 204,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23d0 */   0,  0,  0,  0,  8,  0,  0,  0,212,  1,  0,  0,239,  0,  0,  0,
+/* 0x23e0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x23f0 */ 220,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2400 */   0,  0,  0,  0,  8,  0,  0,  0,228,  1,  0,  0,239,  0,  0,  0,
+/* 0x2410 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2420 */ 236,  1,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2430 */   0,  0,  0,  0,  8,  0,  0,  0, 40,  2,  0,  0,239,  0,  0,  0,
+/* 0x2440 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2450 */  44,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2460 */   0,  0,  0,  0,  8,  0,  0,  0, 68,  2,  0,  0,239,  0,  0,  0,
+/* 0x2470 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2480 */  76,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2490 */   0,  0,  0,  0,  8,  0,  0,  0, 80,  2,  0,  0,239,  0,  0,  0,
+/* 0x24a0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x24b0 */ 104,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24c0 */   0,  0,  0,  0,  8,  0,  0,  0,132,  2,  0,  0,239,  0,  0,  0,
+/* 0x24d0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x24e0 */ 140,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24f0 */   0,  0,  0,  0,  8,  0,  0,  0,164,  2,  0,  0,239,  0,  0,  0,
+/* 0x2500 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2510 */ 200,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2520 */   0,  0,  0,  0,  8,  0,  0,  0,208,  2,  0,  0,239,  0,  0,  0,
+/* 0x2530 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2540 */ 220,  2,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2550 */   0,  0,  0,  0,  8,  0,  0,  0,244,  2,  0,  0,239,  0,  0,  0,
+/* 0x2560 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2570 */  12,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2580 */   0,  0,  0,  0,  8,  0,  0,  0, 20,  3,  0,  0,239,  0,  0,  0,
+/* 0x2590 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x25a0 */  44,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25b0 */   0,  0,  0,  0,  8,  0,  0,  0, 80,  3,  0,  0,239,  0,  0,  0,
+/* 0x25c0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x25d0 */  88,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25e0 */   0,  0,  0,  0,  8,  0,  0,  0,112,  3,  0,  0,239,  0,  0,  0,
+/* 0x25f0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2600 */ 120,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2610 */   0,  0,  0,  0,  8,  0,  0,  0,156,  3,  0,  0,239,  0,  0,  0,
+/* 0x2620 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2630 */ 176,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2640 */   0,  0,  0,  0,  8,  0,  0,  0,184,  3,  0,  0,239,  0,  0,  0,
+/* 0x2650 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2660 */ 200,  3,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2670 */   0,  0,  0,  0,  8,  0,  0,  0,204,  3,  0,  0,239,  0,  0,  0,
+/* 0x2680 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2690 */   0,  4,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26a0 */   0,  0,  0,  0,  8,  0,  0,  0, 24,  4,  0,  0,239,  0,  0,  0,
+/* 0x26b0 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x26c0 */  64,  4,  0,  0,239,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26d0 */   0,  0,  0,  0, 11,  0,  0,  0,240,  0,  0,  0,239,  0,  0,  0,
+/* 0x26e0 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x26f0 */ 252,  0,  0,  0,239,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2700 */   0,  0,  0,  0, 11,  0,  0,  0,  0,  1,  0,  0,227,  0,  0,  0,
+/* 0x2710 */  19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77,
+/* 0x2720 */  65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82,
+/* 0x2730 */  86, 95, 84, 65, 73, 76,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86,
+/* 0x2740 */  50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76,
+/* 0x2750 */  70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76,
+/* 0x2760 */  90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x2770 */  69, 67, 51, 48,  0, 69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76,
+/* 0x2780 */  70, 77, 65, 73, 78, 90,  0, 77, 70, 76, 71,  0, 95,115,116, 97,
+/* 0x2790 */ 114,116,  0,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,
+/* 0x27a0 */ 111,109,112,114,101,115,115, 95, 56,  0,117, 99,108, 95,110,114,
+/* 0x27b0 */ 118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
+/* 0x27c0 */   0,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,
+/* 0x27d0 */ 112,114,101,115,115, 95, 56,  0, 76,122,109, 97, 68,101, 99,111,
+/* 0x27e0 */ 100,101,  0,101,110,100, 95,100,101, 99,111,109,112,114,101,115,
+/* 0x27f0 */ 115,  0, 79, 95, 66, 73, 78, 70, 79,  0, 99,112,114, 48,  0, 82,
+/* 0x2800 */  95, 65, 82, 77, 95, 65, 66, 83, 51, 50,  0, 82, 95, 65, 82, 77,
+/* 0x2810 */  95, 80, 67, 50, 52,  0,252, 18,  0,  0, 85, 80, 88, 35, 79, 66,
+/* 0x2820 */  74, 49
 };
@@ -1,5 +1,5 @@
 /* arm.v5a-linux.shlib-init.h
-   created from arm.v5a-linux.shlib-init.bin, 15730 (0x3d72) bytes
+   created from arm.v5a-linux.shlib-init.bin, 11270 (0x2c06) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V5A_LINUX_SHLIB_INIT_SIZE    15730
-#define STUB_ARM_V5A_LINUX_SHLIB_INIT_ADLER32 0x26a857d5
-#define STUB_ARM_V5A_LINUX_SHLIB_INIT_CRC32   0x5ceb7d8e
+#define STUB_ARM_V5A_LINUX_SHLIB_INIT_SIZE    11270
+#define STUB_ARM_V5A_LINUX_SHLIB_INIT_ADLER32 0x70a0e4d0
+#define STUB_ARM_V5A_LINUX_SHLIB_INIT_CRC32   0xddb30af1
 
-unsigned char stub_arm_v5a_linux_shlib_init[15730] = {
+unsigned char stub_arm_v5a_linux_shlib_init[11270] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 244, 21,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -376,648 +376,369 @@ unsigned char stub_arm_v5a_linux_shlib_init[15730] = {
 /* 0x1510 */ 135,227,  0,  0,  0,239,  4,240,157,228,  1, 64,209,228,  1, 48,
 /* 0x1520 */ 209,228,  3, 68,132,225,  1, 48,209,228,  3, 72,132,225,  1, 48,
 /* 0x1530 */ 209,228,  3, 76,132,225, 30,255, 47,225,  4, 48, 19,229,255, 52,
-/* 0x1540 */ 195,227,  1, 48,131,226,  3, 32,130,224, 30,255, 47,225,102,105,
-/* 0x1550 */ 108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,
-/* 0x1560 */ 108,105,116,116,108,101, 97,114,109, 10, 10, 83,101, 99,116,105,
-/* 0x1570 */ 111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32,
-/* 0x1580 */  32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32,
-/* 0x1590 */  32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32,
-/* 0x15a0 */  32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,
-/* 0x15b0 */ 108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69,
-/* 0x15c0 */  76, 70, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x15d0 */  48, 48, 48, 49, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x15e0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x15f0 */  48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1600 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1610 */  79, 78, 76, 89, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72, 69, 65,
-/* 0x1620 */  68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1630 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1640 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32, 32, 50,
-/* 0x1650 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1660 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 78, 82, 86, 95,
-/* 0x1670 */  84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1680 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1690 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56,
-/* 0x16a0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x16b0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78,
-/* 0x16c0 */  82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x16d0 */  48, 48, 49, 51, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x16e0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x16f0 */  48, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1700 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1710 */  79, 78, 76, 89, 10, 32, 32, 52, 32, 78, 82, 86, 50, 68, 32, 32,
-/* 0x1720 */  32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 50, 56, 32,
-/* 0x1730 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1740 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 56, 52, 32, 32, 50,
-/* 0x1750 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1760 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1770 */  32, 53, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1780 */  32, 48, 48, 48, 48, 48, 48,101, 99, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1790 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x17a0 */  48, 48, 48, 48, 50, 97, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x17b0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x17c0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77,
-/* 0x17d0 */  65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x17e0 */  48, 98, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x17f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 57,
-/* 0x1800 */  56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1810 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1820 */  76, 89, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x1830 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57, 51, 56, 32, 32, 48,
-/* 0x1840 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1850 */  48, 32, 32, 48, 48, 48, 48, 48, 52, 53, 48, 32, 32, 50, 42, 42,
-/* 0x1860 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1870 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56,
-/* 0x1880 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48,
-/* 0x1890 */  48, 48, 48, 48, 52, 55, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18a0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x18b0 */  48, 48,100, 56, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x18c0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x18d0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 76, 90, 77, 65, 95,
-/* 0x18e0 */  68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1900 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 50, 48, 48, 32,
-/* 0x1910 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1920 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48, 32, 69, 76,
-/* 0x1930 */  70, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1940 */  48, 48, 51,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1950 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 50,
-/* 0x1960 */  48, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1970 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49,
-/* 0x1980 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1990 */  48, 48, 48, 48, 51, 49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19a0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x19b0 */  48, 49, 50, 51,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x19c0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x19d0 */  65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65,
-/* 0x19e0 */  66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x19f0 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48,
-/* 0x1a00 */  48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1a10 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x1a20 */  68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68,
-/* 0x1a30 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1a40 */  32, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a50 */  32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1a60 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x1a70 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x1a80 */  95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1a90 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1aa0 */  50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x1ab0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1ac0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1ad0 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x1ae0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1af0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1b00 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x1b10 */  95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1b20 */ 108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,
-/* 0x1b30 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1b40 */  78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1b50 */  32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48,
-/* 0x1b60 */  48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48,
-/* 0x1b70 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1b80 */  78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b90 */  48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48,
-/* 0x1ba0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95,
-/* 0x1bb0 */  84, 65, 73, 76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82,
-/* 0x1bc0 */  86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1bd0 */ 108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89,
-/* 0x1be0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1bf0 */  78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32,
-/* 0x1c00 */  32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48,
-/* 0x1c10 */  48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48,
-/* 0x1c20 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82,
-/* 0x1c30 */  86, 50, 69,  9, 48, 48, 48, 48, 48, 49, 51, 99, 32,117, 99,108,
-/* 0x1c40 */  95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x1c50 */ 115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32,
-/* 0x1c60 */  32, 32, 32, 70, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48,
-/* 0x1c70 */  49, 50, 56, 32,117, 99,108, 95,110,114,118, 50,100, 95,100,101,
-/* 0x1c80 */  99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48,
-/* 0x1c90 */  48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50,
-/* 0x1ca0 */  66,  9, 48, 48, 48, 48, 48, 48,101, 99, 32,117, 99,108, 95,110,
-/* 0x1cb0 */ 114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x1cc0 */  56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32,
-/* 0x1cd0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48,
-/* 0x1ce0 */  48, 48, 48, 48, 48, 48, 32, 76,122,109, 97, 68,101, 99,111,100,
-/* 0x1cf0 */ 101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32,
-/* 0x1d00 */  32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48,
-/* 0x1d10 */  48, 48, 48, 48, 32,101,110,100, 95,100,101, 99,111,109,112,114,
-/* 0x1d20 */ 101,115,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x1d30 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70,
-/* 0x1d40 */  77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x1d50 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1d60 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x1d70 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1d80 */  32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69,
-/* 0x1d90 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x1da0 */  32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70,
-/* 0x1db0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x1dc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x1dd0 */  48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1de0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1df0 */  48, 48, 48, 48, 48, 48, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1e00 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1e10 */  10, 48, 48, 48, 48, 48, 48, 55, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1e20 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1e30 */  69, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77,
-/* 0x1e40 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1e50 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32, 82, 95, 65, 82,
-/* 0x1e60 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1e70 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65,
-/* 0x1e80 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1e90 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 99, 32, 82, 95,
-/* 0x1ea0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1eb0 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 97, 48, 32, 82,
-/* 0x1ec0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ed0 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32,
-/* 0x1ee0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1ef0 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 98, 99,
-/* 0x1f00 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1f10 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 99,
-/* 0x1f20 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1f30 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1f40 */  99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1f50 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1f60 */  48,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1f70 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x1f80 */  48, 48,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1f90 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1fa0 */  48, 48, 48,101, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1fb0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1fc0 */  48, 48, 48, 48,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1fd0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1fe0 */  48, 48, 48, 48, 48,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1ff0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x2000 */  48, 48, 48, 48, 48, 48,102, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2010 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x2020 */  10, 48, 48, 48, 48, 48, 48,102, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2030 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2040 */  69, 10, 48, 48, 48, 48, 48, 49, 48, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2050 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2060 */  50, 69, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32, 82, 95, 65, 82,
-/* 0x2070 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2080 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 51, 52, 32, 82, 95, 65,
-/* 0x2090 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x20a0 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 51, 56, 32, 82, 95,
-/* 0x20b0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x20c0 */  78, 82, 86, 50, 69, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x20d0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x20e0 */  82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x20f0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2100 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 48,
-/* 0x2110 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2120 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 54,
-/* 0x2130 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2140 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2150 */  55, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2160 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x2170 */  48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2180 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x2190 */  48, 48, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x21a0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x21b0 */  48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x21c0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x21d0 */  48, 48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x21e0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x21f0 */  48, 48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2200 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x2210 */  48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2220 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x2230 */  10, 48, 48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2240 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2250 */  68, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2260 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2270 */  50, 68, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82,
-/* 0x2280 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2290 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48,100, 56, 32, 82, 95, 65,
-/* 0x22a0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x22b0 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101, 48, 32, 82, 95,
-/* 0x22c0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22d0 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101, 99, 32, 82,
-/* 0x22e0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22f0 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,102, 56, 32,
-/* 0x2300 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2310 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,102, 99,
-/* 0x2320 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2330 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 49, 50,
-/* 0x2340 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2350 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 49,
-/* 0x2360 */  50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2370 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 10, 82, 69, 76, 79,
-/* 0x2380 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x2390 */  79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83,
-/* 0x23a0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x23b0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x23c0 */  48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x23d0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x23e0 */  48, 48, 48, 48, 55, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x23f0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x2400 */  48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2410 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10,
-/* 0x2420 */  48, 48, 48, 48, 48, 48, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2430 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x2440 */  10, 48, 48, 48, 48, 48, 48, 56, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2450 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2460 */  66, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2470 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2480 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 52, 32, 82, 95, 65, 82,
-/* 0x2490 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x24a0 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 97, 48, 32, 82, 95, 65,
-/* 0x24b0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x24c0 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 48, 32, 82, 95,
-/* 0x24d0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x24e0 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82,
-/* 0x24f0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2500 */  32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 99, 32,
-/* 0x2510 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2520 */  32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 99, 52,
-/* 0x2530 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2540 */  32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 99,
-/* 0x2550 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2560 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2570 */ 101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2580 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x2590 */  48,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x25a0 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 10, 82, 69, 76,
-/* 0x25b0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x25c0 */  70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93,
-/* 0x25d0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x25e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x25f0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 65, 82,
-/* 0x2600 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2610 */  77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 52,
-/* 0x2620 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2630 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48,
-/* 0x2640 */  48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2650 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69,
-/* 0x2660 */  76, 70, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x2670 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90,
-/* 0x2680 */  77, 65, 95, 68, 69, 67, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x2690 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x26a0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x26b0 */  48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x26c0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x26d0 */  48, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77,
-/* 0x26e0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x26f0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 98, 56,
-/* 0x2700 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2710 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2720 */  48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2730 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2740 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 48,102, 52, 32, 82, 95, 65,
-/* 0x2750 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2760 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x2770 */  48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2780 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2790 */  48, 48, 48, 48, 48, 49, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x27a0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x27b0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82,
-/* 0x27c0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x27d0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x27e0 */  48, 49, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x27f0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2800 */  48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2810 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2820 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49,100, 56,
-/* 0x2830 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2840 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2850 */  48, 48, 48, 50, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2860 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2870 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 49, 56, 32, 82, 95, 65,
-/* 0x2880 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2890 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x28a0 */  50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x28b0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x28c0 */  48, 48, 48, 48, 48, 50, 51, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x28d0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x28e0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 51, 99, 32, 82,
-/* 0x28f0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2900 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2910 */  48, 50, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2920 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2930 */  48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2940 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2950 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 53, 56,
-/* 0x2960 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2970 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2980 */  48, 48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2990 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x29a0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56, 32, 82, 95, 65,
-/* 0x29b0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x29c0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x29d0 */ 101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x29e0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x29f0 */  48, 48, 48, 48, 48, 51, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2a00 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2a10 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32, 82,
-/* 0x2a20 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2a30 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2a40 */  48, 51, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2a50 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2a60 */  48, 10, 48, 48, 48, 48, 48, 51, 56, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2a70 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2a80 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 97, 48,
-/* 0x2a90 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2aa0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2ab0 */  48, 48, 48, 51, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2ac0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2ad0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99, 32, 82, 95, 65,
-/* 0x2ae0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2af0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x2b00 */ 101, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2b10 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2b20 */  48, 48, 48, 48, 48, 51,101, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2b30 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2b40 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 50, 52, 32, 82,
-/* 0x2b50 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b60 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2b70 */  48, 52, 51, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2b80 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2b90 */  48, 10, 48, 48, 48, 48, 48, 52, 54, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2ba0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2bb0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 56, 52,
-/* 0x2bc0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2bd0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2be0 */  48, 48, 48, 52, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2bf0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2c00 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 98, 48, 32, 82, 95, 65,
-/* 0x2c10 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2c20 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x2c30 */ 100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2c40 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2c50 */  48, 48, 48, 48, 48, 52,101, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2c60 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2c70 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,102, 52, 32, 82,
-/* 0x2c80 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2c90 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2ca0 */  48, 53, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2cb0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2cc0 */  48, 10, 48, 48, 48, 48, 48, 53, 51, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2cd0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2ce0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 57, 56,
-/* 0x2cf0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2d00 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2d10 */  48, 48, 48, 53, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2d20 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2d30 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 99, 48, 32, 82, 95, 65,
-/* 0x2d40 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2d50 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53,
-/* 0x2d60 */ 101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2d70 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2d80 */  48, 48, 48, 48, 48, 53,102, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2d90 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2da0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 48, 52, 32, 82,
-/* 0x2db0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2dc0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2dd0 */  48, 54, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2de0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2df0 */  48, 10, 48, 48, 48, 48, 48, 54, 52, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2e00 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2e10 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 56, 48,
-/* 0x2e20 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2e30 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2e40 */  48, 48, 48, 54, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2e50 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2e60 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 54,100, 48, 32, 82, 95, 65,
-/* 0x2e70 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2e80 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,
-/* 0x2e90 */ 101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2ea0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2eb0 */  48, 48, 48, 48, 48, 55, 49, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2ec0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2ed0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 50, 56, 32, 82,
-/* 0x2ee0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2ef0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2f00 */  48, 55, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2f10 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2f20 */  48, 10, 48, 48, 48, 48, 48, 55, 55, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2f30 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2f40 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 57, 99,
-/* 0x2f50 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2f60 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2f70 */  48, 48, 48, 55, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2f80 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2f90 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 99, 52, 32, 82, 95, 65,
-/* 0x2fa0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2fb0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,
-/* 0x2fc0 */ 100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2fd0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2fe0 */  48, 48, 48, 48, 48, 55,102, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2ff0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3000 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 50, 48, 32, 82,
-/* 0x3010 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3020 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x3030 */  48, 56, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3040 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x3050 */  48, 10, 48, 48, 48, 48, 48, 56, 55, 99, 32, 82, 95, 65, 82, 77,
-/* 0x3060 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3070 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 56, 56,
-/* 0x3080 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3090 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x30a0 */  48, 48, 48, 56, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x30b0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x30c0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 56,101, 56, 32, 82, 95, 65,
-/* 0x30d0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x30e0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,
-/* 0x30f0 */ 102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3100 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x3110 */  48, 48, 48, 48, 48, 56,102, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3120 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3130 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 57, 48, 52, 32, 82,
-/* 0x3140 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3150 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x3160 */  48, 57, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3170 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x3180 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x3190 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95,
-/* 0x31a0 */  68, 69, 67, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x31b0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x31c0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55,
-/* 0x31d0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x31e0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x31f0 */  48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3200 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3210 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 56, 56, 32, 82, 95,
-/* 0x3220 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3230 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3240 */  48, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3250 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3260 */  10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3270 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3280 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,101, 52, 32,
-/* 0x3290 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x32a0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x32b0 */  48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x32c0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x32d0 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32, 82, 95, 65, 82,
-/* 0x32e0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x32f0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 49,
-/* 0x3300 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3310 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3320 */  48, 48, 48, 48, 49, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3330 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3340 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 50, 48, 32, 82, 95,
-/* 0x3350 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3360 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3370 */  49, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3380 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3390 */  10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x33a0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x33b0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 52, 99, 32,
-/* 0x33c0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x33d0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x33e0 */  48, 48, 49, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x33f0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3400 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 48, 32, 82, 95, 65, 82,
-/* 0x3410 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3420 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 56,
-/* 0x3430 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3440 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3450 */  48, 48, 48, 48, 49, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3460 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3470 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 57, 99, 32, 82, 95,
-/* 0x3480 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3490 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x34a0 */  49, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x34b0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x34c0 */  10, 48, 48, 48, 48, 48, 49, 99, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x34d0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x34e0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32,
-/* 0x34f0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3500 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3510 */  48, 48, 49,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3520 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3530 */  49, 48, 10, 48, 48, 48, 48, 48, 49,100, 99, 32, 82, 95, 65, 82,
-/* 0x3540 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3550 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,101,
-/* 0x3560 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3570 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3580 */  48, 48, 48, 48, 49,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3590 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x35a0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 50, 56, 32, 82, 95,
-/* 0x35b0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x35c0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x35d0 */  50, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x35e0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x35f0 */  10, 48, 48, 48, 48, 48, 50, 52, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3600 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3610 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32,
-/* 0x3620 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3630 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3640 */  48, 48, 50, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3650 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3660 */  49, 48, 10, 48, 48, 48, 48, 48, 50, 54, 56, 32, 82, 95, 65, 82,
-/* 0x3670 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3680 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 56,
-/* 0x3690 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x36a0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x36b0 */  48, 48, 48, 48, 50, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x36c0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x36d0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 97, 52, 32, 82, 95,
-/* 0x36e0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x36f0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3700 */  50, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3710 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3720 */  10, 48, 48, 48, 48, 48, 50,100, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3730 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3740 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,100, 99, 32,
-/* 0x3750 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3760 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3770 */  48, 48, 50,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3780 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3790 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32, 82, 95, 65, 82,
-/* 0x37a0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x37b0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 49,
-/* 0x37c0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x37d0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x37e0 */  48, 48, 48, 48, 51, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x37f0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3800 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 53, 48, 32, 82, 95,
-/* 0x3810 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3820 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3830 */  51, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3840 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3850 */  10, 48, 48, 48, 48, 48, 51, 55, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3860 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3870 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 55, 56, 32,
-/* 0x3880 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3890 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x38a0 */  48, 48, 51, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x38b0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x38c0 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 98, 48, 32, 82, 95, 65, 82,
-/* 0x38d0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x38e0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 98,
-/* 0x38f0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3900 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3910 */  48, 48, 48, 48, 51, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3920 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3930 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99, 32, 82, 95,
-/* 0x3940 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3950 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3960 */  52, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3970 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3980 */  10, 48, 48, 48, 48, 48, 52, 49, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3990 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x39a0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 52, 48, 32,
-/* 0x39b0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x39c0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x39d0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x39e0 */  32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 90, 93, 58,
-/* 0x39f0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x3a00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x3a10 */  69, 10, 48, 48, 48, 48, 48, 48, 50, 56, 32, 82, 95, 65, 82, 77,
-/* 0x3a20 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x3a30 */  77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82,
-/* 0x3a40 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3a50 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3a60 */  56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3a70 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48,
-/* 0x3a80 */  48, 48, 48, 48, 98, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3a90 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x3aa0 */  90, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77,
-/* 0x3ab0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x3ac0 */  77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48,102, 48, 32, 82,
-/* 0x3ad0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3ae0 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3af0 */ 102, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3b00 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48,
-/* 0x3b10 */  48, 48, 48, 49, 51, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3b20 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x3b30 */  90, 10, 48, 48, 48, 48, 48, 49, 51, 56, 32, 82, 95, 65, 82, 77,
-/* 0x3b40 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x3b50 */  77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 49, 51, 99, 32, 82,
-/* 0x3b60 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3b70 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 49,
-/* 0x3b80 */  54, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3b90 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48,
-/* 0x3ba0 */  48, 48, 48, 49, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3bb0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x3bc0 */  90, 10, 48, 48, 48, 48, 48, 49, 56, 52, 32, 82, 95, 65, 82, 77,
-/* 0x3bd0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x3be0 */  77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 49, 97, 52, 32, 82,
-/* 0x3bf0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3c00 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 50,
-/* 0x3c10 */  48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3c20 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48,
-/* 0x3c30 */  48, 48, 48, 50, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3c40 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x3c50 */  90, 10, 48, 48, 48, 48, 48, 50, 49, 99, 32, 82, 95, 65, 82, 77,
-/* 0x3c60 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x3c70 */  77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 50, 51, 48, 32, 82,
-/* 0x3c80 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3c90 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 50,
-/* 0x3ca0 */  53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3cb0 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48,
-/* 0x3cc0 */  48, 48, 48, 50, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3cd0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x3ce0 */  90, 10, 48, 48, 48, 48, 48, 50, 57, 52, 32, 82, 95, 65, 82, 77,
-/* 0x3cf0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x3d00 */  77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 50, 97, 52, 32, 82,
-/* 0x3d10 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3d20 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 50,
-/* 0x3d30 */  98, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3d40 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48,
-/* 0x3d50 */  48, 48, 48, 50, 98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3d60 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x3d70 */  90, 10
+/* 0x1540 */ 195,227,  1, 48,131,226,  3, 32,130,224, 30,255, 47,225, 12,  0,
+/* 0x1550 */   0,  0, 18,  0,  0,  0,212,  0,  0,  0,220,  0,  0,  0,  0,  0,
+/* 0x1560 */   0,  0, 20,  0,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x1570 */   0,  0,  0,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0, 18,  0,
+/* 0x1580 */   0,  0,  0,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0, 27,  0,
+/* 0x1590 */   0,  0, 60,  1,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0, 33,  0,
+/* 0x15a0 */   0,  0, 40,  1,  0,  0,132,  1,  0,  0,  0,  0,  0,  0, 39,  0,
+/* 0x15b0 */   0,  0,236,  0,  0,  0,172,  2,  0,  0,  0,  0,  0,  0, 45,  0,
+/* 0x15c0 */   0,  0,184,  0,  0,  0,152,  3,  0,  0,  0,  0,  0,  0, 56,  0,
+/* 0x15d0 */   0,  0, 56,  9,  0,  0, 80,  4,  0,  0,  0,  0,  0,  0, 67,  0,
+/* 0x15e0 */   0,  0,120,  4,  0,  0,136, 13,  0,  0,  0,  0,  0,  0, 78,  0,
+/* 0x15f0 */   0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0, 89,  0,
+/* 0x1600 */   0,  0, 62,  0,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0, 98,  0,
+/* 0x1610 */   0,  0, 16,  3,  0,  0, 62, 18,  0,  0,  0,  0,  0,  0, 27,  0,
+/* 0x1620 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,
+/* 0x1630 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  0,
+/* 0x1640 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,
+/* 0x1650 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 56,  0,
+/* 0x1660 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 67,  0,
+/* 0x1670 */   0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 78,  0,
+/* 0x1680 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,  0,
+/* 0x1690 */   0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x16b0 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,
+/* 0x16c0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,
+/* 0x16d0 */   0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,107,  0,
+/* 0x16e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,114,  0,
+/* 0x16f0 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,137,  0,
+/* 0x1700 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,  0,
+/* 0x1710 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,183,  0,
+/* 0x1720 */   0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,194,  0,
+/* 0x1730 */   0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1740 */   0,  0, 16,  0,  0,  0,209,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x1750 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 16,  0,  0,  0,209,  0,
+/* 0x1760 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+/* 0x1770 */   0,  0,108,  0,  0,  0,209,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1780 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0,112,  0,  0,  0,209,  0,
+/* 0x1790 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+/* 0x17a0 */   0,  0,120,  0,  0,  0,209,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17b0 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0,132,  0,  0,  0,209,  0,
+/* 0x17c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+/* 0x17d0 */   0,  0,144,  0,  0,  0,209,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17e0 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0,156,  0,  0,  0,209,  0,
+/* 0x17f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+/* 0x1800 */   0,  0,160,  0,  0,  0,209,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1810 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0,172,  0,  0,  0,209,  0,
+/* 0x1820 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+/* 0x1830 */   0,  0,188,  0,  0,  0,209,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1840 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0,196,  0,  0,  0,209,  0,
+/* 0x1850 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+/* 0x1860 */   0,  0,200,  0,  0,  0,209,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1870 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0,208,  0,  0,  0,209,  0,
+/* 0x1880 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+/* 0x1890 */   0,  0,212,  0,  0,  0,209,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18a0 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0,224,  0,  0,  0,209,  0,
+/* 0x18b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+/* 0x18c0 */   0,  0,228,  0,  0,  0,209,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18d0 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0,236,  0,  0,  0,209,  0,
+/* 0x18e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+/* 0x18f0 */   0,  0,248,  0,  0,  0,209,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1900 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0,252,  0,  0,  0,209,  0,
+/* 0x1910 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+/* 0x1920 */   0,  0,  4,  1,  0,  0,209,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1930 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 12,  1,  0,  0,209,  0,
+/* 0x1940 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+/* 0x1950 */   0,  0, 52,  1,  0,  0,209,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1960 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 56,  1,  0,  0,209,  0,
+/* 0x1970 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,
+/* 0x1980 */   0,  0, 16,  0,  0,  0,209,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1990 */   0,  0,  0,  0,  0,  0,  4,  0,  0,  0,108,  0,  0,  0,209,  0,
+/* 0x19a0 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,
+/* 0x19b0 */   0,  0,112,  0,  0,  0,209,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x19c0 */   0,  0,  0,  0,  0,  0,  4,  0,  0,  0,120,  0,  0,  0,209,  0,
+/* 0x19d0 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,
+/* 0x19e0 */   0,  0,132,  0,  0,  0,209,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x19f0 */   0,  0,  0,  0,  0,  0,  4,  0,  0,  0,144,  0,  0,  0,209,  0,
+/* 0x1a00 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,
+/* 0x1a10 */   0,  0,156,  0,  0,  0,209,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1a20 */   0,  0,  0,  0,  0,  0,  4,  0,  0,  0,160,  0,  0,  0,209,  0,
+/* 0x1a30 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,
+/* 0x1a40 */   0,  0,172,  0,  0,  0,209,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1a50 */   0,  0,  0,  0,  0,  0,  4,  0,  0,  0,188,  0,  0,  0,209,  0,
+/* 0x1a60 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,
+/* 0x1a70 */   0,  0,196,  0,  0,  0,209,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1a80 */   0,  0,  0,  0,  0,  0,  4,  0,  0,  0,204,  0,  0,  0,209,  0,
+/* 0x1a90 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,
+/* 0x1aa0 */   0,  0,216,  0,  0,  0,209,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1ab0 */   0,  0,  0,  0,  0,  0,  4,  0,  0,  0,224,  0,  0,  0,209,  0,
+/* 0x1ac0 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,
+/* 0x1ad0 */   0,  0,236,  0,  0,  0,209,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1ae0 */   0,  0,  0,  0,  0,  0,  4,  0,  0,  0,248,  0,  0,  0,209,  0,
+/* 0x1af0 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,
+/* 0x1b00 */   0,  0,252,  0,  0,  0,209,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1b10 */   0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 32,  1,  0,  0,209,  0,
+/* 0x1b20 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,
+/* 0x1b30 */   0,  0, 36,  1,  0,  0,209,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1b40 */   0,  0,  0,  0,  0,  0,  5,  0,  0,  0, 16,  0,  0,  0,209,  0,
+/* 0x1b50 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,
+/* 0x1b60 */   0,  0,112,  0,  0,  0,209,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1b70 */   0,  0,  0,  0,  0,  0,  5,  0,  0,  0,120,  0,  0,  0,209,  0,
+/* 0x1b80 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,
+/* 0x1b90 */   0,  0,124,  0,  0,  0,209,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1ba0 */   0,  0,  0,  0,  0,  0,  5,  0,  0,  0,140,  0,  0,  0,209,  0,
+/* 0x1bb0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,
+/* 0x1bc0 */   0,  0,144,  0,  0,  0,209,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1bd0 */   0,  0,  0,  0,  0,  0,  5,  0,  0,  0,148,  0,  0,  0,209,  0,
+/* 0x1be0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,
+/* 0x1bf0 */   0,  0,160,  0,  0,  0,209,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1c00 */   0,  0,  0,  0,  0,  0,  5,  0,  0,  0,176,  0,  0,  0,209,  0,
+/* 0x1c10 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,
+/* 0x1c20 */   0,  0,180,  0,  0,  0,209,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1c30 */   0,  0,  0,  0,  0,  0,  5,  0,  0,  0,188,  0,  0,  0,209,  0,
+/* 0x1c40 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,
+/* 0x1c50 */   0,  0,196,  0,  0,  0,209,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1c60 */   0,  0,  0,  0,  0,  0,  5,  0,  0,  0,200,  0,  0,  0,209,  0,
+/* 0x1c70 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,
+/* 0x1c80 */   0,  0,228,  0,  0,  0,209,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1c90 */   0,  0,  0,  0,  0,  0,  5,  0,  0,  0,232,  0,  0,  0,209,  0,
+/* 0x1ca0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,
+/* 0x1cb0 */   0,  0,  8,  0,  0,  0,209,  0,  0,  0,  6,  0,  0,  0,  0,  0,
+/* 0x1cc0 */   0,  0,  0,  0,  0,  0,  6,  0,  0,  0, 76,  0,  0,  0,209,  0,
+/* 0x1cd0 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,
+/* 0x1ce0 */   0,  0,128,  0,  0,  0,209,  0,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x1cf0 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,116,  0,  0,  0,209,  0,
+/* 0x1d00 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1d10 */   0,  0,144,  0,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1d20 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,184,  0,  0,  0,209,  0,
+/* 0x1d30 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1d40 */   0,  0,204,  0,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1d50 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,244,  0,  0,  0,209,  0,
+/* 0x1d60 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1d70 */   0,  0,  0,  1,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1d80 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  8,  1,  0,  0,209,  0,
+/* 0x1d90 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1da0 */   0,  0, 68,  1,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1db0 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,144,  1,  0,  0,209,  0,
+/* 0x1dc0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1dd0 */   0,  0,204,  1,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1de0 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,216,  1,  0,  0,209,  0,
+/* 0x1df0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1e00 */   0,  0,  4,  2,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1e10 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 24,  2,  0,  0,209,  0,
+/* 0x1e20 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1e30 */   0,  0, 32,  2,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1e40 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 52,  2,  0,  0,209,  0,
+/* 0x1e50 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1e60 */   0,  0, 60,  2,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1e70 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 64,  2,  0,  0,209,  0,
+/* 0x1e80 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1e90 */   0,  0, 76,  2,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1ea0 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 88,  2,  0,  0,209,  0,
+/* 0x1eb0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1ec0 */   0,  0,164,  2,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1ed0 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,200,  2,  0,  0,209,  0,
+/* 0x1ee0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1ef0 */   0,  0,232,  2,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1f00 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  4,  3,  0,  0,209,  0,
+/* 0x1f10 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1f20 */   0,  0, 12,  3,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1f30 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 60,  3,  0,  0,209,  0,
+/* 0x1f40 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1f50 */   0,  0,136,  3,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1f60 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,160,  3,  0,  0,209,  0,
+/* 0x1f70 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1f80 */   0,  0,168,  3,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1f90 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,204,  3,  0,  0,209,  0,
+/* 0x1fa0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1fb0 */   0,  0,224,  3,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1fc0 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,232,  3,  0,  0,209,  0,
+/* 0x1fd0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x1fe0 */   0,  0, 36,  4,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1ff0 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 56,  4,  0,  0,209,  0,
+/* 0x2000 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x2010 */   0,  0,108,  4,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2020 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,132,  4,  0,  0,209,  0,
+/* 0x2030 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x2040 */   0,  0,140,  4,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2050 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,176,  4,  0,  0,209,  0,
+/* 0x2060 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x2070 */   0,  0,212,  4,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2080 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,236,  4,  0,  0,209,  0,
+/* 0x2090 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x20a0 */   0,  0,244,  4,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x20b0 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 24,  5,  0,  0,209,  0,
+/* 0x20c0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x20d0 */   0,  0, 60,  5,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x20e0 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,152,  5,  0,  0,209,  0,
+/* 0x20f0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x2100 */   0,  0,160,  5,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2110 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,192,  5,  0,  0,209,  0,
+/* 0x2120 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x2130 */   0,  0,228,  5,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2140 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,252,  5,  0,  0,209,  0,
+/* 0x2150 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x2160 */   0,  0,  4,  6,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2170 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 36,  6,  0,  0,209,  0,
+/* 0x2180 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x2190 */   0,  0, 72,  6,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x21a0 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,128,  6,  0,  0,209,  0,
+/* 0x21b0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x21c0 */   0,  0,140,  6,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x21d0 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,208,  6,  0,  0,209,  0,
+/* 0x21e0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x21f0 */   0,  0,236,  6,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2200 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 28,  7,  0,  0,209,  0,
+/* 0x2210 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x2220 */   0,  0, 40,  7,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2230 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,108,  7,  0,  0,209,  0,
+/* 0x2240 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x2250 */   0,  0,124,  7,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2260 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,156,  7,  0,  0,209,  0,
+/* 0x2270 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x2280 */   0,  0,184,  7,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2290 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,196,  7,  0,  0,209,  0,
+/* 0x22a0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x22b0 */   0,  0,208,  7,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x22c0 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,244,  7,  0,  0,209,  0,
+/* 0x22d0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x22e0 */   0,  0, 32,  8,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x22f0 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 44,  8,  0,  0,209,  0,
+/* 0x2300 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x2310 */   0,  0,124,  8,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2320 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,136,  8,  0,  0,209,  0,
+/* 0x2330 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x2340 */   0,  0,160,  8,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2350 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,232,  8,  0,  0,209,  0,
+/* 0x2360 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x2370 */   0,  0,244,  8,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2380 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,252,  8,  0,  0,209,  0,
+/* 0x2390 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x23a0 */   0,  0,  4,  9,  0,  0,209,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x23b0 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 40,  9,  0,  0,209,  0,
+/* 0x23c0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x23d0 */   0,  0,120,  0,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x23e0 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,128,  0,  0,  0,209,  0,
+/* 0x23f0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2400 */   0,  0,136,  0,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2410 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,168,  0,  0,  0,209,  0,
+/* 0x2420 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2430 */   0,  0,172,  0,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2440 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,228,  0,  0,  0,209,  0,
+/* 0x2450 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2460 */   0,  0,  0,  1,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2470 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 12,  1,  0,  0,209,  0,
+/* 0x2480 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2490 */   0,  0, 20,  1,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x24a0 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 24,  1,  0,  0,209,  0,
+/* 0x24b0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x24c0 */   0,  0, 32,  1,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x24d0 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 40,  1,  0,  0,209,  0,
+/* 0x24e0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x24f0 */   0,  0, 68,  1,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2500 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 76,  1,  0,  0,209,  0,
+/* 0x2510 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2520 */   0,  0, 80,  1,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2530 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,128,  1,  0,  0,209,  0,
+/* 0x2540 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2550 */   0,  0,136,  1,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2560 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,140,  1,  0,  0,209,  0,
+/* 0x2570 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2580 */   0,  0,156,  1,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2590 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,160,  1,  0,  0,209,  0,
+/* 0x25a0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x25b0 */   0,  0,192,  1,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x25c0 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,204,  1,  0,  0,209,  0,
+/* 0x25d0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x25e0 */   0,  0,212,  1,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x25f0 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,220,  1,  0,  0,209,  0,
+/* 0x2600 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2610 */   0,  0,228,  1,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2620 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,236,  1,  0,  0,209,  0,
+/* 0x2630 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2640 */   0,  0, 40,  2,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2650 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 44,  2,  0,  0,209,  0,
+/* 0x2660 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2670 */   0,  0, 68,  2,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2680 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 76,  2,  0,  0,209,  0,
+/* 0x2690 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x26a0 */   0,  0, 80,  2,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x26b0 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,104,  2,  0,  0,209,  0,
+/* 0x26c0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x26d0 */   0,  0,132,  2,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x26e0 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,140,  2,  0,  0,209,  0,
+/* 0x26f0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2700 */   0,  0,164,  2,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2710 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,200,  2,  0,  0,209,  0,
+/* 0x2720 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2730 */   0,  0,208,  2,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2740 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,220,  2,  0,  0,209,  0,
+/* 0x2750 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2760 */   0,  0,244,  2,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2770 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 12,  3,  0,  0,209,  0,
+/* 0x2780 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2790 */   0,  0, 20,  3,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x27a0 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 44,  3,  0,  0,209,  0,
+/* 0x27b0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x27c0 */   0,  0, 80,  3,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x27d0 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 88,  3,  0,  0,209,  0,
+/* 0x27e0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x27f0 */   0,  0,112,  3,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2800 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,120,  3,  0,  0,209,  0,
+/* 0x2810 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2820 */   0,  0,156,  3,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2830 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,176,  3,  0,  0,209,  0,
+/* 0x2840 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2850 */   0,  0,184,  3,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2860 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,200,  3,  0,  0,209,  0,
+/* 0x2870 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x2880 */   0,  0,204,  3,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2890 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  4,  0,  0,209,  0,
+/* 0x28a0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+/* 0x28b0 */   0,  0, 24,  4,  0,  0,209,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x28c0 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 64,  4,  0,  0,209,  0,
+/* 0x28d0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x28e0 */   0,  0, 40,  0,  0,  0,209,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x28f0 */   0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 92,  0,  0,  0,209,  0,
+/* 0x2900 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x2910 */   0,  0,132,  0,  0,  0,209,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x2920 */   0,  0,  0,  0,  0,  0, 11,  0,  0,  0,176,  0,  0,  0,209,  0,
+/* 0x2930 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x2940 */   0,  0,204,  0,  0,  0,209,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x2950 */   0,  0,  0,  0,  0,  0, 11,  0,  0,  0,240,  0,  0,  0,209,  0,
+/* 0x2960 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x2970 */   0,  0,248,  0,  0,  0,209,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x2980 */   0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 48,  1,  0,  0,209,  0,
+/* 0x2990 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x29a0 */   0,  0, 56,  1,  0,  0,209,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x29b0 */   0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 60,  1,  0,  0,209,  0,
+/* 0x29c0 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x29d0 */   0,  0,100,  1,  0,  0,209,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x29e0 */   0,  0,  0,  0,  0,  0, 11,  0,  0,  0,116,  1,  0,  0,209,  0,
+/* 0x29f0 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x2a00 */   0,  0,132,  1,  0,  0,209,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x2a10 */   0,  0,  0,  0,  0,  0, 11,  0,  0,  0,164,  1,  0,  0,209,  0,
+/* 0x2a20 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x2a30 */   0,  0,  0,  2,  0,  0,209,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x2a40 */   0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  8,  2,  0,  0,209,  0,
+/* 0x2a50 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x2a60 */   0,  0, 28,  2,  0,  0,209,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x2a70 */   0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 48,  2,  0,  0,209,  0,
+/* 0x2a80 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x2a90 */   0,  0, 88,  2,  0,  0,209,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x2aa0 */   0,  0,  0,  0,  0,  0, 11,  0,  0,  0,108,  2,  0,  0,209,  0,
+/* 0x2ab0 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x2ac0 */   0,  0,148,  2,  0,  0,209,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x2ad0 */   0,  0,  0,  0,  0,  0, 11,  0,  0,  0,164,  2,  0,  0,209,  0,
+/* 0x2ae0 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x2af0 */   0,  0,176,  2,  0,  0,209,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x2b00 */   0,  0,  0,  0,  0,  0, 11,  0,  0,  0,188,  2,  0,  0,209,  0,
+/* 0x2b10 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69, 76,
+/* 0x2b20 */  70, 77, 65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0,
+/* 0x2b30 */  78, 82, 86, 95, 84, 65, 73, 76,  0, 78, 82, 86, 50, 69,  0, 78,
+/* 0x2b40 */  82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95,
+/* 0x2b50 */  69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
+/* 0x2b60 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65,
+/* 0x2b70 */  95, 68, 69, 67, 51, 48,  0, 69, 76, 70, 77, 65, 73, 78, 89,  0,
+/* 0x2b80 */  69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,  0,
+/* 0x2b90 */ 117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,
+/* 0x2ba0 */ 114,101,115,115, 95, 56,  0,117, 99,108, 95,110,114,118, 50,100,
+/* 0x2bb0 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  0,117, 99,
+/* 0x2bc0 */ 108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,
+/* 0x2bd0 */ 115,115, 95, 56,  0, 76,122,109, 97, 68,101, 99,111,100,101,  0,
+/* 0x2be0 */ 101,110,100, 95,100,101, 99,111,109,112,114,101,115,115,  0, 82,
+/* 0x2bf0 */  95, 65, 82, 77, 95, 80, 67, 50, 52,  0, 78, 21,  0,  0, 85, 80,
+/* 0x2c00 */  88, 35, 79, 66, 74, 49
 };
@@ -1,5 +1,5 @@
 /* arm.v5t-linux.shlib-init.h
-   created from arm.v5t-linux.shlib-init.bin, 15578 (0x3cda) bytes
+   created from arm.v5t-linux.shlib-init.bin, 10941 (0x2abd) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V5T_LINUX_SHLIB_INIT_SIZE    15578
-#define STUB_ARM_V5T_LINUX_SHLIB_INIT_ADLER32 0xca642344
-#define STUB_ARM_V5T_LINUX_SHLIB_INIT_CRC32   0x44e5965c
+#define STUB_ARM_V5T_LINUX_SHLIB_INIT_SIZE    10941
+#define STUB_ARM_V5T_LINUX_SHLIB_INIT_ADLER32 0x96b5de8a
+#define STUB_ARM_V5T_LINUX_SHLIB_INIT_CRC32   0x58154917
 
-unsigned char stub_arm_v5t_linux_shlib_init[15578] = {
+unsigned char stub_arm_v5t_linux_shlib_init[10941] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 248, 20,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -361,653 +361,363 @@ unsigned char stub_arm_v5t_linux_shlib_init[15578] = {
 /* 0x1420 */ 139,120, 36,  2, 28, 67, 75,120, 36,  2, 28, 67, 11,120, 36,  2,
 /* 0x1430 */  28, 67,  4, 49,112, 71,155,  8,155,  0,  4, 59, 29,136,109,  5,
 /* 0x1440 */ 173, 10, 91,136, 91,  5, 91, 13,237, 24,  2, 53,109,  8,112, 71,
-/* 0x1450 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51,
-/* 0x1460 */  50, 45,108,105,116,116,108,101, 97,114,109, 10, 10, 83,101, 99,
-/* 0x1470 */ 116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32,
-/* 0x1480 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32,
-/* 0x1490 */  32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65,
-/* 0x14a0 */  32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32,
-/* 0x14b0 */  32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48,
-/* 0x14c0 */  32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48,
-/* 0x14d0 */  48, 48, 48, 48, 48, 97, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x14e0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x14f0 */  48, 48, 48, 51, 52, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78,
-/* 0x1500 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1510 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72,
-/* 0x1520 */  69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1530 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1540 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,100, 52, 32,
-/* 0x1550 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1560 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 78, 82,
-/* 0x1570 */  86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1580 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1590 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x15a0 */ 100, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x15b0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51,
-/* 0x15c0 */  32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x15d0 */  48, 48, 48, 48, 49, 51, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x15e0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x15f0 */  48, 48, 48,100, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1600 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1610 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 78, 82, 86, 50, 68,
-/* 0x1620 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 50,
-/* 0x1630 */  56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1640 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 49, 48, 32,
-/* 0x1650 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1660 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1670 */  10, 32, 32, 53, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32,
-/* 0x1680 */  32, 32, 32, 48, 48, 48, 48, 48, 48,101, 99, 32, 32, 48, 48, 48,
-/* 0x1690 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x16a0 */  32, 48, 48, 48, 48, 48, 51, 51, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x16b0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x16c0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 76,
-/* 0x16d0 */  90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48,
-/* 0x16e0 */  48, 48, 48, 98, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x16f0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1700 */  52, 50, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1710 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1720 */  79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1730 */  67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57, 51, 56, 32,
-/* 0x1740 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1750 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52,100, 99, 32, 32, 50,
-/* 0x1760 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1770 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1780 */  32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32,
-/* 0x1790 */  32, 48, 48, 48, 48, 48, 52, 55, 56, 32, 32, 48, 48, 48, 48, 48,
-/* 0x17a0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x17b0 */  48, 48, 48, 48,101, 49, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x17c0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x17d0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 76, 90, 77,
-/* 0x17e0 */  65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x17f0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1800 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 50, 56,
-/* 0x1810 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1820 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48, 32,
-/* 0x1830 */  69, 76, 70, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1840 */  48, 48, 48, 48, 51,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1850 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1860 */  49, 50, 56, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1870 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1880 */  49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32,
-/* 0x1890 */  32, 48, 48, 48, 48, 48, 49, 56, 52, 32, 32, 48, 48, 48, 48, 48,
-/* 0x18a0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x18b0 */  48, 48, 48, 49, 50, 99, 99, 32, 32, 50, 42, 42, 50, 32, 32, 67,
-/* 0x18c0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x18d0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32,
-/* 0x18e0 */  84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x18f0 */ 108, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,
-/* 0x1900 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 46,114,101, 97,108, 95,
-/* 0x1910 */ 115,116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65, 73, 78, 88,
-/* 0x1920 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1930 */  32, 32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1940 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1950 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48,
-/* 0x1960 */  48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x1970 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x1980 */  86, 50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86,
-/* 0x1990 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x19a0 */  32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48,
-/* 0x19b0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x19c0 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x19d0 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48,
-/* 0x19e0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x19f0 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1a00 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48,
-/* 0x1a10 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1a20 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1a30 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48,
-/* 0x1a40 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1a50 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1a60 */  32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,  9, 48, 48, 48,
-/* 0x1a70 */  48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48,
-/* 0x1a80 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1a90 */  69, 76, 70, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1aa0 */  48, 32, 46,114,101, 97,108, 95,115,116, 97,114,116, 95,111,102,
-/* 0x1ab0 */  69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ac0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1ad0 */  78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77,
-/* 0x1ae0 */  65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1af0 */  32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48,
-/* 0x1b00 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68,
-/* 0x1b10 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1b20 */  32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48, 48, 48,
-/* 0x1b30 */  48, 48, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48,
-/* 0x1b40 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76,
-/* 0x1b50 */  70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1b60 */  69, 76, 70, 77, 65, 73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b70 */  48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1b80 */  78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 95,115,116, 97,
-/* 0x1b90 */ 114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32,
-/* 0x1ba0 */  32, 32, 70, 32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 49,
-/* 0x1bb0 */  51, 99, 32,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,
-/* 0x1bc0 */ 111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1bd0 */  48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 68,
-/* 0x1be0 */   9, 48, 48, 48, 48, 48, 49, 50, 56, 32,117, 99,108, 95,110,114,
-/* 0x1bf0 */ 118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x1c00 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x1c10 */  70, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48, 48,101, 99,
-/* 0x1c20 */  32,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,
-/* 0x1c30 */ 112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c40 */  32,103, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1c50 */  67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,122,109,
-/* 0x1c60 */  97, 68,101, 99,111,100,101, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c70 */  32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x1c80 */  89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,101,110,100, 95,100,
-/* 0x1c90 */ 101, 99,111,109,112,114,101,115,115, 10, 10, 82, 69, 76, 79, 67,
-/* 0x1ca0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x1cb0 */  82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70,
-/* 0x1cc0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x1cd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x1ce0 */  48, 48, 48, 48, 48, 51, 52, 32, 82, 95, 65, 82, 77, 95, 84, 72,
-/* 0x1cf0 */  77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108, 95,
-/* 0x1d00 */ 115,116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65, 73, 78, 90,
-/* 0x1d10 */  10, 48, 48, 48, 48, 48, 48, 52, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1d20 */  84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,
-/* 0x1d30 */ 108, 95,115,116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65, 73,
-/* 0x1d40 */  78, 88, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82,
-/* 0x1d50 */  77, 95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,
-/* 0x1d60 */ 101, 97,108, 95,115,116, 97,114,116, 95,111,102, 69, 76, 70, 77,
-/* 0x1d70 */  65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 57, 54, 32, 82, 95,
-/* 0x1d80 */  65, 82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32,
-/* 0x1d90 */  46,114,101, 97,108, 95,115,116, 97,114,116, 95,111,102, 69, 76,
-/* 0x1da0 */  70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 57, 99, 32,
-/* 0x1db0 */  82, 95, 65, 82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32,
-/* 0x1dc0 */  32, 32, 46,114,101, 97,108, 95,115,116, 97,114,116, 95,111,102,
-/* 0x1dd0 */  69, 76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x1de0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x1df0 */  32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x1e00 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e10 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1e20 */  48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1e30 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x1e40 */  48, 48, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1e50 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1e60 */  48, 48, 48, 55, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1e70 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1e80 */  48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1e90 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1ea0 */  48, 48, 48, 48, 48, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1eb0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1ec0 */  48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1ed0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1ee0 */  10, 48, 48, 48, 48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1ef0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1f00 */  69, 10, 48, 48, 48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82, 77,
-/* 0x1f10 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1f20 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82,
-/* 0x1f30 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1f40 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65,
-/* 0x1f50 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1f60 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32, 82, 95,
-/* 0x1f70 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f80 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 99, 56, 32, 82,
-/* 0x1f90 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1fa0 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,100, 48, 32,
-/* 0x1fb0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1fc0 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,100, 52,
-/* 0x1fd0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1fe0 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,101,
-/* 0x1ff0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2000 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2010 */ 101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2020 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x2030 */  48,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2040 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x2050 */  48, 48,102, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2060 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x2070 */  48, 48, 48,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2080 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x2090 */  48, 48, 48, 49, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x20a0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x20b0 */  48, 48, 48, 48, 49, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x20c0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x20d0 */  48, 48, 48, 48, 48, 49, 51, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x20e0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x20f0 */  10, 48, 48, 48, 48, 48, 49, 51, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2100 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2110 */  69, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x2120 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68,
-/* 0x2130 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x2140 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x2150 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65,
-/* 0x2160 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x2170 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 54, 99, 32, 82, 95,
-/* 0x2180 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2190 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 55, 48, 32, 82,
-/* 0x21a0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x21b0 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32,
-/* 0x21c0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x21d0 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 56, 52,
-/* 0x21e0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x21f0 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 57,
-/* 0x2200 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2210 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2220 */  57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2230 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x2240 */  48, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2250 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x2260 */  48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2270 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x2280 */  48, 48, 48, 98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2290 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x22a0 */  48, 48, 48, 48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x22b0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x22c0 */  48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x22d0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x22e0 */  48, 48, 48, 48, 48, 48,100, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x22f0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x2300 */  10, 48, 48, 48, 48, 48, 48,101, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2310 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2320 */  68, 10, 48, 48, 48, 48, 48, 48,101, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2330 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2340 */  50, 68, 10, 48, 48, 48, 48, 48, 48,102, 56, 32, 82, 95, 65, 82,
-/* 0x2350 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2360 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48,102, 99, 32, 82, 95, 65,
-/* 0x2370 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x2380 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 49, 50, 48, 32, 82, 95,
-/* 0x2390 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x23a0 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 49, 50, 52, 32, 82,
-/* 0x23b0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x23c0 */  32, 78, 82, 86, 50, 68, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x23d0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x23e0 */  78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x23f0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2400 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x2410 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2420 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2430 */  55, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2440 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x2450 */  48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2460 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48,
-/* 0x2470 */  48, 48, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2480 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x2490 */  48, 48, 48, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x24a0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x24b0 */  48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x24c0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x24d0 */  48, 48, 48, 48, 48, 57, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x24e0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10,
-/* 0x24f0 */  48, 48, 48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2500 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x2510 */  10, 48, 48, 48, 48, 48, 48, 98, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2520 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2530 */  66, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2540 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2550 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65, 82,
-/* 0x2560 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2570 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32, 82, 95, 65,
-/* 0x2580 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x2590 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 99, 56, 32, 82, 95,
-/* 0x25a0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x25b0 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,101, 52, 32, 82,
-/* 0x25c0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x25d0 */  32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,101, 56, 32,
-/* 0x25e0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x25f0 */  32, 32, 78, 82, 86, 50, 66, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x2600 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x2610 */  91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70,
-/* 0x2620 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x2630 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x2640 */  48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2650 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2660 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 52, 99, 32, 82, 95,
-/* 0x2670 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2680 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2690 */  48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x26a0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x26b0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x26c0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68,
-/* 0x26d0 */  69, 67, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x26e0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x26f0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 52,
-/* 0x2700 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2710 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2720 */  48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2730 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2740 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 98, 56, 32, 82, 95, 65,
-/* 0x2750 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2760 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2770 */  99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2780 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2790 */  48, 48, 48, 48, 48, 48,102, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x27a0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x27b0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 48, 48, 32, 82,
-/* 0x27c0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x27d0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x27e0 */  48, 49, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x27f0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2800 */  48, 10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2810 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2820 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 57, 48,
-/* 0x2830 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2840 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2850 */  48, 48, 48, 49, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2860 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2870 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 49,100, 56, 32, 82, 95, 65,
-/* 0x2880 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2890 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x28a0 */  48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x28b0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x28c0 */  48, 48, 48, 48, 48, 50, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x28d0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x28e0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 50, 48, 32, 82,
-/* 0x28f0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2900 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2910 */  48, 50, 51, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2920 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2930 */  48, 10, 48, 48, 48, 48, 48, 50, 51, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2940 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2950 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 52, 48,
-/* 0x2960 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2970 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2980 */  48, 48, 48, 50, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2990 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x29a0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 53, 56, 32, 82, 95, 65,
-/* 0x29b0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x29c0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x29d0 */  97, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x29e0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x29f0 */  48, 48, 48, 48, 48, 50, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2a00 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2a10 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,101, 56, 32, 82,
-/* 0x2a20 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2a30 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2a40 */  48, 51, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2a50 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2a60 */  48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2a70 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2a80 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 51, 99,
-/* 0x2a90 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2aa0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2ab0 */  48, 48, 48, 51, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2ac0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2ad0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 97, 48, 32, 82, 95, 65,
-/* 0x2ae0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2af0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x2b00 */  97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2b10 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2b20 */  48, 48, 48, 48, 48, 51, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2b30 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2b40 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,101, 48, 32, 82,
-/* 0x2b50 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b60 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2b70 */  48, 51,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2b80 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2b90 */  48, 10, 48, 48, 48, 48, 48, 52, 50, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2ba0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2bb0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 51, 56,
-/* 0x2bc0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2bd0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2be0 */  48, 48, 48, 52, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2bf0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2c00 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 56, 52, 32, 82, 95, 65,
-/* 0x2c10 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2c20 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x2c30 */  56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2c40 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2c50 */  48, 48, 48, 48, 48, 52, 98, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2c60 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2c70 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,100, 52, 32, 82,
-/* 0x2c80 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2c90 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2ca0 */  48, 52,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2cb0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2cc0 */  48, 10, 48, 48, 48, 48, 48, 52,102, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2cd0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2ce0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 49, 56,
-/* 0x2cf0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2d00 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2d10 */  48, 48, 48, 53, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2d20 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2d30 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 57, 56, 32, 82, 95, 65,
-/* 0x2d40 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2d50 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53,
-/* 0x2d60 */  97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2d70 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2d80 */  48, 48, 48, 48, 48, 53, 99, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2d90 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2da0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53,101, 52, 32, 82,
-/* 0x2db0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2dc0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2dd0 */  48, 53,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2de0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2df0 */  48, 10, 48, 48, 48, 48, 48, 54, 48, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2e00 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2e10 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 50, 52,
-/* 0x2e20 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2e30 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2e40 */  48, 48, 48, 54, 52, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2e50 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2e60 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 56, 48, 32, 82, 95, 65,
-/* 0x2e70 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2e80 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,
-/* 0x2e90 */  56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2ea0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2eb0 */  48, 48, 48, 48, 48, 54,100, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2ec0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2ed0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,101, 99, 32, 82,
-/* 0x2ee0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2ef0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2f00 */  48, 55, 49, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2f10 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2f20 */  48, 10, 48, 48, 48, 48, 48, 55, 50, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2f30 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2f40 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 54, 99,
-/* 0x2f50 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2f60 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2f70 */  48, 48, 48, 55, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2f80 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2f90 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 57, 99, 32, 82, 95, 65,
-/* 0x2fa0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2fb0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,
-/* 0x2fc0 */  98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2fd0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2fe0 */  48, 48, 48, 48, 48, 55, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2ff0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3000 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,100, 48, 32, 82,
-/* 0x3010 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3020 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x3030 */  48, 55,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3040 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x3050 */  48, 10, 48, 48, 48, 48, 48, 56, 50, 48, 32, 82, 95, 65, 82, 77,
-/* 0x3060 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3070 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 50, 99,
-/* 0x3080 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3090 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x30a0 */  48, 48, 48, 56, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x30b0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x30c0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 56, 56, 32, 82, 95, 65,
-/* 0x30d0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x30e0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,
-/* 0x30f0 */  97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3100 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x3110 */  48, 48, 48, 48, 48, 56,101, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3120 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3130 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,102, 52, 32, 82,
-/* 0x3140 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3150 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x3160 */  48, 56,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3170 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x3180 */  48, 10, 48, 48, 48, 48, 48, 57, 48, 52, 32, 82, 95, 65, 82, 77,
-/* 0x3190 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x31a0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 57, 50, 56,
-/* 0x31b0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x31c0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 10, 82,
-/* 0x31d0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x31e0 */  83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x31f0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x3200 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x3210 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95,
-/* 0x3220 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3230 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3240 */  48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3250 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3260 */  10, 48, 48, 48, 48, 48, 48, 56, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3270 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3280 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 97, 56, 32,
-/* 0x3290 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x32a0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x32b0 */  48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x32c0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x32d0 */  49, 48, 10, 48, 48, 48, 48, 48, 48,101, 52, 32, 82, 95, 65, 82,
-/* 0x32e0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x32f0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 48,
-/* 0x3300 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3310 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3320 */  48, 48, 48, 48, 49, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3330 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3340 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 49, 52, 32, 82, 95,
-/* 0x3350 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3360 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3370 */  49, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3380 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3390 */  10, 48, 48, 48, 48, 48, 49, 50, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x33a0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x33b0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 50, 56, 32,
-/* 0x33c0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x33d0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x33e0 */  48, 48, 49, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x33f0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3400 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 52, 99, 32, 82, 95, 65, 82,
-/* 0x3410 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3420 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 53,
-/* 0x3430 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3440 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3450 */  48, 48, 48, 48, 49, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3460 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3470 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 56, 32, 82, 95,
-/* 0x3480 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3490 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x34a0 */  49, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x34b0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x34c0 */  10, 48, 48, 48, 48, 48, 49, 57, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x34d0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x34e0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 97, 48, 32,
-/* 0x34f0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3500 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3510 */  48, 48, 49, 99, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3520 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3530 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82, 95, 65, 82,
-/* 0x3540 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3550 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,100,
-/* 0x3560 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3570 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3580 */  48, 48, 48, 48, 49,100, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3590 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x35a0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,101, 52, 32, 82, 95,
-/* 0x35b0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x35c0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x35d0 */  49,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x35e0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x35f0 */  10, 48, 48, 48, 48, 48, 50, 50, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3600 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3610 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 50, 99, 32,
-/* 0x3620 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3630 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3640 */  48, 48, 50, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3650 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3660 */  49, 48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82, 95, 65, 82,
-/* 0x3670 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3680 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 53,
-/* 0x3690 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x36a0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x36b0 */  48, 48, 48, 48, 50, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x36c0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x36d0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 56, 52, 32, 82, 95,
-/* 0x36e0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x36f0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3700 */  50, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3710 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3720 */  10, 48, 48, 48, 48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3730 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3740 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56, 32,
-/* 0x3750 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3760 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3770 */  48, 48, 50,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3780 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3790 */  49, 48, 10, 48, 48, 48, 48, 48, 50,100, 99, 32, 82, 95, 65, 82,
-/* 0x37a0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x37b0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,102,
-/* 0x37c0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x37d0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x37e0 */  48, 48, 48, 48, 51, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x37f0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3800 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 49, 52, 32, 82, 95,
-/* 0x3810 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3820 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3830 */  51, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3840 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3850 */  10, 48, 48, 48, 48, 48, 51, 53, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3860 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3870 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 53, 56, 32,
-/* 0x3880 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3890 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x38a0 */  48, 48, 51, 55, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x38b0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x38c0 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 55, 56, 32, 82, 95, 65, 82,
-/* 0x38d0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x38e0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 57,
-/* 0x38f0 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3900 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3910 */  48, 48, 48, 48, 51, 98, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3920 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3930 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 98, 56, 32, 82, 95,
-/* 0x3940 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3950 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3960 */  51, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3970 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3980 */  10, 48, 48, 48, 48, 48, 51, 99, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3990 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x39a0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 48, 48, 32,
-/* 0x39b0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x39c0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x39d0 */  48, 48, 52, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x39e0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x39f0 */  49, 48, 10, 48, 48, 48, 48, 48, 52, 52, 48, 32, 82, 95, 65, 82,
-/* 0x3a00 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3a10 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x3a20 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x3a30 */  32, 91, 69, 76, 70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70,
-/* 0x3a40 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x3a50 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x3a60 */  48, 48, 48, 48, 50, 48, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77,
-/* 0x3a70 */  95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108, 95,115,
-/* 0x3a80 */ 116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x3a90 */  48, 48, 48, 48, 48, 48, 50, 56, 32, 82, 95, 65, 82, 77, 95, 84,
-/* 0x3aa0 */  72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108,
-/* 0x3ab0 */  95,115,116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65, 73, 78,
-/* 0x3ac0 */  90, 10, 48, 48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 65, 82, 77,
-/* 0x3ad0 */  95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101,
-/* 0x3ae0 */  97,108, 95,115,116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65,
-/* 0x3af0 */  73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 53, 48, 32, 82, 95, 65,
-/* 0x3b00 */  82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,
-/* 0x3b10 */ 114,101, 97,108, 95,115,116, 97,114,116, 95,111,102, 69, 76, 70,
-/* 0x3b20 */  77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 55, 99, 32, 82,
-/* 0x3b30 */  95, 65, 82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32,
-/* 0x3b40 */  32, 46,114,101, 97,108, 95,115,116, 97,114,116, 95,111,102, 69,
-/* 0x3b50 */  76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 57, 99,
-/* 0x3b60 */  32, 82, 95, 65, 82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76, 32,
-/* 0x3b70 */  32, 32, 32, 46,114,101, 97,108, 95,115,116, 97,114,116, 95,111,
-/* 0x3b80 */ 102, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3b90 */  99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3ba0 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48,
-/* 0x3bb0 */  48, 48, 48, 48,101, 99, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77,
-/* 0x3bc0 */  95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108, 95,115,
-/* 0x3bd0 */ 116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x3be0 */  48, 48, 48, 48, 48, 49, 49, 50, 32, 82, 95, 65, 82, 77, 95, 84,
-/* 0x3bf0 */  72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108,
-/* 0x3c00 */  95,115,116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65, 73, 78,
-/* 0x3c10 */  90, 10, 48, 48, 48, 48, 48, 49, 50, 97, 32, 82, 95, 65, 82, 77,
-/* 0x3c20 */  95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101,
-/* 0x3c30 */  97,108, 95,115,116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65,
-/* 0x3c40 */  73, 78, 90, 10, 48, 48, 48, 48, 48, 49, 51, 52, 32, 82, 95, 65,
-/* 0x3c50 */  82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,
-/* 0x3c60 */ 114,101, 97,108, 95,115,116, 97,114,116, 95,111,102, 69, 76, 70,
-/* 0x3c70 */  77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 49, 51,101, 32, 82,
-/* 0x3c80 */  95, 65, 82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32,
-/* 0x3c90 */  32, 46,114,101, 97,108, 95,115,116, 97,114,116, 95,111,102, 69,
-/* 0x3ca0 */  76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 49, 52, 54,
-/* 0x3cb0 */  32, 82, 95, 65, 82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76, 32,
-/* 0x3cc0 */  32, 32, 32, 46,114,101, 97,108, 95,115,116, 97,114,116, 95,111,
-/* 0x3cd0 */ 102, 69, 76, 70, 77, 65, 73, 78, 90, 10
+/* 0x1450 */  12,  0,  0,  0, 20,  0,  0,  0,205,  0,  0,  0, 25,  1,  0,  0,
+/* 0x1460 */   0,  0,  0,  0,160,  0,  0,  0, 52,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1470 */   9,  0,  0,  0,  0,  0,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1480 */  18,  0,  0,  0,  0,  0,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1490 */  27,  0,  0,  0, 60,  1,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14a0 */  33,  0,  0,  0, 40,  1,  0,  0, 16,  2,  0,  0,  0,  0,  0,  0,
+/* 0x14b0 */  39,  0,  0,  0,236,  0,  0,  0, 56,  3,  0,  0,  0,  0,  0,  0,
+/* 0x14c0 */  45,  0,  0,  0,184,  0,  0,  0, 36,  4,  0,  0,  0,  0,  0,  0,
+/* 0x14d0 */  56,  0,  0,  0, 56,  9,  0,  0,220,  4,  0,  0,  0,  0,  0,  0,
+/* 0x14e0 */  67,  0,  0,  0,120,  4,  0,  0, 20, 14,  0,  0,  0,  0,  0,  0,
+/* 0x14f0 */  78,  0,  0,  0,  0,  0,  0,  0,140, 18,  0,  0,  0,  0,  0,  0,
+/* 0x1500 */  89,  0,  0,  0, 62,  0,  0,  0,140, 18,  0,  0,  0,  0,  0,  0,
+/* 0x1510 */  98,  0,  0,  0,132,  1,  0,  0,204, 18,  0,  0,  2,  0,  0,  0,
+/* 0x1520 */ 107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1530 */  27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1540 */  33,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1550 */  39,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1560 */  45,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1570 */  56,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1580 */  67,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1590 */  78,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15a0 */  98,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15b0 */ 130,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15d0 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15e0 */  18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15f0 */  89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1600 */ 153,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1610 */ 160,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1620 */ 183,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1630 */ 206,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1640 */ 229,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1650 */ 240,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1660 */   0,  0,  0,  0, 52,  0,  0,  0,255,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1670 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0,
+/* 0x1680 */ 255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1690 */   0,  0,  0,  0,144,  0,  0,  0,255,  0,  0,  0,  9,  0,  0,  0,
+/* 0x16a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,150,  0,  0,  0,
+/* 0x16b0 */ 255,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16c0 */   0,  0,  0,  0,156,  0,  0,  0,255,  0,  0,  0,  9,  0,  0,  0,
+/* 0x16d0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 16,  0,  0,  0,
+/* 0x16e0 */  14,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16f0 */   3,  0,  0,  0,108,  0,  0,  0, 14,  1,  0,  0,  1,  0,  0,  0,
+/* 0x1700 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,112,  0,  0,  0,
+/* 0x1710 */  14,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1720 */   3,  0,  0,  0,120,  0,  0,  0, 14,  1,  0,  0,  1,  0,  0,  0,
+/* 0x1730 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,132,  0,  0,  0,
+/* 0x1740 */  14,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1750 */   3,  0,  0,  0,144,  0,  0,  0, 14,  1,  0,  0,  1,  0,  0,  0,
+/* 0x1760 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,156,  0,  0,  0,
+/* 0x1770 */  14,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1780 */   3,  0,  0,  0,160,  0,  0,  0, 14,  1,  0,  0,  1,  0,  0,  0,
+/* 0x1790 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,172,  0,  0,  0,
+/* 0x17a0 */  14,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17b0 */   3,  0,  0,  0,188,  0,  0,  0, 14,  1,  0,  0,  1,  0,  0,  0,
+/* 0x17c0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,196,  0,  0,  0,
+/* 0x17d0 */  14,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17e0 */   3,  0,  0,  0,200,  0,  0,  0, 14,  1,  0,  0,  1,  0,  0,  0,
+/* 0x17f0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,208,  0,  0,  0,
+/* 0x1800 */  14,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1810 */   3,  0,  0,  0,212,  0,  0,  0, 14,  1,  0,  0,  1,  0,  0,  0,
+/* 0x1820 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,224,  0,  0,  0,
+/* 0x1830 */  14,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1840 */   3,  0,  0,  0,228,  0,  0,  0, 14,  1,  0,  0,  1,  0,  0,  0,
+/* 0x1850 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,236,  0,  0,  0,
+/* 0x1860 */  14,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1870 */   3,  0,  0,  0,248,  0,  0,  0, 14,  1,  0,  0,  1,  0,  0,  0,
+/* 0x1880 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,252,  0,  0,  0,
+/* 0x1890 */  14,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18a0 */   3,  0,  0,  0,  4,  1,  0,  0, 14,  1,  0,  0,  1,  0,  0,  0,
+/* 0x18b0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 12,  1,  0,  0,
+/* 0x18c0 */  14,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18d0 */   3,  0,  0,  0, 52,  1,  0,  0, 14,  1,  0,  0,  1,  0,  0,  0,
+/* 0x18e0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 56,  1,  0,  0,
+/* 0x18f0 */  14,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1900 */   4,  0,  0,  0, 16,  0,  0,  0, 14,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1910 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,108,  0,  0,  0,
+/* 0x1920 */  14,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1930 */   4,  0,  0,  0,112,  0,  0,  0, 14,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1940 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,120,  0,  0,  0,
+/* 0x1950 */  14,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1960 */   4,  0,  0,  0,132,  0,  0,  0, 14,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1970 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,144,  0,  0,  0,
+/* 0x1980 */  14,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1990 */   4,  0,  0,  0,156,  0,  0,  0, 14,  1,  0,  0,  2,  0,  0,  0,
+/* 0x19a0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,160,  0,  0,  0,
+/* 0x19b0 */  14,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19c0 */   4,  0,  0,  0,172,  0,  0,  0, 14,  1,  0,  0,  2,  0,  0,  0,
+/* 0x19d0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,188,  0,  0,  0,
+/* 0x19e0 */  14,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19f0 */   4,  0,  0,  0,196,  0,  0,  0, 14,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1a00 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,204,  0,  0,  0,
+/* 0x1a10 */  14,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a20 */   4,  0,  0,  0,216,  0,  0,  0, 14,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1a30 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,224,  0,  0,  0,
+/* 0x1a40 */  14,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a50 */   4,  0,  0,  0,236,  0,  0,  0, 14,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1a60 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,248,  0,  0,  0,
+/* 0x1a70 */  14,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a80 */   4,  0,  0,  0,252,  0,  0,  0, 14,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1a90 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 32,  1,  0,  0,
+/* 0x1aa0 */  14,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ab0 */   4,  0,  0,  0, 36,  1,  0,  0, 14,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1ac0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0, 16,  0,  0,  0,
+/* 0x1ad0 */  14,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ae0 */   5,  0,  0,  0,112,  0,  0,  0, 14,  1,  0,  0,  3,  0,  0,  0,
+/* 0x1af0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,120,  0,  0,  0,
+/* 0x1b00 */  14,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b10 */   5,  0,  0,  0,124,  0,  0,  0, 14,  1,  0,  0,  3,  0,  0,  0,
+/* 0x1b20 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,140,  0,  0,  0,
+/* 0x1b30 */  14,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b40 */   5,  0,  0,  0,144,  0,  0,  0, 14,  1,  0,  0,  3,  0,  0,  0,
+/* 0x1b50 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,148,  0,  0,  0,
+/* 0x1b60 */  14,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b70 */   5,  0,  0,  0,160,  0,  0,  0, 14,  1,  0,  0,  3,  0,  0,  0,
+/* 0x1b80 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,176,  0,  0,  0,
+/* 0x1b90 */  14,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ba0 */   5,  0,  0,  0,180,  0,  0,  0, 14,  1,  0,  0,  3,  0,  0,  0,
+/* 0x1bb0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,188,  0,  0,  0,
+/* 0x1bc0 */  14,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bd0 */   5,  0,  0,  0,196,  0,  0,  0, 14,  1,  0,  0,  3,  0,  0,  0,
+/* 0x1be0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,200,  0,  0,  0,
+/* 0x1bf0 */  14,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c00 */   5,  0,  0,  0,228,  0,  0,  0, 14,  1,  0,  0,  3,  0,  0,  0,
+/* 0x1c10 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,232,  0,  0,  0,
+/* 0x1c20 */  14,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c30 */   6,  0,  0,  0,  8,  0,  0,  0, 14,  1,  0,  0,  7,  0,  0,  0,
+/* 0x1c40 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0, 76,  0,  0,  0,
+/* 0x1c50 */  14,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c60 */   6,  0,  0,  0,128,  0,  0,  0, 14,  1,  0,  0,  4,  0,  0,  0,
+/* 0x1c70 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,116,  0,  0,  0,
+/* 0x1c80 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c90 */   7,  0,  0,  0,144,  0,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1ca0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,184,  0,  0,  0,
+/* 0x1cb0 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cc0 */   7,  0,  0,  0,204,  0,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1cd0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,244,  0,  0,  0,
+/* 0x1ce0 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cf0 */   7,  0,  0,  0,  0,  1,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1d00 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  8,  1,  0,  0,
+/* 0x1d10 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d20 */   7,  0,  0,  0, 68,  1,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1d30 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,144,  1,  0,  0,
+/* 0x1d40 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d50 */   7,  0,  0,  0,204,  1,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1d60 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,216,  1,  0,  0,
+/* 0x1d70 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d80 */   7,  0,  0,  0,  4,  2,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1d90 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 24,  2,  0,  0,
+/* 0x1da0 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1db0 */   7,  0,  0,  0, 32,  2,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1dc0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 52,  2,  0,  0,
+/* 0x1dd0 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1de0 */   7,  0,  0,  0, 60,  2,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 64,  2,  0,  0,
+/* 0x1e00 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e10 */   7,  0,  0,  0, 76,  2,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 88,  2,  0,  0,
+/* 0x1e30 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e40 */   7,  0,  0,  0,164,  2,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,200,  2,  0,  0,
+/* 0x1e60 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e70 */   7,  0,  0,  0,232,  2,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  4,  3,  0,  0,
+/* 0x1e90 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ea0 */   7,  0,  0,  0, 12,  3,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 60,  3,  0,  0,
+/* 0x1ec0 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ed0 */   7,  0,  0,  0,136,  3,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,160,  3,  0,  0,
+/* 0x1ef0 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f00 */   7,  0,  0,  0,168,  3,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,204,  3,  0,  0,
+/* 0x1f20 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f30 */   7,  0,  0,  0,224,  3,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,232,  3,  0,  0,
+/* 0x1f50 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f60 */   7,  0,  0,  0, 36,  4,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 56,  4,  0,  0,
+/* 0x1f80 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f90 */   7,  0,  0,  0,108,  4,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1fa0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,132,  4,  0,  0,
+/* 0x1fb0 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fc0 */   7,  0,  0,  0,140,  4,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,176,  4,  0,  0,
+/* 0x1fe0 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ff0 */   7,  0,  0,  0,212,  4,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x2000 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,236,  4,  0,  0,
+/* 0x2010 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2020 */   7,  0,  0,  0,244,  4,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x2030 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 24,  5,  0,  0,
+/* 0x2040 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2050 */   7,  0,  0,  0, 60,  5,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x2060 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,152,  5,  0,  0,
+/* 0x2070 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2080 */   7,  0,  0,  0,160,  5,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x2090 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,192,  5,  0,  0,
+/* 0x20a0 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20b0 */   7,  0,  0,  0,228,  5,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,252,  5,  0,  0,
+/* 0x20d0 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20e0 */   7,  0,  0,  0,  4,  6,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 36,  6,  0,  0,
+/* 0x2100 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2110 */   7,  0,  0,  0, 72,  6,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x2120 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,128,  6,  0,  0,
+/* 0x2130 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2140 */   7,  0,  0,  0,140,  6,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x2150 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,208,  6,  0,  0,
+/* 0x2160 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2170 */   7,  0,  0,  0,236,  6,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x2180 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 28,  7,  0,  0,
+/* 0x2190 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21a0 */   7,  0,  0,  0, 40,  7,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x21b0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,108,  7,  0,  0,
+/* 0x21c0 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21d0 */   7,  0,  0,  0,124,  7,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x21e0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,156,  7,  0,  0,
+/* 0x21f0 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2200 */   7,  0,  0,  0,184,  7,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x2210 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,196,  7,  0,  0,
+/* 0x2220 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2230 */   7,  0,  0,  0,208,  7,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x2240 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,244,  7,  0,  0,
+/* 0x2250 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2260 */   7,  0,  0,  0, 32,  8,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x2270 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 44,  8,  0,  0,
+/* 0x2280 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2290 */   7,  0,  0,  0,124,  8,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x22a0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,136,  8,  0,  0,
+/* 0x22b0 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22c0 */   7,  0,  0,  0,160,  8,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x22d0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,232,  8,  0,  0,
+/* 0x22e0 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22f0 */   7,  0,  0,  0,244,  8,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x2300 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,252,  8,  0,  0,
+/* 0x2310 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2320 */   7,  0,  0,  0,  4,  9,  0,  0, 14,  1,  0,  0,  5,  0,  0,  0,
+/* 0x2330 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 40,  9,  0,  0,
+/* 0x2340 */  14,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2350 */   8,  0,  0,  0,120,  0,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2360 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,128,  0,  0,  0,
+/* 0x2370 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2380 */   8,  0,  0,  0,136,  0,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2390 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,168,  0,  0,  0,
+/* 0x23a0 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23b0 */   8,  0,  0,  0,172,  0,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x23c0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,228,  0,  0,  0,
+/* 0x23d0 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23e0 */   8,  0,  0,  0,  0,  1,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x23f0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 12,  1,  0,  0,
+/* 0x2400 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2410 */   8,  0,  0,  0, 20,  1,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2420 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 24,  1,  0,  0,
+/* 0x2430 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2440 */   8,  0,  0,  0, 32,  1,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2450 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 40,  1,  0,  0,
+/* 0x2460 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2470 */   8,  0,  0,  0, 68,  1,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2480 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 76,  1,  0,  0,
+/* 0x2490 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24a0 */   8,  0,  0,  0, 80,  1,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x24b0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,128,  1,  0,  0,
+/* 0x24c0 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24d0 */   8,  0,  0,  0,136,  1,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x24e0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,140,  1,  0,  0,
+/* 0x24f0 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2500 */   8,  0,  0,  0,156,  1,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2510 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,160,  1,  0,  0,
+/* 0x2520 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2530 */   8,  0,  0,  0,192,  1,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2540 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,204,  1,  0,  0,
+/* 0x2550 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2560 */   8,  0,  0,  0,212,  1,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2570 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,220,  1,  0,  0,
+/* 0x2580 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2590 */   8,  0,  0,  0,228,  1,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x25a0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,236,  1,  0,  0,
+/* 0x25b0 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25c0 */   8,  0,  0,  0, 40,  2,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x25d0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 44,  2,  0,  0,
+/* 0x25e0 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25f0 */   8,  0,  0,  0, 68,  2,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2600 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 76,  2,  0,  0,
+/* 0x2610 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2620 */   8,  0,  0,  0, 80,  2,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2630 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,104,  2,  0,  0,
+/* 0x2640 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2650 */   8,  0,  0,  0,132,  2,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2660 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,140,  2,  0,  0,
+/* 0x2670 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2680 */   8,  0,  0,  0,164,  2,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2690 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,200,  2,  0,  0,
+/* 0x26a0 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26b0 */   8,  0,  0,  0,208,  2,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x26c0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,220,  2,  0,  0,
+/* 0x26d0 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26e0 */   8,  0,  0,  0,244,  2,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x26f0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 12,  3,  0,  0,
+/* 0x2700 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2710 */   8,  0,  0,  0, 20,  3,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2720 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 44,  3,  0,  0,
+/* 0x2730 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2740 */   8,  0,  0,  0, 80,  3,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2750 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 88,  3,  0,  0,
+/* 0x2760 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2770 */   8,  0,  0,  0,112,  3,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2780 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,120,  3,  0,  0,
+/* 0x2790 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27a0 */   8,  0,  0,  0,156,  3,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x27b0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,176,  3,  0,  0,
+/* 0x27c0 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27d0 */   8,  0,  0,  0,184,  3,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x27e0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,200,  3,  0,  0,
+/* 0x27f0 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2800 */   8,  0,  0,  0,204,  3,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2810 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  4,  0,  0,
+/* 0x2820 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2830 */   8,  0,  0,  0, 24,  4,  0,  0, 14,  1,  0,  0,  6,  0,  0,  0,
+/* 0x2840 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 64,  4,  0,  0,
+/* 0x2850 */  14,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2860 */  11,  0,  0,  0, 32,  0,  0,  0,255,  0,  0,  0,  9,  0,  0,  0,
+/* 0x2870 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 40,  0,  0,  0,
+/* 0x2880 */ 255,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2890 */  11,  0,  0,  0, 48,  0,  0,  0,255,  0,  0,  0,  9,  0,  0,  0,
+/* 0x28a0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 80,  0,  0,  0,
+/* 0x28b0 */ 255,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28c0 */  11,  0,  0,  0,124,  0,  0,  0,255,  0,  0,  0,  9,  0,  0,  0,
+/* 0x28d0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,156,  0,  0,  0,
+/* 0x28e0 */ 255,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28f0 */  11,  0,  0,  0,204,  0,  0,  0, 14,  1,  0,  0,  8,  0,  0,  0,
+/* 0x2900 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,236,  0,  0,  0,
+/* 0x2910 */ 255,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2920 */  11,  0,  0,  0, 18,  1,  0,  0,255,  0,  0,  0,  9,  0,  0,  0,
+/* 0x2930 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 42,  1,  0,  0,
+/* 0x2940 */ 255,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2950 */  11,  0,  0,  0, 52,  1,  0,  0,255,  0,  0,  0,  9,  0,  0,  0,
+/* 0x2960 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 62,  1,  0,  0,
+/* 0x2970 */ 255,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2980 */  11,  0,  0,  0, 70,  1,  0,  0,255,  0,  0,  0,  9,  0,  0,  0,
+/* 0x2990 */   0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,
+/* 0x29a0 */   0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 95, 84, 65,
+/* 0x29b0 */  73, 76,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78,
+/* 0x29c0 */  82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0,
+/* 0x29d0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95,
+/* 0x29e0 */  68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
+/* 0x29f0 */   0, 69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73,
+/* 0x2a00 */  78, 90,  0, 46,114,101, 97,108, 95,115,116, 97,114,116, 95,111,
+/* 0x2a10 */ 102, 69, 76, 70, 77, 65, 73, 78, 88,  0, 46,114,101, 97,108, 95,
+/* 0x2a20 */ 115,116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65, 73, 78, 90,
+/* 0x2a30 */   0, 95,115,116, 97,114,116,  0,117, 99,108, 95,110,114,118, 50,
+/* 0x2a40 */ 101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  0,117,
+/* 0x2a50 */  99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,
+/* 0x2a60 */ 101,115,115, 95, 56,  0,117, 99,108, 95,110,114,118, 50, 98, 95,
+/* 0x2a70 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56,  0, 76,122,109,
+/* 0x2a80 */  97, 68,101, 99,111,100,101,  0,101,110,100, 95,100,101, 99,111,
+/* 0x2a90 */ 109,112,114,101,115,115,  0, 82, 95, 65, 82, 77, 95, 84, 72, 77,
+/* 0x2aa0 */  95, 67, 65, 76, 76,  0, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
+/* 0x2ab0 */   0, 80, 20,  0,  0, 85, 80, 88, 35, 79, 66, 74, 49
 };
@@ -1,5 +1,5 @@
 /* arm64-darwin.macho-entry.h
-   created from arm64-darwin.macho-entry.bin, 8233 (0x2029) bytes
+   created from arm64-darwin.macho-entry.bin, 6191 (0x182f) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM64_DARWIN_MACHO_ENTRY_SIZE    8233
-#define STUB_ARM64_DARWIN_MACHO_ENTRY_ADLER32 0xbb791a9f
-#define STUB_ARM64_DARWIN_MACHO_ENTRY_CRC32   0x4c579503
+#define STUB_ARM64_DARWIN_MACHO_ENTRY_SIZE    6191
+#define STUB_ARM64_DARWIN_MACHO_ENTRY_ADLER32 0x301c1cb0
+#define STUB_ARM64_DARWIN_MACHO_ENTRY_CRC32   0xf1dcd408
 
-unsigned char stub_arm64_darwin_macho_entry[8233] = {
+unsigned char stub_arm64_darwin_macho_entry[6191] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,183,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,240, 23,  0,  0,  0,  0,  0,  0,
@@ -369,186 +369,58 @@ unsigned char stub_arm64_darwin_macho_entry[8233] = {
 /* 0x14a0 */   1,  0,128,210,168,  0,128, 82,  1,  0,  0,212,224, 15, 29,248,
 /* 0x14b0 */   1,  0,  0, 16,246,  3,  1,170, 32, 68, 64,184,214, 66, 32,203,
 /* 0x14c0 */ 246, 19,  0,249,244,  3,  1,170, 32, 68, 64,184,148, 66, 32,203,
-/* 0x14d0 */  21, 32,  0,209,173,255,255,151,102,105,108,101, 32,102,111,114,
-/* 0x14e0 */ 109, 97,116, 32,101,108,102, 54, 52, 45,108,105,116,116,108,101,
-/* 0x14f0 */  97, 97,114, 99,104, 54, 52, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x1500 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x1510 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1520 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1530 */  32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1540 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x1550 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 77, 65, 67,
-/* 0x1560 */  72, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1570 */  48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1580 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1590 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52,
-/* 0x15a0 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x15b0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x15c0 */  76, 89, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32,
-/* 0x15d0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x15e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x15f0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1600 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32, 32, 50, 42, 42,
-/* 0x1610 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1620 */  68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 78, 82, 86, 50, 69, 32,
-/* 0x1630 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 55, 99,
-/* 0x1640 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1650 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1660 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32, 32,
-/* 0x1670 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1680 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86,
-/* 0x1690 */  50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x16a0 */  49, 55, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16b0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16c0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 99,
-/* 0x16d0 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x16e0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32,
-/* 0x16f0 */  78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1700 */  48, 48, 48, 49, 52, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1710 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1720 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1730 */  48, 51, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1740 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1750 */  32, 53, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32,
-/* 0x1760 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1770 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1780 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1790 */  48, 48, 48, 48, 52, 55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x17a0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x17b0 */  89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x17c0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 48, 99, 32, 32, 48, 48,
-/* 0x17d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x17e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x17f0 */  32, 32, 48, 48, 48, 48, 48, 52, 55, 56, 32, 32, 50, 42, 42, 48,
-/* 0x1800 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x1810 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32,
-/* 0x1820 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48,
-/* 0x1830 */  48, 48, 48, 57, 54, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1840 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1850 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1860 */  48, 53, 56, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1870 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1880 */  32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32,
-/* 0x1890 */  32, 48, 48, 48, 48, 48, 52, 57, 99, 32, 32, 48, 48, 48, 48, 48,
-/* 0x18a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x18b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x18c0 */  48, 48, 48, 48,101,101, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x18d0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x18e0 */  89, 10, 32, 32, 57, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x18f0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1900 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1910 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1920 */  32, 32, 48, 48, 48, 48, 49, 51, 56, 56, 32, 32, 50, 42, 42, 48,
-/* 0x1930 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x1940 */  79, 78, 76, 89, 10, 32, 49, 48, 32, 77, 65, 67, 72, 77, 65, 73,
-/* 0x1950 */  78, 89, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1960 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1970 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1980 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 51, 56, 56, 32, 32, 50,
-/* 0x1990 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x19a0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 77, 65, 67, 72,
-/* 0x19b0 */  77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x19c0 */  53, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19e0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 51, 56, 56,
-/* 0x19f0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1a00 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1a10 */  89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10,
-/* 0x1a20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a30 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1a40 */  67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a50 */  48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10,
-/* 0x1a60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a70 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72, 77, 65, 73,
-/* 0x1a80 */  78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a90 */  48, 48, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 10, 48, 48,
-/* 0x1aa0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1ab0 */  32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88,
-/* 0x1ac0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ad0 */  48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48,
-/* 0x1ae0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1af0 */  32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48,
-/* 0x1b00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x1b10 */  82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b20 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1b30 */  32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b40 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1b50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1b60 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48,
-/* 0x1b70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82,
-/* 0x1b80 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b90 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x1ba0 */  50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bb0 */  48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1bc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1bd0 */ 100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48, 48,
-/* 0x1be0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86,
-/* 0x1bf0 */  95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c00 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1c10 */  90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1c20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1c30 */  69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c40 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1c50 */  90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1c60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1c70 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c80 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1c90 */  90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1ca0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1cb0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cc0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77,
-/* 0x1cd0 */  65, 67, 72, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ce0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 65, 67, 72, 77, 65,
-/* 0x1cf0 */  73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d00 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67,
-/* 0x1d10 */  72, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48,
-/* 0x1d30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1d40 */ 103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 69,  9, 48, 48,
-/* 0x1d50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 55, 99, 32,117,
-/* 0x1d60 */  99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,
-/* 0x1d70 */ 101,115,115, 95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d80 */  48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32,
-/* 0x1d90 */  78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1da0 */  48, 48, 48, 49, 55, 48, 32,117, 99,108, 95,110,114,118, 50,100,
-/* 0x1db0 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 51, 50, 10, 48,
-/* 0x1dc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1dd0 */ 103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 66,  9, 48, 48,
-/* 0x1de0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 52, 52, 32,117,
-/* 0x1df0 */  99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,
-/* 0x1e00 */ 101,115,115, 95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e10 */  48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e20 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48,
-/* 0x1e30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,122,109, 97,
-/* 0x1e40 */  68,101, 99,111,100,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e50 */  48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e60 */  77, 65, 67, 72, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1e70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,101,110,100, 95,100,
-/* 0x1e80 */ 101, 99,111,109,112,114,101,115,115, 10, 10, 82, 69, 76, 79, 67,
-/* 0x1e90 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x1ea0 */  82, 32, 91, 77, 65, 67, 72, 77, 65, 73, 78, 88, 93, 58, 10, 79,
-/* 0x1eb0 */  70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ec0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ed0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ee0 */  48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 65, 65, 82, 67, 72,
-/* 0x1ef0 */  54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32, 77, 65, 67, 72, 77,
-/* 0x1f00 */  65, 73, 78, 90, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f10 */  48, 48, 48, 48, 48,100, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x1f20 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x1f30 */  91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70,
-/* 0x1f40 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x1f50 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f60 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f70 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 65, 65, 82, 67, 72, 54,
-/* 0x1f80 */  52, 95, 67, 79, 78, 68, 66, 82, 49, 57, 32, 32, 76, 90, 77, 65,
-/* 0x1f90 */  95, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x1fa0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x1fb0 */  77, 65, 67, 72, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83,
-/* 0x1fc0 */  69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80,
-/* 0x1fd0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1fe0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ff0 */  48, 48, 49, 50, 56, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95,
-/* 0x2000 */  65, 68, 82, 95, 80, 82, 69, 76, 95, 76, 79, 50, 49, 32, 32, 95,
-/* 0x2010 */ 115,116, 97,114,116, 45, 48,120, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2020 */  48, 48, 48, 48, 48, 48, 48, 56, 10
+/* 0x14d0 */  21, 32,  0,209,173,255,255,151, 12,  0,  0,  0, 18,  0,  0,  0,
+/* 0x14e0 */   3,  0,  0,  0, 19,  1,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x14f0 */  64,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1500 */  72,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,124,  1,  0,  0,
+/* 0x1510 */  72,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,112,  1,  0,  0,
+/* 0x1520 */ 196,  1,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0, 68,  1,  0,  0,
+/* 0x1530 */  52,  3,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1540 */ 120,  4,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0, 12,  1,  0,  0,
+/* 0x1550 */ 120,  4,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,104,  9,  0,  0,
+/* 0x1560 */ 132,  5,  0,  0,  0,  0,  0,  0, 68,  0,  0,  0,156,  4,  0,  0,
+/* 0x1570 */ 236, 14,  0,  0,  0,  0,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1580 */ 136, 19,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1590 */ 136, 19,  0,  0,  0,  0,  0,  0,100,  0,  0,  0, 80,  1,  0,  0,
+/* 0x15a0 */ 136, 19,  0,  0,  0,  0,  0,  0, 79,  0,  0,  0,  9,  0,  0,  0,
+/* 0x15b0 */   0,  0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0, 11,  0,  0,  0,
+/* 0x15c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15d0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  1,  0,  0,  0,
+/* 0x15e0 */   0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,  2,  0,  0,  0,
+/* 0x15f0 */   0,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1600 */   0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1610 */   0,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1620 */   0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1630 */   0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1640 */   0,  0,  0,  0,  0,  0,  0,  0, 68,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1650 */   0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1660 */   0,  0,  0,  0,  0,  0,  0,  0,110,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1670 */   0,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1680 */   0,  0,  0,  0,  0,  0,  0,  0,141,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1690 */   0,  0,  0,  0,  0,  0,  0,  0,165,  0,  0,  0,  4,  0,  0,  0,
+/* 0x16a0 */   0,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0,  8,  0,  0,  0,
+/* 0x16b0 */   0,  0,  0,  0,  0,  0,  0,  0,200,  0,  0,  0, 10,  0,  0,  0,
+/* 0x16c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x16d0 */ 215,  0,  0,  0,  1,  0,  0,  0,220,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16e0 */   6,  0,  0,  0,  4,  0,  0,  0,232,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16f0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 40,  1,  0,  0,
+/* 0x1700 */ 251,  0,  0,  0, 12,  0,  0,  0,248,255,255,255,255,255,255,255,
+/* 0x1710 */  77, 65, 67, 72, 77, 65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69,
+/* 0x1720 */  65, 68,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78,
+/* 0x1730 */  82, 86, 50, 66,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 76, 90,
+/* 0x1740 */  77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x1750 */  67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76,
+/* 0x1760 */  90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 77, 65, 67, 72, 77, 65,
+/* 0x1770 */  73, 78, 89,  0, 77, 65, 67, 72, 77, 65, 73, 78, 90,  0, 95,115,
+/* 0x1780 */ 116, 97,114,116,  0,117, 99,108, 95,110,114,118, 50,101, 95,100,
+/* 0x1790 */ 101, 99,111,109,112,114,101,115,115, 95, 51, 50,  0,117, 99,108,
+/* 0x17a0 */  95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,
+/* 0x17b0 */ 115, 95, 51, 50,  0,117, 99,108, 95,110,114,118, 50, 98, 95,100,
+/* 0x17c0 */ 101, 99,111,109,112,114,101,115,115, 95, 51, 50,  0, 76,122,109,
+/* 0x17d0 */  97, 68,101, 99,111,100,101,  0,101,110,100, 95,100,101, 99,111,
+/* 0x17e0 */ 109,112,114,101,115,115,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52,
+/* 0x17f0 */  95, 67, 65, 76, 76, 50, 54,  0, 82, 95, 65, 65, 82, 67, 72, 54,
+/* 0x1800 */  52, 95, 67, 79, 78, 68, 66, 82, 49, 57,  0, 82, 95, 65, 65, 82,
+/* 0x1810 */  67, 72, 54, 52, 95, 65, 68, 82, 95, 80, 82, 69, 76, 95, 76, 79,
+/* 0x1820 */  50, 49,  0,216, 20,  0,  0, 85, 80, 88, 35, 79, 66, 74, 49
 };
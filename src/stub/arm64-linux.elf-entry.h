@@ -1,5 +1,5 @@
 /* arm64-linux.elf-entry.h
-   created from arm64-linux.elf-entry.bin, 8386 (0x20c2) bytes
+   created from arm64-linux.elf-entry.bin, 6289 (0x1891) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM64_LINUX_ELF_ENTRY_SIZE    8386
-#define STUB_ARM64_LINUX_ELF_ENTRY_ADLER32 0xfafe35da
-#define STUB_ARM64_LINUX_ELF_ENTRY_CRC32   0xbf96f88d
+#define STUB_ARM64_LINUX_ELF_ENTRY_SIZE    6289
+#define STUB_ARM64_LINUX_ELF_ENTRY_ADLER32 0x5a0a23a3
+#define STUB_ARM64_LINUX_ELF_ENTRY_CRC32   0x1be5f294
 
-unsigned char stub_arm64_linux_elf_entry[8386] = {
+unsigned char stub_arm64_linux_elf_entry[6289] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,183,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,104, 24,  0,  0,  0,  0,  0,  0,
@@ -372,193 +372,62 @@ unsigned char stub_arm64_linux_elf_entry[8386] = {
 /* 0x14d0 */  34,  0,160,210,250,  3,  2,203, 96, 12,128, 18,161,252,255, 16,
 /* 0x14e0 */   2,  0,128, 82,  8,  7,128, 82,  1,  0,  0,212,251,  3,  0, 42,
 /* 0x14f0 */  31,  0,  0,113,203,252,255, 84,185,255,255,151,  0,  0,  0,  0,
-/* 0x1500 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 54,
-/* 0x1510 */  52, 45,108,105,116,116,108,101, 97, 97,114, 99,104, 54, 52, 10,
-/* 0x1520 */  10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78,
-/* 0x1530 */  97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,
-/* 0x1540 */ 101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32,
-/* 0x1550 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x1560 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,
-/* 0x1570 */ 111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115,
-/* 0x1580 */  10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32, 32,
-/* 0x1590 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 56, 32, 32, 48, 48, 48,
-/* 0x15a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x15b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x15c0 */  32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x15d0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x15e0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 78,
-/* 0x15f0 */  82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1600 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1610 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1620 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1630 */  48, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1640 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1650 */  50, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32,
-/* 0x1660 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1670 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1680 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1690 */  48, 48, 48, 48, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x16a0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x16b0 */  10, 32, 32, 51, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32,
-/* 0x16c0 */  32, 32, 32, 48, 48, 48, 48, 48, 49, 55, 99, 32, 32, 48, 48, 48,
-/* 0x16d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x16e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x16f0 */  32, 48, 48, 48, 48, 48, 48, 52, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1700 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1710 */  78, 76, 89, 10, 32, 32, 52, 32, 78, 82, 86, 50, 68, 32, 32, 32,
-/* 0x1720 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 55, 48, 32, 32,
-/* 0x1730 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1740 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1750 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 99, 52, 32, 32, 50, 42,
-/* 0x1760 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1770 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 78, 82, 86, 50, 66,
-/* 0x1780 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 52,
-/* 0x1790 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x17a0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x17b0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 51, 52, 32,
-/* 0x17c0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x17d0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90,
-/* 0x17e0 */  77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x17f0 */  48, 49, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1800 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1810 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52,
-/* 0x1820 */  55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1830 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1840 */  78, 76, 89, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1850 */  50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 57, 54, 56, 32, 32,
-/* 0x1860 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1870 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1880 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 53, 56, 52, 32, 32, 50, 42,
-/* 0x1890 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x18a0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95,
-/* 0x18b0 */  68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 52, 57,
-/* 0x18c0 */  99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18d0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18e0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,101,101, 99, 32,
-/* 0x18f0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1900 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 76, 90,
-/* 0x1910 */  77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1920 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1930 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1940 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 51,
-/* 0x1950 */  56, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1960 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48,
-/* 0x1970 */  32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1980 */  48, 48, 48, 48, 48, 51,101, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1990 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x19a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x19b0 */  48, 49, 51, 56, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x19c0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x19d0 */  32, 49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32,
-/* 0x19e0 */  32, 32, 48, 48, 48, 48, 48, 49, 51, 56, 32, 32, 48, 48, 48, 48,
-/* 0x19f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1a00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1a10 */  48, 48, 48, 48, 49, 51, 99, 56, 32, 32, 50, 42, 42, 50, 32, 32,
-/* 0x1a20 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1a30 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76,
-/* 0x1a40 */  32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a50 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1a60 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48,
-/* 0x1a70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77,
-/* 0x1a80 */  65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a90 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1aa0 */  32, 69, 76, 70, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1ab0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65,
-/* 0x1ac0 */  73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ad0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70,
-/* 0x1ae0 */  77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1af0 */  48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10,
-/* 0x1b00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b10 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65,
-/* 0x1b20 */  68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b30 */  48, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48,
-/* 0x1b40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1b50 */  32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48,
-/* 0x1b60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x1b70 */  82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b80 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1b90 */  32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ba0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1bb0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1bc0 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48,
-/* 0x1bd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82,
-/* 0x1be0 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bf0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x1c00 */  50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c10 */  48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1c20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1c30 */ 100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48,
-/* 0x1c40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x1c50 */  90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1c60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1c70 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48,
-/* 0x1c80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x1c90 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1ca0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1cb0 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48,
-/* 0x1cc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x1cd0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1ce0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1cf0 */ 100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48,
-/* 0x1d00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70,
-/* 0x1d10 */  77, 65, 73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x1d30 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d40 */  48, 48, 48, 48, 48, 32, 77, 70, 76, 71, 10, 48, 48, 48, 48, 48,
-/* 0x1d50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 32,103, 32, 32, 32,
-/* 0x1d60 */  32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48,
-/* 0x1d70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 95,115,
-/* 0x1d80 */ 116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d90 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82,
-/* 0x1da0 */  86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1db0 */  48, 49, 55, 99, 32,117, 99,108, 95,110,114,118, 50,101, 95,100,
-/* 0x1dc0 */ 101, 99,111,109,112,114,101,115,115, 95, 51, 50, 10, 48, 48, 48,
-/* 0x1dd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x1de0 */  32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48,
-/* 0x1df0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 55, 48, 32,117, 99,108,
-/* 0x1e00 */  95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x1e10 */ 115, 95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e20 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82,
-/* 0x1e30 */  86, 50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e40 */  48, 49, 52, 52, 32,117, 99,108, 95,110,114,118, 50, 98, 95,100,
-/* 0x1e50 */ 101, 99,111,109,112,114,101,115,115, 95, 51, 50, 10, 48, 48, 48,
-/* 0x1e60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x1e70 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x1e80 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e90 */  48, 32, 76,122,109, 97, 68,101, 99,111,100,101, 10, 48, 48, 48,
-/* 0x1ea0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x1eb0 */  32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48,
-/* 0x1ec0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1ed0 */ 101,110,100, 95,100,101, 99,111,109,112,114,101,115,115, 10, 48,
-/* 0x1ee0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1ef0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x1f00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 79,
-/* 0x1f10 */  95, 66, 73, 78, 70, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x1f20 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x1f30 */  69, 76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x1f40 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x1f50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x1f60 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f70 */  48, 48, 48, 48, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 65,
-/* 0x1f80 */  66, 83, 51, 50, 32, 32, 32, 77, 70, 76, 71, 10, 48, 48, 48, 48,
-/* 0x1f90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 65,
-/* 0x1fa0 */  65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32, 69,
-/* 0x1fb0 */  76, 70, 77, 65, 73, 78, 90, 43, 48,120, 48, 48, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 48, 48, 48, 48,101, 52, 10, 10, 82, 69, 76, 79,
-/* 0x1fd0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x1fe0 */  79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58,
-/* 0x1ff0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2000 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2010 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2020 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 65, 65, 82,
-/* 0x2030 */  67, 72, 54, 52, 95, 67, 79, 78, 68, 66, 82, 49, 57, 32, 32, 76,
-/* 0x2040 */  90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x2050 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x2060 */  82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70,
-/* 0x2070 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x2080 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2090 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20a0 */  48, 48, 48, 48, 49, 51, 52, 32, 82, 95, 65, 65, 82, 67, 72, 54,
-/* 0x20b0 */  52, 95, 65, 66, 83, 51, 50, 32, 32, 32, 79, 95, 66, 73, 78, 70,
-/* 0x20c0 */  79, 10
+/* 0x1500 */  12,  0,  0,  0, 20,  0,  0,  0,  4,  0,  0,  0, 21,  1,  0,  0,
+/* 0x1510 */   0,  0,  0,  0,  8,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1520 */   9,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1530 */  18,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1540 */  27,  0,  0,  0,124,  1,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1550 */  33,  0,  0,  0,112,  1,  0,  0,196,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1560 */  39,  0,  0,  0, 68,  1,  0,  0, 52,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1570 */  45,  0,  0,  0, 12,  1,  0,  0,120,  4,  0,  0,  0,  0,  0,  0,
+/* 0x1580 */  56,  0,  0,  0,104,  9,  0,  0,132,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1590 */  67,  0,  0,  0,156,  4,  0,  0,236, 14,  0,  0,  0,  0,  0,  0,
+/* 0x15a0 */  78,  0,  0,  0,  0,  0,  0,  0,136, 19,  0,  0,  0,  0,  0,  0,
+/* 0x15b0 */  89,  0,  0,  0, 62,  0,  0,  0,136, 19,  0,  0,  0,  0,  0,  0,
+/* 0x15c0 */  98,  0,  0,  0, 56,  1,  0,  0,200, 19,  0,  0,  2,  0,  0,  0,
+/* 0x15d0 */  78,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15e0 */  98,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1600 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1610 */  18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1620 */  27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1630 */  33,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1640 */  39,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1650 */  45,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1660 */  56,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1670 */  67,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1680 */  89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1690 */ 107,  0,  0,  0, 13,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x16a0 */ 112,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16b0 */ 119,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16c0 */ 143,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16d0 */ 167,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16e0 */ 191,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16f0 */ 202,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1700 */ 217,  0,  0,  0, 13,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x1710 */   0,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0, 12,  0,  0,  0,
+/* 0x1720 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1730 */ 241,  0,  0,  0,  1,  0,  0,  0,228,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1740 */   6,  0,  0,  0,  4,  0,  0,  0,  2,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1750 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 52,  1,  0,  0,
+/* 0x1760 */ 225,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1770 */  69, 76, 70, 77, 65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69, 65,
+/* 0x1780 */  68,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 78, 82, 86, 50, 69,
+/* 0x1790 */   0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77,
+/* 0x17a0 */  65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x17b0 */  50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90,
+/* 0x17c0 */  77, 65, 95, 68, 69, 67, 51, 48,  0, 69, 76, 70, 77, 65, 73, 78,
+/* 0x17d0 */  89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 77, 70, 76, 71,  0,
+/* 0x17e0 */  95,115,116, 97,114,116,  0,117, 99,108, 95,110,114,118, 50,101,
+/* 0x17f0 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 51, 50,  0,117,
+/* 0x1800 */  99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,
+/* 0x1810 */ 101,115,115, 95, 51, 50,  0,117, 99,108, 95,110,114,118, 50, 98,
+/* 0x1820 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 51, 50,  0, 76,
+/* 0x1830 */ 122,109, 97, 68,101, 99,111,100,101,  0,101,110,100, 95,100,101,
+/* 0x1840 */  99,111,109,112,114,101,115,115,  0, 79, 95, 66, 73, 78, 70, 79,
+/* 0x1850 */   0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 65, 66, 83, 51, 50,
+/* 0x1860 */   0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50,
+/* 0x1870 */  54,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 79, 78, 68,
+/* 0x1880 */  66, 82, 49, 57,  0,  0, 21,  0,  0, 85, 80, 88, 35, 79, 66, 74,
+/* 0x1890 */  49
 };
@@ -1,5 +1,5 @@
 /* arm64-linux.shlib-init.h
-   created from arm64-linux.shlib-init.bin, 8974 (0x230e) bytes
+   created from arm64-linux.shlib-init.bin, 6709 (0x1a35) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM64_LINUX_SHLIB_INIT_SIZE    8974
-#define STUB_ARM64_LINUX_SHLIB_INIT_ADLER32 0xf44cffc6
-#define STUB_ARM64_LINUX_SHLIB_INIT_CRC32   0x8944d6f3
+#define STUB_ARM64_LINUX_SHLIB_INIT_SIZE    6709
+#define STUB_ARM64_LINUX_SHLIB_INIT_ADLER32 0x793cc5c8
+#define STUB_ARM64_LINUX_SHLIB_INIT_CRC32   0x43ac7d1f
 
-unsigned char stub_arm64_linux_shlib_init[8974] = {
+unsigned char stub_arm64_linux_shlib_init[6709] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,183,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,248, 25,  0,  0,  0,  0,  0,  0,
@@ -397,204 +397,63 @@ unsigned char stub_arm64_linux_shlib_init[8974] = {
 /* 0x1660 */ 255,151,224,135, 67,169,162,  0,128,210, 72, 28,128, 82,  1,  0,
 /* 0x1670 */   0,212, 31,  4, 64,177, 67,  0,  0, 84,  0,  0, 32,212,254, 95,
 /* 0x1680 */  64,249,192,  3, 31,214, 99,192, 95,184, 99, 92,  0, 18, 66,  0,
-/* 0x1690 */   3,139,192,  3, 95,214,102,105,108,101, 32,102,111,114,109, 97,
-/* 0x16a0 */ 116, 32,101,108,102, 54, 52, 45,108,105,116,116,108,101, 97, 97,
-/* 0x16b0 */ 114, 99,104, 54, 52, 10, 10, 83,101, 99,116,105,111,110,115, 58,
-/* 0x16c0 */  10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32,
-/* 0x16d0 */  32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65,
-/* 0x16e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x16f0 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1700 */  32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32,
-/* 0x1710 */  32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65,
-/* 0x1720 */  73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49,
-/* 0x1730 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1740 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1750 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 48, 32,
-/* 0x1760 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1770 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1780 */  10, 32, 32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32,
-/* 0x1790 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x17a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x17b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x17c0 */  32, 48, 48, 48, 48, 48, 48, 53, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x17d0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x17e0 */  78, 76, 89, 10, 32, 32, 50, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x17f0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1800 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1810 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1820 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 53, 48, 32, 32, 50, 42,
-/* 0x1830 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1840 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 50, 69,
-/* 0x1850 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 55,
-/* 0x1860 */  99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1870 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1880 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 53, 48, 32,
-/* 0x1890 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x18a0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 78, 82,
-/* 0x18b0 */  86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x18c0 */  48, 49, 55, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18d0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x18f0 */  99, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1900 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53,
-/* 0x1910 */  32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1920 */  48, 48, 48, 48, 49, 52, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1930 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1940 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1950 */  48, 48, 51, 51, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1960 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1970 */  32, 32, 54, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32,
-/* 0x1980 */  32, 32, 48, 48, 48, 48, 48, 49, 48, 99, 32, 32, 48, 48, 48, 48,
-/* 0x1990 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x19a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x19b0 */  48, 48, 48, 48, 48, 52, 56, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x19c0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x19d0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90,
-/* 0x19e0 */  77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x19f0 */  48, 57, 54, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a00 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a10 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 53,
-/* 0x1a20 */  56, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1a30 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56,
-/* 0x1a40 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48,
-/* 0x1a50 */  48, 48, 48, 48, 52, 57, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1a70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1a80 */  48, 48,101,102, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1a90 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1aa0 */  32, 32, 57, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32,
-/* 0x1ab0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1ac0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1ad0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1ae0 */  48, 48, 48, 48, 49, 51, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1af0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1b00 */  76, 89, 10, 32, 49, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32,
-/* 0x1b10 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 51,101, 32, 32, 48,
-/* 0x1b20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1b30 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b40 */  48, 32, 32, 48, 48, 48, 48, 49, 51, 57, 48, 32, 32, 50, 42, 42,
-/* 0x1b50 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1b60 */  68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1b70 */  78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b80 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b90 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ba0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 51, 99,101, 32, 32,
-/* 0x1bb0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1bc0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 50, 32, 69, 76, 70,
-/* 0x1bd0 */  77, 65, 74, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1be0 */  48, 50, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bf0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c00 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 51, 99,
-/* 0x1c10 */ 101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1c20 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 51, 32,
-/* 0x1c30 */  65, 78, 68, 77, 65, 74, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1c40 */  48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c50 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1c60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1c70 */  49, 51,102, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1c80 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1c90 */  49, 52, 32, 69, 76, 70, 77, 65, 75, 78, 90, 32, 32, 32, 32, 32,
-/* 0x1ca0 */  32, 48, 48, 48, 48, 48, 50, 97, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1cb0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1cc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1cd0 */  48, 48, 48, 49, 51,102, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1ce0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1cf0 */  89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10,
-/* 0x1d00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d10 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1d20 */  67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d30 */  48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10,
-/* 0x1d40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d50 */  32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x1d60 */  90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d70 */  48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48,
-/* 0x1d80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1d90 */  32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48,
-/* 0x1da0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69,
-/* 0x1db0 */  76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1dc0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1dd0 */  32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1de0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 72,
-/* 0x1df0 */  69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e00 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x1e10 */  95, 84, 65, 73, 76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e20 */  48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10,
-/* 0x1e30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e40 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69,  9, 48,
-/* 0x1e50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1e60 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e70 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x1e80 */  82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e90 */  48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x1ea0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1eb0 */  32, 32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48,
-/* 0x1ec0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50,
-/* 0x1ed0 */  66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ee0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x1ef0 */  69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f00 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x1f10 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f20 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x1f30 */  68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f40 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x1f50 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f60 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x1f70 */  68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f80 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x1f90 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fa0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65,
-/* 0x1fb0 */  73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10, 48, 48,
-/* 0x1fd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1fe0 */  32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 74, 78, 90,  9,
-/* 0x1ff0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2000 */  32, 69, 76, 70, 77, 65, 74, 78, 90, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2010 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2020 */ 100, 32, 32, 65, 78, 68, 77, 65, 74, 78, 90,  9, 48, 48, 48, 48,
-/* 0x2030 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 65, 78, 68,
-/* 0x2040 */  77, 65, 74, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2050 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,
-/* 0x2060 */  76, 70, 77, 65, 75, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2070 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 75, 78,
-/* 0x2080 */  90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2090 */  48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65,
-/* 0x20a0 */  73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20b0 */  48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48,
-/* 0x20c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32,
-/* 0x20d0 */  32, 32, 32, 70, 32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48,
-/* 0x20e0 */  48, 48, 48, 48, 48, 48, 48, 48, 49, 55, 99, 32,117, 99,108, 95,
-/* 0x20f0 */ 110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x2100 */  95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2110 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86,
-/* 0x2120 */  50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2130 */  49, 55, 48, 32,117, 99,108, 95,110,114,118, 50,100, 95,100,101,
-/* 0x2140 */  99,111,109,112,114,101,115,115, 95, 51, 50, 10, 48, 48, 48, 48,
-/* 0x2150 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32,
-/* 0x2160 */  32, 32, 32, 70, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48,
-/* 0x2170 */  48, 48, 48, 48, 48, 48, 48, 48, 49, 52, 52, 32,117, 99,108, 95,
-/* 0x2180 */ 110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x2190 */  95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21a0 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x21b0 */  65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 76,122,109, 97, 68,101, 99,
-/* 0x21d0 */ 111,100,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21e0 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x21f0 */  77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2200 */  48, 48, 48, 48, 48, 48, 32,101,110,100, 95,100,101, 99,111,109,
-/* 0x2210 */ 112,114,101,115,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x2220 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69,
-/* 0x2230 */  76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x2240 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x2250 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x2260 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2270 */  48, 48, 99, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65,
-/* 0x2280 */  76, 76, 50, 54, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10,
-/* 0x2290 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x22a0 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x22b0 */  48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x22c0 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x22d0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x22e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x22f0 */  95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 79, 78, 68, 66, 82, 49,
-/* 0x2300 */  57, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10
+/* 0x1690 */   3,139,192,  3, 95,214, 15,  0,  0,  0, 21,  0,  0,  0,  2,  0,
+/* 0x16a0 */   0,  0, 19,  1,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0, 64,  0,
+/* 0x16b0 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 80,  0,
+/* 0x16c0 */   0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0, 80,  0,
+/* 0x16d0 */   0,  0,  0,  0,  0,  0, 27,  0,  0,  0,124,  1,  0,  0, 80,  0,
+/* 0x16e0 */   0,  0,  0,  0,  0,  0, 33,  0,  0,  0,112,  1,  0,  0,204,  1,
+/* 0x16f0 */   0,  0,  0,  0,  0,  0, 39,  0,  0,  0, 68,  1,  0,  0, 60,  3,
+/* 0x1700 */   0,  0,  0,  0,  0,  0, 45,  0,  0,  0, 12,  1,  0,  0,128,  4,
+/* 0x1710 */   0,  0,  0,  0,  0,  0, 56,  0,  0,  0,104,  9,  0,  0,140,  5,
+/* 0x1720 */   0,  0,  0,  0,  0,  0, 67,  0,  0,  0,156,  4,  0,  0,244, 14,
+/* 0x1730 */   0,  0,  0,  0,  0,  0, 78,  0,  0,  0,  0,  0,  0,  0,144, 19,
+/* 0x1740 */   0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 62,  0,  0,  0,144, 19,
+/* 0x1750 */   0,  0,  0,  0,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,206, 19,
+/* 0x1760 */   0,  0,  0,  0,  0,  0,107,  0,  0,  0, 36,  0,  0,  0,206, 19,
+/* 0x1770 */   0,  0,  0,  0,  0,  0,116,  0,  0,  0,  4,  0,  0,  0,242, 19,
+/* 0x1780 */   0,  0,  0,  0,  0,  0,125,  0,  0,  0,160,  2,  0,  0,246, 19,
+/* 0x1790 */   0,  0,  0,  0,  0,  0, 78,  0,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x17a0 */   0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x17b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17c0 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x17d0 */   0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x17e0 */   0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x17f0 */   0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1800 */   0,  0,  0,  0,  0,  0, 39,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x1810 */   0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  6,  0,  0,  0,  0,  0,
+/* 0x1820 */   0,  0,  0,  0,  0,  0, 56,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x1830 */   0,  0,  0,  0,  0,  0, 67,  0,  0,  0,  8,  0,  0,  0,  0,  0,
+/* 0x1840 */   0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,  0,  0,
+/* 0x1850 */   0,  0,  0,  0,  0,  0,107,  0,  0,  0, 12,  0,  0,  0,  0,  0,
+/* 0x1860 */   0,  0,  0,  0,  0,  0,116,  0,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x1870 */   0,  0,  0,  0,  0,  0,125,  0,  0,  0, 14,  0,  0,  0,  0,  0,
+/* 0x1880 */   0,  0,  0,  0,  0,  0,134,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1890 */   0,  0,  0,  0,  0,  0,141,  0,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x18a0 */   0,  0,  0,  0,  0,  0,165,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x18b0 */   0,  0,  0,  0,  0,  0,189,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x18c0 */   0,  0,  0,  0,  0,  0,213,  0,  0,  0,  8,  0,  0,  0,  0,  0,
+/* 0x18d0 */   0,  0,  0,  0,  0,  0,224,  0,  0,  0, 10,  0,  0,  0,  0,  0,
+/* 0x18e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,239,  0,
+/* 0x18f0 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,
+/* 0x1900 */   0,  0,  4,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1910 */   0,  0,  0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,  0, 78,
+/* 0x1920 */  82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 95, 84, 65, 73, 76,
+/* 0x1930 */   0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86,
+/* 0x1940 */  50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90,
+/* 0x1950 */  77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x1960 */  67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 69,
+/* 0x1970 */  76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,
+/* 0x1980 */   0, 69, 76, 70, 77, 65, 74, 78, 90,  0, 65, 78, 68, 77, 65, 74,
+/* 0x1990 */  78, 90,  0, 69, 76, 70, 77, 65, 75, 78, 90,  0, 95,115,116, 97,
+/* 0x19a0 */ 114,116,  0,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,
+/* 0x19b0 */ 111,109,112,114,101,115,115, 95, 51, 50,  0,117, 99,108, 95,110,
+/* 0x19c0 */ 114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95,
+/* 0x19d0 */  51, 50,  0,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,
+/* 0x19e0 */ 111,109,112,114,101,115,115, 95, 51, 50,  0, 76,122,109, 97, 68,
+/* 0x19f0 */ 101, 99,111,100,101,  0,101,110,100, 95,100,101, 99,111,109,112,
+/* 0x1a00 */ 114,101,115,115,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67,
+/* 0x1a10 */  65, 76, 76, 50, 54,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95,
+/* 0x1a20 */  67, 79, 78, 68, 66, 82, 49, 57,  0,150, 22,  0,  0, 85, 80, 88,
+/* 0x1a30 */  35, 79, 66, 74, 49
 };
@@ -1,5 +1,5 @@
 /* i386-bsd.elf-entry.h
-   created from i386-bsd.elf-entry.bin, 38222 (0x954e) bytes
+   created from i386-bsd.elf-entry.bin, 16634 (0x40fa) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_BSD_ELF_ENTRY_SIZE    38222
-#define STUB_I386_BSD_ELF_ENTRY_ADLER32 0xad4713cb
-#define STUB_I386_BSD_ELF_ENTRY_CRC32   0x70d4d718
+#define STUB_I386_BSD_ELF_ENTRY_SIZE    16634
+#define STUB_I386_BSD_ELF_ENTRY_ADLER32 0xb7a3ac85
+#define STUB_I386_BSD_ELF_ENTRY_CRC32   0xaccdb1ba
 
-unsigned char stub_i386_bsd_elf_entry[38222] = {
+unsigned char stub_i386_bsd_elf_entry[16634] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 160, 34,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -473,1956 +473,607 @@ unsigned char stub_i386_bsd_elf_entry[38222] = {
 /* 0x1b20 */  82,184,197,  0,  0,  0,205,128, 15,130,252,255,255,255,146, 91,
 /* 0x1b30 */  83,252,173, 80,137,225, 80, 81, 82,173, 80,173,137, 68, 36, 12,
 /* 0x1b40 */  86,255,213,131,196, 60,195, 93,232, 48,  0,  0,  0,  0,  0,  0,
-/* 0x1b50 */   0,102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102,
-/* 0x1b60 */  51, 50, 45,105, 51, 56, 54, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x1b70 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x1b80 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1b90 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x1ba0 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x1bb0 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 76, 69, 88,
-/* 0x1bc0 */  69, 67, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1bd0 */  48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1be0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51,
-/* 0x1bf0 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1c00 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1c10 */  76, 89, 10, 32, 32, 49, 32, 76, 69, 88, 69, 67, 48, 48, 57, 32,
-/* 0x1c20 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1c30 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c40 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 57, 32, 32, 50, 42, 42,
-/* 0x1c50 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1c60 */  68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 76, 69, 88, 69, 67, 48,
-/* 0x1c70 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x1c80 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1c90 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 57, 32, 32,
-/* 0x1ca0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1cb0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 50, 66,
-/* 0x1cc0 */  83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1cd0 */  48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1ce0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52,
-/* 0x1cf0 */  53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1d00 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1d10 */  76, 89, 10, 32, 32, 52, 32, 78, 50, 66, 70, 65, 83, 49, 48, 32,
-/* 0x1d20 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x1d30 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d40 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32, 32, 50, 42, 42,
-/* 0x1d50 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1d60 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53,
-/* 0x1d70 */  32, 78, 50, 66, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1d80 */  48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d90 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1da0 */  48, 48, 48, 52, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1db0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1dc0 */  32, 32, 54, 32, 78, 50, 66, 68, 69, 67, 49, 48, 32, 32, 32, 32,
-/* 0x1dd0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48,
-/* 0x1de0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1df0 */  48, 48, 48, 48, 48, 48, 53, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1e00 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1e10 */  76, 89, 10, 32, 32, 55, 32, 78, 50, 66, 83, 77, 65, 50, 48, 32,
-/* 0x1e20 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x1e30 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e40 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 53, 98, 32, 32, 50, 42, 42,
-/* 0x1e50 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1e60 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56,
-/* 0x1e70 */  32, 78, 50, 66, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1e80 */  48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e90 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1ea0 */  48, 48, 48, 54, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1eb0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1ec0 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 78, 50, 66, 68, 69,
-/* 0x1ed0 */  67, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ee0 */ 100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1ef0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 54, 57, 32,
-/* 0x1f00 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1f10 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48, 32, 78, 50,
-/* 0x1f20 */  66, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1f30 */  48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1f40 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1f50 */  55, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1f60 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1f70 */  78, 76, 89, 10, 32, 49, 49, 32, 78, 50, 66, 70, 65, 83, 51, 48,
-/* 0x1f80 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32,
-/* 0x1f90 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1fa0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 56, 51, 32, 32, 50, 42,
-/* 0x1fb0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1fc0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49,
-/* 0x1fd0 */  50, 32, 78, 50, 66, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1fe0 */  48, 48, 48, 48, 48, 48, 51,101, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1ff0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2000 */  48, 48, 48, 48, 57, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2010 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2020 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 51, 32, 78, 50, 66, 83,
-/* 0x2030 */  77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2040 */  48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2050 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,100, 48,
-/* 0x2060 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2070 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2080 */  89, 10, 32, 49, 52, 32, 78, 50, 66, 70, 65, 83, 52, 48, 32, 32,
-/* 0x2090 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48,
-/* 0x20a0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20b0 */  32, 32, 48, 48, 48, 48, 48, 48,100,100, 32, 32, 50, 42, 42, 48,
-/* 0x20c0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x20d0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 53, 32,
-/* 0x20e0 */  78, 50, 66, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x20f0 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2100 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2110 */  48, 48,101, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2120 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2130 */  49, 54, 32, 78, 50, 66, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32,
-/* 0x2140 */  32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2150 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2160 */  48, 48, 48, 48, 48,101,101, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2170 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2180 */  89, 10, 32, 49, 55, 32, 78, 50, 66, 68, 69, 67, 53, 48, 32, 32,
-/* 0x2190 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48,
-/* 0x21a0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21b0 */  32, 32, 48, 48, 48, 48, 48, 48,102, 49, 32, 32, 50, 42, 42, 48,
-/* 0x21c0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x21d0 */  79, 78, 76, 89, 10, 32, 49, 56, 32, 78, 50, 66, 83, 77, 65, 54,
-/* 0x21e0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32,
-/* 0x21f0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2200 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,102, 97, 32, 32, 50,
-/* 0x2210 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2220 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2230 */  49, 57, 32, 78, 50, 66, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32,
-/* 0x2240 */  32, 48, 48, 48, 48, 48, 48, 49, 57, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2250 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2260 */  48, 48, 48, 48, 49, 48, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2270 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2280 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 48, 32, 78, 50, 66,
-/* 0x2290 */  70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x22a0 */  48, 49, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x22b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 49,
-/* 0x22c0 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x22d0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x22e0 */  76, 89, 10, 32, 50, 49, 32, 78, 50, 66, 68, 69, 67, 54, 48, 32,
-/* 0x22f0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2300 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2310 */  48, 32, 32, 48, 48, 48, 48, 48, 49, 51, 53, 32, 32, 50, 42, 42,
-/* 0x2320 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x2330 */  68, 79, 78, 76, 89, 10, 32, 50, 50, 32, 78, 50, 68, 83, 77, 65,
-/* 0x2340 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x2350 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2360 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 51, 53, 32, 32,
-/* 0x2370 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2380 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2390 */  32, 50, 51, 32, 78, 50, 68, 70, 65, 83, 49, 48, 32, 32, 32, 32,
-/* 0x23a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x23b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x23c0 */  48, 48, 48, 48, 48, 49, 51, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x23d0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x23e0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 52, 32, 78, 50,
-/* 0x23f0 */  68, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2400 */  48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2410 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x2420 */  51, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2430 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 53,
-/* 0x2440 */  32, 78, 50, 68, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2450 */  48, 48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2460 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2470 */  48, 48, 49, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2480 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2490 */  32, 50, 54, 32, 78, 50, 68, 83, 77, 65, 50, 48, 32, 32, 32, 32,
-/* 0x24a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48,
-/* 0x24b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x24c0 */  48, 48, 48, 48, 48, 49, 52, 98, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x24d0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x24e0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 55, 32, 78, 50,
-/* 0x24f0 */  68, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2500 */  48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2510 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x2520 */  53, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2530 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2540 */  78, 76, 89, 10, 32, 50, 56, 32, 78, 50, 68, 68, 69, 67, 50, 48,
-/* 0x2550 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32,
-/* 0x2560 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2570 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 53, 57, 32, 32, 50, 42,
-/* 0x2580 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2590 */  65, 68, 79, 78, 76, 89, 10, 32, 50, 57, 32, 78, 50, 68, 83, 77,
-/* 0x25a0 */  65, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25b0 */ 100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x25c0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 54, 54, 32,
-/* 0x25d0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x25e0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x25f0 */  10, 32, 51, 48, 32, 78, 50, 68, 70, 65, 83, 51, 48, 32, 32, 32,
-/* 0x2600 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48,
-/* 0x2610 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2620 */  32, 48, 48, 48, 48, 48, 49, 55, 51, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2630 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x2640 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 49, 32, 78,
-/* 0x2650 */  50, 68, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2660 */  48, 48, 48, 53, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2670 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2680 */  49, 56, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2690 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x26a0 */  79, 78, 76, 89, 10, 32, 51, 50, 32, 78, 50, 68, 83, 77, 65, 52,
-/* 0x26b0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32,
-/* 0x26c0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x26d0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,100, 52, 32, 32, 50,
-/* 0x26e0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x26f0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2700 */  51, 51, 32, 78, 50, 68, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32,
-/* 0x2710 */  32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2720 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2730 */  48, 48, 48, 48, 49,101, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2740 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2750 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 52, 32, 78, 50, 68,
-/* 0x2760 */  83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2770 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2780 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,102,
-/* 0x2790 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x27a0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 53, 32,
-/* 0x27b0 */  78, 50, 68, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x27c0 */  48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x27e0 */  48, 49,102, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x27f0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2800 */  51, 54, 32, 78, 50, 68, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32,
-/* 0x2810 */  32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2820 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2830 */  48, 48, 48, 48, 49,102, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2840 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2850 */  89, 10, 32, 51, 55, 32, 78, 50, 68, 83, 77, 65, 54, 48, 32, 32,
-/* 0x2860 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32, 32, 48, 48,
-/* 0x2870 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2880 */  32, 32, 48, 48, 48, 48, 48, 49,102,101, 32, 32, 50, 42, 42, 48,
-/* 0x2890 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x28a0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 56, 32,
-/* 0x28b0 */  78, 50, 68, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x28c0 */  48, 48, 48, 48, 49, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x28e0 */  48, 50, 48, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x28f0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2900 */  68, 79, 78, 76, 89, 10, 32, 51, 57, 32, 78, 50, 68, 70, 65, 83,
-/* 0x2910 */  54, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 54,
-/* 0x2920 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2930 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 50, 51, 32, 32,
-/* 0x2940 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2950 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2960 */  32, 52, 48, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32, 32, 32, 32,
-/* 0x2970 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2980 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2990 */  48, 48, 48, 48, 48, 50, 51, 57, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x29a0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x29b0 */  76, 89, 10, 32, 52, 49, 32, 78, 50, 69, 83, 77, 65, 49, 48, 32,
-/* 0x29c0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48,
-/* 0x29d0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x29e0 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 51, 57, 32, 32, 50, 42, 42,
-/* 0x29f0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2a00 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 50,
-/* 0x2a10 */  32, 78, 50, 69, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2a20 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a30 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2a40 */  48, 48, 50, 51, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2a50 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x2a60 */  65, 68, 79, 78, 76, 89, 10, 32, 52, 51, 32, 78, 50, 69, 70, 65,
-/* 0x2a70 */  83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a80 */  54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2a90 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 51,101, 32,
-/* 0x2aa0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2ab0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 52, 32, 78, 50,
-/* 0x2ac0 */  69, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2ad0 */  48, 48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2ae0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,
-/* 0x2af0 */  52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2b00 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 53,
-/* 0x2b10 */  32, 78, 50, 69, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2b20 */  48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b30 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2b40 */  48, 48, 50, 52,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2b50 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x2b60 */  65, 68, 79, 78, 76, 89, 10, 32, 52, 54, 32, 78, 50, 69, 70, 65,
-/* 0x2b70 */  83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b80 */  57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2b90 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 53, 52, 32,
-/* 0x2ba0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2bb0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2bc0 */  10, 32, 52, 55, 32, 78, 50, 69, 68, 69, 67, 50, 48, 32, 32, 32,
-/* 0x2bd0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48,
-/* 0x2be0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2bf0 */  32, 48, 48, 48, 48, 48, 50, 53,100, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2c00 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2c10 */  78, 76, 89, 10, 32, 52, 56, 32, 78, 50, 69, 83, 77, 65, 51, 48,
-/* 0x2c20 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32,
-/* 0x2c30 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2c40 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 54, 97, 32, 32, 50, 42,
-/* 0x2c50 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2c60 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52,
-/* 0x2c70 */  57, 32, 78, 50, 69, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2c80 */  48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2c90 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2ca0 */  48, 48, 48, 50, 55, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2cb0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2cc0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 48, 32, 78, 50, 69, 68,
-/* 0x2cd0 */  69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2ce0 */  53,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2cf0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 56, 54,
-/* 0x2d00 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2d10 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2d20 */  89, 10, 32, 53, 49, 32, 78, 50, 69, 83, 77, 65, 52, 48, 32, 32,
-/* 0x2d30 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48,
-/* 0x2d40 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2d50 */  32, 32, 48, 48, 48, 48, 48, 50,101, 53, 32, 32, 50, 42, 42, 48,
-/* 0x2d60 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2d70 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 50, 32,
-/* 0x2d80 */  78, 50, 69, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2d90 */  48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2da0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2db0 */  48, 50,102, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2dc0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2dd0 */  68, 79, 78, 76, 89, 10, 32, 53, 51, 32, 78, 50, 69, 83, 77, 65,
-/* 0x2de0 */  53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x2df0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2e00 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 48, 49, 32, 32,
-/* 0x2e10 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2e20 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 52, 32, 78, 50, 69,
-/* 0x2e30 */  70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2e40 */  48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2e50 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 48,
-/* 0x2e60 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2e70 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 53, 32,
-/* 0x2e80 */  78, 50, 69, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2e90 */  48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ea0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2eb0 */  48, 51, 48, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2ec0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2ed0 */  53, 54, 32, 78, 50, 69, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32,
-/* 0x2ee0 */  32, 48, 48, 48, 48, 48, 48, 48, 99, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2ef0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2f00 */  48, 48, 48, 48, 51, 48,102, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2f10 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2f20 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 55, 32, 78, 50, 69,
-/* 0x2f30 */  70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2f40 */  48, 49, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2f50 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 49,
-/* 0x2f60 */  98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2f70 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2f80 */  76, 89, 10, 32, 53, 56, 32, 78, 50, 69, 70, 65, 83, 54, 49, 32,
-/* 0x2f90 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 54, 32, 32, 48,
-/* 0x2fa0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2fb0 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 51, 52, 32, 32, 50, 42, 42,
-/* 0x2fc0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2fd0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 57,
-/* 0x2fe0 */  32, 78, 50, 69, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2ff0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3000 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3010 */  48, 48, 51, 52, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3020 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3030 */  32, 54, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 32,
-/* 0x3040 */  32, 32, 48, 48, 48, 48, 48, 48, 50,101, 32, 32, 48, 48, 48, 48,
-/* 0x3050 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3060 */  48, 48, 48, 48, 48, 51, 52, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3070 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x3080 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 49, 32, 76, 90,
-/* 0x3090 */  77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x30a0 */  48, 48, 52, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x30b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,
-/* 0x30c0 */  55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x30d0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 50,
-/* 0x30e0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48,
-/* 0x30f0 */  48, 48, 48, 48, 97, 56, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3100 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3110 */  48, 48, 51, 99, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3120 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3130 */  32, 54, 51, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32,
-/* 0x3140 */  32, 32, 48, 48, 48, 48, 48, 97, 56, 54, 32, 32, 48, 48, 48, 48,
-/* 0x3150 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3160 */  48, 48, 48, 48, 48,101, 52, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3170 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3180 */  76, 89, 10, 32, 54, 52, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x3190 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 97, 32, 32, 48,
-/* 0x31a0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31b0 */  48, 32, 32, 48, 48, 48, 48, 49, 56, 99, 99, 32, 32, 50, 42, 42,
-/* 0x31c0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x31d0 */  68, 79, 78, 76, 89, 10, 32, 54, 53, 32, 76, 69, 88, 69, 67, 48,
-/* 0x31e0 */  49, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49,100,
-/* 0x31f0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3200 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 56,101, 54, 32, 32,
-/* 0x3210 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3220 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 54, 32, 76, 88, 85,
-/* 0x3230 */  78, 70, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3240 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3250 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 48,
-/* 0x3260 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3270 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3280 */  76, 89, 10, 32, 54, 55, 32, 76, 88, 85, 78, 70, 48, 48, 50, 32,
-/* 0x3290 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x32a0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32b0 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 48, 53, 32, 32, 50, 42, 42,
-/* 0x32c0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x32d0 */  68, 79, 78, 76, 89, 10, 32, 54, 56, 32, 77, 82, 85, 66, 89, 84,
-/* 0x32e0 */  69, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x32f0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3300 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 48, 97, 32, 32,
-/* 0x3310 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3320 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 57, 32, 76, 88, 77,
-/* 0x3330 */  82, 85, 48, 48, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3340 */  48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3350 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 48,
-/* 0x3360 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3370 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3380 */  76, 89, 10, 32, 55, 48, 32, 76, 88, 77, 82, 85, 48, 48, 54, 32,
-/* 0x3390 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 55, 32, 32, 48,
-/* 0x33a0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33b0 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 49, 49, 32, 32, 50, 42, 42,
-/* 0x33c0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x33d0 */  68, 79, 78, 76, 89, 10, 32, 55, 49, 32, 76, 88, 77, 82, 85, 48,
-/* 0x33e0 */  48, 55, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 55,
-/* 0x33f0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3400 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 49, 56, 32, 32,
-/* 0x3410 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3420 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 50, 32, 76, 88, 85,
-/* 0x3430 */  78, 70, 48, 48, 56, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3440 */  48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3450 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 49,
-/* 0x3460 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3470 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 51, 32,
-/* 0x3480 */  76, 88, 85, 78, 70, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3490 */  48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x34a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x34b0 */  49, 57, 50, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x34c0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x34d0 */  68, 79, 78, 76, 89, 10, 32, 55, 52, 32, 76, 88, 74, 67, 67, 48,
-/* 0x34e0 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x34f0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3500 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 50, 56, 32, 32,
-/* 0x3510 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3520 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 53, 32, 76, 88, 77,
-/* 0x3530 */  82, 85, 48, 52, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3540 */  48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3550 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 50,
-/* 0x3560 */  98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3570 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 54, 32,
-/* 0x3580 */  76, 88, 77, 82, 85, 48, 52, 54, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3590 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x35a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x35b0 */  49, 57, 50,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x35c0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x35d0 */  55, 55, 32, 76, 88, 74, 67, 67, 48, 50, 48, 32, 32, 32, 32, 32,
-/* 0x35e0 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x35f0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3600 */  48, 48, 48, 49, 57, 51, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3610 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x3620 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 56, 32, 76, 88, 74,
-/* 0x3630 */  67, 67, 48, 50, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3640 */  48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3650 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 51,
-/* 0x3660 */  50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3670 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3680 */  76, 89, 10, 32, 55, 57, 32, 76, 88, 74, 67, 67, 48, 50, 51, 32,
-/* 0x3690 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 55, 32, 32, 48,
-/* 0x36a0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36b0 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 51, 55, 32, 32, 50, 42, 42,
-/* 0x36c0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x36d0 */  68, 79, 78, 76, 89, 10, 32, 56, 48, 32, 76, 88, 85, 78, 70, 48,
-/* 0x36e0 */  51, 55, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x36f0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3700 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 51,101, 32, 32,
-/* 0x3710 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3720 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 49, 32, 76, 88, 85,
-/* 0x3730 */  78, 70, 51, 56, 54, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3740 */  48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3750 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 52,
-/* 0x3760 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3770 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 50, 32,
-/* 0x3780 */  76, 88, 85, 78, 70, 51, 56, 55, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3790 */  48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x37a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x37b0 */  49, 57, 52, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x37c0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x37d0 */  56, 51, 32, 76, 88, 85, 78, 70, 51, 56, 56, 32, 32, 32, 32, 32,
-/* 0x37e0 */  32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48,
-/* 0x37f0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3800 */  48, 48, 48, 49, 57, 52, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3810 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x3820 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 52, 32, 76, 88, 85,
-/* 0x3830 */  78, 70, 52, 56, 54, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3840 */  48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3850 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 52,
-/* 0x3860 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3870 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 53, 32,
-/* 0x3880 */  76, 88, 85, 78, 70, 52, 56, 55, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3890 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x38a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x38b0 */  49, 57, 53, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x38c0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x38d0 */  68, 79, 78, 76, 89, 10, 32, 56, 54, 32, 76, 88, 77, 82, 85, 48,
-/* 0x38e0 */  54, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x38f0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3900 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 53, 51, 32, 32,
-/* 0x3910 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3920 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3930 */  32, 56, 55, 32, 77, 82, 85, 66, 89, 84, 69, 51, 32, 32, 32, 32,
-/* 0x3940 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x3950 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3960 */  48, 48, 48, 48, 49, 57, 53, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3970 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3980 */  76, 89, 10, 32, 56, 56, 32, 77, 82, 85, 65, 82, 66, 51, 48, 32,
-/* 0x3990 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48,
-/* 0x39a0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x39b0 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 53, 97, 32, 32, 50, 42, 42,
-/* 0x39c0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x39d0 */  68, 79, 78, 76, 89, 10, 32, 56, 57, 32, 77, 82, 85, 66, 73, 84,
-/* 0x39e0 */  83, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x39f0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3a00 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 53, 98, 32, 32,
-/* 0x3a10 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3a20 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 48, 32, 77, 82, 85,
-/* 0x3a30 */  65, 82, 66, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3a40 */  48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3a50 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 53,
-/* 0x3a60 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3a70 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 49, 32,
-/* 0x3a80 */  76, 88, 77, 82, 85, 48, 55, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3a90 */  48, 48, 48, 48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3aa0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3ab0 */  49, 57, 54, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3ac0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3ad0 */  68, 79, 78, 76, 89, 10, 32, 57, 50, 32, 77, 82, 85, 66, 89, 84,
-/* 0x3ae0 */  69, 52, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x3af0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3b00 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 54, 57, 32, 32,
-/* 0x3b10 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3b20 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 51, 32, 77, 82, 85,
-/* 0x3b30 */  66, 73, 84, 83, 52, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3b40 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3b50 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 54,
-/* 0x3b60 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3b70 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 52, 32,
-/* 0x3b80 */  77, 82, 85, 65, 82, 66, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3b90 */  48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ba0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3bb0 */  49, 57, 54,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3bc0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x3bd0 */  57, 53, 32, 76, 88, 77, 82, 85, 48, 56, 48, 32, 32, 32, 32, 32,
-/* 0x3be0 */  32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3bf0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3c00 */  48, 48, 48, 49, 57, 55, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3c10 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x3c20 */  89, 10, 32, 57, 54, 32, 77, 82, 85, 66, 89, 84, 69, 53, 32, 32,
-/* 0x3c30 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48,
-/* 0x3c40 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c50 */  32, 32, 48, 48, 48, 48, 49, 57, 55, 55, 32, 32, 50, 42, 42, 48,
-/* 0x3c60 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x3c70 */  79, 78, 76, 89, 10, 32, 57, 55, 32, 77, 82, 85, 65, 82, 66, 54,
-/* 0x3c80 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x3c90 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3ca0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 55, 57, 32, 32, 50,
-/* 0x3cb0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x3cc0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 56, 32, 77, 82, 85, 66,
-/* 0x3cd0 */  73, 84, 83, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3ce0 */  48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3cf0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 55, 97,
-/* 0x3d00 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3d10 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 57, 32, 77,
-/* 0x3d20 */  82, 85, 65, 82, 66, 55, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x3d30 */  48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3d40 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x3d50 */  57, 55, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3d60 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48,
-/* 0x3d70 */  48, 32, 76, 88, 77, 82, 85, 48, 57, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3d80 */  48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3d90 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3da0 */  48, 48, 49, 57, 56, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3db0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x3dc0 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 49, 32, 77, 82, 85, 66,
-/* 0x3dd0 */  89, 84, 69, 54, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3de0 */  48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3df0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 56, 98,
-/* 0x3e00 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3e10 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 50, 32, 77,
-/* 0x3e20 */  82, 85, 65, 82, 66, 56, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x3e30 */  48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3e40 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x3e50 */  57, 56,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3e60 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48,
-/* 0x3e70 */  51, 32, 77, 82, 85, 66, 73, 84, 83, 54, 32, 32, 32, 32, 32, 32,
-/* 0x3e80 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3e90 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3ea0 */  48, 48, 49, 57, 56,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3eb0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x3ec0 */  10, 49, 48, 52, 32, 77, 82, 85, 65, 82, 66, 57, 48, 32, 32, 32,
-/* 0x3ed0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48,
-/* 0x3ee0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3ef0 */  32, 48, 48, 48, 48, 49, 57, 57, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3f00 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x3f10 */  78, 76, 89, 10, 49, 48, 53, 32, 76, 88, 77, 82, 85, 49, 48, 48,
-/* 0x3f20 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 48, 32, 32,
-/* 0x3f30 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3f40 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 57, 52, 32, 32, 50, 42,
-/* 0x3f50 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x3f60 */  65, 68, 79, 78, 76, 89, 10, 49, 48, 54, 32, 76, 88, 85, 78, 70,
-/* 0x3f70 */  48, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f80 */  53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3f90 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 97, 52, 32,
-/* 0x3fa0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3fb0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 55, 32, 76, 88,
-/* 0x3fc0 */  77, 82, 85, 49, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3fd0 */  48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3fe0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x3ff0 */  97, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x4000 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 56,
-/* 0x4010 */  32, 76, 88, 77, 82, 85, 49, 49, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4020 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4030 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4040 */  48, 49, 57, 97, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x4050 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x4060 */  49, 48, 57, 32, 76, 88, 85, 78, 70, 48, 52, 49, 32, 32, 32, 32,
-/* 0x4070 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48,
-/* 0x4080 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4090 */  48, 48, 48, 48, 49, 57, 97,101, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x40a0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x40b0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 48, 32, 76, 88,
-/* 0x40c0 */  85, 78, 70, 48, 52, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x40d0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x40e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x40f0 */  98, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x4100 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 49,
-/* 0x4110 */  32, 76, 69, 88, 69, 67, 48, 49, 54, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4120 */  48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4130 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4140 */  48, 49, 57, 98, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x4150 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x4160 */  65, 68, 79, 78, 76, 89, 10, 49, 49, 50, 32, 76, 88, 77, 82, 85,
-/* 0x4170 */  48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4180 */  49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4190 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 98, 97, 32,
-/* 0x41a0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x41b0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 51, 32, 76, 88,
-/* 0x41c0 */  74, 77, 80, 65, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x41d0 */  48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x41e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x41f0 */  98, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x4200 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 52,
-/* 0x4210 */  32, 76, 88, 67, 65, 76, 76, 66, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4220 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4230 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4240 */  48, 49, 57, 98,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x4250 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x4260 */  49, 49, 53, 32, 76, 88, 85, 78, 70, 48, 50, 49, 32, 32, 32, 32,
-/* 0x4270 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48,
-/* 0x4280 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4290 */  48, 48, 48, 48, 49, 57, 98,102, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x42a0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x42b0 */  76, 89, 10, 49, 49, 54, 32, 76, 88, 77, 82, 85, 48, 50, 50, 32,
-/* 0x42c0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48,
-/* 0x42d0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x42e0 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 99, 53, 32, 32, 50, 42, 42,
-/* 0x42f0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x4300 */  68, 79, 78, 76, 89, 10, 49, 49, 55, 32, 76, 88, 74, 77, 80, 65,
-/* 0x4310 */  48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x4320 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x4330 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 99, 56, 32, 32,
-/* 0x4340 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x4350 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 56, 32, 76, 88, 67,
-/* 0x4360 */  65, 76, 76, 66, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4370 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4380 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 99,
-/* 0x4390 */  97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x43a0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 57, 32,
-/* 0x43b0 */  77, 82, 85, 66, 73, 84, 83, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x43c0 */  48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x43d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x43e0 */  49, 57, 99, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x43f0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x4400 */  50, 48, 32, 76, 88, 77, 82, 85, 48, 51, 48, 32, 32, 32, 32, 32,
-/* 0x4410 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4420 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4430 */  48, 48, 48, 49, 57, 99,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x4440 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x4450 */  89, 10, 49, 50, 49, 32, 77, 82, 85, 66, 89, 84, 69, 49, 32, 32,
-/* 0x4460 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48,
-/* 0x4470 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4480 */  32, 32, 48, 48, 48, 48, 49, 57, 99,102, 32, 32, 50, 42, 42, 48,
-/* 0x4490 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x44a0 */  79, 78, 76, 89, 10, 49, 50, 50, 32, 77, 82, 85, 65, 82, 66, 49,
-/* 0x44b0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x44c0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x44d0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,100, 49, 32, 32, 50,
-/* 0x44e0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x44f0 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 50, 51, 32, 76, 88, 77, 82,
-/* 0x4500 */  85, 48, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4510 */  48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4520 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,100, 50,
-/* 0x4530 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x4540 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x4550 */  89, 10, 49, 50, 52, 32, 76, 88, 85, 78, 70, 48, 51, 48, 32, 32,
-/* 0x4560 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48,
-/* 0x4570 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4580 */  32, 32, 48, 48, 48, 48, 49, 57,100, 52, 32, 32, 50, 42, 42, 48,
-/* 0x4590 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x45a0 */  79, 78, 76, 89, 10, 49, 50, 53, 32, 76, 88, 74, 67, 67, 48, 48,
-/* 0x45b0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 56, 32,
-/* 0x45c0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x45d0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,100, 97, 32, 32, 50,
-/* 0x45e0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x45f0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x4600 */  50, 54, 32, 76, 88, 67, 74, 48, 77, 82, 85, 32, 32, 32, 32, 32,
-/* 0x4610 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4620 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4630 */  48, 48, 48, 49, 57,101, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x4640 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x4650 */  89, 10, 49, 50, 55, 32, 76, 88, 67, 74, 49, 77, 82, 85, 32, 32,
-/* 0x4660 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48,
-/* 0x4670 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4680 */  32, 32, 48, 48, 48, 48, 49, 57,101, 52, 32, 32, 50, 42, 42, 48,
-/* 0x4690 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x46a0 */  79, 78, 76, 89, 10, 49, 50, 56, 32, 76, 88, 67, 65, 76, 74, 77,
-/* 0x46b0 */  80, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x46c0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x46d0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,101, 55, 32, 32, 50,
-/* 0x46e0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x46f0 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 50, 57, 32, 76, 88, 67, 65,
-/* 0x4700 */  76, 76, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4710 */  48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4720 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,101, 97,
-/* 0x4730 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x4740 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x4750 */  89, 10, 49, 51, 48, 32, 76, 88, 67, 65, 76, 76, 48, 49, 32, 32,
-/* 0x4760 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48,
-/* 0x4770 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4780 */  32, 32, 48, 48, 48, 48, 49, 57,101, 99, 32, 32, 50, 42, 42, 48,
-/* 0x4790 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x47a0 */  79, 78, 76, 89, 10, 49, 51, 49, 32, 76, 88, 67, 74, 50, 77, 82,
-/* 0x47b0 */  85, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x47c0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x47d0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,101,102, 32, 32, 50,
-/* 0x47e0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x47f0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x4800 */  51, 50, 32, 76, 88, 67, 74, 52, 77, 82, 85, 32, 32, 32, 32, 32,
-/* 0x4810 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4820 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4830 */  48, 48, 48, 49, 57,102, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x4840 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x4850 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 51, 51, 32, 76, 88, 67,
-/* 0x4860 */  74, 54, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4870 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4880 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,102,
-/* 0x4890 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x48a0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x48b0 */  76, 89, 10, 49, 51, 52, 32, 76, 88, 67, 74, 55, 77, 82, 85, 32,
-/* 0x48c0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x48d0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x48e0 */  48, 32, 32, 48, 48, 48, 48, 49, 57,102, 53, 32, 32, 50, 42, 42,
-/* 0x48f0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x4900 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 51, 53,
-/* 0x4910 */  32, 76, 88, 67, 74, 56, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4920 */  48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4930 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4940 */  48, 49, 57,102, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x4950 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x4960 */  65, 68, 79, 78, 76, 89, 10, 49, 51, 54, 32, 76, 88, 85, 78, 70,
-/* 0x4970 */  48, 51, 52, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4980 */  53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4990 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,102, 97, 32,
-/* 0x49a0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x49b0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x49c0 */  10, 49, 51, 55, 32, 76, 88, 77, 82, 85, 48, 53, 53, 32, 32, 32,
-/* 0x49d0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48,
-/* 0x49e0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x49f0 */  32, 48, 48, 48, 48, 49, 57,102,102, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4a00 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x4a10 */  78, 76, 89, 10, 49, 51, 56, 32, 77, 82, 85, 66, 89, 84, 69, 50,
-/* 0x4a20 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32,
-/* 0x4a30 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4a40 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 48, 49, 32, 32, 50, 42,
-/* 0x4a50 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x4a60 */  65, 68, 79, 78, 76, 89, 10, 49, 51, 57, 32, 77, 82, 85, 66, 73,
-/* 0x4a70 */  84, 83, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a80 */  53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4a90 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 48, 54, 32,
-/* 0x4aa0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x4ab0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52, 48, 32, 77, 82,
-/* 0x4ac0 */  85, 65, 82, 66, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x4ad0 */  48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4ae0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,
-/* 0x4af0 */  48, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x4b00 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52, 49,
-/* 0x4b10 */  32, 76, 88, 77, 82, 85, 48, 53, 55, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4b20 */  48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4b30 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4b40 */  48, 49, 97, 49, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x4b50 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x4b60 */  49, 52, 50, 32, 76, 88, 77, 82, 85, 48, 53, 56, 32, 32, 32, 32,
-/* 0x4b70 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48,
-/* 0x4b80 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4b90 */  48, 48, 48, 48, 49, 97, 49, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x4ba0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x4bb0 */  76, 89, 10, 49, 52, 51, 32, 76, 88, 85, 78, 70, 48, 51, 53, 32,
-/* 0x4bc0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48,
-/* 0x4bd0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4be0 */  48, 32, 32, 48, 48, 48, 48, 49, 97, 49, 55, 32, 32, 50, 42, 42,
-/* 0x4bf0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x4c00 */  68, 79, 78, 76, 89, 10, 49, 52, 52, 32, 99,116,111,107, 51, 50,
-/* 0x4c10 */  46, 48, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 55,
-/* 0x4c20 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x4c30 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 49,100, 32, 32,
-/* 0x4c40 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x4c50 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x4c60 */  49, 52, 53, 32, 99,116,111,107, 51, 50, 46, 49, 48, 32, 32, 32,
-/* 0x4c70 */  32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32, 32, 48, 48, 48, 48,
-/* 0x4c80 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4c90 */  48, 48, 48, 48, 49, 97, 50, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x4ca0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x4cb0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52, 54, 32, 99,116,
-/* 0x4cc0 */ 111,107, 51, 50, 46, 50, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x4cd0 */  48, 48, 50, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4ce0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,
-/* 0x4cf0 */  51, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x4d00 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x4d10 */  78, 76, 89, 10, 49, 52, 55, 32, 99,116,111,107, 51, 50, 46, 51,
-/* 0x4d20 */  48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 97, 32, 32,
-/* 0x4d30 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4d40 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 53, 50, 32, 32, 50, 42,
-/* 0x4d50 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x4d60 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52,
-/* 0x4d70 */  56, 32, 99,116,111,107, 51, 50, 46, 52, 48, 32, 32, 32, 32, 32,
-/* 0x4d80 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4d90 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4da0 */  48, 48, 49, 97, 53, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x4db0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x4dc0 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 52, 57, 32, 67, 65, 76, 76,
-/* 0x4dd0 */  84, 82, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4de0 */  49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4df0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 54, 49,
-/* 0x4e00 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x4e10 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x4e20 */  89, 10, 49, 53, 48, 32, 67, 84, 67, 76, 69, 86, 69, 49, 32, 32,
-/* 0x4e30 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48,
-/* 0x4e40 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4e50 */  32, 32, 48, 48, 48, 48, 49, 97, 55, 49, 32, 32, 50, 42, 42, 48,
-/* 0x4e60 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x4e70 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 53, 49, 32,
-/* 0x4e80 */  67, 65, 76, 76, 84, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x4e90 */  48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ea0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x4eb0 */  49, 97, 55, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x4ec0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x4ed0 */  53, 50, 32, 67, 84, 66, 83, 72, 82, 48, 49, 32, 32, 32, 32, 32,
-/* 0x4ee0 */  32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4ef0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4f00 */  48, 48, 48, 49, 97, 55, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x4f10 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x4f20 */  89, 10, 49, 53, 51, 32, 67, 84, 66, 82, 79, 82, 48, 49, 32, 32,
-/* 0x4f30 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48,
-/* 0x4f40 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4f50 */  32, 32, 48, 48, 48, 48, 49, 97, 55,102, 32, 32, 50, 42, 42, 48,
-/* 0x4f60 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x4f70 */  79, 78, 76, 89, 10, 49, 53, 52, 32, 67, 84, 66, 83, 87, 65, 48,
-/* 0x4f80 */  49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x4f90 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4fa0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 56, 49, 32, 32, 50,
-/* 0x4fb0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x4fc0 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 53, 53, 32, 67, 65, 76, 76,
-/* 0x4fd0 */  84, 82, 48, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4fe0 */  49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4ff0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 56, 54,
-/* 0x5000 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x5010 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x5020 */  89, 10, 49, 53, 54, 32, 67, 65, 76, 76, 84, 82, 49, 48, 32, 32,
-/* 0x5030 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48,
-/* 0x5040 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5050 */  32, 32, 48, 48, 48, 48, 49, 97, 57, 54, 32, 32, 50, 42, 42, 48,
-/* 0x5060 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x5070 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 53, 55, 32,
-/* 0x5080 */  67, 65, 76, 76, 84, 82, 69, 56, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x5090 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x50a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x50b0 */  49, 97, 57, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x50c0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x50d0 */  53, 56, 32, 67, 65, 76, 76, 84, 82, 69, 57, 32, 32, 32, 32, 32,
-/* 0x50e0 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x50f0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x5100 */  48, 48, 48, 49, 97, 57,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x5110 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x5120 */  89, 10, 49, 53, 57, 32, 67, 65, 76, 76, 84, 82, 49, 49, 32, 32,
-/* 0x5130 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48,
-/* 0x5140 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5150 */  32, 32, 48, 48, 48, 48, 49, 97, 57,102, 32, 32, 50, 42, 42, 48,
-/* 0x5160 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x5170 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 54, 48, 32,
-/* 0x5180 */  67, 84, 67, 76, 69, 86, 69, 50, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x5190 */  48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x51a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x51b0 */  49, 97, 97, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x51c0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x51d0 */  68, 79, 78, 76, 89, 10, 49, 54, 49, 32, 67, 65, 76, 76, 84, 82,
-/* 0x51e0 */  49, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x51f0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x5200 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 97, 56, 32, 32,
-/* 0x5210 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x5220 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 54, 50, 32, 67, 84, 66,
-/* 0x5230 */  83, 72, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x5240 */  48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x5250 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 97,
-/* 0x5260 */  97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x5270 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 54, 51, 32,
-/* 0x5280 */  67, 84, 66, 82, 79, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x5290 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x52a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x52b0 */  49, 97, 97,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x52c0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x52d0 */  54, 52, 32, 67, 84, 66, 83, 87, 65, 49, 49, 32, 32, 32, 32, 32,
-/* 0x52e0 */  32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48,
-/* 0x52f0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x5300 */  48, 48, 48, 49, 97, 98, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x5310 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x5320 */  89, 10, 49, 54, 53, 32, 67, 65, 76, 76, 84, 82, 49, 51, 32, 32,
-/* 0x5330 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 55, 32, 32, 48, 48,
-/* 0x5340 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5350 */  32, 32, 48, 48, 48, 48, 49, 97, 98, 53, 32, 32, 50, 42, 42, 48,
-/* 0x5360 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x5370 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 54, 54, 32,
-/* 0x5380 */  76, 69, 88, 69, 67, 48, 49, 55, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x5390 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x53a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x53b0 */  49, 97, 98, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x53c0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x53d0 */  54, 55, 32, 76, 69, 88, 69, 67, 48, 50, 48, 32, 32, 32, 32, 32,
-/* 0x53e0 */  32, 48, 48, 48, 48, 48, 48, 52, 98, 32, 32, 48, 48, 48, 48, 48,
-/* 0x53f0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x5400 */  48, 48, 48, 49, 97, 98,101, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x5410 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x5420 */  89, 10, 49, 54, 56, 32, 76, 85, 78, 77, 80, 48, 48, 48, 32, 32,
-/* 0x5430 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48,
-/* 0x5440 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5450 */  32, 32, 48, 48, 48, 48, 49, 98, 48, 57, 32, 32, 50, 42, 42, 48,
-/* 0x5460 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x5470 */  79, 78, 76, 89, 10, 49, 54, 57, 32, 76, 85, 78, 77, 80, 48, 48,
-/* 0x5480 */  49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x5490 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x54a0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 48, 98, 32, 32, 50,
-/* 0x54b0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x54c0 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 55, 48, 32, 76, 69, 88, 69,
-/* 0x54d0 */  67, 48, 50, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x54e0 */  52, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x54f0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 48,100,
-/* 0x5500 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x5510 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x5520 */  89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10,
-/* 0x5530 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5540 */  32, 78, 50, 66, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5550 */  48, 48, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48,
-/* 0x5560 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x5570 */  70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x5580 */  50, 66, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5590 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 49,
-/* 0x55a0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69,
-/* 0x55b0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x55c0 */  32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48,  9, 48, 48,
-/* 0x55d0 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10,
-/* 0x55e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x55f0 */  32, 78, 50, 66, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5600 */  48, 48, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x5610 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x5620 */  68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x5630 */  50, 66, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5640 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54,
-/* 0x5650 */  49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65,
-/* 0x5660 */  83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5670 */  32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 54, 48,  9, 48, 48,
-/* 0x5680 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10,
-/* 0x5690 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x56a0 */  32, 78, 50, 68, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x56b0 */  48, 48, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48,
-/* 0x56c0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x56d0 */  70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x56e0 */  50, 68, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x56f0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 49,
-/* 0x5700 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69,
-/* 0x5710 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5720 */  32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48,  9, 48, 48,
-/* 0x5730 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 50, 48, 10,
-/* 0x5740 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5750 */  32, 78, 50, 68, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5760 */  48, 48, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x5770 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x5780 */  68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x5790 */  50, 68, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x57a0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54,
-/* 0x57b0 */  49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65,
-/* 0x57c0 */  83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x57d0 */  32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48,  9, 48, 48,
-/* 0x57e0 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10,
-/* 0x57f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5800 */  32, 78, 50, 69, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5810 */  48, 48, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48,
-/* 0x5820 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x5830 */  70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x5840 */  50, 69, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5850 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 49,
-/* 0x5860 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69,
-/* 0x5870 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5880 */  32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48,  9, 48, 48,
-/* 0x5890 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10,
-/* 0x58a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x58b0 */  32, 78, 50, 69, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x58c0 */  48, 48, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x58d0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x58e0 */  68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x58f0 */  50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5900 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54,
-/* 0x5910 */  49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65,
-/* 0x5920 */  83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5930 */  32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48,  9, 48, 48,
-/* 0x5940 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10,
-/* 0x5950 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5960 */  32, 76, 88, 85, 78, 70, 48, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5970 */  48, 48, 32, 76, 88, 85, 78, 70, 48, 49, 48, 10, 48, 48, 48, 48,
-/* 0x5980 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74,
-/* 0x5990 */  67, 67, 48, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x59a0 */  88, 74, 67, 67, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x59b0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51,
-/* 0x59c0 */  55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70,
-/* 0x59d0 */  48, 51, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x59e0 */  32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 55, 48,  9, 48, 48,
-/* 0x59f0 */  48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 55, 48, 10,
-/* 0x5a00 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5a10 */  32, 76, 88, 77, 82, 85, 49, 48, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5a20 */  48, 48, 32, 76, 88, 77, 82, 85, 49, 48, 48, 10, 48, 48, 48, 48,
-/* 0x5a30 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85,
-/* 0x5a40 */  78, 70, 48, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x5a50 */  88, 85, 78, 70, 48, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5a60 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 52,
-/* 0x5a70 */  50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70,
-/* 0x5a80 */  48, 52, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5a90 */  32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 51, 48,  9, 48, 48,
-/* 0x5aa0 */  48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 51, 48, 10,
-/* 0x5ab0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5ac0 */  32, 76, 88, 85, 78, 70, 48, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5ad0 */  48, 48, 32, 76, 88, 85, 78, 70, 48, 51, 48, 10, 48, 48, 48, 48,
-/* 0x5ae0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67,
-/* 0x5af0 */  74, 56, 77, 82, 85,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x5b00 */  88, 67, 74, 56, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5b10 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51,
-/* 0x5b20 */  52,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70,
-/* 0x5b30 */  48, 51, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5b40 */  32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48,  9, 48,
-/* 0x5b50 */  48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 48,
-/* 0x5b60 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x5b70 */ 100, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48,  9, 48, 48, 48,
-/* 0x5b80 */  48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 49, 48, 10,
-/* 0x5b90 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5ba0 */  32, 99,116,111,107, 51, 50, 46, 50, 48,  9, 48, 48, 48, 48, 48,
-/* 0x5bb0 */  48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 48, 48,
-/* 0x5bc0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,
-/* 0x5bd0 */ 116,111,107, 51, 50, 46, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5be0 */  48, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48,
-/* 0x5bf0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76,
-/* 0x5c00 */  76, 84, 82, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67,
-/* 0x5c10 */  65, 76, 76, 84, 82, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5c20 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x5c30 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84,
-/* 0x5c40 */  82, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5c50 */  32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49,  9, 48, 48,
-/* 0x5c60 */  48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 49, 49, 10,
-/* 0x5c70 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5c80 */  32, 67, 65, 76, 76, 84, 82, 49, 51,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5c90 */  48, 48, 32, 67, 65, 76, 76, 84, 82, 49, 51, 10, 48, 48, 48, 48,
-/* 0x5ca0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88,
-/* 0x5cb0 */  69, 67, 48, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x5cc0 */  69, 88, 69, 67, 48, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5cd0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 50,
-/* 0x5ce0 */  53,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 69, 88, 69, 67,
-/* 0x5cf0 */  48, 50, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5d00 */  32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 48, 48,  9, 48, 48,
-/* 0x5d10 */  48, 48, 48, 48, 48, 48, 32, 76, 69, 88, 69, 67, 48, 48, 48, 10,
-/* 0x5d20 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5d30 */  32, 76, 69, 88, 69, 67, 48, 48, 57,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5d40 */  48, 48, 32, 76, 69, 88, 69, 67, 48, 48, 57, 10, 48, 48, 48, 48,
-/* 0x5d50 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88,
-/* 0x5d60 */  69, 67, 48, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x5d70 */  69, 88, 69, 67, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5d80 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 49,
-/* 0x5d90 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65,
-/* 0x5da0 */  83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5db0 */  32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 50, 48,  9, 48, 48,
-/* 0x5dc0 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 50, 48, 10,
-/* 0x5dd0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5de0 */  32, 78, 50, 66, 70, 65, 83, 50, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5df0 */  48, 48, 32, 78, 50, 66, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48,
-/* 0x5e00 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x5e10 */  83, 77, 65, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x5e20 */  50, 66, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5e30 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 51,
-/* 0x5e40 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65,
-/* 0x5e50 */  83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5e60 */  32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 52, 48,  9, 48, 48,
-/* 0x5e70 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 52, 48, 10,
-/* 0x5e80 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5e90 */  32, 78, 50, 66, 70, 65, 83, 52, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5ea0 */  48, 48, 32, 78, 50, 66, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48,
-/* 0x5eb0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x5ec0 */  83, 77, 65, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x5ed0 */  50, 66, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5ee0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 53,
-/* 0x5ef0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65,
-/* 0x5f00 */  83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5f10 */  32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 54, 48,  9, 48, 48,
-/* 0x5f20 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 54, 48, 10,
-/* 0x5f30 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5f40 */  32, 78, 50, 66, 70, 65, 83, 54, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5f50 */  48, 48, 32, 78, 50, 66, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48,
-/* 0x5f60 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x5f70 */  70, 65, 83, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x5f80 */  50, 68, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5f90 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 50,
-/* 0x5fa0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77,
-/* 0x5fb0 */  65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5fc0 */  32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 50, 48,  9, 48, 48,
-/* 0x5fd0 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 50, 48, 10,
-/* 0x5fe0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5ff0 */  32, 78, 50, 68, 83, 77, 65, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6000 */  48, 48, 32, 78, 50, 68, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48,
-/* 0x6010 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x6020 */  70, 65, 83, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x6030 */  50, 68, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6040 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 52,
-/* 0x6050 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77,
-/* 0x6060 */  65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6070 */  32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 52, 48,  9, 48, 48,
-/* 0x6080 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 52, 48, 10,
-/* 0x6090 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x60a0 */  32, 78, 50, 68, 83, 77, 65, 53, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x60b0 */  48, 48, 32, 78, 50, 68, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48,
-/* 0x60c0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x60d0 */  70, 65, 83, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x60e0 */  50, 68, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x60f0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 54,
-/* 0x6100 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77,
-/* 0x6110 */  65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6120 */  32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 48,  9, 48, 48,
-/* 0x6130 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 54, 48, 10,
-/* 0x6140 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6150 */  32, 78, 50, 69, 70, 65, 83, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6160 */  48, 48, 32, 78, 50, 69, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48,
-/* 0x6170 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x6180 */  83, 77, 65, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x6190 */  50, 69, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x61a0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 50,
-/* 0x61b0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65,
-/* 0x61c0 */  83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x61d0 */  32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 51, 48,  9, 48, 48,
-/* 0x61e0 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 51, 48, 10,
-/* 0x61f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6200 */  32, 78, 50, 69, 70, 65, 83, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6210 */  48, 48, 32, 78, 50, 69, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48,
-/* 0x6220 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x6230 */  83, 77, 65, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x6240 */  50, 69, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6250 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 52,
-/* 0x6260 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65,
-/* 0x6270 */  83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6280 */  32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 53, 48,  9, 48, 48,
-/* 0x6290 */  48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 53, 48, 10,
-/* 0x62a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x62b0 */  32, 78, 50, 69, 70, 65, 83, 53, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x62c0 */  48, 48, 32, 78, 50, 69, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48,
-/* 0x62d0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x62e0 */  83, 77, 65, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x62f0 */  50, 69, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6300 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54,
-/* 0x6310 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65,
-/* 0x6320 */  83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6330 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,  9,
-/* 0x6340 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x6350 */  67, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6360 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9,
-/* 0x6370 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76,
-/* 0x6380 */  70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6390 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9,
-/* 0x63a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x63b0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x63c0 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9,
-/* 0x63d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x63e0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x63f0 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9,
-/* 0x6400 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x6410 */  67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6420 */  32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 49, 53,  9, 48, 48,
-/* 0x6430 */  48, 48, 48, 48, 48, 48, 32, 76, 69, 88, 69, 67, 48, 49, 53, 10,
-/* 0x6440 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6450 */  32, 76, 88, 85, 78, 70, 48, 48, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6460 */  48, 48, 32, 76, 88, 85, 78, 70, 48, 48, 48, 10, 48, 48, 48, 48,
-/* 0x6470 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85,
-/* 0x6480 */  78, 70, 48, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x6490 */  88, 85, 78, 70, 48, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x64a0 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69,
-/* 0x64b0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 89,
-/* 0x64c0 */  84, 69, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x64d0 */  32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 48, 53,  9, 48, 48,
-/* 0x64e0 */  48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 48, 53, 10,
-/* 0x64f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6500 */  32, 76, 88, 77, 82, 85, 48, 48, 54,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6510 */  48, 48, 32, 76, 88, 77, 82, 85, 48, 48, 54, 10, 48, 48, 48, 48,
-/* 0x6520 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77,
-/* 0x6530 */  82, 85, 48, 48, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x6540 */  88, 77, 82, 85, 48, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6550 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 48,
-/* 0x6560 */  56,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70,
-/* 0x6570 */  48, 48, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6580 */  32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 52, 53,  9, 48, 48,
-/* 0x6590 */  48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 52, 53, 10,
-/* 0x65a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x65b0 */  32, 76, 88, 77, 82, 85, 48, 52, 54,  9, 48, 48, 48, 48, 48, 48,
-/* 0x65c0 */  48, 48, 32, 76, 88, 77, 82, 85, 48, 52, 54, 10, 48, 48, 48, 48,
-/* 0x65d0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74,
-/* 0x65e0 */  67, 67, 48, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x65f0 */  88, 74, 67, 67, 48, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6600 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 50,
-/* 0x6610 */  49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 74, 67, 67,
-/* 0x6620 */  48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6630 */  32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 50, 51,  9, 48, 48,
-/* 0x6640 */  48, 48, 48, 48, 48, 48, 32, 76, 88, 74, 67, 67, 48, 50, 51, 10,
-/* 0x6650 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6660 */  32, 76, 88, 85, 78, 70, 51, 56, 54,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6670 */  48, 48, 32, 76, 88, 85, 78, 70, 51, 56, 54, 10, 48, 48, 48, 48,
-/* 0x6680 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85,
-/* 0x6690 */  78, 70, 51, 56, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x66a0 */  88, 85, 78, 70, 51, 56, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x66b0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 51, 56,
-/* 0x66c0 */  56,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70,
-/* 0x66d0 */  51, 56, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x66e0 */  32, 32,100, 32, 32, 76, 88, 85, 78, 70, 52, 56, 54,  9, 48, 48,
-/* 0x66f0 */  48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70, 52, 56, 54, 10,
-/* 0x6700 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6710 */  32, 76, 88, 85, 78, 70, 52, 56, 55,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6720 */  48, 48, 32, 76, 88, 85, 78, 70, 52, 56, 55, 10, 48, 48, 48, 48,
-/* 0x6730 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77,
-/* 0x6740 */  82, 85, 48, 54, 53,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x6750 */  88, 77, 82, 85, 48, 54, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6760 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69,
-/* 0x6770 */  51,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 89,
-/* 0x6780 */  84, 69, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6790 */  32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 51, 48,  9, 48, 48,
-/* 0x67a0 */  48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 65, 82, 66, 51, 48, 10,
-/* 0x67b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x67c0 */  32, 77, 82, 85, 66, 73, 84, 83, 51,  9, 48, 48, 48, 48, 48, 48,
-/* 0x67d0 */  48, 48, 32, 77, 82, 85, 66, 73, 84, 83, 51, 10, 48, 48, 48, 48,
-/* 0x67e0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85,
-/* 0x67f0 */  65, 82, 66, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77,
-/* 0x6800 */  82, 85, 65, 82, 66, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6810 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69,
-/* 0x6820 */  52,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 89,
-/* 0x6830 */  84, 69, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6840 */  32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 52,  9, 48, 48,
-/* 0x6850 */  48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 73, 84, 83, 52, 10,
-/* 0x6860 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6870 */  32, 77, 82, 85, 65, 82, 66, 53, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6880 */  48, 48, 32, 77, 82, 85, 65, 82, 66, 53, 48, 10, 48, 48, 48, 48,
-/* 0x6890 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77,
-/* 0x68a0 */  82, 85, 48, 56, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x68b0 */  88, 77, 82, 85, 48, 56, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x68c0 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69,
-/* 0x68d0 */  53,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 89,
-/* 0x68e0 */  84, 69, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x68f0 */  32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 54, 48,  9, 48, 48,
-/* 0x6900 */  48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 65, 82, 66, 54, 48, 10,
-/* 0x6910 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6920 */  32, 77, 82, 85, 66, 73, 84, 83, 53,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6930 */  48, 48, 32, 77, 82, 85, 66, 73, 84, 83, 53, 10, 48, 48, 48, 48,
-/* 0x6940 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85,
-/* 0x6950 */  65, 82, 66, 55, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77,
-/* 0x6960 */  82, 85, 65, 82, 66, 55, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6970 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 57,
-/* 0x6980 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85,
-/* 0x6990 */  48, 57, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x69a0 */  32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 54,  9, 48, 48,
-/* 0x69b0 */  48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 89, 84, 69, 54, 10,
-/* 0x69c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x69d0 */  32, 77, 82, 85, 65, 82, 66, 56, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x69e0 */  48, 48, 32, 77, 82, 85, 65, 82, 66, 56, 48, 10, 48, 48, 48, 48,
-/* 0x69f0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85,
-/* 0x6a00 */  66, 73, 84, 83, 54,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77,
-/* 0x6a10 */  82, 85, 66, 73, 84, 83, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6a20 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 57,
-/* 0x6a30 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 65, 82,
-/* 0x6a40 */  66, 57, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6a50 */  32, 32,100, 32, 32, 76, 88, 77, 82, 85, 49, 49, 48,  9, 48, 48,
-/* 0x6a60 */  48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 49, 49, 48, 10,
-/* 0x6a70 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6a80 */  32, 76, 88, 77, 82, 85, 49, 49, 49,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6a90 */  48, 48, 32, 76, 88, 77, 82, 85, 49, 49, 49, 10, 48, 48, 48, 48,
-/* 0x6aa0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85,
-/* 0x6ab0 */  78, 70, 48, 52, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x6ac0 */  88, 85, 78, 70, 48, 52, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6ad0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 49,
-/* 0x6ae0 */  54,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 69, 88, 69, 67,
-/* 0x6af0 */  48, 49, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6b00 */  32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 49, 48,  9, 48, 48,
-/* 0x6b10 */  48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 49, 48, 10,
-/* 0x6b20 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6b30 */  32, 76, 88, 74, 77, 80, 65, 48, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6b40 */  48, 48, 32, 76, 88, 74, 77, 80, 65, 48, 48, 10, 48, 48, 48, 48,
-/* 0x6b50 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67,
-/* 0x6b60 */  65, 76, 76, 66, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x6b70 */  88, 67, 65, 76, 76, 66, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6b80 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 50,
-/* 0x6b90 */  49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70,
-/* 0x6ba0 */  48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6bb0 */  32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 50, 50,  9, 48, 48,
-/* 0x6bc0 */  48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 50, 50, 10,
-/* 0x6bd0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6be0 */  32, 76, 88, 74, 77, 80, 65, 48, 49,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6bf0 */  48, 48, 32, 76, 88, 74, 77, 80, 65, 48, 49, 10, 48, 48, 48, 48,
-/* 0x6c00 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67,
-/* 0x6c10 */  65, 76, 76, 66, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x6c20 */  88, 67, 65, 76, 76, 66, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6c30 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83,
-/* 0x6c40 */  49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 73,
-/* 0x6c50 */  84, 83, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6c60 */  32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 49,  9, 48, 48,
-/* 0x6c70 */  48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 89, 84, 69, 49, 10,
-/* 0x6c80 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6c90 */  32, 77, 82, 85, 65, 82, 66, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6ca0 */  48, 48, 32, 77, 82, 85, 65, 82, 66, 49, 48, 10, 48, 48, 48, 48,
-/* 0x6cb0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77,
-/* 0x6cc0 */  82, 85, 48, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x6cd0 */  88, 77, 82, 85, 48, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6ce0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 48,
-/* 0x6cf0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 74, 67, 67,
-/* 0x6d00 */  48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6d10 */  32, 32,100, 32, 32, 76, 88, 67, 74, 48, 77, 82, 85,  9, 48, 48,
-/* 0x6d20 */  48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 74, 48, 77, 82, 85, 10,
-/* 0x6d30 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6d40 */  32, 76, 88, 67, 74, 49, 77, 82, 85,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6d50 */  48, 48, 32, 76, 88, 67, 74, 49, 77, 82, 85, 10, 48, 48, 48, 48,
-/* 0x6d60 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67,
-/* 0x6d70 */  65, 76, 74, 77, 80,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x6d80 */  88, 67, 65, 76, 74, 77, 80, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6d90 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 48,
-/* 0x6da0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 65, 76,
-/* 0x6db0 */  76, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6dc0 */  32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 48, 49,  9, 48, 48,
-/* 0x6dd0 */  48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 65, 76, 76, 48, 49, 10,
-/* 0x6de0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6df0 */  32, 76, 88, 67, 74, 50, 77, 82, 85,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6e00 */  48, 48, 32, 76, 88, 67, 74, 50, 77, 82, 85, 10, 48, 48, 48, 48,
-/* 0x6e10 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67,
-/* 0x6e20 */  74, 52, 77, 82, 85,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x6e30 */  88, 67, 74, 52, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6e40 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 54, 77, 82,
-/* 0x6e50 */  85,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 74, 54,
-/* 0x6e60 */  77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6e70 */  32, 32,100, 32, 32, 76, 88, 67, 74, 55, 77, 82, 85,  9, 48, 48,
-/* 0x6e80 */  48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 74, 55, 77, 82, 85, 10,
-/* 0x6e90 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6ea0 */  32, 76, 88, 77, 82, 85, 48, 53, 53,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6eb0 */  48, 48, 32, 76, 88, 77, 82, 85, 48, 53, 53, 10, 48, 48, 48, 48,
-/* 0x6ec0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85,
-/* 0x6ed0 */  66, 89, 84, 69, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77,
-/* 0x6ee0 */  82, 85, 66, 89, 84, 69, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6ef0 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83,
-/* 0x6f00 */  50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 73,
-/* 0x6f10 */  84, 83, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6f20 */  32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 50, 48,  9, 48, 48,
-/* 0x6f30 */  48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 65, 82, 66, 50, 48, 10,
-/* 0x6f40 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6f50 */  32, 76, 88, 77, 82, 85, 48, 53, 55,  9, 48, 48, 48, 48, 48, 48,
-/* 0x6f60 */  48, 48, 32, 76, 88, 77, 82, 85, 48, 53, 55, 10, 48, 48, 48, 48,
-/* 0x6f70 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77,
-/* 0x6f80 */  82, 85, 48, 53, 56,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x6f90 */  88, 77, 82, 85, 48, 53, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6fa0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51,
-/* 0x6fb0 */  53,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70,
-/* 0x6fc0 */  48, 51, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6fd0 */  32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 51, 48,  9, 48,
-/* 0x6fe0 */  48, 48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 51,
-/* 0x6ff0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x7000 */ 100, 32, 32, 67, 84, 67, 76, 69, 86, 69, 49,  9, 48, 48, 48, 48,
-/* 0x7010 */  48, 48, 48, 48, 32, 67, 84, 67, 76, 69, 86, 69, 49, 10, 48, 48,
-/* 0x7020 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x7030 */  65, 76, 76, 84, 82, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7040 */  32, 67, 65, 76, 76, 84, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x7050 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72,
-/* 0x7060 */  82, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66,
-/* 0x7070 */  83, 72, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x7080 */  32, 32, 32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 48, 49,  9,
-/* 0x7090 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 82, 79, 82, 48,
-/* 0x70a0 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x70b0 */ 100, 32, 32, 67, 84, 66, 83, 87, 65, 48, 49,  9, 48, 48, 48, 48,
-/* 0x70c0 */  48, 48, 48, 48, 32, 67, 84, 66, 83, 87, 65, 48, 49, 10, 48, 48,
-/* 0x70d0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x70e0 */  65, 76, 76, 84, 82, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x70f0 */  32, 67, 65, 76, 76, 84, 82, 48, 50, 10, 48, 48, 48, 48, 48, 48,
-/* 0x7100 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84,
-/* 0x7110 */  82, 69, 56,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76,
-/* 0x7120 */  76, 84, 82, 69, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x7130 */  32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 69, 57,  9,
-/* 0x7140 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 69,
-/* 0x7150 */  57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x7160 */ 100, 32, 32, 67, 84, 67, 76, 69, 86, 69, 50,  9, 48, 48, 48, 48,
-/* 0x7170 */  48, 48, 48, 48, 32, 67, 84, 67, 76, 69, 86, 69, 50, 10, 48, 48,
-/* 0x7180 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x7190 */  65, 76, 76, 84, 82, 49, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x71a0 */  32, 67, 65, 76, 76, 84, 82, 49, 50, 10, 48, 48, 48, 48, 48, 48,
-/* 0x71b0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72,
-/* 0x71c0 */  82, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66,
-/* 0x71d0 */  83, 72, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x71e0 */  32, 32, 32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 49, 49,  9,
-/* 0x71f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 82, 79, 82, 49,
-/* 0x7200 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x7210 */ 100, 32, 32, 67, 84, 66, 83, 87, 65, 49, 49,  9, 48, 48, 48, 48,
-/* 0x7220 */  48, 48, 48, 48, 32, 67, 84, 66, 83, 87, 65, 49, 49, 10, 48, 48,
-/* 0x7230 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x7240 */  69, 88, 69, 67, 48, 49, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7250 */  32, 76, 69, 88, 69, 67, 48, 49, 55, 10, 48, 48, 48, 48, 48, 48,
-/* 0x7260 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 85, 78, 77, 80,
-/* 0x7270 */  48, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 85, 78,
-/* 0x7280 */  77, 80, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x7290 */  32, 32, 32, 32,100, 32, 32, 76, 85, 78, 77, 80, 48, 48, 49,  9,
-/* 0x72a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 85, 78, 77, 80, 48, 48,
-/* 0x72b0 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32,
-/* 0x72c0 */  32, 32, 32, 76, 69, 88, 69, 67, 48, 48, 48,  9, 48, 48, 48, 48,
-/* 0x72d0 */  48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48,
-/* 0x72e0 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x72f0 */  68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97,
-/* 0x7300 */  95,115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10, 48, 48,
-/* 0x7310 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x7320 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,
-/* 0x7330 */ 109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7340 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x7350 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95, 99, 95,
-/* 0x7360 */ 108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x7370 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x7380 */  48, 48, 48, 32,108,122,109, 97, 95,112,114,111,112,101,114,116,
-/* 0x7390 */ 105,101,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x73a0 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x73b0 */  48, 48, 48, 32, 78, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x73c0 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x73d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,101,114, 95,
-/* 0x73e0 */ 108,101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x73f0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x7400 */  48, 48, 48, 48, 48, 48, 32,102,105,108,116,101,114, 95, 99,116,
-/* 0x7410 */ 111, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x7420 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7430 */  48, 32, 79, 95, 66, 73, 78, 70, 79, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7440 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x7450 */  82, 32, 91, 76, 69, 88, 69, 67, 48, 48, 48, 93, 58, 10, 79, 70,
-/* 0x7460 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x7470 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x7480 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x7490 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 69, 88, 69, 67, 48,
-/* 0x74a0 */  50, 53, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x74b0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83,
-/* 0x74c0 */  77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x74d0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x74e0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x74f0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x7500 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x7510 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x7520 */  70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 49, 48, 93, 58, 10,
-/* 0x7530 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x7540 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x7550 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7560 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x7570 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x7580 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x7590 */  66, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x75a0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x75b0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x75c0 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x75d0 */  32, 32, 32, 32, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 10, 82,
-/* 0x75e0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x75f0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 50, 48, 93,
-/* 0x7600 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x7610 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x7620 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56,
-/* 0x7630 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x7640 */  66, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x7650 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x7660 */  78, 50, 66, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x7670 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7680 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x7690 */  48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x76a0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10,
-/* 0x76b0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x76c0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 51,
-/* 0x76d0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x76e0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x76f0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95,
-/* 0x7700 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7710 */  78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7720 */ 101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7730 */  32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 10, 82, 69,
-/* 0x7740 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x7750 */  32, 70, 79, 82, 32, 91, 78, 50, 66, 68, 69, 67, 51, 48, 93, 58,
-/* 0x7760 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x7770 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x7780 */  69, 10, 48, 48, 48, 48, 48, 48, 49, 49, 32, 82, 95, 51, 56, 54,
-/* 0x7790 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x77a0 */  68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 50,102, 32, 82,
-/* 0x77b0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x77c0 */  32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x77d0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x77e0 */  82, 32, 91, 78, 50, 66, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70,
-/* 0x77f0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x7800 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x7810 */  48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x7820 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x7830 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x7840 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70,
-/* 0x7850 */  65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x7860 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7870 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x7880 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x7890 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x78a0 */  48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x78b0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10,
-/* 0x78c0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x78d0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 54,
-/* 0x78e0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x78f0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x7900 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95,
-/* 0x7910 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7920 */  78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x7930 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x7940 */  32, 91, 78, 50, 66, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70,
-/* 0x7950 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7960 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7970 */  48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x7980 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 70, 65, 83, 54,
-/* 0x7990 */  49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54,
-/* 0x79a0 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x79b0 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x79c0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x79d0 */  50, 66, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x79e0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x79f0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x7a00 */  48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x7a10 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10,
-/* 0x7a20 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x7a30 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 49, 48,
-/* 0x7a40 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x7a50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x7a60 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x7a70 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x7a80 */  50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x7a90 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x7aa0 */  91, 78, 50, 68, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x7ab0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7ac0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x7ad0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x7ae0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48,
-/* 0x7af0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x7b00 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65,
-/* 0x7b10 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x7b20 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7b30 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x7b40 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7b50 */  32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7b60 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x7b70 */  82, 32, 91, 78, 50, 68, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70,
-/* 0x7b80 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x7b90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x7ba0 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x7bb0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x7bc0 */  49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x7bd0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83,
-/* 0x7be0 */  77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x7bf0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7c00 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x7c10 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x7c20 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x7c30 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x7c40 */  70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 51, 48, 93, 58, 10,
-/* 0x7c50 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x7c60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x7c70 */  10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7c80 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x7c90 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95,
-/* 0x7ca0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7cb0 */  78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x7cc0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x7cd0 */  32, 91, 78, 50, 68, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70,
-/* 0x7ce0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7cf0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7d00 */  48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x7d10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 50,
-/* 0x7d20 */  48, 10, 48, 48, 48, 48, 48, 48, 50, 49, 32, 82, 95, 51, 56, 54,
-/* 0x7d30 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x7d40 */  68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 52, 51, 32, 82,
-/* 0x7d50 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7d60 */  32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7d70 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x7d80 */  82, 32, 91, 78, 50, 68, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70,
-/* 0x7d90 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x7da0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x7db0 */  48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x7dc0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x7dd0 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x7de0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70,
-/* 0x7df0 */  65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x7e00 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7e10 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x7e20 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x7e30 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x7e40 */  48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x7e50 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10,
-/* 0x7e60 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x7e70 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 54,
-/* 0x7e80 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x7e90 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x7ea0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95,
-/* 0x7eb0 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7ec0 */  78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x7ed0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x7ee0 */  32, 91, 78, 50, 68, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70,
-/* 0x7ef0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7f00 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7f10 */  48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x7f20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 70, 65, 83, 54,
-/* 0x7f30 */  49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54,
-/* 0x7f40 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x7f50 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7f60 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x7f70 */  50, 68, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x7f80 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7f90 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x7fa0 */  48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x7fb0 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10,
-/* 0x7fc0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x7fd0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 49, 48,
-/* 0x7fe0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x7ff0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x8000 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x8010 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x8020 */  50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x8030 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x8040 */  91, 78, 50, 69, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x8050 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8060 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x8070 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x8080 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48,
-/* 0x8090 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x80a0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65,
-/* 0x80b0 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x80c0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x80d0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x80e0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x80f0 */  32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x8100 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x8110 */  82, 32, 91, 78, 50, 69, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70,
-/* 0x8120 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x8130 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x8140 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x8150 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 70, 65, 83,
-/* 0x8160 */  49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x8170 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83,
-/* 0x8180 */  77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x8190 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x81a0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x81b0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x81c0 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x81d0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x81e0 */  70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 51, 48, 93, 58, 10,
-/* 0x81f0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x8200 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x8210 */  10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95,
-/* 0x8220 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x8230 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95,
-/* 0x8240 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8250 */  78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x8260 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x8270 */  32, 91, 78, 50, 69, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70,
-/* 0x8280 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x8290 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x82a0 */  48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x82b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 50,
-/* 0x82c0 */  48, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54,
-/* 0x82d0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x82e0 */  68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 51, 48, 32, 82,
-/* 0x82f0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8300 */  32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x8310 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x8320 */  82, 32, 91, 78, 50, 69, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70,
-/* 0x8330 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x8340 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x8350 */  48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x8360 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x8370 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x8380 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70,
-/* 0x8390 */  65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x83a0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x83b0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x83c0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x83d0 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x83e0 */  48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x83f0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10,
-/* 0x8400 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x8410 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 54,
-/* 0x8420 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x8430 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x8440 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95,
-/* 0x8450 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8460 */  78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x8470 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x8480 */  32, 91, 78, 50, 69, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70,
-/* 0x8490 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x84a0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x84b0 */  48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x84c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 70, 65, 83, 54,
-/* 0x84d0 */  49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54,
-/* 0x84e0 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x84f0 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x8500 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x8510 */  50, 69, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x8520 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8530 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x8540 */  48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x8550 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10,
-/* 0x8560 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x8570 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x8580 */  48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x8590 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x85a0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82,
-/* 0x85b0 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x85c0 */  32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,
-/* 0x85d0 */ 115,116, 10, 48, 48, 48, 48, 48, 48, 49, 52, 32, 82, 95, 51, 56,
-/* 0x85e0 */  54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,
-/* 0x85f0 */ 109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x8600 */ 101, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x8610 */  32, 32, 32, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48,
-/* 0x8620 */  48, 48, 48, 48, 48, 50, 97, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x8630 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,
-/* 0x8640 */ 114,111,112,101,114,116,105,101,115, 10, 10, 82, 69, 76, 79, 67,
-/* 0x8650 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x8660 */  82, 32, 91, 76, 88, 85, 78, 70, 48, 48, 48, 93, 58, 10, 79, 70,
-/* 0x8670 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x8680 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x8690 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x86a0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x86b0 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x86c0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82,
-/* 0x86d0 */  85, 48, 48, 53, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x86e0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x86f0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x8700 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8710 */  32, 32, 32, 78, 77, 82, 85, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x8720 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x8730 */  91, 76, 88, 85, 78, 70, 48, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x8740 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8750 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x8760 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,
-/* 0x8770 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 50,
-/* 0x8780 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x8790 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 74, 67, 67, 48,
-/* 0x87a0 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x87b0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x87c0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x87d0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x87e0 */  32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79, 67,
-/* 0x87f0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x8800 */  82, 32, 91, 76, 88, 74, 67, 67, 48, 50, 49, 93, 58, 10, 79, 70,
-/* 0x8810 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x8820 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x8830 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x8840 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x8850 */  51, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x8860 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78,
-/* 0x8870 */  70, 51, 56, 56, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x8880 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8890 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x88a0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x88b0 */  32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10, 82, 69, 76,
-/* 0x88c0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x88d0 */  70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 52, 56, 55, 93, 58, 10,
-/* 0x88e0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x88f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x8900 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x8910 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78,
-/* 0x8920 */  70, 48, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x8930 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88,
-/* 0x8940 */  77, 82, 85, 48, 54, 53, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x8950 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8960 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x8970 */  48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x8980 */  32, 32, 32, 32, 32, 76, 88, 77, 82, 85, 48, 55, 48, 10, 10, 82,
-/* 0x8990 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x89a0 */  83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 55, 48, 93,
-/* 0x89b0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x89c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x89d0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56,
-/* 0x89e0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88,
-/* 0x89f0 */  85, 78, 70, 48, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x8a00 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x8a10 */  76, 88, 77, 82, 85, 48, 57, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x8a20 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8a30 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x8a40 */  48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x8a50 */  32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82, 85, 49, 48, 48, 10,
-/* 0x8a60 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x8a70 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 52,
-/* 0x8a80 */  49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x8a90 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x8aa0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95,
-/* 0x8ab0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8ac0 */  76, 88, 85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x8ad0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x8ae0 */  32, 91, 76, 69, 88, 69, 67, 48, 49, 54, 93, 58, 10, 79, 70, 70,
-/* 0x8af0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x8b00 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x8b10 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x8b20 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52,
-/* 0x8b30 */  50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x8b40 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82, 85,
-/* 0x8b50 */  48, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x8b60 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8b70 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x8b80 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8b90 */  32, 32, 76, 88, 77, 82, 85, 48, 51, 48, 10, 10, 82, 69, 76, 79,
-/* 0x8ba0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x8bb0 */  79, 82, 32, 91, 76, 88, 74, 67, 67, 48, 48, 48, 93, 58, 10, 79,
-/* 0x8bc0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x8bd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x8be0 */  48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x8bf0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 74, 67, 67,
-/* 0x8c00 */  48, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x8c10 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67,
-/* 0x8c20 */  65, 76, 76, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x8c30 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8c40 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x8c50 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x8c60 */  32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 10, 82, 69,
-/* 0x8c70 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x8c80 */  32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 50, 77, 82, 85, 93, 58,
-/* 0x8c90 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x8ca0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x8cb0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x8cc0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85,
-/* 0x8cd0 */  78, 70, 48, 51, 55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x8ce0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x8cf0 */  88, 67, 74, 52, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x8d00 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8d10 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x8d20 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x8d30 */  32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10,
-/* 0x8d40 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x8d50 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 54, 77, 82, 85,
-/* 0x8d60 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x8d70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x8d80 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x8d90 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x8da0 */  88, 67, 74, 56, 77, 82, 85, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x8db0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x8dc0 */  91, 76, 88, 67, 74, 55, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83,
-/* 0x8dd0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8de0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x8df0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x8e00 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 67, 74, 56, 77, 82, 85,
-/* 0x8e10 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x8e20 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 56, 77,
-/* 0x8e30 */  82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x8e40 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8e50 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82,
-/* 0x8e60 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8e70 */  32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 10, 82, 69, 76, 79, 67,
-/* 0x8e80 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x8e90 */  82, 32, 91, 76, 88, 85, 78, 70, 48, 51, 52, 93, 58, 10, 79, 70,
-/* 0x8ea0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x8eb0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x8ec0 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x8ed0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x8ee0 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x8ef0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107,
-/* 0x8f00 */  51, 50, 46, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x8f10 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8f20 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x8f30 */  51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x8f40 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 10, 82,
-/* 0x8f50 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x8f60 */  83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 49, 48,
-/* 0x8f70 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x8f80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x8f90 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,100, 32, 82, 95, 51,
-/* 0x8fa0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x8fb0 */ 116,111,107, 51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x8fc0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x8fd0 */  32, 91, 99,116,111,107, 51, 50, 46, 50, 48, 93, 58, 10, 79, 70,
-/* 0x8fe0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x8ff0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x9000 */  48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x9010 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50,
-/* 0x9020 */  46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51,
-/* 0x9030 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x9040 */ 116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x9050 */  48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x9060 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 10, 82,
-/* 0x9070 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x9080 */  83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 51, 48,
-/* 0x9090 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x90a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x90b0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51,
-/* 0x90c0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x90d0 */ 116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x90e0 */  57, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x90f0 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 10, 82,
-/* 0x9100 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x9110 */  83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x9120 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x9130 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x9140 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51,
-/* 0x9150 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x9160 */ 116,111,107, 51, 50, 46, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x9170 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x9180 */  32, 91, 67, 65, 76, 76, 84, 82, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x9190 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x91a0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x91b0 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x91c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,
-/* 0x91d0 */ 108,101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x91e0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x91f0 */  67, 84, 67, 76, 69, 86, 69, 49, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x9200 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9210 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x9220 */  48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32,
-/* 0x9230 */  32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,
-/* 0x9240 */ 111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54,
-/* 0x9250 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76,
-/* 0x9260 */  76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x9270 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67,
-/* 0x9280 */  65, 76, 76, 84, 82, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x9290 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x92a0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x92b0 */  48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x92c0 */  32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10,
-/* 0x92d0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x92e0 */  68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 48,
-/* 0x92f0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x9300 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x9310 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x9320 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,
-/* 0x9330 */ 105,108,116,101,114, 95,108,101,110,103,116,104, 10, 10, 82, 69,
-/* 0x9340 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x9350 */  32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 49, 93, 58,
-/* 0x9360 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x9370 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x9380 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54,
-/* 0x9390 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76,
-/* 0x93a0 */  76, 84, 82, 49, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x93b0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67,
-/* 0x93c0 */  84, 67, 76, 69, 86, 69, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x93d0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x93e0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x93f0 */  48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32,
-/* 0x9400 */  32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,111,
-/* 0x9410 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95,
-/* 0x9420 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76,
-/* 0x9430 */  84, 82, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x9440 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65,
-/* 0x9450 */  76, 76, 84, 82, 49, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x9460 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9470 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x9480 */  48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x9490 */  32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 48, 10, 10, 82,
-/* 0x94a0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x94b0 */  83, 32, 70, 79, 82, 32, 91, 76, 69, 88, 69, 67, 48, 50, 53, 93,
-/* 0x94c0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x94d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x94e0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 51, 99, 32, 82, 95, 51, 56,
-/* 0x94f0 */  54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 69,
-/* 0x9500 */  88, 69, 67, 48, 50, 48, 10, 48, 48, 48, 48, 48, 48, 52, 48, 32,
-/* 0x9510 */  82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9520 */  32, 32, 79, 95, 66, 73, 78, 70, 79, 10, 48, 48, 48, 48, 48, 48,
-/* 0x9530 */  49,100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x9540 */  32, 32, 32, 32, 32, 76, 69, 88, 69, 67, 48, 50, 48, 10
+/* 0x1b50 */   0,171,  0,  0,  0,180,  0,  0,  0, 96,  0,  0,  0,157,  6,  0,
+/* 0x1b60 */   0,  0,  0,  0,  0,  5,  0,  0,  0, 52,  0,  0,  0,  0,  0,  0,
+/* 0x1b70 */   0,  9,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */   0, 18,  0,  0,  0, 12,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,
+/* 0x1b90 */   0, 27,  0,  0,  0,  3,  0,  0,  0, 69,  0,  0,  0,  0,  0,  0,
+/* 0x1ba0 */   0, 36,  0,  0,  0,  2,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */   0, 45,  0,  0,  0,  6,  0,  0,  0, 74,  0,  0,  0,  0,  0,  0,
+/* 0x1bc0 */   0, 54,  0,  0,  0, 11,  0,  0,  0, 80,  0,  0,  0,  0,  0,  0,
+/* 0x1bd0 */   0, 63,  0,  0,  0,  5,  0,  0,  0, 91,  0,  0,  0,  0,  0,  0,
+/* 0x1be0 */   0, 72,  0,  0,  0,  9,  0,  0,  0, 96,  0,  0,  0,  0,  0,  0,
+/* 0x1bf0 */   0, 81,  0,  0,  0, 13,  0,  0,  0,105,  0,  0,  0,  0,  0,  0,
+/* 0x1c00 */   0, 90,  0,  0,  0, 13,  0,  0,  0,118,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */   0, 99,  0,  0,  0, 15,  0,  0,  0,131,  0,  0,  0,  0,  0,  0,
+/* 0x1c20 */   0,108,  0,  0,  0, 62,  0,  0,  0,146,  0,  0,  0,  0,  0,  0,
+/* 0x1c30 */   0,117,  0,  0,  0, 13,  0,  0,  0,208,  0,  0,  0,  0,  0,  0,
+/* 0x1c40 */   0,126,  0,  0,  0, 15,  0,  0,  0,221,  0,  0,  0,  0,  0,  0,
+/* 0x1c50 */   0,135,  0,  0,  0,  2,  0,  0,  0,236,  0,  0,  0,  0,  0,  0,
+/* 0x1c60 */   0,144,  0,  0,  0,  3,  0,  0,  0,238,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */   0,153,  0,  0,  0,  9,  0,  0,  0,241,  0,  0,  0,  0,  0,  0,
+/* 0x1c80 */   0,162,  0,  0,  0, 12,  0,  0,  0,250,  0,  0,  0,  0,  0,  0,
+/* 0x1c90 */   0,171,  0,  0,  0, 25,  0,  0,  0,  6,  1,  0,  0,  0,  0,  0,
+/* 0x1ca0 */   0,180,  0,  0,  0, 22,  0,  0,  0, 31,  1,  0,  0,  0,  0,  0,
+/* 0x1cb0 */   0,189,  0,  0,  0,  0,  0,  0,  0, 53,  1,  0,  0,  0,  0,  0,
+/* 0x1cc0 */   0,198,  0,  0,  0,  3,  0,  0,  0, 53,  1,  0,  0,  0,  0,  0,
+/* 0x1cd0 */   0,207,  0,  0,  0,  2,  0,  0,  0, 56,  1,  0,  0,  0,  0,  0,
+/* 0x1ce0 */   0,216,  0,  0,  0,  6,  0,  0,  0, 58,  1,  0,  0,  0,  0,  0,
+/* 0x1cf0 */   0,225,  0,  0,  0, 11,  0,  0,  0, 64,  1,  0,  0,  0,  0,  0,
+/* 0x1d00 */   0,234,  0,  0,  0,  5,  0,  0,  0, 75,  1,  0,  0,  0,  0,  0,
+/* 0x1d10 */   0,243,  0,  0,  0,  9,  0,  0,  0, 80,  1,  0,  0,  0,  0,  0,
+/* 0x1d20 */   0,252,  0,  0,  0, 13,  0,  0,  0, 89,  1,  0,  0,  0,  0,  0,
+/* 0x1d30 */   0,  5,  1,  0,  0, 13,  0,  0,  0,102,  1,  0,  0,  0,  0,  0,
+/* 0x1d40 */   0, 14,  1,  0,  0, 15,  0,  0,  0,115,  1,  0,  0,  0,  0,  0,
+/* 0x1d50 */   0, 23,  1,  0,  0, 82,  0,  0,  0,130,  1,  0,  0,  0,  0,  0,
+/* 0x1d60 */   0, 32,  1,  0,  0, 13,  0,  0,  0,212,  1,  0,  0,  0,  0,  0,
+/* 0x1d70 */   0, 41,  1,  0,  0, 15,  0,  0,  0,225,  1,  0,  0,  0,  0,  0,
+/* 0x1d80 */   0, 50,  1,  0,  0,  2,  0,  0,  0,240,  1,  0,  0,  0,  0,  0,
+/* 0x1d90 */   0, 59,  1,  0,  0,  3,  0,  0,  0,242,  1,  0,  0,  0,  0,  0,
+/* 0x1da0 */   0, 68,  1,  0,  0,  9,  0,  0,  0,245,  1,  0,  0,  0,  0,  0,
+/* 0x1db0 */   0, 77,  1,  0,  0, 12,  0,  0,  0,254,  1,  0,  0,  0,  0,  0,
+/* 0x1dc0 */   0, 86,  1,  0,  0, 25,  0,  0,  0, 10,  2,  0,  0,  0,  0,  0,
+/* 0x1dd0 */   0, 95,  1,  0,  0, 22,  0,  0,  0, 35,  2,  0,  0,  0,  0,  0,
+/* 0x1de0 */   0,104,  1,  0,  0,  0,  0,  0,  0, 57,  2,  0,  0,  0,  0,  0,
+/* 0x1df0 */   0,113,  1,  0,  0,  3,  0,  0,  0, 57,  2,  0,  0,  0,  0,  0,
+/* 0x1e00 */   0,122,  1,  0,  0,  2,  0,  0,  0, 60,  2,  0,  0,  0,  0,  0,
+/* 0x1e10 */   0,131,  1,  0,  0,  6,  0,  0,  0, 62,  2,  0,  0,  0,  0,  0,
+/* 0x1e20 */   0,140,  1,  0,  0, 11,  0,  0,  0, 68,  2,  0,  0,  0,  0,  0,
+/* 0x1e30 */   0,149,  1,  0,  0,  5,  0,  0,  0, 79,  2,  0,  0,  0,  0,  0,
+/* 0x1e40 */   0,158,  1,  0,  0,  9,  0,  0,  0, 84,  2,  0,  0,  0,  0,  0,
+/* 0x1e50 */   0,167,  1,  0,  0, 13,  0,  0,  0, 93,  2,  0,  0,  0,  0,  0,
+/* 0x1e60 */   0,176,  1,  0,  0, 13,  0,  0,  0,106,  2,  0,  0,  0,  0,  0,
+/* 0x1e70 */   0,185,  1,  0,  0, 15,  0,  0,  0,119,  2,  0,  0,  0,  0,  0,
+/* 0x1e80 */   0,194,  1,  0,  0, 95,  0,  0,  0,134,  2,  0,  0,  0,  0,  0,
+/* 0x1e90 */   0,203,  1,  0,  0, 13,  0,  0,  0,229,  2,  0,  0,  0,  0,  0,
+/* 0x1ea0 */   0,212,  1,  0,  0, 15,  0,  0,  0,242,  2,  0,  0,  0,  0,  0,
+/* 0x1eb0 */   0,221,  1,  0,  0,  2,  0,  0,  0,  1,  3,  0,  0,  0,  0,  0,
+/* 0x1ec0 */   0,230,  1,  0,  0,  3,  0,  0,  0,  3,  3,  0,  0,  0,  0,  0,
+/* 0x1ed0 */   0,239,  1,  0,  0,  9,  0,  0,  0,  6,  3,  0,  0,  0,  0,  0,
+/* 0x1ee0 */   0,248,  1,  0,  0, 12,  0,  0,  0, 15,  3,  0,  0,  0,  0,  0,
+/* 0x1ef0 */   0,  1,  2,  0,  0, 25,  0,  0,  0, 27,  3,  0,  0,  0,  0,  0,
+/* 0x1f00 */   0, 10,  2,  0,  0, 22,  0,  0,  0, 52,  3,  0,  0,  0,  0,  0,
+/* 0x1f10 */   0, 19,  2,  0,  0,  0,  0,  0,  0, 74,  3,  0,  0,  0,  0,  0,
+/* 0x1f20 */   0, 28,  2,  0,  0, 46,  0,  0,  0, 74,  3,  0,  0,  0,  0,  0,
+/* 0x1f30 */   0, 39,  2,  0,  0, 72,  0,  0,  0,120,  3,  0,  0,  0,  0,  0,
+/* 0x1f40 */   0, 50,  2,  0,  0,134, 10,  0,  0,192,  3,  0,  0,  0,  0,  0,
+/* 0x1f50 */   0, 61,  2,  0,  0,134, 10,  0,  0, 70, 14,  0,  0,  0,  0,  0,
+/* 0x1f60 */   0, 72,  2,  0,  0, 26,  0,  0,  0,204, 24,  0,  0,  0,  0,  0,
+/* 0x1f70 */   0, 83,  2,  0,  0, 29,  0,  0,  0,230, 24,  0,  0,  0,  0,  0,
+/* 0x1f80 */   0, 92,  2,  0,  0,  2,  0,  0,  0,  3, 25,  0,  0,  0,  0,  0,
+/* 0x1f90 */   0,101,  2,  0,  0,  5,  0,  0,  0,  5, 25,  0,  0,  0,  0,  0,
+/* 0x1fa0 */   0,110,  2,  0,  0,  2,  0,  0,  0, 10, 25,  0,  0,  0,  0,  0,
+/* 0x1fb0 */   0,119,  2,  0,  0,  5,  0,  0,  0, 12, 25,  0,  0,  0,  0,  0,
+/* 0x1fc0 */   0,128,  2,  0,  0,  7,  0,  0,  0, 17, 25,  0,  0,  0,  0,  0,
+/* 0x1fd0 */   0,137,  2,  0,  0,  7,  0,  0,  0, 24, 25,  0,  0,  0,  0,  0,
+/* 0x1fe0 */   0,146,  2,  0,  0,  4,  0,  0,  0, 31, 25,  0,  0,  0,  0,  0,
+/* 0x1ff0 */   0,155,  2,  0,  0,  5,  0,  0,  0, 35, 25,  0,  0,  0,  0,  0,
+/* 0x2000 */   0,164,  2,  0,  0,  3,  0,  0,  0, 40, 25,  0,  0,  0,  0,  0,
+/* 0x2010 */   0,173,  2,  0,  0,  3,  0,  0,  0, 43, 25,  0,  0,  0,  0,  0,
+/* 0x2020 */   0,182,  2,  0,  0,  2,  0,  0,  0, 46, 25,  0,  0,  0,  0,  0,
+/* 0x2030 */   0,191,  2,  0,  0,  2,  0,  0,  0, 48, 25,  0,  0,  0,  0,  0,
+/* 0x2040 */   0,200,  2,  0,  0,  5,  0,  0,  0, 50, 25,  0,  0,  0,  0,  0,
+/* 0x2050 */   0,209,  2,  0,  0,  7,  0,  0,  0, 55, 25,  0,  0,  0,  0,  0,
+/* 0x2060 */   0,218,  2,  0,  0,  2,  0,  0,  0, 62, 25,  0,  0,  0,  0,  0,
+/* 0x2070 */   0,227,  2,  0,  0,  1,  0,  0,  0, 64, 25,  0,  0,  0,  0,  0,
+/* 0x2080 */   0,236,  2,  0,  0,  9,  0,  0,  0, 65, 25,  0,  0,  0,  0,  0,
+/* 0x2090 */   0,245,  2,  0,  0,  3,  0,  0,  0, 74, 25,  0,  0,  0,  0,  0,
+/* 0x20a0 */   0,254,  2,  0,  0,  4,  0,  0,  0, 77, 25,  0,  0,  0,  0,  0,
+/* 0x20b0 */   0,  7,  3,  0,  0,  2,  0,  0,  0, 81, 25,  0,  0,  0,  0,  0,
+/* 0x20c0 */   0, 16,  3,  0,  0,  5,  0,  0,  0, 83, 25,  0,  0,  0,  0,  0,
+/* 0x20d0 */   0, 25,  3,  0,  0,  2,  0,  0,  0, 88, 25,  0,  0,  0,  0,  0,
+/* 0x20e0 */   0, 34,  3,  0,  0,  1,  0,  0,  0, 90, 25,  0,  0,  0,  0,  0,
+/* 0x20f0 */   0, 43,  3,  0,  0,  2,  0,  0,  0, 91, 25,  0,  0,  0,  0,  0,
+/* 0x2100 */   0, 52,  3,  0,  0,  4,  0,  0,  0, 93, 25,  0,  0,  0,  0,  0,
+/* 0x2110 */   0, 61,  3,  0,  0,  8,  0,  0,  0, 97, 25,  0,  0,  0,  0,  0,
+/* 0x2120 */   0, 70,  3,  0,  0,  3,  0,  0,  0,105, 25,  0,  0,  0,  0,  0,
+/* 0x2130 */   0, 79,  3,  0,  0,  2,  0,  0,  0,108, 25,  0,  0,  0,  0,  0,
+/* 0x2140 */   0, 88,  3,  0,  0,  6,  0,  0,  0,110, 25,  0,  0,  0,  0,  0,
+/* 0x2150 */   0, 97,  3,  0,  0,  3,  0,  0,  0,116, 25,  0,  0,  0,  0,  0,
+/* 0x2160 */   0,106,  3,  0,  0,  2,  0,  0,  0,119, 25,  0,  0,  0,  0,  0,
+/* 0x2170 */   0,115,  3,  0,  0,  1,  0,  0,  0,121, 25,  0,  0,  0,  0,  0,
+/* 0x2180 */   0,124,  3,  0,  0,  2,  0,  0,  0,122, 25,  0,  0,  0,  0,  0,
+/* 0x2190 */   0,133,  3,  0,  0,  4,  0,  0,  0,124, 25,  0,  0,  0,  0,  0,
+/* 0x21a0 */   0,142,  3,  0,  0, 11,  0,  0,  0,128, 25,  0,  0,  0,  0,  0,
+/* 0x21b0 */   0,151,  3,  0,  0,  2,  0,  0,  0,139, 25,  0,  0,  0,  0,  0,
+/* 0x21c0 */   0,160,  3,  0,  0,  1,  0,  0,  0,141, 25,  0,  0,  0,  0,  0,
+/* 0x21d0 */   0,169,  3,  0,  0,  2,  0,  0,  0,142, 25,  0,  0,  0,  0,  0,
+/* 0x21e0 */   0,178,  3,  0,  0,  4,  0,  0,  0,144, 25,  0,  0,  0,  0,  0,
+/* 0x21f0 */   0,187,  3,  0,  0, 16,  0,  0,  0,148, 25,  0,  0,  0,  0,  0,
+/* 0x2200 */   0,196,  3,  0,  0,  5,  0,  0,  0,164, 25,  0,  0,  0,  0,  0,
+/* 0x2210 */   0,205,  3,  0,  0,  3,  0,  0,  0,169, 25,  0,  0,  0,  0,  0,
+/* 0x2220 */   0,214,  3,  0,  0,  2,  0,  0,  0,172, 25,  0,  0,  0,  0,  0,
+/* 0x2230 */   0,223,  3,  0,  0,  7,  0,  0,  0,174, 25,  0,  0,  0,  0,  0,
+/* 0x2240 */   0,232,  3,  0,  0,  0,  0,  0,  0,181, 25,  0,  0,  0,  0,  0,
+/* 0x2250 */   0,241,  3,  0,  0,  5,  0,  0,  0,181, 25,  0,  0,  0,  0,  0,
+/* 0x2260 */   0,250,  3,  0,  0,  1,  0,  0,  0,186, 25,  0,  0,  0,  0,  0,
+/* 0x2270 */   0,  3,  4,  0,  0,  2,  0,  0,  0,187, 25,  0,  0,  0,  0,  0,
+/* 0x2280 */   0, 12,  4,  0,  0,  2,  0,  0,  0,189, 25,  0,  0,  0,  0,  0,
+/* 0x2290 */   0, 21,  4,  0,  0,  6,  0,  0,  0,191, 25,  0,  0,  0,  0,  0,
+/* 0x22a0 */   0, 30,  4,  0,  0,  3,  0,  0,  0,197, 25,  0,  0,  0,  0,  0,
+/* 0x22b0 */   0, 39,  4,  0,  0,  2,  0,  0,  0,200, 25,  0,  0,  0,  0,  0,
+/* 0x22c0 */   0, 48,  4,  0,  0,  2,  0,  0,  0,202, 25,  0,  0,  0,  0,  0,
+/* 0x22d0 */   0, 57,  4,  0,  0,  1,  0,  0,  0,204, 25,  0,  0,  0,  0,  0,
+/* 0x22e0 */   0, 66,  4,  0,  0,  2,  0,  0,  0,205, 25,  0,  0,  0,  0,  0,
+/* 0x22f0 */   0, 75,  4,  0,  0,  2,  0,  0,  0,207, 25,  0,  0,  0,  0,  0,
+/* 0x2300 */   0, 84,  4,  0,  0,  1,  0,  0,  0,209, 25,  0,  0,  0,  0,  0,
+/* 0x2310 */   0, 93,  4,  0,  0,  2,  0,  0,  0,210, 25,  0,  0,  0,  0,  0,
+/* 0x2320 */   0,102,  4,  0,  0,  6,  0,  0,  0,212, 25,  0,  0,  0,  0,  0,
+/* 0x2330 */   0,111,  4,  0,  0,  8,  0,  0,  0,218, 25,  0,  0,  0,  0,  0,
+/* 0x2340 */   0,120,  4,  0,  0,  2,  0,  0,  0,226, 25,  0,  0,  0,  0,  0,
+/* 0x2350 */   0,129,  4,  0,  0,  3,  0,  0,  0,228, 25,  0,  0,  0,  0,  0,
+/* 0x2360 */   0,138,  4,  0,  0,  3,  0,  0,  0,231, 25,  0,  0,  0,  0,  0,
+/* 0x2370 */   0,147,  4,  0,  0,  2,  0,  0,  0,234, 25,  0,  0,  0,  0,  0,
+/* 0x2380 */   0,156,  4,  0,  0,  3,  0,  0,  0,236, 25,  0,  0,  0,  0,  0,
+/* 0x2390 */   0,165,  4,  0,  0,  2,  0,  0,  0,239, 25,  0,  0,  0,  0,  0,
+/* 0x23a0 */   0,174,  4,  0,  0,  2,  0,  0,  0,241, 25,  0,  0,  0,  0,  0,
+/* 0x23b0 */   0,183,  4,  0,  0,  2,  0,  0,  0,243, 25,  0,  0,  0,  0,  0,
+/* 0x23c0 */   0,192,  4,  0,  0,  2,  0,  0,  0,245, 25,  0,  0,  0,  0,  0,
+/* 0x23d0 */   0,201,  4,  0,  0,  3,  0,  0,  0,247, 25,  0,  0,  0,  0,  0,
+/* 0x23e0 */   0,210,  4,  0,  0,  5,  0,  0,  0,250, 25,  0,  0,  0,  0,  0,
+/* 0x23f0 */   0,219,  4,  0,  0,  2,  0,  0,  0,255, 25,  0,  0,  0,  0,  0,
+/* 0x2400 */   0,228,  4,  0,  0,  5,  0,  0,  0,  1, 26,  0,  0,  0,  0,  0,
+/* 0x2410 */   0,237,  4,  0,  0,  5,  0,  0,  0,  6, 26,  0,  0,  0,  0,  0,
+/* 0x2420 */   0,246,  4,  0,  0,  5,  0,  0,  0, 11, 26,  0,  0,  0,  0,  0,
+/* 0x2430 */   0,255,  4,  0,  0,  6,  0,  0,  0, 16, 26,  0,  0,  0,  0,  0,
+/* 0x2440 */   0,  8,  5,  0,  0,  1,  0,  0,  0, 22, 26,  0,  0,  0,  0,  0,
+/* 0x2450 */   0, 17,  5,  0,  0,  6,  0,  0,  0, 23, 26,  0,  0,  0,  0,  0,
+/* 0x2460 */   0, 26,  5,  0,  0,  7,  0,  0,  0, 29, 26,  0,  0,  0,  0,  0,
+/* 0x2470 */   0, 36,  5,  0,  0, 14,  0,  0,  0, 36, 26,  0,  0,  0,  0,  0,
+/* 0x2480 */   0, 46,  5,  0,  0, 32,  0,  0,  0, 50, 26,  0,  0,  0,  0,  0,
+/* 0x2490 */   0, 56,  5,  0,  0, 10,  0,  0,  0, 82, 26,  0,  0,  0,  0,  0,
+/* 0x24a0 */   0, 66,  5,  0,  0,  5,  0,  0,  0, 92, 26,  0,  0,  0,  0,  0,
+/* 0x24b0 */   0, 76,  5,  0,  0, 16,  0,  0,  0, 97, 26,  0,  0,  0,  0,  0,
+/* 0x24c0 */   0, 85,  5,  0,  0,  5,  0,  0,  0,113, 26,  0,  0,  0,  0,  0,
+/* 0x24d0 */   0, 94,  5,  0,  0,  5,  0,  0,  0,118, 26,  0,  0,  0,  0,  0,
+/* 0x24e0 */   0,103,  5,  0,  0,  4,  0,  0,  0,123, 26,  0,  0,  0,  0,  0,
+/* 0x24f0 */   0,112,  5,  0,  0,  2,  0,  0,  0,127, 26,  0,  0,  0,  0,  0,
+/* 0x2500 */   0,121,  5,  0,  0,  5,  0,  0,  0,129, 26,  0,  0,  0,  0,  0,
+/* 0x2510 */   0,130,  5,  0,  0, 16,  0,  0,  0,134, 26,  0,  0,  0,  0,  0,
+/* 0x2520 */   0,139,  5,  0,  0,  5,  0,  0,  0,150, 26,  0,  0,  0,  0,  0,
+/* 0x2530 */   0,148,  5,  0,  0,  2,  0,  0,  0,155, 26,  0,  0,  0,  0,  0,
+/* 0x2540 */   0,157,  5,  0,  0,  2,  0,  0,  0,157, 26,  0,  0,  0,  0,  0,
+/* 0x2550 */   0,166,  5,  0,  0,  4,  0,  0,  0,159, 26,  0,  0,  0,  0,  0,
+/* 0x2560 */   0,175,  5,  0,  0,  5,  0,  0,  0,163, 26,  0,  0,  0,  0,  0,
+/* 0x2570 */   0,184,  5,  0,  0,  2,  0,  0,  0,168, 26,  0,  0,  0,  0,  0,
+/* 0x2580 */   0,193,  5,  0,  0,  4,  0,  0,  0,170, 26,  0,  0,  0,  0,  0,
+/* 0x2590 */   0,202,  5,  0,  0,  2,  0,  0,  0,174, 26,  0,  0,  0,  0,  0,
+/* 0x25a0 */   0,211,  5,  0,  0,  5,  0,  0,  0,176, 26,  0,  0,  0,  0,  0,
+/* 0x25b0 */   0,220,  5,  0,  0,  7,  0,  0,  0,181, 26,  0,  0,  0,  0,  0,
+/* 0x25c0 */   0,229,  5,  0,  0,  2,  0,  0,  0,188, 26,  0,  0,  0,  0,  0,
+/* 0x25d0 */   0,238,  5,  0,  0, 75,  0,  0,  0,190, 26,  0,  0,  0,  0,  0,
+/* 0x25e0 */   0,247,  5,  0,  0,  2,  0,  0,  0,  9, 27,  0,  0,  0,  0,  0,
+/* 0x25f0 */   0,  0,  6,  0,  0,  2,  0,  0,  0, 11, 27,  0,  0,  0,  0,  0,
+/* 0x2600 */   0,  9,  6,  0,  0, 68,  0,  0,  0, 13, 27,  0,  0,  0,  0,  0,
+/* 0x2610 */   0, 27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2620 */   0, 45,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2630 */   0, 54,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2640 */   0, 81,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2650 */   0,108,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2660 */   0,153,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2670 */   0,180,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2680 */   0,189,  0,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2690 */   0,198,  0,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26a0 */   0,216,  0,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26b0 */   0,225,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26c0 */   0,252,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26d0 */   0, 23,  1,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26e0 */   0, 68,  1,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26f0 */   0, 95,  1,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2700 */   0,104,  1,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2710 */   0,113,  1,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2720 */   0,131,  1,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2730 */   0,140,  1,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2740 */   0,167,  1,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2750 */   0,194,  1,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2760 */   0,239,  1,  0,  0, 55,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2770 */   0, 10,  2,  0,  0, 58,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2780 */   0, 19,  2,  0,  0, 59,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2790 */   0,155,  2,  0,  0, 73,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27a0 */   0,164,  2,  0,  0, 74,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27b0 */   0,218,  2,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27c0 */   0, 61,  3,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27d0 */   0,187,  3,  0,  0,105,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27e0 */   0,196,  3,  0,  0,106,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27f0 */   0,232,  3,  0,  0,110,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2800 */   0, 66,  4,  0,  0,120,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2810 */   0,102,  4,  0,  0,124,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2820 */   0,201,  4,  0,  0,135,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2830 */   0,210,  4,  0,  0,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2840 */   0, 26,  5,  0,  0,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2850 */   0, 36,  5,  0,  0,145,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2860 */   0, 46,  5,  0,  0,146,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2870 */   0, 66,  5,  0,  0,148,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2880 */   0, 76,  5,  0,  0,149,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2890 */   0,139,  5,  0,  0,156,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28a0 */   0,166,  5,  0,  0,159,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28b0 */   0,220,  5,  0,  0,165,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28c0 */   0,238,  5,  0,  0,167,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28d0 */   0,  9,  6,  0,  0,170,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28f0 */   0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2900 */   0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2910 */   0, 36,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2920 */   0, 63,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2930 */   0, 72,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2940 */   0, 90,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2950 */   0, 99,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2960 */   0,117,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2970 */   0,126,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2980 */   0,135,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2990 */   0,144,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29a0 */   0,162,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29b0 */   0,171,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29c0 */   0,207,  0,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29d0 */   0,234,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29e0 */   0,243,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29f0 */   0,  5,  1,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a00 */   0, 14,  1,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a10 */   0, 32,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a20 */   0, 41,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a30 */   0, 50,  1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a40 */   0, 59,  1,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a50 */   0, 77,  1,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a60 */   0, 86,  1,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a70 */   0,122,  1,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a80 */   0,149,  1,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a90 */   0,158,  1,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2aa0 */   0,176,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ab0 */   0,185,  1,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ac0 */   0,203,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ad0 */   0,212,  1,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ae0 */   0,221,  1,  0,  0, 53,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2af0 */   0,230,  1,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b00 */   0,248,  1,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b10 */   0,  1,  2,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b20 */   0, 28,  2,  0,  0, 60,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b30 */   0, 39,  2,  0,  0, 61,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b40 */   0, 50,  2,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b50 */   0, 61,  2,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b60 */   0, 72,  2,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b70 */   0, 83,  2,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b80 */   0, 92,  2,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b90 */   0,101,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ba0 */   0,110,  2,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bb0 */   0,119,  2,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bc0 */   0,128,  2,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bd0 */   0,137,  2,  0,  0, 71,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2be0 */   0,146,  2,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bf0 */   0,173,  2,  0,  0, 75,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c00 */   0,182,  2,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c10 */   0,191,  2,  0,  0, 77,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c20 */   0,200,  2,  0,  0, 78,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c30 */   0,209,  2,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c40 */   0,227,  2,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c50 */   0,236,  2,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c60 */   0,245,  2,  0,  0, 83,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c70 */   0,254,  2,  0,  0, 84,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c80 */   0,  7,  3,  0,  0, 85,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c90 */   0, 16,  3,  0,  0, 86,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ca0 */   0, 25,  3,  0,  0, 87,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cb0 */   0, 34,  3,  0,  0, 88,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cc0 */   0, 43,  3,  0,  0, 89,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cd0 */   0, 52,  3,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ce0 */   0, 70,  3,  0,  0, 92,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cf0 */   0, 79,  3,  0,  0, 93,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d00 */   0, 88,  3,  0,  0, 94,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d10 */   0, 97,  3,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d20 */   0,106,  3,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d30 */   0,115,  3,  0,  0, 97,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d40 */   0,124,  3,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d50 */   0,133,  3,  0,  0, 99,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d60 */   0,142,  3,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d70 */   0,151,  3,  0,  0,101,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d80 */   0,160,  3,  0,  0,102,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d90 */   0,169,  3,  0,  0,103,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2da0 */   0,178,  3,  0,  0,104,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2db0 */   0,205,  3,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2dc0 */   0,214,  3,  0,  0,108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2dd0 */   0,223,  3,  0,  0,109,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2de0 */   0,241,  3,  0,  0,111,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2df0 */   0,250,  3,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e00 */   0,  3,  4,  0,  0,113,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e10 */   0, 12,  4,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e20 */   0, 21,  4,  0,  0,115,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e30 */   0, 30,  4,  0,  0,116,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e40 */   0, 39,  4,  0,  0,117,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e50 */   0, 48,  4,  0,  0,118,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e60 */   0, 57,  4,  0,  0,119,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e70 */   0, 75,  4,  0,  0,121,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e80 */   0, 84,  4,  0,  0,122,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e90 */   0, 93,  4,  0,  0,123,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ea0 */   0,111,  4,  0,  0,125,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2eb0 */   0,120,  4,  0,  0,126,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ec0 */   0,129,  4,  0,  0,127,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ed0 */   0,138,  4,  0,  0,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ee0 */   0,147,  4,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ef0 */   0,156,  4,  0,  0,130,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f00 */   0,165,  4,  0,  0,131,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f10 */   0,174,  4,  0,  0,132,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f20 */   0,183,  4,  0,  0,133,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f30 */   0,192,  4,  0,  0,134,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f40 */   0,219,  4,  0,  0,137,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f50 */   0,228,  4,  0,  0,138,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f60 */   0,237,  4,  0,  0,139,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f70 */   0,246,  4,  0,  0,140,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f80 */   0,255,  4,  0,  0,141,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f90 */   0,  8,  5,  0,  0,142,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fa0 */   0, 17,  5,  0,  0,143,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fb0 */   0, 56,  5,  0,  0,147,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fc0 */   0, 85,  5,  0,  0,150,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fd0 */   0, 94,  5,  0,  0,151,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fe0 */   0,103,  5,  0,  0,152,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ff0 */   0,112,  5,  0,  0,153,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3000 */   0,121,  5,  0,  0,154,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3010 */   0,130,  5,  0,  0,155,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3020 */   0,148,  5,  0,  0,157,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3030 */   0,157,  5,  0,  0,158,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3040 */   0,175,  5,  0,  0,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3050 */   0,184,  5,  0,  0,161,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3060 */   0,193,  5,  0,  0,162,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3070 */   0,202,  5,  0,  0,163,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3080 */   0,211,  5,  0,  0,164,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3090 */   0,229,  5,  0,  0,166,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30a0 */   0,247,  5,  0,  0,168,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30b0 */   0,  0,  6,  0,  0,169,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30c0 */   0, 18,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30d0 */   0, 25,  6,  0,  0,172,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x30e0 */   0, 43,  6,  0,  0,172,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x30f0 */   0, 54,  6,  0,  0,172,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x3100 */   0, 65,  6,  0,  0,172,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x3110 */   0, 81,  6,  0,  0,172,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x3120 */   0, 86,  6,  0,  0,172,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x3130 */   0,100,  6,  0,  0,172,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x3140 */   0,111,  6,  0,  0,172,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x3150 */   0,  0,  0,  0,  0,  1,  0,  0,  0,119,  6,  0,  0, 44,  0,  0,
+/* 0x3160 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  1,  0,  0,
+/* 0x3170 */   0,130,  6,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3180 */   0,  4,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,  0,  2,  0,  0,
+/* 0x3190 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  1,  0,  0,
+/* 0x31a0 */   0,130,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31b0 */   0,  8,  0,  0,  0,  3,  0,  0,  0,130,  6,  0,  0,  1,  0,  0,
+/* 0x31c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 12,  0,  0,
+/* 0x31d0 */   0,130,  6,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31e0 */   0, 11,  0,  0,  0,  3,  0,  0,  0,130,  6,  0,  0,  3,  0,  0,
+/* 0x31f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 14,  0,  0,
+/* 0x3200 */   0,130,  6,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3210 */   0, 12,  0,  0,  0, 17,  0,  0,  0,130,  6,  0,  0,  7,  0,  0,
+/* 0x3220 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 47,  0,  0,
+/* 0x3230 */   0,130,  6,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3240 */   0, 13,  0,  0,  0, 12,  0,  0,  0,130,  6,  0,  0,  4,  0,  0,
+/* 0x3250 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  3,  0,  0,
+/* 0x3260 */   0,130,  6,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3270 */   0, 14,  0,  0,  0, 14,  0,  0,  0,130,  6,  0,  0,  4,  0,  0,
+/* 0x3280 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  8,  0,  0,
+/* 0x3290 */   0,119,  6,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32a0 */   0, 19,  0,  0,  0, 10,  0,  0,  0,130,  6,  0,  0,  6,  0,  0,
+/* 0x32b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0, 21,  0,  0,
+/* 0x32c0 */   0,119,  6,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32d0 */   0, 20,  0,  0,  0, 18,  0,  0,  0,119,  6,  0,  0,  2,  0,  0,
+/* 0x32e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 22,  0,  0,  0,  1,  0,  0,
+/* 0x32f0 */   0,130,  6,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3300 */   0, 23,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,  0, 10,  0,  0,
+/* 0x3310 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  1,  0,  0,
+/* 0x3320 */   0,130,  6,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3330 */   0, 27,  0,  0,  0,  3,  0,  0,  0,130,  6,  0,  0,  9,  0,  0,
+/* 0x3340 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0, 12,  0,  0,
+/* 0x3350 */   0,130,  6,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3360 */   0, 30,  0,  0,  0,  5,  0,  0,  0,130,  6,  0,  0, 12,  0,  0,
+/* 0x3370 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0, 14,  0,  0,
+/* 0x3380 */   0,130,  6,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3390 */   0, 31,  0,  0,  0, 15,  0,  0,  0,130,  6,  0,  0, 11,  0,  0,
+/* 0x33a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0, 33,  0,  0,
+/* 0x33b0 */   0,130,  6,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33c0 */   0, 31,  0,  0,  0, 67,  0,  0,  0,130,  6,  0,  0, 13,  0,  0,
+/* 0x33d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0, 12,  0,  0,
+/* 0x33e0 */   0,130,  6,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33f0 */   0, 33,  0,  0,  0,  3,  0,  0,  0,130,  6,  0,  0, 12,  0,  0,
+/* 0x3400 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0, 14,  0,  0,
+/* 0x3410 */   0,130,  6,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3420 */   0, 37,  0,  0,  0,  8,  0,  0,  0,119,  6,  0,  0, 10,  0,  0,
+/* 0x3430 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0, 10,  0,  0,
+/* 0x3440 */   0,130,  6,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3450 */   0, 38,  0,  0,  0, 21,  0,  0,  0,119,  6,  0,  0, 10,  0,  0,
+/* 0x3460 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0, 18,  0,  0,
+/* 0x3470 */   0,119,  6,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3480 */   0, 41,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,  0, 18,  0,  0,
+/* 0x3490 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,  1,  0,  0,
+/* 0x34a0 */   0,130,  6,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34b0 */   0, 45,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,  0, 16,  0,  0,
+/* 0x34c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  3,  0,  0,
+/* 0x34d0 */   0,130,  6,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34e0 */   0, 48,  0,  0,  0, 12,  0,  0,  0,130,  6,  0,  0, 20,  0,  0,
+/* 0x34f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  5,  0,  0,
+/* 0x3500 */   0,130,  6,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3510 */   0, 49,  0,  0,  0, 14,  0,  0,  0,130,  6,  0,  0, 20,  0,  0,
+/* 0x3520 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0, 15,  0,  0,
+/* 0x3530 */   0,130,  6,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3540 */   0, 50,  0,  0,  0, 30,  0,  0,  0,130,  6,  0,  0, 21,  0,  0,
+/* 0x3550 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0, 48,  0,  0,
+/* 0x3560 */   0,130,  6,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3570 */   0, 51,  0,  0,  0, 12,  0,  0,  0,130,  6,  0,  0, 20,  0,  0,
+/* 0x3580 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  3,  0,  0,
+/* 0x3590 */   0,130,  6,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35a0 */   0, 52,  0,  0,  0, 14,  0,  0,  0,130,  6,  0,  0, 20,  0,  0,
+/* 0x35b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,  8,  0,  0,
+/* 0x35c0 */   0,119,  6,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35d0 */   0, 57,  0,  0,  0, 10,  0,  0,  0,130,  6,  0,  0, 22,  0,  0,
+/* 0x35e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0, 21,  0,  0,
+/* 0x35f0 */   0,119,  6,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3600 */   0, 58,  0,  0,  0, 18,  0,  0,  0,119,  6,  0,  0, 18,  0,  0,
+/* 0x3610 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,  5,  0,  0,
+/* 0x3620 */   0,140,  6,  0,  0,172,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3630 */   0, 60,  0,  0,  0, 20,  0,  0,  0,140,  6,  0,  0,173,  0,  0,
+/* 0x3640 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0, 30,  0,  0,
+/* 0x3650 */   0,140,  6,  0,  0,174,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3660 */   0, 60,  0,  0,  0, 42,  0,  0,  0,140,  6,  0,  0,175,  0,  0,
+/* 0x3670 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0,  1,  0,  0,
+/* 0x3680 */   0,130,  6,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3690 */   0, 69,  0,  0,  0,  1,  0,  0,  0,140,  6,  0,  0,176,  0,  0,
+/* 0x36a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 73,  0,  0,  0,  1,  0,  0,
+/* 0x36b0 */   0,119,  6,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36c0 */   0, 77,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,  0, 34,  0,  0,
+/* 0x36d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,  4,  0,  0,
+/* 0x36e0 */   0,130,  6,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36f0 */   0, 83,  0,  0,  0,  2,  0,  0,  0,130,  6,  0,  0, 29,  0,  0,
+/* 0x3700 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 85,  0,  0,  0,  1,  0,  0,
+/* 0x3710 */   0,130,  6,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3720 */   0, 86,  0,  0,  0,  4,  0,  0,  0,130,  6,  0,  0, 27,  0,  0,
+/* 0x3730 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,  4,  0,  0,
+/* 0x3740 */   0,130,  6,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3750 */   0,100,  0,  0,  0,  6,  0,  0,  0,130,  6,  0,  0, 28,  0,  0,
+/* 0x3760 */   0,  0,  0,  0,  0,  0,  0,  0,  0,109,  0,  0,  0,  6,  0,  0,
+/* 0x3770 */   0,130,  6,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3780 */   0,111,  0,  0,  0,  1,  0,  0,  0,119,  6,  0,  0, 30,  0,  0,
+/* 0x3790 */   0,  0,  0,  0,  0,  0,  0,  0,  0,123,  0,  0,  0,  1,  0,  0,
+/* 0x37a0 */   0,130,  6,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x37b0 */   0,125,  0,  0,  0,  7,  0,  0,  0,130,  6,  0,  0, 25,  0,  0,
+/* 0x37c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,129,  0,  0,  0,  1,  0,  0,
+/* 0x37d0 */   0,130,  6,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x37e0 */   0,131,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,  0, 26,  0,  0,
+/* 0x37f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,132,  0,  0,  0,  1,  0,  0,
+/* 0x3800 */   0,130,  6,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3810 */   0,133,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,  0, 33,  0,  0,
+/* 0x3820 */   0,  0,  0,  0,  0,  0,  0,  0,  0,134,  0,  0,  0,  1,  0,  0,
+/* 0x3830 */   0,130,  6,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3840 */   0,135,  0,  0,  0,  2,  0,  0,  0,130,  6,  0,  0, 26,  0,  0,
+/* 0x3850 */   0,  0,  0,  0,  0,  0,  0,  0,  0,136,  0,  0,  0,  4,  0,  0,
+/* 0x3860 */   0,130,  6,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3870 */   0,144,  0,  0,  0,  3,  0,  0,  0,130,  6,  0,  0, 37,  0,  0,
+/* 0x3880 */   0,  0,  0,  0,  0,  0,  0,  0,  0,145,  0,  0,  0, 13,  0,  0,
+/* 0x3890 */   0,130,  6,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x38a0 */   0,146,  0,  0,  0,  5,  0,  0,  0,130,  6,  0,  0, 38,  0,  0,
+/* 0x38b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,146,  0,  0,  0, 10,  0,  0,
+/* 0x38c0 */   0,130,  6,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x38d0 */   0,146,  0,  0,  0, 16,  0,  0,  0,130,  6,  0,  0, 38,  0,  0,
+/* 0x38e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,147,  0,  0,  0,  4,  0,  0,
+/* 0x38f0 */   0,130,  6,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3900 */   0,147,  0,  0,  0,  9,  0,  0,  0,130,  6,  0,  0, 36,  0,  0,
+/* 0x3910 */   0,  0,  0,  0,  0,  0,  0,  0,  0,148,  0,  0,  0,  4,  0,  0,
+/* 0x3920 */   0,130,  6,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3930 */   0,149,  0,  0,  0,  1,  0,  0,  0,140,  6,  0,  0,177,  0,  0,
+/* 0x3940 */   0,  0,  0,  0,  0,  0,  0,  0,  0,150,  0,  0,  0,  2,  0,  0,
+/* 0x3950 */   0,149,  6,  0,  0,178,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3960 */   0,150,  0,  0,  0,  4,  0,  0,  0,130,  6,  0,  0, 39,  0,  0,
+/* 0x3970 */   0,  0,  0,  0,  0,  0,  0,  0,  0,155,  0,  0,  0, 15,  0,  0,
+/* 0x3980 */   0,130,  6,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3990 */   0,156,  0,  0,  0,  1,  0,  0,  0,140,  6,  0,  0,177,  0,  0,
+/* 0x39a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,159,  0,  0,  0,  3,  0,  0,
+/* 0x39b0 */   0,130,  6,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x39c0 */   0,160,  0,  0,  0,  2,  0,  0,  0,149,  6,  0,  0,178,  0,  0,
+/* 0x39d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,160,  0,  0,  0,  4,  0,  0,
+/* 0x39e0 */   0,130,  6,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x39f0 */   0,165,  0,  0,  0,  6,  0,  0,  0,130,  6,  0,  0, 40,  0,  0,
+/* 0x3a00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,170,  0,  0,  0, 60,  0,  0,
+/* 0x3a10 */   0,119,  6,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a20 */   0,170,  0,  0,  0, 64,  0,  0,  0,140,  6,  0,  0,179,  0,  0,
+/* 0x3a30 */   0,  0,  0,  0,  0,  0,  0,  0,  0,170,  0,  0,  0, 29,  0,  0,
+/* 0x3a40 */   0,119,  6,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a50 */   0, 76, 69, 88, 69, 67, 48, 48, 48,  0, 76, 69, 88, 69, 67, 48,
+/* 0x3a60 */  48, 57,  0, 76, 69, 88, 69, 67, 48, 49, 48,  0, 78, 50, 66, 83,
+/* 0x3a70 */  77, 65, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49, 48,  0, 78, 50,
+/* 0x3a80 */  66, 70, 65, 83, 49, 49,  0, 78, 50, 66, 68, 69, 67, 49, 48,  0,
+/* 0x3a90 */  78, 50, 66, 83, 77, 65, 50, 48,  0, 78, 50, 66, 70, 65, 83, 50,
+/* 0x3aa0 */  48,  0, 78, 50, 66, 68, 69, 67, 50, 48,  0, 78, 50, 66, 83, 77,
+/* 0x3ab0 */  65, 51, 48,  0, 78, 50, 66, 70, 65, 83, 51, 48,  0, 78, 50, 66,
+/* 0x3ac0 */  68, 69, 67, 51, 48,  0, 78, 50, 66, 83, 77, 65, 52, 48,  0, 78,
+/* 0x3ad0 */  50, 66, 70, 65, 83, 52, 48,  0, 78, 50, 66, 83, 77, 65, 53, 48,
+/* 0x3ae0 */   0, 78, 50, 66, 70, 65, 83, 53, 48,  0, 78, 50, 66, 68, 69, 67,
+/* 0x3af0 */  53, 48,  0, 78, 50, 66, 83, 77, 65, 54, 48,  0, 78, 50, 66, 70,
+/* 0x3b00 */  65, 83, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 49,  0, 78, 50,
+/* 0x3b10 */  66, 68, 69, 67, 54, 48,  0, 78, 50, 68, 83, 77, 65, 49, 48,  0,
+/* 0x3b20 */  78, 50, 68, 70, 65, 83, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49,
+/* 0x3b30 */  49,  0, 78, 50, 68, 68, 69, 67, 49, 48,  0, 78, 50, 68, 83, 77,
+/* 0x3b40 */  65, 50, 48,  0, 78, 50, 68, 70, 65, 83, 50, 48,  0, 78, 50, 68,
+/* 0x3b50 */  68, 69, 67, 50, 48,  0, 78, 50, 68, 83, 77, 65, 51, 48,  0, 78,
+/* 0x3b60 */  50, 68, 70, 65, 83, 51, 48,  0, 78, 50, 68, 68, 69, 67, 51, 48,
+/* 0x3b70 */   0, 78, 50, 68, 83, 77, 65, 52, 48,  0, 78, 50, 68, 70, 65, 83,
+/* 0x3b80 */  52, 48,  0, 78, 50, 68, 83, 77, 65, 53, 48,  0, 78, 50, 68, 70,
+/* 0x3b90 */  65, 83, 53, 48,  0, 78, 50, 68, 68, 69, 67, 53, 48,  0, 78, 50,
+/* 0x3ba0 */  68, 83, 77, 65, 54, 48,  0, 78, 50, 68, 70, 65, 83, 54, 48,  0,
+/* 0x3bb0 */  78, 50, 68, 70, 65, 83, 54, 49,  0, 78, 50, 68, 68, 69, 67, 54,
+/* 0x3bc0 */  48,  0, 78, 50, 69, 83, 77, 65, 49, 48,  0, 78, 50, 69, 70, 65,
+/* 0x3bd0 */  83, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 49,  0, 78, 50, 69,
+/* 0x3be0 */  68, 69, 67, 49, 48,  0, 78, 50, 69, 83, 77, 65, 50, 48,  0, 78,
+/* 0x3bf0 */  50, 69, 70, 65, 83, 50, 48,  0, 78, 50, 69, 68, 69, 67, 50, 48,
+/* 0x3c00 */   0, 78, 50, 69, 83, 77, 65, 51, 48,  0, 78, 50, 69, 70, 65, 83,
+/* 0x3c10 */  51, 48,  0, 78, 50, 69, 68, 69, 67, 51, 48,  0, 78, 50, 69, 83,
+/* 0x3c20 */  77, 65, 52, 48,  0, 78, 50, 69, 70, 65, 83, 52, 48,  0, 78, 50,
+/* 0x3c30 */  69, 83, 77, 65, 53, 48,  0, 78, 50, 69, 70, 65, 83, 53, 48,  0,
+/* 0x3c40 */  78, 50, 69, 68, 69, 67, 53, 48,  0, 78, 50, 69, 83, 77, 65, 54,
+/* 0x3c50 */  48,  0, 78, 50, 69, 70, 65, 83, 54, 48,  0, 78, 50, 69, 70, 65,
+/* 0x3c60 */  83, 54, 49,  0, 78, 50, 69, 68, 69, 67, 54, 48,  0, 76, 90, 77,
+/* 0x3c70 */  65, 95, 68, 69, 67, 48, 48,  0, 76, 90, 77, 65, 95, 69, 76, 70,
+/* 0x3c80 */  48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90,
+/* 0x3c90 */  77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x3ca0 */  67, 51, 48,  0, 76, 69, 88, 69, 67, 48, 49, 53,  0, 76, 88, 85,
+/* 0x3cb0 */  78, 70, 48, 48, 48,  0, 76, 88, 85, 78, 70, 48, 48, 50,  0, 77,
+/* 0x3cc0 */  82, 85, 66, 89, 84, 69, 48,  0, 76, 88, 77, 82, 85, 48, 48, 53,
+/* 0x3cd0 */   0, 76, 88, 77, 82, 85, 48, 48, 54,  0, 76, 88, 77, 82, 85, 48,
+/* 0x3ce0 */  48, 55,  0, 76, 88, 85, 78, 70, 48, 48, 56,  0, 76, 88, 85, 78,
+/* 0x3cf0 */  70, 48, 49, 48,  0, 76, 88, 74, 67, 67, 48, 49, 48,  0, 76, 88,
+/* 0x3d00 */  77, 82, 85, 48, 52, 53,  0, 76, 88, 77, 82, 85, 48, 52, 54,  0,
+/* 0x3d10 */  76, 88, 74, 67, 67, 48, 50, 48,  0, 76, 88, 74, 67, 67, 48, 50,
+/* 0x3d20 */  49,  0, 76, 88, 74, 67, 67, 48, 50, 51,  0, 76, 88, 85, 78, 70,
+/* 0x3d30 */  48, 51, 55,  0, 76, 88, 85, 78, 70, 51, 56, 54,  0, 76, 88, 85,
+/* 0x3d40 */  78, 70, 51, 56, 55,  0, 76, 88, 85, 78, 70, 51, 56, 56,  0, 76,
+/* 0x3d50 */  88, 85, 78, 70, 52, 56, 54,  0, 76, 88, 85, 78, 70, 52, 56, 55,
+/* 0x3d60 */   0, 76, 88, 77, 82, 85, 48, 54, 53,  0, 77, 82, 85, 66, 89, 84,
+/* 0x3d70 */  69, 51,  0, 77, 82, 85, 65, 82, 66, 51, 48,  0, 77, 82, 85, 66,
+/* 0x3d80 */  73, 84, 83, 51,  0, 77, 82, 85, 65, 82, 66, 52, 48,  0, 76, 88,
+/* 0x3d90 */  77, 82, 85, 48, 55, 48,  0, 77, 82, 85, 66, 89, 84, 69, 52,  0,
+/* 0x3da0 */  77, 82, 85, 66, 73, 84, 83, 52,  0, 77, 82, 85, 65, 82, 66, 53,
+/* 0x3db0 */  48,  0, 76, 88, 77, 82, 85, 48, 56, 48,  0, 77, 82, 85, 66, 89,
+/* 0x3dc0 */  84, 69, 53,  0, 77, 82, 85, 65, 82, 66, 54, 48,  0, 77, 82, 85,
+/* 0x3dd0 */  66, 73, 84, 83, 53,  0, 77, 82, 85, 65, 82, 66, 55, 48,  0, 76,
+/* 0x3de0 */  88, 77, 82, 85, 48, 57, 48,  0, 77, 82, 85, 66, 89, 84, 69, 54,
+/* 0x3df0 */   0, 77, 82, 85, 65, 82, 66, 56, 48,  0, 77, 82, 85, 66, 73, 84,
+/* 0x3e00 */  83, 54,  0, 77, 82, 85, 65, 82, 66, 57, 48,  0, 76, 88, 77, 82,
+/* 0x3e10 */  85, 49, 48, 48,  0, 76, 88, 85, 78, 70, 48, 52, 48,  0, 76, 88,
+/* 0x3e20 */  77, 82, 85, 49, 49, 48,  0, 76, 88, 77, 82, 85, 49, 49, 49,  0,
+/* 0x3e30 */  76, 88, 85, 78, 70, 48, 52, 49,  0, 76, 88, 85, 78, 70, 48, 52,
+/* 0x3e40 */  50,  0, 76, 69, 88, 69, 67, 48, 49, 54,  0, 76, 88, 77, 82, 85,
+/* 0x3e50 */  48, 49, 48,  0, 76, 88, 74, 77, 80, 65, 48, 48,  0, 76, 88, 67,
+/* 0x3e60 */  65, 76, 76, 66, 48,  0, 76, 88, 85, 78, 70, 48, 50, 49,  0, 76,
+/* 0x3e70 */  88, 77, 82, 85, 48, 50, 50,  0, 76, 88, 74, 77, 80, 65, 48, 49,
+/* 0x3e80 */   0, 76, 88, 67, 65, 76, 76, 66, 49,  0, 77, 82, 85, 66, 73, 84,
+/* 0x3e90 */  83, 49,  0, 76, 88, 77, 82, 85, 48, 51, 48,  0, 77, 82, 85, 66,
+/* 0x3ea0 */  89, 84, 69, 49,  0, 77, 82, 85, 65, 82, 66, 49, 48,  0, 76, 88,
+/* 0x3eb0 */  77, 82, 85, 48, 52, 48,  0, 76, 88, 85, 78, 70, 48, 51, 48,  0,
+/* 0x3ec0 */  76, 88, 74, 67, 67, 48, 48, 48,  0, 76, 88, 67, 74, 48, 77, 82,
+/* 0x3ed0 */  85,  0, 76, 88, 67, 74, 49, 77, 82, 85,  0, 76, 88, 67, 65, 76,
+/* 0x3ee0 */  74, 77, 80,  0, 76, 88, 67, 65, 76, 76, 48, 48,  0, 76, 88, 67,
+/* 0x3ef0 */  65, 76, 76, 48, 49,  0, 76, 88, 67, 74, 50, 77, 82, 85,  0, 76,
+/* 0x3f00 */  88, 67, 74, 52, 77, 82, 85,  0, 76, 88, 67, 74, 54, 77, 82, 85,
+/* 0x3f10 */   0, 76, 88, 67, 74, 55, 77, 82, 85,  0, 76, 88, 67, 74, 56, 77,
+/* 0x3f20 */  82, 85,  0, 76, 88, 85, 78, 70, 48, 51, 52,  0, 76, 88, 77, 82,
+/* 0x3f30 */  85, 48, 53, 53,  0, 77, 82, 85, 66, 89, 84, 69, 50,  0, 77, 82,
+/* 0x3f40 */  85, 66, 73, 84, 83, 50,  0, 77, 82, 85, 65, 82, 66, 50, 48,  0,
+/* 0x3f50 */  76, 88, 77, 82, 85, 48, 53, 55,  0, 76, 88, 77, 82, 85, 48, 53,
+/* 0x3f60 */  56,  0, 76, 88, 85, 78, 70, 48, 51, 53,  0, 99,116,111,107, 51,
+/* 0x3f70 */  50, 46, 48, 48,  0, 99,116,111,107, 51, 50, 46, 49, 48,  0, 99,
+/* 0x3f80 */ 116,111,107, 51, 50, 46, 50, 48,  0, 99,116,111,107, 51, 50, 46,
+/* 0x3f90 */  51, 48,  0, 99,116,111,107, 51, 50, 46, 52, 48,  0, 67, 65, 76,
+/* 0x3fa0 */  76, 84, 82, 48, 48,  0, 67, 84, 67, 76, 69, 86, 69, 49,  0, 67,
+/* 0x3fb0 */  65, 76, 76, 84, 82, 48, 49,  0, 67, 84, 66, 83, 72, 82, 48, 49,
+/* 0x3fc0 */   0, 67, 84, 66, 82, 79, 82, 48, 49,  0, 67, 84, 66, 83, 87, 65,
+/* 0x3fd0 */  48, 49,  0, 67, 65, 76, 76, 84, 82, 48, 50,  0, 67, 65, 76, 76,
+/* 0x3fe0 */  84, 82, 49, 48,  0, 67, 65, 76, 76, 84, 82, 69, 56,  0, 67, 65,
+/* 0x3ff0 */  76, 76, 84, 82, 69, 57,  0, 67, 65, 76, 76, 84, 82, 49, 49,  0,
+/* 0x4000 */  67, 84, 67, 76, 69, 86, 69, 50,  0, 67, 65, 76, 76, 84, 82, 49,
+/* 0x4010 */  50,  0, 67, 84, 66, 83, 72, 82, 49, 49,  0, 67, 84, 66, 82, 79,
+/* 0x4020 */  82, 49, 49,  0, 67, 84, 66, 83, 87, 65, 49, 49,  0, 67, 65, 76,
+/* 0x4030 */  76, 84, 82, 49, 51,  0, 76, 69, 88, 69, 67, 48, 49, 55,  0, 76,
+/* 0x4040 */  69, 88, 69, 67, 48, 50, 48,  0, 76, 85, 78, 77, 80, 48, 48, 48,
+/* 0x4050 */   0, 76, 85, 78, 77, 80, 48, 48, 49,  0, 76, 69, 88, 69, 67, 48,
+/* 0x4060 */  50, 53,  0, 95,115,116, 97,114,116,  0,108,122,109, 97, 95,115,
+/* 0x4070 */ 116, 97, 99,107, 95, 97,100,106,117,115,116,  0,108,122,109, 97,
+/* 0x4080 */  95,117, 95,108,101,110,  0,108,122,109, 97, 95, 99, 95,108,101,
+/* 0x4090 */ 110,  0,108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,
+/* 0x40a0 */ 115,  0, 78, 77, 82, 85,  0,102,105,108,116,101,114, 95,108,101,
+/* 0x40b0 */ 110,103,116,104,  0,102,105,108,116,101,114, 95, 99,116,111,  0,
+/* 0x40c0 */  79, 95, 66, 73, 78, 70, 79,  0, 82, 95, 51, 56, 54, 95, 80, 67,
+/* 0x40d0 */  51, 50,  0, 82, 95, 51, 56, 54, 95, 80, 67, 56,  0, 82, 95, 51,
+/* 0x40e0 */  56, 54, 95, 51, 50,  0, 82, 95, 51, 56, 54, 95, 56,  0, 81, 27,
+/* 0x40f0 */   0,  0, 85, 80, 88, 35, 79, 66, 74, 49
 };
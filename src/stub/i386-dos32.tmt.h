@@ -1,5 +1,5 @@
 /* i386-dos32.tmt.h
-   created from i386-dos32.tmt.bin, 27077 (0x69c5) bytes
+   created from i386-dos32.tmt.bin, 13034 (0x32ea) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_DOS32_TMT_SIZE    27077
-#define STUB_I386_DOS32_TMT_ADLER32 0x692aaf56
-#define STUB_I386_DOS32_TMT_CRC32   0xf741d739
+#define STUB_I386_DOS32_TMT_SIZE    13034
+#define STUB_I386_DOS32_TMT_ADLER32 0x03b6b4b9
+#define STUB_I386_DOS32_TMT_CRC32   0x38526282
 
-unsigned char stub_i386_dos32_tmt[27077] = {
+unsigned char stub_i386_dos32_tmt[13034] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 136, 30,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -452,1281 +452,403 @@ unsigned char stub_i386_dos32_tmt[27077] = {
 /* 0x19d0 */  60,239,119, 17,  1,199,139,  7,134,196,193,192, 16,134,196,  1,
 /* 0x19e0 */ 232,137,  7,235,226, 36, 15,193,224, 16,102,139,  6,131,198,  2,
 /* 0x19f0 */   9,192,117, 12,139,  6,131,198,  4,235, 12,233,252,255,255,255,
-/* 0x1a00 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51,
-/* 0x1a10 */  50, 45,105, 51, 56, 54, 10, 10, 83,101, 99,116,105,111,110,115,
-/* 0x1a20 */  58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32,
-/* 0x1a30 */  32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77,
-/* 0x1a40 */  65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32,
-/* 0x1a50 */  32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110,
-/* 0x1a60 */  32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 84, 77, 84, 77,
-/* 0x1a70 */  65, 73, 78, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1a80 */  49, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1a90 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52,
-/* 0x1aa0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1ab0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1ac0 */  89, 10, 32, 32, 49, 32, 84, 77, 84, 77, 65, 73, 78, 49, 65, 32,
-/* 0x1ad0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48,
-/* 0x1ae0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1af0 */  32, 32, 48, 48, 48, 48, 48, 48, 52, 54, 32, 32, 50, 42, 42, 48,
-/* 0x1b00 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x1b10 */  79, 78, 76, 89, 10, 32, 32, 50, 32, 84, 77, 84, 77, 65, 73, 78,
-/* 0x1b20 */  49, 66, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32,
-/* 0x1b30 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1b40 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32, 32, 50,
-/* 0x1b50 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x1b60 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1b70 */  32, 51, 32, 84, 77, 84, 67, 65, 76, 84, 49, 32, 32, 32, 32, 32,
-/* 0x1b80 */  32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1b90 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1ba0 */  48, 48, 48, 48, 48, 53, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1bb0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1bc0 */  89, 10, 32, 32, 52, 32, 84, 77, 84, 77, 65, 73, 78, 50, 32, 32,
-/* 0x1bd0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48,
-/* 0x1be0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bf0 */  32, 32, 48, 48, 48, 48, 48, 48, 53, 55, 32, 32, 50, 42, 42, 48,
-/* 0x1c00 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x1c10 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32,
-/* 0x1c20 */  85, 80, 88, 49, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1c30 */  48, 48, 48, 48, 50, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c40 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1c50 */  48, 48, 53, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1c60 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x1c70 */  32, 54, 32, 84, 77, 84, 67, 85, 84, 80, 79, 32, 32, 32, 32, 32,
-/* 0x1c80 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1c90 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1ca0 */  48, 48, 48, 48, 48, 55, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1cb0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1cc0 */  89, 10, 32, 32, 55, 32, 78, 50, 66, 83, 77, 65, 49, 48, 32, 32,
-/* 0x1cd0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48,
-/* 0x1ce0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cf0 */  32, 32, 48, 48, 48, 48, 48, 48, 55, 99, 32, 32, 50, 42, 42, 48,
-/* 0x1d00 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x1d10 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32,
-/* 0x1d20 */  78, 50, 66, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1d30 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d40 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1d50 */  48, 48, 55,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1d60 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x1d70 */  68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 78, 50, 66, 70, 65, 83,
-/* 0x1d80 */  49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54,
-/* 0x1d90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1da0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 56, 49, 32, 32,
-/* 0x1db0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1dc0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48, 32, 78, 50, 66,
-/* 0x1dd0 */  68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1de0 */  48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1df0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 56,
-/* 0x1e00 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1e10 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32,
-/* 0x1e20 */  78, 50, 66, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1e30 */  48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e40 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1e50 */  48, 48, 57, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1e60 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x1e70 */  68, 79, 78, 76, 89, 10, 32, 49, 50, 32, 78, 50, 66, 70, 65, 83,
-/* 0x1e80 */  50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57,
-/* 0x1e90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1ea0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 57, 55, 32, 32,
-/* 0x1eb0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1ec0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1ed0 */  32, 49, 51, 32, 78, 50, 66, 68, 69, 67, 50, 48, 32, 32, 32, 32,
-/* 0x1ee0 */  32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48,
-/* 0x1ef0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1f00 */  48, 48, 48, 48, 48, 48, 97, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1f10 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1f20 */  76, 89, 10, 32, 49, 52, 32, 78, 50, 66, 83, 77, 65, 51, 48, 32,
-/* 0x1f30 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48,
-/* 0x1f40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f50 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 97,100, 32, 32, 50, 42, 42,
-/* 0x1f60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1f70 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 53,
-/* 0x1f80 */  32, 78, 50, 66, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1f90 */  48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fa0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1fb0 */  48, 48, 48, 98, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1fc0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1fd0 */  65, 68, 79, 78, 76, 89, 10, 32, 49, 54, 32, 78, 50, 66, 68, 69,
-/* 0x1fe0 */  67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 51,
-/* 0x1ff0 */ 101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2000 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 99, 57, 32,
-/* 0x2010 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2020 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2030 */  10, 32, 49, 55, 32, 78, 50, 66, 83, 77, 65, 52, 48, 32, 32, 32,
-/* 0x2040 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48,
-/* 0x2050 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2060 */  32, 48, 48, 48, 48, 48, 49, 48, 55, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2070 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x2080 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 56, 32, 78,
-/* 0x2090 */  50, 66, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x20a0 */  48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x20b0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x20c0 */  49, 49, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x20d0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x20e0 */  79, 78, 76, 89, 10, 32, 49, 57, 32, 78, 50, 66, 83, 77, 65, 53,
-/* 0x20f0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x2100 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2110 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 50, 51, 32, 32, 50,
-/* 0x2120 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2130 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 48, 32, 78, 50, 66, 70,
-/* 0x2140 */  65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2150 */  48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2160 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 50, 53,
-/* 0x2170 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2180 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 49, 32, 78,
-/* 0x2190 */  50, 66, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x21a0 */  48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x21b0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x21c0 */  49, 50, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x21d0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50,
-/* 0x21e0 */  50, 32, 78, 50, 66, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32,
-/* 0x21f0 */  48, 48, 48, 48, 48, 48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2200 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2210 */  48, 48, 48, 49, 51, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2220 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2230 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 51, 32, 78, 50, 66, 70,
-/* 0x2240 */  65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2250 */  49, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2260 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 51,100,
-/* 0x2270 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2280 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2290 */  89, 10, 32, 50, 52, 32, 78, 50, 66, 70, 65, 83, 54, 49, 32, 32,
-/* 0x22a0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 54, 32, 32, 48, 48,
-/* 0x22b0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22c0 */  32, 32, 48, 48, 48, 48, 48, 49, 53, 54, 32, 32, 50, 42, 42, 48,
-/* 0x22d0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x22e0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 53, 32,
-/* 0x22f0 */  78, 50, 66, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2300 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2310 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2320 */  48, 49, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2330 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2340 */  50, 54, 32, 78, 50, 68, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32,
-/* 0x2350 */  32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2360 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2370 */  48, 48, 48, 48, 49, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2380 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2390 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 55, 32, 78, 50, 68,
-/* 0x23a0 */  70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x23b0 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x23c0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 54,
-/* 0x23d0 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x23e0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x23f0 */  76, 89, 10, 32, 50, 56, 32, 78, 50, 68, 70, 65, 83, 49, 49, 32,
-/* 0x2400 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48,
-/* 0x2410 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2420 */  48, 32, 32, 48, 48, 48, 48, 48, 49, 55, 49, 32, 32, 50, 42, 42,
-/* 0x2430 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x2440 */  68, 79, 78, 76, 89, 10, 32, 50, 57, 32, 78, 50, 68, 68, 69, 67,
-/* 0x2450 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98,
-/* 0x2460 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2470 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 55, 55, 32, 32,
-/* 0x2480 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2490 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 48, 32, 78, 50, 68,
-/* 0x24a0 */  83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x24b0 */  48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x24c0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 56,
-/* 0x24d0 */  50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x24e0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x24f0 */  76, 89, 10, 32, 51, 49, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32,
-/* 0x2500 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48,
-/* 0x2510 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2520 */  48, 32, 32, 48, 48, 48, 48, 48, 49, 56, 55, 32, 32, 50, 42, 42,
-/* 0x2530 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2540 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 50,
-/* 0x2550 */  32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2560 */  48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2570 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2580 */  48, 48, 49, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2590 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x25a0 */  32, 51, 51, 32, 78, 50, 68, 83, 77, 65, 51, 48, 32, 32, 32, 32,
-/* 0x25b0 */  32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48,
-/* 0x25c0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x25d0 */  48, 48, 48, 48, 48, 49, 57,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x25e0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x25f0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 52, 32, 78, 50,
-/* 0x2600 */  68, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2610 */  48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2620 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x2630 */  97, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2640 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2650 */  78, 76, 89, 10, 32, 51, 53, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x2660 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 53, 50, 32, 32,
-/* 0x2670 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2680 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 98, 57, 32, 32, 50, 42,
-/* 0x2690 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x26a0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51,
-/* 0x26b0 */  54, 32, 78, 50, 68, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x26c0 */  48, 48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x26d0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x26e0 */  48, 48, 48, 50, 48, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x26f0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2700 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 55, 32, 78, 50, 68, 70,
-/* 0x2710 */  65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2720 */  48,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2730 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 49, 56,
-/* 0x2740 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2750 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2760 */  89, 10, 32, 51, 56, 32, 78, 50, 68, 83, 77, 65, 53, 48, 32, 32,
-/* 0x2770 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48,
-/* 0x2780 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2790 */  32, 32, 48, 48, 48, 48, 48, 50, 50, 55, 32, 32, 50, 42, 42, 48,
-/* 0x27a0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x27b0 */  79, 78, 76, 89, 10, 32, 51, 57, 32, 78, 50, 68, 70, 65, 83, 53,
-/* 0x27c0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x27d0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x27e0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 50, 57, 32, 32, 50,
-/* 0x27f0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2800 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 48, 32, 78, 50, 68, 68,
-/* 0x2810 */  69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2820 */  48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2830 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 50, 99,
-/* 0x2840 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2850 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 49, 32, 78,
-/* 0x2860 */  50, 68, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2870 */  48, 48, 48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2880 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2890 */  50, 51, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x28a0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x28b0 */  79, 78, 76, 89, 10, 32, 52, 50, 32, 78, 50, 68, 70, 65, 83, 54,
-/* 0x28c0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 57, 32,
-/* 0x28d0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x28e0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 52, 49, 32, 32, 50,
-/* 0x28f0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2900 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2910 */  52, 51, 32, 78, 50, 68, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32,
-/* 0x2920 */  32, 48, 48, 48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2930 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2940 */  48, 48, 48, 48, 50, 53, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2950 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2960 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 52, 32, 78, 50, 68,
-/* 0x2970 */  68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2980 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2990 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 55,
-/* 0x29a0 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x29b0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 53, 32,
-/* 0x29c0 */  78, 50, 69, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x29d0 */  48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x29e0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x29f0 */  48, 50, 55, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2a00 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2a10 */  68, 79, 78, 76, 89, 10, 32, 52, 54, 32, 78, 50, 69, 70, 65, 83,
-/* 0x2a20 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x2a30 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2a40 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 55, 51, 32, 32,
-/* 0x2a50 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2a60 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2a70 */  32, 52, 55, 32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 32, 32, 32,
-/* 0x2a80 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48,
-/* 0x2a90 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2aa0 */  48, 48, 48, 48, 48, 50, 55, 53, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2ab0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2ac0 */  76, 89, 10, 32, 52, 56, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32,
-/* 0x2ad0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48,
-/* 0x2ae0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2af0 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 55, 98, 32, 32, 50, 42, 42,
-/* 0x2b00 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x2b10 */  68, 79, 78, 76, 89, 10, 32, 52, 57, 32, 78, 50, 69, 83, 77, 65,
-/* 0x2b20 */  50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x2b30 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2b40 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 56, 54, 32, 32,
-/* 0x2b50 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2b60 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2b70 */  32, 53, 48, 32, 78, 50, 69, 70, 65, 83, 50, 48, 32, 32, 32, 32,
-/* 0x2b80 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48,
-/* 0x2b90 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2ba0 */  48, 48, 48, 48, 48, 50, 56, 98, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2bb0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x2bc0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 49, 32, 78, 50,
-/* 0x2bd0 */  69, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2be0 */  48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2bf0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,
-/* 0x2c00 */  57, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2c10 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 50,
-/* 0x2c20 */  32, 78, 50, 69, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2c30 */  48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c40 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2c50 */  48, 48, 50, 97, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2c60 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x2c70 */  65, 68, 79, 78, 76, 89, 10, 32, 53, 51, 32, 78, 50, 69, 70, 65,
-/* 0x2c80 */  83, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c90 */ 102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2ca0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 97,101, 32,
-/* 0x2cb0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2cc0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2cd0 */  10, 32, 53, 52, 32, 78, 50, 69, 68, 69, 67, 51, 48, 32, 32, 32,
-/* 0x2ce0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 53,102, 32, 32, 48, 48, 48,
-/* 0x2cf0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2d00 */  32, 48, 48, 48, 48, 48, 50, 98,100, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2d10 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x2d20 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 53, 32, 78,
-/* 0x2d30 */  50, 69, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2d40 */  48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2d50 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2d60 */  51, 49, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2d70 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2d80 */  79, 78, 76, 89, 10, 32, 53, 54, 32, 78, 50, 69, 70, 65, 83, 52,
-/* 0x2d90 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32,
-/* 0x2da0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2db0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 50, 57, 32, 32, 50,
-/* 0x2dc0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2dd0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2de0 */  53, 55, 32, 78, 50, 69, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32,
-/* 0x2df0 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2e00 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2e10 */  48, 48, 48, 48, 51, 51, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2e20 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2e30 */  89, 10, 32, 53, 56, 32, 78, 50, 69, 70, 65, 83, 53, 48, 32, 32,
-/* 0x2e40 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48,
-/* 0x2e50 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2e60 */  32, 32, 48, 48, 48, 48, 48, 51, 51, 97, 32, 32, 50, 42, 42, 48,
-/* 0x2e70 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x2e80 */  79, 78, 76, 89, 10, 32, 53, 57, 32, 78, 50, 69, 68, 69, 67, 53,
-/* 0x2e90 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32,
-/* 0x2ea0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2eb0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 51,100, 32, 32, 50,
-/* 0x2ec0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2ed0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 48, 32, 78, 50, 69, 83,
-/* 0x2ee0 */  77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2ef0 */  48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2f00 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 52, 54,
-/* 0x2f10 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2f20 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2f30 */  89, 10, 32, 54, 49, 32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 32,
-/* 0x2f40 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 57, 32, 32, 48, 48,
-/* 0x2f50 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f60 */  32, 32, 48, 48, 48, 48, 48, 51, 53, 50, 32, 32, 50, 42, 42, 48,
-/* 0x2f70 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2f80 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 50, 32,
-/* 0x2f90 */  78, 50, 69, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2fa0 */  48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2fb0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2fc0 */  48, 51, 54, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2fd0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2fe0 */  68, 79, 78, 76, 89, 10, 32, 54, 51, 32, 78, 50, 69, 68, 69, 67,
-/* 0x2ff0 */  54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3000 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3010 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 56, 49, 32, 32,
-/* 0x3020 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3030 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 52, 32, 76, 90, 77,
-/* 0x3040 */  65, 95, 68, 69, 67, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3050 */  48, 50,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3060 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 56,
-/* 0x3070 */  49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3080 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3090 */  76, 89, 10, 32, 54, 53, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x30a0 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 52, 56, 32, 32, 48,
-/* 0x30b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x30c0 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 97,102, 32, 32, 50, 42, 42,
-/* 0x30d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x30e0 */  68, 79, 78, 76, 89, 10, 32, 54, 54, 32, 76, 90, 77, 65, 95, 68,
-/* 0x30f0 */  69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97, 56, 54,
-/* 0x3100 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3110 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51,102, 55, 32, 32,
-/* 0x3120 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3130 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 55, 32, 76, 90, 77,
-/* 0x3140 */  65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3150 */  97, 56, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3160 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,101, 55,
-/* 0x3170 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3180 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 56, 32,
-/* 0x3190 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48,
-/* 0x31a0 */  48, 48, 48, 48, 49, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31b0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x31c0 */  49, 57, 48, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x31d0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x31e0 */  54, 57, 32, 84, 77, 84, 77, 65, 73, 78, 53, 32, 32, 32, 32, 32,
-/* 0x31f0 */  32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3200 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3210 */  48, 48, 48, 49, 57, 49,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3220 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x3230 */  89, 10, 32, 55, 48, 32, 84, 77, 84, 67, 65, 76, 84, 50, 32, 32,
-/* 0x3240 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48,
-/* 0x3250 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3260 */  32, 32, 48, 48, 48, 48, 49, 57, 50, 51, 32, 32, 50, 42, 42, 48,
-/* 0x3270 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x3280 */  79, 78, 76, 89, 10, 32, 55, 49, 32, 67, 65, 76, 76, 84, 82, 48,
-/* 0x3290 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32,
-/* 0x32a0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x32b0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 50, 52, 32, 32, 50,
-/* 0x32c0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x32d0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x32e0 */  55, 50, 32, 67, 84, 67, 76, 69, 86, 69, 49, 32, 32, 32, 32, 32,
-/* 0x32f0 */  32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3300 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3310 */  48, 48, 48, 49, 57, 51, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3320 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x3330 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 51, 32, 67, 65, 76,
-/* 0x3340 */  76, 84, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3350 */  48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3360 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 51,
-/* 0x3370 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3380 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 52, 32,
-/* 0x3390 */  67, 84, 66, 83, 72, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x33a0 */  48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33b0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x33c0 */  49, 57, 51, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x33d0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x33e0 */  55, 53, 32, 67, 84, 66, 82, 79, 82, 48, 49, 32, 32, 32, 32, 32,
-/* 0x33f0 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3400 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3410 */  48, 48, 48, 49, 57, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3420 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x3430 */  89, 10, 32, 55, 54, 32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 32,
-/* 0x3440 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48,
-/* 0x3450 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3460 */  32, 32, 48, 48, 48, 48, 49, 57, 52, 50, 32, 32, 50, 42, 42, 48,
-/* 0x3470 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x3480 */  79, 78, 76, 89, 10, 32, 55, 55, 32, 67, 65, 76, 76, 84, 82, 48,
-/* 0x3490 */  50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 48, 32,
-/* 0x34a0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x34b0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 52, 55, 32, 32, 50,
-/* 0x34c0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x34d0 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x34e0 */  55, 56, 32, 67, 65, 76, 76, 84, 82, 49, 48, 32, 32, 32, 32, 32,
-/* 0x34f0 */  32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3500 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3510 */  48, 48, 48, 49, 57, 53, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3520 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x3530 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 57, 32, 67, 65, 76,
-/* 0x3540 */  76, 84, 82, 69, 56, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3550 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3560 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 53,
-/* 0x3570 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3580 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 48, 32,
-/* 0x3590 */  67, 65, 76, 76, 84, 82, 69, 57, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x35a0 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x35b0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x35c0 */  49, 57, 53,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x35d0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x35e0 */  56, 49, 32, 67, 65, 76, 76, 84, 82, 49, 49, 32, 32, 32, 32, 32,
-/* 0x35f0 */  32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3600 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3610 */  48, 48, 48, 49, 57, 54, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3620 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x3630 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 50, 32, 67, 84, 67,
-/* 0x3640 */  76, 69, 86, 69, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3650 */  48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3660 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 54,
-/* 0x3670 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3680 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3690 */  76, 89, 10, 32, 56, 51, 32, 67, 65, 76, 76, 84, 82, 49, 50, 32,
-/* 0x36a0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x36b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36c0 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 54, 57, 32, 32, 50, 42, 42,
-/* 0x36d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x36e0 */  68, 79, 78, 76, 89, 10, 32, 56, 52, 32, 67, 84, 66, 83, 72, 82,
-/* 0x36f0 */  49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x3700 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3710 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 54, 98, 32, 32,
-/* 0x3720 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3730 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 53, 32, 67, 84, 66,
-/* 0x3740 */  82, 79, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3750 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3760 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 54,
-/* 0x3770 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3780 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 54, 32,
-/* 0x3790 */  67, 84, 66, 83, 87, 65, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x37a0 */  48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x37b0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x37c0 */  49, 57, 55, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x37d0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x37e0 */  56, 55, 32, 67, 65, 76, 76, 84, 82, 49, 51, 32, 32, 32, 32, 32,
-/* 0x37f0 */  32, 48, 48, 48, 48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3800 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3810 */  48, 48, 48, 49, 57, 55, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3820 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x3830 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 56, 32, 99,116,111,
-/* 0x3840 */ 107, 51, 50, 46, 48, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3850 */  48, 48, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3860 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 55,
-/* 0x3870 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3880 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3890 */  76, 89, 10, 32, 56, 57, 32, 99,116,111,107, 51, 50, 46, 49, 48,
-/* 0x38a0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,101, 32, 32, 48,
-/* 0x38b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x38c0 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 56, 55, 32, 32, 50, 42, 42,
-/* 0x38d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x38e0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 48,
-/* 0x38f0 */  32, 99,116,111,107, 51, 50, 46, 50, 48, 32, 32, 32, 32, 32, 48,
-/* 0x3900 */  48, 48, 48, 48, 48, 50, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3910 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3920 */  48, 49, 57, 57, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3930 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x3940 */  65, 68, 79, 78, 76, 89, 10, 32, 57, 49, 32, 99,116,111,107, 51,
-/* 0x3950 */  50, 46, 51, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3960 */  97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3970 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 98, 53, 32,
-/* 0x3980 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3990 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x39a0 */  10, 32, 57, 50, 32, 99,116,111,107, 51, 50, 46, 52, 48, 32, 32,
-/* 0x39b0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48,
-/* 0x39c0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x39d0 */  32, 48, 48, 48, 48, 49, 57, 98,102, 32, 32, 50, 42, 42, 48, 32,
-/* 0x39e0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x39f0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 51, 32, 84,
-/* 0x3a00 */  77, 84, 82, 69, 76, 79, 67, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x3a10 */  48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3a20 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x3a30 */  57, 99, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3a40 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57,
-/* 0x3a50 */  52, 32, 82, 69, 76, 79, 67, 51, 50, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3a60 */  48, 48, 48, 48, 48, 48, 50, 57, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3a70 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3a80 */  48, 48, 49, 57, 99, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3a90 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x3aa0 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 53, 32, 82, 69, 76, 51,
-/* 0x3ab0 */  50, 66, 73, 71, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x3ac0 */  48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x3ad0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,102, 48,
-/* 0x3ae0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3af0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x3b00 */  89, 10, 32, 57, 54, 32, 82, 69, 76, 79, 67, 51, 50, 74, 32, 32,
-/* 0x3b10 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48,
-/* 0x3b20 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b30 */  32, 32, 48, 48, 48, 48, 49, 57,102, 57, 32, 32, 50, 42, 42, 48,
-/* 0x3b40 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x3b50 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 55, 32,
-/* 0x3b60 */  82, 69, 76, 51, 50, 69, 78, 68, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x3b70 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b80 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3b90 */  49, 57,102, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3ba0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x3bb0 */  57, 56, 32, 84, 77, 84, 74, 85, 77, 80, 49, 32, 32, 32, 32, 32,
-/* 0x3bc0 */  32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48,
-/* 0x3bd0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x3be0 */  48, 48, 48, 49, 57,102, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3bf0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x3c00 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32,
-/* 0x3c10 */  84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3c20 */ 108, 32, 32, 32, 32,100, 32, 32, 84, 77, 84, 67, 85, 84, 80, 79,
-/* 0x3c30 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 84, 77, 84, 67, 85, 84,
-/* 0x3c40 */  80, 79, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3c50 */  32,100, 32, 32, 78, 50, 66, 83, 77, 65, 49, 48,  9, 48, 48, 48,
-/* 0x3c60 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 48,
-/* 0x3c70 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3c80 */  78, 50, 66, 70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c90 */  48, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48,
-/* 0x3ca0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68,
-/* 0x3cb0 */  69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x3cc0 */  66, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3cd0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48,
-/* 0x3ce0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67,
-/* 0x3cf0 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3d00 */  32,100, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48,  9, 48, 48, 48,
-/* 0x3d10 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 48,
-/* 0x3d20 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3d30 */  78, 50, 66, 68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d40 */  48, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3d50 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x3d60 */  65, 83, 54, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x3d70 */  66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3d80 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 54, 48,
-/* 0x3d90 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67,
-/* 0x3da0 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3db0 */  32,100, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48,  9, 48, 48, 48,
-/* 0x3dc0 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 48,
-/* 0x3dd0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3de0 */  78, 50, 68, 70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3df0 */  48, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48,
-/* 0x3e00 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68,
-/* 0x3e10 */  69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x3e20 */  68, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3e30 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48,
-/* 0x3e40 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67,
-/* 0x3e50 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3e60 */  32,100, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,  9, 48, 48, 48,
-/* 0x3e70 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48,
-/* 0x3e80 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3e90 */  78, 50, 68, 68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ea0 */  48, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3eb0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70,
-/* 0x3ec0 */  65, 83, 54, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x3ed0 */  68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3ee0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48,
-/* 0x3ef0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67,
-/* 0x3f00 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3f10 */  32,100, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48,  9, 48, 48, 48,
-/* 0x3f20 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 48,
-/* 0x3f30 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3f40 */  78, 50, 69, 70, 65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f50 */  48, 32, 78, 50, 69, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48,
-/* 0x3f60 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68,
-/* 0x3f70 */  69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x3f80 */  69, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3f90 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48,
-/* 0x3fa0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67,
-/* 0x3fb0 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3fc0 */  32,100, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48,  9, 48, 48, 48,
-/* 0x3fd0 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48,
-/* 0x3fe0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3ff0 */  78, 50, 69, 68, 69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4000 */  48, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4010 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x4020 */  65, 83, 54, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4030 */  69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4040 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48,
-/* 0x4050 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67,
-/* 0x4060 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4070 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48,  9, 48, 48, 48,
-/* 0x4080 */  48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 48,
-/* 0x4090 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x40a0 */  67, 65, 76, 76, 84, 82, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x40b0 */  48, 32, 67, 65, 76, 76, 84, 82, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x40c0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76,
-/* 0x40d0 */  84, 82, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65,
-/* 0x40e0 */  76, 76, 84, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x40f0 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51,
-/* 0x4100 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x4110 */  49, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4120 */  32,100, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48,  9, 48, 48,
-/* 0x4130 */  48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 48, 48,
-/* 0x4140 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4150 */  32, 32, 99,116,111,107, 51, 50, 46, 49, 48,  9, 48, 48, 48, 48,
-/* 0x4160 */  48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 48,
-/* 0x4170 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4180 */  99,116,111,107, 51, 50, 46, 50, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4190 */  48, 48, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 48, 48, 48,
-/* 0x41a0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,
-/* 0x41b0 */ 111,107, 51, 50, 46, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x41c0 */  32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x41d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 82, 69, 76, 79,
-/* 0x41e0 */  67, 51, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 69,
-/* 0x41f0 */  76, 79, 67, 51, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4200 */ 108, 32, 32, 32, 32,100, 32, 32, 82, 69, 76, 79, 67, 51, 50, 74,
-/* 0x4210 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 69, 76, 79, 67, 51,
-/* 0x4220 */  50, 74, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4230 */  32,100, 32, 32, 84, 77, 84, 77, 65, 73, 78, 49,  9, 48, 48, 48,
-/* 0x4240 */  48, 48, 48, 48, 48, 32, 84, 77, 84, 77, 65, 73, 78, 49, 10, 48,
-/* 0x4250 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4260 */  84, 77, 84, 77, 65, 73, 78, 49, 65,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4270 */  48, 48, 32, 84, 77, 84, 77, 65, 73, 78, 49, 65, 10, 48, 48, 48,
-/* 0x4280 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 84, 77,
-/* 0x4290 */  84, 77, 65, 73, 78, 49, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x42a0 */  32, 84, 77, 84, 77, 65, 73, 78, 49, 66, 10, 48, 48, 48, 48, 48,
-/* 0x42b0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 84, 77, 84, 67,
-/* 0x42c0 */  65, 76, 84, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 84, 77,
-/* 0x42d0 */  84, 67, 65, 76, 84, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x42e0 */ 108, 32, 32, 32, 32,100, 32, 32, 84, 77, 84, 77, 65, 73, 78, 50,
-/* 0x42f0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 84, 77, 84, 77, 65, 73,
-/* 0x4300 */  78, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4310 */  32,100, 32, 32, 85, 80, 88, 49, 72, 69, 65, 68,  9, 48, 48, 48,
-/* 0x4320 */  48, 48, 48, 48, 48, 32, 85, 80, 88, 49, 72, 69, 65, 68, 10, 48,
-/* 0x4330 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4340 */  78, 50, 66, 70, 65, 83, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4350 */  48, 32, 78, 50, 66, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4360 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83,
-/* 0x4370 */  77, 65, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4380 */  66, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4390 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 50, 48,
-/* 0x43a0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83,
-/* 0x43b0 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x43c0 */  32,100, 32, 32, 78, 50, 66, 83, 77, 65, 51, 48,  9, 48, 48, 48,
-/* 0x43d0 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 51, 48, 10, 48,
-/* 0x43e0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x43f0 */  78, 50, 66, 70, 65, 83, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4400 */  48, 32, 78, 50, 66, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4410 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83,
-/* 0x4420 */  77, 65, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4430 */  66, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4440 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 52, 48,
-/* 0x4450 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83,
-/* 0x4460 */  52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4470 */  32,100, 32, 32, 78, 50, 66, 83, 77, 65, 53, 48,  9, 48, 48, 48,
-/* 0x4480 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65, 53, 48, 10, 48,
-/* 0x4490 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x44a0 */  78, 50, 66, 70, 65, 83, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x44b0 */  48, 32, 78, 50, 66, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x44c0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83,
-/* 0x44d0 */  77, 65, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x44e0 */  66, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x44f0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 48,
-/* 0x4500 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83,
-/* 0x4510 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4520 */  32,100, 32, 32, 78, 50, 68, 70, 65, 83, 49, 48,  9, 48, 48, 48,
-/* 0x4530 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 49, 48, 10, 48,
-/* 0x4540 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4550 */  78, 50, 68, 83, 77, 65, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4560 */  48, 32, 78, 50, 68, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4570 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70,
-/* 0x4580 */  65, 83, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4590 */  68, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x45a0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 51, 48,
-/* 0x45b0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65,
-/* 0x45c0 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x45d0 */  32,100, 32, 32, 78, 50, 68, 70, 65, 83, 51, 48,  9, 48, 48, 48,
-/* 0x45e0 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 51, 48, 10, 48,
-/* 0x45f0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4600 */  78, 50, 68, 83, 77, 65, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4610 */  48, 32, 78, 50, 68, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4620 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70,
-/* 0x4630 */  65, 83, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4640 */  68, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4650 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 53, 48,
-/* 0x4660 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65,
-/* 0x4670 */  53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4680 */  32,100, 32, 32, 78, 50, 68, 70, 65, 83, 53, 48,  9, 48, 48, 48,
-/* 0x4690 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83, 53, 48, 10, 48,
-/* 0x46a0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x46b0 */  78, 50, 68, 83, 77, 65, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x46c0 */  48, 32, 78, 50, 68, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x46d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70,
-/* 0x46e0 */  65, 83, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x46f0 */  68, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4700 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 49, 48,
-/* 0x4710 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83,
-/* 0x4720 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4730 */  32,100, 32, 32, 78, 50, 69, 83, 77, 65, 50, 48,  9, 48, 48, 48,
-/* 0x4740 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 50, 48, 10, 48,
-/* 0x4750 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4760 */  78, 50, 69, 70, 65, 83, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4770 */  48, 32, 78, 50, 69, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4780 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83,
-/* 0x4790 */  77, 65, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x47a0 */  69, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x47b0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 51, 48,
-/* 0x47c0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83,
-/* 0x47d0 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x47e0 */  32,100, 32, 32, 78, 50, 69, 83, 77, 65, 52, 48,  9, 48, 48, 48,
-/* 0x47f0 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 52, 48, 10, 48,
-/* 0x4800 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4810 */  78, 50, 69, 70, 65, 83, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4820 */  48, 32, 78, 50, 69, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4830 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83,
-/* 0x4840 */  77, 65, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x4850 */  69, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4860 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 53, 48,
-/* 0x4870 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83,
-/* 0x4880 */  53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4890 */  32,100, 32, 32, 78, 50, 69, 83, 77, 65, 54, 48,  9, 48, 48, 48,
-/* 0x48a0 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65, 54, 48, 10, 48,
-/* 0x48b0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x48c0 */  78, 50, 69, 70, 65, 83, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x48d0 */  48, 32, 78, 50, 69, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x48e0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x48f0 */  95, 68, 69, 67, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4900 */  76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4910 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x4920 */  95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4930 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4940 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x4950 */  95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4960 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4970 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x4980 */  95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4990 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x49a0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x49b0 */  95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x49c0 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x49d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 84, 77, 84, 77,
-/* 0x49e0 */  65, 73, 78, 53,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 84, 77,
-/* 0x49f0 */  84, 77, 65, 73, 78, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4a00 */ 108, 32, 32, 32, 32,100, 32, 32, 84, 77, 84, 67, 65, 76, 84, 50,
-/* 0x4a10 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 84, 77, 84, 67, 65, 76,
-/* 0x4a20 */  84, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4a30 */  32,100, 32, 32, 67, 84, 67, 76, 69, 86, 69, 49,  9, 48, 48, 48,
-/* 0x4a40 */  48, 48, 48, 48, 48, 32, 67, 84, 67, 76, 69, 86, 69, 49, 10, 48,
-/* 0x4a50 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4a60 */  67, 65, 76, 76, 84, 82, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a70 */  48, 32, 67, 65, 76, 76, 84, 82, 48, 49, 10, 48, 48, 48, 48, 48,
-/* 0x4a80 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83,
-/* 0x4a90 */  72, 82, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84,
-/* 0x4aa0 */  66, 83, 72, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4ab0 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 48, 49,
-/* 0x4ac0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 82, 79, 82,
-/* 0x4ad0 */  48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4ae0 */  32,100, 32, 32, 67, 84, 66, 83, 87, 65, 48, 49,  9, 48, 48, 48,
-/* 0x4af0 */  48, 48, 48, 48, 48, 32, 67, 84, 66, 83, 87, 65, 48, 49, 10, 48,
-/* 0x4b00 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4b10 */  67, 65, 76, 76, 84, 82, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4b20 */  48, 32, 67, 65, 76, 76, 84, 82, 48, 50, 10, 48, 48, 48, 48, 48,
-/* 0x4b30 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76,
-/* 0x4b40 */  84, 82, 69, 56,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65,
-/* 0x4b50 */  76, 76, 84, 82, 69, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4b60 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 69, 57,
-/* 0x4b70 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x4b80 */  69, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4b90 */  32,100, 32, 32, 67, 84, 67, 76, 69, 86, 69, 50,  9, 48, 48, 48,
-/* 0x4ba0 */  48, 48, 48, 48, 48, 32, 67, 84, 67, 76, 69, 86, 69, 50, 10, 48,
-/* 0x4bb0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4bc0 */  67, 65, 76, 76, 84, 82, 49, 50,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4bd0 */  48, 32, 67, 65, 76, 76, 84, 82, 49, 50, 10, 48, 48, 48, 48, 48,
-/* 0x4be0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83,
-/* 0x4bf0 */  72, 82, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84,
-/* 0x4c00 */  66, 83, 72, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4c10 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 49, 49,
-/* 0x4c20 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 82, 79, 82,
-/* 0x4c30 */  49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4c40 */  32,100, 32, 32, 67, 84, 66, 83, 87, 65, 49, 49,  9, 48, 48, 48,
-/* 0x4c50 */  48, 48, 48, 48, 48, 32, 67, 84, 66, 83, 87, 65, 49, 49, 10, 48,
-/* 0x4c60 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4c70 */  99,116,111,107, 51, 50, 46, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4c80 */  48, 48, 32, 99,116,111,107, 51, 50, 46, 51, 48, 10, 48, 48, 48,
-/* 0x4c90 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 84, 77,
-/* 0x4ca0 */  84, 82, 69, 76, 79, 67,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4cb0 */  84, 77, 84, 82, 69, 76, 79, 67, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4cc0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 82, 69, 76, 51, 50, 66,
-/* 0x4cd0 */  73, 71,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 69, 76, 51,
-/* 0x4ce0 */  50, 66, 73, 71, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4cf0 */  32, 32, 32,100, 32, 32, 82, 69, 76, 51, 50, 69, 78, 68,  9, 48,
-/* 0x4d00 */  48, 48, 48, 48, 48, 48, 48, 32, 82, 69, 76, 51, 50, 69, 78, 68,
-/* 0x4d10 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4d20 */  32, 32, 84, 77, 84, 74, 85, 77, 80, 49,  9, 48, 48, 48, 48, 48,
-/* 0x4d30 */  48, 48, 48, 32, 84, 77, 84, 74, 85, 77, 80, 49, 10, 48, 48, 48,
-/* 0x4d40 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x4d50 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 99,111,112,
-/* 0x4d60 */ 121, 95,115,111,117,114, 99,101, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4d70 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x4d80 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 99,111,112,121, 95,100,101,
-/* 0x4d90 */ 115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x4da0 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4db0 */  48, 48, 32, 98,121,116,101,115, 95,116,111, 95, 99,111,112,121,
-/* 0x4dc0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4dd0 */  32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4de0 */  32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,
-/* 0x4df0 */ 115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x4e00 */  32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48,
-/* 0x4e10 */  48, 48, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48,
-/* 0x4e20 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x4e30 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,
-/* 0x4e40 */ 109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4e50 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x4e60 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95,112,114,
-/* 0x4e70 */ 111,112,101,114,116,105,101,115, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4e80 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x4e90 */  48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,101,114, 95,
-/* 0x4ea0 */ 108,101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4eb0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x4ec0 */  48, 48, 48, 48, 48, 48, 32,102,105,108,116,101,114, 95, 99,116,
-/* 0x4ed0 */ 111, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x4ee0 */  32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ef0 */  48, 32,111,114,105,103,105,110, 97,108, 95,101,110,116,114,121,
-/* 0x4f00 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4f10 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 84, 77, 84, 77, 65, 73,
-/* 0x4f20 */  78, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x4f30 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4f40 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82,
-/* 0x4f50 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4f60 */  32, 99,111,112,121, 95,115,111,117,114, 99,101, 10, 48, 48, 48,
-/* 0x4f70 */  48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32,
-/* 0x4f80 */  32, 32, 32, 32, 32, 32, 32, 32, 99,111,112,121, 95,100,101,115,
-/* 0x4f90 */ 116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x4fa0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 84, 77, 84, 77, 65,
-/* 0x4fb0 */  73, 78, 49, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x4fc0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4fd0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x4fe0 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4ff0 */  32, 32, 32, 98,121,116,101,115, 95,116,111, 95, 99,111,112,121,
-/* 0x5000 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5010 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 84, 77, 84, 77, 65, 73,
-/* 0x5020 */  78, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5030 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5040 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x5050 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5060 */  32, 84, 77, 84, 67, 85, 84, 80, 79, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5070 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5080 */  82, 32, 91, 78, 50, 66, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70,
-/* 0x5090 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x50a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x50b0 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x50c0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x50d0 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x50e0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70,
-/* 0x50f0 */  65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5100 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5110 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x5120 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5130 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x5140 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5150 */  70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 50, 48, 93, 58, 10,
-/* 0x5160 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5170 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5180 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5190 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 83,
-/* 0x51a0 */  77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x51b0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x51c0 */  66, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x51d0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x51e0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x51f0 */  48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5200 */  32, 32, 32, 32, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 10, 82,
-/* 0x5210 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5220 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 51, 48, 93,
-/* 0x5230 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5240 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5250 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56,
-/* 0x5260 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5270 */  66, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5280 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5290 */  78, 50, 66, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x52a0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x52b0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x52c0 */  48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x52d0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10,
-/* 0x52e0 */  48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x52f0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69,
-/* 0x5300 */  67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5310 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66,
-/* 0x5320 */  68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5330 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5340 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x5350 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5360 */  32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48, 48,
-/* 0x5370 */  48, 48, 48, 50,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5380 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48,
-/* 0x5390 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x53a0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65,
-/* 0x53b0 */  52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x53c0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x53d0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82,
-/* 0x53e0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x53f0 */  32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5400 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5410 */  82, 32, 91, 78, 50, 66, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70,
-/* 0x5420 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5430 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5440 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5450 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x5460 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56,
-/* 0x5470 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5480 */  66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5490 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x54a0 */  78, 50, 66, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x54b0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x54c0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x54d0 */  48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x54e0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10,
-/* 0x54f0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5500 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54,
-/* 0x5510 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5520 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5530 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95,
-/* 0x5540 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5550 */  78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x5560 */  53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x5570 */  32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x5580 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5590 */  32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 49, 93, 58,
-/* 0x55a0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x55b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x55c0 */  69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54,
-/* 0x55d0 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x55e0 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x55f0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5600 */  50, 68, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5610 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5620 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5630 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5640 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10,
-/* 0x5650 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5660 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 49, 48,
-/* 0x5670 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5680 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5690 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x56a0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x56b0 */  50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x56c0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x56d0 */  91, 78, 50, 68, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x56e0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x56f0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5700 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5710 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48,
-/* 0x5720 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5730 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83,
-/* 0x5740 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5750 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5760 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x5770 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5780 */  32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5790 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x57a0 */  82, 32, 91, 78, 50, 68, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70,
-/* 0x57b0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x57c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x57d0 */  48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x57e0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x57f0 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5800 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70,
-/* 0x5810 */  65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5820 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5830 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x5840 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5850 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x5860 */  48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5870 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10,
-/* 0x5880 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5890 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 68, 69, 67, 51,
-/* 0x58a0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x58b0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x58c0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95,
-/* 0x58d0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x58e0 */  78, 50, 68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 50,
-/* 0x58f0 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5900 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48,
-/* 0x5910 */  48, 48, 48, 52, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5920 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48,
-/* 0x5930 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5940 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65,
-/* 0x5950 */  52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5960 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5970 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82,
-/* 0x5980 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5990 */  32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x59a0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x59b0 */  82, 32, 91, 78, 50, 68, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70,
-/* 0x59c0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x59d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x59e0 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x59f0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x5a00 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56,
-/* 0x5a10 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5a20 */  68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5a30 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5a40 */  78, 50, 68, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x5a50 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5a60 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5a70 */  48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x5a80 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10,
-/* 0x5a90 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5aa0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54,
-/* 0x5ab0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5ac0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5ad0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95,
-/* 0x5ae0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5af0 */  78, 50, 68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x5b00 */  53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x5b10 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x5b20 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5b30 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 49, 93, 58,
-/* 0x5b40 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5b50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5b60 */  69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54,
-/* 0x5b70 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x5b80 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5b90 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5ba0 */  50, 69, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5bb0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5bc0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5bd0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5be0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10,
-/* 0x5bf0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5c00 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 49, 48,
-/* 0x5c10 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5c20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5c30 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x5c40 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5c50 */  50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5c60 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5c70 */  91, 78, 50, 69, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5c80 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5c90 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5ca0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5cb0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48,
-/* 0x5cc0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5cd0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83,
-/* 0x5ce0 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5cf0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d00 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x5d10 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d20 */  32, 78, 50, 69, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5d30 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5d40 */  82, 32, 91, 78, 50, 69, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70,
-/* 0x5d50 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5d60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5d70 */  48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5d80 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x5d90 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5da0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70,
-/* 0x5db0 */  65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5dc0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5dd0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x5de0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5df0 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x5e00 */  48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5e10 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10,
-/* 0x5e20 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5e30 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 68, 69, 67, 51,
-/* 0x5e40 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5e50 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5e60 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95,
-/* 0x5e70 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e80 */  78, 50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x5e90 */ 101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5ea0 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48,
-/* 0x5eb0 */  48, 48, 48, 51, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5ec0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48,
-/* 0x5ed0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5ee0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65,
-/* 0x5ef0 */  52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5f00 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f10 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82,
-/* 0x5f20 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f30 */  32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5f40 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5f50 */  82, 32, 91, 78, 50, 69, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70,
-/* 0x5f60 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5f70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5f80 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5f90 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x5fa0 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56,
-/* 0x5fb0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5fc0 */  69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5fd0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5fe0 */  78, 50, 69, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x5ff0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6000 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6010 */  48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x6020 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10,
-/* 0x6030 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6040 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54,
-/* 0x6050 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6060 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6070 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95,
-/* 0x6080 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6090 */  78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x60a0 */  53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x60b0 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x60c0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x60d0 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 49, 93, 58,
-/* 0x60e0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x60f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6100 */  69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54,
-/* 0x6110 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x6120 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6130 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x6140 */  90, 77, 65, 95, 68, 69, 67, 48, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6150 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6160 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6170 */  48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32,
-/* 0x6180 */  32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,115,116, 97,
-/* 0x6190 */  99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x61a0 */  49, 52, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x61b0 */  32, 32, 32, 32, 32,108,122,109, 97, 95,117, 95,108,101,110, 10,
-/* 0x61c0 */  48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x61d0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,
-/* 0x61e0 */  99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 50, 97, 32, 82,
-/* 0x61f0 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6200 */  32,108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,
-/* 0x6210 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6220 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82,
-/* 0x6230 */  48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6240 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6250 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x6260 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6270 */  32,102,105,108,116,101,114, 95,108,101,110,103,116,104, 10, 10,
-/* 0x6280 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6290 */  68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76, 69, 86, 69, 49,
-/* 0x62a0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x62b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x62c0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51,
-/* 0x62d0 */  56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,
-/* 0x62e0 */ 105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48,
-/* 0x62f0 */  48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6300 */  32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82,
-/* 0x6310 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6320 */  83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 48, 50, 93,
-/* 0x6330 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6340 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6350 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56,
-/* 0x6360 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65,
-/* 0x6370 */  76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6380 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6390 */  67, 65, 76, 76, 84, 82, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x63a0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x63b0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x63c0 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x63d0 */  32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,
-/* 0x63e0 */ 110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x63f0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65,
-/* 0x6400 */  76, 76, 84, 82, 49, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6410 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6420 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6430 */  48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6440 */  32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51, 10, 10, 82,
-/* 0x6450 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6460 */  83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76, 69, 86, 69, 50, 93,
-/* 0x6470 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6480 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6490 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56,
-/* 0x64a0 */  54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,
-/* 0x64b0 */ 108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x64c0 */  52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x64d0 */  32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49, 10, 10, 82, 69,
-/* 0x64e0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x64f0 */  32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 51, 93, 58,
-/* 0x6500 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6510 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6520 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54,
-/* 0x6530 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76,
-/* 0x6540 */  76, 84, 82, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6550 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,
-/* 0x6560 */ 116,111,107, 51, 50, 46, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x6570 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6580 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6590 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x65a0 */  32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,
-/* 0x65b0 */ 110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95,
-/* 0x65c0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x65d0 */  99,116,111,107, 51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x65e0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x65f0 */  82, 32, 91, 99,116,111,107, 51, 50, 46, 49, 48, 93, 58, 10, 79,
-/* 0x6600 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6610 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6620 */  48, 48, 48, 48, 48, 48, 48,100, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6630 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51,
-/* 0x6640 */  50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6650 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,
-/* 0x6660 */ 111,107, 51, 50, 46, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6670 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6680 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6690 */  48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x66a0 */  32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10,
-/* 0x66b0 */  48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x66c0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51,
-/* 0x66d0 */  50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95,
-/* 0x66e0 */  51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x66f0 */ 102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48,
-/* 0x6700 */  48, 49, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6710 */  32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10,
-/* 0x6720 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6730 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46,
-/* 0x6740 */  51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6750 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6760 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x6770 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6780 */  32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6790 */  48, 48, 57, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x67a0 */  32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48, 10,
-/* 0x67b0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x67c0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46,
-/* 0x67d0 */  52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x67e0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x67f0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x6800 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6810 */  32, 99,116,111,107, 51, 50, 46, 48, 48, 10, 10, 82, 69, 76, 79,
-/* 0x6820 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6830 */  79, 82, 32, 91, 82, 69, 76, 79, 67, 51, 50, 48, 93, 58, 10, 79,
-/* 0x6840 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6850 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6860 */  48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6870 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 82, 69, 76, 79, 67,
-/* 0x6880 */  51, 50, 74, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x6890 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 82, 69, 76,
-/* 0x68a0 */  51, 50, 66, 73, 71, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x68b0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x68c0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x68d0 */  51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x68e0 */  32, 32, 32, 32, 82, 69, 76, 79, 67, 51, 50, 48, 10, 10, 82, 69,
-/* 0x68f0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x6900 */  32, 70, 79, 82, 32, 91, 82, 69, 76, 79, 67, 51, 50, 74, 93, 58,
-/* 0x6910 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6920 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6930 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x6940 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 82, 69, 76,
-/* 0x6950 */  79, 67, 51, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6960 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 84,
-/* 0x6970 */  77, 84, 74, 85, 77, 80, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6980 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6990 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x69a0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x69b0 */  32, 32, 32, 32, 32, 32,111,114,105,103,105,110, 97,108, 95,101,
-/* 0x69c0 */ 110,116,114,121, 10
+/* 0x1a00 */  99,  0,  0,  0,109,  0,  0,  0, 81,  0,  0,  0, 54,  4,  0,  0,
+/* 0x1a10 */   0,  0,  0,  0, 18,  0,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a20 */   9,  0,  0,  0,  2,  0,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */  19,  0,  0,  0, 14,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a40 */  29,  0,  0,  0,  1,  0,  0,  0, 86,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a50 */  38,  0,  0,  0,  5,  0,  0,  0, 87,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */  47,  0,  0,  0, 32,  0,  0,  0, 92,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a70 */  56,  0,  0,  0,  0,  0,  0,  0,124,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a80 */  65,  0,  0,  0,  3,  0,  0,  0,124,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */  74,  0,  0,  0,  2,  0,  0,  0,127,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1aa0 */  83,  0,  0,  0,  6,  0,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ab0 */  92,  0,  0,  0, 11,  0,  0,  0,135,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */ 101,  0,  0,  0,  5,  0,  0,  0,146,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ad0 */ 110,  0,  0,  0,  9,  0,  0,  0,151,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ae0 */ 119,  0,  0,  0, 13,  0,  0,  0,160,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */ 128,  0,  0,  0, 13,  0,  0,  0,173,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b00 */ 137,  0,  0,  0, 15,  0,  0,  0,186,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b10 */ 146,  0,  0,  0, 62,  0,  0,  0,201,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */ 155,  0,  0,  0, 13,  0,  0,  0,  7,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1b30 */ 164,  0,  0,  0, 15,  0,  0,  0, 20,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1b40 */ 173,  0,  0,  0,  2,  0,  0,  0, 35,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1b50 */ 182,  0,  0,  0,  3,  0,  0,  0, 37,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1b60 */ 191,  0,  0,  0,  9,  0,  0,  0, 40,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1b70 */ 200,  0,  0,  0, 12,  0,  0,  0, 49,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */ 209,  0,  0,  0, 25,  0,  0,  0, 61,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1b90 */ 218,  0,  0,  0, 22,  0,  0,  0, 86,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1ba0 */ 227,  0,  0,  0,  0,  0,  0,  0,108,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */ 236,  0,  0,  0,  3,  0,  0,  0,108,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1bc0 */ 245,  0,  0,  0,  2,  0,  0,  0,111,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1bd0 */ 254,  0,  0,  0,  6,  0,  0,  0,113,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1be0 */   7,  1,  0,  0, 11,  0,  0,  0,119,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1bf0 */  16,  1,  0,  0,  5,  0,  0,  0,130,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1c00 */  25,  1,  0,  0,  9,  0,  0,  0,135,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */  34,  1,  0,  0, 13,  0,  0,  0,144,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1c20 */  43,  1,  0,  0, 13,  0,  0,  0,157,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1c30 */  52,  1,  0,  0, 15,  0,  0,  0,170,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1c40 */  61,  1,  0,  0, 82,  0,  0,  0,185,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1c50 */  70,  1,  0,  0, 13,  0,  0,  0, 11,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1c60 */  79,  1,  0,  0, 15,  0,  0,  0, 24,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */  88,  1,  0,  0,  2,  0,  0,  0, 39,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1c80 */  97,  1,  0,  0,  3,  0,  0,  0, 41,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1c90 */ 106,  1,  0,  0,  9,  0,  0,  0, 44,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1ca0 */ 115,  1,  0,  0, 12,  0,  0,  0, 53,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1cb0 */ 124,  1,  0,  0, 25,  0,  0,  0, 65,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1cc0 */ 133,  1,  0,  0, 22,  0,  0,  0, 90,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */ 142,  1,  0,  0,  0,  0,  0,  0,112,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1ce0 */ 151,  1,  0,  0,  3,  0,  0,  0,112,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1cf0 */ 160,  1,  0,  0,  2,  0,  0,  0,115,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */ 169,  1,  0,  0,  6,  0,  0,  0,117,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1d10 */ 178,  1,  0,  0, 11,  0,  0,  0,123,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1d20 */ 187,  1,  0,  0,  5,  0,  0,  0,134,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1d30 */ 196,  1,  0,  0,  9,  0,  0,  0,139,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1d40 */ 205,  1,  0,  0, 13,  0,  0,  0,148,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1d50 */ 214,  1,  0,  0, 13,  0,  0,  0,161,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1d60 */ 223,  1,  0,  0, 15,  0,  0,  0,174,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1d70 */ 232,  1,  0,  0, 95,  0,  0,  0,189,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1d80 */ 241,  1,  0,  0, 13,  0,  0,  0, 28,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1d90 */ 250,  1,  0,  0, 15,  0,  0,  0, 41,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1da0 */   3,  2,  0,  0,  2,  0,  0,  0, 56,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1db0 */  12,  2,  0,  0,  3,  0,  0,  0, 58,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1dc0 */  21,  2,  0,  0,  9,  0,  0,  0, 61,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1dd0 */  30,  2,  0,  0, 12,  0,  0,  0, 70,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1de0 */  39,  2,  0,  0, 25,  0,  0,  0, 82,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1df0 */  48,  2,  0,  0, 22,  0,  0,  0,107,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1e00 */  57,  2,  0,  0,  0,  0,  0,  0,129,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1e10 */  66,  2,  0,  0, 46,  0,  0,  0,129,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1e20 */  77,  2,  0,  0, 72,  0,  0,  0,175,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1e30 */  88,  2,  0,  0,134, 10,  0,  0,247,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1e40 */  99,  2,  0,  0,134, 10,  0,  0,125, 14,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */ 110,  2,  0,  0, 26,  0,  0,  0,  3, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1e60 */ 121,  2,  0,  0,  6,  0,  0,  0, 29, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1e70 */ 130,  2,  0,  0,  1,  0,  0,  0, 35, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1e80 */ 139,  2,  0,  0, 14,  0,  0,  0, 36, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1e90 */ 148,  2,  0,  0,  5,  0,  0,  0, 50, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1ea0 */ 157,  2,  0,  0,  5,  0,  0,  0, 55, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */ 166,  2,  0,  0,  4,  0,  0,  0, 60, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1ec0 */ 175,  2,  0,  0,  2,  0,  0,  0, 64, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1ed0 */ 184,  2,  0,  0,  5,  0,  0,  0, 66, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */ 193,  2,  0,  0, 16,  0,  0,  0, 71, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1ef0 */ 202,  2,  0,  0,  5,  0,  0,  0, 87, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1f00 */ 211,  2,  0,  0,  2,  0,  0,  0, 92, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */ 220,  2,  0,  0,  2,  0,  0,  0, 94, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1f20 */ 229,  2,  0,  0,  4,  0,  0,  0, 96, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1f30 */ 238,  2,  0,  0,  5,  0,  0,  0,100, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */ 247,  2,  0,  0,  2,  0,  0,  0,105, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1f50 */   0,  3,  0,  0,  4,  0,  0,  0,107, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1f60 */   9,  3,  0,  0,  2,  0,  0,  0,111, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */  18,  3,  0,  0,  5,  0,  0,  0,113, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1f80 */  27,  3,  0,  0,  7,  0,  0,  0,118, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1f90 */  36,  3,  0,  0, 10,  0,  0,  0,125, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */  46,  3,  0,  0, 14,  0,  0,  0,135, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1fb0 */  56,  3,  0,  0, 32,  0,  0,  0,149, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1fc0 */  66,  3,  0,  0, 10,  0,  0,  0,181, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */  76,  3,  0,  0,  5,  0,  0,  0,191, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1fe0 */  86,  3,  0,  0,  3,  0,  0,  0,196, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1ff0 */  95,  3,  0,  0, 41,  0,  0,  0,199, 25,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */ 104,  3,  0,  0,  9,  0,  0,  0,240, 25,  0,  0,  0,  0,  0,  0,
+/* 0x2010 */ 113,  3,  0,  0,  2,  0,  0,  0,249, 25,  0,  0,  0,  0,  0,  0,
+/* 0x2020 */ 122,  3,  0,  0,  0,  0,  0,  0,251, 25,  0,  0,  0,  0,  0,  0,
+/* 0x2030 */ 131,  3,  0,  0,  5,  0,  0,  0,251, 25,  0,  0,  0,  0,  0,  0,
+/* 0x2040 */  56,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2050 */  65,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2060 */  83,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2070 */  92,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2080 */ 119,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2090 */ 146,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20a0 */ 191,  0,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20b0 */ 218,  0,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20c0 */ 227,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20d0 */ 236,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20e0 */ 254,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20f0 */   7,  1,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2100 */  34,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2110 */  61,  1,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2120 */ 106,  1,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2130 */ 133,  1,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2140 */ 142,  1,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2150 */ 151,  1,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2160 */ 169,  1,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2170 */ 178,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2180 */ 205,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2190 */ 232,  1,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21a0 */  21,  2,  0,  0, 59,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21b0 */  48,  2,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21c0 */  57,  2,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21d0 */ 139,  2,  0,  0, 71,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21e0 */ 202,  2,  0,  0, 78,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21f0 */ 229,  2,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2200 */  27,  3,  0,  0, 87,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2210 */  36,  3,  0,  0, 88,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2220 */  46,  3,  0,  0, 89,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2230 */  56,  3,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2240 */  76,  3,  0,  0, 92,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2250 */  95,  3,  0,  0, 94,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2260 */ 113,  3,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2270 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2280 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2290 */  19,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22a0 */  29,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22b0 */  38,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22c0 */  47,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22d0 */  74,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22e0 */ 101,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22f0 */ 110,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2300 */ 128,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2310 */ 137,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2320 */ 155,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2330 */ 164,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2340 */ 173,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2350 */ 182,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2360 */ 200,  0,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2370 */ 209,  0,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2380 */ 245,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2390 */  16,  1,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23a0 */  25,  1,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23b0 */  43,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23c0 */  52,  1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23d0 */  70,  1,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23e0 */  79,  1,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23f0 */  88,  1,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2400 */  97,  1,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2410 */ 115,  1,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2420 */ 124,  1,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2430 */ 160,  1,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2440 */ 187,  1,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2450 */ 196,  1,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2460 */ 214,  1,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2470 */ 223,  1,  0,  0, 53,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2480 */ 241,  1,  0,  0, 55,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2490 */ 250,  1,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24a0 */   3,  2,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24b0 */  12,  2,  0,  0, 58,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24c0 */  30,  2,  0,  0, 60,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24d0 */  39,  2,  0,  0, 61,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24e0 */  66,  2,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24f0 */  77,  2,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2500 */  88,  2,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2510 */  99,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2520 */ 110,  2,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2530 */ 121,  2,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2540 */ 130,  2,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2550 */ 148,  2,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2560 */ 157,  2,  0,  0, 73,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2570 */ 166,  2,  0,  0, 74,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2580 */ 175,  2,  0,  0, 75,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2590 */ 184,  2,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25a0 */ 193,  2,  0,  0, 77,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25b0 */ 211,  2,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25c0 */ 220,  2,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25d0 */ 238,  2,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25e0 */ 247,  2,  0,  0, 83,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25f0 */   0,  3,  0,  0, 84,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2600 */   9,  3,  0,  0, 85,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2610 */  18,  3,  0,  0, 86,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2620 */  66,  3,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2630 */  86,  3,  0,  0, 93,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2640 */ 104,  3,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2650 */ 122,  3,  0,  0, 97,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2660 */ 131,  3,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2670 */ 140,  3,  0,  0,100,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x2680 */ 152,  3,  0,  0,100,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x2690 */ 162,  3,  0,  0,100,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x26a0 */ 176,  3,  0,  0,100,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x26b0 */ 194,  3,  0,  0,100,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x26c0 */ 205,  3,  0,  0,100,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x26d0 */ 216,  3,  0,  0,100,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x26e0 */ 232,  3,  0,  0,100,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x26f0 */ 246,  3,  0,  0,100,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x2700 */   1,  4,  0,  0,100,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x2710 */   0,  0,  0,  0,  8,  0,  0,  0, 16,  4,  0,  0, 99,  0,  0,  0,
+/* 0x2720 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
+/* 0x2730 */  16,  4,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2740 */   2,  0,  0,  0,  1,  0,  0,  0, 16,  4,  0,  0,101,  0,  0,  0,
+/* 0x2750 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2760 */  25,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2770 */   7,  0,  0,  0,  1,  0,  0,  0, 36,  4,  0,  0,  3,  0,  0,  0,
+/* 0x2780 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2790 */  36,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27a0 */  11,  0,  0,  0,  1,  0,  0,  0, 36,  4,  0,  0,  1,  0,  0,  0,
+/* 0x27b0 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  3,  0,  0,  0,
+/* 0x27c0 */  36,  4,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27d0 */  14,  0,  0,  0, 12,  0,  0,  0, 36,  4,  0,  0,  4,  0,  0,  0,
+/* 0x27e0 */   0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  3,  0,  0,  0,
+/* 0x27f0 */  36,  4,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2800 */  15,  0,  0,  0, 14,  0,  0,  0, 36,  4,  0,  0,  4,  0,  0,  0,
+/* 0x2810 */   0,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0, 17,  0,  0,  0,
+/* 0x2820 */  36,  4,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2830 */  16,  0,  0,  0, 47,  0,  0,  0, 36,  4,  0,  0,  6,  0,  0,  0,
+/* 0x2840 */   0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0, 12,  0,  0,  0,
+/* 0x2850 */  36,  4,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2860 */  18,  0,  0,  0,  3,  0,  0,  0, 36,  4,  0,  0,  5,  0,  0,  0,
+/* 0x2870 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 14,  0,  0,  0,
+/* 0x2880 */  36,  4,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2890 */  22,  0,  0,  0,  8,  0,  0,  0, 25,  4,  0,  0,  3,  0,  0,  0,
+/* 0x28a0 */   0,  0,  0,  0,  0,  0,  0,  0, 23,  0,  0,  0, 10,  0,  0,  0,
+/* 0x28b0 */  36,  4,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28c0 */  23,  0,  0,  0, 21,  0,  0,  0, 25,  4,  0,  0,  3,  0,  0,  0,
+/* 0x28d0 */   0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0, 18,  0,  0,  0,
+/* 0x28e0 */  25,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28f0 */  26,  0,  0,  0,  1,  0,  0,  0, 36,  4,  0,  0, 11,  0,  0,  0,
+/* 0x2900 */   0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2910 */  36,  4,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2920 */  30,  0,  0,  0,  1,  0,  0,  0, 36,  4,  0,  0,  9,  0,  0,  0,
+/* 0x2930 */   0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2940 */  36,  4,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2950 */  33,  0,  0,  0, 12,  0,  0,  0, 36,  4,  0,  0, 13,  0,  0,  0,
+/* 0x2960 */   0,  0,  0,  0,  0,  0,  0,  0, 34,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2970 */  36,  4,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2980 */  34,  0,  0,  0, 14,  0,  0,  0, 36,  4,  0,  0, 13,  0,  0,  0,
+/* 0x2990 */   0,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0, 15,  0,  0,  0,
+/* 0x29a0 */  36,  4,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29b0 */  35,  0,  0,  0, 33,  0,  0,  0, 36,  4,  0,  0, 16,  0,  0,  0,
+/* 0x29c0 */   0,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0, 67,  0,  0,  0,
+/* 0x29d0 */  36,  4,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29e0 */  36,  0,  0,  0, 12,  0,  0,  0, 36,  4,  0,  0, 13,  0,  0,  0,
+/* 0x29f0 */   0,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2a00 */  36,  4,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a10 */  37,  0,  0,  0, 14,  0,  0,  0, 36,  4,  0,  0, 13,  0,  0,  0,
+/* 0x2a20 */   0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2a30 */  25,  4,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a40 */  42,  0,  0,  0, 10,  0,  0,  0, 36,  4,  0,  0, 15,  0,  0,  0,
+/* 0x2a50 */   0,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0, 21,  0,  0,  0,
+/* 0x2a60 */  25,  4,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a70 */  43,  0,  0,  0, 18,  0,  0,  0, 25,  4,  0,  0, 11,  0,  0,  0,
+/* 0x2a80 */   0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2a90 */  36,  4,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2aa0 */  46,  0,  0,  0,  1,  0,  0,  0, 36,  4,  0,  0, 19,  0,  0,  0,
+/* 0x2ab0 */   0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2ac0 */  36,  4,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ad0 */  50,  0,  0,  0,  3,  0,  0,  0, 36,  4,  0,  0, 18,  0,  0,  0,
+/* 0x2ae0 */   0,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 12,  0,  0,  0,
+/* 0x2af0 */  36,  4,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b00 */  53,  0,  0,  0,  5,  0,  0,  0, 36,  4,  0,  0, 21,  0,  0,  0,
+/* 0x2b10 */   0,  0,  0,  0,  0,  0,  0,  0, 53,  0,  0,  0, 14,  0,  0,  0,
+/* 0x2b20 */  36,  4,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b30 */  54,  0,  0,  0, 15,  0,  0,  0, 36,  4,  0,  0, 20,  0,  0,  0,
+/* 0x2b40 */   0,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0, 30,  0,  0,  0,
+/* 0x2b50 */  36,  4,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b60 */  54,  0,  0,  0, 48,  0,  0,  0, 36,  4,  0,  0, 24,  0,  0,  0,
+/* 0x2b70 */   0,  0,  0,  0,  0,  0,  0,  0, 55,  0,  0,  0, 12,  0,  0,  0,
+/* 0x2b80 */  36,  4,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b90 */  56,  0,  0,  0,  3,  0,  0,  0, 36,  4,  0,  0, 21,  0,  0,  0,
+/* 0x2ba0 */   0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0, 14,  0,  0,  0,
+/* 0x2bb0 */  36,  4,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bc0 */  60,  0,  0,  0,  8,  0,  0,  0, 25,  4,  0,  0, 19,  0,  0,  0,
+/* 0x2bd0 */   0,  0,  0,  0,  0,  0,  0,  0, 61,  0,  0,  0, 10,  0,  0,  0,
+/* 0x2be0 */  36,  4,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bf0 */  61,  0,  0,  0, 21,  0,  0,  0, 25,  4,  0,  0, 19,  0,  0,  0,
+/* 0x2c00 */   0,  0,  0,  0,  0,  0,  0,  0, 62,  0,  0,  0, 18,  0,  0,  0,
+/* 0x2c10 */  25,  4,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c20 */  64,  0,  0,  0,  5,  0,  0,  0, 16,  4,  0,  0,102,  0,  0,  0,
+/* 0x2c30 */   0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0, 20,  0,  0,  0,
+/* 0x2c40 */  16,  4,  0,  0,103,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c50 */  64,  0,  0,  0, 30,  0,  0,  0, 16,  4,  0,  0,104,  0,  0,  0,
+/* 0x2c60 */   0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0, 42,  0,  0,  0,
+/* 0x2c70 */  16,  4,  0,  0,105,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c80 */  71,  0,  0,  0,  1,  0,  0,  0, 16,  4,  0,  0,106,  0,  0,  0,
+/* 0x2c90 */   0,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,  2,  0,  0,  0,
+/* 0x2ca0 */  46,  4,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cb0 */  72,  0,  0,  0,  4,  0,  0,  0, 36,  4,  0,  0, 25,  0,  0,  0,
+/* 0x2cc0 */   0,  0,  0,  0,  0,  0,  0,  0, 77,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2cd0 */  36,  4,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ce0 */  78,  0,  0,  0,  1,  0,  0,  0, 16,  4,  0,  0,106,  0,  0,  0,
+/* 0x2cf0 */   0,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2d00 */  36,  4,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d10 */  82,  0,  0,  0,  2,  0,  0,  0, 46,  4,  0,  0,107,  0,  0,  0,
+/* 0x2d20 */   0,  0,  0,  0,  0,  0,  0,  0, 82,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2d30 */  36,  4,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d40 */  87,  0,  0,  0,  6,  0,  0,  0, 36,  4,  0,  0, 26,  0,  0,  0,
+/* 0x2d50 */   0,  0,  0,  0,  0,  0,  0,  0, 88,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2d60 */  16,  4,  0,  0,106,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d70 */  88,  0,  0,  0,  6,  0,  0,  0, 36,  4,  0,  0, 31,  0,  0,  0,
+/* 0x2d80 */   0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 13,  0,  0,  0,
+/* 0x2d90 */  36,  4,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2da0 */  90,  0,  0,  0,  5,  0,  0,  0, 36,  4,  0,  0, 32,  0,  0,  0,
+/* 0x2db0 */   0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0, 10,  0,  0,  0,
+/* 0x2dc0 */  36,  4,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2dd0 */  90,  0,  0,  0, 14,  0,  0,  0, 46,  4,  0,  0,107,  0,  0,  0,
+/* 0x2de0 */   0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0, 16,  0,  0,  0,
+/* 0x2df0 */  36,  4,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e00 */  91,  0,  0,  0,  4,  0,  0,  0, 36,  4,  0,  0, 32,  0,  0,  0,
+/* 0x2e10 */   0,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,  9,  0,  0,  0,
+/* 0x2e20 */  36,  4,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e30 */  92,  0,  0,  0,  4,  0,  0,  0, 36,  4,  0,  0, 29,  0,  0,  0,
+/* 0x2e40 */   0,  0,  0,  0,  0,  0,  0,  0, 94,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2e50 */  36,  4,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e60 */  95,  0,  0,  0,  3,  0,  0,  0, 36,  4,  0,  0, 33,  0,  0,  0,
+/* 0x2e70 */   0,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2e80 */  36,  4,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e90 */  98,  0,  0,  0,  1,  0,  0,  0, 25,  4,  0,  0,108,  0,  0,  0,
+/* 0x2ea0 */   0,  0,  0,  0,  0,  0,  0,  0, 84, 77, 84, 77, 65, 73, 78, 49,
+/* 0x2eb0 */   0, 84, 77, 84, 77, 65, 73, 78, 49, 65,  0, 84, 77, 84, 77, 65,
+/* 0x2ec0 */  73, 78, 49, 66,  0, 84, 77, 84, 67, 65, 76, 84, 49,  0, 84, 77,
+/* 0x2ed0 */  84, 77, 65, 73, 78, 50,  0, 85, 80, 88, 49, 72, 69, 65, 68,  0,
+/* 0x2ee0 */  84, 77, 84, 67, 85, 84, 80, 79,  0, 78, 50, 66, 83, 77, 65, 49,
+/* 0x2ef0 */  48,  0, 78, 50, 66, 70, 65, 83, 49, 48,  0, 78, 50, 66, 70, 65,
+/* 0x2f00 */  83, 49, 49,  0, 78, 50, 66, 68, 69, 67, 49, 48,  0, 78, 50, 66,
+/* 0x2f10 */  83, 77, 65, 50, 48,  0, 78, 50, 66, 70, 65, 83, 50, 48,  0, 78,
+/* 0x2f20 */  50, 66, 68, 69, 67, 50, 48,  0, 78, 50, 66, 83, 77, 65, 51, 48,
+/* 0x2f30 */   0, 78, 50, 66, 70, 65, 83, 51, 48,  0, 78, 50, 66, 68, 69, 67,
+/* 0x2f40 */  51, 48,  0, 78, 50, 66, 83, 77, 65, 52, 48,  0, 78, 50, 66, 70,
+/* 0x2f50 */  65, 83, 52, 48,  0, 78, 50, 66, 83, 77, 65, 53, 48,  0, 78, 50,
+/* 0x2f60 */  66, 70, 65, 83, 53, 48,  0, 78, 50, 66, 68, 69, 67, 53, 48,  0,
+/* 0x2f70 */  78, 50, 66, 83, 77, 65, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54,
+/* 0x2f80 */  48,  0, 78, 50, 66, 70, 65, 83, 54, 49,  0, 78, 50, 66, 68, 69,
+/* 0x2f90 */  67, 54, 48,  0, 78, 50, 68, 83, 77, 65, 49, 48,  0, 78, 50, 68,
+/* 0x2fa0 */  70, 65, 83, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 49,  0, 78,
+/* 0x2fb0 */  50, 68, 68, 69, 67, 49, 48,  0, 78, 50, 68, 83, 77, 65, 50, 48,
+/* 0x2fc0 */   0, 78, 50, 68, 70, 65, 83, 50, 48,  0, 78, 50, 68, 68, 69, 67,
+/* 0x2fd0 */  50, 48,  0, 78, 50, 68, 83, 77, 65, 51, 48,  0, 78, 50, 68, 70,
+/* 0x2fe0 */  65, 83, 51, 48,  0, 78, 50, 68, 68, 69, 67, 51, 48,  0, 78, 50,
+/* 0x2ff0 */  68, 83, 77, 65, 52, 48,  0, 78, 50, 68, 70, 65, 83, 52, 48,  0,
+/* 0x3000 */  78, 50, 68, 83, 77, 65, 53, 48,  0, 78, 50, 68, 70, 65, 83, 53,
+/* 0x3010 */  48,  0, 78, 50, 68, 68, 69, 67, 53, 48,  0, 78, 50, 68, 83, 77,
+/* 0x3020 */  65, 54, 48,  0, 78, 50, 68, 70, 65, 83, 54, 48,  0, 78, 50, 68,
+/* 0x3030 */  70, 65, 83, 54, 49,  0, 78, 50, 68, 68, 69, 67, 54, 48,  0, 78,
+/* 0x3040 */  50, 69, 83, 77, 65, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 48,
+/* 0x3050 */   0, 78, 50, 69, 70, 65, 83, 49, 49,  0, 78, 50, 69, 68, 69, 67,
+/* 0x3060 */  49, 48,  0, 78, 50, 69, 83, 77, 65, 50, 48,  0, 78, 50, 69, 70,
+/* 0x3070 */  65, 83, 50, 48,  0, 78, 50, 69, 68, 69, 67, 50, 48,  0, 78, 50,
+/* 0x3080 */  69, 83, 77, 65, 51, 48,  0, 78, 50, 69, 70, 65, 83, 51, 48,  0,
+/* 0x3090 */  78, 50, 69, 68, 69, 67, 51, 48,  0, 78, 50, 69, 83, 77, 65, 52,
+/* 0x30a0 */  48,  0, 78, 50, 69, 70, 65, 83, 52, 48,  0, 78, 50, 69, 83, 77,
+/* 0x30b0 */  65, 53, 48,  0, 78, 50, 69, 70, 65, 83, 53, 48,  0, 78, 50, 69,
+/* 0x30c0 */  68, 69, 67, 53, 48,  0, 78, 50, 69, 83, 77, 65, 54, 48,  0, 78,
+/* 0x30d0 */  50, 69, 70, 65, 83, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 49,
+/* 0x30e0 */   0, 78, 50, 69, 68, 69, 67, 54, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x30f0 */  69, 67, 48, 48,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0,
+/* 0x3100 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95,
+/* 0x3110 */  68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
+/* 0x3120 */   0, 84, 77, 84, 77, 65, 73, 78, 53,  0, 84, 77, 84, 67, 65, 76,
+/* 0x3130 */  84, 50,  0, 67, 65, 76, 76, 84, 82, 48, 48,  0, 67, 84, 67, 76,
+/* 0x3140 */  69, 86, 69, 49,  0, 67, 65, 76, 76, 84, 82, 48, 49,  0, 67, 84,
+/* 0x3150 */  66, 83, 72, 82, 48, 49,  0, 67, 84, 66, 82, 79, 82, 48, 49,  0,
+/* 0x3160 */  67, 84, 66, 83, 87, 65, 48, 49,  0, 67, 65, 76, 76, 84, 82, 48,
+/* 0x3170 */  50,  0, 67, 65, 76, 76, 84, 82, 49, 48,  0, 67, 65, 76, 76, 84,
+/* 0x3180 */  82, 69, 56,  0, 67, 65, 76, 76, 84, 82, 69, 57,  0, 67, 65, 76,
+/* 0x3190 */  76, 84, 82, 49, 49,  0, 67, 84, 67, 76, 69, 86, 69, 50,  0, 67,
+/* 0x31a0 */  65, 76, 76, 84, 82, 49, 50,  0, 67, 84, 66, 83, 72, 82, 49, 49,
+/* 0x31b0 */   0, 67, 84, 66, 82, 79, 82, 49, 49,  0, 67, 84, 66, 83, 87, 65,
+/* 0x31c0 */  49, 49,  0, 67, 65, 76, 76, 84, 82, 49, 51,  0, 99,116,111,107,
+/* 0x31d0 */  51, 50, 46, 48, 48,  0, 99,116,111,107, 51, 50, 46, 49, 48,  0,
+/* 0x31e0 */  99,116,111,107, 51, 50, 46, 50, 48,  0, 99,116,111,107, 51, 50,
+/* 0x31f0 */  46, 51, 48,  0, 99,116,111,107, 51, 50, 46, 52, 48,  0, 84, 77,
+/* 0x3200 */  84, 82, 69, 76, 79, 67,  0, 82, 69, 76, 79, 67, 51, 50, 48,  0,
+/* 0x3210 */  82, 69, 76, 51, 50, 66, 73, 71,  0, 82, 69, 76, 79, 67, 51, 50,
+/* 0x3220 */  74,  0, 82, 69, 76, 51, 50, 69, 78, 68,  0, 84, 77, 84, 74, 85,
+/* 0x3230 */  77, 80, 49,  0, 99,111,112,121, 95,115,111,117,114, 99,101,  0,
+/* 0x3240 */  99,111,112,121, 95,100,101,115,116,  0, 98,121,116,101,115, 95,
+/* 0x3250 */ 116,111, 95, 99,111,112,121,  0,108,122,109, 97, 95,115,116, 97,
+/* 0x3260 */  99,107, 95, 97,100,106,117,115,116,  0,108,122,109, 97, 95,117,
+/* 0x3270 */  95,108,101,110,  0,108,122,109, 97, 95, 99, 95,108,101,110,  0,
+/* 0x3280 */ 108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,  0,
+/* 0x3290 */ 102,105,108,116,101,114, 95,108,101,110,103,116,104,  0,102,105,
+/* 0x32a0 */ 108,116,101,114, 95, 99,116,111,  0,111,114,105,103,105,110, 97,
+/* 0x32b0 */ 108, 95,101,110,116,114,121,  0, 82, 95, 51, 56, 54, 95, 51, 50,
+/* 0x32c0 */   0, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,  0, 82, 95, 51, 56,
+/* 0x32d0 */  54, 95, 80, 67, 56,  0, 82, 95, 51, 56, 54, 95, 56,  0,  0, 26,
+/* 0x32e0 */   0,  0, 85, 80, 88, 35, 79, 66, 74, 49
 };
@@ -1,5 +1,5 @@
 /* i386-linux.shlib-init.h
-   created from i386-linux.shlib-init.bin, 38305 (0x95a1) bytes
+   created from i386-linux.shlib-init.bin, 16758 (0x4176) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_LINUX_SHLIB_INIT_SIZE    38305
-#define STUB_I386_LINUX_SHLIB_INIT_ADLER32 0x78a35aed
-#define STUB_I386_LINUX_SHLIB_INIT_CRC32   0xd815a5bb
+#define STUB_I386_LINUX_SHLIB_INIT_SIZE    16758
+#define STUB_I386_LINUX_SHLIB_INIT_ADLER32 0xeb65f75d
+#define STUB_I386_LINUX_SHLIB_INIT_CRC32   0xb6e54b86
 
-unsigned char stub_i386_linux_shlib_init[38305] = {
+unsigned char stub_i386_linux_shlib_init[16758] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  88, 35,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -484,1951 +484,604 @@ unsigned char stub_i386_linux_shlib_init[38305] = {
 /* 0x1bd0 */ 137,203,137, 69,244,137, 85,248,151,150,139,117,236,131,193,  3,
 /* 0x1be0 */ 193,233,  2,243,165, 94, 89, 81, 87,131,193,  3,193,233,  2,243,
 /* 0x1bf0 */ 165,139,117,216,137,125,216,139, 78,252,243,164,150, 87,139, 78,
-/* 0x1c00 */ 252,243,164,195,102,105,108,101, 32,102,111,114,109, 97,116, 32,
-/* 0x1c10 */ 101,108,102, 51, 50, 45,105, 51, 56, 54, 10, 10, 83,101, 99,116,
-/* 0x1c20 */ 105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32,
-/* 0x1c30 */  32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32,
-/* 0x1c40 */  32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32,
-/* 0x1c50 */  32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32,
-/* 0x1c60 */  65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32,
-/* 0x1c70 */  76, 69, 88, 69, 67, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1c80 */  48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1ca0 */  48, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1cb0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x1cc0 */  68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 76, 69, 88, 69, 67, 48,
-/* 0x1cd0 */  48, 57, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ce0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1cf0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51,100, 32, 32,
-/* 0x1d00 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1d10 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 76, 69, 88,
-/* 0x1d20 */  69, 67, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1d30 */  48, 48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1d40 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51,
-/* 0x1d50 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1d60 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32,
-/* 0x1d70 */  78, 50, 66, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1d80 */  48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d90 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1da0 */  48, 48, 52, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1db0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x1dc0 */  68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 78, 50, 66, 70, 65, 83,
-/* 0x1dd0 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x1de0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1df0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 99, 32, 32,
-/* 0x1e00 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1e10 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1e20 */  32, 32, 53, 32, 78, 50, 66, 70, 65, 83, 49, 49, 32, 32, 32, 32,
-/* 0x1e30 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48,
-/* 0x1e40 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1e50 */  48, 48, 48, 48, 48, 48, 52,101, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1e60 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1e70 */  76, 89, 10, 32, 32, 54, 32, 78, 50, 66, 68, 69, 67, 49, 48, 32,
-/* 0x1e80 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48,
-/* 0x1e90 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ea0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 53, 52, 32, 32, 50, 42, 42,
-/* 0x1eb0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1ec0 */  68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 78, 50, 66, 83, 77, 65,
-/* 0x1ed0 */  50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x1ee0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1ef0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 53,102, 32, 32,
-/* 0x1f00 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1f10 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1f20 */  32, 32, 56, 32, 78, 50, 66, 70, 65, 83, 50, 48, 32, 32, 32, 32,
-/* 0x1f30 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48,
-/* 0x1f40 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1f50 */  48, 48, 48, 48, 48, 48, 54, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1f60 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1f70 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 78, 50,
-/* 0x1f80 */  66, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1f90 */  48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1fa0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1fb0 */  54,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1fc0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48,
-/* 0x1fd0 */  32, 78, 50, 66, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1fe0 */  48, 48, 48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ff0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2000 */  48, 48, 48, 55, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2010 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x2020 */  65, 68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 78, 50, 66, 70, 65,
-/* 0x2030 */  83, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2040 */ 102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2050 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 56, 55, 32,
-/* 0x2060 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2070 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2080 */  10, 32, 49, 50, 32, 78, 50, 66, 68, 69, 67, 51, 48, 32, 32, 32,
-/* 0x2090 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 51,101, 32, 32, 48, 48, 48,
-/* 0x20a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x20b0 */  32, 48, 48, 48, 48, 48, 48, 57, 54, 32, 32, 50, 42, 42, 48, 32,
-/* 0x20c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x20d0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 51, 32, 78,
-/* 0x20e0 */  50, 66, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x20f0 */  48, 48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2100 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2110 */  48,100, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2120 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2130 */  79, 78, 76, 89, 10, 32, 49, 52, 32, 78, 50, 66, 70, 65, 83, 52,
-/* 0x2140 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32,
-/* 0x2150 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2160 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,101, 49, 32, 32, 50,
-/* 0x2170 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2180 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2190 */  49, 53, 32, 78, 50, 66, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32,
-/* 0x21a0 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x21b0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x21c0 */  48, 48, 48, 48, 48,102, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x21d0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x21e0 */  89, 10, 32, 49, 54, 32, 78, 50, 66, 70, 65, 83, 53, 48, 32, 32,
-/* 0x21f0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48,
-/* 0x2200 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2210 */  32, 32, 48, 48, 48, 48, 48, 48,102, 50, 32, 32, 50, 42, 42, 48,
-/* 0x2220 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x2230 */  79, 78, 76, 89, 10, 32, 49, 55, 32, 78, 50, 66, 68, 69, 67, 53,
-/* 0x2240 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32,
-/* 0x2250 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2260 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,102, 53, 32, 32, 50,
-/* 0x2270 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2280 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 56, 32, 78, 50, 66, 83,
-/* 0x2290 */  77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x22a0 */  48, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x22b0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,102,101,
-/* 0x22c0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x22d0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x22e0 */  89, 10, 32, 49, 57, 32, 78, 50, 66, 70, 65, 83, 54, 48, 32, 32,
-/* 0x22f0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 57, 32, 32, 48, 48,
-/* 0x2300 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2310 */  32, 32, 48, 48, 48, 48, 48, 49, 48, 97, 32, 32, 50, 42, 42, 48,
-/* 0x2320 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2330 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 48, 32,
-/* 0x2340 */  78, 50, 66, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2350 */  48, 48, 48, 48, 49, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2360 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2370 */  48, 49, 50, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2380 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2390 */  68, 79, 78, 76, 89, 10, 32, 50, 49, 32, 78, 50, 66, 68, 69, 67,
-/* 0x23a0 */  54, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23b0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x23c0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 51, 57, 32, 32,
-/* 0x23d0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x23e0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 50, 32, 78, 50, 68,
-/* 0x23f0 */  83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2400 */  48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2410 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 51,
-/* 0x2420 */  57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2430 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2440 */  76, 89, 10, 32, 50, 51, 32, 78, 50, 68, 70, 65, 83, 49, 48, 32,
-/* 0x2450 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x2460 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2470 */  48, 32, 32, 48, 48, 48, 48, 48, 49, 51, 99, 32, 32, 50, 42, 42,
-/* 0x2480 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2490 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 52,
-/* 0x24a0 */  32, 78, 50, 68, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x24b0 */  48, 48, 48, 48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24c0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x24d0 */  48, 48, 49, 51,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x24e0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x24f0 */  32, 50, 53, 32, 78, 50, 68, 68, 69, 67, 49, 48, 32, 32, 32, 32,
-/* 0x2500 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48,
-/* 0x2510 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2520 */  48, 48, 48, 48, 48, 49, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2530 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2540 */  76, 89, 10, 32, 50, 54, 32, 78, 50, 68, 83, 77, 65, 50, 48, 32,
-/* 0x2550 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x2560 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2570 */  48, 32, 32, 48, 48, 48, 48, 48, 49, 52,102, 32, 32, 50, 42, 42,
-/* 0x2580 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x2590 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 55,
-/* 0x25a0 */  32, 78, 50, 68, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x25b0 */  48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25c0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x25d0 */  48, 48, 49, 53, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x25e0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x25f0 */  65, 68, 79, 78, 76, 89, 10, 32, 50, 56, 32, 78, 50, 68, 68, 69,
-/* 0x2600 */  67, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2610 */ 100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2620 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 53,100, 32,
-/* 0x2630 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2640 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 50, 57, 32, 78, 50,
-/* 0x2650 */  68, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2660 */  48, 48, 48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2670 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x2680 */  54, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2690 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x26a0 */  78, 76, 89, 10, 32, 51, 48, 32, 78, 50, 68, 70, 65, 83, 51, 48,
-/* 0x26b0 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32,
-/* 0x26c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x26d0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 55, 55, 32, 32, 50, 42,
-/* 0x26e0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x26f0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51,
-/* 0x2700 */  49, 32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2710 */  48, 48, 48, 48, 48, 48, 53, 50, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2720 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2730 */  48, 48, 48, 49, 56, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2740 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x2750 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 50, 32, 78, 50, 68, 83,
-/* 0x2760 */  77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2770 */  48,100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2780 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49,100, 56,
-/* 0x2790 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x27a0 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x27b0 */  89, 10, 32, 51, 51, 32, 78, 50, 68, 70, 65, 83, 52, 48, 32, 32,
-/* 0x27c0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48,
-/* 0x27d0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27e0 */  32, 32, 48, 48, 48, 48, 48, 49,101, 53, 32, 32, 50, 42, 42, 48,
-/* 0x27f0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2800 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 52, 32,
-/* 0x2810 */  78, 50, 68, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2820 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2830 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2840 */  48, 49,102, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2850 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2860 */  51, 53, 32, 78, 50, 68, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32,
-/* 0x2870 */  32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2880 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2890 */  48, 48, 48, 48, 49,102, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x28a0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x28b0 */  89, 10, 32, 51, 54, 32, 78, 50, 68, 68, 69, 67, 53, 48, 32, 32,
-/* 0x28c0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48,
-/* 0x28d0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28e0 */  32, 32, 48, 48, 48, 48, 48, 49,102, 57, 32, 32, 50, 42, 42, 48,
-/* 0x28f0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x2900 */  79, 78, 76, 89, 10, 32, 51, 55, 32, 78, 50, 68, 83, 77, 65, 54,
-/* 0x2910 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32,
-/* 0x2920 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2930 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 48, 50, 32, 32, 50,
-/* 0x2940 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2950 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2960 */  51, 56, 32, 78, 50, 68, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32,
-/* 0x2970 */  32, 48, 48, 48, 48, 48, 48, 49, 57, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2980 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2990 */  48, 48, 48, 48, 50, 48,101, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x29a0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x29b0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 51, 57, 32, 78, 50, 68,
-/* 0x29c0 */  70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x29d0 */  48, 49, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x29e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 50,
-/* 0x29f0 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2a00 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2a10 */  76, 89, 10, 32, 52, 48, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32,
-/* 0x2a20 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2a30 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a40 */  48, 32, 32, 48, 48, 48, 48, 48, 50, 51,100, 32, 32, 50, 42, 42,
-/* 0x2a50 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x2a60 */  68, 79, 78, 76, 89, 10, 32, 52, 49, 32, 78, 50, 69, 83, 77, 65,
-/* 0x2a70 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x2a80 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2a90 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 51,100, 32, 32,
-/* 0x2aa0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2ab0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2ac0 */  32, 52, 50, 32, 78, 50, 69, 70, 65, 83, 49, 48, 32, 32, 32, 32,
-/* 0x2ad0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x2ae0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2af0 */  48, 48, 48, 48, 48, 50, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2b00 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x2b10 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 51, 32, 78, 50,
-/* 0x2b20 */  69, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2b30 */  48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2b40 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,
-/* 0x2b50 */  52, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2b60 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 52,
-/* 0x2b70 */  32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2b80 */  48, 48, 48, 48, 48, 48, 98, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b90 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2ba0 */  48, 48, 50, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2bb0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2bc0 */  32, 52, 53, 32, 78, 50, 69, 83, 77, 65, 50, 48, 32, 32, 32, 32,
-/* 0x2bd0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48,
-/* 0x2be0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2bf0 */  48, 48, 48, 48, 48, 50, 53, 51, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2c00 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x2c10 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 52, 54, 32, 78, 50,
-/* 0x2c20 */  69, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x2c30 */  48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2c40 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,
-/* 0x2c50 */  53, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2c60 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2c70 */  78, 76, 89, 10, 32, 52, 55, 32, 78, 50, 69, 68, 69, 67, 50, 48,
-/* 0x2c80 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32, 32,
-/* 0x2c90 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2ca0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 54, 49, 32, 32, 50, 42,
-/* 0x2cb0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x2cc0 */  65, 68, 79, 78, 76, 89, 10, 32, 52, 56, 32, 78, 50, 69, 83, 77,
-/* 0x2cd0 */  65, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ce0 */ 100, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2cf0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 54,101, 32,
-/* 0x2d00 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x2d10 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2d20 */  10, 32, 52, 57, 32, 78, 50, 69, 70, 65, 83, 51, 48, 32, 32, 32,
-/* 0x2d30 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48,
-/* 0x2d40 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2d50 */  32, 48, 48, 48, 48, 48, 50, 55, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2d60 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x2d70 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 48, 32, 78,
-/* 0x2d80 */  50, 69, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2d90 */  48, 48, 48, 53,102, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2da0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2db0 */  50, 56, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2dc0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x2dd0 */  79, 78, 76, 89, 10, 32, 53, 49, 32, 78, 50, 69, 83, 77, 65, 52,
-/* 0x2de0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,100, 32,
-/* 0x2df0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2e00 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,101, 57, 32, 32, 50,
-/* 0x2e10 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2e20 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2e30 */  53, 50, 32, 78, 50, 69, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32,
-/* 0x2e40 */  32, 48, 48, 48, 48, 48, 48, 48,102, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2e50 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2e60 */  48, 48, 48, 48, 50,102, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2e70 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x2e80 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 51, 32, 78, 50, 69,
-/* 0x2e90 */  83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2ea0 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2eb0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 48,
-/* 0x2ec0 */  53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2ed0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 52, 32,
-/* 0x2ee0 */  78, 50, 69, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2ef0 */  48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f00 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2f10 */  48, 51, 48, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2f20 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2f30 */  53, 53, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32,
-/* 0x2f40 */  32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2f50 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2f60 */  48, 48, 48, 48, 51, 48, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2f70 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2f80 */  89, 10, 32, 53, 54, 32, 78, 50, 69, 83, 77, 65, 54, 48, 32, 32,
-/* 0x2f90 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 99, 32, 32, 48, 48,
-/* 0x2fa0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2fb0 */  32, 32, 48, 48, 48, 48, 48, 51, 49, 51, 32, 32, 50, 42, 42, 48,
-/* 0x2fc0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x2fd0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 53, 55, 32,
-/* 0x2fe0 */  78, 50, 69, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x2ff0 */  48, 48, 48, 48, 49, 57, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3000 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3010 */  48, 51, 49,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3020 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x3030 */  68, 79, 78, 76, 89, 10, 32, 53, 56, 32, 78, 50, 69, 70, 65, 83,
-/* 0x3040 */  54, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 54,
-/* 0x3050 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3060 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 51, 56, 32, 32,
-/* 0x3070 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3080 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3090 */  32, 53, 57, 32, 78, 50, 69, 68, 69, 67, 54, 48, 32, 32, 32, 32,
-/* 0x30a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x30b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x30c0 */  48, 48, 48, 48, 48, 51, 52,101, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x30d0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x30e0 */  76, 89, 10, 32, 54, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48,
-/* 0x30f0 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50,101, 32, 32, 48,
-/* 0x3100 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3110 */  48, 32, 32, 48, 48, 48, 48, 48, 51, 52,101, 32, 32, 50, 42, 42,
-/* 0x3120 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x3130 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 49,
-/* 0x3140 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48,
-/* 0x3150 */  48, 48, 48, 48, 48, 52, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3160 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3170 */  48, 48, 51, 55, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3180 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3190 */  32, 54, 50, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32,
-/* 0x31a0 */  32, 32, 48, 48, 48, 48, 48, 97, 56, 54, 32, 32, 48, 48, 48, 48,
-/* 0x31b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x31c0 */  48, 48, 48, 48, 48, 51, 99, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x31d0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x31e0 */  76, 89, 10, 32, 54, 51, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x31f0 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97, 56, 54, 32, 32, 48,
-/* 0x3200 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3210 */  48, 32, 32, 48, 48, 48, 48, 48,101, 52, 97, 32, 32, 50, 42, 42,
-/* 0x3220 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3230 */  68, 79, 78, 76, 89, 10, 32, 54, 52, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3240 */  69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 97,
-/* 0x3250 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3260 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 56,100, 48, 32, 32,
-/* 0x3270 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3280 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 53, 32, 67, 65, 76,
-/* 0x3290 */  76, 84, 82, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x32a0 */  48, 48,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x32b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 56,101,
-/* 0x32c0 */  97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x32d0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x32e0 */  76, 89, 10, 32, 54, 54, 32, 67, 84, 67, 76, 69, 86, 69, 49, 32,
-/* 0x32f0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x3300 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3310 */  48, 32, 32, 48, 48, 48, 48, 49, 56,102, 56, 32, 32, 50, 42, 42,
-/* 0x3320 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x3330 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 54, 55,
-/* 0x3340 */  32, 67, 65, 76, 76, 84, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3350 */  48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3360 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3370 */  48, 49, 56,102,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3380 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3390 */  32, 54, 56, 32, 67, 84, 66, 83, 72, 82, 48, 49, 32, 32, 32, 32,
-/* 0x33a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48,
-/* 0x33b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x33c0 */  48, 48, 48, 48, 49, 57, 48, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x33d0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x33e0 */  76, 89, 10, 32, 54, 57, 32, 67, 84, 66, 82, 79, 82, 48, 49, 32,
-/* 0x33f0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x3400 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3410 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 48, 54, 32, 32, 50, 42, 42,
-/* 0x3420 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3430 */  68, 79, 78, 76, 89, 10, 32, 55, 48, 32, 67, 84, 66, 83, 87, 65,
-/* 0x3440 */  48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x3450 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3460 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 48, 56, 32, 32,
-/* 0x3470 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3480 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 49, 32, 67, 65, 76,
-/* 0x3490 */  76, 84, 82, 48, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x34a0 */  48, 48,101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x34b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 48,
-/* 0x34c0 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x34d0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x34e0 */  76, 89, 10, 32, 55, 50, 32, 67, 65, 76, 76, 84, 82, 49, 48, 32,
-/* 0x34f0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x3500 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3510 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 49, 98, 32, 32, 50, 42, 42,
-/* 0x3520 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x3530 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 51,
-/* 0x3540 */  32, 67, 65, 76, 76, 84, 82, 69, 56, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3550 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3560 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3570 */  48, 49, 57, 50, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3580 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3590 */  32, 55, 52, 32, 67, 65, 76, 76, 84, 82, 69, 57, 32, 32, 32, 32,
-/* 0x35a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x35b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x35c0 */  48, 48, 48, 48, 49, 57, 50, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x35d0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x35e0 */  76, 89, 10, 32, 55, 53, 32, 67, 65, 76, 76, 84, 82, 49, 49, 32,
-/* 0x35f0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48,
-/* 0x3600 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3610 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 50, 52, 32, 32, 50, 42, 42,
-/* 0x3620 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x3630 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 54,
-/* 0x3640 */  32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3650 */  48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3660 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3670 */  48, 49, 57, 50, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3680 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x3690 */  65, 68, 79, 78, 76, 89, 10, 32, 55, 55, 32, 67, 65, 76, 76, 84,
-/* 0x36a0 */  82, 49, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36b0 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x36c0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 50,100, 32,
-/* 0x36d0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x36e0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 56, 32, 67, 84,
-/* 0x36f0 */  66, 83, 72, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3700 */  48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3710 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x3720 */  50,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3730 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 55, 57,
-/* 0x3740 */  32, 67, 84, 66, 82, 79, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3750 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3760 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3770 */  48, 49, 57, 51, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3780 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3790 */  32, 56, 48, 32, 67, 84, 66, 83, 87, 65, 49, 49, 32, 32, 32, 32,
-/* 0x37a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48,
-/* 0x37b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x37c0 */  48, 48, 48, 48, 49, 57, 51, 53, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x37d0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x37e0 */  76, 89, 10, 32, 56, 49, 32, 67, 65, 76, 76, 84, 82, 49, 51, 32,
-/* 0x37f0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x3800 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3810 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 51, 97, 32, 32, 50, 42, 42,
-/* 0x3820 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x3830 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 50,
-/* 0x3840 */  32, 76, 69, 88, 69, 67, 48, 49, 53, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3850 */  48, 48, 48, 48, 48, 49,100, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3860 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3870 */  48, 49, 57, 51,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3880 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3890 */  32, 56, 51, 32, 76, 88, 85, 78, 70, 48, 48, 48, 32, 32, 32, 32,
-/* 0x38a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x38b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x38c0 */  48, 48, 48, 48, 49, 57, 53, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x38d0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x38e0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 52, 32, 76, 88,
-/* 0x38f0 */  85, 78, 70, 48, 48, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3900 */  48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3910 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x3920 */  53,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3930 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 53,
-/* 0x3940 */  32, 77, 82, 85, 66, 89, 84, 69, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3950 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3960 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3970 */  48, 49, 57, 54, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3980 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3990 */  32, 56, 54, 32, 76, 88, 77, 82, 85, 48, 48, 53, 32, 32, 32, 32,
-/* 0x39a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48,
-/* 0x39b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x39c0 */  48, 48, 48, 48, 49, 57, 54, 53, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x39d0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x39e0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 55, 32, 76, 88,
-/* 0x39f0 */  77, 82, 85, 48, 48, 54, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3a00 */  48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3a10 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x3a20 */  54, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3a30 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 56, 56,
-/* 0x3a40 */  32, 76, 88, 77, 82, 85, 48, 48, 55, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3a50 */  48, 48, 48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a60 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3a70 */  48, 49, 57, 55, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3a80 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3a90 */  32, 56, 57, 32, 76, 88, 85, 78, 70, 48, 48, 56, 32, 32, 32, 32,
-/* 0x3aa0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48,
-/* 0x3ab0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3ac0 */  48, 48, 48, 48, 49, 57, 55, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3ad0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3ae0 */  76, 89, 10, 32, 57, 48, 32, 76, 88, 85, 78, 70, 48, 49, 48, 32,
-/* 0x3af0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48,
-/* 0x3b00 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b10 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 55, 99, 32, 32, 50, 42, 42,
-/* 0x3b20 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x3b30 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 49,
-/* 0x3b40 */  32, 76, 88, 74, 67, 67, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3b50 */  48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b60 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3b70 */  48, 49, 57, 56, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3b80 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3b90 */  32, 57, 50, 32, 76, 88, 77, 82, 85, 48, 52, 53, 32, 32, 32, 32,
-/* 0x3ba0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48,
-/* 0x3bb0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3bc0 */  48, 48, 48, 48, 49, 57, 56, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3bd0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3be0 */  76, 89, 10, 32, 57, 51, 32, 76, 88, 77, 82, 85, 48, 52, 54, 32,
-/* 0x3bf0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x3c00 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c10 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 56, 55, 32, 32, 50, 42, 42,
-/* 0x3c20 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3c30 */  68, 79, 78, 76, 89, 10, 32, 57, 52, 32, 76, 88, 74, 67, 67, 48,
-/* 0x3c40 */  50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x3c50 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3c60 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 56, 57, 32, 32,
-/* 0x3c70 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3c80 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3c90 */  32, 57, 53, 32, 76, 88, 74, 67, 67, 48, 50, 49, 32, 32, 32, 32,
-/* 0x3ca0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48,
-/* 0x3cb0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3cc0 */  48, 48, 48, 48, 49, 57, 56, 98, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3cd0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x3ce0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 54, 32, 76, 88,
-/* 0x3cf0 */  74, 67, 67, 48, 50, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x3d00 */  48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3d10 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x3d20 */  57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3d30 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 57, 55,
-/* 0x3d40 */  32, 76, 88, 85, 78, 70, 48, 51, 55, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3d50 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d60 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3d70 */  48, 49, 57, 57, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3d80 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3d90 */  32, 57, 56, 32, 76, 88, 85, 78, 70, 51, 56, 54, 32, 32, 32, 32,
-/* 0x3da0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48,
-/* 0x3db0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3dc0 */  48, 48, 48, 48, 49, 57, 57, 57, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3dd0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3de0 */  76, 89, 10, 32, 57, 57, 32, 76, 88, 85, 78, 70, 51, 56, 55, 32,
-/* 0x3df0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 57, 32, 32, 48,
-/* 0x3e00 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e10 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 57, 97, 32, 32, 50, 42, 42,
-/* 0x3e20 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x3e30 */  68, 79, 78, 76, 89, 10, 49, 48, 48, 32, 76, 88, 85, 78, 70, 51,
-/* 0x3e40 */  56, 56, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x3e50 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x3e60 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 97, 51, 32, 32,
-/* 0x3e70 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x3e80 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x3e90 */  49, 48, 49, 32, 76, 88, 85, 78, 70, 52, 56, 54, 32, 32, 32, 32,
-/* 0x3ea0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48,
-/* 0x3eb0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3ec0 */  48, 48, 48, 48, 49, 57, 97, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3ed0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x3ee0 */  76, 89, 10, 49, 48, 50, 32, 76, 88, 85, 78, 70, 52, 56, 55, 32,
-/* 0x3ef0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48,
-/* 0x3f00 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f10 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 97, 97, 32, 32, 50, 42, 42,
-/* 0x3f20 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x3f30 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 51,
-/* 0x3f40 */  32, 76, 88, 77, 82, 85, 48, 54, 53, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3f50 */  48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f60 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3f70 */  48, 49, 57, 97, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3f80 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x3f90 */  65, 68, 79, 78, 76, 89, 10, 49, 48, 52, 32, 77, 82, 85, 66, 89,
-/* 0x3fa0 */  84, 69, 51, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3fb0 */  50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x3fc0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 98, 49, 32,
-/* 0x3fd0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x3fe0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 53, 32, 77, 82,
-/* 0x3ff0 */  85, 65, 82, 66, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x4000 */  48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4010 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,
-/* 0x4020 */  98, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x4030 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 54,
-/* 0x4040 */  32, 77, 82, 85, 66, 73, 84, 83, 51, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4050 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4060 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4070 */  48, 49, 57, 98, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x4080 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x4090 */  49, 48, 55, 32, 77, 82, 85, 65, 82, 66, 52, 48, 32, 32, 32, 32,
-/* 0x40a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48, 48,
-/* 0x40b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x40c0 */  48, 48, 48, 48, 49, 57, 98, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x40d0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x40e0 */  76, 89, 10, 49, 48, 56, 32, 76, 88, 77, 82, 85, 48, 55, 48, 32,
-/* 0x40f0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 56, 32, 32, 48,
-/* 0x4100 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4110 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 98, 97, 32, 32, 50, 42, 42,
-/* 0x4120 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x4130 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 48, 57,
-/* 0x4140 */  32, 77, 82, 85, 66, 89, 84, 69, 52, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4150 */  48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4160 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4170 */  48, 49, 57, 99, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x4180 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x4190 */  49, 49, 48, 32, 77, 82, 85, 66, 73, 84, 83, 52, 32, 32, 32, 32,
-/* 0x41a0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x41b0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x41c0 */  48, 48, 48, 48, 49, 57, 99, 53, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x41d0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x41e0 */  76, 89, 10, 49, 49, 49, 32, 77, 82, 85, 65, 82, 66, 53, 48, 32,
-/* 0x41f0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32, 48,
-/* 0x4200 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4210 */  48, 32, 32, 48, 48, 48, 48, 49, 57, 99, 55, 32, 32, 50, 42, 42,
-/* 0x4220 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x4230 */  68, 79, 78, 76, 89, 10, 49, 49, 50, 32, 76, 88, 77, 82, 85, 48,
-/* 0x4240 */  56, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x4250 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x4260 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57, 99,100, 32, 32,
-/* 0x4270 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x4280 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 51, 32, 77, 82, 85,
-/* 0x4290 */  66, 89, 84, 69, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x42a0 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x42b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,100,
-/* 0x42c0 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x42d0 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 49, 52, 32,
-/* 0x42e0 */  77, 82, 85, 65, 82, 66, 54, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x42f0 */  48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4300 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x4310 */  49, 57,100, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x4320 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x4330 */  49, 53, 32, 77, 82, 85, 66, 73, 84, 83, 53, 32, 32, 32, 32, 32,
-/* 0x4340 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4350 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4360 */  48, 48, 48, 49, 57,100, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x4370 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x4380 */  89, 10, 49, 49, 54, 32, 77, 82, 85, 65, 82, 66, 55, 48, 32, 32,
-/* 0x4390 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48,
-/* 0x43a0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x43b0 */  32, 32, 48, 48, 48, 48, 49, 57,100, 53, 32, 32, 50, 42, 42, 48,
-/* 0x43c0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x43d0 */  79, 78, 76, 89, 10, 49, 49, 55, 32, 76, 88, 77, 82, 85, 48, 57,
-/* 0x43e0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 98, 32,
-/* 0x43f0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4400 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,100, 57, 32, 32, 50,
-/* 0x4410 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x4420 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x4430 */  49, 56, 32, 77, 82, 85, 66, 89, 84, 69, 54, 32, 32, 32, 32, 32,
-/* 0x4440 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4450 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4460 */  48, 48, 48, 49, 57,101, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x4470 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x4480 */  89, 10, 49, 49, 57, 32, 77, 82, 85, 65, 82, 66, 56, 48, 32, 32,
-/* 0x4490 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48,
-/* 0x44a0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x44b0 */  32, 32, 48, 48, 48, 48, 49, 57,101, 54, 32, 32, 50, 42, 42, 48,
-/* 0x44c0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x44d0 */  79, 78, 76, 89, 10, 49, 50, 48, 32, 77, 82, 85, 66, 73, 84, 83,
-/* 0x44e0 */  54, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x44f0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4500 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,101, 55, 32, 32, 50,
-/* 0x4510 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x4520 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 50, 49, 32, 77, 82, 85, 65,
-/* 0x4530 */  82, 66, 57, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4540 */  48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4550 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 57,101, 57,
-/* 0x4560 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x4570 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 50, 50, 32, 76,
-/* 0x4580 */  88, 77, 82, 85, 49, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x4590 */  48, 48, 48, 49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x45a0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x45b0 */  57,101,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x45c0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 50,
-/* 0x45d0 */  51, 32, 76, 88, 85, 78, 70, 48, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x45e0 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x45f0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4600 */  48, 48, 49, 57,102,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x4610 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4620 */  10, 49, 50, 52, 32, 76, 88, 77, 82, 85, 49, 49, 48, 32, 32, 32,
-/* 0x4630 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48,
-/* 0x4640 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4650 */  32, 48, 48, 48, 48, 49, 97, 48, 50, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4660 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x4670 */  78, 76, 89, 10, 49, 50, 53, 32, 76, 88, 77, 82, 85, 49, 49, 49,
-/* 0x4680 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x4690 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x46a0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 48, 53, 32, 32, 50, 42,
-/* 0x46b0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x46c0 */  65, 68, 79, 78, 76, 89, 10, 49, 50, 54, 32, 76, 88, 85, 78, 70,
-/* 0x46d0 */  48, 52, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x46e0 */  55, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x46f0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 48, 55, 32,
-/* 0x4700 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x4710 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4720 */  10, 49, 50, 55, 32, 76, 88, 85, 78, 70, 48, 52, 50, 32, 32, 32,
-/* 0x4730 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x4740 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4750 */  32, 48, 48, 48, 48, 49, 97, 48,101, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4760 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x4770 */  78, 76, 89, 10, 49, 50, 56, 32, 76, 69, 88, 69, 67, 48, 49, 54,
-/* 0x4780 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32,
-/* 0x4790 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x47a0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 48,101, 32, 32, 50, 42,
-/* 0x47b0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x47c0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 50,
-/* 0x47d0 */  57, 32, 76, 88, 77, 82, 85, 48, 49, 48, 32, 32, 32, 32, 32, 32,
-/* 0x47e0 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x47f0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x4800 */  48, 48, 49, 97, 49, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x4810 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x4820 */  10, 49, 51, 48, 32, 76, 88, 74, 77, 80, 65, 48, 48, 32, 32, 32,
-/* 0x4830 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48,
-/* 0x4840 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4850 */  32, 48, 48, 48, 48, 49, 97, 49, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4860 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x4870 */  78, 76, 89, 10, 49, 51, 49, 32, 76, 88, 67, 65, 76, 76, 66, 48,
-/* 0x4880 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32,
-/* 0x4890 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x48a0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 49, 54, 32, 32, 50, 42,
-/* 0x48b0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x48c0 */  65, 68, 79, 78, 76, 89, 10, 49, 51, 50, 32, 76, 88, 85, 78, 70,
-/* 0x48d0 */  48, 50, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x48e0 */  54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x48f0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 49, 56, 32,
-/* 0x4900 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x4910 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 51, 51, 32, 76, 88,
-/* 0x4920 */  77, 82, 85, 48, 50, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x4930 */  48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4940 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,
-/* 0x4950 */  49,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x4960 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 51, 52,
-/* 0x4970 */  32, 76, 88, 74, 77, 80, 65, 48, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4980 */  48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4990 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x49a0 */  48, 49, 97, 50, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x49b0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x49c0 */  49, 51, 53, 32, 76, 88, 67, 65, 76, 76, 66, 49, 32, 32, 32, 32,
-/* 0x49d0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x49e0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x49f0 */  48, 48, 48, 48, 49, 97, 50, 51, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x4a00 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x4a10 */  76, 89, 10, 49, 51, 54, 32, 77, 82, 85, 66, 73, 84, 83, 49, 32,
-/* 0x4a20 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 49, 32, 32, 48,
-/* 0x4a30 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a40 */  48, 32, 32, 48, 48, 48, 48, 49, 97, 50, 53, 32, 32, 50, 42, 42,
-/* 0x4a50 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x4a60 */  68, 79, 78, 76, 89, 10, 49, 51, 55, 32, 76, 88, 77, 82, 85, 48,
-/* 0x4a70 */  51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x4a80 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x4a90 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 50, 54, 32, 32,
-/* 0x4aa0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x4ab0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 51, 56, 32, 77, 82, 85,
-/* 0x4ac0 */  66, 89, 84, 69, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4ad0 */  48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4ae0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 50,
-/* 0x4af0 */  56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x4b00 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 51, 57, 32,
-/* 0x4b10 */  77, 82, 85, 65, 82, 66, 49, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x4b20 */  48, 48, 48, 48, 48, 49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4b30 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x4b40 */  49, 97, 50, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x4b50 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x4b60 */  52, 48, 32, 76, 88, 77, 82, 85, 48, 52, 48, 32, 32, 32, 32, 32,
-/* 0x4b70 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4b80 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4b90 */  48, 48, 48, 49, 97, 50, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x4ba0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x4bb0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52, 49, 32, 76, 88, 85,
-/* 0x4bc0 */  78, 70, 48, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4bd0 */  48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4be0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 50,
-/* 0x4bf0 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x4c00 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52, 50, 32,
-/* 0x4c10 */  76, 88, 74, 67, 67, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x4c20 */  48, 48, 48, 48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4c30 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x4c40 */  49, 97, 51, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x4c50 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x4c60 */  68, 79, 78, 76, 89, 10, 49, 52, 51, 32, 76, 88, 67, 74, 48, 77,
-/* 0x4c70 */  82, 85, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x4c80 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x4c90 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 51, 98, 32, 32,
-/* 0x4ca0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x4cb0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52, 52, 32, 76, 88, 67,
-/* 0x4cc0 */  74, 49, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4cd0 */  48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4ce0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 51,
-/* 0x4cf0 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x4d00 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52, 53, 32,
-/* 0x4d10 */  76, 88, 67, 65, 76, 74, 77, 80, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x4d20 */  48, 48, 48, 48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4d30 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x4d40 */  49, 97, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x4d50 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x4d60 */  52, 54, 32, 76, 88, 67, 65, 76, 76, 48, 48, 32, 32, 32, 32, 32,
-/* 0x4d70 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4d80 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4d90 */  48, 48, 48, 49, 97, 52, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x4da0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32,
-/* 0x4db0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52, 55, 32, 76, 88, 67,
-/* 0x4dc0 */  65, 76, 76, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x4dd0 */  48, 48, 51, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x4de0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 52,
-/* 0x4df0 */  53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x4e00 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 52, 56, 32,
-/* 0x4e10 */  76, 88, 67, 74, 50, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x4e20 */  48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4e30 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x4e40 */  49, 97, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x4e50 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x4e60 */  68, 79, 78, 76, 89, 10, 49, 52, 57, 32, 76, 88, 67, 74, 52, 77,
-/* 0x4e70 */  82, 85, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x4e80 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x4e90 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 52, 97, 32, 32,
-/* 0x4ea0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x4eb0 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x4ec0 */  49, 53, 48, 32, 76, 88, 67, 74, 54, 77, 82, 85, 32, 32, 32, 32,
-/* 0x4ed0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48,
-/* 0x4ee0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4ef0 */  48, 48, 48, 48, 49, 97, 52, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x4f00 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x4f10 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 53, 49, 32, 76, 88,
-/* 0x4f20 */  67, 74, 55, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x4f30 */  48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4f40 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,
-/* 0x4f50 */  52,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x4f60 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x4f70 */  78, 76, 89, 10, 49, 53, 50, 32, 76, 88, 67, 74, 56, 77, 82, 85,
-/* 0x4f80 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 51, 32, 32,
-/* 0x4f90 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4fa0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 53, 48, 32, 32, 50, 42,
-/* 0x4fb0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x4fc0 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 53,
-/* 0x4fd0 */  51, 32, 76, 88, 85, 78, 70, 48, 51, 52, 32, 32, 32, 32, 32, 32,
-/* 0x4fe0 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x4ff0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x5000 */  48, 48, 49, 97, 53, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x5010 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x5020 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 53, 52, 32, 76, 88, 77, 82,
-/* 0x5030 */  85, 48, 53, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x5040 */  48, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x5050 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 53, 56,
-/* 0x5060 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x5070 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 53, 53, 32, 77,
-/* 0x5080 */  82, 85, 66, 89, 84, 69, 50, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x5090 */  48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x50a0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x50b0 */  97, 53, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x50c0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 53,
-/* 0x50d0 */  54, 32, 77, 82, 85, 66, 73, 84, 83, 50, 32, 32, 32, 32, 32, 32,
-/* 0x50e0 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x50f0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x5100 */  48, 48, 49, 97, 53,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x5110 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x5120 */  10, 49, 53, 55, 32, 77, 82, 85, 65, 82, 66, 50, 48, 32, 32, 32,
-/* 0x5130 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32, 32, 48, 48, 48,
-/* 0x5140 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5150 */  32, 48, 48, 48, 48, 49, 97, 54, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x5160 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x5170 */  78, 76, 89, 10, 49, 53, 56, 32, 76, 88, 77, 82, 85, 48, 53, 55,
-/* 0x5180 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 54, 32, 32,
-/* 0x5190 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x51a0 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 54, 57, 32, 32, 50, 42,
-/* 0x51b0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x51c0 */  65, 68, 79, 78, 76, 89, 10, 49, 53, 57, 32, 76, 88, 77, 82, 85,
-/* 0x51d0 */  48, 53, 56, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x51e0 */  49, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x51f0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 54,102, 32,
-/* 0x5200 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x5210 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 54, 48, 32, 76, 88,
-/* 0x5220 */  85, 78, 70, 48, 51, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x5230 */  48, 48, 48, 54, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x5240 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,
-/* 0x5250 */  55, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x5260 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 54, 49,
-/* 0x5270 */  32, 99,116,111,107, 51, 50, 46, 48, 48, 32, 32, 32, 32, 32, 48,
-/* 0x5280 */  48, 48, 48, 48, 48, 48, 55, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5290 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x52a0 */  48, 49, 97, 55, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x52b0 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x52c0 */  65, 68, 79, 78, 76, 89, 10, 49, 54, 50, 32, 99,116,111,107, 51,
-/* 0x52d0 */  50, 46, 49, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x52e0 */ 101, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x52f0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 55,100, 32,
-/* 0x5300 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x5310 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x5320 */  10, 49, 54, 51, 32, 99,116,111,107, 51, 50, 46, 50, 48, 32, 32,
-/* 0x5330 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 48, 32, 32, 48, 48, 48,
-/* 0x5340 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5350 */  32, 48, 48, 48, 48, 49, 97, 56, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x5360 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x5370 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 54, 52, 32, 99,
-/* 0x5380 */ 116,111,107, 51, 50, 46, 51, 48, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x5390 */  48, 48, 48, 48, 97, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x53a0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x53b0 */  97, 97, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x53c0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x53d0 */  79, 78, 76, 89, 10, 49, 54, 53, 32, 99,116,111,107, 51, 50, 46,
-/* 0x53e0 */  52, 48, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x53f0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x5400 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 98, 53, 32, 32, 50,
-/* 0x5410 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x5420 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49,
-/* 0x5430 */  54, 54, 32, 76, 69, 88, 69, 67, 48, 49, 55, 32, 32, 32, 32, 32,
-/* 0x5440 */  32, 48, 48, 48, 48, 48, 48, 48, 50, 32, 32, 48, 48, 48, 48, 48,
-/* 0x5450 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x5460 */  48, 48, 48, 49, 97, 98, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x5470 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x5480 */  89, 10, 49, 54, 55, 32, 76, 69, 88, 69, 67, 48, 50, 48, 32, 32,
-/* 0x5490 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 52, 56, 32, 32, 48, 48,
-/* 0x54a0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x54b0 */  32, 32, 48, 48, 48, 48, 49, 97, 98, 99, 32, 32, 50, 42, 42, 48,
-/* 0x54c0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x54d0 */  79, 78, 76, 89, 10, 49, 54, 56, 32, 76, 85, 78, 77, 80, 48, 48,
-/* 0x54e0 */  48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x54f0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x5500 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 99, 48, 52, 32, 32, 50,
-/* 0x5510 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x5520 */  69, 65, 68, 79, 78, 76, 89, 10, 49, 54, 57, 32, 76, 85, 78, 77,
-/* 0x5530 */  80, 48, 48, 49, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x5540 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x5550 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 99, 48, 52,
-/* 0x5560 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x5570 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 55, 48, 32, 76,
-/* 0x5580 */  69, 88, 69, 67, 48, 50, 53, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x5590 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x55a0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x55b0 */  99, 48, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x55c0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 49, 55,
-/* 0x55d0 */  49, 32, 76, 69, 88, 69, 67, 68, 89, 78, 32, 32, 32, 32, 32, 32,
-/* 0x55e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x55f0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x5600 */  48, 48, 49, 99, 48, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x5610 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x5620 */  10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48,
-/* 0x5630 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5640 */  78, 50, 66, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5650 */  48, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5660 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x5670 */  65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x5680 */  66, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5690 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48,
-/* 0x56a0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67,
-/* 0x56b0 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x56c0 */  32,100, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48,  9, 48, 48, 48,
-/* 0x56d0 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48,
-/* 0x56e0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x56f0 */  78, 50, 66, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5700 */  48, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5710 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68,
-/* 0x5720 */  69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x5730 */  66, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5740 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 49,
-/* 0x5750 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83,
-/* 0x5760 */  54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5770 */  32,100, 32, 32, 78, 50, 66, 68, 69, 67, 54, 48,  9, 48, 48, 48,
-/* 0x5780 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48,
-/* 0x5790 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x57a0 */  78, 50, 68, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x57b0 */  48, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x57c0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70,
-/* 0x57d0 */  65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x57e0 */  68, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x57f0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48,
-/* 0x5800 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67,
-/* 0x5810 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5820 */  32,100, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48,  9, 48, 48, 48,
-/* 0x5830 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 50, 48, 10, 48,
-/* 0x5840 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5850 */  78, 50, 68, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5860 */  48, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5870 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68,
-/* 0x5880 */  69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x5890 */  68, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x58a0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 49,
-/* 0x58b0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x58c0 */  54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x58d0 */  32,100, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48,  9, 48, 48, 48,
-/* 0x58e0 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48,
-/* 0x58f0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5900 */  78, 50, 69, 83, 77, 65, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5910 */  48, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5920 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x5930 */  65, 83, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x5940 */  69, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5950 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48,
-/* 0x5960 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67,
-/* 0x5970 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5980 */  32,100, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48,  9, 48, 48, 48,
-/* 0x5990 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48,
-/* 0x59a0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x59b0 */  78, 50, 69, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x59c0 */  48, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x59d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68,
-/* 0x59e0 */  69, 67, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x59f0 */  69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5a00 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54, 49,
-/* 0x5a10 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83,
-/* 0x5a20 */  54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5a30 */  32,100, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48,  9, 48, 48, 48,
-/* 0x5a40 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 48,
-/* 0x5a50 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5a60 */  67, 65, 76, 76, 84, 82, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5a70 */  48, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5a80 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76,
-/* 0x5a90 */  84, 82, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65,
-/* 0x5aa0 */  76, 76, 84, 82, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5ab0 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49,
-/* 0x5ac0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x5ad0 */  49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5ae0 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51,  9, 48, 48, 48,
-/* 0x5af0 */  48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 49, 51, 10, 48,
-/* 0x5b00 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5b10 */  76, 88, 85, 78, 70, 48, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5b20 */  48, 32, 76, 88, 85, 78, 70, 48, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5b30 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67,
-/* 0x5b40 */  67, 48, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x5b50 */  74, 67, 67, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5b60 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51, 55,
-/* 0x5b70 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70, 48,
-/* 0x5b80 */  51, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5b90 */  32,100, 32, 32, 76, 88, 77, 82, 85, 48, 55, 48,  9, 48, 48, 48,
-/* 0x5ba0 */  48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 55, 48, 10, 48,
-/* 0x5bb0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5bc0 */  76, 88, 77, 82, 85, 49, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5bd0 */  48, 32, 76, 88, 77, 82, 85, 49, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5be0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78,
-/* 0x5bf0 */  70, 48, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x5c00 */  85, 78, 70, 48, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5c10 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 52, 50,
-/* 0x5c20 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70, 48,
-/* 0x5c30 */  52, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5c40 */  32,100, 32, 32, 76, 88, 77, 82, 85, 48, 51, 48,  9, 48, 48, 48,
-/* 0x5c50 */  48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 51, 48, 10, 48,
-/* 0x5c60 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5c70 */  76, 88, 85, 78, 70, 48, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5c80 */  48, 32, 76, 88, 85, 78, 70, 48, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5c90 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74,
-/* 0x5ca0 */  56, 77, 82, 85,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x5cb0 */  67, 74, 56, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5cc0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52,
-/* 0x5cd0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70, 48,
-/* 0x5ce0 */  51, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5cf0 */  32,100, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48,  9, 48, 48,
-/* 0x5d00 */  48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 48, 48,
-/* 0x5d10 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5d20 */  32, 32, 99,116,111,107, 51, 50, 46, 49, 48,  9, 48, 48, 48, 48,
-/* 0x5d30 */  48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 48,
-/* 0x5d40 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5d50 */  99,116,111,107, 51, 50, 46, 50, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x5d60 */  48, 48, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 48, 48, 48,
-/* 0x5d70 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,
-/* 0x5d80 */ 111,107, 51, 50, 46, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5d90 */  32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5da0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69,
-/* 0x5db0 */  67, 48, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 69,
-/* 0x5dc0 */  88, 69, 67, 48, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5dd0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 48, 48,
-/* 0x5de0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 69, 88, 69, 67, 48,
-/* 0x5df0 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5e00 */  32,100, 32, 32, 76, 69, 88, 69, 67, 48, 48, 57,  9, 48, 48, 48,
-/* 0x5e10 */  48, 48, 48, 48, 48, 32, 76, 69, 88, 69, 67, 48, 48, 57, 10, 48,
-/* 0x5e20 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5e30 */  76, 69, 88, 69, 67, 48, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5e40 */  48, 32, 76, 69, 88, 69, 67, 48, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5e50 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x5e60 */  65, 83, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x5e70 */  66, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5e80 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 50, 48,
-/* 0x5e90 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65,
-/* 0x5ea0 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5eb0 */  32,100, 32, 32, 78, 50, 66, 70, 65, 83, 50, 48,  9, 48, 48, 48,
-/* 0x5ec0 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 50, 48, 10, 48,
-/* 0x5ed0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5ee0 */  78, 50, 66, 83, 77, 65, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5ef0 */  48, 32, 78, 50, 66, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5f00 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x5f10 */  65, 83, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x5f20 */  66, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5f30 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 52, 48,
-/* 0x5f40 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65,
-/* 0x5f50 */  52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5f60 */  32,100, 32, 32, 78, 50, 66, 70, 65, 83, 52, 48,  9, 48, 48, 48,
-/* 0x5f70 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 52, 48, 10, 48,
-/* 0x5f80 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5f90 */  78, 50, 66, 83, 77, 65, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5fa0 */  48, 32, 78, 50, 66, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5fb0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x5fc0 */  65, 83, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x5fd0 */  66, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5fe0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 54, 48,
-/* 0x5ff0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 66, 83, 77, 65,
-/* 0x6000 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6010 */  32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 48,  9, 48, 48, 48,
-/* 0x6020 */  48, 48, 48, 48, 48, 32, 78, 50, 66, 70, 65, 83, 54, 48, 10, 48,
-/* 0x6030 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6040 */  78, 50, 68, 70, 65, 83, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6050 */  48, 32, 78, 50, 68, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6060 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83,
-/* 0x6070 */  77, 65, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x6080 */  68, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6090 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 50, 48,
-/* 0x60a0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x60b0 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x60c0 */  32,100, 32, 32, 78, 50, 68, 83, 77, 65, 51, 48,  9, 48, 48, 48,
-/* 0x60d0 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 51, 48, 10, 48,
-/* 0x60e0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x60f0 */  78, 50, 68, 70, 65, 83, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6100 */  48, 32, 78, 50, 68, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6110 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83,
-/* 0x6120 */  77, 65, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x6130 */  68, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6140 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 52, 48,
-/* 0x6150 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x6160 */  52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6170 */  32,100, 32, 32, 78, 50, 68, 83, 77, 65, 53, 48,  9, 48, 48, 48,
-/* 0x6180 */  48, 48, 48, 48, 48, 32, 78, 50, 68, 83, 77, 65, 53, 48, 10, 48,
-/* 0x6190 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x61a0 */  78, 50, 68, 70, 65, 83, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x61b0 */  48, 32, 78, 50, 68, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x61c0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83,
-/* 0x61d0 */  77, 65, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x61e0 */  68, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x61f0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 48,
-/* 0x6200 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x6210 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6220 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 49, 48,  9, 48, 48, 48,
-/* 0x6230 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 49, 48, 10, 48,
-/* 0x6240 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6250 */  78, 50, 69, 83, 77, 65, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6260 */  48, 32, 78, 50, 69, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6270 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x6280 */  65, 83, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x6290 */  69, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x62a0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 51, 48,
-/* 0x62b0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65,
-/* 0x62c0 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x62d0 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 51, 48,  9, 48, 48, 48,
-/* 0x62e0 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 51, 48, 10, 48,
-/* 0x62f0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6300 */  78, 50, 69, 83, 77, 65, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6310 */  48, 32, 78, 50, 69, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6320 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x6330 */  65, 83, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x6340 */  69, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6350 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 53, 48,
-/* 0x6360 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50, 69, 83, 77, 65,
-/* 0x6370 */  53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6380 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 53, 48,  9, 48, 48, 48,
-/* 0x6390 */  48, 48, 48, 48, 48, 32, 78, 50, 69, 70, 65, 83, 53, 48, 10, 48,
-/* 0x63a0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x63b0 */  78, 50, 69, 83, 77, 65, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x63c0 */  48, 32, 78, 50, 69, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x63d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x63e0 */  65, 83, 54, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 50,
-/* 0x63f0 */  69, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6400 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x6410 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x6420 */  95, 68, 69, 67, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6430 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x6440 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x6450 */  95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6460 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x6470 */  49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x6480 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6490 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x64a0 */  50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x64b0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x64c0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x64d0 */  51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65,
-/* 0x64e0 */  95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x64f0 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86, 69, 49,
-/* 0x6500 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 67, 76, 69, 86,
-/* 0x6510 */  69, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6520 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 49,  9, 48, 48, 48,
-/* 0x6530 */  48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 48, 49, 10, 48,
-/* 0x6540 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6550 */  67, 84, 66, 83, 72, 82, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6560 */  48, 32, 67, 84, 66, 83, 72, 82, 48, 49, 10, 48, 48, 48, 48, 48,
-/* 0x6570 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 82,
-/* 0x6580 */  79, 82, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84,
-/* 0x6590 */  66, 82, 79, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x65a0 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65, 48, 49,
-/* 0x65b0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83, 87, 65,
-/* 0x65c0 */  48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x65d0 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 50,  9, 48, 48, 48,
-/* 0x65e0 */  48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 48, 50, 10, 48,
-/* 0x65f0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6600 */  67, 65, 76, 76, 84, 82, 69, 56,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6610 */  48, 32, 67, 65, 76, 76, 84, 82, 69, 56, 10, 48, 48, 48, 48, 48,
-/* 0x6620 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76,
-/* 0x6630 */  84, 82, 69, 57,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 65,
-/* 0x6640 */  76, 76, 84, 82, 69, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6650 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86, 69, 50,
-/* 0x6660 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 67, 76, 69, 86,
-/* 0x6670 */  69, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6680 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 50,  9, 48, 48, 48,
-/* 0x6690 */  48, 48, 48, 48, 48, 32, 67, 65, 76, 76, 84, 82, 49, 50, 10, 48,
-/* 0x66a0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x66b0 */  67, 84, 66, 83, 72, 82, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x66c0 */  48, 32, 67, 84, 66, 83, 72, 82, 49, 49, 10, 48, 48, 48, 48, 48,
-/* 0x66d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 82,
-/* 0x66e0 */  79, 82, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84,
-/* 0x66f0 */  66, 82, 79, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6700 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65, 49, 49,
-/* 0x6710 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 84, 66, 83, 87, 65,
-/* 0x6720 */  49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6730 */  32,100, 32, 32, 76, 69, 88, 69, 67, 48, 49, 53,  9, 48, 48, 48,
-/* 0x6740 */  48, 48, 48, 48, 48, 32, 76, 69, 88, 69, 67, 48, 49, 53, 10, 48,
-/* 0x6750 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6760 */  76, 88, 85, 78, 70, 48, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6770 */  48, 32, 76, 88, 85, 78, 70, 48, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6780 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78,
-/* 0x6790 */  70, 48, 48, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x67a0 */  85, 78, 70, 48, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x67b0 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 48,
-/* 0x67c0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 89, 84,
-/* 0x67d0 */  69, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x67e0 */  32,100, 32, 32, 76, 88, 77, 82, 85, 48, 48, 53,  9, 48, 48, 48,
-/* 0x67f0 */  48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 48, 53, 10, 48,
-/* 0x6800 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6810 */  76, 88, 77, 82, 85, 48, 48, 54,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6820 */  48, 32, 76, 88, 77, 82, 85, 48, 48, 54, 10, 48, 48, 48, 48, 48,
-/* 0x6830 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82,
-/* 0x6840 */  85, 48, 48, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x6850 */  77, 82, 85, 48, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6860 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 48, 56,
-/* 0x6870 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70, 48,
-/* 0x6880 */  48, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6890 */  32,100, 32, 32, 76, 88, 77, 82, 85, 48, 52, 53,  9, 48, 48, 48,
-/* 0x68a0 */  48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 52, 53, 10, 48,
-/* 0x68b0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x68c0 */  76, 88, 77, 82, 85, 48, 52, 54,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x68d0 */  48, 32, 76, 88, 77, 82, 85, 48, 52, 54, 10, 48, 48, 48, 48, 48,
-/* 0x68e0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67,
-/* 0x68f0 */  67, 48, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x6900 */  74, 67, 67, 48, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6910 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 50, 49,
-/* 0x6920 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 74, 67, 67, 48,
-/* 0x6930 */  50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6940 */  32,100, 32, 32, 76, 88, 74, 67, 67, 48, 50, 51,  9, 48, 48, 48,
-/* 0x6950 */  48, 48, 48, 48, 48, 32, 76, 88, 74, 67, 67, 48, 50, 51, 10, 48,
-/* 0x6960 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6970 */  76, 88, 85, 78, 70, 51, 56, 54,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6980 */  48, 32, 76, 88, 85, 78, 70, 51, 56, 54, 10, 48, 48, 48, 48, 48,
-/* 0x6990 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78,
-/* 0x69a0 */  70, 51, 56, 55,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x69b0 */  85, 78, 70, 51, 56, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x69c0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 51, 56, 56,
-/* 0x69d0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70, 51,
-/* 0x69e0 */  56, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x69f0 */  32,100, 32, 32, 76, 88, 85, 78, 70, 52, 56, 54,  9, 48, 48, 48,
-/* 0x6a00 */  48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70, 52, 56, 54, 10, 48,
-/* 0x6a10 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6a20 */  76, 88, 85, 78, 70, 52, 56, 55,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6a30 */  48, 32, 76, 88, 85, 78, 70, 52, 56, 55, 10, 48, 48, 48, 48, 48,
-/* 0x6a40 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82,
-/* 0x6a50 */  85, 48, 54, 53,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x6a60 */  77, 82, 85, 48, 54, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6a70 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 51,
-/* 0x6a80 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 89, 84,
-/* 0x6a90 */  69, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6aa0 */  32,100, 32, 32, 77, 82, 85, 65, 82, 66, 51, 48,  9, 48, 48, 48,
-/* 0x6ab0 */  48, 48, 48, 48, 48, 32, 77, 82, 85, 65, 82, 66, 51, 48, 10, 48,
-/* 0x6ac0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6ad0 */  77, 82, 85, 66, 73, 84, 83, 51,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6ae0 */  48, 32, 77, 82, 85, 66, 73, 84, 83, 51, 10, 48, 48, 48, 48, 48,
-/* 0x6af0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65,
-/* 0x6b00 */  82, 66, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82,
-/* 0x6b10 */  85, 65, 82, 66, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6b20 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 52,
-/* 0x6b30 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 89, 84,
-/* 0x6b40 */  69, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6b50 */  32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 52,  9, 48, 48, 48,
-/* 0x6b60 */  48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 73, 84, 83, 52, 10, 48,
-/* 0x6b70 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6b80 */  77, 82, 85, 65, 82, 66, 53, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6b90 */  48, 32, 77, 82, 85, 65, 82, 66, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6ba0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82,
-/* 0x6bb0 */  85, 48, 56, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x6bc0 */  77, 82, 85, 48, 56, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6bd0 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 53,
-/* 0x6be0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 89, 84,
-/* 0x6bf0 */  69, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6c00 */  32,100, 32, 32, 77, 82, 85, 65, 82, 66, 54, 48,  9, 48, 48, 48,
-/* 0x6c10 */  48, 48, 48, 48, 48, 32, 77, 82, 85, 65, 82, 66, 54, 48, 10, 48,
-/* 0x6c20 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6c30 */  77, 82, 85, 66, 73, 84, 83, 53,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6c40 */  48, 32, 77, 82, 85, 66, 73, 84, 83, 53, 10, 48, 48, 48, 48, 48,
-/* 0x6c50 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65,
-/* 0x6c60 */  82, 66, 55, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82,
-/* 0x6c70 */  85, 65, 82, 66, 55, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6c80 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 57, 48,
-/* 0x6c90 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48,
-/* 0x6ca0 */  57, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6cb0 */  32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 54,  9, 48, 48, 48,
-/* 0x6cc0 */  48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 89, 84, 69, 54, 10, 48,
-/* 0x6cd0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6ce0 */  77, 82, 85, 65, 82, 66, 56, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6cf0 */  48, 32, 77, 82, 85, 65, 82, 66, 56, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6d00 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66,
-/* 0x6d10 */  73, 84, 83, 54,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82,
-/* 0x6d20 */  85, 66, 73, 84, 83, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6d30 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 57, 48,
-/* 0x6d40 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 65, 82, 66,
-/* 0x6d50 */  57, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6d60 */  32,100, 32, 32, 76, 88, 77, 82, 85, 49, 49, 48,  9, 48, 48, 48,
-/* 0x6d70 */  48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 49, 49, 48, 10, 48,
-/* 0x6d80 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6d90 */  76, 88, 77, 82, 85, 49, 49, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6da0 */  48, 32, 76, 88, 77, 82, 85, 49, 49, 49, 10, 48, 48, 48, 48, 48,
-/* 0x6db0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78,
-/* 0x6dc0 */  70, 48, 52, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x6dd0 */  85, 78, 70, 48, 52, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6de0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 49, 54,
-/* 0x6df0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 69, 88, 69, 67, 48,
-/* 0x6e00 */  49, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6e10 */  32,100, 32, 32, 76, 88, 77, 82, 85, 48, 49, 48,  9, 48, 48, 48,
-/* 0x6e20 */  48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 49, 48, 10, 48,
-/* 0x6e30 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6e40 */  76, 88, 74, 77, 80, 65, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6e50 */  48, 32, 76, 88, 74, 77, 80, 65, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6e60 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65,
-/* 0x6e70 */  76, 76, 66, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x6e80 */  67, 65, 76, 76, 66, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6e90 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 50, 49,
-/* 0x6ea0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70, 48,
-/* 0x6eb0 */  50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6ec0 */  32,100, 32, 32, 76, 88, 77, 82, 85, 48, 50, 50,  9, 48, 48, 48,
-/* 0x6ed0 */  48, 48, 48, 48, 48, 32, 76, 88, 77, 82, 85, 48, 50, 50, 10, 48,
-/* 0x6ee0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6ef0 */  76, 88, 74, 77, 80, 65, 48, 49,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6f00 */  48, 32, 76, 88, 74, 77, 80, 65, 48, 49, 10, 48, 48, 48, 48, 48,
-/* 0x6f10 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65,
-/* 0x6f20 */  76, 76, 66, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x6f30 */  67, 65, 76, 76, 66, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6f40 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 49,
-/* 0x6f50 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 73, 84,
-/* 0x6f60 */  83, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x6f70 */  32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 49,  9, 48, 48, 48,
-/* 0x6f80 */  48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 89, 84, 69, 49, 10, 48,
-/* 0x6f90 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6fa0 */  77, 82, 85, 65, 82, 66, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6fb0 */  48, 32, 77, 82, 85, 65, 82, 66, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6fc0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82,
-/* 0x6fd0 */  85, 48, 52, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x6fe0 */  77, 82, 85, 48, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6ff0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 48, 48,
-/* 0x7000 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 74, 67, 67, 48,
-/* 0x7010 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x7020 */  32,100, 32, 32, 76, 88, 67, 74, 48, 77, 82, 85,  9, 48, 48, 48,
-/* 0x7030 */  48, 48, 48, 48, 48, 32, 76, 88, 67, 74, 48, 77, 82, 85, 10, 48,
-/* 0x7040 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x7050 */  76, 88, 67, 74, 49, 77, 82, 85,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7060 */  48, 32, 76, 88, 67, 74, 49, 77, 82, 85, 10, 48, 48, 48, 48, 48,
-/* 0x7070 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65,
-/* 0x7080 */  76, 74, 77, 80,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x7090 */  67, 65, 76, 74, 77, 80, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x70a0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 48, 48,
-/* 0x70b0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 65, 76, 76,
-/* 0x70c0 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x70d0 */  32,100, 32, 32, 76, 88, 67, 65, 76, 76, 48, 49,  9, 48, 48, 48,
-/* 0x70e0 */  48, 48, 48, 48, 48, 32, 76, 88, 67, 65, 76, 76, 48, 49, 10, 48,
-/* 0x70f0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x7100 */  76, 88, 67, 74, 50, 77, 82, 85,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7110 */  48, 32, 76, 88, 67, 74, 50, 77, 82, 85, 10, 48, 48, 48, 48, 48,
-/* 0x7120 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74,
-/* 0x7130 */  52, 77, 82, 85,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x7140 */  67, 74, 52, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7150 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 54, 77, 82, 85,
-/* 0x7160 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 67, 74, 54, 77,
-/* 0x7170 */  82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x7180 */  32,100, 32, 32, 76, 88, 67, 74, 55, 77, 82, 85,  9, 48, 48, 48,
-/* 0x7190 */  48, 48, 48, 48, 48, 32, 76, 88, 67, 74, 55, 77, 82, 85, 10, 48,
-/* 0x71a0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x71b0 */  76, 88, 77, 82, 85, 48, 53, 53,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x71c0 */  48, 32, 76, 88, 77, 82, 85, 48, 53, 53, 10, 48, 48, 48, 48, 48,
-/* 0x71d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66,
-/* 0x71e0 */  89, 84, 69, 50,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82,
-/* 0x71f0 */  85, 66, 89, 84, 69, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7200 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 50,
-/* 0x7210 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 77, 82, 85, 66, 73, 84,
-/* 0x7220 */  83, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x7230 */  32,100, 32, 32, 77, 82, 85, 65, 82, 66, 50, 48,  9, 48, 48, 48,
-/* 0x7240 */  48, 48, 48, 48, 48, 32, 77, 82, 85, 65, 82, 66, 50, 48, 10, 48,
-/* 0x7250 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x7260 */  76, 88, 77, 82, 85, 48, 53, 55,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7270 */  48, 32, 76, 88, 77, 82, 85, 48, 53, 55, 10, 48, 48, 48, 48, 48,
-/* 0x7280 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82,
-/* 0x7290 */  85, 48, 53, 56,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88,
-/* 0x72a0 */  77, 82, 85, 48, 53, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x72b0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51, 53,
-/* 0x72c0 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 88, 85, 78, 70, 48,
-/* 0x72d0 */  51, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x72e0 */  32,100, 32, 32, 99,116,111,107, 51, 50, 46, 51, 48,  9, 48, 48,
-/* 0x72f0 */  48, 48, 48, 48, 48, 48, 32, 99,116,111,107, 51, 50, 46, 51, 48,
-/* 0x7300 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x7310 */  32, 32, 76, 69, 88, 69, 67, 48, 49, 55,  9, 48, 48, 48, 48, 48,
-/* 0x7320 */  48, 48, 48, 32, 76, 69, 88, 69, 67, 48, 49, 55, 10, 48, 48, 48,
-/* 0x7330 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 85,
-/* 0x7340 */  78, 77, 80, 48, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7350 */  76, 85, 78, 77, 80, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7360 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 85, 78, 77, 80, 48,
-/* 0x7370 */  48, 49,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 85, 78, 77,
-/* 0x7380 */  80, 48, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x7390 */  32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 50, 53,  9, 48,
-/* 0x73a0 */  48, 48, 48, 48, 48, 48, 48, 32, 76, 69, 88, 69, 67, 48, 50, 53,
-/* 0x73b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x73c0 */  32, 32, 76, 69, 88, 69, 67, 68, 89, 78,  9, 48, 48, 48, 48, 48,
-/* 0x73d0 */  48, 48, 48, 32, 76, 69, 88, 69, 67, 68, 89, 78, 10, 48, 48, 48,
-/* 0x73e0 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 76, 69,
-/* 0x73f0 */  88, 69, 67, 48, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7400 */  95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x7410 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48,
-/* 0x7420 */  48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95,115,116, 97, 99,
-/* 0x7430 */ 107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7440 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9,
-/* 0x7450 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108,122,109, 97, 95,117, 95,
-/* 0x7460 */ 108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x7470 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48,
-/* 0x7480 */  48, 48, 48, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48,
-/* 0x7490 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x74a0 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x74b0 */ 122,109, 97, 95,112,114,111,112,101,114,116,105,101,115, 10, 48,
-/* 0x74c0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x74d0 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,
-/* 0x74e0 */ 105,108,116,101,114, 95,108,101,110,103,116,104, 10, 48, 48, 48,
-/* 0x74f0 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x7500 */  78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,
-/* 0x7510 */ 116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7520 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48,
-/* 0x7530 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 77, 82, 85, 10, 10, 82, 69,
-/* 0x7540 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x7550 */  32, 70, 79, 82, 32, 91, 76, 69, 88, 69, 67, 48, 48, 48, 93, 58,
-/* 0x7560 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x7570 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x7580 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54,
-/* 0x7590 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 69, 88,
-/* 0x75a0 */  69, 67, 48, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x75b0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x75c0 */  50, 66, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x75d0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x75e0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x75f0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x7600 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10,
-/* 0x7610 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x7620 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 49, 48,
-/* 0x7630 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x7640 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x7650 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x7660 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x7670 */  50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x7680 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x7690 */  91, 78, 50, 66, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x76a0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x76b0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x76c0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x76d0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 83, 77, 65, 49, 48,
-/* 0x76e0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x76f0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83,
-/* 0x7700 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x7710 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7720 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x7730 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7740 */  32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7750 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x7760 */  82, 32, 91, 78, 50, 66, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70,
-/* 0x7770 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x7780 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x7790 */  48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x77a0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x77b0 */  50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x77c0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70,
-/* 0x77d0 */  65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x77e0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x77f0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x7800 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x7810 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x7820 */  48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x7830 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10,
-/* 0x7840 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x7850 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 68, 69, 67, 51,
-/* 0x7860 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x7870 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x7880 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 49, 32, 82, 95,
-/* 0x7890 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x78a0 */  78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 50,
-/* 0x78b0 */ 102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x78c0 */  32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 10, 82, 69,
-/* 0x78d0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x78e0 */  32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 52, 48, 93, 58,
-/* 0x78f0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x7900 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x7910 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54,
-/* 0x7920 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x7930 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7940 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x7950 */  50, 66, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x7960 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7970 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x7980 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x7990 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 48,
-/* 0x79a0 */  48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x79b0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x79c0 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x79d0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83,
-/* 0x79e0 */  77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x79f0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7a00 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56,
-/* 0x7a10 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x7a20 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x7a30 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x7a40 */  70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 48, 93, 58, 10,
-/* 0x7a50 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x7a60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x7a70 */  10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7a80 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 70,
-/* 0x7a90 */  65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95,
-/* 0x7aa0 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7ab0 */  78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x7ac0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x7ad0 */  32, 91, 78, 50, 66, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70,
-/* 0x7ae0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7af0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7b00 */  48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x7b10 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49,
-/* 0x7b20 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x7b30 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77,
-/* 0x7b40 */  65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x7b50 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7b60 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x7b70 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7b80 */  32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x7b90 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x7ba0 */  79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 49, 48, 93, 58, 10, 79,
-/* 0x7bb0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x7bc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x7bd0 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x7be0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69,
-/* 0x7bf0 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x7c00 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68,
-/* 0x7c10 */  83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x7c20 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7c30 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7c40 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7c50 */  32, 32, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 10, 82, 69,
-/* 0x7c60 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x7c70 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 50, 48, 93, 58,
-/* 0x7c80 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x7c90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x7ca0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54,
-/* 0x7cb0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x7cc0 */  70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7cd0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x7ce0 */  50, 68, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x7cf0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7d00 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x7d10 */  48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x7d20 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10,
-/* 0x7d30 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x7d40 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 51, 48,
-/* 0x7d50 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x7d60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x7d70 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51,
-/* 0x7d80 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x7d90 */  50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101,
-/* 0x7da0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x7db0 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x7dc0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x7dd0 */  70, 79, 82, 32, 91, 78, 50, 68, 68, 69, 67, 51, 48, 93, 58, 10,
-/* 0x7de0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x7df0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x7e00 */  10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7e10 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x7e20 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 50, 49, 32, 82, 95,
-/* 0x7e30 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7e40 */  78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 52,
-/* 0x7e50 */  51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7e60 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 10, 82, 69,
-/* 0x7e70 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x7e80 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 52, 48, 93, 58,
-/* 0x7e90 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x7ea0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x7eb0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54,
-/* 0x7ec0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x7ed0 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7ee0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x7ef0 */  50, 68, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x7f00 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7f10 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x7f20 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x7f30 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48,
-/* 0x7f40 */  48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x7f50 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x7f60 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x7f70 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83,
-/* 0x7f80 */  77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x7f90 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7fa0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56,
-/* 0x7fb0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x7fc0 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x7fd0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x7fe0 */  70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 48, 93, 58, 10,
-/* 0x7ff0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x8000 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x8010 */  10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95,
-/* 0x8020 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 70,
-/* 0x8030 */  65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95,
-/* 0x8040 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8050 */  78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x8060 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x8070 */  32, 91, 78, 50, 68, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70,
-/* 0x8080 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x8090 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x80a0 */  48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x80b0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49,
-/* 0x80c0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x80d0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77,
-/* 0x80e0 */  65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x80f0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8100 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x8110 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8120 */  32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x8130 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x8140 */  79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 49, 48, 93, 58, 10, 79,
-/* 0x8150 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x8160 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x8170 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x8180 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69,
-/* 0x8190 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x81a0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69,
-/* 0x81b0 */  83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x81c0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x81d0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x81e0 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x81f0 */  32, 32, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 10, 82, 69,
-/* 0x8200 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x8210 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 50, 48, 93, 58,
-/* 0x8220 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x8230 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x8240 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54,
-/* 0x8250 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x8260 */  70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x8270 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x8280 */  50, 69, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x8290 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x82a0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x82b0 */  48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x82c0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10,
-/* 0x82d0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x82e0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 51, 48,
-/* 0x82f0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x8300 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x8310 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51,
-/* 0x8320 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x8330 */  50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101,
-/* 0x8340 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x8350 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x8360 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x8370 */  70, 79, 82, 32, 91, 78, 50, 69, 68, 69, 67, 51, 48, 93, 58, 10,
-/* 0x8380 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x8390 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x83a0 */  10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95,
-/* 0x83b0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x83c0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95,
-/* 0x83d0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x83e0 */  78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 51,
-/* 0x83f0 */  48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x8400 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 10, 82, 69,
-/* 0x8410 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x8420 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 52, 48, 93, 58,
-/* 0x8430 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x8440 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x8450 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54,
-/* 0x8460 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x8470 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x8480 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x8490 */  50, 69, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x84a0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x84b0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x84c0 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x84d0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48,
-/* 0x84e0 */  48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x84f0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x8500 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x8510 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83,
-/* 0x8520 */  77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x8530 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8540 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56,
-/* 0x8550 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x8560 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x8570 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x8580 */  70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 48, 93, 58, 10,
-/* 0x8590 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x85a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x85b0 */  10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95,
-/* 0x85c0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 70,
-/* 0x85d0 */  65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95,
-/* 0x85e0 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x85f0 */  78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x8600 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x8610 */  32, 91, 78, 50, 69, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70,
-/* 0x8620 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x8630 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x8640 */  48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x8650 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49,
-/* 0x8660 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x8670 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95,
-/* 0x8680 */  68, 69, 67, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x8690 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x86a0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x86b0 */  53, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x86c0 */  32, 32, 32, 32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,
-/* 0x86d0 */ 100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 49, 52, 32, 82,
-/* 0x86e0 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x86f0 */  32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48,
-/* 0x8700 */  48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x8710 */  32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95, 99, 95,108,101,
-/* 0x8720 */ 110, 10, 48, 48, 48, 48, 48, 48, 50, 97, 32, 82, 95, 51, 56, 54,
-/* 0x8730 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109,
-/* 0x8740 */  97, 95,112,114,111,112,101,114,116,105,101,115, 10, 10, 82, 69,
-/* 0x8750 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x8760 */  32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 48, 48, 93, 58,
-/* 0x8770 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x8780 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x8790 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x87a0 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,
-/* 0x87b0 */ 116,101,114, 95,108,101,110,103,116,104, 10, 10, 82, 69, 76, 79,
-/* 0x87c0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x87d0 */  79, 82, 32, 91, 67, 84, 67, 76, 69, 86, 69, 49, 93, 58, 10, 79,
-/* 0x87e0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x87f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x8800 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56,
-/* 0x8810 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,
-/* 0x8820 */ 114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x8830 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8840 */  32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x8850 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x8860 */  82, 32, 91, 67, 65, 76, 76, 84, 82, 48, 50, 93, 58, 10, 79, 70,
-/* 0x8870 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x8880 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x8890 */  48, 48, 48, 48, 48, 48,100, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x88a0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x88b0 */  48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x88c0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76,
-/* 0x88d0 */  84, 82, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x88e0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x88f0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x8900 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8910 */  32, 32, 32,102,105,108,116,101,114, 95,108,101,110,103,116,104,
-/* 0x8920 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x8930 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82,
-/* 0x8940 */  49, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x8950 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8960 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x8970 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8980 */  32, 67, 65, 76, 76, 84, 82, 49, 51, 10, 10, 82, 69, 76, 79, 67,
-/* 0x8990 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x89a0 */  82, 32, 91, 67, 84, 67, 76, 69, 86, 69, 50, 93, 58, 10, 79, 70,
-/* 0x89b0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x89c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x89d0 */  48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32,
-/* 0x89e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114,
-/* 0x89f0 */  95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95,
-/* 0x8a00 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8a10 */  67, 65, 76, 76, 84, 82, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x8a20 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x8a30 */  32, 91, 67, 65, 76, 76, 84, 82, 49, 51, 93, 58, 10, 79, 70, 70,
-/* 0x8a40 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x8a50 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x8a60 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x8a70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x8a80 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x8a90 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70,
-/* 0x8aa0 */  48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x8ab0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8ac0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x8ad0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8ae0 */  32, 32, 76, 88, 85, 78, 70, 48, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x8af0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x8b00 */  79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 48, 53, 93, 58, 10, 79,
-/* 0x8b10 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x8b20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x8b30 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x8b40 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 77, 82, 85, 10,
-/* 0x8b50 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x8b60 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 49,
-/* 0x8b70 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x8b80 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x8b90 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x8ba0 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8bb0 */  76, 88, 85, 78, 70, 48, 52, 50, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x8bc0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x8bd0 */  32, 91, 76, 88, 74, 67, 67, 48, 50, 48, 93, 58, 10, 79, 70, 70,
-/* 0x8be0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x8bf0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x8c00 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x8c10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51,
-/* 0x8c20 */  52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x8c30 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 74, 67, 67,
-/* 0x8c40 */  48, 50, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x8c50 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8c60 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x8c70 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8c80 */  32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79,
-/* 0x8c90 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x8ca0 */  79, 82, 32, 91, 76, 88, 85, 78, 70, 51, 56, 56, 93, 58, 10, 79,
-/* 0x8cb0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x8cc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x8cd0 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x8ce0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70,
-/* 0x8cf0 */  48, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x8d00 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85,
-/* 0x8d10 */  78, 70, 52, 56, 55, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x8d20 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8d30 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x8d40 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x8d50 */  32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10, 82, 69,
-/* 0x8d60 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x8d70 */  32, 70, 79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 54, 53, 93, 58,
-/* 0x8d80 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x8d90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x8da0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54,
-/* 0x8db0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 77,
-/* 0x8dc0 */  82, 85, 48, 55, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x8dd0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x8de0 */  88, 77, 82, 85, 48, 55, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x8df0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8e00 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x8e10 */  48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x8e20 */  32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10,
-/* 0x8e30 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x8e40 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 57, 48,
-/* 0x8e50 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x8e60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x8e70 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51,
-/* 0x8e80 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x8e90 */  88, 77, 82, 85, 49, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x8ea0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x8eb0 */  91, 76, 88, 85, 78, 70, 48, 52, 49, 93, 58, 10, 79, 70, 70, 83,
-/* 0x8ec0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8ed0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x8ee0 */  48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x8ef0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52,
-/* 0x8f00 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x8f10 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 69, 88, 69, 67, 48,
-/* 0x8f20 */  49, 54, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x8f30 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8f40 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x8f50 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8f60 */  32, 76, 88, 85, 78, 70, 48, 52, 50, 10, 10, 82, 69, 76, 79, 67,
-/* 0x8f70 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x8f80 */  82, 32, 91, 76, 88, 77, 82, 85, 48, 52, 48, 93, 58, 10, 79, 70,
-/* 0x8f90 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x8fa0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x8fb0 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x8fc0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82, 85, 48,
-/* 0x8fd0 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x8fe0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 74, 67,
-/* 0x8ff0 */  67, 48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x9000 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9010 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 55,
-/* 0x9020 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x9030 */  32, 32, 32, 76, 88, 74, 67, 67, 48, 49, 48, 10, 10, 82, 69, 76,
-/* 0x9040 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x9050 */  70, 79, 82, 32, 91, 76, 88, 67, 65, 76, 76, 48, 48, 93, 58, 10,
-/* 0x9060 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x9070 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x9080 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x9090 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78,
-/* 0x90a0 */  70, 48, 51, 55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x90b0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88,
-/* 0x90c0 */  67, 74, 50, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x90d0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x90e0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x90f0 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x9100 */  32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 10, 82,
-/* 0x9110 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x9120 */  83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 52, 77, 82, 85, 93,
-/* 0x9130 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x9140 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x9150 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x9160 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88,
-/* 0x9170 */  85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x9180 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x9190 */  76, 88, 67, 74, 54, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x91a0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x91b0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x91c0 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x91d0 */  32, 32, 32, 32, 32, 32, 32, 76, 88, 67, 74, 56, 77, 82, 85, 10,
-/* 0x91e0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x91f0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 55, 77, 82,
-/* 0x9200 */  85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x9210 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x9220 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x9230 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9240 */  76, 88, 67, 74, 56, 77, 82, 85, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x9250 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x9260 */  32, 91, 76, 88, 67, 74, 56, 77, 82, 85, 93, 58, 10, 79, 70, 70,
-/* 0x9270 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x9280 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x9290 */  48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x92a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51,
-/* 0x92b0 */  55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x92c0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70,
-/* 0x92d0 */  48, 51, 52, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x92e0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x92f0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x9300 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9310 */  32, 32, 76, 88, 85, 78, 70, 48, 51, 48, 10, 10, 82, 69, 76, 79,
-/* 0x9320 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x9330 */  79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 48, 48, 93, 58, 10,
-/* 0x9340 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x9350 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x9360 */  10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95,
-/* 0x9370 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x9380 */  51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x9390 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,
-/* 0x93a0 */ 116,111,107, 51, 50, 46, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x93b0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x93c0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x93d0 */  48, 48, 48,100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x93e0 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48,
-/* 0x93f0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x9400 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50,
-/* 0x9410 */  46, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x9420 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9430 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x9440 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9450 */  32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48,
-/* 0x9460 */  48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x9470 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x9480 */  10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 51, 56, 54, 95,
-/* 0x9490 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x94a0 */  51, 50, 46, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x94b0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,
-/* 0x94c0 */ 116,111,107, 51, 50, 46, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x94d0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x94e0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x94f0 */  48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x9500 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x9510 */  10, 48, 48, 48, 48, 48, 48, 48, 57, 32, 82, 95, 51, 56, 54, 95,
-/* 0x9520 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x9530 */  51, 50, 46, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x9540 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,
-/* 0x9550 */ 116,111,107, 51, 50, 46, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x9560 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x9570 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x9580 */  48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x9590 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48,
-/* 0x95a0 */  10
+/* 0x1c00 */ 252,243,164,195,172,  0,  0,  0,180,  0,  0,  0, 93,  0,  0,  0,
+/* 0x1c10 */ 158,  6,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 52,  0,  0,  0,
+/* 0x1c20 */   0,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 61,  0,  0,  0,
+/* 0x1c30 */   0,  0,  0,  0, 18,  0,  0,  0, 12,  0,  0,  0, 61,  0,  0,  0,
+/* 0x1c40 */   0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0, 73,  0,  0,  0,
+/* 0x1c50 */   0,  0,  0,  0, 36,  0,  0,  0,  2,  0,  0,  0, 76,  0,  0,  0,
+/* 0x1c60 */   0,  0,  0,  0, 45,  0,  0,  0,  6,  0,  0,  0, 78,  0,  0,  0,
+/* 0x1c70 */   0,  0,  0,  0, 54,  0,  0,  0, 11,  0,  0,  0, 84,  0,  0,  0,
+/* 0x1c80 */   0,  0,  0,  0, 63,  0,  0,  0,  5,  0,  0,  0, 95,  0,  0,  0,
+/* 0x1c90 */   0,  0,  0,  0, 72,  0,  0,  0,  9,  0,  0,  0,100,  0,  0,  0,
+/* 0x1ca0 */   0,  0,  0,  0, 81,  0,  0,  0, 13,  0,  0,  0,109,  0,  0,  0,
+/* 0x1cb0 */   0,  0,  0,  0, 90,  0,  0,  0, 13,  0,  0,  0,122,  0,  0,  0,
+/* 0x1cc0 */   0,  0,  0,  0, 99,  0,  0,  0, 15,  0,  0,  0,135,  0,  0,  0,
+/* 0x1cd0 */   0,  0,  0,  0,108,  0,  0,  0, 62,  0,  0,  0,150,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  0,  0,117,  0,  0,  0, 13,  0,  0,  0,212,  0,  0,  0,
+/* 0x1cf0 */   0,  0,  0,  0,126,  0,  0,  0, 15,  0,  0,  0,225,  0,  0,  0,
+/* 0x1d00 */   0,  0,  0,  0,135,  0,  0,  0,  2,  0,  0,  0,240,  0,  0,  0,
+/* 0x1d10 */   0,  0,  0,  0,144,  0,  0,  0,  3,  0,  0,  0,242,  0,  0,  0,
+/* 0x1d20 */   0,  0,  0,  0,153,  0,  0,  0,  9,  0,  0,  0,245,  0,  0,  0,
+/* 0x1d30 */   0,  0,  0,  0,162,  0,  0,  0, 12,  0,  0,  0,254,  0,  0,  0,
+/* 0x1d40 */   0,  0,  0,  0,171,  0,  0,  0, 25,  0,  0,  0, 10,  1,  0,  0,
+/* 0x1d50 */   0,  0,  0,  0,180,  0,  0,  0, 22,  0,  0,  0, 35,  1,  0,  0,
+/* 0x1d60 */   0,  0,  0,  0,189,  0,  0,  0,  0,  0,  0,  0, 57,  1,  0,  0,
+/* 0x1d70 */   0,  0,  0,  0,198,  0,  0,  0,  3,  0,  0,  0, 57,  1,  0,  0,
+/* 0x1d80 */   0,  0,  0,  0,207,  0,  0,  0,  2,  0,  0,  0, 60,  1,  0,  0,
+/* 0x1d90 */   0,  0,  0,  0,216,  0,  0,  0,  6,  0,  0,  0, 62,  1,  0,  0,
+/* 0x1da0 */   0,  0,  0,  0,225,  0,  0,  0, 11,  0,  0,  0, 68,  1,  0,  0,
+/* 0x1db0 */   0,  0,  0,  0,234,  0,  0,  0,  5,  0,  0,  0, 79,  1,  0,  0,
+/* 0x1dc0 */   0,  0,  0,  0,243,  0,  0,  0,  9,  0,  0,  0, 84,  1,  0,  0,
+/* 0x1dd0 */   0,  0,  0,  0,252,  0,  0,  0, 13,  0,  0,  0, 93,  1,  0,  0,
+/* 0x1de0 */   0,  0,  0,  0,  5,  1,  0,  0, 13,  0,  0,  0,106,  1,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0, 14,  1,  0,  0, 15,  0,  0,  0,119,  1,  0,  0,
+/* 0x1e00 */   0,  0,  0,  0, 23,  1,  0,  0, 82,  0,  0,  0,134,  1,  0,  0,
+/* 0x1e10 */   0,  0,  0,  0, 32,  1,  0,  0, 13,  0,  0,  0,216,  1,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0, 41,  1,  0,  0, 15,  0,  0,  0,229,  1,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0, 50,  1,  0,  0,  2,  0,  0,  0,244,  1,  0,  0,
+/* 0x1e40 */   0,  0,  0,  0, 59,  1,  0,  0,  3,  0,  0,  0,246,  1,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0, 68,  1,  0,  0,  9,  0,  0,  0,249,  1,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0, 77,  1,  0,  0, 12,  0,  0,  0,  2,  2,  0,  0,
+/* 0x1e70 */   0,  0,  0,  0, 86,  1,  0,  0, 25,  0,  0,  0, 14,  2,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0, 95,  1,  0,  0, 22,  0,  0,  0, 39,  2,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0,104,  1,  0,  0,  0,  0,  0,  0, 61,  2,  0,  0,
+/* 0x1ea0 */   0,  0,  0,  0,113,  1,  0,  0,  3,  0,  0,  0, 61,  2,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0,122,  1,  0,  0,  2,  0,  0,  0, 64,  2,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0,131,  1,  0,  0,  6,  0,  0,  0, 66,  2,  0,  0,
+/* 0x1ed0 */   0,  0,  0,  0,140,  1,  0,  0, 11,  0,  0,  0, 72,  2,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0,149,  1,  0,  0,  5,  0,  0,  0, 83,  2,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0,158,  1,  0,  0,  9,  0,  0,  0, 88,  2,  0,  0,
+/* 0x1f00 */   0,  0,  0,  0,167,  1,  0,  0, 13,  0,  0,  0, 97,  2,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0,176,  1,  0,  0, 13,  0,  0,  0,110,  2,  0,  0,
+/* 0x1f20 */   0,  0,  0,  0,185,  1,  0,  0, 15,  0,  0,  0,123,  2,  0,  0,
+/* 0x1f30 */   0,  0,  0,  0,194,  1,  0,  0, 95,  0,  0,  0,138,  2,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0,203,  1,  0,  0, 13,  0,  0,  0,233,  2,  0,  0,
+/* 0x1f50 */   0,  0,  0,  0,212,  1,  0,  0, 15,  0,  0,  0,246,  2,  0,  0,
+/* 0x1f60 */   0,  0,  0,  0,221,  1,  0,  0,  2,  0,  0,  0,  5,  3,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0,230,  1,  0,  0,  3,  0,  0,  0,  7,  3,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0,239,  1,  0,  0,  9,  0,  0,  0, 10,  3,  0,  0,
+/* 0x1f90 */   0,  0,  0,  0,248,  1,  0,  0, 12,  0,  0,  0, 19,  3,  0,  0,
+/* 0x1fa0 */   0,  0,  0,  0,  1,  2,  0,  0, 25,  0,  0,  0, 31,  3,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0, 10,  2,  0,  0, 22,  0,  0,  0, 56,  3,  0,  0,
+/* 0x1fc0 */   0,  0,  0,  0, 19,  2,  0,  0,  0,  0,  0,  0, 78,  3,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0, 28,  2,  0,  0, 46,  0,  0,  0, 78,  3,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0, 39,  2,  0,  0, 72,  0,  0,  0,124,  3,  0,  0,
+/* 0x1ff0 */   0,  0,  0,  0, 50,  2,  0,  0,134, 10,  0,  0,196,  3,  0,  0,
+/* 0x2000 */   0,  0,  0,  0, 61,  2,  0,  0,134, 10,  0,  0, 74, 14,  0,  0,
+/* 0x2010 */   0,  0,  0,  0, 72,  2,  0,  0, 26,  0,  0,  0,208, 24,  0,  0,
+/* 0x2020 */   0,  0,  0,  0, 83,  2,  0,  0, 14,  0,  0,  0,234, 24,  0,  0,
+/* 0x2030 */   0,  0,  0,  0, 92,  2,  0,  0,  5,  0,  0,  0,248, 24,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,101,  2,  0,  0,  5,  0,  0,  0,253, 24,  0,  0,
+/* 0x2050 */   0,  0,  0,  0,110,  2,  0,  0,  4,  0,  0,  0,  2, 25,  0,  0,
+/* 0x2060 */   0,  0,  0,  0,119,  2,  0,  0,  2,  0,  0,  0,  6, 25,  0,  0,
+/* 0x2070 */   0,  0,  0,  0,128,  2,  0,  0,  5,  0,  0,  0,  8, 25,  0,  0,
+/* 0x2080 */   0,  0,  0,  0,137,  2,  0,  0, 14,  0,  0,  0, 13, 25,  0,  0,
+/* 0x2090 */   0,  0,  0,  0,146,  2,  0,  0,  5,  0,  0,  0, 27, 25,  0,  0,
+/* 0x20a0 */   0,  0,  0,  0,155,  2,  0,  0,  2,  0,  0,  0, 32, 25,  0,  0,
+/* 0x20b0 */   0,  0,  0,  0,164,  2,  0,  0,  2,  0,  0,  0, 34, 25,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0,173,  2,  0,  0,  4,  0,  0,  0, 36, 25,  0,  0,
+/* 0x20d0 */   0,  0,  0,  0,182,  2,  0,  0,  5,  0,  0,  0, 40, 25,  0,  0,
+/* 0x20e0 */   0,  0,  0,  0,191,  2,  0,  0,  2,  0,  0,  0, 45, 25,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0,200,  2,  0,  0,  4,  0,  0,  0, 47, 25,  0,  0,
+/* 0x2100 */   0,  0,  0,  0,209,  2,  0,  0,  2,  0,  0,  0, 51, 25,  0,  0,
+/* 0x2110 */   0,  0,  0,  0,218,  2,  0,  0,  5,  0,  0,  0, 53, 25,  0,  0,
+/* 0x2120 */   0,  0,  0,  0,227,  2,  0,  0,  5,  0,  0,  0, 58, 25,  0,  0,
+/* 0x2130 */   0,  0,  0,  0,236,  2,  0,  0, 29,  0,  0,  0, 63, 25,  0,  0,
+/* 0x2140 */   0,  0,  0,  0,245,  2,  0,  0,  2,  0,  0,  0, 92, 25,  0,  0,
+/* 0x2150 */   0,  0,  0,  0,254,  2,  0,  0,  5,  0,  0,  0, 94, 25,  0,  0,
+/* 0x2160 */   0,  0,  0,  0,  7,  3,  0,  0,  2,  0,  0,  0, 99, 25,  0,  0,
+/* 0x2170 */   0,  0,  0,  0, 16,  3,  0,  0,  5,  0,  0,  0,101, 25,  0,  0,
+/* 0x2180 */   0,  0,  0,  0, 25,  3,  0,  0,  7,  0,  0,  0,106, 25,  0,  0,
+/* 0x2190 */   0,  0,  0,  0, 34,  3,  0,  0,  7,  0,  0,  0,113, 25,  0,  0,
+/* 0x21a0 */   0,  0,  0,  0, 43,  3,  0,  0,  4,  0,  0,  0,120, 25,  0,  0,
+/* 0x21b0 */   0,  0,  0,  0, 52,  3,  0,  0,  5,  0,  0,  0,124, 25,  0,  0,
+/* 0x21c0 */   0,  0,  0,  0, 61,  3,  0,  0,  3,  0,  0,  0,129, 25,  0,  0,
+/* 0x21d0 */   0,  0,  0,  0, 70,  3,  0,  0,  3,  0,  0,  0,132, 25,  0,  0,
+/* 0x21e0 */   0,  0,  0,  0, 79,  3,  0,  0,  2,  0,  0,  0,135, 25,  0,  0,
+/* 0x21f0 */   0,  0,  0,  0, 88,  3,  0,  0,  2,  0,  0,  0,137, 25,  0,  0,
+/* 0x2200 */   0,  0,  0,  0, 97,  3,  0,  0,  5,  0,  0,  0,139, 25,  0,  0,
+/* 0x2210 */   0,  0,  0,  0,106,  3,  0,  0,  7,  0,  0,  0,144, 25,  0,  0,
+/* 0x2220 */   0,  0,  0,  0,115,  3,  0,  0,  2,  0,  0,  0,151, 25,  0,  0,
+/* 0x2230 */   0,  0,  0,  0,124,  3,  0,  0,  1,  0,  0,  0,153, 25,  0,  0,
+/* 0x2240 */   0,  0,  0,  0,133,  3,  0,  0,  9,  0,  0,  0,154, 25,  0,  0,
+/* 0x2250 */   0,  0,  0,  0,142,  3,  0,  0,  3,  0,  0,  0,163, 25,  0,  0,
+/* 0x2260 */   0,  0,  0,  0,151,  3,  0,  0,  4,  0,  0,  0,166, 25,  0,  0,
+/* 0x2270 */   0,  0,  0,  0,160,  3,  0,  0,  2,  0,  0,  0,170, 25,  0,  0,
+/* 0x2280 */   0,  0,  0,  0,169,  3,  0,  0,  5,  0,  0,  0,172, 25,  0,  0,
+/* 0x2290 */   0,  0,  0,  0,178,  3,  0,  0,  2,  0,  0,  0,177, 25,  0,  0,
+/* 0x22a0 */   0,  0,  0,  0,187,  3,  0,  0,  1,  0,  0,  0,179, 25,  0,  0,
+/* 0x22b0 */   0,  0,  0,  0,196,  3,  0,  0,  2,  0,  0,  0,180, 25,  0,  0,
+/* 0x22c0 */   0,  0,  0,  0,205,  3,  0,  0,  4,  0,  0,  0,182, 25,  0,  0,
+/* 0x22d0 */   0,  0,  0,  0,214,  3,  0,  0,  8,  0,  0,  0,186, 25,  0,  0,
+/* 0x22e0 */   0,  0,  0,  0,223,  3,  0,  0,  3,  0,  0,  0,194, 25,  0,  0,
+/* 0x22f0 */   0,  0,  0,  0,232,  3,  0,  0,  2,  0,  0,  0,197, 25,  0,  0,
+/* 0x2300 */   0,  0,  0,  0,241,  3,  0,  0,  6,  0,  0,  0,199, 25,  0,  0,
+/* 0x2310 */   0,  0,  0,  0,250,  3,  0,  0,  3,  0,  0,  0,205, 25,  0,  0,
+/* 0x2320 */   0,  0,  0,  0,  3,  4,  0,  0,  2,  0,  0,  0,208, 25,  0,  0,
+/* 0x2330 */   0,  0,  0,  0, 12,  4,  0,  0,  1,  0,  0,  0,210, 25,  0,  0,
+/* 0x2340 */   0,  0,  0,  0, 21,  4,  0,  0,  2,  0,  0,  0,211, 25,  0,  0,
+/* 0x2350 */   0,  0,  0,  0, 30,  4,  0,  0,  4,  0,  0,  0,213, 25,  0,  0,
+/* 0x2360 */   0,  0,  0,  0, 39,  4,  0,  0, 11,  0,  0,  0,217, 25,  0,  0,
+/* 0x2370 */   0,  0,  0,  0, 48,  4,  0,  0,  2,  0,  0,  0,228, 25,  0,  0,
+/* 0x2380 */   0,  0,  0,  0, 57,  4,  0,  0,  1,  0,  0,  0,230, 25,  0,  0,
+/* 0x2390 */   0,  0,  0,  0, 66,  4,  0,  0,  2,  0,  0,  0,231, 25,  0,  0,
+/* 0x23a0 */   0,  0,  0,  0, 75,  4,  0,  0,  4,  0,  0,  0,233, 25,  0,  0,
+/* 0x23b0 */   0,  0,  0,  0, 84,  4,  0,  0, 16,  0,  0,  0,237, 25,  0,  0,
+/* 0x23c0 */   0,  0,  0,  0, 93,  4,  0,  0,  5,  0,  0,  0,253, 25,  0,  0,
+/* 0x23d0 */   0,  0,  0,  0,102,  4,  0,  0,  3,  0,  0,  0,  2, 26,  0,  0,
+/* 0x23e0 */   0,  0,  0,  0,111,  4,  0,  0,  2,  0,  0,  0,  5, 26,  0,  0,
+/* 0x23f0 */   0,  0,  0,  0,120,  4,  0,  0,  7,  0,  0,  0,  7, 26,  0,  0,
+/* 0x2400 */   0,  0,  0,  0,129,  4,  0,  0,  0,  0,  0,  0, 14, 26,  0,  0,
+/* 0x2410 */   0,  0,  0,  0,138,  4,  0,  0,  5,  0,  0,  0, 14, 26,  0,  0,
+/* 0x2420 */   0,  0,  0,  0,147,  4,  0,  0,  1,  0,  0,  0, 19, 26,  0,  0,
+/* 0x2430 */   0,  0,  0,  0,156,  4,  0,  0,  2,  0,  0,  0, 20, 26,  0,  0,
+/* 0x2440 */   0,  0,  0,  0,165,  4,  0,  0,  2,  0,  0,  0, 22, 26,  0,  0,
+/* 0x2450 */   0,  0,  0,  0,174,  4,  0,  0,  6,  0,  0,  0, 24, 26,  0,  0,
+/* 0x2460 */   0,  0,  0,  0,183,  4,  0,  0,  3,  0,  0,  0, 30, 26,  0,  0,
+/* 0x2470 */   0,  0,  0,  0,192,  4,  0,  0,  2,  0,  0,  0, 33, 26,  0,  0,
+/* 0x2480 */   0,  0,  0,  0,201,  4,  0,  0,  2,  0,  0,  0, 35, 26,  0,  0,
+/* 0x2490 */   0,  0,  0,  0,210,  4,  0,  0,  1,  0,  0,  0, 37, 26,  0,  0,
+/* 0x24a0 */   0,  0,  0,  0,219,  4,  0,  0,  2,  0,  0,  0, 38, 26,  0,  0,
+/* 0x24b0 */   0,  0,  0,  0,228,  4,  0,  0,  2,  0,  0,  0, 40, 26,  0,  0,
+/* 0x24c0 */   0,  0,  0,  0,237,  4,  0,  0,  1,  0,  0,  0, 42, 26,  0,  0,
+/* 0x24d0 */   0,  0,  0,  0,246,  4,  0,  0,  2,  0,  0,  0, 43, 26,  0,  0,
+/* 0x24e0 */   0,  0,  0,  0,255,  4,  0,  0,  6,  0,  0,  0, 45, 26,  0,  0,
+/* 0x24f0 */   0,  0,  0,  0,  8,  5,  0,  0,  8,  0,  0,  0, 51, 26,  0,  0,
+/* 0x2500 */   0,  0,  0,  0, 17,  5,  0,  0,  2,  0,  0,  0, 59, 26,  0,  0,
+/* 0x2510 */   0,  0,  0,  0, 26,  5,  0,  0,  3,  0,  0,  0, 61, 26,  0,  0,
+/* 0x2520 */   0,  0,  0,  0, 35,  5,  0,  0,  3,  0,  0,  0, 64, 26,  0,  0,
+/* 0x2530 */   0,  0,  0,  0, 44,  5,  0,  0,  2,  0,  0,  0, 67, 26,  0,  0,
+/* 0x2540 */   0,  0,  0,  0, 53,  5,  0,  0,  3,  0,  0,  0, 69, 26,  0,  0,
+/* 0x2550 */   0,  0,  0,  0, 62,  5,  0,  0,  2,  0,  0,  0, 72, 26,  0,  0,
+/* 0x2560 */   0,  0,  0,  0, 71,  5,  0,  0,  2,  0,  0,  0, 74, 26,  0,  0,
+/* 0x2570 */   0,  0,  0,  0, 80,  5,  0,  0,  2,  0,  0,  0, 76, 26,  0,  0,
+/* 0x2580 */   0,  0,  0,  0, 89,  5,  0,  0,  2,  0,  0,  0, 78, 26,  0,  0,
+/* 0x2590 */   0,  0,  0,  0, 98,  5,  0,  0,  3,  0,  0,  0, 80, 26,  0,  0,
+/* 0x25a0 */   0,  0,  0,  0,107,  5,  0,  0,  5,  0,  0,  0, 83, 26,  0,  0,
+/* 0x25b0 */   0,  0,  0,  0,116,  5,  0,  0,  2,  0,  0,  0, 88, 26,  0,  0,
+/* 0x25c0 */   0,  0,  0,  0,125,  5,  0,  0,  5,  0,  0,  0, 90, 26,  0,  0,
+/* 0x25d0 */   0,  0,  0,  0,134,  5,  0,  0,  5,  0,  0,  0, 95, 26,  0,  0,
+/* 0x25e0 */   0,  0,  0,  0,143,  5,  0,  0,  5,  0,  0,  0,100, 26,  0,  0,
+/* 0x25f0 */   0,  0,  0,  0,152,  5,  0,  0,  6,  0,  0,  0,105, 26,  0,  0,
+/* 0x2600 */   0,  0,  0,  0,161,  5,  0,  0,  1,  0,  0,  0,111, 26,  0,  0,
+/* 0x2610 */   0,  0,  0,  0,170,  5,  0,  0,  6,  0,  0,  0,112, 26,  0,  0,
+/* 0x2620 */   0,  0,  0,  0,179,  5,  0,  0,  7,  0,  0,  0,118, 26,  0,  0,
+/* 0x2630 */   0,  0,  0,  0,189,  5,  0,  0, 14,  0,  0,  0,125, 26,  0,  0,
+/* 0x2640 */   0,  0,  0,  0,199,  5,  0,  0, 32,  0,  0,  0,139, 26,  0,  0,
+/* 0x2650 */   0,  0,  0,  0,209,  5,  0,  0, 10,  0,  0,  0,171, 26,  0,  0,
+/* 0x2660 */   0,  0,  0,  0,219,  5,  0,  0,  5,  0,  0,  0,181, 26,  0,  0,
+/* 0x2670 */   0,  0,  0,  0,229,  5,  0,  0,  2,  0,  0,  0,186, 26,  0,  0,
+/* 0x2680 */   0,  0,  0,  0,238,  5,  0,  0, 72,  1,  0,  0,188, 26,  0,  0,
+/* 0x2690 */   0,  0,  0,  0,247,  5,  0,  0,  0,  0,  0,  0,  4, 28,  0,  0,
+/* 0x26a0 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  4, 28,  0,  0,
+/* 0x26b0 */   0,  0,  0,  0,  9,  6,  0,  0,  0,  0,  0,  0,  4, 28,  0,  0,
+/* 0x26c0 */   0,  0,  0,  0, 18,  6,  0,  0,  0,  0,  0,  0,  4, 28,  0,  0,
+/* 0x26d0 */   0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26e0 */   0,  0,  0,  0, 45,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26f0 */   0,  0,  0,  0, 54,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2700 */   0,  0,  0,  0, 81,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2710 */   0,  0,  0,  0,108,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2720 */   0,  0,  0,  0,153,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2730 */   0,  0,  0,  0,180,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2740 */   0,  0,  0,  0,189,  0,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2750 */   0,  0,  0,  0,198,  0,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2760 */   0,  0,  0,  0,216,  0,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2770 */   0,  0,  0,  0,225,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2780 */   0,  0,  0,  0,252,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2790 */   0,  0,  0,  0, 23,  1,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27a0 */   0,  0,  0,  0, 68,  1,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27b0 */   0,  0,  0,  0, 95,  1,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27c0 */   0,  0,  0,  0,104,  1,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27d0 */   0,  0,  0,  0,113,  1,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27e0 */   0,  0,  0,  0,131,  1,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27f0 */   0,  0,  0,  0,140,  1,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2800 */   0,  0,  0,  0,167,  1,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2810 */   0,  0,  0,  0,194,  1,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2820 */   0,  0,  0,  0,239,  1,  0,  0, 55,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2830 */   0,  0,  0,  0, 10,  2,  0,  0, 58,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2840 */   0,  0,  0,  0, 19,  2,  0,  0, 59,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2850 */   0,  0,  0,  0, 83,  2,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2860 */   0,  0,  0,  0,146,  2,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2870 */   0,  0,  0,  0,173,  2,  0,  0, 75,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2880 */   0,  0,  0,  0,227,  2,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2890 */   0,  0,  0,  0, 52,  3,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28a0 */   0,  0,  0,  0, 61,  3,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28b0 */   0,  0,  0,  0,115,  3,  0,  0, 97,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28c0 */   0,  0,  0,  0,214,  3,  0,  0,108,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28d0 */   0,  0,  0,  0, 84,  4,  0,  0,122,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28e0 */   0,  0,  0,  0, 93,  4,  0,  0,123,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28f0 */   0,  0,  0,  0,129,  4,  0,  0,127,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2900 */   0,  0,  0,  0,219,  4,  0,  0,137,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2910 */   0,  0,  0,  0,255,  4,  0,  0,141,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2920 */   0,  0,  0,  0, 98,  5,  0,  0,152,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2930 */   0,  0,  0,  0,107,  5,  0,  0,153,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2940 */   0,  0,  0,  0,179,  5,  0,  0,161,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2950 */   0,  0,  0,  0,189,  5,  0,  0,162,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2960 */   0,  0,  0,  0,199,  5,  0,  0,163,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2970 */   0,  0,  0,  0,219,  5,  0,  0,165,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2980 */   0,  0,  0,  0,238,  5,  0,  0,167,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2990 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29a0 */   0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29b0 */   0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29c0 */   0,  0,  0,  0, 36,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29d0 */   0,  0,  0,  0, 63,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29e0 */   0,  0,  0,  0, 72,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29f0 */   0,  0,  0,  0, 90,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a00 */   0,  0,  0,  0, 99,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a10 */   0,  0,  0,  0,117,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a20 */   0,  0,  0,  0,126,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a30 */   0,  0,  0,  0,135,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a40 */   0,  0,  0,  0,144,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a50 */   0,  0,  0,  0,162,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a60 */   0,  0,  0,  0,171,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a70 */   0,  0,  0,  0,207,  0,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a80 */   0,  0,  0,  0,234,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a90 */   0,  0,  0,  0,243,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2aa0 */   0,  0,  0,  0,  5,  1,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ab0 */   0,  0,  0,  0, 14,  1,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ac0 */   0,  0,  0,  0, 32,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ad0 */   0,  0,  0,  0, 41,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ae0 */   0,  0,  0,  0, 50,  1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2af0 */   0,  0,  0,  0, 59,  1,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b00 */   0,  0,  0,  0, 77,  1,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b10 */   0,  0,  0,  0, 86,  1,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b20 */   0,  0,  0,  0,122,  1,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b30 */   0,  0,  0,  0,149,  1,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b40 */   0,  0,  0,  0,158,  1,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b50 */   0,  0,  0,  0,176,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b60 */   0,  0,  0,  0,185,  1,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b70 */   0,  0,  0,  0,203,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b80 */   0,  0,  0,  0,212,  1,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b90 */   0,  0,  0,  0,221,  1,  0,  0, 53,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ba0 */   0,  0,  0,  0,230,  1,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bb0 */   0,  0,  0,  0,248,  1,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bc0 */   0,  0,  0,  0,  1,  2,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bd0 */   0,  0,  0,  0, 28,  2,  0,  0, 60,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2be0 */   0,  0,  0,  0, 39,  2,  0,  0, 61,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bf0 */   0,  0,  0,  0, 50,  2,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c00 */   0,  0,  0,  0, 61,  2,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c10 */   0,  0,  0,  0, 72,  2,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c20 */   0,  0,  0,  0, 92,  2,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c30 */   0,  0,  0,  0,101,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c40 */   0,  0,  0,  0,110,  2,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c50 */   0,  0,  0,  0,119,  2,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c60 */   0,  0,  0,  0,128,  2,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c70 */   0,  0,  0,  0,137,  2,  0,  0, 71,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c80 */   0,  0,  0,  0,155,  2,  0,  0, 73,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c90 */   0,  0,  0,  0,164,  2,  0,  0, 74,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ca0 */   0,  0,  0,  0,182,  2,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cb0 */   0,  0,  0,  0,191,  2,  0,  0, 77,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cc0 */   0,  0,  0,  0,200,  2,  0,  0, 78,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cd0 */   0,  0,  0,  0,209,  2,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ce0 */   0,  0,  0,  0,218,  2,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cf0 */   0,  0,  0,  0,236,  2,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d00 */   0,  0,  0,  0,245,  2,  0,  0, 83,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d10 */   0,  0,  0,  0,254,  2,  0,  0, 84,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d20 */   0,  0,  0,  0,  7,  3,  0,  0, 85,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d30 */   0,  0,  0,  0, 16,  3,  0,  0, 86,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d40 */   0,  0,  0,  0, 25,  3,  0,  0, 87,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d50 */   0,  0,  0,  0, 34,  3,  0,  0, 88,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d60 */   0,  0,  0,  0, 43,  3,  0,  0, 89,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d70 */   0,  0,  0,  0, 70,  3,  0,  0, 92,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d80 */   0,  0,  0,  0, 79,  3,  0,  0, 93,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d90 */   0,  0,  0,  0, 88,  3,  0,  0, 94,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2da0 */   0,  0,  0,  0, 97,  3,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2db0 */   0,  0,  0,  0,106,  3,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2dc0 */   0,  0,  0,  0,124,  3,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2dd0 */   0,  0,  0,  0,133,  3,  0,  0, 99,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2de0 */   0,  0,  0,  0,142,  3,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2df0 */   0,  0,  0,  0,151,  3,  0,  0,101,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e00 */   0,  0,  0,  0,160,  3,  0,  0,102,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e10 */   0,  0,  0,  0,169,  3,  0,  0,103,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e20 */   0,  0,  0,  0,178,  3,  0,  0,104,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e30 */   0,  0,  0,  0,187,  3,  0,  0,105,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e40 */   0,  0,  0,  0,196,  3,  0,  0,106,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e50 */   0,  0,  0,  0,205,  3,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e60 */   0,  0,  0,  0,223,  3,  0,  0,109,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e70 */   0,  0,  0,  0,232,  3,  0,  0,110,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e80 */   0,  0,  0,  0,241,  3,  0,  0,111,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e90 */   0,  0,  0,  0,250,  3,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ea0 */   0,  0,  0,  0,  3,  4,  0,  0,113,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2eb0 */   0,  0,  0,  0, 12,  4,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ec0 */   0,  0,  0,  0, 21,  4,  0,  0,115,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ed0 */   0,  0,  0,  0, 30,  4,  0,  0,116,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ee0 */   0,  0,  0,  0, 39,  4,  0,  0,117,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ef0 */   0,  0,  0,  0, 48,  4,  0,  0,118,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f00 */   0,  0,  0,  0, 57,  4,  0,  0,119,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f10 */   0,  0,  0,  0, 66,  4,  0,  0,120,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f20 */   0,  0,  0,  0, 75,  4,  0,  0,121,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f30 */   0,  0,  0,  0,102,  4,  0,  0,124,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f40 */   0,  0,  0,  0,111,  4,  0,  0,125,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f50 */   0,  0,  0,  0,120,  4,  0,  0,126,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f60 */   0,  0,  0,  0,138,  4,  0,  0,128,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f70 */   0,  0,  0,  0,147,  4,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f80 */   0,  0,  0,  0,156,  4,  0,  0,130,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f90 */   0,  0,  0,  0,165,  4,  0,  0,131,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fa0 */   0,  0,  0,  0,174,  4,  0,  0,132,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fb0 */   0,  0,  0,  0,183,  4,  0,  0,133,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fc0 */   0,  0,  0,  0,192,  4,  0,  0,134,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fd0 */   0,  0,  0,  0,201,  4,  0,  0,135,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fe0 */   0,  0,  0,  0,210,  4,  0,  0,136,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ff0 */   0,  0,  0,  0,228,  4,  0,  0,138,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3000 */   0,  0,  0,  0,237,  4,  0,  0,139,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3010 */   0,  0,  0,  0,246,  4,  0,  0,140,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3020 */   0,  0,  0,  0,  8,  5,  0,  0,142,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3030 */   0,  0,  0,  0, 17,  5,  0,  0,143,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3040 */   0,  0,  0,  0, 26,  5,  0,  0,144,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3050 */   0,  0,  0,  0, 35,  5,  0,  0,145,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3060 */   0,  0,  0,  0, 44,  5,  0,  0,146,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3070 */   0,  0,  0,  0, 53,  5,  0,  0,147,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3080 */   0,  0,  0,  0, 62,  5,  0,  0,148,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3090 */   0,  0,  0,  0, 71,  5,  0,  0,149,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30a0 */   0,  0,  0,  0, 80,  5,  0,  0,150,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30b0 */   0,  0,  0,  0, 89,  5,  0,  0,151,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30c0 */   0,  0,  0,  0,116,  5,  0,  0,154,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30d0 */   0,  0,  0,  0,125,  5,  0,  0,155,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30e0 */   0,  0,  0,  0,134,  5,  0,  0,156,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30f0 */   0,  0,  0,  0,143,  5,  0,  0,157,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3100 */   0,  0,  0,  0,152,  5,  0,  0,158,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3110 */   0,  0,  0,  0,161,  5,  0,  0,159,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3120 */   0,  0,  0,  0,170,  5,  0,  0,160,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3130 */   0,  0,  0,  0,209,  5,  0,  0,164,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3140 */   0,  0,  0,  0,229,  5,  0,  0,166,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3150 */   0,  0,  0,  0,247,  5,  0,  0,168,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3160 */   0,  0,  0,  0,  0,  6,  0,  0,169,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3170 */   0,  0,  0,  0,  9,  6,  0,  0,170,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3180 */   0,  0,  0,  0, 18,  6,  0,  0,171,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3190 */   0,  0,  0,  0, 27,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31a0 */   0,  0,  0,  0, 34,  6,  0,  0,173,  0,  0,  0,173,222,173,222,
+/* 0x31b0 */   0,  0,  0,  0, 52,  6,  0,  0,173,  0,  0,  0,173,222,173,222,
+/* 0x31c0 */   0,  0,  0,  0, 63,  6,  0,  0,173,  0,  0,  0,173,222,173,222,
+/* 0x31d0 */   0,  0,  0,  0, 74,  6,  0,  0,173,  0,  0,  0,173,222,173,222,
+/* 0x31e0 */   0,  0,  0,  0, 90,  6,  0,  0,173,  0,  0,  0,173,222,173,222,
+/* 0x31f0 */   0,  0,  0,  0,104,  6,  0,  0,173,  0,  0,  0,173,222,173,222,
+/* 0x3200 */   0,  0,  0,  0,115,  6,  0,  0,173,  0,  0,  0,173,222,173,222,
+/* 0x3210 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,120,  6,  0,  0,
+/* 0x3220 */  43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x3230 */   1,  0,  0,  0,131,  6,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3240 */   0,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x3250 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x3260 */   1,  0,  0,  0,131,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3270 */   0,  0,  0,  0,  8,  0,  0,  0,  3,  0,  0,  0,131,  6,  0,  0,
+/* 0x3280 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,
+/* 0x3290 */  12,  0,  0,  0,131,  6,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32a0 */   0,  0,  0,  0, 11,  0,  0,  0,  3,  0,  0,  0,131,  6,  0,  0,
+/* 0x32b0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x32c0 */  14,  0,  0,  0,131,  6,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32d0 */   0,  0,  0,  0, 12,  0,  0,  0, 17,  0,  0,  0,131,  6,  0,  0,
+/* 0x32e0 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
+/* 0x32f0 */  47,  0,  0,  0,131,  6,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3300 */   0,  0,  0,  0, 13,  0,  0,  0, 12,  0,  0,  0,131,  6,  0,  0,
+/* 0x3310 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
+/* 0x3320 */   3,  0,  0,  0,131,  6,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3330 */   0,  0,  0,  0, 14,  0,  0,  0, 14,  0,  0,  0,131,  6,  0,  0,
+/* 0x3340 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x3350 */   8,  0,  0,  0,120,  6,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3360 */   0,  0,  0,  0, 19,  0,  0,  0, 10,  0,  0,  0,131,  6,  0,  0,
+/* 0x3370 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,
+/* 0x3380 */  21,  0,  0,  0,120,  6,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3390 */   0,  0,  0,  0, 20,  0,  0,  0, 18,  0,  0,  0,120,  6,  0,  0,
+/* 0x33a0 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22,  0,  0,  0,
+/* 0x33b0 */   1,  0,  0,  0,131,  6,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33c0 */   0,  0,  0,  0, 23,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x33d0 */  10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
+/* 0x33e0 */   1,  0,  0,  0,131,  6,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33f0 */   0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,131,  6,  0,  0,
+/* 0x3400 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0,
+/* 0x3410 */  12,  0,  0,  0,131,  6,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3420 */   0,  0,  0,  0, 30,  0,  0,  0,  5,  0,  0,  0,131,  6,  0,  0,
+/* 0x3430 */  12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,
+/* 0x3440 */  14,  0,  0,  0,131,  6,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3450 */   0,  0,  0,  0, 31,  0,  0,  0, 15,  0,  0,  0,131,  6,  0,  0,
+/* 0x3460 */  11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,
+/* 0x3470 */  33,  0,  0,  0,131,  6,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3480 */   0,  0,  0,  0, 31,  0,  0,  0, 67,  0,  0,  0,131,  6,  0,  0,
+/* 0x3490 */  13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,
+/* 0x34a0 */  12,  0,  0,  0,131,  6,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34b0 */   0,  0,  0,  0, 33,  0,  0,  0,  3,  0,  0,  0,131,  6,  0,  0,
+/* 0x34c0 */  12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x34d0 */  14,  0,  0,  0,131,  6,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34e0 */   0,  0,  0,  0, 37,  0,  0,  0,  8,  0,  0,  0,120,  6,  0,  0,
+/* 0x34f0 */  10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0,
+/* 0x3500 */  10,  0,  0,  0,131,  6,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3510 */   0,  0,  0,  0, 38,  0,  0,  0, 21,  0,  0,  0,120,  6,  0,  0,
+/* 0x3520 */  10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,
+/* 0x3530 */  18,  0,  0,  0,120,  6,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3540 */   0,  0,  0,  0, 41,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x3550 */  18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,
+/* 0x3560 */   1,  0,  0,  0,131,  6,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3570 */   0,  0,  0,  0, 45,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x3580 */  16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,
+/* 0x3590 */   3,  0,  0,  0,131,  6,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35a0 */   0,  0,  0,  0, 48,  0,  0,  0, 12,  0,  0,  0,131,  6,  0,  0,
+/* 0x35b0 */  20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,
+/* 0x35c0 */   5,  0,  0,  0,131,  6,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35d0 */   0,  0,  0,  0, 49,  0,  0,  0, 14,  0,  0,  0,131,  6,  0,  0,
+/* 0x35e0 */  20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,
+/* 0x35f0 */  15,  0,  0,  0,131,  6,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3600 */   0,  0,  0,  0, 50,  0,  0,  0, 30,  0,  0,  0,131,  6,  0,  0,
+/* 0x3610 */  21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,
+/* 0x3620 */  48,  0,  0,  0,131,  6,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3630 */   0,  0,  0,  0, 51,  0,  0,  0, 12,  0,  0,  0,131,  6,  0,  0,
+/* 0x3640 */  20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,
+/* 0x3650 */   3,  0,  0,  0,131,  6,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3660 */   0,  0,  0,  0, 52,  0,  0,  0, 14,  0,  0,  0,131,  6,  0,  0,
+/* 0x3670 */  20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,
+/* 0x3680 */   8,  0,  0,  0,120,  6,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3690 */   0,  0,  0,  0, 57,  0,  0,  0, 10,  0,  0,  0,131,  6,  0,  0,
+/* 0x36a0 */  22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,
+/* 0x36b0 */  21,  0,  0,  0,120,  6,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36c0 */   0,  0,  0,  0, 58,  0,  0,  0, 18,  0,  0,  0,120,  6,  0,  0,
+/* 0x36d0 */  18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,
+/* 0x36e0 */   5,  0,  0,  0,141,  6,  0,  0,173,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36f0 */   0,  0,  0,  0, 60,  0,  0,  0, 20,  0,  0,  0,141,  6,  0,  0,
+/* 0x3700 */ 174,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,
+/* 0x3710 */  30,  0,  0,  0,141,  6,  0,  0,175,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3720 */   0,  0,  0,  0, 60,  0,  0,  0, 42,  0,  0,  0,141,  6,  0,  0,
+/* 0x3730 */ 176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 65,  0,  0,  0,
+/* 0x3740 */   1,  0,  0,  0,141,  6,  0,  0,177,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3750 */   0,  0,  0,  0, 66,  0,  0,  0,  2,  0,  0,  0,150,  6,  0,  0,
+/* 0x3760 */ 178,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0,
+/* 0x3770 */   4,  0,  0,  0,131,  6,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3780 */   0,  0,  0,  0, 71,  0,  0,  0, 13,  0,  0,  0,131,  6,  0,  0,
+/* 0x3790 */  24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,
+/* 0x37a0 */   1,  0,  0,  0,141,  6,  0,  0,177,  0,  0,  0,  0,  0,  0,  0,
+/* 0x37b0 */   0,  0,  0,  0, 75,  0,  0,  0,  3,  0,  0,  0,131,  6,  0,  0,
+/* 0x37c0 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0,
+/* 0x37d0 */   2,  0,  0,  0,150,  6,  0,  0,178,  0,  0,  0,  0,  0,  0,  0,
+/* 0x37e0 */   0,  0,  0,  0, 76,  0,  0,  0,  4,  0,  0,  0,131,  6,  0,  0,
+/* 0x37f0 */  26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,
+/* 0x3800 */   4,  0,  0,  0,131,  6,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3810 */   0,  0,  0,  0, 83,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x3820 */  28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 86,  0,  0,  0,
+/* 0x3830 */   1,  0,  0,  0,141,  6,  0,  0,179,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3840 */   0,  0,  0,  0, 90,  0,  0,  0,  1,  0,  0,  0,120,  6,  0,  0,
+/* 0x3850 */  34,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 94,  0,  0,  0,
+/* 0x3860 */   1,  0,  0,  0,131,  6,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3870 */   0,  0,  0,  0, 95,  0,  0,  0,  4,  0,  0,  0,131,  6,  0,  0,
+/* 0x3880 */  38,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0,
+/* 0x3890 */   2,  0,  0,  0,131,  6,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x38a0 */   0,  0,  0,  0,102,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x38b0 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,103,  0,  0,  0,
+/* 0x38c0 */   4,  0,  0,  0,131,  6,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+/* 0x38d0 */   0,  0,  0,  0,108,  0,  0,  0,  4,  0,  0,  0,131,  6,  0,  0,
+/* 0x38e0 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,
+/* 0x38f0 */   6,  0,  0,  0,131,  6,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3900 */   0,  0,  0,  0,126,  0,  0,  0,  6,  0,  0,  0,131,  6,  0,  0,
+/* 0x3910 */  38,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,
+/* 0x3920 */   1,  0,  0,  0,120,  6,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3930 */   0,  0,  0,  0,140,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x3940 */  35,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,142,  0,  0,  0,
+/* 0x3950 */   7,  0,  0,  0,131,  6,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3960 */   0,  0,  0,  0,146,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x3970 */  30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,148,  0,  0,  0,
+/* 0x3980 */   1,  0,  0,  0,131,  6,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3990 */   0,  0,  0,  0,149,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x39a0 */  38,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,150,  0,  0,  0,
+/* 0x39b0 */   1,  0,  0,  0,131,  6,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,
+/* 0x39c0 */   0,  0,  0,  0,151,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x39d0 */  37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,152,  0,  0,  0,
+/* 0x39e0 */   2,  0,  0,  0,131,  6,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,
+/* 0x39f0 */   0,  0,  0,  0,153,  0,  0,  0,  4,  0,  0,  0,131,  6,  0,  0,
+/* 0x3a00 */  36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,161,  0,  0,  0,
+/* 0x3a10 */   3,  0,  0,  0,131,  6,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a20 */   0,  0,  0,  0,162,  0,  0,  0, 13,  0,  0,  0,131,  6,  0,  0,
+/* 0x3a30 */  41,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,163,  0,  0,  0,
+/* 0x3a40 */   5,  0,  0,  0,131,  6,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a50 */   0,  0,  0,  0,163,  0,  0,  0, 10,  0,  0,  0,131,  6,  0,  0,
+/* 0x3a60 */  42,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,163,  0,  0,  0,
+/* 0x3a70 */  16,  0,  0,  0,131,  6,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a80 */   0,  0,  0,  0,164,  0,  0,  0,  4,  0,  0,  0,131,  6,  0,  0,
+/* 0x3a90 */  42,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,164,  0,  0,  0,
+/* 0x3aa0 */   9,  0,  0,  0,131,  6,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ab0 */   0,  0,  0,  0,165,  0,  0,  0,  4,  0,  0,  0,131,  6,  0,  0,
+/* 0x3ac0 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76, 69, 88, 69,
+/* 0x3ad0 */  67, 48, 48, 48,  0, 76, 69, 88, 69, 67, 48, 48, 57,  0, 76, 69,
+/* 0x3ae0 */  88, 69, 67, 48, 49, 48,  0, 78, 50, 66, 83, 77, 65, 49, 48,  0,
+/* 0x3af0 */  78, 50, 66, 70, 65, 83, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49,
+/* 0x3b00 */  49,  0, 78, 50, 66, 68, 69, 67, 49, 48,  0, 78, 50, 66, 83, 77,
+/* 0x3b10 */  65, 50, 48,  0, 78, 50, 66, 70, 65, 83, 50, 48,  0, 78, 50, 66,
+/* 0x3b20 */  68, 69, 67, 50, 48,  0, 78, 50, 66, 83, 77, 65, 51, 48,  0, 78,
+/* 0x3b30 */  50, 66, 70, 65, 83, 51, 48,  0, 78, 50, 66, 68, 69, 67, 51, 48,
+/* 0x3b40 */   0, 78, 50, 66, 83, 77, 65, 52, 48,  0, 78, 50, 66, 70, 65, 83,
+/* 0x3b50 */  52, 48,  0, 78, 50, 66, 83, 77, 65, 53, 48,  0, 78, 50, 66, 70,
+/* 0x3b60 */  65, 83, 53, 48,  0, 78, 50, 66, 68, 69, 67, 53, 48,  0, 78, 50,
+/* 0x3b70 */  66, 83, 77, 65, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 48,  0,
+/* 0x3b80 */  78, 50, 66, 70, 65, 83, 54, 49,  0, 78, 50, 66, 68, 69, 67, 54,
+/* 0x3b90 */  48,  0, 78, 50, 68, 83, 77, 65, 49, 48,  0, 78, 50, 68, 70, 65,
+/* 0x3ba0 */  83, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 49,  0, 78, 50, 68,
+/* 0x3bb0 */  68, 69, 67, 49, 48,  0, 78, 50, 68, 83, 77, 65, 50, 48,  0, 78,
+/* 0x3bc0 */  50, 68, 70, 65, 83, 50, 48,  0, 78, 50, 68, 68, 69, 67, 50, 48,
+/* 0x3bd0 */   0, 78, 50, 68, 83, 77, 65, 51, 48,  0, 78, 50, 68, 70, 65, 83,
+/* 0x3be0 */  51, 48,  0, 78, 50, 68, 68, 69, 67, 51, 48,  0, 78, 50, 68, 83,
+/* 0x3bf0 */  77, 65, 52, 48,  0, 78, 50, 68, 70, 65, 83, 52, 48,  0, 78, 50,
+/* 0x3c00 */  68, 83, 77, 65, 53, 48,  0, 78, 50, 68, 70, 65, 83, 53, 48,  0,
+/* 0x3c10 */  78, 50, 68, 68, 69, 67, 53, 48,  0, 78, 50, 68, 83, 77, 65, 54,
+/* 0x3c20 */  48,  0, 78, 50, 68, 70, 65, 83, 54, 48,  0, 78, 50, 68, 70, 65,
+/* 0x3c30 */  83, 54, 49,  0, 78, 50, 68, 68, 69, 67, 54, 48,  0, 78, 50, 69,
+/* 0x3c40 */  83, 77, 65, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 48,  0, 78,
+/* 0x3c50 */  50, 69, 70, 65, 83, 49, 49,  0, 78, 50, 69, 68, 69, 67, 49, 48,
+/* 0x3c60 */   0, 78, 50, 69, 83, 77, 65, 50, 48,  0, 78, 50, 69, 70, 65, 83,
+/* 0x3c70 */  50, 48,  0, 78, 50, 69, 68, 69, 67, 50, 48,  0, 78, 50, 69, 83,
+/* 0x3c80 */  77, 65, 51, 48,  0, 78, 50, 69, 70, 65, 83, 51, 48,  0, 78, 50,
+/* 0x3c90 */  69, 68, 69, 67, 51, 48,  0, 78, 50, 69, 83, 77, 65, 52, 48,  0,
+/* 0x3ca0 */  78, 50, 69, 70, 65, 83, 52, 48,  0, 78, 50, 69, 83, 77, 65, 53,
+/* 0x3cb0 */  48,  0, 78, 50, 69, 70, 65, 83, 53, 48,  0, 78, 50, 69, 68, 69,
+/* 0x3cc0 */  67, 53, 48,  0, 78, 50, 69, 83, 77, 65, 54, 48,  0, 78, 50, 69,
+/* 0x3cd0 */  70, 65, 83, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 49,  0, 78,
+/* 0x3ce0 */  50, 69, 68, 69, 67, 54, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x3cf0 */  48, 48,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90,
+/* 0x3d00 */  77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x3d10 */  67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 67,
+/* 0x3d20 */  65, 76, 76, 84, 82, 48, 48,  0, 67, 84, 67, 76, 69, 86, 69, 49,
+/* 0x3d30 */   0, 67, 65, 76, 76, 84, 82, 48, 49,  0, 67, 84, 66, 83, 72, 82,
+/* 0x3d40 */  48, 49,  0, 67, 84, 66, 82, 79, 82, 48, 49,  0, 67, 84, 66, 83,
+/* 0x3d50 */  87, 65, 48, 49,  0, 67, 65, 76, 76, 84, 82, 48, 50,  0, 67, 65,
+/* 0x3d60 */  76, 76, 84, 82, 49, 48,  0, 67, 65, 76, 76, 84, 82, 69, 56,  0,
+/* 0x3d70 */  67, 65, 76, 76, 84, 82, 69, 57,  0, 67, 65, 76, 76, 84, 82, 49,
+/* 0x3d80 */  49,  0, 67, 84, 67, 76, 69, 86, 69, 50,  0, 67, 65, 76, 76, 84,
+/* 0x3d90 */  82, 49, 50,  0, 67, 84, 66, 83, 72, 82, 49, 49,  0, 67, 84, 66,
+/* 0x3da0 */  82, 79, 82, 49, 49,  0, 67, 84, 66, 83, 87, 65, 49, 49,  0, 67,
+/* 0x3db0 */  65, 76, 76, 84, 82, 49, 51,  0, 76, 69, 88, 69, 67, 48, 49, 53,
+/* 0x3dc0 */   0, 76, 88, 85, 78, 70, 48, 48, 48,  0, 76, 88, 85, 78, 70, 48,
+/* 0x3dd0 */  48, 50,  0, 77, 82, 85, 66, 89, 84, 69, 48,  0, 76, 88, 77, 82,
+/* 0x3de0 */  85, 48, 48, 53,  0, 76, 88, 77, 82, 85, 48, 48, 54,  0, 76, 88,
+/* 0x3df0 */  77, 82, 85, 48, 48, 55,  0, 76, 88, 85, 78, 70, 48, 48, 56,  0,
+/* 0x3e00 */  76, 88, 85, 78, 70, 48, 49, 48,  0, 76, 88, 74, 67, 67, 48, 49,
+/* 0x3e10 */  48,  0, 76, 88, 77, 82, 85, 48, 52, 53,  0, 76, 88, 77, 82, 85,
+/* 0x3e20 */  48, 52, 54,  0, 76, 88, 74, 67, 67, 48, 50, 48,  0, 76, 88, 74,
+/* 0x3e30 */  67, 67, 48, 50, 49,  0, 76, 88, 74, 67, 67, 48, 50, 51,  0, 76,
+/* 0x3e40 */  88, 85, 78, 70, 48, 51, 55,  0, 76, 88, 85, 78, 70, 51, 56, 54,
+/* 0x3e50 */   0, 76, 88, 85, 78, 70, 51, 56, 55,  0, 76, 88, 85, 78, 70, 51,
+/* 0x3e60 */  56, 56,  0, 76, 88, 85, 78, 70, 52, 56, 54,  0, 76, 88, 85, 78,
+/* 0x3e70 */  70, 52, 56, 55,  0, 76, 88, 77, 82, 85, 48, 54, 53,  0, 77, 82,
+/* 0x3e80 */  85, 66, 89, 84, 69, 51,  0, 77, 82, 85, 65, 82, 66, 51, 48,  0,
+/* 0x3e90 */  77, 82, 85, 66, 73, 84, 83, 51,  0, 77, 82, 85, 65, 82, 66, 52,
+/* 0x3ea0 */  48,  0, 76, 88, 77, 82, 85, 48, 55, 48,  0, 77, 82, 85, 66, 89,
+/* 0x3eb0 */  84, 69, 52,  0, 77, 82, 85, 66, 73, 84, 83, 52,  0, 77, 82, 85,
+/* 0x3ec0 */  65, 82, 66, 53, 48,  0, 76, 88, 77, 82, 85, 48, 56, 48,  0, 77,
+/* 0x3ed0 */  82, 85, 66, 89, 84, 69, 53,  0, 77, 82, 85, 65, 82, 66, 54, 48,
+/* 0x3ee0 */   0, 77, 82, 85, 66, 73, 84, 83, 53,  0, 77, 82, 85, 65, 82, 66,
+/* 0x3ef0 */  55, 48,  0, 76, 88, 77, 82, 85, 48, 57, 48,  0, 77, 82, 85, 66,
+/* 0x3f00 */  89, 84, 69, 54,  0, 77, 82, 85, 65, 82, 66, 56, 48,  0, 77, 82,
+/* 0x3f10 */  85, 66, 73, 84, 83, 54,  0, 77, 82, 85, 65, 82, 66, 57, 48,  0,
+/* 0x3f20 */  76, 88, 77, 82, 85, 49, 48, 48,  0, 76, 88, 85, 78, 70, 48, 52,
+/* 0x3f30 */  48,  0, 76, 88, 77, 82, 85, 49, 49, 48,  0, 76, 88, 77, 82, 85,
+/* 0x3f40 */  49, 49, 49,  0, 76, 88, 85, 78, 70, 48, 52, 49,  0, 76, 88, 85,
+/* 0x3f50 */  78, 70, 48, 52, 50,  0, 76, 69, 88, 69, 67, 48, 49, 54,  0, 76,
+/* 0x3f60 */  88, 77, 82, 85, 48, 49, 48,  0, 76, 88, 74, 77, 80, 65, 48, 48,
+/* 0x3f70 */   0, 76, 88, 67, 65, 76, 76, 66, 48,  0, 76, 88, 85, 78, 70, 48,
+/* 0x3f80 */  50, 49,  0, 76, 88, 77, 82, 85, 48, 50, 50,  0, 76, 88, 74, 77,
+/* 0x3f90 */  80, 65, 48, 49,  0, 76, 88, 67, 65, 76, 76, 66, 49,  0, 77, 82,
+/* 0x3fa0 */  85, 66, 73, 84, 83, 49,  0, 76, 88, 77, 82, 85, 48, 51, 48,  0,
+/* 0x3fb0 */  77, 82, 85, 66, 89, 84, 69, 49,  0, 77, 82, 85, 65, 82, 66, 49,
+/* 0x3fc0 */  48,  0, 76, 88, 77, 82, 85, 48, 52, 48,  0, 76, 88, 85, 78, 70,
+/* 0x3fd0 */  48, 51, 48,  0, 76, 88, 74, 67, 67, 48, 48, 48,  0, 76, 88, 67,
+/* 0x3fe0 */  74, 48, 77, 82, 85,  0, 76, 88, 67, 74, 49, 77, 82, 85,  0, 76,
+/* 0x3ff0 */  88, 67, 65, 76, 74, 77, 80,  0, 76, 88, 67, 65, 76, 76, 48, 48,
+/* 0x4000 */   0, 76, 88, 67, 65, 76, 76, 48, 49,  0, 76, 88, 67, 74, 50, 77,
+/* 0x4010 */  82, 85,  0, 76, 88, 67, 74, 52, 77, 82, 85,  0, 76, 88, 67, 74,
+/* 0x4020 */  54, 77, 82, 85,  0, 76, 88, 67, 74, 55, 77, 82, 85,  0, 76, 88,
+/* 0x4030 */  67, 74, 56, 77, 82, 85,  0, 76, 88, 85, 78, 70, 48, 51, 52,  0,
+/* 0x4040 */  76, 88, 77, 82, 85, 48, 53, 53,  0, 77, 82, 85, 66, 89, 84, 69,
+/* 0x4050 */  50,  0, 77, 82, 85, 66, 73, 84, 83, 50,  0, 77, 82, 85, 65, 82,
+/* 0x4060 */  66, 50, 48,  0, 76, 88, 77, 82, 85, 48, 53, 55,  0, 76, 88, 77,
+/* 0x4070 */  82, 85, 48, 53, 56,  0, 76, 88, 85, 78, 70, 48, 51, 53,  0, 99,
+/* 0x4080 */ 116,111,107, 51, 50, 46, 48, 48,  0, 99,116,111,107, 51, 50, 46,
+/* 0x4090 */  49, 48,  0, 99,116,111,107, 51, 50, 46, 50, 48,  0, 99,116,111,
+/* 0x40a0 */ 107, 51, 50, 46, 51, 48,  0, 99,116,111,107, 51, 50, 46, 52, 48,
+/* 0x40b0 */   0, 76, 69, 88, 69, 67, 48, 49, 55,  0, 76, 69, 88, 69, 67, 48,
+/* 0x40c0 */  50, 48,  0, 76, 85, 78, 77, 80, 48, 48, 48,  0, 76, 85, 78, 77,
+/* 0x40d0 */  80, 48, 48, 49,  0, 76, 69, 88, 69, 67, 48, 50, 53,  0, 76, 69,
+/* 0x40e0 */  88, 69, 67, 68, 89, 78,  0, 95,115,116, 97,114,116,  0,108,122,
+/* 0x40f0 */ 109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116,  0,
+/* 0x4100 */ 108,122,109, 97, 95,117, 95,108,101,110,  0,108,122,109, 97, 95,
+/* 0x4110 */  99, 95,108,101,110,  0,108,122,109, 97, 95,112,114,111,112,101,
+/* 0x4120 */ 114,116,105,101,115,  0,102,105,108,116,101,114, 95,108,101,110,
+/* 0x4130 */ 103,116,104,  0,102,105,108,116,101,114, 95, 99,116,111,  0, 78,
+/* 0x4140 */  77, 82, 85,  0, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,  0, 82,
+/* 0x4150 */  95, 51, 56, 54, 95, 80, 67, 56,  0, 82, 95, 51, 56, 54, 95, 51,
+/* 0x4160 */  50,  0, 82, 95, 51, 56, 54, 95, 56,  0,  4, 28,  0,  0, 85, 80,
+/* 0x4170 */  88, 35, 79, 66, 74, 49
 };
@@ -1,5 +1,5 @@
 /* mips.r3000-linux.elf-entry.h
-   created from mips.r3000-linux.elf-entry.bin, 9644 (0x25ac) bytes
+   created from mips.r3000-linux.elf-entry.bin, 7905 (0x1ee1) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_SIZE    9644
-#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_ADLER32 0x538e03ee
-#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_CRC32   0xa88024f1
+#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_SIZE    7905
+#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_ADLER32 0x2f182384
+#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_CRC32   0x0fb17ebe
 
-unsigned char stub_mips_r3000_linux_elf_entry[9644] = {
+unsigned char stub_mips_r3000_linux_elf_entry[7905] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0,  8,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 28,132,  0,  0,  0,  1,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -481,162 +481,54 @@ unsigned char stub_mips_r3000_linux_elf_entry[9644] = {
 /* 0x1ba0 */   0,  8, 36,  8,  0,  6,  4, 17,255,249,  3,160, 32, 33,  4, 17,
 /* 0x1bb0 */ 255,247,  2,192, 32, 33,140,131,  0,  0, 36,132,  0,  8, 16,104,
 /* 0x1bc0 */   0,  3,140,130,255,252, 20, 96,255,251, 36,  2, 16,  0,  0,  2,
-/* 0x1bd0 */ 224, 34,  4, 17,255,191, 39,244,  0,  4,  0,  0,  0,  0,102,105,
-/* 0x1be0 */ 108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,
-/* 0x1bf0 */  98,105,103,109,105,112,115, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x1c00 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x1c10 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1c20 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x1c30 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x1c40 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70,
-/* 0x1c50 */  77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1c60 */  48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1c70 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51,
-/* 0x1c80 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1c90 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1ca0 */  76, 89, 10, 32, 32, 49, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32,
-/* 0x1cb0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 53, 52, 32, 32, 48,
-/* 0x1cc0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cd0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 99, 32, 32, 50, 42, 42,
-/* 0x1ce0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1cf0 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50,
-/* 0x1d00 */  32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1d10 */  48, 48, 48, 48, 49, 52, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d20 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1d30 */  48, 48, 49, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1d40 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1d50 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 50, 66,
-/* 0x1d60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 50,
-/* 0x1d70 */  56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1d80 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,100, 52, 32,
-/* 0x1d90 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1da0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1db0 */  10, 32, 32, 52, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32,
-/* 0x1dc0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 57, 99, 32, 32, 48, 48, 48,
-/* 0x1dd0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1de0 */  32, 48, 48, 48, 48, 48, 51,102, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1df0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1e00 */  78, 76, 89, 10, 32, 32, 53, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1e10 */  50, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97,100, 56, 32, 32,
-/* 0x1e20 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1e30 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 57, 56, 32, 32, 50, 42,
-/* 0x1e40 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1e50 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95,
-/* 0x1e60 */  68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97,100,
-/* 0x1e70 */  56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1e80 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,102, 55, 48, 32,
-/* 0x1e90 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1ea0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90,
-/* 0x1eb0 */  77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1ec0 */  48, 48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1ed0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97,
-/* 0x1ee0 */  52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1ef0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56,
-/* 0x1f00 */  32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1f10 */  48, 48, 48, 48, 48, 49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f20 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1f30 */  48, 49, 97, 52, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1f40 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1f50 */  32, 32, 57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32,
-/* 0x1f60 */  32, 32, 48, 48, 48, 48, 48, 48, 49, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1f70 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1f80 */  48, 48, 48, 48, 49, 97, 53, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1f90 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x1fa0 */  76, 89, 10, 32, 49, 48, 32, 67, 70, 76, 85, 83, 72, 32, 32, 32,
-/* 0x1fb0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 52, 32, 32, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fd0 */  48, 32, 32, 48, 48, 48, 48, 49, 97, 54, 99, 32, 32, 50, 42, 42,
-/* 0x1fe0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1ff0 */  68, 79, 78, 76, 89, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65, 73,
-/* 0x2000 */  78, 89, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 97,
-/* 0x2010 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2020 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 57, 48, 32, 32,
-/* 0x2030 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2040 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2050 */  32, 49, 50, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32,
-/* 0x2060 */  32, 32, 48, 48, 48, 48, 48, 49, 50, 52, 32, 32, 48, 48, 48, 48,
-/* 0x2070 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2080 */  48, 48, 48, 48, 49, 97, 98, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2090 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x20a0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76,
-/* 0x20b0 */  32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20c0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73,
-/* 0x20d0 */  76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 84,
-/* 0x20e0 */  65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x20f0 */  32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,  9, 48, 48,
-/* 0x2100 */  48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x2110 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2120 */  32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2130 */  48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48,
-/* 0x2140 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x2150 */  50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50,
-/* 0x2160 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2170 */ 100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2180 */  48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2190 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48,
-/* 0x21a0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x21b0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x21c0 */  90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x21d0 */  48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48,
-/* 0x21e0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x21f0 */  90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2200 */  48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2210 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x2220 */  90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2230 */  48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x2240 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x2250 */  90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2260 */  48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48,
-/* 0x2270 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x2280 */  82, 86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2290 */  32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x22a0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83,
-/* 0x22b0 */  72,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 70, 76, 85, 83,
-/* 0x22c0 */  72, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x22d0 */ 100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48,
-/* 0x22e0 */  48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10, 48, 48,
-/* 0x22f0 */  48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 79, 32, 69,
-/* 0x2300 */  76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2310 */  32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2320 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,  9, 48,
-/* 0x2330 */  48, 48, 48, 48, 48, 48, 48, 32, 79, 95, 66, 73, 78, 70, 79, 10,
-/* 0x2340 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x2350 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78,
-/* 0x2360 */  88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x2370 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x2380 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95,
-/* 0x2390 */  77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x23a0 */  69, 76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x23b0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x23c0 */  32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x23d0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x23e0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x23f0 */  48, 55, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32,
-/* 0x2400 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10,
-/* 0x2410 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x2420 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10,
-/* 0x2430 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x2440 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x2450 */  10, 48, 48, 48, 48, 48, 48, 55, 99, 32, 82, 95, 77, 73, 80, 83,
-/* 0x2460 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95,
-/* 0x2470 */  84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x2480 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x2490 */  86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x24a0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x24b0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 54, 52, 32,
-/* 0x24c0 */  82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x24d0 */  32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79,
-/* 0x24e0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x24f0 */  79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 89, 93, 58, 10, 79,
-/* 0x2500 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x2510 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x2520 */  48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 77, 73, 80, 83, 95,
-/* 0x2530 */  80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65,
-/* 0x2540 */  73, 78, 90, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x2550 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70,
-/* 0x2560 */  77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x2570 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2580 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 49, 50,
-/* 0x2590 */  48, 32, 82, 95, 77, 73, 80, 83, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x25a0 */  32, 32, 32, 32, 79, 95, 66, 73, 78, 70, 79, 10
+/* 0x1bd0 */ 224, 34,  4, 17,255,191, 39,244,  0,  4,  0,  0,  0,  0, 13,  0,
+/* 0x1be0 */   0,  0, 15,  0,  0,  0,  6,  0,  0,  0,151,  0,  0,  0,  0,  0,
+/* 0x1bf0 */   0,  0,  8,  0,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x1c00 */   0,  0, 84,  1,  0,  0, 60,  0,  0,  0,  0,  0,  0,  0, 15,  0,
+/* 0x1c10 */   0,  0, 68,  1,  0,  0,144,  1,  0,  0,  0,  0,  0,  0, 21,  0,
+/* 0x1c20 */   0,  0, 40,  1,  0,  0,212,  2,  0,  0,  0,  0,  0,  0, 27,  0,
+/* 0x1c30 */   0,  0,156,  0,  0,  0,252,  3,  0,  0,  0,  0,  0,  0, 38,  0,
+/* 0x1c40 */   0,  0,216, 10,  0,  0,152,  4,  0,  0,  0,  0,  0,  0, 49,  0,
+/* 0x1c50 */   0,  0,216, 10,  0,  0,112, 15,  0,  0,  0,  0,  0,  0, 60,  0,
+/* 0x1c60 */   0,  0,  4,  0,  0,  0, 72, 26,  0,  0,  0,  0,  0,  0, 71,  0,
+/* 0x1c70 */   0,  0, 16,  0,  0,  0, 76, 26,  0,  0,  0,  0,  0,  0, 80,  0,
+/* 0x1c80 */   0,  0, 16,  0,  0,  0, 92, 26,  0,  0,  0,  0,  0,  0, 89,  0,
+/* 0x1c90 */   0,  0, 36,  0,  0,  0,108, 26,  0,  0,  0,  0,  0,  0, 96,  0,
+/* 0x1ca0 */   0,  0, 42,  0,  0,  0,144, 26,  0,  0,  0,  0,  0,  0,105,  0,
+/* 0x1cb0 */   0,  0, 36,  1,  0,  0,186, 26,  0,  0,  0,  0,  0,  0, 80,  0,
+/* 0x1cc0 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,105,  0,
+/* 0x1cd0 */   0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x1cf0 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,
+/* 0x1d00 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 21,  0,
+/* 0x1d10 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,
+/* 0x1d20 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,  0,
+/* 0x1d30 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,
+/* 0x1d40 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,
+/* 0x1d50 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 71,  0,
+/* 0x1d60 */   0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,
+/* 0x1d70 */   0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 96,  0,
+/* 0x1d80 */   0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,114,  0,
+/* 0x1d90 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,121,  0,
+/* 0x1da0 */   0,  0, 14,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,  0,  0,
+/* 0x1db0 */   0,  0,  0,  0,  0,  0,129,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1dc0 */   0,  0,  0,  0,  0,  0,  1,  0,  0,  0,124,  0,  0,  0,129,  0,
+/* 0x1dd0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,
+/* 0x1de0 */   0,  0,124,  0,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0,100,  0,  0,  0,129,  0,
+/* 0x1e00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x1e10 */   0,  0,  4,  0,  0,  0,129,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 32,  1,  0,  0,141,  0,
+/* 0x1e30 */   0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69, 76,
+/* 0x1e40 */  70, 77, 65, 73, 78, 88,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86,
+/* 0x1e50 */  50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76,
+/* 0x1e60 */  70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76,
+/* 0x1e70 */  90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x1e80 */  69, 67, 51, 48,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82,
+/* 0x1e90 */  86, 95, 84, 65, 73, 76,  0, 67, 70, 76, 85, 83, 72,  0, 69, 76,
+/* 0x1ea0 */  70, 77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0,
+/* 0x1eb0 */  95,115,116, 97,114,116,  0, 79, 95, 66, 73, 78, 70, 79,  0, 82,
+/* 0x1ec0 */  95, 77, 73, 80, 83, 95, 80, 67, 49, 54,  0, 82, 95, 77, 73, 80,
+/* 0x1ed0 */  83, 95, 51, 50,  0,222, 27,  0,  0, 85, 80, 88, 35, 79, 66, 74,
+/* 0x1ee0 */  49
 };
@@ -1,5 +1,5 @@
 /* mips.r3000-linux.shlib-init.h
-   created from mips.r3000-linux.shlib-init.bin, 10071 (0x2757) bytes
+   created from mips.r3000-linux.shlib-init.bin, 8496 (0x2130) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_SIZE    10071
-#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_ADLER32 0x662384fd
-#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_CRC32   0xc06781e5
+#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_SIZE    8496
+#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_ADLER32 0xb8d4cabb
+#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_CRC32   0x65eaa65d
 
-unsigned char stub_mips_r3000_linux_shlib_init[10071] = {
+unsigned char stub_mips_r3000_linux_shlib_init[8496] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0,  8,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 30,220,  0,  0,  0,  1,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -519,151 +519,52 @@ unsigned char stub_mips_r3000_linux_shlib_init[10071] = {
 /* 0x1e00 */ 175,164,  0, 20,  0,128, 40, 33,  0,192, 32, 33, 36,  6,  0,  0,
 /* 0x1e10 */  36,  2, 16, 51,  0,  0,  0, 12,143,185,  0, 20,  3, 32,  0,  8,
 /* 0x1e20 */   0,  0,  0,  0,140,231,255,248,  0,  7, 60,  0,  0,  7, 60,  2,
-/* 0x1e30 */  36,231,255,255,  3,224,  0,  8,  0,199, 48, 33,102,105,108,101,
-/* 0x1e40 */  32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45, 98,105,
-/* 0x1e50 */ 103,109,105,112,115, 10, 10, 83,101, 99,116,105,111,110,115, 58,
-/* 0x1e60 */  10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e70 */  32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65,
-/* 0x1e80 */  32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32,
-/* 0x1e90 */  32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32,
-/* 0x1ea0 */  32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65,
-/* 0x1eb0 */  73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 99,
-/* 0x1ec0 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1ed0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32,
-/* 0x1ee0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1ef0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1f00 */  10, 32, 32, 49, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32,
-/* 0x1f10 */  32, 32, 32, 48, 48, 48, 48, 48, 49, 53, 52, 32, 32, 48, 48, 48,
-/* 0x1f20 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1f30 */  32, 48, 48, 48, 48, 48, 48,102, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1f40 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x1f50 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 78,
-/* 0x1f60 */  82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1f70 */  48, 48, 49, 52, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1f80 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1f90 */  50, 52, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1fa0 */  78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68,
-/* 0x1fb0 */  79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 50, 66, 32, 32,
-/* 0x1fc0 */  32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 50, 56, 32,
-/* 0x1fd0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1fe0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 57, 48, 32, 32, 50,
-/* 0x1ff0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2000 */  69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2010 */  32, 52, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32,
-/* 0x2020 */  32, 48, 48, 48, 48, 48, 48, 57, 99, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2030 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2040 */  48, 48, 48, 48, 52, 98, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2050 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2060 */  89, 10, 32, 32, 53, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2070 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 97,100, 56, 32, 32, 48, 48,
-/* 0x2080 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2090 */  32, 32, 48, 48, 48, 48, 48, 53, 53, 52, 32, 32, 50, 42, 42, 48,
-/* 0x20a0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x20b0 */  79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x20c0 */  67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 97,100, 56, 32,
-/* 0x20d0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x20e0 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 48, 50, 99, 32, 32, 50,
-/* 0x20f0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2100 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90, 77, 65,
-/* 0x2110 */  95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2120 */  48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x2130 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 48, 52,
-/* 0x2140 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2150 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 78,
-/* 0x2160 */  82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x2170 */  48, 48, 48, 49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2180 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49,
-/* 0x2190 */  98, 48, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x21a0 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x21b0 */  57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32,
-/* 0x21c0 */  48, 48, 48, 48, 48, 48, 49, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x21d0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x21e0 */  48, 48, 49, 98, 49, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x21f0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x2200 */  10, 32, 49, 48, 32, 67, 70, 76, 85, 83, 72, 32, 32, 32, 32, 32,
-/* 0x2210 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 52, 32, 32, 48, 48, 48,
-/* 0x2220 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2230 */  32, 48, 48, 48, 48, 49, 98, 50, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2240 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x2250 */  78, 76, 89, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 89,
-/* 0x2260 */  32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2270 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2280 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 52, 99, 32, 32, 50, 42,
-/* 0x2290 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x22a0 */  65, 68, 79, 78, 76, 89, 10, 32, 49, 50, 32, 69, 76, 70, 77, 65,
-/* 0x22b0 */  73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 50,102,
-/* 0x22c0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x22d0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 98, 52, 99, 32,
-/* 0x22e0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x22f0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76,
-/* 0x2300 */  32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2310 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73,
-/* 0x2320 */  76,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 84,
-/* 0x2330 */  65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2340 */  32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,  9, 48, 48,
-/* 0x2350 */  48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x2360 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2370 */  32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2380 */  48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48,
-/* 0x2390 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x23a0 */  50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50,
-/* 0x23b0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x23c0 */ 100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23d0 */  48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23e0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48,
-/* 0x23f0 */  48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x2400 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x2410 */  90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2420 */  48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48,
-/* 0x2430 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x2440 */  90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2450 */  48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2460 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x2470 */  90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2480 */  48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x2490 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x24a0 */  90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48,
-/* 0x24b0 */  48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48,
-/* 0x24c0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x24d0 */  82, 86, 95, 72, 69, 65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24e0 */  32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x24f0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83,
-/* 0x2500 */  72,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 70, 76, 85, 83,
-/* 0x2510 */  72, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2520 */ 100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48,
-/* 0x2530 */  48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10, 48, 48,
-/* 0x2540 */  48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 79, 32, 69,
-/* 0x2550 */  76, 70, 77, 65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2560 */  32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2570 */  32,103, 32, 32, 32, 32, 32, 79, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x2580 */  89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,101,110,100, 95,100,
-/* 0x2590 */ 101, 99,111,109,112,114,101,115,115, 10, 10, 82, 69, 76, 79, 67,
-/* 0x25a0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x25b0 */  82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70,
-/* 0x25c0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x25d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x25e0 */  48, 48, 48, 48, 48, 49, 56, 32, 82, 95, 77, 73, 80, 83, 95, 76,
-/* 0x25f0 */  79, 49, 54, 32, 32, 32, 32, 32, 32, 32, 95,115,116, 97,114,116,
-/* 0x2600 */  10, 48, 48, 48, 48, 48, 48, 50, 48, 32, 82, 95, 77, 73, 80, 83,
-/* 0x2610 */  95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77,
-/* 0x2620 */  65, 73, 78, 90, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x2630 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x2640 */  86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x2650 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2660 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 99, 32,
-/* 0x2670 */  82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x2680 */  32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79,
-/* 0x2690 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x26a0 */  79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83,
-/* 0x26b0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x26c0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x26d0 */  48, 48, 48, 55, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x26e0 */  54, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x26f0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2700 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93,
-/* 0x2710 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x2720 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x2730 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 54, 52, 32, 82, 95, 77, 73,
-/* 0x2740 */  80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2750 */  86, 95, 84, 65, 73, 76, 10
+/* 0x1e30 */  36,231,255,255,  3,224,  0,  8,  0,199, 48, 33, 13,  0,  0,  0,
+/* 0x1e40 */  15,  0,  0,  0,  5,  0,  0,  0,160,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */ 196,  0,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1e60 */  84,  1,  0,  0,248,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1e70 */  68,  1,  0,  0, 76,  2,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,
+/* 0x1e80 */  40,  1,  0,  0,144,  3,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1e90 */ 156,  0,  0,  0,184,  4,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0,
+/* 0x1ea0 */ 216, 10,  0,  0, 84,  5,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,
+/* 0x1eb0 */ 216, 10,  0,  0, 44, 16,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,
+/* 0x1ec0 */   4,  0,  0,  0,  4, 27,  0,  0,  0,  0,  0,  0, 71,  0,  0,  0,
+/* 0x1ed0 */  16,  0,  0,  0,  8, 27,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,
+/* 0x1ee0 */  16,  0,  0,  0, 24, 27,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,
+/* 0x1ef0 */  36,  0,  0,  0, 40, 27,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0,
+/* 0x1f00 */   0,  0,  0,  0, 76, 27,  0,  0,  0,  0,  0,  0,105,  0,  0,  0,
+/* 0x1f10 */ 240,  2,  0,  0, 76, 27,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,
+/* 0x1f20 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0,
+/* 0x1f30 */  12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1f50 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1f60 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,
+/* 0x1f70 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1f80 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0,
+/* 0x1f90 */   5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,
+/* 0x1fa0 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,
+/* 0x1fb0 */   7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 71,  0,  0,  0,
+/* 0x1fc0 */   8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,
+/* 0x1fd0 */  10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0,
+/* 0x1fe0 */  11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,  0,
+/* 0x1ff0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,121,  0,  0,  0,
+/* 0x2000 */  11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2010 */  24,  0,  0,  0,136,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2020 */   0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,136,  0,  0,  0,
+/* 0x2030 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2040 */ 124,  0,  0,  0,148,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2050 */   0,  0,  0,  0,  2,  0,  0,  0,124,  0,  0,  0,148,  0,  0,  0,
+/* 0x2060 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2070 */ 100,  0,  0,  0,148,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2080 */   0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,  0, 78, 82, 86,
+/* 0x2090 */  50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76,
+/* 0x20a0 */  90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x20b0 */  69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0,
+/* 0x20c0 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 78, 82, 86, 95, 72,
+/* 0x20d0 */  69, 65, 68,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 67, 70, 76,
+/* 0x20e0 */  85, 83, 72,  0, 69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70,
+/* 0x20f0 */  77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,  0,101,110,100,
+/* 0x2100 */  95,100,101, 99,111,109,112,114,101,115,115,  0, 82, 95, 77, 73,
+/* 0x2110 */  80, 83, 95, 76, 79, 49, 54,  0, 82, 95, 77, 73, 80, 83, 95, 80,
+/* 0x2120 */  67, 49, 54,  0, 60, 30,  0,  0, 85, 80, 88, 35, 79, 66, 74, 49
 };
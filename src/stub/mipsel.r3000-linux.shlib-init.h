@@ -1,5 +1,5 @@
 /* mipsel.r3000-linux.shlib-init.h
-   created from mipsel.r3000-linux.shlib-init.bin, 9954 (0x26e2) bytes
+   created from mipsel.r3000-linux.shlib-init.bin, 8376 (0x20b8) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_MIPSEL_R3000_LINUX_SHLIB_INIT_SIZE    9954
-#define STUB_MIPSEL_R3000_LINUX_SHLIB_INIT_ADLER32 0xa43e7017
-#define STUB_MIPSEL_R3000_LINUX_SHLIB_INIT_CRC32   0xd7e8606f
+#define STUB_MIPSEL_R3000_LINUX_SHLIB_INIT_SIZE    8376
+#define STUB_MIPSEL_R3000_LINUX_SHLIB_INIT_ADLER32 0x427db6d7
+#define STUB_MIPSEL_R3000_LINUX_SHLIB_INIT_CRC32   0xafaf26af
 
-unsigned char stub_mipsel_r3000_linux_shlib_init[9954] = {
+unsigned char stub_mipsel_r3000_linux_shlib_init[8376] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  8,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 100, 30,  0,  0,  1,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -512,151 +512,52 @@ unsigned char stub_mipsel_r3000_linux_shlib_init[9954] = {
 /* 0x1d90 */  33, 32,192,  0,  0,  0,  6, 36, 51, 16,  2, 36, 12,  0,  0,  0,
 /* 0x1da0 */  20,  0,185,143,  8,  0, 32,  3,  0,  0,  0,  0,248,255,231,140,
 /* 0x1db0 */   0, 60,  7,  0,  2, 60,  7,  0,255,255,231, 36,  8,  0,224,  3,
-/* 0x1dc0 */  33, 48,199,  0,102,105,108,101, 32,102,111,114,109, 97,116, 32,
-/* 0x1dd0 */ 101,108,102, 51, 50, 45,108,105,116,116,108,101,109,105,112,115,
-/* 0x1de0 */  10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32,
-/* 0x1df0 */  78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,
-/* 0x1e00 */ 122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32,
-/* 0x1e10 */  32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101,
-/* 0x1e20 */  32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,
-/* 0x1e30 */ 115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32,
-/* 0x1e40 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 99, 52, 32, 32, 48, 48,
-/* 0x1e50 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e60 */  32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32, 32, 50, 42, 42, 48,
-/* 0x1e70 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x1e80 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32,
-/* 0x1e90 */  78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x1ea0 */  48, 48, 48, 49, 50, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1eb0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1ec0 */  48, 48,102, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1ed0 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x1ee0 */  68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 78, 82, 86, 50, 68, 32,
-/* 0x1ef0 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 49, 99,
-/* 0x1f00 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1f10 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50, 50, 52, 32, 32,
-/* 0x1f20 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1f30 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1f40 */  32, 32, 51, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f50 */  32, 32, 48, 48, 48, 48, 48, 49, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1f60 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1f70 */  48, 48, 48, 48, 48, 51, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1f80 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1f90 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 76, 90,
-/* 0x1fa0 */  77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1fb0 */  48, 48, 57, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1fc0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52,
-/* 0x1fd0 */  52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1fe0 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53,
-/* 0x1ff0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48,
-/* 0x2000 */  48, 48, 48, 48, 97,100, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2010 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x2020 */  48, 48, 52,100, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2030 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x2040 */  32, 32, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32,
-/* 0x2050 */  32, 32, 48, 48, 48, 48, 48, 97,100, 56, 32, 32, 48, 48, 48, 48,
-/* 0x2060 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2070 */  48, 48, 48, 48, 48,102, 98, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2080 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x2090 */  76, 89, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x20a0 */  48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48,
-/* 0x20b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20c0 */  48, 32, 32, 48, 48, 48, 48, 49, 97, 56, 99, 32, 32, 50, 42, 42,
-/* 0x20d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x20e0 */  68, 79, 78, 76, 89, 10, 32, 32, 56, 32, 78, 82, 86, 95, 72, 69,
-/* 0x20f0 */  65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49, 48,
-/* 0x2100 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2110 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 57, 48, 32, 32,
-/* 0x2120 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x2130 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 78, 82, 86,
-/* 0x2140 */  95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2150 */  48, 49, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2160 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 97, 97,
-/* 0x2170 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2180 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48, 32,
-/* 0x2190 */  67, 70, 76, 85, 83, 72, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48,
-/* 0x21a0 */  48, 48, 48, 48, 50, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21b0 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x21c0 */  49, 97, 98, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x21d0 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x21e0 */  49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32,
-/* 0x21f0 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2200 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x2210 */  48, 48, 48, 49, 97,100, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2220 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x2230 */  89, 10, 32, 49, 50, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 32,
-/* 0x2240 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 50,102, 48, 32, 32, 48, 48,
-/* 0x2250 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2260 */  32, 32, 48, 48, 48, 48, 49, 97,100, 52, 32, 32, 50, 42, 42, 48,
-/* 0x2270 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x2280 */  79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76,
-/* 0x2290 */  69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x22a0 */  32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48,
-/* 0x22b0 */  48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48,
-/* 0x22c0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x22d0 */  69, 76, 70, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22e0 */  48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48,
-/* 0x22f0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77,
-/* 0x2300 */  65, 73, 78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76,
-/* 0x2310 */  70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2320 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69,  9, 48, 48,
-/* 0x2330 */  48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x2340 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x2350 */  86, 50, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86,
-/* 0x2360 */  50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2370 */  32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48, 48,
-/* 0x2380 */  48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2390 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69,
-/* 0x23a0 */  76, 70, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x23b0 */  77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x23d0 */  69, 67, 50, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x23e0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2400 */  69, 67, 49, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x2410 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2420 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2430 */  69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x2440 */  77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2450 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69,
-/* 0x2460 */  65, 68,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95,
-/* 0x2470 */  72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2480 */  32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83, 72,  9, 48, 48, 48,
-/* 0x2490 */  48, 48, 48, 48, 48, 32, 67, 70, 76, 85, 83, 72, 10, 48, 48, 48,
-/* 0x24a0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76,
-/* 0x24b0 */  70, 77, 65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x24c0 */  69, 76, 70, 77, 65, 73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24d0 */  48, 32,103, 32, 32, 32, 32, 32, 79, 32, 69, 76, 70, 77, 65, 73,
-/* 0x24e0 */  78, 88,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 95,115,116, 97,
-/* 0x24f0 */ 114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32,
-/* 0x2500 */  32, 32, 79, 32, 69, 76, 70, 77, 65, 73, 78, 89,  9, 48, 48, 48,
-/* 0x2510 */  48, 48, 48, 48, 48, 32,101,110,100, 95,100,101, 99,111,109,112,
-/* 0x2520 */ 114,101,115,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x2530 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76,
-/* 0x2540 */  70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x2550 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2560 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2570 */  49, 56, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32,
-/* 0x2580 */  32, 32, 32, 32, 32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48,
-/* 0x2590 */  48, 48, 50, 48, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54,
-/* 0x25a0 */  32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x25b0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x25c0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58,
-/* 0x25d0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x25e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x25f0 */  69, 10, 48, 48, 48, 48, 48, 48, 55, 99, 32, 82, 95, 77, 73, 80,
-/* 0x2600 */  83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2610 */  95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x2620 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x2630 */  82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x2640 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2650 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 99,
-/* 0x2660 */  32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32,
-/* 0x2670 */  32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76,
-/* 0x2680 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x2690 */  70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70,
-/* 0x26a0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x26b0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x26c0 */  48, 48, 48, 48, 54, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67,
-/* 0x26d0 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73,
-/* 0x26e0 */  76, 10
+/* 0x1dc0 */  33, 48,199,  0, 13,  0,  0,  0, 15,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1dd0 */ 160,  0,  0,  0,  0,  0,  0,  0,196,  0,  0,  0, 52,  0,  0,  0,
+/* 0x1de0 */   0,  0,  0,  0,  9,  0,  0,  0, 44,  1,  0,  0,248,  0,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0, 15,  0,  0,  0, 28,  1,  0,  0, 36,  2,  0,  0,
+/* 0x1e00 */   0,  0,  0,  0, 21,  0,  0,  0,  0,  1,  0,  0, 64,  3,  0,  0,
+/* 0x1e10 */   0,  0,  0,  0, 27,  0,  0,  0,156,  0,  0,  0, 64,  4,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0, 38,  0,  0,  0,216, 10,  0,  0,220,  4,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0, 49,  0,  0,  0,216, 10,  0,  0,180, 15,  0,  0,
+/* 0x1e40 */   0,  0,  0,  0, 60,  0,  0,  0,  4,  0,  0,  0,140, 26,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0, 71,  0,  0,  0, 16,  0,  0,  0,144, 26,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0, 80,  0,  0,  0, 16,  0,  0,  0,160, 26,  0,  0,
+/* 0x1e70 */   0,  0,  0,  0, 89,  0,  0,  0, 36,  0,  0,  0,176, 26,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0,212, 26,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0,105,  0,  0,  0,240,  2,  0,  0,212, 26,  0,  0,
+/* 0x1ea0 */   0,  0,  0,  0, 80,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0,105,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ed0 */   0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0, 15,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0, 21,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f00 */   0,  0,  0,  0, 27,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0, 38,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f20 */   0,  0,  0,  0, 49,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f30 */   0,  0,  0,  0, 60,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0, 71,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f50 */   0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f60 */   0,  0,  0,  0, 96,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0,121,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f90 */   0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,136,  0,  0,  0,
+/* 0x1fa0 */  13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fb0 */  32,  0,  0,  0,136,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fc0 */   0,  0,  0,  0,  1,  0,  0,  0,124,  0,  0,  0,148,  0,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1fe0 */ 124,  0,  0,  0,148,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ff0 */   0,  0,  0,  0,  3,  0,  0,  0,100,  0,  0,  0,148,  0,  0,  0,
+/* 0x2000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77,
+/* 0x2010 */  65, 73, 78, 88,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,
+/* 0x2020 */   0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48,
+/* 0x2030 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77,
+/* 0x2040 */  65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x2050 */  51, 48,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 95,
+/* 0x2060 */  84, 65, 73, 76,  0, 67, 70, 76, 85, 83, 72,  0, 69, 76, 70, 77,
+/* 0x2070 */  65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,
+/* 0x2080 */ 116, 97,114,116,  0,101,110,100, 95,100,101, 99,111,109,112,114,
+/* 0x2090 */ 101,115,115,  0, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54,  0,
+/* 0x20a0 */  82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54,  0,196, 29,  0,  0,
+/* 0x20b0 */  85, 80, 88, 35, 79, 66, 74, 49
 };
@@ -1,5 +1,5 @@
 /* powerpc-linux.elf-entry.h
-   created from powerpc-linux.elf-entry.bin, 9046 (0x2356) bytes
+   created from powerpc-linux.elf-entry.bin, 7208 (0x1c28) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC_LINUX_ELF_ENTRY_SIZE    9046
-#define STUB_POWERPC_LINUX_ELF_ENTRY_ADLER32 0xe44b3e52
-#define STUB_POWERPC_LINUX_ELF_ENTRY_CRC32   0xa2c50c72
+#define STUB_POWERPC_LINUX_ELF_ENTRY_SIZE    7208
+#define STUB_POWERPC_LINUX_ELF_ENTRY_ADLER32 0x4fa54565
+#define STUB_POWERPC_LINUX_ELF_ENTRY_CRC32   0x16f46c65
 
-unsigned char stub_powerpc_linux_elf_entry[9046] = {
+unsigned char stub_powerpc_linux_elf_entry[7208] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0, 20,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 25,176,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -435,171 +435,56 @@ unsigned char stub_powerpc_linux_elf_entry[9046] = {
 /* 0x18c0 */   2,166, 56, 97,  0,144, 75,255,255,221, 75,255,255,217,124,122,
 /* 0x18d0 */  27,120,128,  3,  0,  0,128,131,  0,  4, 56, 99,  0,  8, 47,128,
 /* 0x18e0 */   0,  6, 65,158,  0, 16, 44,  0,  0,  0, 64,130,255,232, 56,128,
-/* 0x18f0 */  16,  0,127,196,  0,208, 75,255,255,  5,  0,  0,  0,  0,102,105,
-/* 0x1900 */ 108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,
-/* 0x1910 */ 112,111,119,101,114,112, 99, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x1920 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x1930 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1940 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x1950 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x1960 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70,
-/* 0x1970 */  77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1980 */  48, 48, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1990 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51,
-/* 0x19a0 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x19b0 */  83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78,
-/* 0x19c0 */  76, 89, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32,
-/* 0x19d0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x19e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 56, 32, 32, 50, 42, 42,
-/* 0x1a00 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65,
-/* 0x1a10 */  68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 78, 82, 86, 50, 69, 32,
-/* 0x1a20 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 52, 56,
-/* 0x1a30 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1a40 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 56, 32, 32,
-/* 0x1a50 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x1a60 */  82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10,
-/* 0x1a70 */  32, 32, 51, 32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1a80 */  32, 32, 48, 48, 48, 48, 48, 49, 50, 99, 32, 32, 48, 48, 48, 48,
-/* 0x1a90 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1aa0 */  48, 48, 48, 48, 48, 49, 56, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1ab0 */  67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44,
-/* 0x1ac0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52, 32, 78, 82,
-/* 0x1ad0 */  86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1ae0 */  48, 48,102, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1af0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 50,
-/* 0x1b00 */  97, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1b10 */  84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1b20 */  78, 76, 89, 10, 32, 32, 53, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x1b30 */  48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 57, 48, 32, 32,
-/* 0x1b40 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1b50 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 51, 57, 99, 32, 32, 50, 42,
-/* 0x1b60 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1b70 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1b80 */  54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32,
-/* 0x1b90 */  48, 48, 48, 48, 48, 57, 57, 99, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1ba0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1bb0 */  48, 48, 48, 52, 50, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1bc0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1bd0 */  10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x1be0 */  32, 32, 32, 48, 48, 48, 48, 48, 57, 57, 99, 32, 32, 48, 48, 48,
-/* 0x1bf0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1c00 */  32, 48, 48, 48, 48, 48,100, 99, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1c10 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1c20 */  78, 76, 89, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1c30 */  51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 52, 32, 32,
-/* 0x1c40 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1c50 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 54, 52, 32, 32, 50, 42,
-/* 0x1c60 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1c70 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 57, 32, 78, 82, 86, 95, 84,
-/* 0x1c80 */  65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 49,
-/* 0x1c90 */  99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1ca0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55, 56, 56, 32,
-/* 0x1cb0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1cc0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 48, 32, 67, 70,
-/* 0x1cd0 */  76, 85, 83, 72, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x1ce0 */  48, 48, 50, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1cf0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55,
-/* 0x1d00 */  97, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1d10 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 49,
-/* 0x1d20 */  32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1d30 */  48, 48, 48, 48, 48, 49, 50, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d40 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1d50 */  48, 49, 55, 99, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1d60 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1d70 */  65, 68, 79, 78, 76, 89, 10, 32, 49, 50, 32, 69, 76, 70, 77, 65,
-/* 0x1d80 */  73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 50,
-/* 0x1d90 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1da0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 55,100, 97, 32,
-/* 0x1db0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1dc0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1dd0 */  10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48,
-/* 0x1de0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1df0 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48,
-/* 0x1e00 */  48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48,
-/* 0x1e10 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1e20 */  78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e30 */  48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48,
-/* 0x1e40 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77,
-/* 0x1e50 */  65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76,
-/* 0x1e60 */  70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1e70 */ 108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,
-/* 0x1e80 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1e90 */  78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1ea0 */  32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48, 48, 48,
-/* 0x1eb0 */  48, 48, 48, 48, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48,
-/* 0x1ec0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1ed0 */  78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x1ee0 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1ef0 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48, 48, 48,
-/* 0x1f00 */  48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x1f10 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x1f20 */  66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 66,
-/* 0x1f30 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1f40 */  32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48, 48,
-/* 0x1f50 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x1f60 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1f70 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48, 48,
-/* 0x1f80 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x1f90 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1fa0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48, 48,
-/* 0x1fb0 */  48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x1fc0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1fd0 */  32, 32, 67, 70, 76, 85, 83, 72,  9, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fe0 */  48, 32, 67, 70, 76, 85, 83, 72, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ff0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73,
-/* 0x2000 */  78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77,
-/* 0x2010 */  65, 73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x2020 */  32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,  9, 48,
-/* 0x2030 */  48, 48, 48, 48, 48, 48, 48, 32, 95,115,116, 97,114,116, 10, 48,
-/* 0x2040 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2050 */  42, 85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 79,
-/* 0x2060 */  95, 66, 73, 78, 70, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x2070 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x2080 */  69, 76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x2090 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x20a0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x20b0 */  48, 48, 48, 48, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 50, 52,
-/* 0x20c0 */  32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 43,
-/* 0x20d0 */  48,120, 48, 48, 48, 48, 48, 48,100, 99, 10, 10, 82, 69, 76, 79,
-/* 0x20e0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x20f0 */  79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2100 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2110 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x2120 */  48, 48, 48, 98, 52, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49,
-/* 0x2130 */  52, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x2140 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2150 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93,
-/* 0x2160 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x2170 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x2180 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 80, 80,
-/* 0x2190 */  67, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x21a0 */  86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x21b0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x21c0 */  78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x21d0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x21e0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 57,
-/* 0x21f0 */  48, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49, 52, 32, 32, 32,
-/* 0x2200 */  32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69,
-/* 0x2210 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x2220 */  32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x2230 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x2240 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x2250 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 80,
-/* 0x2260 */  80, 67, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2270 */  90, 77, 65, 95, 68, 69, 67, 51, 48, 43, 48,120, 48, 48, 48, 48,
-/* 0x2280 */  48, 48, 50, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x2290 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76,
-/* 0x22a0 */  70, 77, 65, 73, 78, 89, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x22b0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22c0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x22d0 */  48, 48, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 50, 52, 32, 32,
-/* 0x22e0 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10, 82,
-/* 0x22f0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x2300 */  83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 90, 93,
-/* 0x2310 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x2320 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x2330 */  85, 69, 10, 48, 48, 48, 48, 48, 49, 50, 48, 32, 82, 95, 80, 80,
-/* 0x2340 */  67, 95, 65, 68, 68, 82, 51, 50, 32, 32, 32, 32, 32, 32, 79, 95,
-/* 0x2350 */  66, 73, 78, 70, 79, 10
+/* 0x18f0 */  16,  0,127,196,  0,208, 75,255,255,  5,  0,  0,  0,  0, 13,  0,
+/* 0x1900 */   0,  0, 15,  0,  0,  0,  7,  0,  0,  0,166,  0,  0,  0,  0,  0,
+/* 0x1910 */   0,  0,  4,  0,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x1920 */   0,  0,  0,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0, 18,  0,
+/* 0x1930 */   0,  0, 72,  1,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0, 24,  0,
+/* 0x1940 */   0,  0, 44,  1,  0,  0,128,  1,  0,  0,  0,  0,  0,  0, 30,  0,
+/* 0x1950 */   0,  0,240,  0,  0,  0,172,  2,  0,  0,  0,  0,  0,  0, 36,  0,
+/* 0x1960 */   0,  0,144,  0,  0,  0,156,  3,  0,  0,  0,  0,  0,  0, 47,  0,
+/* 0x1970 */   0,  0,156,  9,  0,  0, 44,  4,  0,  0,  0,  0,  0,  0, 58,  0,
+/* 0x1980 */   0,  0,156,  9,  0,  0,200, 13,  0,  0,  0,  0,  0,  0, 69,  0,
+/* 0x1990 */   0,  0, 36,  0,  0,  0,100, 23,  0,  0,  0,  0,  0,  0, 80,  0,
+/* 0x19a0 */   0,  0, 28,  0,  0,  0,136, 23,  0,  0,  0,  0,  0,  0, 89,  0,
+/* 0x19b0 */   0,  0, 36,  0,  0,  0,164, 23,  0,  0,  0,  0,  0,  0, 96,  0,
+/* 0x19c0 */   0,  0, 18,  0,  0,  0,200, 23,  0,  0,  0,  0,  0,  0,105,  0,
+/* 0x19d0 */   0,  0, 36,  1,  0,  0,218, 23,  0,  0,  0,  0,  0,  0, 69,  0,
+/* 0x19e0 */   0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 80,  0,
+/* 0x19f0 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,105,  0,
+/* 0x1a00 */   0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x1a20 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,
+/* 0x1a30 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  0,
+/* 0x1a40 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,
+/* 0x1a50 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,
+/* 0x1a60 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47,  0,
+/* 0x1a70 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 58,  0,
+/* 0x1a80 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,
+/* 0x1a90 */   0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 96,  0,
+/* 0x1aa0 */   0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,114,  0,
+/* 0x1ab0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,121,  0,
+/* 0x1ac0 */   0,  0, 14,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,  0,  0,
+/* 0x1ad0 */   0,  0,  0,  0,  0,  0,129,  0,  0,  0,  2,  0,  0,  0,220,  0,
+/* 0x1ae0 */   0,  0,  0,  0,  0,  0,  2,  0,  0,  0,180,  0,  0,  0,141,  0,
+/* 0x1af0 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+/* 0x1b00 */   0,  0,180,  0,  0,  0,141,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1b10 */   0,  0,  0,  0,  0,  0,  4,  0,  0,  0,144,  0,  0,  0,141,  0,
+/* 0x1b20 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,
+/* 0x1b30 */   0,  0,  4,  0,  0,  0,141,  0,  0,  0,  0,  0,  0,  0, 36,  0,
+/* 0x1b40 */   0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,129,  0,
+/* 0x1b50 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,
+/* 0x1b60 */   0,  0, 32,  1,  0,  0,153,  0,  0,  0, 14,  0,  0,  0,  0,  0,
+/* 0x1b70 */   0,  0,  0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,  0, 78,
+/* 0x1b80 */  82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 50, 69,  0, 78, 82,
+/* 0x1b90 */  86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69,
+/* 0x1ba0 */  76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0,
+/* 0x1bb0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95,
+/* 0x1bc0 */  68, 69, 67, 51, 48,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 67,
+/* 0x1bd0 */  70, 76, 85, 83, 72,  0, 69, 76, 70, 77, 65, 73, 78, 89,  0, 69,
+/* 0x1be0 */  76, 70, 77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,  0, 79,
+/* 0x1bf0 */  95, 66, 73, 78, 70, 79,  0, 82, 95, 80, 80, 67, 95, 82, 69, 76,
+/* 0x1c00 */  50, 52,  0, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49, 52,  0, 82,
+/* 0x1c10 */  95, 80, 80, 67, 95, 65, 68, 68, 82, 51, 50,  0,254, 24,  0,  0,
+/* 0x1c20 */  85, 80, 88, 35, 79, 66, 74, 49
 };
@@ -1,5 +1,5 @@
 /* powerpc-linux.kernel.vmlinux.h
-   created from powerpc-linux.kernel.vmlinux.bin, 9090 (0x2382) bytes
+   created from powerpc-linux.kernel.vmlinux.bin, 7154 (0x1bf2) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC_LINUX_KERNEL_VMLINUX_SIZE    9090
-#define STUB_POWERPC_LINUX_KERNEL_VMLINUX_ADLER32 0x07ef2789
-#define STUB_POWERPC_LINUX_KERNEL_VMLINUX_CRC32   0x4e7e9b33
+#define STUB_POWERPC_LINUX_KERNEL_VMLINUX_SIZE    7154
+#define STUB_POWERPC_LINUX_KERNEL_VMLINUX_ADLER32 0x37ac100d
+#define STUB_POWERPC_LINUX_KERNEL_VMLINUX_CRC32   0x045f9a3b
 
-unsigned char stub_powerpc_linux_kernel_vmlinux[9090] = {
+unsigned char stub_powerpc_linux_kernel_vmlinux[7154] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0, 20,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 25, 20,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -425,184 +425,63 @@ unsigned char stub_powerpc_linux_kernel_vmlinux[9090] = {
 /* 0x1820 */ 128, 33,  0,  0,124,165, 58, 20,128,  1,  0,  8, 56,165,255,255,
 /* 0x1830 */ 128, 33,  0,  0,124,  8,  3,166, 85, 80, 88, 33,161,216,208,213,
 /* 0x1840 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x1850 */   0,  0,  0,  0,  0,  0,  0, 45,102,105,108,101, 32,102,111,114,
-/* 0x1860 */ 109, 97,116, 32,101,108,102, 51, 50, 45,112,111,119,101,114,112,
-/* 0x1870 */  99, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120,
-/* 0x1880 */  32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x1890 */ 105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32,
-/* 0x18a0 */  32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,
-/* 0x18b0 */ 101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,
-/* 0x18c0 */ 103,115, 10, 32, 32, 48, 32, 76, 73, 78, 85, 88, 48, 48, 48, 32,
-/* 0x18d0 */  32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 56, 32, 32, 48,
-/* 0x18e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18f0 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 51, 52, 32, 32, 50, 42, 42,
-/* 0x1900 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76,
-/* 0x1910 */  79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49,
-/* 0x1920 */  32, 76, 73, 78, 85, 88, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1930 */  48, 48, 48, 48, 48, 48, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1940 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1950 */  48, 48, 48, 51, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1960 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1970 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 50, 32, 76, 73, 78, 85, 88,
-/* 0x1980 */  48, 50, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 54,
-/* 0x1990 */  52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x19a0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 52, 52, 32,
-/* 0x19b0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x19c0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 76, 73,
-/* 0x19d0 */  78, 85, 88, 48, 51, 48, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48,
-/* 0x19e0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x19f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1a00 */  97, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1a10 */  84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 52,
-/* 0x1a20 */  32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1a30 */  48, 48, 48, 48, 48,102, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a40 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1a50 */  48, 48, 48, 97, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1a60 */  84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69,
-/* 0x1a70 */  65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32, 78, 82, 86, 50, 68,
-/* 0x1a80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49, 50,
-/* 0x1a90 */  99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1aa0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 57, 56, 32,
-/* 0x1ab0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1ac0 */  32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1ad0 */  10, 32, 32, 54, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32,
-/* 0x1ae0 */  32, 32, 32, 48, 48, 48, 48, 48, 49, 52, 56, 32, 32, 48, 48, 48,
-/* 0x1af0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1b00 */  32, 48, 48, 48, 48, 48, 50, 99, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1b10 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x1b20 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 78,
-/* 0x1b30 */  82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1b40 */  48, 48, 48, 49, 99, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1b50 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1b60 */  52, 48, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1b70 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1b80 */  56, 32, 67, 70, 76, 85, 83, 72, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1b90 */  48, 48, 48, 48, 48, 48, 50, 52, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1ba0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1bb0 */  48, 48, 48, 52, 50, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1bc0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1bd0 */  10, 32, 32, 57, 32, 76, 90, 77, 65, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1be0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1bf0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1c00 */  32, 48, 48, 48, 48, 48, 52, 52, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1c10 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1c20 */  78, 76, 89, 10, 32, 49, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x1c30 */  48, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 57, 48, 32, 32,
-/* 0x1c40 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1c50 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 52, 99, 32, 32, 50, 42,
-/* 0x1c60 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1c70 */  76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 49,
-/* 0x1c80 */  49, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32,
-/* 0x1c90 */  48, 48, 48, 48, 48, 57, 57, 99, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1ca0 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1cb0 */  48, 48, 48, 52,100, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1cc0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89,
-/* 0x1cd0 */  10, 32, 49, 50, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x1ce0 */  32, 32, 32, 48, 48, 48, 48, 48, 57, 57, 99, 32, 32, 48, 48, 48,
-/* 0x1cf0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1d00 */  32, 48, 48, 48, 48, 48,101, 55, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1d10 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79,
-/* 0x1d20 */  78, 76, 89, 10, 32, 49, 51, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1d30 */  51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 52, 32, 32,
-/* 0x1d40 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1d50 */  48, 48, 32, 32, 48, 48, 48, 48, 49, 56, 49, 52, 32, 32, 50, 42,
-/* 0x1d60 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69,
-/* 0x1d70 */  65, 68, 79, 78, 76, 89, 10, 32, 49, 52, 32, 85, 80, 88, 49, 72,
-/* 0x1d80 */  69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50,
-/* 0x1d90 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x1da0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 56, 51, 56, 32,
-/* 0x1db0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44,
-/* 0x1dc0 */  32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79, 76,
-/* 0x1dd0 */  32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1de0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85, 88, 48, 50,
-/* 0x1df0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 73, 78, 85, 88,
-/* 0x1e00 */  48, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1e10 */  32, 32,100, 32, 32, 76, 73, 78, 85, 88, 48, 51, 48,  9, 48, 48,
-/* 0x1e20 */  48, 48, 48, 48, 48, 48, 32, 76, 73, 78, 85, 88, 48, 51, 48, 10,
-/* 0x1e30 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1e40 */  32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48, 48, 48, 48,
-/* 0x1e50 */  48, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48,
-/* 0x1e60 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x1e70 */  65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e80 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x1e90 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78,
-/* 0x1ea0 */  85, 88, 48, 48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76,
-/* 0x1eb0 */  73, 78, 85, 88, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ec0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85, 88, 48, 49,
-/* 0x1ed0 */  48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 73, 78, 85, 88,
-/* 0x1ee0 */  48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1ef0 */  32, 32,100, 32, 32, 78, 82, 86, 50, 66,  9, 48, 48, 48, 48, 48,
-/* 0x1f00 */  48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1f10 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,
-/* 0x1f20 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 68, 10,
-/* 0x1f30 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1f40 */  32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1f50 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1f60 */  32, 32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83, 72,  9, 48, 48,
-/* 0x1f70 */  48, 48, 48, 48, 48, 48, 32, 67, 70, 76, 85, 83, 72, 10, 48, 48,
-/* 0x1f80 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1f90 */  90, 77, 65,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90, 77,
-/* 0x1fa0 */  65, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1fb0 */ 100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x1fd0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1fe0 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48, 48,
-/* 0x1ff0 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x2000 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2010 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48, 48,
-/* 0x2020 */  48, 48, 48, 48, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2030 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2040 */ 100, 32, 32, 85, 80, 88, 49, 72, 69, 65, 68,  9, 48, 48, 48, 48,
-/* 0x2050 */  48, 48, 48, 48, 32, 85, 80, 88, 49, 72, 69, 65, 68, 10, 48, 48,
-/* 0x2060 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x2070 */  85, 78, 68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,
-/* 0x2080 */ 108,116,101,114, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48,
-/* 0x2090 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x20a0 */  68, 42,  9, 48, 48, 48, 48, 48, 48, 48, 48, 32,102,105,108,116,
-/* 0x20b0 */ 101,114, 95, 99,116,111, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x20c0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x20d0 */  76, 73, 78, 85, 88, 48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x20e0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x20f0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x2100 */  48, 48, 48, 48, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 50, 52,
-/* 0x2110 */  32, 32, 32, 32, 32, 32, 32, 76, 73, 78, 85, 88, 48, 51, 48, 10,
-/* 0x2120 */  48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 80, 80, 67, 95, 82,
-/* 0x2130 */  69, 76, 50, 52, 32, 32, 32, 32, 32, 32, 32, 76, 73, 78, 85, 88,
-/* 0x2140 */  48, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x2150 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 73, 78,
-/* 0x2160 */  85, 88, 48, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x2170 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2180 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2190 */  48, 32, 82, 95, 80, 80, 67, 95, 65, 68, 68, 82, 51, 50, 32, 32,
-/* 0x21a0 */  32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,110,103,116,
-/* 0x21b0 */ 104, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 80, 80, 67,
-/* 0x21c0 */  95, 65, 68, 68, 82, 51, 50, 32, 32, 32, 32, 32, 32,102,105,108,
-/* 0x21d0 */ 116,101,114, 95, 99,116,111, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x21e0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x21f0 */  91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x2200 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2210 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2220 */  57, 48, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49, 52, 32, 32,
-/* 0x2230 */  32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82,
-/* 0x2240 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x2250 */  83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79,
-/* 0x2260 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x2270 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x2280 */  48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 80, 80, 67, 95, 82,
-/* 0x2290 */  69, 76, 49, 52, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84,
-/* 0x22a0 */  65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x22b0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86,
-/* 0x22c0 */  50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x22d0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22e0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82,
-/* 0x22f0 */  95, 80, 80, 67, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2300 */  32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67,
-/* 0x2310 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x2320 */  82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10,
-/* 0x2330 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x2340 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x2350 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 80, 80, 67, 95,
-/* 0x2360 */  82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2370 */  95, 68, 69, 67, 51, 48, 43, 48,120, 48, 48, 48, 48, 48, 48, 50,
-/* 0x2380 */  52, 10
+/* 0x1850 */   0,  0,  0,  0,  0,  0,  0, 45, 15,  0,  0,  0, 17,  0,  0,  0,
+/* 0x1860 */   8,  0,  0,  0,190,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1870 */  52,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1880 */  60,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,100,  0,  0,  0,
+/* 0x1890 */  68,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18a0 */ 168,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,240,  0,  0,  0,
+/* 0x18b0 */ 168,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0, 44,  1,  0,  0,
+/* 0x18c0 */ 152,  1,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0, 72,  1,  0,  0,
+/* 0x18d0 */ 196,  2,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0, 28,  0,  0,  0,
+/* 0x18e0 */  12,  4,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0, 36,  0,  0,  0,
+/* 0x18f0 */  40,  4,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1900 */  76,  4,  0,  0,  0,  0,  0,  0, 75,  0,  0,  0,144,  0,  0,  0,
+/* 0x1910 */  76,  4,  0,  0,  0,  0,  0,  0, 86,  0,  0,  0,156,  9,  0,  0,
+/* 0x1920 */ 220,  4,  0,  0,  0,  0,  0,  0, 97,  0,  0,  0,156,  9,  0,  0,
+/* 0x1930 */ 120, 14,  0,  0,  0,  0,  0,  0,108,  0,  0,  0, 36,  0,  0,  0,
+/* 0x1940 */  20, 24,  0,  0,  0,  0,  0,  0,119,  0,  0,  0, 32,  0,  0,  0,
+/* 0x1950 */  56, 24,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1960 */   0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1970 */   0,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1980 */   0,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1990 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x19b0 */   0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  4,  0,  0,  0,
+/* 0x19c0 */   0,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,  5,  0,  0,  0,
+/* 0x19d0 */   0,  0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,  6,  0,  0,  0,
+/* 0x19e0 */   0,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,  8,  0,  0,  0,
+/* 0x19f0 */   0,  0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1a00 */   0,  0,  0,  0,  0,  0,  0,  0, 75,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1a10 */   0,  0,  0,  0,  0,  0,  0,  0, 86,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1a20 */   0,  0,  0,  0,  0,  0,  0,  0, 97,  0,  0,  0, 12,  0,  0,  0,
+/* 0x1a30 */   0,  0,  0,  0,  0,  0,  0,  0,119,  0,  0,  0, 14,  0,  0,  0,
+/* 0x1a40 */   0,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0, 16,  0,  0,  0,
+/* 0x1a50 */ 173,222,173,222,  0,  0,  0,  0,142,  0,  0,  0, 16,  0,  0,  0,
+/* 0x1a60 */ 173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a70 */ 153,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a80 */   0,  0,  0,  0,  4,  0,  0,  0,153,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */   0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1aa0 */ 165,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ab0 */   1,  0,  0,  0,  4,  0,  0,  0,165,  0,  0,  0, 16,  0,  0,  0,
+/* 0x1ac0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,144,  0,  0,  0,
+/* 0x1ad0 */ 178,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ae0 */   5,  0,  0,  0,180,  0,  0,  0,178,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1af0 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,180,  0,  0,  0,
+/* 0x1b00 */ 178,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b10 */  10,  0,  0,  0,  4,  0,  0,  0,178,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1b20 */  36,  0,  0,  0,  0,  0,  0,  0, 76, 73, 78, 85, 88, 48, 48, 48,
+/* 0x1b30 */   0, 76, 73, 78, 85, 88, 48, 49, 48,  0, 76, 73, 78, 85, 88, 48,
+/* 0x1b40 */  50, 48,  0, 76, 73, 78, 85, 88, 48, 51, 48,  0, 78, 82, 86, 50,
+/* 0x1b50 */  66,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 69,  0, 78, 82,
+/* 0x1b60 */  86, 95, 84, 65, 73, 76,  0, 67, 70, 76, 85, 83, 72,  0, 76, 90,
+/* 0x1b70 */  77, 65,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90,
+/* 0x1b80 */  77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x1b90 */  67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 85,
+/* 0x1ba0 */  80, 88, 49, 72, 69, 65, 68,  0,102,105,108,116,101,114, 95,108,
+/* 0x1bb0 */ 101,110,103,116,104,  0,102,105,108,116,101,114, 95, 99,116,111,
+/* 0x1bc0 */   0, 82, 95, 80, 80, 67, 95, 82, 69, 76, 50, 52,  0, 82, 95, 80,
+/* 0x1bd0 */  80, 67, 95, 65, 68, 68, 82, 51, 50,  0, 82, 95, 80, 80, 67, 95,
+/* 0x1be0 */  82, 69, 76, 49, 52,  0, 88, 24,  0,  0, 85, 80, 88, 35, 79, 66,
+/* 0x1bf0 */  74, 49
 };
@@ -1,5 +1,5 @@
 /* powerpc64le-darwin.macho-entry.h
-   created from powerpc64le-darwin.macho-entry.bin, 10439 (0x28c7) bytes
+   created from powerpc64le-darwin.macho-entry.bin, 8237 (0x202d) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC64LE_DARWIN_MACHO_ENTRY_SIZE    10439
-#define STUB_POWERPC64LE_DARWIN_MACHO_ENTRY_ADLER32 0x7914a5b4
-#define STUB_POWERPC64LE_DARWIN_MACHO_ENTRY_CRC32   0x5e59d09e
+#define STUB_POWERPC64LE_DARWIN_MACHO_ENTRY_SIZE    8237
+#define STUB_POWERPC64LE_DARWIN_MACHO_ENTRY_ADLER32 0x809f7be5
+#define STUB_POWERPC64LE_DARWIN_MACHO_ENTRY_CRC32   0xd17bb210
 
-unsigned char stub_powerpc64le_darwin_macho_entry[10439] = {
+unsigned char stub_powerpc64le_darwin_macho_entry[8237] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 21,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,232, 31,  0,  0,  0,  0,  0,  0,
@@ -505,188 +505,50 @@ unsigned char stub_powerpc64le_darwin_macho_entry[10439] = {
 /* 0x1d20 */ 255,255,  5,140,255,255,  3,156,248,255, 32, 67,166,  3,233,127,
 /* 0x1d30 */ 128,  0,171, 56,248,255,193,248,248,255,193, 56,113,255, 33,248,
 /* 0x1d40 */  32,  4,128, 78,166,  2,232,127,181,255,255, 75,128,  0,  0, 72,
-/* 0x1d50 */   0,  0,  0,  0,102,105,108,101, 32,102,111,114,109, 97,116, 32,
-/* 0x1d60 */ 101,108,102, 54, 52, 45,112,111,119,101,114,112, 99,108,101, 10,
-/* 0x1d70 */  10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78,
-/* 0x1d80 */  97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,
-/* 0x1d90 */ 101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32,
-/* 0x1da0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x1db0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,
-/* 0x1dc0 */ 111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115,
-/* 0x1dd0 */  10, 32, 32, 48, 32, 77, 65, 67, 79, 83, 48, 48, 48, 32, 32, 32,
-/* 0x1de0 */  32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 52, 32, 32, 48, 48, 48,
-/* 0x1df0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x1e00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1e10 */  32, 48, 48, 48, 48, 48, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1e20 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67,
-/* 0x1e30 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 49, 32, 78,
-/* 0x1e40 */  82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 48, 48,
-/* 0x1e50 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e60 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48,
-/* 0x1e80 */  48, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1e90 */  78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32,
-/* 0x1ea0 */  50, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1eb0 */  48, 48, 48, 48, 48, 49, 53, 52, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x1ec0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x1ed0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48,
-/* 0x1ee0 */  48, 48, 48, 48, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1ef0 */  78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82,
-/* 0x1f00 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 51, 32, 78, 82, 86, 50,
-/* 0x1f10 */  68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 49,
-/* 0x1f20 */  52, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f30 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f40 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 49, 57, 56,
-/* 0x1f50 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1f60 */  44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x1f70 */  89, 10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32,
-/* 0x1f80 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48,102, 56, 32, 32, 48, 48,
-/* 0x1f90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1fa0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fb0 */  32, 32, 48, 48, 48, 48, 48, 50,100, 99, 32, 32, 50, 42, 42, 48,
-/* 0x1fc0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 76, 79,
-/* 0x1fd0 */  67, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 53, 32,
-/* 0x1fe0 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 48,
-/* 0x1ff0 */  48, 48, 48, 48, 57, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2000 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2010 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2020 */  48, 51,100, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2030 */  69, 78, 84, 83, 44, 32, 82, 69, 76, 79, 67, 44, 32, 82, 69, 65,
-/* 0x2040 */  68, 79, 78, 76, 89, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2050 */  69, 67, 51, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 56,
-/* 0x2060 */  32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2070 */  48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2080 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 54, 56, 32, 32,
-/* 0x2090 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32,
-/* 0x20a0 */  82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 55, 32, 76, 90, 77,
-/* 0x20b0 */  65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 48, 48, 48, 48,
-/* 0x20c0 */  98, 98, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20d0 */  48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 52, 57,
-/* 0x20f0 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2100 */  83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32, 32, 56, 32,
-/* 0x2110 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 48,
-/* 0x2120 */  48, 48, 48, 99, 55, 52, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2130 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x2140 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48,
-/* 0x2150 */  49, 48, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2160 */  69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 32,
-/* 0x2170 */  32, 57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32,
-/* 0x2180 */  32, 48, 48, 48, 48, 48, 48, 49, 99, 32, 32, 48, 48, 48, 48, 48,
-/* 0x2190 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48,
-/* 0x21a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 48,
-/* 0x21b0 */  48, 48, 48, 49, 99, 98, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x21c0 */  79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68, 79, 78, 76,
-/* 0x21d0 */  89, 10, 32, 49, 48, 32, 67, 70, 76, 85, 83, 72, 32, 32, 32, 32,
-/* 0x21e0 */  32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 50, 52, 32, 32, 48, 48,
-/* 0x21f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2200 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2210 */  32, 32, 48, 48, 48, 48, 49, 99,100, 56, 32, 32, 50, 42, 42, 48,
-/* 0x2220 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82, 69, 65, 68,
-/* 0x2230 */  79, 78, 76, 89, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x2240 */  89, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2250 */  32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2260 */  48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2270 */  48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 99,102, 99, 32, 32, 50,
-/* 0x2280 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 44, 32, 82,
-/* 0x2290 */  69, 65, 68, 79, 78, 76, 89, 10, 32, 49, 50, 32, 69, 76, 70, 77,
-/* 0x22a0 */  65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 48, 48, 48, 48, 48,
-/* 0x22b0 */  53, 56, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22c0 */  48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22d0 */  48, 48, 48, 48, 48, 48, 32, 32, 48, 48, 48, 48, 49, 99,102, 99,
-/* 0x22e0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x22f0 */  44, 32, 82, 69, 65, 68, 79, 78, 76, 89, 10, 83, 89, 77, 66, 79,
-/* 0x2300 */  76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2310 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2320 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  9, 48, 48, 48,
-/* 0x2330 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 76, 90,
-/* 0x2340 */  77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2350 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2360 */  32, 32, 78, 82, 86, 95, 84, 65, 73, 76,  9, 48, 48, 48, 48, 48,
-/* 0x2370 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 95,
-/* 0x2380 */  84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2390 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76,
-/* 0x23a0 */  70, 77, 65, 73, 78, 90,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23b0 */  48, 48, 48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90,
-/* 0x23c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 79, 83, 48,
-/* 0x23e0 */  48, 48,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23f0 */  48, 48, 48, 32, 77, 65, 67, 79, 83, 48, 48, 48, 10, 48, 48, 48,
-/* 0x2400 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2410 */  32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,  9, 48,
-/* 0x2420 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2430 */  78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2440 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2450 */  32, 32, 78, 82, 86, 50, 69,  9, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2460 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x2470 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2480 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,  9, 48, 48,
-/* 0x2490 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 78,
-/* 0x24a0 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24b0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x24c0 */  86, 50, 66,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24d0 */  48, 48, 48, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x24e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x24f0 */  32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  9, 48,
-/* 0x2500 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2510 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2520 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2530 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  9, 48,
-/* 0x2540 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2550 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2560 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2570 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  9, 48,
-/* 0x2580 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2590 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x25a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x25b0 */  32,100, 32, 32, 67, 70, 76, 85, 83, 72,  9, 48, 48, 48, 48, 48,
-/* 0x25c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 67, 70, 76, 85,
-/* 0x25d0 */  83, 72, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25e0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77,
-/* 0x25f0 */  65, 73, 78, 89,  9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2600 */  48, 48, 48, 48, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10, 48,
-/* 0x2610 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2620 */ 103, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 79, 83, 48, 48, 48,
-/* 0x2630 */   9, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2640 */  48, 32, 95,115,116, 97,114,116, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x2650 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x2660 */  32, 91, 77, 65, 67, 79, 83, 48, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x2670 */  83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89,
-/* 0x2680 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2690 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26a0 */  48, 48, 48, 48, 48, 48, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82,
-/* 0x26b0 */  69, 76, 50, 52, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x26c0 */  90, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26d0 */  48, 48, 52, 56, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x26e0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x26f0 */  86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x2700 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x2710 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x2720 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 99, 48, 32,
-/* 0x2730 */  82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32,
-/* 0x2740 */  32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79,
-/* 0x2750 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x2760 */  79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2770 */  69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80,
-/* 0x2780 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x2790 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27a0 */  48, 48, 48, 99, 99, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69,
-/* 0x27b0 */  76, 49, 52, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x27c0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x27d0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93,
-/* 0x27e0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x27f0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2800 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x2810 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 57, 56, 32, 82, 95, 80, 80,
-/* 0x2820 */  67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2830 */  86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x2840 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x2850 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x2860 */  83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89,
-/* 0x2870 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2880 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2890 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82,
-/* 0x28a0 */  69, 76, 49, 52, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x28b0 */  67, 51, 48, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28c0 */  48, 48, 48, 48, 50, 56, 10
+/* 0x1d50 */   0,  0,  0,  0, 13,  0,  0,  0, 14,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1d60 */ 149,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 64,  0,  0,  0,
+/* 0x1d70 */   0,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 68,  0,  0,  0,
+/* 0x1d80 */   0,  0,  0,  0, 18,  0,  0,  0, 84,  1,  0,  0, 68,  0,  0,  0,
+/* 0x1d90 */   0,  0,  0,  0, 24,  0,  0,  0, 68,  1,  0,  0,152,  1,  0,  0,
+/* 0x1da0 */   0,  0,  0,  0, 30,  0,  0,  0,248,  0,  0,  0,220,  2,  0,  0,
+/* 0x1db0 */   0,  0,  0,  0, 36,  0,  0,  0,148,  0,  0,  0,212,  3,  0,  0,
+/* 0x1dc0 */   0,  0,  0,  0, 47,  0,  0,  0, 40,  0,  0,  0,104,  4,  0,  0,
+/* 0x1dd0 */   0,  0,  0,  0, 58,  0,  0,  0,184, 11,  0,  0,144,  4,  0,  0,
+/* 0x1de0 */   0,  0,  0,  0, 69,  0,  0,  0,116, 12,  0,  0, 72, 16,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0, 80,  0,  0,  0, 28,  0,  0,  0,188, 28,  0,  0,
+/* 0x1e00 */   0,  0,  0,  0, 89,  0,  0,  0, 36,  0,  0,  0,216, 28,  0,  0,
+/* 0x1e10 */   0,  0,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0,252, 28,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0,105,  0,  0,  0, 88,  0,  0,  0,252, 28,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0, 47,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e40 */   0,  0,  0,  0, 80,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0,105,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e70 */   0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0, 24,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ea0 */   0,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0, 36,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0, 58,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ed0 */   0,  0,  0,  0, 69,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0, 96,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f00 */   0,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,121,  0,  0,  0,
+/* 0x1f20 */   2,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1f30 */ 192,  0,  0,  0,135,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0,  3,  0,  0,  0,204,  0,  0,  0,135,  0,  0,  0,
+/* 0x1f50 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1f60 */ 152,  0,  0,  0,135,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0,  5,  0,  0,  0,  4,  0,  0,  0,135,  0,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0, 77, 65, 67, 79,
+/* 0x1f90 */  83, 48, 48, 48,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82,
+/* 0x1fa0 */  86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0,
+/* 0x1fb0 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95,
+/* 0x1fc0 */  68, 69, 67, 51, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
+/* 0x1fd0 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 78, 82, 86, 95,
+/* 0x1fe0 */  84, 65, 73, 76,  0, 67, 70, 76, 85, 83, 72,  0, 69, 76, 70, 77,
+/* 0x1ff0 */  65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,
+/* 0x2000 */ 116, 97,114,116,  0, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76,
+/* 0x2010 */  50, 52,  0, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52,
+/* 0x2020 */   0, 84, 29,  0,  0, 85, 80, 88, 35, 79, 66, 74, 49
 };
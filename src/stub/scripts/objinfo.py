@@ -0,0 +1,164 @@
+#! /usr/bin/env python2
+## vim:set ts=4 sw=4 et: -*- coding: utf-8 -*-
+#
+#  objinfo.py -- append the "objdump -htr" info as a binary table
+#
+#  This file is part of the UPX executable compressor.
+#
+#  Copyright (C) 1996-2022 Markus Franz Xaver Johannes Oberhumer
+#  All Rights Reserved.
+#
+#  UPX and the UCL library are free software; you can redistribute them
+#  and/or modify them under the terms of the GNU General Public License as
+#  published by the Free Software Foundation; either version 2 of
+#  the License, or (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program; see the file COPYING.
+#  If not, write to the Free Software Foundation, Inc.,
+#  59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+#
+#  Markus F.X.J. Oberhumer              Laszlo Molnar
+#  <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+#
+
+
+import getopt, os, re, struct, sys
+
+
+class opts:
+    dry_run = 0
+    verbose = 0
+
+
+# /***********************************************************************
+# // parse the dump exactly like ElfLinker::preprocessXXX() in linker.cpp
+# ************************************************************************/
+
+def parse_dump(lines):
+    sections, symbols, relocs = [], [], []
+    mode = None
+    rsect = None
+    for l in lines:
+        l = l.rstrip("\r\n")
+        if l.startswith("Sections:"):
+            mode = "sections"; continue
+        if l.startswith("SYMBOL TABLE:"):
+            mode = "symbols"; continue
+        if l.startswith("RELOCATION RECORDS FOR "):
+            mode = "relocs"
+            m = re.match(r"^RELOCATION RECORDS FOR \[([^\]]+)\]", l)
+            rsect = m.group(1)
+            continue
+        if mode == "sections":
+            m = re.match(r"^\s*\d+\s+(\S+)\s+([0-9a-fA-F]+)\s+\d+\s+\d+\s+([0-9a-fA-F]+)\s+2\*\*(\d+)", l)
+            if m:
+                sections.append((m.group(1), int(m.group(2), 16), int(m.group(3), 16), int(m.group(4))))
+        elif mode == "symbols":
+            m = re.match(r"^([0-9a-fA-F]+)\s+g\s+\*ABS\*\s+([0-9a-fA-F]+)\s+(\S+)", l)
+            if m:
+                assert int(m.group(2), 16) == 0, l
+                symbols.append((m.group(3), "*ABS*", int(m.group(1), 16) & 0xffffffff))
+                continue
+            m = re.match(r"^([0-9a-fA-F]+).{8}\s*(\S+)\s+[0-9a-fA-F]+\s+(\S+)", l)
+            if m:
+                section, value = m.group(2), int(m.group(1), 16) & 0xffffffff
+                if section == "*UND*":
+                    value = 0xdeaddead
+                assert section != "*ABS*", l
+                symbols.append((m.group(3), section, value))
+        elif mode == "relocs":
+            m = re.match(r"^([0-9a-fA-F]+)\s+(\S+)\s+(\S+)", l)
+            if m and rsect is not None:
+                symbol, add = m.group(3), 0
+                m2 = re.match(r"^(.*?)([+-])0x([0-9a-fA-F]+)$", symbol)
+                if m2:
+                    assert len(m2.group(3)) in [8, 16], l
+                    symbol, add = m2.group(1), int(m2.group(3), 16)
+                    if m2.group(2) == "-":
+                        add = (0 - add) & 0xffffffffffffffff
+                relocs.append((rsect, int(m.group(1), 16) & 0xffffffff, m.group(2), symbol, add))
+    return sections, symbols, relocs
+
+
+# /***********************************************************************
+# // see the table layout in ElfLinker::preprocessObjectTable()
+# ************************************************************************/
+
+def make_table(sections, symbols, relocs, table_pos):
+    strings = [b""]
+    string_offsets = {}
+    def add_string(s):
+        if s not in string_offsets:
+            string_offsets[s] = sum([len(x) for x in strings])
+            strings.append(s.encode("latin-1") + b"\0")
+        return string_offsets[s]
+    section_index = {}
+    for i, s in enumerate(sections):
+        assert s[0] not in section_index, s
+        section_index[s[0]] = i
+    section_index["*ABS*"] = len(sections)
+    section_index["*UND*"] = len(sections) + 1
+    symbol_index = {}
+    for i, s in enumerate(symbols):
+        assert s[0] not in symbol_index, s
+        symbol_index[s[0]] = i
+    d = []
+    for name, size, offset, p2align in sections:
+        assert offset + size <= table_pos, (name, offset, size)
+        d.append(struct.pack("<IIII", add_string(name), size, offset, p2align))
+    for name, section, value in symbols:
+        d.append(struct.pack("<IIQ", add_string(name), section_index[section], value))
+    for section, offset, rtype, symbol, add in relocs:
+        assert section_index[section] < len(sections), section
+        d.append(struct.pack("<IIIIQ", section_index[section], offset, add_string(rtype),
+                             symbol_index[symbol], add))
+    strings = b"".join(strings)
+    if not strings:
+        strings = b"\0"
+    head = struct.pack("<IIII", len(sections), len(symbols), len(relocs), len(strings))
+    return head + b"".join(d) + strings + struct.pack("<I", table_pos) + b"UPX#OBJ1"
+
+
+def do_file(dump_fn, fn):
+    lines = open(dump_fn, "rb").read().decode("latin-1").splitlines(True)
+    sections, symbols, relocs = parse_dump(lines)
+    fp = open(fn, "r+b")
+    fp.seek(0, 2)
+    table_pos = fp.tell()
+    table = make_table(sections, symbols, relocs, table_pos)
+    if opts.verbose >= 1:
+        print("%s: %d sections, %d symbols, %d relocations, %d bytes" %
+              (fn, len(sections), len(symbols), len(relocs), len(table)))
+    if not opts.dry_run:
+        fp.write(table)
+    fp.close()
+
+
+def main(argv):
+    try: assert 0
+    except AssertionError: pass
+    else: raise Exception("fatal error - assertions not enabled")
+    shortopts, longopts = "qv", [
+        "dry-run", "quiet", "verbose"
+    ]
+    xopts, args = getopt.gnu_getopt(argv[1:], shortopts, longopts)
+    for opt, optarg in xopts:
+        if 0: pass
+        elif opt in ["-q", "--quiet"]: opts.verbose = opts.verbose - 1
+        elif opt in ["-v", "--verbose"]: opts.verbose = opts.verbose + 1
+        elif opt in ["--dry-run"]: opts.dry_run = opts.dry_run + 1
+        else: assert 0, ("getopt problem:", opt, optarg, xopts, args)
+    if len(args) != 2:
+        raise Exception("usage: objinfo.py DUMPFILE OBJFILE")
+    do_file(args[0], args[1])
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -150,6 +150,16 @@ typedef int f_expand(
     const nrv_byte *, nrv_uint,
           nrv_byte *, size_t *, unsigned );
 
+#if defined(__x86_64)  //{ --hot-pages
+// The packer stored the hot pages so that they begin on a page of the
+// compressed file, which the kernel mapped with the stub.  Move those
+// pages into place instead of copying: no work at all, and they share
+// the page cache until the program writes to them.
+#define MREMAP_MAYMOVE 1
+#define MREMAP_FIXED   2
+void *mremap(void *old, size_t old_len, size_t new_len, int flags, void *new_addr);
+#endif  //}
+
 static void
 unpackExtent(
     Extent *const xi,  // input
@@ -180,6 +190,20 @@ unpackExtent(
             err_exit(4);
 ERR_LAB
         }
+#if defined(__x86_64)  //{ --hot-pages
+        if (B_PAGES == h.b_method) { // stored; skip padding
+            if (h.sz_cpr < h.sz_unc) {
+                err_exit(5);
+            }
+            size_t const pad = h.sz_cpr - h.sz_unc;
+            if (xi->size < pad) {
+                err_exit(5);
+            }
+            xi->buf  += pad;
+            xi->size -= pad;
+            h.sz_cpr = h.sz_unc;
+        }
+#endif  //}
         if (h.sz_cpr > h.sz_unc
         ||  h.sz_unc > xo->size ) {
             err_exit(5);
@@ -214,6 +238,16 @@ ERR_LAB
             xi->size -= h.sz_cpr;
         }
         else { // copy literal block
+#if defined(__x86_64)  //{
+            if (B_PAGES == h.b_method && h.sz_cpr <= xi->size
+            &&  0 == (~PAGE_MASK & ((size_t)xi->buf | (size_t)xo->buf | h.sz_unc))
+            &&  xo->buf == mremap(xi->buf, h.sz_unc, h.sz_unc,
+                    MREMAP_MAYMOVE|MREMAP_FIXED, xo->buf)) {
+                xi->buf  += h.sz_cpr;
+                xi->size -= h.sz_cpr;
+            }
+            else
+#endif  //}
             xread(xi, xo->buf, h.sz_cpr);
         }
         xo->buf  += h.sz_unc;
@@ -221,6 +255,146 @@ ERR_LAB
     }
 }
 
+#if defined(__x86_64)  //{ threads
+/*************************************************************************
+// When the packer cut an Extent into several blocks (--split-blocks),
+// decompress the blocks on several threads, straight into place.
+// Thread k takes blocks k, k+n_thr, k+2*n_thr, ...; so there is no need
+// for atomic operations.  The main thread waits for the others, then
+// decompresses any block which they did not finish, which also reports
+// bad data the usual way.  Anything unusual means: all on one thread.
+**************************************************************************/
+
+#define MT_MAX_THR 16
+#define MT_MAX_BLK 128  // else one thread
+#define MT_STACK (1<<20)  // zstd_d.S uses alloca(0x22800)
+#define CLONE_VM_THREAD 0x50f00  // VM|FS|FILES|SIGHAND|THREAD|SYSVSEM
+#define CLONE_CHILD_CLEARTID 0x200000
+#define FUTEX_WAIT 0
+
+// amd64-linux.elf-fold.S; these return -errno on failure
+int clone_thread(unsigned long flags, char *stack, void (*fn)(void *), void *arg,
+    int *ctid);
+int futex(int *addr, int op, int val, void *timeout);
+int sched_getaffinity(int pid, size_t len, uint64_t *mask);
+
+typedef struct {
+    Extent xi, xo;  // exactly one block
+    f_unfilter *f_unf;  // as unpackExtent would
+    int done;
+} MtBlock;
+
+typedef struct {
+    MtBlock *blk;
+    unsigned n_blk, n_thr, k;
+    f_expand *f_exp;
+    int tid;  // the kernel clears it when the thread is gone
+} MtThread;
+
+static void
+mt_work(void *const arg)
+{
+    MtThread const *const t = (MtThread const *)arg;
+    unsigned j;
+    for (j = t->k; j < t->n_blk; j += t->n_thr) {
+        MtBlock *const b = &t->blk[j];
+        Extent xi, xo;
+        xi.buf = b->xi.buf; xi.size = b->xi.size;
+        xo.buf = b->xo.buf; xo.size = b->xo.size;
+        unpackExtent(&xi, &xo, t->f_exp, b->f_unf);  // exit() ends just a thread
+        b->done = 1;
+    }
+}
+
+static unsigned
+mt_ncpu(void)
+{
+    uint64_t mask[16];  // 1024 CPUs
+    int const len = sched_getaffinity(0, sizeof(mask), mask);
+    unsigned n = 0;
+    int j;
+    for (j = 0; j < len && j < (int)sizeof(mask); j += sizeof(mask[0])) {
+        uint64_t w = mask[j / sizeof(mask[0])];
+        for (; w; w &= w - 1) {
+            ++n;
+        }
+    }
+    return (n < MT_MAX_THR) ? n : MT_MAX_THR;
+}
+
+static void
+mt_unpackExtent(
+    Extent *const xi,  // input
+    Extent *const xo,  // output
+    f_expand *const f_exp,
+    f_unfilter *const f_unf
+)
+{
+    MtBlock blk[MT_MAX_BLK];
+    MtThread thr[MT_MAX_THR];
+    unsigned n_blk = 0, n_thr, j;
+    size_t pos = 0, out = 0;
+    char *stacks;
+
+    while (out < xo->size && n_blk < MT_MAX_BLK
+    &&  pos + sizeof(struct b_info) <= xi->size) {
+        struct b_info const *const h = (struct b_info const *)(void const *)
+            (pos + xi->buf);
+        size_t const len = sizeof(*h) + h->sz_cpr;
+        if (0 == h->sz_unc || xo->size - out < h->sz_unc || xi->size - pos < len) {
+            break;  // let unpackExtent complain
+        }
+        MtBlock *const b = &blk[n_blk++];
+        b->xi.buf = pos + xi->buf; b->xi.size = len;
+        b->xo.buf = out + xo->buf; b->xo.size = h->sz_unc;
+        pos += len;
+        out += h->sz_unc;
+        b->f_unf = (512 < h->sz_unc || out == xo->size) ? f_unf : 0;
+        b->done = 0;
+    }
+    n_thr = mt_ncpu();
+    if (n_blk < n_thr) {
+        n_thr = n_blk;
+    }
+    if (out != xo->size || n_thr < 2) {
+        unpackExtent(xi, xo, f_exp, f_unf);
+        return;
+    }
+    stacks = (char *)mmap(0, (n_thr - 1) * MT_STACK, PROT_READ|PROT_WRITE,
+        MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if ((size_t)-4096 < (size_t)stacks) { // failure (-1 or -errno)
+        unpackExtent(xi, xo, f_exp, f_unf);
+        return;
+    }
+    for (j = 0; j < n_thr; ++j) {
+        MtThread *const t = &thr[j];
+        t->blk = blk; t->n_blk = n_blk; t->n_thr = n_thr; t->k = j;
+        t->f_exp = f_exp;
+        t->tid = 0;
+        if (j) { // the main thread is k= 0
+            t->tid = -1;
+            if (0 >= clone_thread(CLONE_VM_THREAD | CLONE_CHILD_CLEARTID,
+                    j * MT_STACK + stacks, mt_work, t, &t->tid)) {
+                t->tid = 0;  // main thread does its blocks below
+            }
+        }
+    }
+    mt_work(&thr[0]);
+    for (j = 1; j < n_thr; ++j) {
+        int v;
+        while (0 != (v = *(int volatile *)&thr[j].tid)) {
+            futex(&thr[j].tid, FUTEX_WAIT, v, 0);
+        }
+    }
+    munmap(stacks, (n_thr - 1) * MT_STACK);
+    for (j = 0; j < n_blk; ++j) if (!blk[j].done) {
+        unpackExtent(&blk[j].xi, &blk[j].xo, f_exp, blk[j].f_unf);
+    }
+    xi->buf  += pos; xi->size -= pos;
+    xo->buf  += out; xo->size -= out;
+}
+#endif  //}
+
 #if defined(__x86_64__)  //{
 static void *
 make_hatch_x86_64(
@@ -399,6 +573,460 @@ auxv_up(Elf64_auxv_t *av, unsigned const type, uint64_t const value)
         ) >> ((pf & (PF_R|PF_W|PF_X))<<2) ))
 
 
+#if defined(__x86_64)  //{ --lazy
+/*************************************************************************
+// Decompress on first touch.  The packer cut the compressed PT_LOADs into
+// blocks which begin and end on page boundaries.  Except for the first and
+// the last block of each PT_LOAD (which may share a page with something
+// else), we only note where each block goes, and register those pages with
+// userfaultfd(2).  A thread which upx_main leaves behind then decompresses
+// a block when the program first touches one of its pages.  Without
+// userfaultfd (old kernel, or vm.unprivileged_userfaultfd=0) all blocks
+// are decompressed at once, as usual.
+**************************************************************************/
+
+// <linux/userfaultfd.h>
+#define UFFD_API 0xAA
+#define UFFD_FEATURE_EVENT_FORK (1<<1)
+#define UFFD_EVENT_PAGEFAULT 0x12
+#define UFFD_EVENT_FORK 0x13
+#define UFFDIO_REGISTER_MODE_MISSING 1
+#define UFFDIO_API      0xc018aa3f
+#define UFFDIO_REGISTER 0xc020aa00
+#define UFFDIO_WAKE     0x8010aa02
+#define UFFDIO_COPY     0xc028aa03
+
+#define O_CLOEXEC 02000000
+#define F_DUPFD_CLOEXEC 1030
+#define RLIMIT_NOFILE 7
+#define SIG_SETMASK 2
+#define LAZY_STACK (1<<20)  // generous: some decompressors use alloca
+
+// amd64-linux.elf-fold.S; these return -errno on failure
+int userfaultfd(int flags);
+int fcntl(int fd, int cmd, long arg);
+int getrlimit(int resource, uint64_t *rlim);  // struct rlimit
+int ioctl(int fd, unsigned long req, void *arg);
+int rt_sigprocmask(int how, uint64_t const *set, uint64_t *oset, size_t len);
+void exit_group(int) __attribute__((__noreturn__));
+
+typedef struct {
+    char *addr;  // page aligned destination
+    struct b_info const *bi;  // followed by the compressed data
+} LazyBlock;
+
+typedef struct {
+    int uffd;
+    unsigned n;  // used entries of blk[]
+    unsigned max;  // allocated entries of blk[]
+    char *buf;  // output of f_exp
+    char *stack;  // top of LAZY_STACK, just above buf
+    f_expand *f_exp;
+    f_unfilter *f_unf;
+    LazyBlock blk[1];  // ascending .addr, as are the PT_LOADs
+} Lazy;
+
+// The thread shares the fd table with the program, which may close or
+// dup2() over the low fds that it did not open itself.  So move a
+// userfaultfd to just below RLIMIT_NOFILE, out of the way.  A program
+// which closes all fds up to the limit still breaks --lazy.
+static int
+lazy_high_fd(int const fd)
+{
+    uint64_t lim[2];
+    if (0 == getrlimit(RLIMIT_NOFILE, lim) && 128 <= lim[0]) {
+        long const lo = (long)((1u<<16) < lim[0] ? (1u<<16) : lim[0]) - 64;
+        int const hi = fcntl(fd, F_DUPFD_CLOEXEC, lo);
+        if (0 <= hi) {
+            close(fd);
+            return hi;
+        }
+    }
+    return fd;  // keep the low one
+}
+
+static Lazy *
+lazy_init(Extent const *const xi, f_expand *const f_exp, f_unfilter *const f_unf)
+{
+    uint64_t api[3];  // struct uffdio_api
+    size_t pos, sz_buf = 0, sz_tab;
+    unsigned n = 0;
+    Lazy *lz;
+    int uffd = userfaultfd(O_CLOEXEC);
+    if (uffd < 0) {
+        return 0;
+    }
+    uffd = lazy_high_fd(uffd);
+    api[0] = UFFD_API; api[1] = UFFD_FEATURE_EVENT_FORK; api[2] = 0;
+    if (0 != ioctl(uffd, UFFDIO_API, api)) {
+        goto fail;
+    }
+    // The index is just the chain of b_info.
+    for (pos = 0; pos + sizeof(struct b_info) <= xi->size; ++n) {
+        struct b_info const *const h = (struct b_info const *)(void const *)
+            (pos + xi->buf);
+        if (0 == h->sz_unc) {
+            break;
+        }
+        if (sz_buf < h->sz_unc) {
+            sz_buf = h->sz_unc;
+        }
+        pos += sizeof(*h) + h->sz_cpr;
+    }
+    sz_tab = PAGE_MASK & (sizeof(*lz) + n * sizeof(LazyBlock) - PAGE_MASK - 1);
+    sz_buf = PAGE_MASK & (sz_buf - PAGE_MASK - 1);
+    lz = (Lazy *)mmap(0, sz_tab + sz_buf + LAZY_STACK, PROT_READ|PROT_WRITE,
+        MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (~PAGE_MASK & (size_t)lz) { // failure
+        goto fail;
+    }
+    lz->uffd = uffd;
+    lz->max = n;
+    lz->buf = sz_tab + (char *)lz;
+    lz->stack = sz_buf + LAZY_STACK + lz->buf;
+    lz->f_exp = f_exp;
+    lz->f_unf = f_unf;
+    return lz;
+fail:
+    close(uffd);
+    return 0;
+}
+
+static void
+lazy_now(LazyBlock const *const b, f_expand *const f_exp, f_unfilter *const f_unf)
+{
+    Extent xi, xo;
+    xi.buf  = CONST_CAST(char *, b->bi);
+    xi.size = sizeof(*b->bi) + b->bi->sz_cpr;
+    xo.buf  = b->addr;
+    xo.size = b->bi->sz_unc;
+    unpackExtent(&xi, &xo, f_exp, f_unf);
+}
+
+// Register the pages of blk[n0, lz->n) with userfaultfd.
+static void
+lazy_register(Lazy *const lz, unsigned const n0, f_expand *const f_exp,
+    f_unfilter *const f_unf)
+{
+    if (n0 < lz->n) {
+        LazyBlock const *const first = &lz->blk[n0];
+        LazyBlock const *const last  = &lz->blk[lz->n - 1];
+        uint64_t reg[4];  // struct uffdio_register
+        reg[0] = (size_t)first->addr;
+        reg[1] = last->bi->sz_unc + last->addr - first->addr;
+        reg[2] = UFFDIO_REGISTER_MODE_MISSING;
+        reg[3] = 0;
+        if (0 != ioctl(lz->uffd, UFFDIO_REGISTER, reg)) { // too bad: do it now
+            unsigned j;
+            for (j = n0; j < lz->n; ++j) {
+                lazy_now(&lz->blk[j], f_exp, f_unf);
+            }
+            lz->n = n0;
+        }
+    }
+}
+
+// Like unpackExtent, but only note the blocks which are whole pages.
+// Pages which --hot-pages mapped from the file cannot be registered,
+// so each run of noted blocks is registered on its own.
+static void
+lazy_extent(
+    Lazy *const lz,
+    Extent *const xi,
+    Extent *const xo,
+    f_expand *const f_exp,
+    f_unfilter *const f_unf
+)
+{
+    unsigned n0 = lz->n;
+    char const *const lo = xo->buf;
+    while (xo->size) {
+        struct b_info const *const h = (struct b_info const *)(void const *)xi->buf;
+        size_t const len = sizeof(*h) + h->sz_cpr;
+        if (sizeof(*h) <= xi->size && len <= xi->size && lz->n < lz->max
+        &&  lo != xo->buf && h->sz_unc < xo->size  // neither first nor last
+        &&  0 == (~PAGE_MASK & ((size_t)xo->buf | h->sz_unc))
+        &&  h->sz_cpr <= h->sz_unc && B_PAGES != h->b_method) {
+            LazyBlock *const b = &lz->blk[lz->n++];
+            b->addr = xo->buf;
+            b->bi = h;
+            xi->buf  += len; xi->size -= len;
+            xo->buf  += h->sz_unc; xo->size -= h->sz_unc;
+        }
+        else { // one block now; filter as unpackExtent(xi, xo) would
+            lazy_register(lz, n0, f_exp, f_unf);
+            n0 = lz->n;
+            Extent x1;
+            x1.buf = xo->buf;
+            x1.size = (h->sz_unc && h->sz_unc < xo->size) ? h->sz_unc : xo->size;
+            unpackExtent(xi, &x1, f_exp,
+                ((512 < h->sz_unc || xo->size <= h->sz_unc) ? f_unf : 0));
+            size_t const done = x1.buf - xo->buf;
+            if (!done) { // EOF
+                break;
+            }
+            xo->buf  += done; xo->size -= done;
+        }
+    }
+    lazy_register(lz, n0, f_exp, f_unf);
+}
+
+// Decompress one block, and hand its pages to the kernel.
+static void
+lazy_fill(Lazy const *const lz, int const uffd, LazyBlock const *const b)
+{
+    struct b_info const *const h = b->bi;
+    size_t const sz_unc = h->sz_unc;
+    char const *src = (char const *)(1+ h);
+    uint64_t cp[5];  // struct uffdio_copy
+    size_t j;
+    if (h->sz_cpr < sz_unc) {
+        size_t out_len = sz_unc;
+        if (0 != (*lz->f_exp)((unsigned char const *)src, h->sz_cpr,
+                (unsigned char *)lz->buf, &out_len,
+                *(int const *)(void const *)&h->b_method)
+        ||  out_len != sz_unc) {
+            exit_group(127);  // the program cannot continue
+        }
+        if (h->b_ftid != 0 && lz->f_unf) {
+            (*lz->f_unf)((unsigned char *)lz->buf, out_len, h->b_cto8, h->b_ftid);
+        }
+        src = lz->buf;
+    }
+    cp[0] = (size_t)b->addr; cp[1] = (size_t)src; cp[2] = sz_unc;
+    cp[3] = 0; cp[4] = 0;
+    if (0 != ioctl(uffd, UFFDIO_COPY, cp)) {
+        // Some pages are present already (-EEXIST): one page at a time.
+        for (j = 0; j < sz_unc; j += PAGE_SIZE) {
+            cp[0] = (size_t)(j + b->addr); cp[1] = (size_t)(j + src);
+            cp[2] = PAGE_SIZE; cp[3] = 0;
+            ioctl(uffd, UFFDIO_COPY, cp);
+        }
+        cp[0] = (size_t)b->addr; cp[1] = sz_unc;  // struct uffdio_range
+        ioctl(uffd, UFFDIO_WAKE, cp);
+    }
+}
+
+static void
+lazy_serve(void *const arg)
+{
+    Lazy const *const lz = (Lazy const *)arg;
+    for (;;) {
+        uint64_t msg[4];  // struct uffd_msg
+        if ((int)sizeof(msg) != read(lz->uffd, msg, sizeof(msg))) {
+            exit(0);  // just this thread
+        }
+        if (UFFD_EVENT_PAGEFAULT == (0xff & msg[0])) {
+            // the last block which begins at or below the address
+            unsigned lo = 0, hi = lz->n;
+            while (1 < hi - lo) {
+                unsigned const mid = (lo + hi) >> 1;
+                if ((char *)msg[2] < lz->blk[mid].addr) {
+                    hi = mid;
+                }
+                else {
+                    lo = mid;
+                }
+            }
+            lazy_fill(lz, lz->uffd, &lz->blk[lo]);
+            msg[1] = PAGE_MASK & msg[2]; msg[2] = PAGE_SIZE;
+            ioctl(lz->uffd, UFFDIO_WAKE, &msg[1]);
+        }
+        else if (UFFD_EVENT_FORK == (0xff & msg[0])) {
+            // Nobody would serve the faults of the child after we are gone.
+            int const ufd = lazy_high_fd((int)msg[1]);
+            unsigned j;
+            for (j = 0; j < lz->n; ++j) {
+                lazy_fill(lz, ufd, &lz->blk[j]);
+            }
+            close(ufd);
+        }
+    }
+}
+
+static void
+lazy_start(Lazy *const lz)
+{
+    if (lz->n) {
+        uint64_t all = ~(uint64_t)0, old;
+        // The thread must never run a signal handler of the program.
+        rt_sigprocmask(SIG_SETMASK, &all, &old, sizeof(all));
+        int const rv = clone_thread(CLONE_VM_THREAD, lz->stack, lazy_serve, lz, 0);
+        rt_sigprocmask(SIG_SETMASK, &old, 0, sizeof(old));
+        if (0 < rv) {
+            return;
+        }
+        // No thread: decompress the rest now.  The pages may be read-only,
+        // so they must go through UFFDIO_COPY.
+        unsigned j;
+        for (j = 0; j < lz->n; ++j) {
+            lazy_fill(lz, lz->uffd, &lz->blk[j]);
+        }
+    }
+    close(lz->uffd);
+}
+#endif  //}
+
+#if defined(__x86_64)  //{ --cache-dir
+/*************************************************************************
+// Cache of the decompressed program.  The packer put an absolute directory
+// over the marker at get_cache_dir(), and the adler32 of the PT_LOADs of
+// the original file into p_info.p_progid.  The cache file has the PT_LOADs
+// at their original file offsets, so that it can be mapped just like an
+// uncompressed program: all processes which run it share its pages.
+// Its name also has the adler32 of the compressed data (the whole b_info
+// chain), so two packed programs share it only if both checksums and the
+// size agree.  The first run writes the file; later runs check the adler32
+// of the PT_LOADs before use.
+**************************************************************************/
+
+#define O_NOFOLLOW 0400000
+#define CACHE_NAME (128 + 4*(1+ 8) + 1)  // dir/progid-filesize-cadler.pid
+
+// amd64-linux.elf-fold.S; these return -errno on failure
+char const *get_cache_dir(void);
+int fstat(int fd, uint64_t *st);  // struct stat is 18 words
+ssize_t pwrite(int fd, void const *buf, size_t len, off_t pos);
+int rename(char const *from, char const *to);
+int unlink(char const *name);
+int getpid(void);
+int geteuid(void);
+
+static unsigned
+cache_adler(unsigned adler, unsigned char const *p, size_t len)
+{
+    unsigned s1 = 0xffff & adler, s2 = adler >> 16;
+    while (len) {
+        size_t n = (len < 5552) ? len : 5552;  // no overflow of s2
+        len -= n;
+        do {
+            s1 += *p++;
+            s2 += s1;
+        } while (--n);
+        s1 %= 65521;
+        s2 %= 65521;
+    }
+    return (s2 << 16) | s1;
+}
+
+static char *
+cache_hex(char *p, unsigned const x)
+{
+    int j;
+    for (j = 28; 0 <= j; j -= 4) {
+        unsigned const d = 0xf & (x >> j);
+        *p++ = (char)(d + (d < 10 ? '0' : 'a' - 10));
+    }
+    *p = 0;
+    return p;
+}
+
+// Returns the end of the name of the cache file, or 0 if none.
+static char *
+cache_name(char *p, struct p_info const *const pi, Extent const *const xi)
+{
+    char const *dir = get_cache_dir();
+    if ('/' != *dir || 0 == pi->p_progid) { // no --cache-dir
+        return 0;
+    }
+    while (*dir) {
+        *p++ = *dir++;
+    }
+    *p++ = '/';
+    p = cache_hex(p, pi->p_progid);
+    *p++ = '-';
+    p = cache_hex(p, pi->p_filesize);
+    *p++ = '-';
+    return cache_hex(p, cache_adler(1, (unsigned char const *)xi->buf, xi->size));
+}
+
+// Returns a descriptor for a cache file which matches, else -1.
+static int
+cache_open(char const *const name, Elf64_Ehdr const *const ehdr, unsigned const adler0)
+{
+    uint64_t st[18];  // struct stat
+    Elf64_Phdr const *phdr;
+    unsigned adler = 1;
+    size_t hi = 0;
+    char *img;
+    int j;
+    int const fd = open(name, O_RDONLY | O_NOFOLLOW | O_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    phdr = (Elf64_Phdr const *)(1+ ehdr);
+    for (j = 0; j < ehdr->e_phnum; ++phdr, ++j) if (PT_LOAD == phdr->p_type) {
+        if (hi < phdr->p_offset + phdr->p_filesz) {
+            hi = phdr->p_offset + phdr->p_filesz;
+        }
+    }
+    // Trust only a regular file of root or of ourself, which nobody else
+    // may write; and do not SIGBUS on a short one.
+    if (0 != fstat(fd, st)
+    ||  0100000 != (0170000 & st[3])  // S_ISREG(.st_mode)
+    ||  (022 & st[3])
+    ||  ((st[3] >> 32) && (st[3] >> 32) != (unsigned)geteuid())  // .st_uid
+    ||  st[6] < hi) {  // .st_size
+        goto fail;
+    }
+    img = (char *)mmap(0, hi, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (~PAGE_MASK & (size_t)img) {
+        goto fail;
+    }
+    phdr = (Elf64_Phdr const *)(1+ ehdr);
+    for (j = 0; j < ehdr->e_phnum; ++phdr, ++j) if (PT_LOAD == phdr->p_type) {
+        adler = cache_adler(adler,
+            (unsigned char const *)(phdr->p_offset + img), phdr->p_filesz);
+    }
+    munmap(img, hi);
+    if (adler == adler0) {
+        return fd;
+    }
+fail:
+    close(fd);
+    return -1;
+}
+
+// Write the cache file from the PT_LOADs just decompressed.
+static void
+cache_write(char const *const name, Elf64_Ehdr const *const ehdr, Elf64_Addr const reloc)
+{
+    Elf64_Phdr const *phdr = (Elf64_Phdr const *)(1+ ehdr);
+    char tmp[CACHE_NAME], *p = tmp;
+    char const *q = name;
+    int j, ok = 1;
+    while (*q) {
+        *p++ = *q++;
+    }
+    *p++ = '.';
+    cache_hex(p, getpid());  // others may be at it, too
+    // readable by our own uid only: do not leak the image to others
+    int const fd = open(tmp, O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC, 0600);
+    if (fd < 0) {
+        return;
+    }
+    for (j = 0; j < ehdr->e_phnum; ++phdr, ++j) if (PT_LOAD == phdr->p_type) {
+        ok &= (ssize_t)phdr->p_filesz == pwrite(fd,
+            reloc + (char const *)phdr->p_vaddr, phdr->p_filesz, phdr->p_offset);
+    }
+    // make_hatch_x86_64 may have used Elf64_Ehdr.e_ident[12..15]
+    ok &= (ssize_t)sizeof(*ehdr) == pwrite(fd, ehdr, sizeof(*ehdr), 0);
+    close(fd);
+    if (!ok || 0 != rename(tmp, name)) {
+        unlink(tmp);
+    }
+}
+#endif  //}
+
+#if defined(__x86_64)  //{ --hugepage-text
+// The packer aligned the stub ET_DYN to 2 MiB, so the PF_X PT_LOAD of a
+// -pie program keeps its offset from a 2 MiB boundary.  With MADV_HUGEPAGE
+// before decompressing into it, each 2 MiB which the PT_LOAD covers
+// completely can be one huge page: fewer iTLB misses.
+#define MADV_HUGEPAGE 14
+int madvise(void *addr, size_t len, int advice);  // amd64-linux.elf-fold.S
+#endif  //}
+
 // Find convex hull of PT_LOAD (the minimal interval which covers all PT_LOAD),
 // and mmap that much, to be sure that a kernel using exec-shield-randomize
 // won't place the first piece in a way that leaves no room for the rest.
@@ -453,6 +1081,9 @@ do_xmap(
     Elf64_Addr *p_reloc
 #if defined(__powerpc64__) || defined(__aarch64__)
     , size_t const PAGE_MASK
+#elif defined(__x86_64)
+    , Lazy *const lz  // --lazy
+    , unsigned const hugepage  // --hugepage-text
 #endif
 )
 {
@@ -511,13 +1142,38 @@ do_xmap(
         mlen += -(mlen + (size_t)addr) &~ PAGE_MASK;
 #endif
 
+#if defined(__x86_64)  //{
+        // The main program maps from fdi too, if it is cached.
+        if (addr != mmap(addr, mlen, prot | (xi ? PROT_WRITE : 0),
+                MAP_FIXED | MAP_PRIVATE | ((xi && fdi < 0) ? MAP_ANONYMOUS : 0),
+                fdi, phdr->p_offset - frag) ) {
+            err_exit(8);
+        }
+#if defined(__x86_64)  //{
+        if (hugepage && (PF_X & phdr->p_flags)) { // before the first touch
+            madvise(addr, mlen, MADV_HUGEPAGE);
+        }
+#endif  //}
+        if (xi && fdi < 0) {
+#else  //}{
         if (addr != mmap(addr, mlen, prot | (xi ? PROT_WRITE : 0),
                 MAP_FIXED | MAP_PRIVATE | (xi ? MAP_ANONYMOUS : 0),
                 (xi ? -1 : fdi), phdr->p_offset - frag) ) {
             err_exit(8);
         }
         if (xi) {
+#endif  //}
+#if defined(__x86_64)  //{
+            if (lz) {
+                lazy_extent(lz, xi, &xo, f_exp, f_unf);
+            }
+            else
+#endif  //}
+#if defined(__x86_64)  //{
+            mt_unpackExtent(xi, &xo, f_exp, f_unf);
+#else  //}{
             unpackExtent(xi, &xo, f_exp, f_unf);
+#endif  //}
         }
         // Linux does not fixup the low end, so neither do we.
         //if (PROT_WRITE & prot) {
@@ -575,7 +1231,11 @@ upx_main(  // returns entry address
     struct b_info const *const bi,  // 1st block header
     size_t const sz_compressed,  // total length
     Elf64_Ehdr *const ehdr,  // temp char[sz_ehdr] for decompressing
+#if defined(__x86_64)  //{
+    Elf64_auxv_t *av,  // bit 1 set: --lazy
+#else  //}{
     Elf64_auxv_t *const av,
+#endif  //}
     f_expand *const f_exp,
     f_unfilter *const f_unf
 #if defined(__x86_64)  //{
@@ -600,17 +1260,49 @@ upx_main(  // returns entry address
 
 #if defined(__x86_64) || defined(__aarch64__)  //{
     Elf64_Addr *const p_reloc = &elfaddr;
+#endif  //}
+#if defined(__x86_64)  //{
+    char cname[CACHE_NAME];
+    int const fdc = cache_name(cname, ((struct p_info const *)bi) - 1, &xi1)
+        ? cache_open(cname, ehdr, (((struct p_info const *)bi) - 1)->p_progid)
+        : -2;  // no --cache-dir
+    unsigned const hugepage = 4 & (size_t)av;  // --hugepage-text
+    Lazy *lz = 0;
+    av = (Elf64_auxv_t *)(~(size_t)4 & (size_t)av);
+    if (2 & (size_t)av) { // --lazy
+        av = (Elf64_auxv_t *)(~(size_t)2 & (size_t)av);
+        if (-2 == fdc) { // else a cache is better
+            lz = lazy_init(&xi1, f_exp, f_unf);
+        }
+    }
 #endif  //}
     DPRINTF("upx_main1  .e_entry=%%p  p_reloc=%%p  *p_reloc=%%p  PAGE_MASK=%%p\\n",
         ehdr->e_entry, p_reloc, *p_reloc, PAGE_MASK);
     Elf64_Phdr *phdr = (Elf64_Phdr *)(1+ ehdr);
 
     // De-compress Ehdr again into actual position, then de-compress the rest.
+#if defined(__x86_64)  //{
+    Elf64_Addr entry = do_xmap(ehdr, &xi1, (fdc < 0 ? -1 : fdc), av, f_exp, f_unf, p_reloc
+#else  //}{
     Elf64_Addr entry = do_xmap(ehdr, &xi1, 0, av, f_exp, f_unf, p_reloc
+#endif  //}
 #if defined(__powerpc64__) || defined(__aarch64__)
        , PAGE_MASK
+#elif defined(__x86_64)
+       , lz, hugepage
 #endif
     );
+#if defined(__x86_64)  //{
+    if (lz) { // before anything touches the pages
+        lazy_start(lz);
+    }
+    if (0 <= fdc) {
+        close(fdc);
+    }
+    else if (-1 == fdc) { // before PT_INTERP re-uses ehdr
+        cache_write(cname, ehdr, *p_reloc);
+    }
+#endif  //}
     DPRINTF("upx_main2  entry=%%p  *p_reloc=%%p\\n", entry, *p_reloc);
     auxv_up(av, AT_ENTRY , entry);
 
@@ -633,6 +1325,8 @@ ERR_LAB
         entry = do_xmap(ehdr, 0, fdi, 0, 0, 0, p_reloc
 #if defined(__powerpc64__) || defined(__aarch64__)
             , PAGE_MASK
+#elif defined(__x86_64)
+            , 0, 0
 #endif
         );
         auxv_up(av, AT_BASE, *p_reloc);  // musl
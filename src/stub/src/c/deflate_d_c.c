@@ -0,0 +1,354 @@
+/* deflate_d_c.c -- minimal decoder for raw Deflate streams
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2022 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2022 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+
+/*************************************************************************
+// A small decoder for one raw Deflate stream (RFC 1951), as written by
+// upx_zlib_compress(). The Huffman codes are decoded canonically, one
+// bit at a time, which needs no lookup tables: this runs at about half
+// the speed of zlib's inflate(), which is still faster than LZMA, and
+// the code is smaller than the LZMA decoder and needs just 1.5 KiB of
+// work memory.
+//
+// This file is compiled twice: by the stub Makefile.extra rules into
+// deflate_d_cf.S, and by ../../../compress_zlib.cpp for the host side.
+// Therefore: no #include, no static data, no string constants, no calls
+// to libc, and DeflateDecode() must be the first function in the file.
+**************************************************************************/
+
+#define DEFLATE_WORK_SIZE   0x600       /* >= sizeof(DeflateWork) */
+
+typedef struct {
+    short lencnt[16];
+    short lensym[288];
+    short distcnt[16];
+    short distsym[30];
+    short lengths[288 + 30];
+    const unsigned char *ip;
+    const unsigned char *iend;
+    unsigned bitbuf;
+    unsigned bitcnt;
+    int error;                      /* input overrun or corrupt data */
+    int need;                       /* in-place overlap, see compress_zlib.cpp */
+} DeflateWork;
+
+int DeflateDecode(const unsigned char *src, unsigned src_len,
+                  unsigned char *dst, unsigned *dst_len, DeflateWork *w);
+
+static unsigned char *deflate_stored(unsigned char *op, unsigned char *oend,
+                                     DeflateWork *w);
+static unsigned char *deflate_codes(unsigned char *op, unsigned char *oend,
+                                    const unsigned char *dst, const unsigned char *src,
+                                    DeflateWork *w);
+static int deflate_dynamic(DeflateWork *w);
+static void deflate_fixed(DeflateWork *w);
+static int deflate_build(short *cnt, short *sym, const short *length, unsigned n);
+static int deflate_decode(DeflateWork *w, const short *cnt, const short *sym);
+static unsigned deflate_bits(DeflateWork *w, unsigned n);
+
+
+/*************************************************************************
+// stream
+**************************************************************************/
+
+int
+DeflateDecode(const unsigned char *src, unsigned src_len,
+              unsigned char *dst, unsigned *dst_len, DeflateWork *w)
+{
+    unsigned char *op = dst;
+    unsigned char *const oend = dst + *dst_len;
+    unsigned last, type;
+
+    *dst_len = 0;
+    w->ip = src;
+    w->iend = src + src_len;
+    w->bitbuf = 0;
+    w->bitcnt = 0;
+    w->error = 0;
+    w->need = 0;
+
+    do {
+        last = deflate_bits(w, 1);
+        type = deflate_bits(w, 2);
+        if (type == 0)
+            op = deflate_stored(op, oend, w);
+        else if (type == 1) {
+            deflate_fixed(w);
+            op = deflate_codes(op, oend, dst, src, w);
+        }
+        else if (type == 2 && deflate_dynamic(w) == 0)
+            op = deflate_codes(op, oend, dst, src, w);
+        else
+            return 0;
+        if (w->error)
+            return 0;
+    } while (!last);
+
+    *dst_len = (unsigned) (op - dst);
+    return (int) (w->ip - src);
+}
+
+
+/*************************************************************************
+// blocks
+**************************************************************************/
+
+static unsigned char *
+deflate_stored(unsigned char *op, unsigned char *oend, DeflateWork *w)
+{
+    const unsigned char *ip = w->ip;
+    unsigned len;
+
+    /* the rest of the current byte is padding */
+    w->bitbuf = 0;
+    w->bitcnt = 0;
+    if (w->iend - ip < 4)
+        goto bad;
+    len = ip[0] | (ip[1] << 8);
+    if ((ip[0] ^ ip[2]) != 0xff || (ip[1] ^ ip[3]) != 0xff)
+        goto bad;
+    ip += 4;
+    if ((unsigned) (w->iend - ip) < len || (unsigned) (oend - op) < len)
+        goto bad;
+    /* forward copy, one input byte per output byte: no change of 'need' */
+    while (len-- != 0)
+        *op++ = *ip++;
+    w->ip = ip;
+    return op;
+bad:
+    w->error = 1;
+    return op;
+}
+
+static unsigned char *
+deflate_codes(unsigned char *op, unsigned char *oend,
+              const unsigned char *dst, const unsigned char *src, DeflateWork *w)
+{
+    for (;;) {
+        int sym = deflate_decode(w, w->lencnt, w->lensym);
+        unsigned len, dist, extra;
+        if (sym < 256) {
+            if (sym < 0 || op == oend)
+                goto bad;
+            *op++ = (unsigned char) sym;
+        }
+        else if (sym == 256)
+            return op;
+        else {
+            /* length: 3..258 */
+            sym -= 257;
+            if (sym >= 29)
+                goto bad;
+            if (sym < 8)
+                len = 3 + sym, extra = 0;
+            else if (sym == 28)
+                len = 258, extra = 0;
+            else {
+                extra = (sym >> 2) - 1;
+                len = ((4 + (sym & 3)) << extra) + 3;
+            }
+            len += deflate_bits(w, extra);
+            /* distance: 1..32768 */
+            sym = deflate_decode(w, w->distcnt, w->distsym);
+            if (sym < 0 || sym >= 30)
+                goto bad;
+            if (sym < 4)
+                dist = 1 + sym, extra = 0;
+            else {
+                extra = (sym >> 1) - 1;
+                dist = ((2 + (sym & 1)) << extra) + 1;
+            }
+            dist += deflate_bits(w, extra);
+            if (dist > (unsigned) (op - dst) || len > (unsigned) (oend - op))
+                goto bad;
+            do {
+                *op = op[0 - (long) dist];
+                op++;
+            } while (--len != 0);
+        }
+        if (w->error)
+            goto bad;
+        /* in place, the output must not reach the unread input */
+        if ((op - dst) - (w->ip - src) > w->need)
+            w->need = (int) ((op - dst) - (w->ip - src));
+    }
+bad:
+    w->error = 1;
+    return op;
+}
+
+static void
+deflate_fixed(DeflateWork *w)
+{
+    unsigned i;
+    for (i = 0; i < 144; i++)
+        w->lengths[i] = 8;
+    for (; i < 256; i++)
+        w->lengths[i] = 9;
+    for (; i < 280; i++)
+        w->lengths[i] = 7;
+    for (; i < 288; i++)
+        w->lengths[i] = 8;
+    for (i = 0; i < 30; i++)
+        w->lengths[288 + i] = 5;
+    (void) deflate_build(w->lencnt, w->lensym, w->lengths, 288);
+    (void) deflate_build(w->distcnt, w->distsym, w->lengths + 288, 30);
+}
+
+static int
+deflate_dynamic(DeflateWork *w)
+{
+    /* the order of the code length codes, 5 bits each */
+    const unsigned long long order0 = 0x022caa324e804a30ull; /* 16 17 18 0 8 7 9 6 10 5 11 4 */
+    const unsigned long long order1 = 0x00000003c2e1346cull; /* 12 3 13 2 14 1 15 */
+    unsigned nlen, ndist, ncode, i, n;
+    int sym, left;
+
+    nlen = deflate_bits(w, 5) + 257;
+    ndist = deflate_bits(w, 5) + 1;
+    ncode = deflate_bits(w, 4) + 4;
+    if (nlen > 286 || ndist > 30)
+        return -1;
+    for (i = 0; i < 19; i++)
+        w->lengths[i] = 0;
+    for (i = 0; i < ncode; i++) {
+        n = (unsigned) ((i < 12 ? order0 >> (5 * i) : order1 >> (5 * (i - 12))) & 31);
+        w->lengths[n] = (short) deflate_bits(w, 3);
+    }
+    if (deflate_build(w->lencnt, w->lensym, w->lengths, 19) != 0)
+        return -1;
+
+    for (i = 0; i < nlen + ndist; ) {
+        sym = deflate_decode(w, w->lencnt, w->lensym);
+        if (sym < 0)
+            return -1;
+        if (sym < 16)
+            w->lengths[i++] = (short) sym;
+        else {
+            short len = 0;
+            if (sym == 16) {
+                if (i == 0)
+                    return -1;
+                len = w->lengths[i - 1];
+                n = 3 + deflate_bits(w, 2);
+            }
+            else if (sym == 17)
+                n = 3 + deflate_bits(w, 3);
+            else
+                n = 11 + deflate_bits(w, 7);
+            if (i + n > nlen + ndist)
+                return -1;
+            while (n-- != 0)
+                w->lengths[i++] = len;
+        }
+        if (w->error)
+            return -1;
+    }
+    if (w->lengths[256] == 0)
+        return -1;
+
+    /* incomplete codes are only allowed for a single length */
+    left = deflate_build(w->lencnt, w->lensym, w->lengths, nlen);
+    if (left < 0 || (left > 0 && nlen - w->lencnt[0] != 1))
+        return -1;
+    left = deflate_build(w->distcnt, w->distsym, w->lengths + nlen, ndist);
+    if (left < 0 || (left > 0 && ndist - w->distcnt[0] != 1))
+        return -1;
+    return 0;
+}
+
+
+/*************************************************************************
+// canonical Huffman codes
+**************************************************************************/
+
+/* returns 0 for a complete code, > 0 for an incomplete one, < 0 if
+   the code is over-subscribed */
+static int
+deflate_build(short *cnt, short *sym, const short *length, unsigned n)
+{
+    short offs[16];
+    unsigned i;
+    int left;
+
+    for (i = 0; i < 16; i++)
+        cnt[i] = 0;
+    for (i = 0; i < n; i++)
+        cnt[length[i]]++;
+    if (cnt[0] == (short) n)
+        return 0;
+    left = 1;
+    for (i = 1; i < 16; i++) {
+        left <<= 1;
+        left -= cnt[i];
+        if (left < 0)
+            return left;
+    }
+    offs[1] = 0;
+    for (i = 1; i < 15; i++)
+        offs[i + 1] = (short) (offs[i] + cnt[i]);
+    for (i = 0; i < n; i++)
+        if (length[i] != 0)
+            sym[offs[length[i]]++] = (short) i;
+    return left;
+}
+
+static int
+deflate_decode(DeflateWork *w, const short *cnt, const short *sym)
+{
+    int code = 0, first = 0, index = 0;
+    unsigned len;
+    for (len = 1; len < 16; len++) {
+        int count = cnt[len];
+        code |= (int) deflate_bits(w, 1);
+        if (code - count < first)
+            return sym[index + (code - first)];
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+    return -1;
+}
+
+static unsigned
+deflate_bits(DeflateWork *w, unsigned n)
+{
+    unsigned v = w->bitbuf;
+    while (w->bitcnt < n) {
+        if (w->ip == w->iend) {
+            w->error = 1;
+            return 0;
+        }
+        v |= (unsigned) *w->ip++ << w->bitcnt;
+        w->bitcnt += 8;
+    }
+    w->bitbuf = v >> n;
+    w->bitcnt -= n;
+    return v & ((1u << n) - 1);
+}
+
+/* vim:set ts=4 sw=4 et: */
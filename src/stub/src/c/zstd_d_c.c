@@ -0,0 +1,800 @@
+/* zstd_d_c.c -- minimal decoder for Zstandard frames
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2022 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2022 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+
+/*************************************************************************
+// A self-contained decoder for one Zstandard frame (RFC 8878) without
+// dictionary, as written by upx_zstd_compress() or by "zstd".
+//
+// This file is compiled twice: by the stub Makefile.extra rules into
+// zstd_d_c[fs].S, and by ../../../compress_zstd.cpp for the host side.
+// Therefore: no #include, no static data, no string constants, no calls
+// to libc, and ZstdDecode() must be the first function in the file.
+// The checksum of the frame is skipped, not verified.
+**************************************************************************/
+
+#define ZSTD_BLOCK_MAX      (128 * 1024)
+#define ZSTD_WORK_SIZE      0x22800     /* >= sizeof(ZstdWork) */
+
+typedef struct {
+    unsigned short base;
+    unsigned char nb;
+    unsigned char sym;
+} ZstdFseEntry;
+
+typedef struct {
+    unsigned char lit[ZSTD_BLOCK_MAX];
+    unsigned short huf[1 << 11];    /* (nbBits << 8) | symbol */
+    ZstdFseEntry ll[1 << 9];
+    ZstdFseEntry ml[1 << 9];
+    ZstdFseEntry of[1 << 8];
+    ZstdFseEntry wt[1 << 6];
+    short norm[64];
+    unsigned short next[64];
+    unsigned char weights[256];
+    unsigned rep[3];
+    int need;                       /* in-place overlap, see compress_zstd.cpp */
+    unsigned char huf_bits;         /* 0 = no table yet */
+    unsigned char ll_log, ml_log, of_log; /* tableLog + 1, 0 = no table yet */
+} ZstdWork;
+
+typedef struct {
+    const unsigned char *p;
+    unsigned size;
+    int pos;                        /* unread bits; negative on overflow */
+} ZstdBits;
+
+int ZstdDecode(const unsigned char *src, unsigned src_len,
+               unsigned char *dst, unsigned *dst_len, ZstdWork *w);
+
+static unsigned zstd_block(const unsigned char *ip, unsigned size,
+                           unsigned char *op, unsigned char *oend,
+                           const unsigned char *ostart, int bias, ZstdWork *w);
+static int zstd_literals(const unsigned char *ip, unsigned size,
+                         unsigned *nb_lit, ZstdWork *w);
+static int zstd_huf_table(const unsigned char *ip, unsigned size, ZstdWork *w);
+static int zstd_huf_stream(const unsigned char *ip, unsigned size,
+                           unsigned char *op, unsigned n, const ZstdWork *w);
+static int zstd_seq_table(ZstdFseEntry *t, unsigned char *log, unsigned mode,
+                          const unsigned char *ip, unsigned size,
+                          unsigned max_sym, unsigned max_log, ZstdWork *w);
+static int zstd_read_ncount(short *norm, unsigned *max_sym, unsigned *log,
+                            unsigned max_log, const unsigned char *ip, unsigned size);
+static void zstd_build(ZstdFseEntry *t, const short *norm, unsigned max_sym,
+                       unsigned log, unsigned short *next);
+static void zstd_predef(short *norm, unsigned n, unsigned long long w0,
+                        unsigned long long w1, unsigned long long w2);
+static int zstd_bits_init(ZstdBits *b, const unsigned char *p, unsigned size);
+static unsigned zstd_peek(const ZstdBits *b, unsigned n);
+static unsigned zstd_read(ZstdBits *b, unsigned n);
+static unsigned zstd_fwd_peek(const unsigned char *p, unsigned size, unsigned bitpos);
+static unsigned zstd_ll_base(unsigned code, unsigned *bits);
+static unsigned zstd_ml_base(unsigned code, unsigned *bits);
+static unsigned zstd_highbit(unsigned x);
+
+
+/*************************************************************************
+// frame
+**************************************************************************/
+
+int
+ZstdDecode(const unsigned char *src, unsigned src_len,
+           unsigned char *dst, unsigned *dst_len, ZstdWork *w)
+{
+    const unsigned char *ip = src;
+    const unsigned char *const iend = src + src_len;
+    unsigned char *op = dst;
+    unsigned char *const oend = dst + *dst_len;
+    unsigned fhd, n, hdr, size, last;
+
+    *dst_len = 0;
+    w->need = 0;
+    w->huf_bits = 0;
+    w->ll_log = w->ml_log = w->of_log = 0;
+    w->rep[0] = 1; w->rep[1] = 4; w->rep[2] = 8;
+
+    if (src_len < 6 || ip[0] != 0x28 || ip[1] != 0xb5 || ip[2] != 0x2f || ip[3] != 0xfd)
+        return 0;
+    fhd = ip[4];
+    if (fhd & 0x08)  // reserved bit
+        return 0;
+    ip += 5;
+    if (!(fhd & 0x20))  // Window_Descriptor
+        ip += 1;
+    n = (fhd & 3) == 3 ? 4 : (fhd & 3);  // Dictionary_ID: must be absent or 0
+    if ((unsigned) (iend - ip) < n)
+        return 0;
+    for (; n != 0; --n)
+        if (*ip++ != 0)
+            return 0;
+    n = fhd >> 6;  // Frame_Content_Size is not needed
+    n = n == 0 ? ((fhd & 0x20) ? 1 : 0) : (1u << n);
+    ip += n;
+
+    do {
+        if (ip > iend || (unsigned) (iend - ip) < 3)
+            return 0;
+        hdr = ip[0] | (ip[1] << 8) | ((unsigned) ip[2] << 16);
+        ip += 3;
+        last = hdr & 1;
+        size = hdr >> 3;
+        switch ((hdr >> 1) & 3) {
+        case 0:  // Raw_Block
+            if ((unsigned) (iend - ip) < size || (unsigned) (oend - op) < size)
+                return 0;
+            if (w->need < (int) (op - dst) - (int) (ip - src))
+                w->need = (int) (op - dst) - (int) (ip - src);
+            for (n = size; n != 0; --n)
+                *op++ = *ip++;
+            break;
+        case 1:  // RLE_Block
+            if (ip >= iend || (unsigned) (oend - op) < size)
+                return 0;
+            if (w->need < (int) (op + size - dst) - (int) (ip + 1 - src))
+                w->need = (int) (op + size - dst) - (int) (ip + 1 - src);
+            for (n = size; n != 0; --n)
+                *op++ = *ip;
+            ip += 1;
+            break;
+        case 2:  // Compressed_Block
+            if (size > ZSTD_BLOCK_MAX || (unsigned) (iend - ip) < size)
+                return 0;
+            n = zstd_block(ip, size, op, oend, dst,
+                           (int) (op - dst) - (int) (ip - src), w);
+            if (n == 0u - 1)
+                return 0;
+            op += n;
+            ip += size;
+            break;
+        default:
+            return 0;
+        }
+    } while (!last);
+
+    if (fhd & 0x04)  // Content_Checksum
+        ip += 4;
+    if (ip > iend)
+        return 0;
+    *dst_len = (unsigned) (op - dst);
+    return (int) (ip - src);
+}
+
+
+
+/*************************************************************************
+// block
+**************************************************************************/
+
+// Decompress one Compressed_Block; return the number of bytes written,
+// or -1 on error. 'bias' is (op - dst) - (ip - src) in ZstdDecode().
+static unsigned
+zstd_block(const unsigned char *ip, unsigned size,
+           unsigned char *op, unsigned char *oend,
+           const unsigned char *ostart, int bias, ZstdWork *w)
+{
+    const unsigned char *const istart = ip;
+    const unsigned char *const iend = ip + size;
+    unsigned char *const obase = op;
+    const unsigned char *lit = w->lit;
+    const unsigned char *lend;
+    const unsigned char *seq;
+    unsigned nb_seq, n;
+    int r;
+
+    r = zstd_literals(ip, size, &n, w);
+    if (r < 0)
+        return 0u - 1;
+    lend = lit + n;
+    ip += r;
+
+    // the input from here on is needed until the end of the block
+    seq = ip;
+    if (ip >= iend)
+        return 0u - 1;
+    nb_seq = *ip++;
+    if (nb_seq >= 128) {
+        if (iend - ip < (nb_seq == 255 ? 2 : 1))
+            return 0u - 1;
+        if (nb_seq == 255) {
+            nb_seq = ip[0] + (ip[1] << 8) + 0x7f00;
+            ip += 2;
+        } else {
+            nb_seq = ((nb_seq - 128) << 8) + *ip++;
+        }
+    }
+
+    if (nb_seq != 0) {
+        ZstdBits b;
+        unsigned modes, ll, ml, of;
+
+        if (ip >= iend)
+            return 0u - 1;
+        modes = *ip++;
+        if (modes & 3)
+            return 0u - 1;
+        r = zstd_seq_table(w->ll, &w->ll_log, (modes >> 6) & 3, ip, (unsigned) (iend - ip), 35, 9, w);
+        if (r < 0)
+            return 0u - 1;
+        ip += r;
+        r = zstd_seq_table(w->of, &w->of_log, (modes >> 4) & 3, ip, (unsigned) (iend - ip), 31, 8, w);
+        if (r < 0)
+            return 0u - 1;
+        ip += r;
+        r = zstd_seq_table(w->ml, &w->ml_log, (modes >> 2) & 3, ip, (unsigned) (iend - ip), 52, 9, w);
+        if (r < 0)
+            return 0u - 1;
+        ip += r;
+
+        if (!zstd_bits_init(&b, ip, (unsigned) (iend - ip)))
+            return 0u - 1;
+        ll = zstd_read(&b, w->ll_log - 1);
+        of = zstd_read(&b, w->of_log - 1);
+        ml = zstd_read(&b, w->ml_log - 1);
+        for (;;) {
+            const ZstdFseEntry *const el = &w->ll[ll];
+            const ZstdFseEntry *const em = &w->ml[ml];
+            const ZstdFseEntry *const eo = &w->of[of];
+            const unsigned char *from;
+            unsigned offset, ml_len, ll_len, bits;
+
+            offset = (1u << eo->sym) + zstd_read(&b, eo->sym);
+            ml_len = zstd_ml_base(em->sym, &bits);
+            ml_len += zstd_read(&b, bits);
+            ll_len = zstd_ll_base(el->sym, &bits);
+            ll_len += zstd_read(&b, bits);
+
+            if (offset > 3) {
+                offset -= 3;
+                w->rep[2] = w->rep[1];
+                w->rep[1] = w->rep[0];
+                w->rep[0] = offset;
+            } else {
+                n = offset - 1 + (ll_len == 0);
+                offset = w->rep[0];
+                if (n != 0) {
+                    if (n != 3)
+                        offset = w->rep[n];
+                    else
+                        offset -= 1;
+                    if (n != 1)
+                        w->rep[2] = w->rep[1];
+                    w->rep[1] = w->rep[0];
+                    w->rep[0] = offset;
+                }
+            }
+
+            if ((unsigned) (lend - lit) < ll_len || (unsigned) (oend - op) < ll_len)
+                return 0u - 1;
+            for (n = ll_len; n != 0; --n)
+                *op++ = *lit++;
+            if (offset - 1 >= (unsigned) (op - ostart) || (unsigned) (oend - op) < ml_len)
+                return 0u - 1;
+            from = op - offset;
+            for (n = ml_len; n != 0; --n)  // may overlap by design
+                *op++ = *from++;
+
+            if (--nb_seq == 0)
+                break;
+            ll = el->base + zstd_read(&b, el->nb);
+            ml = em->base + zstd_read(&b, em->nb);
+            of = eo->base + zstd_read(&b, eo->nb);
+        }
+        if (b.pos != 0)
+            return 0u - 1;
+    }
+
+    // the last literals
+    if ((unsigned) (oend - op) < (unsigned) (lend - lit))
+        return 0u - 1;
+    while (lit < lend)
+        *op++ = *lit++;
+
+    r = bias + (int) (op - obase) - (int) (seq - istart);
+    if (w->need < r)
+        w->need = r;
+    return (unsigned) (op - obase);
+}
+
+static unsigned
+zstd_ll_base(unsigned code, unsigned *bits)
+{
+    if (code < 16) { *bits = 0; return code; }
+    if (code < 20) { *bits = 1; return 16 + 2 * (code - 16); }
+    if (code < 22) { *bits = 2; return 24 + 4 * (code - 20); }
+    if (code < 24) { *bits = 3; return 32 + 8 * (code - 22); }
+    if (code < 25) { *bits = 4; return 48; }
+    *bits = code - 19; return 1u << (code - 19);
+}
+
+static unsigned
+zstd_ml_base(unsigned code, unsigned *bits)
+{
+    if (code < 32) { *bits = 0; return 3 + code; }
+    if (code < 36) { *bits = 1; return 35 + 2 * (code - 32); }
+    if (code < 38) { *bits = 2; return 43 + 4 * (code - 36); }
+    if (code < 40) { *bits = 3; return 51 + 8 * (code - 38); }
+    if (code < 42) { *bits = 4; return 67 + 16 * (code - 40); }
+    if (code < 43) { *bits = 5; return 99; }
+    *bits = code - 36; return 3 + (1u << (code - 36));
+}
+
+
+/*************************************************************************
+// literals
+**************************************************************************/
+
+// Decode the Literals_Section into w->lit; return its size, or -1.
+static int
+zstd_literals(const unsigned char *ip, unsigned size,
+              unsigned *nb_lit, ZstdWork *w)
+{
+    unsigned type, sf, hsize, regen, comp, bits, n;
+    unsigned long long h;
+    int r;
+
+    if (size < 1)
+        return -1;
+    type = ip[0] & 3;
+    sf = (ip[0] >> 2) & 3;
+    if (type < 2) {  // Raw_Literals_Block or RLE_Literals_Block
+        hsize = (sf & 1) ? (sf >> 1) + 2 : 1;
+        if (size < hsize + type)
+            return -1;
+        regen = ip[0] >> 3;
+        if (sf == 1)
+            regen = (ip[0] >> 4) + (ip[1] << 4);
+        if (sf == 3)
+            regen = (ip[0] >> 4) + (ip[1] << 4) + (ip[2] << 12);
+        if (regen > ZSTD_BLOCK_MAX)
+            return -1;
+        ip += hsize;
+        *nb_lit = regen;
+        if (type == 1) {
+            for (n = 0; n < regen; n++)
+                w->lit[n] = ip[0];
+            return (int) hsize + 1;
+        }
+        if (size - hsize < regen)
+            return -1;
+        for (n = 0; n < regen; n++)
+            w->lit[n] = ip[n];
+        return (int) (hsize + regen);
+    }
+
+    // Compressed_Literals_Block or Treeless_Literals_Block
+    hsize = sf < 2 ? 3 : sf + 2;
+    if (size < hsize)
+        return -1;
+    h = 0;
+    for (n = hsize; n != 0; --n)
+        h = (h << 8) | ip[n - 1];
+    bits = sf < 2 ? 10 : sf * 4 + 6;
+    regen = (unsigned) (h >> 4) & ((1u << bits) - 1);
+    comp = (unsigned) (h >> (4 + bits)) & ((1u << bits) - 1);
+    if (regen > ZSTD_BLOCK_MAX || comp > size - hsize)
+        return -1;
+    ip += hsize;
+    *nb_lit = regen;
+    size = hsize + comp;
+    if (type == 2) {
+        r = zstd_huf_table(ip, comp, w);
+        if (r < 0)
+            return -1;
+        ip += r;
+        comp -= r;
+    } else if (w->huf_bits == 0) {
+        return -1;
+    }
+
+    if (sf == 0) {
+        if (!zstd_huf_stream(ip, comp, w->lit, regen, w))
+            return -1;
+    } else {
+        unsigned char *op = w->lit;
+        unsigned seg = (regen + 3) >> 2;
+        unsigned s1, s2, s3;
+
+        if (comp < 6 || regen < 3 * seg)
+            return -1;
+        s1 = ip[0] + (ip[1] << 8);
+        s2 = ip[2] + (ip[3] << 8);
+        s3 = ip[4] + (ip[5] << 8);
+        ip += 6;
+        comp -= 6;
+        if (s1 + s2 + s3 > comp)
+            return -1;
+        if (!zstd_huf_stream(ip, s1, op, seg, w))
+            return -1;
+        ip += s1; op += seg;
+        if (!zstd_huf_stream(ip, s2, op, seg, w))
+            return -1;
+        ip += s2; op += seg;
+        if (!zstd_huf_stream(ip, s3, op, seg, w))
+            return -1;
+        ip += s3; op += seg;
+        if (!zstd_huf_stream(ip, comp - s1 - s2 - s3, op, regen - 3 * seg, w))
+            return -1;
+    }
+    return (int) size;
+}
+
+static int
+zstd_huf_stream(const unsigned char *ip, unsigned size,
+                unsigned char *op, unsigned n, const ZstdWork *w)
+{
+    ZstdBits b;
+    unsigned e;
+
+    if (!zstd_bits_init(&b, ip, size))
+        return 0;
+    for (; n != 0; --n) {
+        e = w->huf[zstd_peek(&b, w->huf_bits)];
+        *op++ = (unsigned char) e;
+        b.pos -= (int) (e >> 8);
+    }
+    return b.pos == 0;
+}
+
+// Read a Huffman_Tree_Description and build w->huf; return its size, or -1.
+static int
+zstd_huf_table(const unsigned char *ip, unsigned size, ZstdWork *w)
+{
+    unsigned char *const wt = w->weights;
+    unsigned short start[16];
+    unsigned hb, n, i, u, len, total, bits, rest, e;
+
+    if (size < 1)
+        return -1;
+    hb = ip[0];
+    if (hb < 128) {  // FSE-compressed weights, with two interleaved states
+        ZstdBits b;
+        unsigned max_sym = 15, log, s1, s2;
+        int r;
+
+        if (size - 1 < hb)
+            return -1;
+        r = zstd_read_ncount(w->norm, &max_sym, &log, 6, ip + 1, hb);
+        if (r < 0)
+            return -1;
+        zstd_build(w->wt, w->norm, max_sym, log, w->next);
+        if (!zstd_bits_init(&b, ip + 1 + r, hb - r))
+            return -1;
+        s1 = zstd_read(&b, log);
+        s2 = zstd_read(&b, log);
+        n = 0;
+        for (;;) {
+            if (n > 253)
+                return -1;
+            wt[n++] = w->wt[s1].sym;
+            s1 = w->wt[s1].base + zstd_read(&b, w->wt[s1].nb);
+            if (b.pos < 0) {
+                wt[n++] = w->wt[s2].sym;
+                break;
+            }
+            wt[n++] = w->wt[s2].sym;
+            s2 = w->wt[s2].base + zstd_read(&b, w->wt[s2].nb);
+            if (b.pos < 0) {
+                wt[n++] = w->wt[s1].sym;
+                break;
+            }
+        }
+        hb += 1;
+    } else {  // direct representation, 4 bits per weight
+        n = hb - 127;
+        hb = 1 + ((n + 1) >> 1);
+        if (size < hb)
+            return -1;
+        for (i = 0; i < n; i++)
+            wt[i] = (unsigned char) ((i & 1) ? ip[1 + (i >> 1)] & 15 : ip[1 + (i >> 1)] >> 4);
+    }
+
+    // the weight of the last symbol is implied
+    total = 0;
+    for (i = 0; i < n; i++) {
+        if (wt[i] > 11)
+            return -1;
+        total += (1u << wt[i]) >> 1;
+    }
+    if (total == 0)
+        return -1;
+    bits = zstd_highbit(total) + 1;
+    rest = (1u << bits) - total;
+    if (bits > 11 || (rest & (rest - 1)) != 0)
+        return -1;
+    wt[n++] = (unsigned char) (zstd_highbit(rest) + 1);
+
+    // symbols of equal weight get consecutive ranges, in symbol order
+    for (i = 0; i < 16; i++)
+        start[i] = 0;
+    for (i = 0; i < n; i++)
+        start[wt[i]]++;
+    u = 0;
+    for (i = 1; i <= bits; i++) {
+        len = start[i] << (i - 1);
+        start[i] = (unsigned short) u;
+        u += len;
+    }
+    for (i = 0; i < n; i++) {
+        if (wt[i] == 0)
+            continue;
+        len = (1u << wt[i]) >> 1;
+        e = ((bits + 1 - wt[i]) << 8) | i;
+        for (u = start[wt[i]]; len != 0; --len)
+            w->huf[u++] = (unsigned short) e;
+        start[wt[i]] = (unsigned short) u;
+    }
+    w->huf_bits = (unsigned char) bits;
+    return (int) hb;
+}
+
+
+/*************************************************************************
+// FSE tables
+**************************************************************************/
+
+// Set up the table of one Symbol_Compression_Mode; return the number of
+// bytes read, or -1. *log is tableLog + 1 of the current table.
+static int
+zstd_seq_table(ZstdFseEntry *t, unsigned char *log, unsigned mode,
+               const unsigned char *ip, unsigned size,
+               unsigned max_sym, unsigned max_log, ZstdWork *w)
+{
+    unsigned l;
+    int r = 0;
+
+    if (mode == 0) {  // Predefined_Mode
+        if (max_sym == 35) {
+            zstd_predef(w->norm, 36, 0x36db4936db6db6e5ULL, 0x9249c6dbULL, 0);
+            l = 6;
+        } else if (max_sym == 52) {
+            zstd_predef(w->norm, 53, 0x24924924936db72aULL, 0x2492492492492492ULL, 0x492ULL);
+            l = 6;
+        } else {
+            zstd_predef(w->norm, 29, 0x24924924936d2492ULL, 0x92ULL, 0);
+            max_sym = 28;
+            l = 5;
+        }
+        zstd_build(t, w->norm, max_sym, l, w->next);
+    } else if (mode == 1) {  // RLE_Mode
+        if (size < 1 || ip[0] > max_sym)
+            return -1;
+        t[0].sym = ip[0];
+        t[0].nb = 0;
+        t[0].base = 0;
+        l = 0;
+        r = 1;
+    } else if (mode == 2) {  // FSE_Compressed_Mode
+        r = zstd_read_ncount(w->norm, &max_sym, &l, max_log, ip, size);
+        if (r < 0)
+            return -1;
+        zstd_build(t, w->norm, max_sym, l, w->next);
+    } else {  // Repeat_Mode
+        return *log != 0 ? 0 : -1;
+    }
+    *log = (unsigned char) (l + 1);
+    return r;
+}
+
+// 3 bits (count + 1) per symbol, 21 symbols per word
+static void
+zstd_predef(short *norm, unsigned n, unsigned long long w0,
+            unsigned long long w1, unsigned long long w2)
+{
+    unsigned long long v = w0;
+    unsigned i;
+
+    for (i = 0; i < n; i++) {
+        if (i == 21)
+            v = w1;
+        if (i == 42)
+            v = w2;
+        norm[i] = (short) ((int) (v & 7) - 1);
+        v >>= 3;
+    }
+}
+
+// Read an FSE_Table_Description; return its size, or -1.
+static int
+zstd_read_ncount(short *norm, unsigned *max_sym, unsigned *log,
+                 unsigned max_log, const unsigned char *ip, unsigned size)
+{
+    unsigned bitpos, v, remaining, threshold, nb, sym, n0, prev0, l;
+    int max, count;
+
+    if (size < 1)
+        return -1;
+    l = (ip[0] & 15) + 5;
+    if (l > max_log)
+        return -1;
+    bitpos = 4;
+    remaining = (1u << l) + 1;
+    threshold = 1u << l;
+    nb = l + 1;
+    sym = 0;
+    prev0 = 0;
+    while (remaining > 1 && sym <= *max_sym) {
+        if (prev0) {
+            n0 = sym;
+            while (((v = zstd_fwd_peek(ip, size, bitpos)) & 0xffff) == 0xffff) {
+                n0 += 24;
+                bitpos += 16;
+                if (n0 > *max_sym)
+                    return -1;
+            }
+            while ((v & 3) == 3) {
+                n0 += 3;
+                bitpos += 2;
+                v >>= 2;
+            }
+            n0 += v & 3;
+            bitpos += 2;
+            if (n0 > *max_sym)
+                return -1;
+            while (sym < n0)
+                norm[sym++] = 0;
+        }
+        v = zstd_fwd_peek(ip, size, bitpos);
+        max = (int) (2 * threshold - 1 - remaining);
+        if ((int) (v & (threshold - 1)) < max) {
+            count = (int) (v & (threshold - 1));
+            bitpos += nb - 1;
+        } else {
+            count = (int) (v & (2 * threshold - 1));
+            if (count >= (int) threshold)
+                count -= max;
+            bitpos += nb;
+        }
+        count -= 1;
+        remaining -= count < 0 ? -count : count;
+        norm[sym++] = (short) count;
+        prev0 = count == 0;
+        while (remaining < threshold) {
+            nb -= 1;
+            threshold >>= 1;
+        }
+    }
+    if (remaining != 1 || bitpos > size * 8)
+        return -1;
+    *max_sym = sym - 1;
+    *log = l;
+    return (int) ((bitpos + 7) >> 3);
+}
+
+// Build the decoding table, spreading the symbols as the encoder does.
+static void
+zstd_build(ZstdFseEntry *t, const short *norm, unsigned max_sym,
+           unsigned log, unsigned short *next)
+{
+    unsigned const size = 1u << log;
+    unsigned const step = (size >> 1) + (size >> 3) + 3;
+    unsigned high = size - 1;
+    unsigned pos = 0, s, i, n;
+
+    for (s = 0; s <= max_sym; s++) {
+        if (norm[s] == -1) {
+            t[high--].sym = (unsigned char) s;
+            next[s] = 1;
+        } else {
+            next[s] = (unsigned short) norm[s];
+        }
+    }
+    for (s = 0; s <= max_sym; s++) {
+        for (i = 0; (int) i < norm[s]; i++) {
+            t[pos].sym = (unsigned char) s;
+            do
+                pos = (pos + step) & (size - 1);
+            while (pos > high);
+        }
+    }
+    for (i = 0; i < size; i++) {
+        n = next[t[i].sym]++;
+        t[i].nb = (unsigned char) (log - zstd_highbit(n));
+        t[i].base = (unsigned short) ((n << t[i].nb) - size);
+    }
+}
+
+
+/*************************************************************************
+// bit streams
+**************************************************************************/
+
+// A backward bit stream starts at the highest 1 bit of its last byte.
+static int
+zstd_bits_init(ZstdBits *b, const unsigned char *p, unsigned size)
+{
+    if (size == 0 || p[size - 1] == 0)
+        return 0;
+    b->p = p;
+    b->size = size;
+    b->pos = (int) ((size - 1) * 8 + zstd_highbit(p[size - 1]));
+    return 1;
+}
+
+// Return the next n <= 32 bits, reading zeros beyond the start.
+static unsigned
+zstd_peek(const ZstdBits *b, unsigned n)
+{
+    const unsigned char *q;
+    unsigned long long v;
+    unsigned k;
+    int lo = b->pos - (int) n;
+
+    if (n == 0 || b->pos <= 0)
+        return 0;
+    if (lo < 0) {
+        v = 0;
+        for (k = 0; k < 4 && k < b->size; k++)
+            v |= (unsigned long long) b->p[k] << (8 * k);
+        v &= (1ULL << b->pos) - 1;
+        return (unsigned) (v << -lo);
+    }
+    q = b->p + (lo >> 3);
+    if ((unsigned) (lo >> 3) + 8 <= b->size) {
+        v =  (unsigned long long) q[0]        | ((unsigned long long) q[1] << 8)
+          | ((unsigned long long) q[2] << 16) | ((unsigned long long) q[3] << 24)
+          | ((unsigned long long) q[4] << 32) | ((unsigned long long) q[5] << 40)
+          | ((unsigned long long) q[6] << 48) | ((unsigned long long) q[7] << 56);
+    } else {
+        v = 0;
+        for (k = 0; (unsigned) (lo >> 3) + k < b->size; k++)
+            v |= (unsigned long long) q[k] << (8 * k);
+    }
+    return (unsigned) ((v >> (lo & 7)) & ((1ULL << n) - 1));
+}
+
+static unsigned
+zstd_read(ZstdBits *b, unsigned n)
+{
+    unsigned v = zstd_peek(b, n);
+    b->pos -= (int) n;
+    return v;
+}
+
+// Return the 32 bits at bitpos of a forward bit stream, zeros beyond its end.
+static unsigned
+zstd_fwd_peek(const unsigned char *p, unsigned size, unsigned bitpos)
+{
+    unsigned long long v = 0;
+    unsigned i = bitpos >> 3, k;
+
+    for (k = 0; k < 5; k++)
+        if (i + k < size)
+            v |= (unsigned long long) p[i + k] << (8 * k);
+    return (unsigned) (v >> (bitpos & 7));
+}
+
+static unsigned
+zstd_highbit(unsigned x)
+{
+    unsigned r = 0;
+
+    while (x >>= 1)
+        r++;
+    return r;
+}
+
+/* vim:set ts=4 sw=4 et: */
@@ -723,6 +723,7 @@ struct b_info {     // 12-byte header before each compressed block
     unsigned char b_cto8;       // filter parameter
     unsigned char b_unused;
 };
+#define B_PAGES 0xff  // b_method: --hot-pages, sz_cpr counts padding too
 
 struct l_info       // 12-byte trailer in header for loader (offset 116)
 {
@@ -30,6 +30,7 @@
 #include "ui.h"
 #include "screen.h"
 #include "packer.h"
+#include "parallel.h"
 
 #if 1 && (USE_SCREEN)
 #define UI_USE_SCREEN 1
@@ -82,10 +83,13 @@ upx_uint64_t UiPacker::total_c_len = 0;
 upx_uint64_t UiPacker::total_u_len = 0;
 upx_uint64_t UiPacker::total_fc_len = 0;
 upx_uint64_t UiPacker::total_fu_len = 0;
-unsigned UiPacker::update_c_len = 0;
-unsigned UiPacker::update_u_len = 0;
-unsigned UiPacker::update_fc_len = 0;
-unsigned UiPacker::update_fu_len = 0;
+thread_local unsigned UiPacker::update_c_len = 0;
+thread_local unsigned UiPacker::update_u_len = 0;
+thread_local unsigned UiPacker::update_fc_len = 0;
+thread_local unsigned UiPacker::update_fu_len = 0;
+
+// several files may get processed at the same time
+static upx_mutex_t totals_lock;
 
 /*************************************************************************
 // constants
@@ -129,7 +133,7 @@ static void init_global_constants(void) {
 static const char *mkline(upx_uint64_t fu_len, upx_uint64_t fc_len, upx_uint64_t u_len,
                           upx_uint64_t c_len, const char *format_name, const char *filename,
                           bool decompress = false) {
-    static char buf[2048];
+    static thread_local char buf[2048];
     char r[7 + 1];
     char fn[15 + 1];
     const char *f;
@@ -173,7 +177,7 @@ UiPacker::UiPacker(const Packer *p_) : ui_pass(0), ui_total_passes(0), p(p_), s(
 
     if (opt->verbose < 0)
         s->mode = M_QUIET;
-    else if (opt->verbose == 0 || !acc_isatty(STDOUT_FILENO))
+    else if (opt->verbose == 0 || !acc_isatty(STDOUT_FILENO) || con_capture_active())
         s->mode = M_INFO;
     else if (opt->verbose == 1 || opt->no_progress)
         s->mode = M_MSG;
@@ -446,6 +450,7 @@ void UiPacker::doCallback(unsigned isize, unsigned osize) {
 **************************************************************************/
 
 void UiPacker::uiPackStart(const OutputFile *fo) {
+    MutexLocker guard(totals_lock);
     total_files++;
     UNUSED(fo);
 }
@@ -469,6 +474,18 @@ void UiPacker::uiPackEnd(const OutputFile *fo) {
     con_fprintf(stdout, "%s\n",
                 mkline(p->ph.u_file_size, fo->st_size(), p->ph.u_len, p->ph.c_len, p->getName(),
                        fn_basename(name)));
+    if (opt->verbose >= 3 && p->loader_cache_hits + p->loader_cache_misses > 0)
+        con_fprintf(stdout, "  loader cache: %u hits, %u misses\n", p->loader_cache_hits,
+                    p->loader_cache_misses);
+    if (opt->verbose >= 3 && p->rank_searches > 0)
+        con_fprintf(stdout,
+                    "  candidate ranking: predicted best won %u of %u times,"
+                    " worst predicted rank of a winner %u of %u\n",
+                    p->rank_hits, p->rank_searches, p->rank_worst, p->rank_candidates);
+    if (opt->verbose >= 3 && p->lzma_tuned)
+        con_fprintf(stdout, "  lzma tuning: lc=%u lp=%u pb=%u fb=%u\n",
+                    (unsigned) p->lzma_tune.lit_context_bits, (unsigned) p->lzma_tune.lit_pos_bits,
+                    (unsigned) p->lzma_tune.pos_bits, (unsigned) p->lzma_tune.num_fast_bytes);
     printSetNl(0);
 }
 
@@ -482,6 +499,7 @@ void UiPacker::uiPackTotal() {
 **************************************************************************/
 
 void UiPacker::uiUnpackStart(const OutputFile *fo) {
+    MutexLocker guard(totals_lock);
     total_files++;
     UNUSED(fo);
 }
@@ -512,7 +530,10 @@ void UiPacker::uiUnpackTotal() {
 // list
 **************************************************************************/
 
-void UiPacker::uiListStart() { total_files++; }
+void UiPacker::uiListStart() {
+    MutexLocker guard(totals_lock);
+    total_files++;
+}
 
 void UiPacker::uiList() {
     const char *name = p->fi->getName();
@@ -541,7 +562,10 @@ void UiPacker::uiListTotal(bool decompress) {
 **************************************************************************/
 
 void UiPacker::uiTestStart() {
-    total_files++;
+    {
+        MutexLocker guard(totals_lock);
+        total_files++;
+    }
 
     if (opt->verbose >= 1) {
         con_fprintf(stdout, "testing %s ", p->fi->getName());
@@ -566,7 +590,10 @@ void UiPacker::uiTestTotal() { uiFooter("Tested"); }
 **************************************************************************/
 
 bool UiPacker::uiFileInfoStart() {
-    total_files++;
+    {
+        MutexLocker guard(totals_lock);
+        total_files++;
+    }
 
     int fg = con_fg(stdout, FG_CYAN);
     con_fprintf(stdout, "%s [%s, %s]\n", p->fi->getName(), p->getFullName(opt), p->getName());
@@ -630,6 +657,7 @@ void UiPacker::uiUpdate(upx_off_t fc_len, upx_off_t fu_len) {
 }
 
 void UiPacker::uiConfirmUpdate() {
+    MutexLocker guard(totals_lock);
     total_files_done++;
     total_fc_len += update_fc_len;
     total_fu_len += update_fu_len;
@@ -103,10 +103,11 @@ protected:
     static upx_uint64_t total_u_len;
     static upx_uint64_t total_fc_len;
     static upx_uint64_t total_fu_len;
-    static unsigned update_c_len;
-    static unsigned update_u_len;
-    static unsigned update_fc_len;
-    static unsigned update_fu_len;
+    // pending update of the current file, see uiConfirmUpdate()
+    static thread_local unsigned update_c_len;
+    static thread_local unsigned update_u_len;
+    static thread_local unsigned update_fc_len;
+    static thread_local unsigned update_fu_len;
 };
 
 #endif /* already included */
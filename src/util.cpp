@@ -421,6 +421,12 @@ bool set_method_name(char *buf, size_t size, int method, int level) {
         alg = "NRV2E";
     else if (M_IS_LZMA(method))
         alg = "LZMA";
+    else if (M_IS_LZ4(method))
+        alg = "LZ4";
+    else if (M_IS_ZSTD(method))
+        alg = "ZSTD";
+    else if (M_IS_DEFLATE(method))
+        alg = "DEFLATE";
     else {
         alg = "???";
         r = false;
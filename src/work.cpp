@@ -30,6 +30,7 @@
 #include "packmast.h"
 #include "packer.h"
 #include "ui.h"
+#include "parallel.h"
 
 #if (ACC_OS_DOS32) && defined(__DJGPP__)
 #define USE_FTIME 1
@@ -53,6 +54,11 @@
 // process one file
 **************************************************************************/
 
+// With '-j' several files may want the same temporary or backup name
+// (for example "libfoo.so.1" and "libfoo.so.2" both map to "libfoo.so.upx").
+// Choosing a name and creating the file must be one step then.
+static upx_mutex_t names_lock;
+
 void do_one_file(const char *iname, char *oname) {
     int r;
     struct stat st;
@@ -113,6 +119,7 @@ void do_one_file(const char *iname, char *oname) {
             if (!fo.openStdout(1, opt->force ? true : false))
                 throwIOException("data not written to a terminal; Use '-f' to force.");
         } else {
+            MutexLocker guard(names_lock);
             char tname[ACC_FN_PATH_MAX + 1];
             if (opt->output_name)
                 strcpy(tname, opt->output_name);
@@ -193,6 +200,7 @@ void do_one_file(const char *iname, char *oname) {
             File::unlink(iname);
         } else {
             // make backup
+            MutexLocker guard(names_lock);
             char bakname[ACC_FN_PATH_MAX + 1];
             if (!makebakname(bakname, sizeof(bakname), iname))
                 throwIOException("could not create a backup file name");
@@ -236,7 +244,7 @@ void do_one_file(const char *iname, char *oname) {
 }
 
 /*************************************************************************
-// process all files from the commandline
+// error handling
 **************************************************************************/
 
 static void unlink_ofile(char *oname) {
@@ -251,6 +259,142 @@ static void unlink_ofile(char *oname) {
     }
 }
 
+// process one file and handle all errors; returns the exit code for
+// main_set_exit_code() and sets "fatal" if no more files should be processed
+static int do_one_file_safe(const char *iname, bool *fatal) {
+    char oname[ACC_FN_PATH_MAX + 1];
+    oname[0] = 0;
+    *fatal = false;
+
+    try {
+        do_one_file(iname, oname);
+    } catch (const Exception &e) {
+        unlink_ofile(oname);
+        if (opt->verbose >= 1 || (opt->verbose >= 0 && !e.isWarning()))
+            printErr(iname, &e);
+        // continue processing more files
+        return e.isWarning() ? EXIT_WARN : EXIT_ERROR;
+    } catch (const Error &e) {
+        unlink_ofile(oname);
+        printErr(iname, &e);
+        *fatal = true;
+        return EXIT_ERROR;
+    } catch (std::bad_alloc *e) {
+        unlink_ofile(oname);
+        printErr(iname, "out of memory");
+        UNUSED(e);
+        // delete e;
+        *fatal = true;
+        return EXIT_ERROR;
+    } catch (const std::bad_alloc &) {
+        unlink_ofile(oname);
+        printErr(iname, "out of memory");
+        *fatal = true;
+        return EXIT_ERROR;
+    } catch (std::exception *e) {
+        unlink_ofile(oname);
+        printUnhandledException(iname, e);
+        // delete e;
+        *fatal = true;
+        return EXIT_ERROR;
+    } catch (const std::exception &e) {
+        unlink_ofile(oname);
+        printUnhandledException(iname, &e);
+        *fatal = true;
+        return EXIT_ERROR;
+    } catch (...) {
+        unlink_ofile(oname);
+        printUnhandledException(iname, nullptr);
+        *fatal = true;
+        return EXIT_ERROR;
+    }
+    return EXIT_OK;
+}
+
+/*************************************************************************
+// process several files at once ('-j N')
+//
+// The biggest files are started first so that a single large file does not
+// end up running alone at the end. The output of each file is captured and
+// printed in commandline order as soon as all previous files are done,
+// so the log looks the same as for a serial run.
+**************************************************************************/
+
+namespace {
+struct FileJob {
+    const char *iname;
+    upx_off_t size;
+    con_capture_t output;
+    int exit_code;
+    bool fatal;
+    bool done;
+};
+} // namespace
+
+static int __acc_cdecl_qsort compare_job_size(const void *aa, const void *bb) {
+    const FileJob *a = *(const FileJob *const *) aa;
+    const FileJob *b = *(const FileJob *const *) bb;
+    if (a->size != b->size)
+        return a->size > b->size ? -1 : 1;
+    return a < b ? -1 : (a > b ? 1 : 0); // keep commandline order
+}
+
+static int do_files_parallel(int i, int argc, char *argv[]) {
+    const unsigned n = argc - i;
+    Array(FileJob, jobs, n);
+    Array(FileJob *, order, n);
+    memset(jobs, 0, mem_size(sizeof(FileJob), n));
+    for (unsigned k = 0; k < n; k++) {
+        FileJob *job = &jobs[k];
+        job->iname = argv[i + k];
+        struct stat st;
+        if (stat(job->iname, &st) == 0)
+            job->size = st.st_size;
+        order[k] = job;
+    }
+    qsort(order, n, sizeof(*order), compare_job_size);
+
+    upx_mutex_t lock;
+    unsigned next_print = 0;
+    bool fatal = false;
+    auto run_job = [&](unsigned k) {
+        FileJob *job = order[k];
+        {
+            MutexLocker guard(lock);
+            if (fatal)
+                return; // do not start any more files - see do_files()
+        }
+        con_capture_begin(&job->output);
+        infoHeader();
+        job->exit_code = do_one_file_safe(job->iname, &job->fatal);
+        con_capture_end();
+        // print all finished output in commandline order
+        MutexLocker guard(lock);
+        job->done = true;
+        if (job->fatal)
+            fatal = true;
+        while (next_print < n && jobs[next_print].done) {
+            FileJob *p = &jobs[next_print++];
+            con_capture_flush(&p->output);
+            main_set_exit_code(p->exit_code);
+        }
+    };
+    upx_parallel_for(n, opt->jobs, run_job);
+
+    // after a fatal error some files may not have been started at all
+    for (; next_print < n; next_print++) {
+        FileJob *p = &jobs[next_print];
+        con_capture_flush(&p->output);
+        if (p->done)
+            main_set_exit_code(p->exit_code);
+    }
+    return fatal ? -1 : 0;
+}
+
+/*************************************************************************
+// process all files from the commandline
+**************************************************************************/
+
 int do_files(int i, int argc, char *argv[]) {
     upx_compiler_sanity_check();
     if (opt->verbose >= 1) {
@@ -258,54 +402,18 @@ int do_files(int i, int argc, char *argv[]) {
         UiPacker::uiHeader();
     }
 
-    for (; i < argc; i++) {
-        infoHeader();
-
-        const char *iname = argv[i];
-        char oname[ACC_FN_PATH_MAX + 1];
-        oname[0] = 0;
-
-        try {
-            do_one_file(iname, oname);
-        } catch (const Exception &e) {
-            unlink_ofile(oname);
-            if (opt->verbose >= 1 || (opt->verbose >= 0 && !e.isWarning()))
-                printErr(iname, &e);
-            main_set_exit_code(e.isWarning() ? EXIT_WARN : EXIT_ERROR);
-            // continue processing more files
-        } catch (const Error &e) {
-            unlink_ofile(oname);
-            printErr(iname, &e);
-            main_set_exit_code(EXIT_ERROR);
-            return -1;
-        } catch (std::bad_alloc *e) {
-            unlink_ofile(oname);
-            printErr(iname, "out of memory");
-            UNUSED(e);
-            // delete e;
-            main_set_exit_code(EXIT_ERROR);
-            return -1;
-        } catch (const std::bad_alloc &) {
-            unlink_ofile(oname);
-            printErr(iname, "out of memory");
-            main_set_exit_code(EXIT_ERROR);
-            return -1;
-        } catch (std::exception *e) {
-            unlink_ofile(oname);
-            printUnhandledException(iname, e);
-            // delete e;
-            main_set_exit_code(EXIT_ERROR);
-            return -1;
-        } catch (const std::exception &e) {
-            unlink_ofile(oname);
-            printUnhandledException(iname, &e);
-            main_set_exit_code(EXIT_ERROR);
-            return -1;
-        } catch (...) {
-            unlink_ofile(oname);
-            printUnhandledException(iname, nullptr);
-            main_set_exit_code(EXIT_ERROR);
+    if (i < argc && upx_parallel_threads(argc - i, opt->jobs) > 1) {
+        if (do_files_parallel(i, argc, argv) != 0)
             return -1;
+    } else {
+        for (; i < argc; i++) {
+            infoHeader();
+            bool fatal;
+            int ec = do_one_file_safe(argv[i], &fatal);
+            if (ec != EXIT_OK)
+                main_set_exit_code(ec);
+            if (fatal)
+                return -1;
         }
     }
 